@@ -2,6 +2,8 @@
 from pydict import *
 from id import *
 from valid_hanzi import *
+from simptrad import *
+import getopt
 import sys
 
 def get_sheng_yun(pinyin):
@@ -27,7 +29,7 @@ def read_phrases(filename):
             continue
         yield hanzi, freq, pinyin
 
-def create_db(filename):
+def create_db(filename, converter=None):
     # import sqlite3
     # con = sqlite3.connect("main.db")
     # con.execute ("PRAGMA synchronous = NORMAL;")
@@ -48,6 +50,12 @@ def create_db(filename):
         # con.execute(sql % (i, column))
         # con.commit()
 
+    if converter:
+        # the library takes the phrases as they are, instead of converting
+        # them to traditional Chinese
+        print "CREATE TABLE desc (name PRIMARY KEY, value TEXT);"
+        print "INSERT INTO desc VALUES ('script', 'traditional');"
+
     records = list(read_phrases(filename))
     records.sort(lambda a, b: 1 if a[1] > b[1] else -1)
     records_new = []
@@ -60,6 +68,19 @@ def create_db(filename):
         records_new.append((hanzi, i, pinyin))
     records_new.reverse()
     
+    if converter:
+        # converts the whole phrases, and keeps the most frequent one of
+        # the phrases becoming the same
+        records_trad = []
+        converted = set()
+        for hanzi, freq, pinyin in records_new:
+            hanzi = converter.convert(hanzi)
+            if (hanzi, tuple(pinyin)) in converted:
+                continue
+            converted.add((hanzi, tuple(pinyin)))
+            records_trad.append((hanzi, freq, pinyin))
+        records_new = records_trad
+
     print "BEGIN;"
     insert_sql = "INSERT INTO py_phrase_%d VALUES (%s);"
     for hanzi, freq, pinyin in records_new:
@@ -76,8 +97,22 @@ def create_db(filename):
     print "COMMIT;"
     print "VACUUM;"
 
+def usage():
+    sys.stderr.write("Usage: %s [--trad=SimpTradConverterTable.h] rawdict.txt\n" % sys.argv[0])
+    sys.exit(1)
+
 def main():
-    create_db(sys.argv[1])
+    try:
+        opts, args = getopt.getopt(sys.argv[1:], "", ["trad="])
+    except getopt.GetoptError:
+        usage()
+    if len(args) != 1:
+        usage()
+    converter = None
+    for o, a in opts:
+        if o == "--trad":
+            converter = SimpTrad(a)
+    create_db(args[0], converter)
  
 if __name__ == "__main__":
     main()
@@ -0,0 +1 @@
+../../../scripts/simptrad.py
\ No newline at end of file
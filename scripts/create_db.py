@@ -1,8 +1,17 @@
 import sqlite3
 from pydict import *
 from id import *
+from simptrad import *
+import getopt
 import sys
 
+# --trad=SimpTradConverterTable.h stores the phrases in traditional Chinese
+converter = None
+opts, args = getopt.getopt(sys.argv[1:], "", ["trad="])
+for o, a in opts:
+	if o == "--trad":
+		converter = SimpTrad(a)
+
 con1 = sqlite3.connect("py.db")
 con2 = sqlite3.connect("py-new.db")
 con2.execute ("PRAGMA synchronous = NORMAL;")
@@ -18,6 +27,9 @@ for i in range(0, 16):
 		column.append ("y%d INTEGER" % j)
 	column = ",".join(column)
 	con2.execute(sql % (i, column))
+if converter:
+	con2.execute("CREATE TABLE desc (name PRIMARY KEY, value TEXT)")
+	con2.execute("INSERT INTO desc VALUES ('script', 'traditional')")
 con2.commit()
 
 def get_sheng_yun(pinyin):
@@ -41,14 +53,20 @@ def encode_pinyin(pinyin):
 	return e
 
 insert_sql = "INSERT INTO py_phrase_%d VALUES (%s);"
+delete_sql = "DELETE FROM py_phrase_%d WHERE rowid = ?;"
 con2.commit()
 new_freq = 0
 freq = 0
+# the rowid of each converted (phrase, pinyin), so a more frequent phrase
+# becoming the same replaces the row inserted before
+converted = {}
 
 print "INSERTING"
 for  r in con1.execute("SELECT * FROM py_phrase ORDER BY freq"):
 	ylen = r[0]
 	phrase = r[10]
+	if converter:
+		phrase = converter.convert(phrase)
 	if r[11] > freq:
 		freq = r[11]
 		new_freq += 1
@@ -72,8 +90,15 @@ for  r in con1.execute("SELECT * FROM py_phrase ORDER BY freq"):
 	
 	column = [phrase, new_freq] + map(encode_pinyin, sheng_yun)
 
+	if converter:
+		key = (i, phrase, tuple(sheng_yun))
+		if key in converted:
+			con2.execute (delete_sql % i, (converted[key], ))
+
 	sql = insert_sql % (i, ",".join(["?"] * len(column)))
-	con2.execute (sql, column)
+	cur = con2.execute (sql, column)
+	if converter:
+		converted[key] = cur.lastrowid
 
 print "Remove duplicate"
 for i in xrange(0, 16):
@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+# vim:set et sts=4 sw=4:
+# -*- coding: utf-8 -*-
+
+# Compiles a sqlite phrase database (main.db, android.db, ...) into the
+# read-only memory-mapped dictionary format loaded by src/MappedDictionary.cc.
+#
+# Layout (native byte order, all offsets from the beginning of the file):
+#
+#   header   "PYZYDICT", version, table count,
+#            MAX_PHRASE_LEN x (offset, count), text offset, text size,
+#            flags (since version 2)
+#   tables   py_phrase_N records sorted by (s0, y0, s1, y1, ...) and then
+#            by freq in descending order. A record is
+#            (text offset, freq, s0, y0, ..., sN, yN) padded to 4 bytes.
+#   text     NUL terminated utf-8 phrases
+#
+# FLAG_TRADITIONAL is set when the phrases are traditional Chinese, which the
+# create_db.py scripts record in the desc table when run with --trad.
+
+import sqlite3
+import struct
+import sys
+
+MAGIC = b"PYZYDICT"
+VERSION = 2
+MAX_PHRASE_LEN = 16
+FLAG_TRADITIONAL = 1
+
+def record_size(i):
+    return 8 + ((2 * (i + 1) + 3) & ~3)
+
+def read_tables(db):
+    con = sqlite3.connect(db)
+    for i in range(0, MAX_PHRASE_LEN):
+        columns = ",".join(["s%d,y%d" % (j, j) for j in range(0, i + 1)])
+        sql = "SELECT phrase, freq, %s FROM py_phrase_%d" % (columns, i)
+        rows = []
+        for r in con.execute(sql):
+            phrase = r[0]
+            if not isinstance(phrase, bytes):
+                phrase = phrase.encode("utf8")
+            rows.append((tuple(r[2:]), -int(r[1]), phrase))
+        rows.sort()
+        yield rows
+
+def read_flags(db):
+    con = sqlite3.connect(db)
+    try:
+        rows = list(con.execute("SELECT value FROM desc WHERE name = 'script'"))
+    except sqlite3.OperationalError:
+        # no desc table
+        rows = []
+    if rows and rows[0][0] == "traditional":
+        return FLAG_TRADITIONAL
+    return 0
+
+def create_dict(db, filename):
+    tables = list(read_tables(db))
+    flags = read_flags(db)
+
+    texts = {}
+    text_pool = []
+    text_size = 0
+    for rows in tables:
+        for ids, freq, phrase in rows:
+            if phrase not in texts:
+                texts[phrase] = text_size
+                text_pool.append(phrase + b"\0")
+                text_size += len(phrase) + 1
+
+    header_size = len(MAGIC) + 4 * 2 + MAX_PHRASE_LEN * 8 + 4 * 3
+    offset = header_size
+    entries = []
+    for i, rows in enumerate(tables):
+        entries.append((offset, len(rows)))
+        offset += record_size(i) * len(rows)
+    text_offset = offset
+
+    out = open(filename, "wb")
+    out.write(MAGIC)
+    out.write(struct.pack("=II", VERSION, MAX_PHRASE_LEN))
+    for table_offset, count in entries:
+        out.write(struct.pack("=II", table_offset, count))
+    out.write(struct.pack("=III", text_offset, text_size, flags))
+
+    for i, rows in enumerate(tables):
+        pad = record_size(i) - 8 - 2 * (i + 1)
+        for ids, freq, phrase in rows:
+            out.write(struct.pack("=II", texts[phrase], -freq))
+            out.write(struct.pack("=%dB" % len(ids), *ids))
+            out.write(b"\0" * pad)
+
+    out.write(b"".join(text_pool))
+    out.close()
+
+def main():
+    if len(sys.argv) != 3:
+        sys.stderr.write("Usage: %s input.db output.dict\n" % sys.argv[0])
+        sys.exit(1)
+    create_dict(sys.argv[1], sys.argv[2])
+
+if __name__ == "__main__":
+    main()
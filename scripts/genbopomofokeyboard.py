@@ -73,25 +73,18 @@ bopomofo_keyboard = (
     ),
 )
 
-def tochar(ch):
-    if ch == "'" or ch == "\\":
-        ch = "\\" + ch;
-    return "'" + ch + "'"
-
 def gen_table():
-    i = 0
+    # a key indexes the bopomofo of its schema directly
     print 'static const unsigned char'
-    print 'bopomofo_keyboard[][41][2] = {'
+    print 'bopomofo_keyboard[][128] = {'
     for keyboard in bopomofo_keyboard:
+        keys = {}
+        for i, v in enumerate(keyboard):
+            keys[ord(v)] = bopomofo[i + 1]
         print '    {'
-        items = []
-        i=1
-        for v in keyboard:
-            items.append ((v,bopomofo[i]));
-            i += 1
-        items.sort()
-        for k,v in items:
-            print '        { %-4s, %-15s },' % (tochar(k),v)
+        for i in xrange(0, 128, 4):
+            items = ["%-16s" % (keys.get(c, "BOPOMOFO_ZERO") + ",") for c in xrange(i, i + 4)]
+            print '        /* 0x%02x */ %s' % (i, " ".join(items).rstrip())
         print '    },'
     print '};'
     print
@@ -325,6 +325,79 @@ def gen_table():
 
     return pinyins
 
+def gen_pinyin_trie(pinyins):
+    # nodes are numbered breadth first, so the children of a node are
+    # consecutive and ordered by letter
+    index = {}
+    for i, p in enumerate(pinyins):
+        index[p[0]] = i
+
+    prefixes = set([""])
+    for text in index:
+        for i in range(1, len(text) + 1):
+            prefixes.add(text[:i])
+
+    nodes = [""]
+    numbers = {"": 0}
+    for prefix in nodes:
+        for c in "abcdefghijklmnopqrstuvwxyz":
+            if prefix + c in prefixes:
+                numbers[prefix + c] = len(nodes)
+                nodes.append(prefix + c)
+
+    print 'static const PinyinTrieNode pinyin_trie[] = {'
+    for prefix in nodes:
+        mask = 0
+        first = 0
+        for i, c in enumerate("abcdefghijklmnopqrstuvwxyz"):
+            if prefix + c in numbers:
+                if mask == 0:
+                    first = numbers[prefix + c]
+                mask |= 1 << i
+        print '    %-32s /* %d "%s" */' % \
+            ('{ 0x%07x, %d, %d },' % (mask, first, index.get(prefix, -1)),
+             numbers[prefix], prefix)
+    print '};'
+    print
+
+def gen_bopomofo_trie(pinyins):
+    # the bopomofo letters are U+3105 to U+3129, so a node keeps its
+    # children in a 37-bit mask of letter - U+3105, and nodes are numbered
+    # breadth first like in pinyin_trie
+    index = {}
+    for i, p in enumerate(pinyins):
+        if p[1]:
+            index[p[1].decode("utf-8")] = i
+
+    prefixes = set([u""])
+    for text in index:
+        for i in range(1, len(text) + 1):
+            prefixes.add(text[:i])
+
+    letters = [unichr(c) for c in xrange(0x3105, 0x312a)]
+    nodes = [u""]
+    numbers = {u"": 0}
+    for prefix in nodes:
+        for c in letters:
+            if prefix + c in prefixes:
+                numbers[prefix + c] = len(nodes)
+                nodes.append(prefix + c)
+
+    print 'static const BopomofoTrieNode bopomofo_trie[] = {'
+    for prefix in nodes:
+        mask = 0
+        first = 0
+        for i, c in enumerate(letters):
+            if prefix + c in numbers:
+                if mask == 0:
+                    first = numbers[prefix + c]
+                mask |= 1 << i
+        print '    %-48s /* %d "%s" */' % \
+            ('{ G_GUINT64_CONSTANT (0x%010x), %d, %d },' % (mask, first, index.get(prefix, -1)),
+             numbers[prefix], prefix.encode("utf-8"))
+    print '};'
+    print
+
 def gen_bopomofo_table(pinyins):
     bopomofo_table = [ (i, p) for i, p in enumerate(pinyins)]
     bopomofo_table.sort(lambda a, b: cmp(a[1][1], b[1][1]))
@@ -422,14 +495,102 @@ def gen_special_table(pinyins):
     print '};'
     print
 
+    return l
+
+def get_special_displacements(keys, size, buckets):
+    # hash and displace: the keys of a bucket, key % buckets, go to the
+    # slots (key / buckets + displacement) % size, and the biggest buckets
+    # are placed first
+    bucket_keys = {}
+    for k in keys:
+        bucket_keys.setdefault(k % buckets, []).append(k)
+
+    used = set([])
+    displacements = [0] * buckets
+    for b, ks in sorted(bucket_keys.items(), key=lambda x: (-len(x[1]), x[0])):
+        for d in xrange(0, size):
+            slots = set([(k / buckets + d) % size for k in ks])
+            if len(slots) == len(ks) and not (slots & used):
+                used |= slots
+                displacements[b] = d
+                break
+        else:
+            return None
+    return displacements
+
+def gen_special_hash(pinyins, special):
+    # a perfect hash of the pairs of special_table, the key of a pair is
+    # index1 * len(pinyins) + index2
+    _dict = {}
+    for i in xrange(0, len(pinyins)):
+        _dict[pinyins[i][0]] = i
+
+    keys = [_dict[r[0]] * len(pinyins) + _dict[r[1]] for r in special]
+    size = 1
+    while size < len(keys):
+        size *= 2
+    buckets = size / 8
+    displacements = get_special_displacements(keys, size, buckets)
+    while displacements == None:
+        buckets *= 2
+        displacements = get_special_displacements(keys, size, buckets)
+
+    table = [-1] * size
+    for i, k in enumerate(keys):
+        table[(k / buckets + displacements[k % buckets]) % size] = i
+
+    print 'static const guint16 special_displacement[] = {'
+    for i in xrange(0, buckets, 12):
+        print '    %s' % " ".join(["%d," % v for v in displacements[i:i + 12]])
+    print '};'
+    print
+    print 'static const gint16 special_hash[] = {'
+    for i in xrange(0, size, 12):
+        print '    %s' % " ".join(["%d," % v for v in table[i:i + 12]])
+    print '};'
+    print
+
+def gen_sheng_yun_table(pinyins):
+    _dict = {}
+    for i in xrange(0, len(pinyins)):
+        _dict[pinyins[i][0]] = i
+
+    # yun ids start after the sheng ids, and ue is ve after most shengs
+    shengs = [""] + shengmu_list
+    print 'static const gint16 sheng_yun_table[%d][%d] = {' % \
+        (len(shengs), id_dict["v"] + 1)
+    for s in shengs:
+        row = []
+        for y in xrange(0, id_dict["v"] + 1):
+            if y == 0:
+                text = s
+            elif y < id_dict["a"]:
+                text = ""
+            else:
+                yun = shengmu_yunmu_list[y - 1]
+                if yun == "ue" and s not in ["j", "q", "x", "y"]:
+                    yun = "ve"
+                text = s + yun
+            row.append(_dict.get(text, -1) if text else -1)
+        print '    {   /* "%s" */' % s
+        for i in xrange(0, len(row), 12):
+            print '        %s' % " ".join(["%d," % v for v in row[i:i + 12]])
+        print '    },'
+    print '};'
+    print
+
 
 def main():
     # gen_header()
     # gen_macros()
     pinyins = gen_table()
+    gen_pinyin_trie(pinyins)
+    gen_sheng_yun_table(pinyins)
     # gen_full_pinyin_table (pinyins)
-    gen_bopomofo_table(pinyins)
-    gen_special_table(pinyins)
+    # gen_bopomofo_table(pinyins)
+    gen_bopomofo_trie(pinyins)
+    special = gen_special_table(pinyins)
+    gen_special_hash(pinyins, special)
     # gen_option_check("pinyin_option_check_sheng", fuzzy_shengmu)
     # gen_option_check("pinyin_option_check_yun", fuzzy_yunmu)
 
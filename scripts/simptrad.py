@@ -0,0 +1,49 @@
+# -*- coding: utf-8 -*-
+# vim:set et sts=4 sw=4:
+
+# Converts simplified Chinese phrases to traditional Chinese with the table
+# of src/SimpTradConverterTable.h, matching the longest simplified words
+# the same way src/SimpTradConverter.cc does, so a database built with
+# traditional phrases holds what the library would convert them to.
+
+import re
+
+RECORD = re.compile(r'^\s*\{ "([^"]*)", "([^"]*)" \},$')
+
+class SimpTrad:
+    def __init__(self, filename):
+        self.table = {}
+        self.maxlen = 0
+        in_table = False
+        for l in open(filename):
+            if l.startswith("static const char *simp_to_trad[][2]"):
+                in_table = True
+                continue
+            if not in_table:
+                continue
+            if l.startswith("};"):
+                break
+            m = RECORD.match(l)
+            if m:
+                s = m.group(1).decode("utf8")
+                t = m.group(2).decode("utf8")
+                self.table[s] = t
+                self.maxlen = max(self.maxlen, len(s))
+
+    def convert(self, s):
+        out = []
+        begin = 0
+        end = len(s)
+        while begin < end:
+            t = None
+            for i in xrange(min(self.maxlen, end - begin), 0, -1):
+                t = self.table.get(s[begin:begin + i])
+                if t:
+                    break
+            if t:
+                out.append(t)
+            else:
+                i = 1
+                out.append(s[begin])
+            begin += i
+        return u"".join(out)
@@ -57,6 +57,59 @@ def get_records():
     records.sort()
     return maxlen, records
 
+def gen_double_array(records):
+    # a trie of the utf-8 bytes of the simplified texts in a double array:
+    # the child of node s for byte c is t = base[s] + c if check[t] == s,
+    # and trad[t] is the index of the record t ends, or -1
+    children = [{}]
+    trads = [-1]
+    for i, (s, ts) in enumerate(records):
+        node = 0
+        for c in map(ord, s):
+            if c not in children[node]:
+                children[node][c] = len(children)
+                children.append({})
+                trads.append(-1)
+            node = children[node][c]
+        trads[node] = i
+
+    base = [0]
+    check = [0]
+    trad = [trads[0]]
+    position = {0: 0}
+    holes = []          # the free cells before the end of the array
+    queue = [0]
+    for node in queue:
+        s = position[node]
+        keys = sorted(children[node])
+        if not keys:
+            continue
+        # the first base all the children fit in, tried at the free cells
+        for f in holes + [max(len(check), keys[0] + 1)]:
+            b = f - keys[0]
+            if b >= 1 and not [c for c in keys if b + c < len(check) and check[b + c] >= 0]:
+                break
+        size = b + keys[-1] + 1
+        if size > len(check):
+            holes += range(len(check), size)
+            base += [0] * (size - len(base))
+            check += [-1] * (size - len(check))
+            trad += [-1] * (size - len(trad))
+        base[s] = b
+        for c in keys:
+            child = children[node][c]
+            position[child] = b + c
+            check[b + c] = s
+            trad[b + c] = trads[child]
+            holes.remove(b + c)
+            queue.append(child)
+
+    print "static const SimpTradNode simp_to_trad_trie[] = {"
+    for i in range(0, len(base), 4):
+        print "    " + " ".join(["{ %d, %d, %d }," % (base[j], check[j], trad[j])
+                                 for j in range(i, min(i + 4, len(base)))])
+    print "};"
+
 def main():
     print "static const char *simp_to_trad[][2] = {"
     maxlen, records = get_records()
@@ -64,6 +117,8 @@ def main():
         print '    { "%s", "%s" },' % (s, ts)
     print "};"
     print '#define SIMP_TO_TRAD_MAX_LEN (%d)' % maxlen
+    print
+    gen_double_array(records)
 
 if __name__ == "__main__":
     main()
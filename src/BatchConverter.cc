@@ -0,0 +1,197 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#include "BatchConverter.h"
+
+#include "Converter.h"
+
+namespace PyZy {
+
+/* lines converted by a thread between looking at the queues */
+#define BATCH_CHUNK_SIZE (64)
+
+BatchConverter::BatchConverter (const Converter &converter, size_t threads)
+    : m_converter (converter)
+    , m_batch (0)
+    , m_pending (0)
+    , m_quit (false)
+    , m_pinyins (NULL)
+    , m_texts (NULL)
+{
+    g_mutex_init (&m_mutex);
+    g_cond_init (&m_start_cond);
+    g_cond_init (&m_done_cond);
+
+    threads = MAX (threads, (size_t) 1);
+    for (size_t i = 0; i < threads; i++) {
+        Worker *worker = new Worker ();
+        worker->batch = this;
+        worker->index = i;
+        g_mutex_init (&worker->lock);
+        m_workers.push_back (std::unique_ptr<Worker> (worker));
+    }
+    /* the workers are all set up before any thread steals */
+    for (size_t i = 0; i < threads; i++) {
+        m_workers[i]->thread = g_thread_new ("pyzy-convert", BatchConverter::threadFunc,
+                                             static_cast<gpointer> (m_workers[i].get ()));
+    }
+}
+
+BatchConverter::~BatchConverter (void)
+{
+    wait ();
+
+    g_mutex_lock (&m_mutex);
+    m_quit = true;
+    g_cond_broadcast (&m_start_cond);
+    g_mutex_unlock (&m_mutex);
+
+    for (size_t i = 0; i < m_workers.size (); i++) {
+        g_thread_join (m_workers[i]->thread);
+        g_mutex_clear (&m_workers[i]->lock);
+    }
+    g_cond_clear (&m_done_cond);
+    g_cond_clear (&m_start_cond);
+    g_mutex_clear (&m_mutex);
+}
+
+void
+BatchConverter::start (const std::vector<std::string> &pinyins,
+                       std::vector<std::string>       &texts)
+{
+    wait ();
+
+    texts.clear ();
+    texts.resize (pinyins.size ());
+    if (pinyins.empty ())
+        return;
+
+    size_t chunks = (pinyins.size () + BATCH_CHUNK_SIZE - 1) / BATCH_CHUNK_SIZE;
+
+    /* a worker still looking at the queues may take a chunk as soon as it
+     * is queued, so the batch is set up first */
+    g_mutex_lock (&m_mutex);
+    m_pinyins = &pinyins;
+    m_texts = &texts;
+    m_pending = chunks;
+    g_mutex_unlock (&m_mutex);
+
+    /* every worker gets the same number of neighbouring chunks */
+    size_t workers = m_workers.size ();
+    for (size_t i = 0; i < workers; i++) {
+        Worker &worker = *m_workers[i];
+        g_mutex_lock (&worker.lock);
+        for (size_t chunk = chunks * i / workers; chunk < chunks * (i + 1) / workers; chunk++)
+            worker.chunks.push_back (chunk);
+        g_mutex_unlock (&worker.lock);
+    }
+
+    g_mutex_lock (&m_mutex);
+    m_batch ++;
+    g_cond_broadcast (&m_start_cond);
+    g_mutex_unlock (&m_mutex);
+}
+
+void
+BatchConverter::wait (void)
+{
+    g_mutex_lock (&m_mutex);
+    while (m_pending != 0)
+        g_cond_wait (&m_done_cond, &m_mutex);
+    m_pinyins = NULL;
+    m_texts = NULL;
+    g_mutex_unlock (&m_mutex);
+}
+
+/* takes a chunk from the front of the own queue, or from the back of the
+ * queue of another worker */
+bool
+BatchConverter::take (size_t index, size_t &chunk)
+{
+    size_t workers = m_workers.size ();
+    for (size_t i = 0; i < workers; i++) {
+        Worker &worker = *m_workers[(index + i) % workers];
+        g_mutex_lock (&worker.lock);
+        bool found = !worker.chunks.empty ();
+        if (found) {
+            if (i == 0) {
+                chunk = worker.chunks.front ();
+                worker.chunks.pop_front ();
+            }
+            else {
+                chunk = worker.chunks.back ();
+                worker.chunks.pop_back ();
+            }
+        }
+        g_mutex_unlock (&worker.lock);
+        if (found)
+            return true;
+    }
+    return false;
+}
+
+void
+BatchConverter::convertChunk (size_t chunk)
+{
+    size_t begin = chunk * BATCH_CHUNK_SIZE;
+    size_t end = MIN (begin + BATCH_CHUNK_SIZE, m_pinyins->size ());
+    for (size_t i = begin; i < end; i++)
+        (*m_texts)[i] = m_converter.convert ((*m_pinyins)[i]);
+}
+
+void
+BatchConverter::run (Worker &worker)
+{
+    guint batch = 0;
+
+    g_mutex_lock (&m_mutex);
+    for (;;) {
+        while (m_batch == batch && !m_quit)
+            g_cond_wait (&m_start_cond, &m_mutex);
+        if (m_quit)
+            break;
+        batch = m_batch;
+        g_mutex_unlock (&m_mutex);
+
+        /* the batch can not finish while this worker holds a chunk */
+        size_t chunk, done = 0;
+        while (take (worker.index, chunk)) {
+            convertChunk (chunk);
+            done ++;
+        }
+
+        g_mutex_lock (&m_mutex);
+        m_pending -= done;
+        if (done != 0 && m_pending == 0)
+            g_cond_broadcast (&m_done_cond);
+    }
+    g_mutex_unlock (&m_mutex);
+}
+
+gpointer
+BatchConverter::threadFunc (gpointer data)
+{
+    Worker *worker = static_cast<Worker *> (data);
+    worker->batch->run (*worker);
+    return NULL;
+}
+
+};  // namespace PyZy
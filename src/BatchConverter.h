@@ -0,0 +1,88 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#ifndef __PYZY_BATCH_CONVERTER_H_
+#define __PYZY_BATCH_CONVERTER_H_
+
+#include <glib.h>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "Util.h"
+
+namespace PyZy {
+
+class Converter;
+
+/*
+ * Converts batches of pinyin lines with a pool of threads. A batch is cut
+ * into chunks of lines, and every thread gets a queue of neighbouring
+ * chunks. A thread converts the chunks from the front of its own queue;
+ * when its queue is empty, it steals chunks from the back of the queues
+ * of the others, so a thread that gets slow lines does not hold the
+ * batch up.
+ *
+ * The caller may read the next batch while the threads convert one.
+ */
+class BatchConverter {
+public:
+    BatchConverter (const Converter &converter, size_t threads);
+    ~BatchConverter (void);
+
+    /* starts converting pinyins to texts, which must not change until
+     * wait () returns */
+    void start (const std::vector<std::string> &pinyins,
+                std::vector<std::string>       &texts);
+    void wait (void);
+
+private:
+    struct Worker {
+        BatchConverter *batch;
+        size_t index;
+        GThread *thread;
+        GMutex lock;
+        std::deque<size_t> chunks;
+    };
+
+    bool take (size_t index, size_t &chunk);
+    void convertChunk (size_t chunk);
+    void run (Worker &worker);
+    static gpointer threadFunc (gpointer data);
+
+private:
+    const Converter &m_converter;
+    std::vector<std::unique_ptr<Worker> > m_workers;
+
+    GMutex m_mutex;
+    GCond m_start_cond;
+    GCond m_done_cond;
+    guint m_batch;          /* sequence number of the running batch */
+    size_t m_pending;       /* chunks of the batch not converted yet */
+    bool m_quit;
+
+    const std::vector<std::string> *m_pinyins;
+    std::vector<std::string> *m_texts;
+};
+
+};  // namespace PyZy
+
+#endif  // __PYZY_BATCH_CONVERTER_H_
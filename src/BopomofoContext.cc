@@ -24,13 +24,13 @@
 
 #include "Config.h"
 #include "PinyinParser.h"
-#include "SimpTradConverter.h"
 
 namespace PyZy {
 #include "BopomofoKeyboard.h"
 
-BopomofoContext::BopomofoContext (PhoneticContext::Observer *observer)
-    : PhoneticContext (observer),
+BopomofoContext::BopomofoContext (PhoneticContext::Observer *observer,
+                                  const DatabasePtr &database)
+    : PhoneticContext (observer, database),
       m_bopomofo_schema (BOPOMOFO_KEYBOARD_STANDARD)
 {
 }
@@ -393,13 +393,9 @@ BopomofoContext::updatePreeditText (void)
                 m_buffer << textAfterCursor ();
             }
             else {
-                const Phrase & candidate = m_phrase_editor.candidate (index - m_special_phrases.size ());
                 if (m_text.size () == m_cursor) {
                     /* cursor at end */
-                    if (m_config.modeSimp)
-                        m_buffer << candidate;
-                    else
-                        SimpTradConverter::simpToTrad (candidate, m_buffer);
+                    m_buffer << m_phrase_editor.candidateText (index - m_special_phrases.size ());
                     edit_end_byte = m_buffer.size ();
                     /* append rest text */
                     for (const char *p=m_text.c_str() + m_pinyin_len; *p ;++p) {
@@ -459,27 +455,12 @@ BopomofoContext::setProperty (PropertyName name, const Variant &variant)
     return PhoneticContext::setProperty (name, variant);
 }
 
-static int
-keyboard_cmp (const void * p1, const void * p2)
-{
-    const int s1 = GPOINTER_TO_INT (p1);
-    const unsigned char *s2 = (const unsigned char *) p2;
-    return s1 - s2[0];
-}
-
 int
 BopomofoContext::keyvalToBopomofo(int ch)
 {
-    const unsigned int keyboard = m_bopomofo_schema;
-    const unsigned char *brs;
-    brs = (const unsigned char *) std::bsearch (GINT_TO_POINTER (ch),
-                                       bopomofo_keyboard[keyboard],
-                                       G_N_ELEMENTS (bopomofo_keyboard[keyboard]),
-                                       sizeof(bopomofo_keyboard[keyboard][0]),
-                                       keyboard_cmp);
-    if (G_UNLIKELY (brs == NULL))
+    if (G_UNLIKELY (ch < 0 || ch >= (int) G_N_ELEMENTS (bopomofo_keyboard[0])))
         return BOPOMOFO_ZERO;
-    return brs[1];
+    return bopomofo_keyboard[m_bopomofo_schema][ch];
 }
 
 };  // namespace PyZy
@@ -30,7 +30,8 @@ namespace PyZy {
 class BopomofoContext : public PhoneticContext {
 
 public:
-    explicit BopomofoContext (PhoneticContext::Observer *observer);
+    BopomofoContext (PhoneticContext::Observer *observer,
+                     const DatabasePtr &database);
     virtual ~BopomofoContext (void);
 
     /* API of InputContext */
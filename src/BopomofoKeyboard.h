@@ -26,178 +26,142 @@
 #include "Bopomofo.h"
 
 static const unsigned char
-bopomofo_keyboard[][41][2] = {
+bopomofo_keyboard[][128] = {
     {
-        { ',' , BOPOMOFO_E2     },
-        { '-' , BOPOMOFO_ER     },
-        { '.' , BOPOMOFO_OU     },
-        { '/' , BOPOMOFO_ENG    },
-        { '0' , BOPOMOFO_AN     },
-        { '1' , BOPOMOFO_B      },
-        { '2' , BOPOMOFO_D      },
-        { '3' , BOPOMOFO_TONE_3 },
-        { '4' , BOPOMOFO_TONE_4 },
-        { '5' , BOPOMOFO_ZH     },
-        { '6' , BOPOMOFO_TONE_2 },
-        { '7' , BOPOMOFO_TONE_5 },
-        { '8' , BOPOMOFO_A      },
-        { '9' , BOPOMOFO_AI     },
-        { ';' , BOPOMOFO_ANG    },
-        { 'a' , BOPOMOFO_M      },
-        { 'b' , BOPOMOFO_R      },
-        { 'c' , BOPOMOFO_H      },
-        { 'd' , BOPOMOFO_K      },
-        { 'e' , BOPOMOFO_G      },
-        { 'f' , BOPOMOFO_Q      },
-        { 'g' , BOPOMOFO_SH     },
-        { 'h' , BOPOMOFO_C      },
-        { 'i' , BOPOMOFO_O      },
-        { 'j' , BOPOMOFO_U      },
-        { 'k' , BOPOMOFO_E      },
-        { 'l' , BOPOMOFO_AO     },
-        { 'm' , BOPOMOFO_V      },
-        { 'n' , BOPOMOFO_S      },
-        { 'o' , BOPOMOFO_EI     },
-        { 'p' , BOPOMOFO_EN     },
-        { 'q' , BOPOMOFO_P      },
-        { 'r' , BOPOMOFO_J      },
-        { 's' , BOPOMOFO_N      },
-        { 't' , BOPOMOFO_CH     },
-        { 'u' , BOPOMOFO_I      },
-        { 'v' , BOPOMOFO_X      },
-        { 'w' , BOPOMOFO_T      },
-        { 'x' , BOPOMOFO_L      },
-        { 'y' , BOPOMOFO_Z      },
-        { 'z' , BOPOMOFO_F      },
+        /* 0x00 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x04 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x08 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x0c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x10 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x14 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x18 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x1c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x20 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x24 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x28 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x2c */ BOPOMOFO_E2,     BOPOMOFO_ER,     BOPOMOFO_OU,     BOPOMOFO_ENG,
+        /* 0x30 */ BOPOMOFO_AN,     BOPOMOFO_B,      BOPOMOFO_D,      BOPOMOFO_TONE_3,
+        /* 0x34 */ BOPOMOFO_TONE_4, BOPOMOFO_ZH,     BOPOMOFO_TONE_2, BOPOMOFO_TONE_5,
+        /* 0x38 */ BOPOMOFO_A,      BOPOMOFO_AI,     BOPOMOFO_ZERO,   BOPOMOFO_ANG,
+        /* 0x3c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x40 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x44 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x48 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x4c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x50 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x54 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x58 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x5c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x60 */ BOPOMOFO_ZERO,   BOPOMOFO_M,      BOPOMOFO_R,      BOPOMOFO_H,
+        /* 0x64 */ BOPOMOFO_K,      BOPOMOFO_G,      BOPOMOFO_Q,      BOPOMOFO_SH,
+        /* 0x68 */ BOPOMOFO_C,      BOPOMOFO_O,      BOPOMOFO_U,      BOPOMOFO_E,
+        /* 0x6c */ BOPOMOFO_AO,     BOPOMOFO_V,      BOPOMOFO_S,      BOPOMOFO_EI,
+        /* 0x70 */ BOPOMOFO_EN,     BOPOMOFO_P,      BOPOMOFO_J,      BOPOMOFO_N,
+        /* 0x74 */ BOPOMOFO_CH,     BOPOMOFO_I,      BOPOMOFO_X,      BOPOMOFO_T,
+        /* 0x78 */ BOPOMOFO_L,      BOPOMOFO_Z,      BOPOMOFO_F,      BOPOMOFO_ZERO,
+        /* 0x7c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
     },
     {
-        { '\'', BOPOMOFO_V      },
-        { ',' , BOPOMOFO_E2     },
-        { '-' , BOPOMOFO_I      },
-        { '.' , BOPOMOFO_OU     },
-        { '/' , BOPOMOFO_ENG    },
-        { '0' , BOPOMOFO_AN     },
-        { '1' , BOPOMOFO_TONE_5 },
-        { '2' , BOPOMOFO_B      },
-        { '3' , BOPOMOFO_D      },
-        { '6' , BOPOMOFO_ZH     },
-        { '8' , BOPOMOFO_A      },
-        { '9' , BOPOMOFO_AI     },
-        { ';' , BOPOMOFO_ANG    },
-        { '=' , BOPOMOFO_ER     },
-        { '[' , BOPOMOFO_U      },
-        { 'a' , BOPOMOFO_TONE_3 },
-        { 'b' , BOPOMOFO_X      },
-        { 'c' , BOPOMOFO_L      },
-        { 'd' , BOPOMOFO_N      },
-        { 'e' , BOPOMOFO_T      },
-        { 'f' , BOPOMOFO_K      },
-        { 'g' , BOPOMOFO_Q      },
-        { 'h' , BOPOMOFO_SH     },
-        { 'i' , BOPOMOFO_O      },
-        { 'j' , BOPOMOFO_C      },
-        { 'k' , BOPOMOFO_E      },
-        { 'l' , BOPOMOFO_AO     },
-        { 'm' , BOPOMOFO_S      },
-        { 'n' , BOPOMOFO_R      },
-        { 'o' , BOPOMOFO_EI     },
-        { 'p' , BOPOMOFO_EN     },
-        { 'q' , BOPOMOFO_TONE_2 },
-        { 'r' , BOPOMOFO_G      },
-        { 's' , BOPOMOFO_M      },
-        { 't' , BOPOMOFO_J      },
-        { 'u' , BOPOMOFO_Z      },
-        { 'v' , BOPOMOFO_H      },
-        { 'w' , BOPOMOFO_P      },
-        { 'x' , BOPOMOFO_F      },
-        { 'y' , BOPOMOFO_CH     },
-        { 'z' , BOPOMOFO_TONE_4 },
+        /* 0x00 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x04 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x08 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x0c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x10 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x14 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x18 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x1c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x20 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x24 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_V,
+        /* 0x28 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x2c */ BOPOMOFO_E2,     BOPOMOFO_I,      BOPOMOFO_OU,     BOPOMOFO_ENG,
+        /* 0x30 */ BOPOMOFO_AN,     BOPOMOFO_TONE_5, BOPOMOFO_B,      BOPOMOFO_D,
+        /* 0x34 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZH,     BOPOMOFO_ZERO,
+        /* 0x38 */ BOPOMOFO_A,      BOPOMOFO_AI,     BOPOMOFO_ZERO,   BOPOMOFO_ANG,
+        /* 0x3c */ BOPOMOFO_ZERO,   BOPOMOFO_ER,     BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x40 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x44 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x48 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x4c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x50 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x54 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x58 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_U,
+        /* 0x5c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x60 */ BOPOMOFO_ZERO,   BOPOMOFO_TONE_3, BOPOMOFO_X,      BOPOMOFO_L,
+        /* 0x64 */ BOPOMOFO_N,      BOPOMOFO_T,      BOPOMOFO_K,      BOPOMOFO_Q,
+        /* 0x68 */ BOPOMOFO_SH,     BOPOMOFO_O,      BOPOMOFO_C,      BOPOMOFO_E,
+        /* 0x6c */ BOPOMOFO_AO,     BOPOMOFO_S,      BOPOMOFO_R,      BOPOMOFO_EI,
+        /* 0x70 */ BOPOMOFO_EN,     BOPOMOFO_TONE_2, BOPOMOFO_G,      BOPOMOFO_M,
+        /* 0x74 */ BOPOMOFO_J,      BOPOMOFO_Z,      BOPOMOFO_H,      BOPOMOFO_P,
+        /* 0x78 */ BOPOMOFO_F,      BOPOMOFO_CH,     BOPOMOFO_TONE_4, BOPOMOFO_ZERO,
+        /* 0x7c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
     },
     {
-        { '\'', BOPOMOFO_C      },
-        { ',' , BOPOMOFO_ZH     },
-        { '-' , BOPOMOFO_ENG    },
-        { '.' , BOPOMOFO_CH     },
-        { '/' , BOPOMOFO_SH     },
-        { '0' , BOPOMOFO_ANG    },
-        { '1' , BOPOMOFO_TONE_5 },
-        { '2' , BOPOMOFO_TONE_2 },
-        { '3' , BOPOMOFO_TONE_3 },
-        { '4' , BOPOMOFO_TONE_4 },
-        { '7' , BOPOMOFO_Q      },
-        { '8' , BOPOMOFO_AN     },
-        { '9' , BOPOMOFO_EN     },
-        { ';' , BOPOMOFO_Z      },
-        { '=' , BOPOMOFO_ER     },
-        { 'a' , BOPOMOFO_A      },
-        { 'b' , BOPOMOFO_B      },
-        { 'c' , BOPOMOFO_X      },
-        { 'd' , BOPOMOFO_D      },
-        { 'e' , BOPOMOFO_I      },
-        { 'f' , BOPOMOFO_F      },
-        { 'g' , BOPOMOFO_J      },
-        { 'h' , BOPOMOFO_H      },
-        { 'i' , BOPOMOFO_AI     },
-        { 'j' , BOPOMOFO_R      },
-        { 'k' , BOPOMOFO_K      },
-        { 'l' , BOPOMOFO_L      },
-        { 'm' , BOPOMOFO_M      },
-        { 'n' , BOPOMOFO_N      },
-        { 'o' , BOPOMOFO_O      },
-        { 'p' , BOPOMOFO_P      },
-        { 'q' , BOPOMOFO_EI     },
-        { 'r' , BOPOMOFO_E      },
-        { 's' , BOPOMOFO_S      },
-        { 't' , BOPOMOFO_T      },
-        { 'u' , BOPOMOFO_V      },
-        { 'v' , BOPOMOFO_G      },
-        { 'w' , BOPOMOFO_E2     },
-        { 'x' , BOPOMOFO_U      },
-        { 'y' , BOPOMOFO_OU     },
-        { 'z' , BOPOMOFO_AO     },
+        /* 0x00 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x04 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x08 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x0c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x10 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x14 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x18 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x1c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x20 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x24 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_C,
+        /* 0x28 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x2c */ BOPOMOFO_ZH,     BOPOMOFO_ENG,    BOPOMOFO_CH,     BOPOMOFO_SH,
+        /* 0x30 */ BOPOMOFO_ANG,    BOPOMOFO_TONE_5, BOPOMOFO_TONE_2, BOPOMOFO_TONE_3,
+        /* 0x34 */ BOPOMOFO_TONE_4, BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_Q,
+        /* 0x38 */ BOPOMOFO_AN,     BOPOMOFO_EN,     BOPOMOFO_ZERO,   BOPOMOFO_Z,
+        /* 0x3c */ BOPOMOFO_ZERO,   BOPOMOFO_ER,     BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x40 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x44 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x48 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x4c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x50 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x54 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x58 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x5c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x60 */ BOPOMOFO_ZERO,   BOPOMOFO_A,      BOPOMOFO_B,      BOPOMOFO_X,
+        /* 0x64 */ BOPOMOFO_D,      BOPOMOFO_I,      BOPOMOFO_F,      BOPOMOFO_J,
+        /* 0x68 */ BOPOMOFO_H,      BOPOMOFO_AI,     BOPOMOFO_R,      BOPOMOFO_K,
+        /* 0x6c */ BOPOMOFO_L,      BOPOMOFO_M,      BOPOMOFO_N,      BOPOMOFO_O,
+        /* 0x70 */ BOPOMOFO_P,      BOPOMOFO_EI,     BOPOMOFO_E,      BOPOMOFO_S,
+        /* 0x74 */ BOPOMOFO_T,      BOPOMOFO_V,      BOPOMOFO_G,      BOPOMOFO_E2,
+        /* 0x78 */ BOPOMOFO_U,      BOPOMOFO_OU,     BOPOMOFO_AO,     BOPOMOFO_ZERO,
+        /* 0x7c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
     },
     {
-        { ',' , BOPOMOFO_TONE_3 },
-        { '-' , BOPOMOFO_H      },
-        { '.' , BOPOMOFO_TONE_4 },
-        { '/' , BOPOMOFO_TONE_5 },
-        { '0' , BOPOMOFO_K      },
-        { '1' , BOPOMOFO_B      },
-        { '2' , BOPOMOFO_P      },
-        { '3' , BOPOMOFO_M      },
-        { '4' , BOPOMOFO_F      },
-        { '5' , BOPOMOFO_D      },
-        { '6' , BOPOMOFO_T      },
-        { '7' , BOPOMOFO_N      },
-        { '8' , BOPOMOFO_L      },
-        { '9' , BOPOMOFO_G      },
-        { ';' , BOPOMOFO_AO     },
-        { 'a' , BOPOMOFO_I      },
-        { 'b' , BOPOMOFO_ENG    },
-        { 'c' , BOPOMOFO_EN     },
-        { 'd' , BOPOMOFO_V      },
-        { 'e' , BOPOMOFO_X      },
-        { 'f' , BOPOMOFO_A      },
-        { 'g' , BOPOMOFO_O      },
-        { 'h' , BOPOMOFO_E      },
-        { 'i' , BOPOMOFO_Z      },
-        { 'j' , BOPOMOFO_E2     },
-        { 'k' , BOPOMOFO_AI     },
-        { 'l' , BOPOMOFO_EI     },
-        { 'm' , BOPOMOFO_TONE_2 },
-        { 'n' , BOPOMOFO_ER     },
-        { 'o' , BOPOMOFO_C      },
-        { 'p' , BOPOMOFO_S      },
-        { 'q' , BOPOMOFO_J      },
-        { 'r' , BOPOMOFO_ZH     },
-        { 's' , BOPOMOFO_U      },
-        { 't' , BOPOMOFO_CH     },
-        { 'u' , BOPOMOFO_R      },
-        { 'v' , BOPOMOFO_ANG    },
-        { 'w' , BOPOMOFO_Q      },
-        { 'x' , BOPOMOFO_AN     },
-        { 'y' , BOPOMOFO_SH     },
-        { 'z' , BOPOMOFO_OU     },
+        /* 0x00 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x04 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x08 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x0c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x10 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x14 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x18 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x1c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x20 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x24 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x28 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x2c */ BOPOMOFO_TONE_3, BOPOMOFO_H,      BOPOMOFO_TONE_4, BOPOMOFO_TONE_5,
+        /* 0x30 */ BOPOMOFO_K,      BOPOMOFO_B,      BOPOMOFO_P,      BOPOMOFO_M,
+        /* 0x34 */ BOPOMOFO_F,      BOPOMOFO_D,      BOPOMOFO_T,      BOPOMOFO_N,
+        /* 0x38 */ BOPOMOFO_L,      BOPOMOFO_G,      BOPOMOFO_ZERO,   BOPOMOFO_AO,
+        /* 0x3c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x40 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x44 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x48 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x4c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x50 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x54 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x58 */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x5c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
+        /* 0x60 */ BOPOMOFO_ZERO,   BOPOMOFO_I,      BOPOMOFO_ENG,    BOPOMOFO_EN,
+        /* 0x64 */ BOPOMOFO_V,      BOPOMOFO_X,      BOPOMOFO_A,      BOPOMOFO_O,
+        /* 0x68 */ BOPOMOFO_E,      BOPOMOFO_Z,      BOPOMOFO_E2,     BOPOMOFO_AI,
+        /* 0x6c */ BOPOMOFO_EI,     BOPOMOFO_TONE_2, BOPOMOFO_ER,     BOPOMOFO_C,
+        /* 0x70 */ BOPOMOFO_S,      BOPOMOFO_J,      BOPOMOFO_ZH,     BOPOMOFO_U,
+        /* 0x74 */ BOPOMOFO_CH,     BOPOMOFO_R,      BOPOMOFO_ANG,    BOPOMOFO_Q,
+        /* 0x78 */ BOPOMOFO_AN,     BOPOMOFO_SH,     BOPOMOFO_OU,     BOPOMOFO_ZERO,
+        /* 0x7c */ BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,   BOPOMOFO_ZERO,
     },
 };
 
@@ -0,0 +1,280 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#include "Converter.h"
+
+#include "BatchConverter.h"
+#include "Config.h"
+#include "Database.h"
+#include "PhraseLattice.h"
+#include "PinyinParser.h"
+#include "SimpTradConverter.h"
+#include "Variant.h"
+
+namespace PyZy {
+
+class PinyinConverter : public Converter {
+public:
+    PinyinConverter (const DatabasePtr &database)
+        : m_database (database) { }
+
+    std::string convert (const std::string &pinyin) const
+    {
+        std::vector<std::string> texts;
+        convert (pinyin, 1, texts);
+        return texts.empty () ? std::string () : texts[0];
+    }
+
+    size_t convert (const std::string        &pinyin,
+                    size_t                    n,
+                    std::vector<std::string> &texts) const;
+
+    void convert (const std::vector<std::string> &pinyins,
+                  std::vector<std::string>       &texts) const
+    {
+        texts.reserve (texts.size () + pinyins.size ());
+        for (size_t i = 0; i < pinyins.size (); i++)
+            texts.push_back (convert (pinyins[i]));
+    }
+
+    void convert (const std::vector<std::string> &pinyins,
+                  std::vector<std::string>       &texts,
+                  size_t                          threads) const;
+
+    size_t convert (std::istream &in,
+                    std::ostream &out,
+                    size_t        threads) const;
+
+    Variant getProperty (InputContext::PropertyName name) const
+    {
+        switch (name) {
+        case InputContext::PROPERTY_CONVERSION_OPTION:
+            return Variant::fromUnsignedInt (m_config.option);
+        case InputContext::PROPERTY_MODE_SIMP:
+            return Variant::fromBool (m_config.modeSimp);
+        default:
+            return Variant::nullVariant ();
+        }
+    }
+
+    bool setProperty (InputContext::PropertyName name, const Variant &variant)
+    {
+        if (name == InputContext::PROPERTY_CONVERSION_OPTION &&
+            variant.getType () == Variant::TYPE_UNSIGNED_INT) {
+            m_config.option = variant.getUnsignedInt ();
+            return true;
+        }
+        if (name == InputContext::PROPERTY_MODE_SIMP &&
+            variant.getType () == Variant::TYPE_BOOL) {
+            m_config.modeSimp = variant.getBool ();
+            return true;
+        }
+        return false;
+    }
+
+private:
+    void convertRun (const PinyinArray        &pinyin,
+                     size_t                    n,
+                     std::vector<std::string> &texts) const;
+
+private:
+    DatabasePtr m_database;
+    Config m_config;
+};
+
+/* Appends the n best conversions of the syllables to texts */
+void
+PinyinConverter::convertRun (const PinyinArray        &pinyin,
+                             size_t                    n,
+                             std::vector<std::string> &texts) const
+{
+    /* a lattice of its own, so other threads may convert at the same time */
+    PhraseLattice lattice (*m_database);
+    std::vector<PhraseArray> paths;
+    lattice.bestPaths (pinyin, 0, m_config.option, n, paths);
+
+    std::vector<String> results (paths.size ());
+    for (size_t k = 0; k < paths.size (); k++) {
+        for (size_t i = 0; i < paths[k].size (); i++)
+            results[k] << paths[k][i].phrase;
+    }
+
+    if (!m_config.modeSimp && !m_database->traditional ()) {
+        /* the n conversions in one go */
+        std::vector<String> trads;
+        SimpTradConverter::simpToTrad (results, trads);
+        results.swap (trads);
+    }
+    texts.insert (texts.end (), results.begin (), results.end ());
+}
+
+size_t
+PinyinConverter::convert (const std::string        &pinyin,
+                          size_t                    n,
+                          std::vector<std::string> &texts) const
+{
+    if (G_UNLIKELY (n == 0))
+        return 0;
+
+    /* the conversions of every run of syllables, and the characters that
+     * are not pinyin as the only conversion of their runs */
+    std::vector<std::vector<std::string> > runs;
+    size_t count = 0;
+    bool literal = false;
+
+    const String text (pinyin);
+    size_t begin = 0;
+    while (begin < text.length ()) {
+        if (text[begin] == '\'') {
+            begin ++;
+            continue;
+        }
+
+        const String rest (text.substr (begin));
+        PinyinArray syllables;
+        size_t len = PinyinParser::parse (rest, rest.length (), m_config.option,
+                                          syllables, rest.length ());
+        if (syllables.empty ()) {
+            if (!literal)
+                runs.push_back (std::vector<std::string> (1));
+            runs.back ()[0] += text[begin];
+            literal = true;
+            begin ++;
+            continue;
+        }
+
+        runs.push_back (std::vector<std::string> ());
+        convertRun (syllables, n, runs.back ());
+        if (runs.back ().empty ())
+            runs.back ().push_back (text.substr (begin, len));
+        count = MAX (count, runs.back ().size ());
+        literal = false;
+        begin += len;
+    }
+
+    /* the k-th conversion joins the k-th conversions of the runs */
+    count = MAX (count, (size_t) 1);
+    for (size_t k = 0; k < count; k++) {
+        std::string result;
+        for (size_t r = 0; r < runs.size (); r++)
+            result += runs[r][MIN (k, runs[r].size () - 1)];
+        texts.push_back (result);
+    }
+    return count;
+}
+
+/* the number of lines every thread gets in a batch of a stream */
+#define CONVERTER_LINES_PER_THREAD (4096)
+
+static size_t
+thread_count (size_t threads)
+{
+    return threads != 0 ? threads : MAX (g_get_num_processors (), 1U);
+}
+
+void
+PinyinConverter::convert (const std::vector<std::string> &pinyins,
+                          std::vector<std::string>       &texts,
+                          size_t                          threads) const
+{
+    threads = thread_count (threads);
+    if (threads == 1) {
+        convert (pinyins, texts);
+        return;
+    }
+
+    std::vector<std::string> batch_texts;
+    BatchConverter batch (*this, threads);
+    batch.start (pinyins, batch_texts);
+    batch.wait ();
+    texts.insert (texts.end (), batch_texts.begin (), batch_texts.end ());
+}
+
+/* Reads the next batch of lines while the threads convert the last one */
+size_t
+PinyinConverter::convert (std::istream &in,
+                          std::ostream &out,
+                          size_t        threads) const
+{
+    threads = thread_count (threads);
+    const size_t batch_size = threads * CONVERTER_LINES_PER_THREAD;
+
+    BatchConverter batch (*this, threads);
+    std::vector<std::string> pinyins[2];
+    std::vector<std::string> texts[2];
+    size_t count = 0;
+    size_t current = 0;
+
+    for (;;) {
+        std::vector<std::string> &lines = pinyins[current];
+        lines.clear ();
+        std::string line;
+        while (lines.size () < batch_size && std::getline (in, line))
+            lines.push_back (line);
+
+        batch.wait ();
+        const std::vector<std::string> &last = texts[1 - current];
+        for (size_t i = 0; i < last.size (); i++)
+            out << last[i] << '\n';
+
+        if (lines.empty ())
+            break;
+        batch.start (lines, texts[current]);
+        count += lines.size ();
+        current = 1 - current;
+    }
+    out.flush ();
+    return count;
+}
+
+void
+Converter::simpToTrad (const char  *text,
+                       size_t       len,
+                       std::string &out,
+                       size_t       threads)
+{
+    String trad;
+    SimpTradConverter::simpToTrad (text, len, trad, threads);
+    out += trad;
+}
+
+bool
+Converter::simpToTrad (int in_fd, int out_fd, size_t threads)
+{
+    return SimpTradConverter::simpToTrad (in_fd, out_fd, threads);
+}
+
+Converter *
+Converter::create (void)
+{
+    return new PinyinConverter (Database::instance ());
+}
+
+Converter *
+Converter::create (const std::string & user_cache_dir)
+{
+    if (user_cache_dir.empty ()) {
+        g_error ("Error: user_cache_dir should not be empty");
+    }
+    return new PinyinConverter (Database::instance (user_cache_dir));
+}
+
+};  // namespace PyZy
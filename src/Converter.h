@@ -0,0 +1,196 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+/**
+ * \brief Converts pinyin strings to phrases without input contexts.
+ *
+ * Takes whole full pinyin strings, e.g. from a search log, and converts
+ * them at once, without the cursor, the candidates and the notifications
+ * of an InputContext.
+ *
+ * To use this class, you should call InputContext::init() at first and
+ * InputContext::finalize() at last.
+ */
+#ifndef __PYZY_CONVERTER_H_
+#define __PYZY_CONVERTER_H_
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "InputContext.h"
+
+namespace PyZy {
+
+class Variant;
+
+/**
+ * \brief Full pinyin to phrases conversion class.
+ *
+ * This class is a factory class. You call a create() method and you get a
+ * pointer of the instance. You should delete it yourself.
+ * The convert() methods change nothing, so one instance may convert from
+ * several threads at the same time. The user phrases are read, but the
+ * conversions are never learnt.
+ */
+class Converter {
+public:
+    /**
+     * \brief Virtual destructor.
+     */
+    virtual ~Converter (void) { }
+
+    /**
+     * \brief Converts a pinyin string.
+     * @param pinyin Full pinyin string.
+     * @return The best conversion.
+     *
+     * Pinyin is converted as a whole, so the phrases of the conversion
+     * may cross the syllables "'" separates. The characters that are not
+     * pinyin are copied to the conversion as they are.
+     */
+    virtual std::string convert (const std::string &pinyin) const = 0;
+
+    /**
+     * \brief Converts a pinyin string to several conversions.
+     * @param pinyin Full pinyin string.
+     * @param n The number of conversions wanted.
+     * @param texts The conversions are appended to it, the best first.
+     * @return The number of the conversions appended.
+     *
+     * If pinyin has several runs of syllables, the k-th conversion joins
+     * the k-th conversion of every run, or the last one of a run that has
+     * fewer conversions.
+     */
+    virtual size_t convert (const std::string        &pinyin,
+                            size_t                    n,
+                            std::vector<std::string> &texts) const = 0;
+
+    /**
+     * \brief Converts many pinyin strings.
+     * @param pinyins Full pinyin strings.
+     * @param texts The best conversion of every pinyin string is
+     *        appended to it, in the same order.
+     */
+    virtual void convert (const std::vector<std::string> &pinyins,
+                          std::vector<std::string>       &texts) const = 0;
+
+    /**
+     * \brief Converts many pinyin strings with several threads.
+     * @param pinyins Full pinyin strings.
+     * @param texts The best conversion of every pinyin string is
+     *        appended to it, in the same order.
+     * @param threads The number of threads, or 0 for one thread for
+     *        every processor.
+     */
+    virtual void convert (const std::vector<std::string> &pinyins,
+                          std::vector<std::string>       &texts,
+                          size_t                          threads) const = 0;
+
+    /**
+     * \brief Converts every line of a stream with several threads.
+     * @param in The stream of full pinyin strings, one on every line.
+     * @param out The best conversions are written to it, one on every
+     *        line, in the order of the lines of in.
+     * @param threads The number of threads, or 0 for one thread for
+     *        every processor.
+     * @return The number of the lines converted.
+     *
+     * The lines are read and converted in batches, so a stream of any
+     * size may be converted.
+     */
+    virtual size_t convert (std::istream &in,
+                            std::ostream &out,
+                            size_t        threads) const = 0;
+
+    /**
+     * \brief Gets property of the converter.
+     * @param name you want to get.
+     * @return value of the property.
+     *
+     * Only PROPERTY_CONVERSION_OPTION and PROPERTY_MODE_SIMP are used.
+     */
+    virtual Variant getProperty (InputContext::PropertyName name) const = 0;
+
+    /**
+     * \brief Sets property of the converter.
+     * @param name you want to set.
+     * @param variant value of the property.
+     * @return true if the value is set successfully.
+     *
+     * Only PROPERTY_CONVERSION_OPTION and PROPERTY_MODE_SIMP can be set.
+     * It must not be called while the converter converts.
+     */
+    virtual bool setProperty (InputContext::PropertyName name,
+                              const Variant &variant) = 0;
+
+    /**
+     * \brief Converts a simplified Chinese document to traditional Chinese.
+     * @param text The document.
+     * @param len The length of text in bytes.
+     * @param out The traditional Chinese document is appended to it.
+     * @param threads The number of threads, or 0 for one thread for
+     *        every processor.
+     *
+     * text does not have to end with NUL, and the bytes of it that are
+     * not UTF-8 characters are copied to out as they are.
+     */
+    static void simpToTrad (const char  *text,
+                            size_t       len,
+                            std::string &out,
+                            size_t       threads);
+
+    /**
+     * \brief Converts a simplified Chinese document from a file descriptor.
+     * @param in_fd The file descriptor to read the document from.
+     * @param out_fd The file descriptor to write the traditional Chinese
+     *        document to.
+     * @param threads The number of threads, or 0 for one thread for
+     *        every processor.
+     * @return false if reading or writing fails.
+     *
+     * The document is read and converted a block at a time, so a
+     * document of any size may be converted.
+     */
+    static bool simpToTrad (int in_fd, int out_fd, size_t threads);
+
+    /**
+     * \brief Creates a new Converter instance.
+     * @return instance of the Converter.
+     *
+     * The converter reads the user phrases of InputContext::init ().
+     * You should take responsibility for deleting the instance.
+     */
+    static Converter * create (void);
+
+    /**
+     * \brief Creates a new Converter instance for another user.
+     * @param user_cache_dir The directory of the user database.
+     * @return instance of the Converter.
+     *
+     * You should take responsibility for deleting the instance.
+     */
+    static Converter * create (const std::string & user_cache_dir);
+};
+
+}; // namespace PyZy
+
+#endif  // __PYZY_CONVERTER_H_
@@ -21,133 +21,218 @@
  */
 #include "Database.h"
 
+#include <algorithm>
 #include <glib.h>
 #include <glib/gstdio.h>
 #include <sqlite3.h>
 
 #include "Config.h"
 #include "PinyinArray.h"
+#include "SQLStmt.h"
+#include "UserDBWriter.h"
+#include "UserPhraseOverlay.h"
 #include "Util.h"
 
 
 namespace PyZy {
 
 #define DB_CACHE_SIZE       "5000"
-#define DB_INDEX_SIZE       (3)
 /* define columns */
 #define DB_COLUMN_USER_FREQ (0)
 #define DB_COLUMN_PHRASE    (1)
 #define DB_COLUMN_FREQ      (2)
 #define DB_COLUMN_S0        (3)
 
+#define DB_QUERY_CACHE_SIZE (256)
+/* rows of a query kept in its cache entry, a few pages of candidates */
+#define DB_QUERY_CACHE_ROWS (64)
+
 #define DB_PREFETCH_LEN     (6)
-#define DB_BACKUP_TIMEOUT   (60)
+/* fold the overlay into the user database beyond this many phrases */
+#define DB_OVERLAY_SIZE     (128)
+/* idle connections to the main database kept for the next queries */
+#define DB_IDLE_READERS     (8)
+/* stmts kept for each where clause shape, for queries running at once */
+#define DB_SHAPE_STMTS      (4)
 
 #define USER_DICTIONARY_FILE  "user-1.0.db"
+#define USER_JOURNAL_FILE     "user-1.0.journal"
+
 
+DatabasePtr Database::m_instance;
 
-std::unique_ptr<Database> Database::m_instance;
+/* The databases by user data directory and the compiled main databases by
+ * file name, so that the users of one file share an instance */
+static GMutex databases_lock;
+static std::map<std::string, std::weak_ptr<Database> > databases;
+static GMutex dictionaries_lock;
+static std::map<std::string, std::weak_ptr<MappedDictionary> > dictionaries;
 
-class Conditions : public std::vector<std::string> {
+class SQLPhraseStream : public PhraseStream {
 public:
-    Conditions (void) : std::vector<std::string> (1) {}
-
-    void double_ (void) {
-        size_t i = size ();
-        // To avoid a invalid referece caused by a memory reallocation, which
-        // may occur on push_back, we call reserve here.
-        reserve (i * 2);
-        do {
-            push_back (at (--i));
-        } while (i > 0);
-    }
-
-    void triple (void) {
-        size_t i = size ();
-        // To avoid a invalid referece caused by a memory reallocation, which
-        // may occur on push_back, we call reserve here.
-        reserve (i * 3);
-        do {
-            const std::string & value = at (--i);
-            push_back (value);
-            push_back (value);
-        } while (i > 0);
-    }
-
-    void appendVPrintf (size_t begin, size_t end, const char *fmt, va_list args) {
-        char str[64];
-        g_vsnprintf (str, sizeof(str), fmt, args);
-        for (size_t i = begin; i < end; i++) {
-            at (i) += str;
-        }
+    SQLPhraseStream (const SQLStmtPtr &stmt, size_t len)
+        : m_stmt (stmt), m_len (len) { }
+    /* keeps the connection of stmt open while it is read */
+    SQLPhraseStream (const QueryReaderPtr &reader, const SQLStmtPtr &stmt, size_t len)
+        : m_reader (reader), m_stmt (stmt), m_len (len) { }
+
+    ~SQLPhraseStream (void) {
+        /* the stmt may be reused by the next query of the same shape */
+        m_stmt->reset ();
+    }
+
+    bool next (Phrase &phrase) {
+        if (!m_stmt->step ())
+            return false;
+        fillPhrase (*m_stmt, m_len, phrase);
+        return true;
     }
 
-    void appendPrintf (size_t begin, size_t end, const char *fmt, ...) {
-        va_list args;
-        va_start (args, fmt);
-        appendVPrintf (begin, end, fmt, args);
-        va_end (args);
+    static void fillPhrase (SQLStmt &stmt, size_t len, Phrase &phrase) {
+        g_strlcpy (phrase.phrase,
+                   stmt.columnText (DB_COLUMN_PHRASE),
+                   sizeof (phrase.phrase));
+        phrase.freq = stmt.columnInt (DB_COLUMN_FREQ);
+        phrase.user_freq = stmt.columnInt (DB_COLUMN_USER_FREQ);
+        phrase.len = len;
+
+        for (size_t i = 0, column = DB_COLUMN_S0; i < len; i++) {
+            phrase.pinyin_id[i].sheng = stmt.columnInt (column++);
+            phrase.pinyin_id[i].yun = stmt.columnInt (column++);
+        }
     }
+
+private:
+    QueryReaderPtr m_reader;
+    SQLStmtPtr m_stmt;
+    size_t m_len;
 };
 
-class SQLStmt {
+/* Stops after the first count phrases of the source */
+class LimitedPhraseStream : public PhraseStream {
 public:
-    SQLStmt (sqlite3 *db)
-        : m_db (db), m_stmt (NULL) {
-        g_assert (m_db != NULL);
-    }
+    LimitedPhraseStream (const PhraseStreamPtr &source, size_t count)
+        : m_source (source), m_count (count) { }
 
-    ~SQLStmt () {
-        if (m_stmt != NULL) {
-            if (sqlite3_finalize (m_stmt) != SQLITE_OK) {
-                g_warning ("destroy sqlite stmt failed!");
-            }
-        }
+    bool next (Phrase &phrase) {
+        if (m_count == 0 || !m_source->next (phrase))
+            return false;
+        m_count --;
+        return true;
     }
 
-    bool prepare (const String &sql) {
-        if (sqlite3_prepare (m_db,
-                             sql.c_str (),
-                             sql.size (),
-                             &m_stmt,
-                             NULL) != SQLITE_OK) {
-            g_warning ("parse sql failed!\n %s", sql.c_str ());
+private:
+    PhraseStreamPtr m_source;
+    size_t m_count;
+};
+
+/* Result of a query: its first rows, and whether they are all of them.
+ * An entry keeps no stream, so no stmt stays busy for the cache, and it is
+ * not changed once cached, so the streams of several threads may read it. */
+struct QueryCacheEntry {
+    std::string key;
+    MappedDictionary::Condition conditions[MAX_PHRASE_LEN];
+    size_t len;
+    PhraseArray phrases;
+    bool complete;
+
+    bool matches (const Phrase &phrase) const {
+        if (phrase.len != len)
             return false;
+        for (size_t i = 0; i < len; i++) {
+            if (!conditions[i].accepts (phrase.pinyin_id[i].sheng,
+                                        phrase.pinyin_id[i].yun))
+                return false;
         }
-
         return true;
     }
+};
 
-    bool step (void) {
-        switch (sqlite3_step (m_stmt)) {
-        case SQLITE_ROW:
-            return true;
-        case SQLITE_DONE:
+/* A connection to the main database, unless it is a compiled dictionary,
+ * and the query stmts prepared with it, by where clause shape */
+struct QueryReader {
+    typedef std::map<guint64, std::vector<SQLStmtPtr> > StmtCache;
+
+    sqlite3 *db;
+    StmtCache stmts[2];         /* main and userdb stmts */
+
+    QueryReader (void) : db (NULL) { }
+
+    ~QueryReader (void) {
+        stmts[0].clear ();
+        stmts[1].clear ();
+        if (db != NULL && sqlite3_close (db) != SQLITE_OK) {
+            g_warning ("close sqlite database failed!");
+        }
+    }
+
+    bool open (const char *filename) {
+        unsigned int flags = SQLITE_OPEN_READONLY | SQLITE_OPEN_FULLMUTEX;
+        if (sqlite3_open_v2 (filename, &db, flags, NULL) != SQLITE_OK)
             return false;
-        default:
-            g_warning ("sqlites step error!");
+
+        String sql;
+        /* Set the cache size for better performance */
+        sql << "PRAGMA cache_size=" DB_CACHE_SIZE ";\n";
+
+        /* Using EXCLUSIVE locking mode on databases
+         * for better performance. The readers only take shared locks. */
+        sql << "PRAGMA locking_mode=EXCLUSIVE;\n";
+
+        char *errmsg = NULL;
+        if (sqlite3_exec (db, sql, NULL, NULL, &errmsg) != SQLITE_OK) {
+            g_warning ("%s: %s", errmsg, sql.c_str ());
+            sqlite3_free (errmsg);
             return false;
         }
+        return true;
     }
+};
 
-    const char *columnText (int col) {
-        return (const char *) sqlite3_column_text (m_stmt, col);
-    }
+/* Returns the rows of a cache entry, and queries again for the rows after
+ * them, skipping the ones already returned */
+class CachedPhraseStream : public PhraseStream {
+public:
+    CachedPhraseStream (Database &database, const QueryCacheEntryPtr &entry)
+        : m_database (database), m_entry (entry), m_pos (0) { }
 
-    int columnInt (int col) {
-        return sqlite3_column_int (m_stmt, col);
+    bool next (Phrase &phrase) {
+        const PhraseArray & phrases = m_entry->phrases;
+        if (m_pos < phrases.size ()) {
+            phrase = phrases[m_pos++];
+            return true;
+        }
+        if (m_entry->complete)
+            return false;
+
+        if (m_source.get () == NULL) {
+            unsigned int generation;
+            m_source = m_database.queryStreams (m_entry->conditions,
+                                                m_entry->len, generation);
+            if (m_source.get () == NULL)
+                return false;
+            for (size_t i = 0; i < phrases.size (); i++) {
+                if (!m_source->next (phrase))
+                    return false;
+            }
+        }
+        return m_source->next (phrase);
     }
 
 private:
-    sqlite3 *m_db;
-    sqlite3_stmt *m_stmt;
+    Database & m_database;
+    QueryCacheEntryPtr m_entry;
+    PhraseStreamPtr m_source;
+    size_t m_pos;
 };
 
-Query::Query (const PinyinArray    & pinyin,
+Query::Query (Database             & database,
+              const PinyinArray    & pinyin,
               size_t                 pinyin_begin,
               size_t                 pinyin_len,
               unsigned int           option)
-    : m_pinyin (pinyin),
+    : m_database (database),
+      m_pinyin (pinyin),
       m_pinyin_begin (pinyin_begin),
       m_pinyin_len (pinyin_len),
       m_option (option)
@@ -165,26 +250,13 @@ Query::fill (PhraseArray &phrases, int count)
     int row = 0;
 
     while (m_pinyin_len > 0) {
-        if (G_LIKELY (m_stmt.get () == NULL)) {
-            m_stmt = Database::instance ().query (m_pinyin, m_pinyin_begin, m_pinyin_len, -1, m_option);
-            g_assert (m_stmt.get () != NULL);
+        if (G_LIKELY (m_stream.get () == NULL)) {
+            m_stream = m_database.query (m_pinyin, m_pinyin_begin, m_pinyin_len, -1, m_option);
+            g_assert (m_stream.get () != NULL);
         }
 
-        while (m_stmt->step ()) {
-            Phrase phrase;
-
-            g_strlcpy (phrase.phrase,
-                       m_stmt->columnText (DB_COLUMN_PHRASE),
-                       sizeof (phrase.phrase));
-            phrase.freq = m_stmt->columnInt (DB_COLUMN_FREQ);
-            phrase.user_freq = m_stmt->columnInt (DB_COLUMN_USER_FREQ);
-            phrase.len = m_pinyin_len;
-
-            for (size_t i = 0, column = DB_COLUMN_S0; i < m_pinyin_len; i++) {
-                phrase.pinyin_id[i].sheng = m_stmt->columnInt (column++);
-                phrase.pinyin_id[i].yun = m_stmt->columnInt (column++);
-            }
-
+        Phrase phrase;
+        while (m_stream->next (phrase)) {
             phrases.push_back (phrase);
             row ++;
             if (G_UNLIKELY (row == count)) {
@@ -192,7 +264,7 @@ Query::fill (PhraseArray &phrases, int count)
             }
         }
 
-        m_stmt.reset ();
+        m_stream.reset ();
         m_pinyin_len --;
     }
 
@@ -201,25 +273,35 @@ Query::fill (PhraseArray &phrases, int count)
 
 Database::Database (const std::string &user_data_dir)
     : m_db (NULL)
-    , m_timeout_id (0)
-    , m_timer (g_timer_new ())
+    , m_traditional (false)
+    , m_cache_hits (0)
+    , m_cache_misses (0)
+    , m_stmt_prepares (0)
+    , m_generation (0)
     , m_user_data_dir (user_data_dir)
 {
+    g_mutex_init (&m_readers_lock);
+    g_rw_lock_init (&m_user_lock);
+    g_mutex_init (&m_cache_lock);
     open ();
 }
 
 Database::~Database (void)
 {
-    g_timer_destroy (m_timer);
-    if (m_timeout_id != 0) {
-        saveUserDB ();
-        g_source_remove (m_timeout_id);
-    }
+    /* waits for the pending changes to be written */
+    m_writer.reset ();
+    m_updater.reset ();
+    m_cache_map.clear ();
+    m_cache_list.clear ();
+    m_readers.clear ();
     if (m_db) {
         if (sqlite3_close (m_db) != SQLITE_OK) {
             g_warning ("close sqlite database failed!");
         }
     }
+    g_mutex_clear (&m_cache_lock);
+    g_rw_lock_clear (&m_user_lock);
+    g_mutex_clear (&m_readers_lock);
 }
 
 inline bool
@@ -245,20 +327,16 @@ Database::open (void)
         sqlite3_initialize ();
 #endif
         static const char * maindb [] = {
-            PKGDATADIR"/db/local.db",
-            PKGDATADIR"/db/open-phrase.db",
-            PKGDATADIR"/db/android.db",
-            "main.db",
+            PKGDATADIR"/db/local",
+            PKGDATADIR"/db/open-phrase",
+            PKGDATADIR"/db/android",
+            "main",
         };
 
         size_t i;
         for (i = 0; i < G_N_ELEMENTS (maindb); i++) {
-            if (!g_file_test(maindb[i], G_FILE_TEST_IS_REGULAR))
-                continue;
-            if (sqlite3_open_v2 (maindb[i], &m_db,
-                SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL) == SQLITE_OK) {
+            if (openMainDB (maindb[i]))
                 break;
-            }
         }
 
         if (i == G_N_ELEMENTS (maindb)) {
@@ -266,27 +344,10 @@ Database::open (void)
             break;
         }
 
-        m_sql.clear ();
-
-        /* Set synchronous=OFF, write user database will become much faster.
-         * It will cause user database corrupted, if the operatering system
-         * crashes or computer loses power.
-         * */
-        m_sql << "PRAGMA synchronous=OFF;\n";
-
-        /* Set the cache size for better performance */
-        m_sql << "PRAGMA cache_size=" DB_CACHE_SIZE ";\n";
-
-        /* Using memory for temp store */
-        // m_sql << "PRAGMA temp_store=MEMORY;\n";
-
-        /* Set journal mode */
-        // m_sql << "PRAGMA journal_mode=PERSIST;\n";
-
-        /* Using EXCLUSIVE locking mode on databases
-         * for better performance */
-        m_sql << "PRAGMA locking_mode=EXCLUSIVE;\n";
-        if (!executeSQL (m_sql))
+        /* the user database lives in memory, and is shared by the
+         * querying threads */
+        unsigned int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX;
+        if (sqlite3_open_v2 (":memory:", &m_db, flags, NULL) != SQLITE_OK)
             break;
 
         loadUserDB ();
@@ -318,6 +379,104 @@ Database::open (void)
     return false;
 }
 
+/* A main database built with traditional phrases says so in its desc
+ * table, which the other main databases do not have */
+static bool
+is_traditional (sqlite3 *db)
+{
+    sqlite3_stmt *stmt = NULL;
+    if (sqlite3_prepare_v2 (db,
+                            "SELECT value FROM desc WHERE name = 'script'",
+                            -1, &stmt, NULL) != SQLITE_OK)
+        return false;
+
+    bool traditional = sqlite3_step (stmt) == SQLITE_ROW &&
+        g_strcmp0 ((const char *) sqlite3_column_text (stmt, 0), "traditional") == 0;
+    sqlite3_finalize (stmt);
+    return traditional;
+}
+
+/* Prefer the compiled dictionary name.dict, and fall back to name.db,
+ * which every querying thread opens on its own. */
+bool
+Database::openMainDB (const char *name)
+{
+    m_buffer.clear ();
+    m_buffer << name << ".dict";
+    if (g_file_test (m_buffer, G_FILE_TEST_IS_REGULAR)) {
+        m_dict = openDictionary (m_buffer);
+        if (m_dict.get () != NULL) {
+            m_traditional = m_dict->traditional ();
+            return true;
+        }
+    }
+
+    m_buffer.clear ();
+    m_buffer << name << ".db";
+    if (g_file_test (m_buffer, G_FILE_TEST_IS_REGULAR)) {
+        /* open the first connection to check the file */
+        m_main_db = m_buffer;
+        QueryReaderPtr reader = acquireReader ();
+        if (reader->db != NULL) {
+            m_traditional = is_traditional (reader->db);
+            releaseReader (reader);
+            return true;
+        }
+        m_main_db.clear ();
+    }
+
+    return false;
+}
+
+/* Takes an idle connection, or opens a new one when all of them are in use
+ * by other threads */
+QueryReaderPtr
+Database::acquireReader (void)
+{
+    QueryReaderPtr reader;
+
+    g_mutex_lock (&m_readers_lock);
+    if (!m_readers.empty ()) {
+        reader = m_readers.back ();
+        m_readers.pop_back ();
+    }
+    g_mutex_unlock (&m_readers_lock);
+
+    if (reader.get () == NULL) {
+        reader.reset (new QueryReader ());
+        if (!m_main_db.empty () && !reader->open (m_main_db))
+            g_warning ("can not open main database %s", m_main_db.c_str ());
+    }
+    return reader;
+}
+
+/* Keeps the connection for the next query, unless there are enough idle
+ * ones. The streams still reading its stmts keep it open until they end. */
+void
+Database::releaseReader (const QueryReaderPtr &reader)
+{
+    g_mutex_lock (&m_readers_lock);
+    if (m_readers.size () < DB_IDLE_READERS)
+        m_readers.push_back (reader);
+    g_mutex_unlock (&m_readers_lock);
+}
+
+std::shared_ptr<MappedDictionary>
+Database::openDictionary (const char *filename)
+{
+    g_mutex_lock (&dictionaries_lock);
+    std::shared_ptr<MappedDictionary> dict = dictionaries[filename].lock ();
+    if (dict.get () == NULL) {
+        dict.reset (new MappedDictionary ());
+        if (dict->open (filename))
+            dictionaries[filename] = dict;
+        else
+            dict.reset ();
+    }
+    g_mutex_unlock (&dictionaries_lock);
+    return dict;
+}
+
 bool
 Database::loadUserDB (void)
 {
@@ -333,9 +492,16 @@ Database::loadUserDB (void)
         m_buffer << m_user_data_dir << G_DIR_SEPARATOR_S << USER_DICTIONARY_FILE;
 
         unsigned int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
-        if (sqlite3_open_v2 (m_buffer, &userdb, flags, NULL) != SQLITE_OK &&
-            sqlite3_open_v2 (":memory:", &userdb, flags, NULL) != SQLITE_OK)
-            break;
+        bool persistent = true;
+        if (sqlite3_open_v2 (m_buffer, &userdb, flags, NULL) != SQLITE_OK) {
+            if (userdb != NULL)
+                sqlite3_close (userdb);
+            userdb = NULL;
+            persistent = false;
+            g_warning ("can not open user database %s", m_buffer.c_str ());
+            if (sqlite3_open_v2 (":memory:", &userdb, flags, NULL) != SQLITE_OK)
+                break;
+        }
 
         m_sql = "BEGIN TRANSACTION;\n";
         /* create desc table*/
@@ -345,7 +511,8 @@ Database::loadUserDB (void)
               << "INSERT OR IGNORE INTO desc VALUES " << "('hostname', '" << Hostname () << "');\n"
               << "INSERT OR IGNORE INTO desc VALUES " << "('username', '" << Env ("USERNAME") << "');\n"
               << "INSERT OR IGNORE INTO desc VALUES " << "('create-time', datetime());\n"
-              << "INSERT OR IGNORE INTO desc VALUES " << "('attach-time', datetime());\n";
+              << "INSERT OR IGNORE INTO desc VALUES " << "('attach-time', datetime());\n"
+              << "INSERT OR IGNORE INTO desc VALUES " << "('journal-seq', '0');\n";
 
         /* create phrase tables */
         for (size_t i = 0; i < MAX_PHRASE_LEN; i++) {
@@ -372,6 +539,15 @@ Database::loadUserDB (void)
         if (!executeSQL (m_sql, userdb))
             break;
 
+        /* the writer first folds the journal left by a crash into the
+         * file. The user database is read from memory, and the changes
+         * are written back to the file in the background. */
+        if (persistent) {
+            String journal;
+            journal << m_user_data_dir << G_DIR_SEPARATOR_S << USER_JOURNAL_FILE;
+            m_writer.reset (new UserDBWriter (m_buffer, journal));
+        }
+
         sqlite3_backup *backup = sqlite3_backup_init (m_db, "userdb", userdb, "main");
 
         if (backup) {
@@ -379,50 +555,14 @@ Database::loadUserDB (void)
             sqlite3_backup_finish (backup);
         }
 
-        sqlite3_close (userdb);
-        return true;
-    } while (0);
-
-    if (userdb)
-        sqlite3_close (userdb);
-    return false;
-}
-
-bool
-Database::saveUserDB (void)
-{
-    g_mkdir_with_parents (m_user_data_dir, 0750);
-    m_buffer.clear ();
-    m_buffer << m_user_data_dir << G_DIR_SEPARATOR_S << USER_DICTIONARY_FILE;
-
-    String tmpfile = m_buffer + "-tmp";
-    sqlite3 *userdb = NULL;
-    do {
-        /* remove tmpfile if it exist */
-        g_unlink (tmpfile);
-
-        unsigned int flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
-        if (sqlite3_open_v2 (tmpfile, &userdb, flags, NULL) != SQLITE_OK)
-            break;
-
-        sqlite3_backup *backup = sqlite3_backup_init (userdb, "main", m_db, "userdb");
-
-        if (backup == NULL)
-            break;
-
-        sqlite3_backup_step (backup, -1);
-        sqlite3_backup_finish (backup);
         sqlite3_close (userdb);
 
-        g_rename (tmpfile, m_buffer);
-
+        m_updater.reset (new UserPhraseUpdater (m_db, "userdb"));
         return true;
     } while (0);
 
-    if (userdb != NULL)
+    if (userdb)
         sqlite3_close (userdb);
-    g_unlink (tmpfile);
-
     return false;
 }
 
@@ -438,38 +578,6 @@ Database::prefetch (void)
     // g_debug ("done");
 }
 
-// This function should be return gboolean because g_timeout_add_seconds requires it.
-gboolean
-Database::timeoutCallback (void * data)
-{
-    Database *self = static_cast<Database*> (data);
-
-    /* Get elapsed time since last modification of database. */
-    unsigned int elapsed = (unsigned int)g_timer_elapsed (self->m_timer, NULL);
-
-    if (elapsed >= DB_BACKUP_TIMEOUT &&
-        self->saveUserDB ()) {
-        self->m_timeout_id = 0;
-        return false;
-    }
-
-    return true;
-}
-
-void
-Database::modified (void)
-{
-    /* Restart the timer */
-    g_timer_start (m_timer);
-
-    if (m_timeout_id != 0)
-        return;
-
-    m_timeout_id = g_timeout_add_seconds (DB_BACKUP_TIMEOUT,
-                                          Database::timeoutCallback,
-                                          static_cast<void *> (this));
-}
-
 inline static bool
 pinyin_option_check_sheng (unsigned int option, unsigned int id, unsigned int fid)
 {
@@ -534,7 +642,126 @@ pinyin_option_check_yun (unsigned int option, unsigned int id, unsigned int fid)
     }
 }
 
+/* Every syllable has 1 to 3 sheng ids and 0 to 2 yun ids, so its part of
+ * the where clause takes one of 9 shapes, which fits in 4 bits. */
+static guint64
+conditions_shape (const MappedDictionary::Condition *conditions, size_t len)
+{
+    guint64 shape = 0;
+    for (size_t i = 0; i < len; i++) {
+        guint64 code = (conditions[i].sheng_count - 1) * 3 + conditions[i].yun_count + 1;
+        shape |= code << (i * 4);
+    }
+    return shape;
+}
+
+/* The ids are bound to the parameters ?1, ?2, ... in the order of sheng and
+ * yun ids of each syllable. The where clause refers to a parameter by its
+ * number, so both halves of a UNION share them. A fuzzy syllable becomes an
+ * IN list, and sqlite walks the index once for each accepted prefix. */
+static void
+where_sql (const MappedDictionary::Condition *conditions,
+           size_t                             len,
+           String                            &sql)
+{
+    int param = 1;
+
+    for (size_t i = 0; i < len; i++) {
+        const MappedDictionary::Condition &cond = conditions[i];
+
+        if (G_LIKELY (i > 0))
+            sql << " AND ";
+
+        if (cond.sheng_count == 1) {
+            sql.appendPrintf ("s%d=?%d", (int) i, param++);
+        }
+        else {
+            sql.appendPrintf ("s%d IN (", (int) i);
+            for (size_t j = 0; j < cond.sheng_count; j++)
+                sql.appendPrintf (j == 0 ? "?%d" : ",?%d", param++);
+            sql << ")";
+        }
+
+        if (cond.yun_count == 1) {
+            sql.appendPrintf (" AND y%d=?%d", (int) i, param++);
+        }
+        else if (cond.yun_count > 1) {
+            sql.appendPrintf (" AND y%d IN (", (int) i);
+            for (size_t j = 0; j < cond.yun_count; j++)
+                sql.appendPrintf (j == 0 ? "?%d" : ",?%d", param++);
+            sql << ")";
+        }
+    }
+}
+
+/* Returns a statement of the main or the user database with the pinyin ids
+ * bound. Statements are cached with the connection of reader, which the
+ * calling thread holds, by the shape of the where clause; a cached one
+ * still used by a running query is not shared, so a few are kept for each
+ * shape, and a new one is prepared only when all of them are in use. */
 SQLStmtPtr
+Database::prepareQuery (QueryReader                       &reader,
+                        const MappedDictionary::Condition *conditions,
+                        size_t                             len,
+                        bool                               userdb)
+{
+    guint64 shape = conditions_shape (conditions, len);
+
+    sqlite3 *db = userdb ? m_db : reader.db;
+    if (db == NULL)
+        return SQLStmtPtr ();
+
+    SQLStmtPtr stmt;
+    std::vector<SQLStmtPtr> & stmts = reader.stmts[userdb ? 1 : 0][shape];
+    for (size_t i = 0; i < stmts.size (); i++) {
+        if (stmts[i].use_count () == 1) {
+            stmt = stmts[i];
+            stmt->reset ();
+            break;
+        }
+    }
+
+    if (stmt.get () == NULL) {
+        String where;
+        where_sql (conditions, len, where);
+
+        /* each database is read in its own order, and the two streams are
+         * merged by MergePhraseStream */
+        int id = len - 1;
+        String sql;
+        if (userdb) {
+            sql << "SELECT * FROM userdb.py_phrase_" << id << " WHERE " << where
+                << " ORDER BY user_freq DESC, freq DESC, phrase";
+        }
+        else {
+            sql << "SELECT 0 AS user_freq, * FROM main.py_phrase_" << id << " WHERE " << where
+                << " ORDER BY freq DESC, phrase";
+        }
+#if 0
+        g_debug ("sql =\n%s", sql.c_str ());
+#endif
+
+        g_atomic_int_inc (&m_stmt_prepares);
+        stmt.reset (new SQLStmt (db));
+        if (!stmt->prepare (sql))
+            return SQLStmtPtr ();
+        if (stmts.size () < DB_SHAPE_STMTS)
+            stmts.push_back (stmt);
+    }
+
+    int param = 1;
+    for (size_t i = 0; i < len; i++) {
+        const MappedDictionary::Condition &cond = conditions[i];
+        for (size_t j = 0; j < cond.sheng_count; j++)
+            stmt->bindInt (param++, cond.sheng[j]);
+        for (size_t j = 0; j < cond.yun_count; j++)
+            stmt->bindInt (param++, cond.yun[j]);
+    }
+
+    return stmt;
+}
+
+PhraseStreamPtr
 Database::query (const PinyinArray &pinyin,
                  size_t             pinyin_begin,
                  size_t             pinyin_len,
@@ -545,153 +772,181 @@ Database::query (const PinyinArray &pinyin,
     g_assert (pinyin_len <= pinyin.size () - pinyin_begin);
     g_assert (pinyin_len <= MAX_PHRASE_LEN);
 
-    /* prepare sql */
-    Conditions conditions;
+    /* collect the accepted ids of each syllable */
+    MappedDictionary::Condition conditions[MAX_PHRASE_LEN];
 
     for (size_t i = 0; i < pinyin_len; i++) {
         const Pinyin *p;
-        bool fs1, fs2;
         p = pinyin[i + pinyin_begin];
 
-        fs1 = pinyin_option_check_sheng (option, p->pinyin_id[0].sheng, p->pinyin_id[1].sheng);
-        fs2 = pinyin_option_check_sheng (option, p->pinyin_id[0].sheng, p->pinyin_id[2].sheng);
-
-        if (G_LIKELY (i > 0))
-            conditions.appendPrintf (0, conditions.size (),
-                                       " AND ");
-
-        if (G_UNLIKELY (fs1 || fs2)) {
-            if (G_LIKELY (i < DB_INDEX_SIZE)) {
-                if (fs1 && fs2 == 0) {
-                    conditions.double_ ();
-                    conditions.appendPrintf (0, conditions.size ()  >> 1,
-                                               "s%d=%d", i, p->pinyin_id[0].sheng);
-                    conditions.appendPrintf (conditions.size () >> 1, conditions.size (),
-                                               "s%d=%d", i, p->pinyin_id[1].sheng);
-                }
-                else if (fs1 == 0 && fs2) {
-                    conditions.double_ ();
-                    conditions.appendPrintf (0, conditions.size ()  >> 1,
-                                               "s%d=%d", i, p->pinyin_id[0].sheng);
-                    conditions.appendPrintf (conditions.size () >> 1, conditions.size (),
-                                               "s%d=%d", i, p->pinyin_id[2].sheng);
-                }
-                else {
-                    size_t len = conditions.size ();
-                    conditions.triple ();
-                    conditions.appendPrintf (0, len,
-                                               "s%d=%d", i, p->pinyin_id[0].sheng);
-                    conditions.appendPrintf (len, len << 1,
-                                               "s%d=%d", i, p->pinyin_id[1].sheng);
-                    conditions.appendPrintf (len << 1, conditions.size (),
-                                               "s%d=%d", i, p->pinyin_id[2].sheng);
-                }
-            }
-            else {
-                if (fs1 && fs2 == 0) {
-                    conditions.appendPrintf (0, conditions.size (),
-                                               "s%d IN (%d,%d)", i, p->pinyin_id[0].sheng, p->pinyin_id[1].sheng);
-                }
-                else if (fs1 == 0 && fs2) {
-                    conditions.appendPrintf (0, conditions.size (),
-                                               "s%d IN (%d,%d)", i, p->pinyin_id[0].sheng, p->pinyin_id[2].sheng);
-                }
-                else {
-                    conditions.appendPrintf (0, conditions.size (),
-                                               "s%d IN (%d,%d,%d)", i, p->pinyin_id[0].sheng, p->pinyin_id[1].sheng, p->pinyin_id[2].sheng);
-                }
-            }
-        }
-        else {
-            conditions.appendPrintf (0, conditions.size (),
-                                       "s%d=%d", i, p->pinyin_id[0].sheng);
-        }
+        MappedDictionary::Condition &cond = conditions[i];
+        cond.reset ();
+        cond.addSheng (p->pinyin_id[0].sheng);
+        if (pinyin_option_check_sheng (option, p->pinyin_id[0].sheng, p->pinyin_id[1].sheng))
+            cond.addSheng (p->pinyin_id[1].sheng);
+        if (pinyin_option_check_sheng (option, p->pinyin_id[0].sheng, p->pinyin_id[2].sheng))
+            cond.addSheng (p->pinyin_id[2].sheng);
 
         if (p->pinyin_id[0].yun != PINYIN_ID_ZERO) {
-            if (pinyin_option_check_yun (option, p->pinyin_id[0].yun, p->pinyin_id[1].yun)) {
-                if (G_LIKELY (i < DB_INDEX_SIZE)) {
-                    conditions.double_ ();
-                    conditions.appendPrintf (0, conditions.size ()  >> 1,
-                                               " AND y%d=%d", i, p->pinyin_id[0].yun);
-                    conditions.appendPrintf (conditions.size () >> 1, conditions.size (),
-                                               " and y%d=%d", i, p->pinyin_id[1].yun);
-                }
-                else {
-                    conditions.appendPrintf (0, conditions.size (),
-                                               " AND y%d IN (%d,%d)", i, p->pinyin_id[0].yun, p->pinyin_id[1].yun);
-                }
-            }
-            else {
-                conditions.appendPrintf (0, conditions.size (),
-                                           " AND y%d=%d", i, p->pinyin_id[0].yun);
-            }
+            cond.addYun (p->pinyin_id[0].yun);
+            if (pinyin_option_check_yun (option, p->pinyin_id[0].yun, p->pinyin_id[1].yun))
+                cond.addYun (p->pinyin_id[1].yun);
         }
     }
 
+    if (m <= 0)
+        return lookupCache (conditions, pinyin_len);
 
-    m_buffer.clear ();
-    for (size_t i = 0; i < conditions.size (); i++) {
-        if (G_UNLIKELY (i == 0))
-            m_buffer << "  (" << conditions[i] << ")\n";
-        else
-            m_buffer << "  OR (" << conditions[i] << ")\n";
+    unsigned int generation;
+    PhraseStreamPtr stream = queryStreams (conditions, pinyin_len, generation);
+    if (stream.get () == NULL)
+        return stream;
+    return PhraseStreamPtr (new LimitedPhraseStream (stream, m));
+}
+
+/* The accepted ids are what the pinyin ids of a span and the conversion
+ * option decide the result by, so they are the key of the cache. */
+PhraseStreamPtr
+Database::lookupCache (const MappedDictionary::Condition *conditions,
+                       size_t                             pinyin_len)
+{
+    std::string key (1, (char) pinyin_len);
+    for (size_t i = 0; i < pinyin_len; i++) {
+        const MappedDictionary::Condition &cond = conditions[i];
+        key += (char) cond.sheng_count;
+        key.append ((const char *) cond.sheng, cond.sheng_count);
+        key += (char) cond.yun_count;
+        key.append ((const char *) cond.yun, cond.yun_count);
     }
 
-    m_sql.clear ();
-    int id = pinyin_len - 1;
-    m_sql << "SELECT * FROM ("
-                "SELECT 0 AS user_freq, * FROM main.py_phrase_" << id << " WHERE " << m_buffer << " UNION ALL "
-                "SELECT * FROM userdb.py_phrase_" << id << " WHERE " << m_buffer << ") "
-                    "GROUP BY phrase ORDER BY user_freq DESC, freq DESC";
-    if (m > 0)
-        m_sql << " LIMIT " << m;
-#if 0
-    g_debug ("sql =\n%s", m_sql.c_str ());
-#endif
+    g_mutex_lock (&m_cache_lock);
+    QueryCacheMap::iterator it = m_cache_map.find (key);
+    if (it != m_cache_map.end ()) {
+        g_atomic_int_inc (&m_cache_hits);
+        m_cache_list.splice (m_cache_list.begin (), m_cache_list, it->second);
+        PhraseStreamPtr stream (new CachedPhraseStream (*this, *it->second));
+        g_mutex_unlock (&m_cache_lock);
+        return stream;
+    }
+    g_atomic_int_inc (&m_cache_misses);
+    g_mutex_unlock (&m_cache_lock);
+
+    unsigned int generation;
+    PhraseStreamPtr source = queryStreams (conditions, pinyin_len, generation);
+    if (source.get () == NULL)
+        return PhraseStreamPtr ();
+
+    QueryCacheEntryPtr entry (new QueryCacheEntry ());
+    entry->key = key;
+    std::copy (conditions, conditions + pinyin_len, entry->conditions);
+    entry->len = pinyin_len;
+
+    /* The rows are read now and the source is dropped, which resets its
+     * stmts for the next queries of the same shape */
+    Phrase phrase;
+    while (entry->phrases.size () < DB_QUERY_CACHE_ROWS && source->next (phrase))
+        entry->phrases.push_back (phrase);
+    entry->complete = entry->phrases.size () < DB_QUERY_CACHE_ROWS;
+    source.reset ();
+
+    /* A commit since the user database was read would not have found the
+     * entry to drop it, so the entry is not cached then. Neither is it if
+     * another thread cached the same query meanwhile. */
+    g_mutex_lock (&m_cache_lock);
+    if (generation == this->generation () &&
+        m_cache_map.find (key) == m_cache_map.end ()) {
+        m_cache_list.push_front (entry);
+        m_cache_map[key] = m_cache_list.begin ();
+        if (m_cache_list.size () > DB_QUERY_CACHE_SIZE) {
+            m_cache_map.erase (m_cache_list.back ()->key);
+            m_cache_list.pop_back ();
+        }
+    }
+    g_mutex_unlock (&m_cache_lock);
 
-    /* query database */
-    SQLStmtPtr stmt (new SQLStmt (m_db));
+    return PhraseStreamPtr (new CachedPhraseStream (*this, entry));
+}
 
-    if (!stmt->prepare (m_sql)) {
-        stmt.reset ();
+/* Drops the cached results the phrase would appear in. Running queries
+ * keep their entries, the same as they keep their sqlite stmts. */
+void
+Database::invalidateCache (const Phrase & phrase)
+{
+    g_mutex_lock (&m_cache_lock);
+    QueryCacheList::iterator it = m_cache_list.begin ();
+    while (it != m_cache_list.end ()) {
+        if ((*it)->matches (phrase)) {
+            m_cache_map.erase ((*it)->key);
+            it = m_cache_list.erase (it);
+        }
+        else {
+            ++it;
+        }
     }
-
-    return stmt;
+    g_mutex_unlock (&m_cache_lock);
 }
 
-inline void
-Database::phraseWhereSql (const Phrase & p, String & sql)
+/* Reads the user phrases with the overlay applied, and the generation of
+ * the database they belong to */
+PhraseStreamPtr
+Database::queryUserDB (const MappedDictionary::Condition *conditions,
+                       size_t                             pinyin_len,
+                       unsigned int                      &generation)
 {
-    sql << " WHERE";
-    sql << " s0=" << p.pinyin_id[0].sheng
-        << " AND y0=" << p.pinyin_id[0].yun;
-    for (size_t i = 1; i < p.len; i++) {
-        sql << " AND s" << i << '=' << p.pinyin_id[i].sheng
-            << " AND y" << i << '=' << p.pinyin_id[i].yun;
+    PhraseStreamPtr rows;
+
+    QueryReaderPtr reader = acquireReader ();
+    g_rw_lock_reader_lock (&m_user_lock);
+    generation = this->generation ();
+    SQLStmtPtr stmt = prepareQuery (*reader, conditions, pinyin_len, true);
+    if (stmt.get () != NULL) {
+        /* read all rows now, the user database may change before the
+         * stream is read; a query has few user phrases */
+        std::shared_ptr<ArrayPhraseStream> array (new ArrayPhraseStream ());
+        SQLPhraseStream stream (stmt, pinyin_len);
+        Phrase phrase;
+        while (stream.next (phrase))
+            array->phrases ().push_back (phrase);
+        rows = m_overlay.apply (array, conditions, pinyin_len);
     }
-    sql << " AND phrase=\"" << p.phrase << "\"";
+    g_rw_lock_reader_unlock (&m_user_lock);
+    stmt.reset ();
+    releaseReader (reader);
 
+    return rows;
 }
 
-inline void
-Database::phraseSql (const Phrase & p, String & sql)
+/* Merges the phrases of the user database with the ones of the system
+ * database, which come from sqlite or from the ranges of the compiled
+ * dictionary. */
+PhraseStreamPtr
+Database::queryStreams (const MappedDictionary::Condition *conditions,
+                        size_t                             pinyin_len,
+                        unsigned int                      &generation)
 {
-    sql << "INSERT OR IGNORE INTO userdb.py_phrase_" << p.len - 1
-        << " VALUES(" << 0                  /* user_freq */
-        << ",\"" << p.phrase << '"'         /* phrase */
-        << ','   << p.freq;                 /* freq */
+    std::vector<PhraseStreamPtr> sources;
 
-    for (size_t i = 0; i < p.len; i++) {
-        sql << ',' << p.pinyin_id[i].sheng << ',' << p.pinyin_id[i].yun;
-    }
+    PhraseStreamPtr rows = queryUserDB (conditions, pinyin_len, generation);
+    if (rows.get () == NULL)
+        return PhraseStreamPtr ();
+    sources.push_back (rows);
 
-    sql << ");\n";
-
-    sql << "UPDATE userdb.py_phrase_" << p.len - 1
-        << " SET user_freq=user_freq+1";
+    if (m_dict.get () != NULL) {
+        m_dict->lookup (conditions, pinyin_len, sources);
+    }
+    else {
+        QueryReaderPtr reader = acquireReader ();
+        SQLStmtPtr stmt = prepareQuery (*reader, conditions, pinyin_len, false);
+        releaseReader (reader);
+        if (stmt.get () == NULL)
+            return PhraseStreamPtr ();
+        sources.push_back (PhraseStreamPtr (new SQLPhraseStream (reader, stmt, pinyin_len)));
+    }
 
-    phraseWhereSql (p, sql);
-    sql << ";\n";
+    std::shared_ptr<MergePhraseStream> stream (new MergePhraseStream ());
+    for (size_t i = 0; i < sources.size (); i++)
+        stream->addSource (sources[i]);
+    return stream;
 }
 
 void
@@ -699,44 +954,92 @@ Database::commit (const PhraseArray  &phrases)
 {
     Phrase phrase = {""};
 
-    m_sql = "BEGIN TRANSACTION;\n";
+    g_rw_lock_writer_lock (&m_user_lock);
+    /* the running queries do not cache their results, see lookupCache () */
+    g_atomic_int_inc (&m_generation);
     for (size_t i = 0; i < phrases.size (); i++) {
         phrase += phrases[i];
-        phraseSql (phrases[i], m_sql);
+        commitPhrase (phrases[i]);
     }
     if (phrases.size () > 1)
-        phraseSql (phrase, m_sql);
-    m_sql << "COMMIT;\n";
+        commitPhrase (phrase);
 
-    executeSQL (m_sql);
-    modified ();
+    if (m_overlay.size () > DB_OVERLAY_SIZE)
+        foldOverlay ();
+    g_rw_lock_writer_unlock (&m_user_lock);
+}
+
+inline void
+Database::commitPhrase (const Phrase & phrase)
+{
+    m_overlay.insert (phrase, 1);
+    invalidateCache (phrase);
+    if (m_writer.get () != NULL)
+        m_writer->insert (phrase);
 }
 
 void
 Database::remove (const Phrase & phrase)
 {
-    m_sql = "BEGIN TRANSACTION;\n";
-    m_sql << "DELETE FROM userdb.py_phrase_" << phrase.len - 1;
-    phraseWhereSql (phrase, m_sql);
-    m_sql << ";\n";
-    m_sql << "COMMIT;\n";
+    g_rw_lock_writer_lock (&m_user_lock);
+    g_atomic_int_inc (&m_generation);
+    m_overlay.remove (phrase);
+    invalidateCache (phrase);
+    if (m_writer.get () != NULL)
+        m_writer->remove (phrase);
+    g_rw_lock_writer_unlock (&m_user_lock);
+}
 
-    executeSQL (m_sql);
-    modified ();
+/* Moves the overlay into the in-memory user database. It does not change
+ * any query result, so the cache stays valid. */
+void
+Database::foldOverlay (void)
+{
+    if (m_updater.get () == NULL || !executeSQL ("BEGIN TRANSACTION;"))
+        return;
+
+    for (size_t len = 1; len <= MAX_PHRASE_LEN; len++) {
+        const UserPhraseOverlay::Entries &entries = m_overlay.entries (len);
+        for (UserPhraseOverlay::Entries::const_iterator it = entries.begin ();
+             it != entries.end (); ++it) {
+            if (it->second.removed)
+                m_updater->remove (it->second.phrase);
+            if (it->second.delta > 0)
+                m_updater->insert (it->second.phrase, it->second.delta);
+        }
+    }
+
+    if (executeSQL ("COMMIT;"))
+        m_overlay.clear ();
+    else
+        executeSQL ("ROLLBACK;");
 }
 
 void
 Database::init (const std::string & user_data_dir)
 {
     if (m_instance.get () == NULL) {
-        m_instance.reset (new Database (user_data_dir));
+        m_instance = instance (user_data_dir);
     }
 }
 
 void
 Database::finalize (void)
 {
-    m_instance.reset (NULL);
+    m_instance.reset ();
+}
+
+DatabasePtr
+Database::instance (const std::string & user_data_dir)
+{
+    g_mutex_lock (&databases_lock);
+    DatabasePtr database = databases[user_data_dir].lock ();
+    if (database.get () == NULL) {
+        database.reset (new Database (user_data_dir));
+        databases[user_data_dir] = database;
+    }
+    g_mutex_unlock (&databases_lock);
+    return database;
 }
 
 };  // namespace PyZy
@@ -22,7 +22,13 @@
 #ifndef __PYZY_DATABASE_H_
 #define __PYZY_DATABASE_H_
 
+#include <list>
+#include <map>
+
+#include "MappedDictionary.h"
 #include "PhraseArray.h"
+#include "PhraseStream.h"
+#include "UserPhraseOverlay.h"
 #include "String.h"
 #include "Types.h"
 #include "Util.h"
@@ -36,12 +42,21 @@ struct Phrase;
 
 class SQLStmt;
 typedef std::shared_ptr<SQLStmt> SQLStmtPtr;
+class UserDBWriter;
+class UserPhraseUpdater;
 
 class Database;
+typedef std::shared_ptr<Database> DatabasePtr;
+
+struct QueryCacheEntry;
+typedef std::shared_ptr<QueryCacheEntry> QueryCacheEntryPtr;
+struct QueryReader;
+typedef std::shared_ptr<QueryReader> QueryReaderPtr;
 
 class Query {
 public:
-    Query (const PinyinArray    & pinyin,
+    Query (Database             & database,
+           const PinyinArray    & pinyin,
            size_t                 pinyin_begin,
            size_t                 pinyin_len,
            unsigned int           option);
@@ -49,11 +64,12 @@ public:
     int fill (PhraseArray &phrases, int count);
 
 private:
+    Database & m_database;
     const PinyinArray & m_pinyin;
     size_t m_pinyin_begin;
     size_t m_pinyin_len;
     unsigned int m_option;
-    SQLStmtPtr m_stmt;
+    PhraseStreamPtr m_stream;
 };
 
 class Database {
@@ -65,48 +81,114 @@ protected:
 public:
     static void init (const std::string & data_dir);
 
-    SQLStmtPtr query (const PinyinArray   & pinyin,
-                      size_t                pinyin_begin,
-                      size_t                pinyin_len,
-                      int                   m,
-                      unsigned int          option);
+    PhraseStreamPtr query (const PinyinArray   & pinyin,
+                           size_t                pinyin_begin,
+                           size_t                pinyin_len,
+                           int                   m,
+                           unsigned int          option);
     void commit (const PhraseArray  & phrases);
     void remove (const Phrase & phrase);
 
-    void conditionsDouble (void);
-    void conditionsTriple (void);
+    /* changes whenever the user database is written */
+    unsigned int generation (void) const
+    {
+        return g_atomic_int_get (&m_generation);
+    }
+
+    /* The main database was built with traditional phrases, so the phrases
+     * need no conversion in traditional Chinese mode */
+    bool traditional (void) const { return m_traditional; }
+
+    /* statistics of the query result cache */
+    size_t queryCacheHits (void) const { return g_atomic_int_get (&m_cache_hits); }
+    size_t queryCacheMisses (void) const { return g_atomic_int_get (&m_cache_misses); }
+    /* query stmts prepared, since the cached ones of the shape were busy
+     * or there were none yet */
+    size_t queryPrepares (void) const { return g_atomic_int_get (&m_stmt_prepares); }
 
     static void finalize (void);
-    static Database & instance (void)
+
+    /* the database of InputContext::init () */
+    static const DatabasePtr & instance (void)
     {
         if (m_instance == NULL) {
             g_error ("Error: Please call InputContext::init () !");
         }
-        return *m_instance;
+        return m_instance;
     }
 
+    /* The database of the user in user_data_dir. All the databases share
+     * one compiled main database. query () may be called from several
+     * threads at once, and commit () and remove () block the queries of
+     * the same database only while they update the user phrases. */
+    static DatabasePtr instance (const std::string & user_data_dir);
+
 private:
+    friend class CachedPhraseStream;
+
     bool open (void);
+    bool openMainDB (const char *name);
+    static std::shared_ptr<MappedDictionary> openDictionary (const char *filename);
+    QueryReaderPtr acquireReader (void);
+    void releaseReader (const QueryReaderPtr &reader);
+    SQLStmtPtr prepareQuery (QueryReader                       &reader,
+                             const MappedDictionary::Condition *conditions,
+                             size_t                             len,
+                             bool                               userdb);
+    PhraseStreamPtr queryUserDB (const MappedDictionary::Condition *conditions,
+                                 size_t                             pinyin_len,
+                                 unsigned int                      &generation);
+    PhraseStreamPtr lookupCache (const MappedDictionary::Condition *conditions,
+                                 size_t                             pinyin_len);
+    void invalidateCache (const Phrase & phrase);
+    PhraseStreamPtr queryStreams (const MappedDictionary::Condition *conditions,
+                                  size_t                             pinyin_len,
+                                  unsigned int                      &generation);
     bool loadUserDB (void);
-    bool saveUserDB (void);
     void prefetch (void);
-    void phraseSql (const Phrase & p, String & sql);
-    void phraseWhereSql (const Phrase & p, String & sql);
+    void commitPhrase (const Phrase & phrase);
+    void foldOverlay (void);
     bool executeSQL (const char *sql, sqlite3 *db = NULL);
-    void modified (void);
-    static gboolean timeoutCallback (void * data);
 
 private:
-    sqlite3 *m_db;              /* sqlite3 database */
-
-    String m_sql;        /* sql stmt */
-    String m_buffer;     /* temp buffer */
-    unsigned int m_timeout_id;
-    GTimer *m_timer;
+    sqlite3 *m_db;              /* sqlite3 database holding userdb */
+    std::shared_ptr<MappedDictionary> m_dict;   /* compiled main database,
+                                                   shared by all instances */
+    String m_main_db;           /* or the file name of the main database */
+    bool m_traditional;         /* the main database is traditional Chinese */
+
+    /* The idle connections to the main database with their prepared
+     * stmts. A querying thread takes one while it prepares a query, so no
+     * two threads prepare on one connection, and a few are kept for the
+     * next queries. */
+    GMutex m_readers_lock;
+    std::vector<QueryReaderPtr> m_readers;
+
+    /* Queries read userdb and m_overlay with the reader lock held, and
+     * commit () and remove () change them with the writer lock held */
+    GRWLock m_user_lock;
+
+    /* LRU cache of query results, the most recently used entry first */
+    typedef std::list<QueryCacheEntryPtr> QueryCacheList;
+    typedef std::map<std::string, QueryCacheList::iterator> QueryCacheMap;
+    GMutex m_cache_lock;
+    QueryCacheList m_cache_list;
+    QueryCacheMap m_cache_map;
+    gint m_cache_hits;
+    gint m_cache_misses;
+    gint m_stmt_prepares;
+    gint m_generation;
+
+    String m_sql;        /* sql stmt, not used by queries */
+    String m_buffer;     /* temp buffer, not used by queries */
     String m_user_data_dir;
+    UserPhraseOverlay m_overlay;    /* user phrase changes not in userdb yet */
+    std::unique_ptr<UserPhraseUpdater> m_updater;   /* folds m_overlay */
+    std::unique_ptr<UserDBWriter> m_writer; /* background writer of the user
+                                               database file */
 
 private:
-    static std::unique_ptr<Database> m_instance;
+    static DatabasePtr m_instance;
 };
 
 };  // namespace PyZy
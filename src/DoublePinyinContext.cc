@@ -45,9 +45,11 @@ namespace PyZy {
 #define IS_ALPHA(c) \
     ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
 
-DoublePinyinContext::DoublePinyinContext (PhoneticContext::Observer *observer)
-    : PinyinContext (observer),
-      m_double_pinyin_schema (DOUBLE_PINYIN_KEYBOARD_MSPY)
+DoublePinyinContext::DoublePinyinContext (PhoneticContext::Observer *observer,
+                                          const DatabasePtr &database)
+    : PinyinContext (observer, database),
+      m_double_pinyin_schema (DOUBLE_PINYIN_KEYBOARD_MSPY),
+      m_pinyin_table_valid (false)
 {
 }
 
@@ -347,6 +349,29 @@ DoublePinyinContext::moveCursorToEnd (void)
 
 inline const Pinyin *
 DoublePinyinContext::isPinyin (int i)
+{
+    return m_sheng_table[i];
+}
+
+inline const Pinyin *
+DoublePinyinContext::isPinyin (int i, int j)
+{
+    return m_pinyin_table[i][j];
+}
+
+void
+DoublePinyinContext::updatePinyinTable (void)
+{
+    for (int i = 0; i < 27; i++) {
+        m_sheng_table[i] = lookupPinyin (i);
+        for (int j = 0; j < 27; j++)
+            m_pinyin_table[i][j] = lookupPinyin (i, j);
+    }
+    m_pinyin_table_valid = true;
+}
+
+const Pinyin *
+DoublePinyinContext::lookupPinyin (int i)
 {
     if ((m_config.option & PINYIN_INCOMPLETE_PINYIN) == 0) {
         return NULL;
@@ -361,8 +386,8 @@ DoublePinyinContext::isPinyin (int i)
     return PinyinParser::isPinyin (sheng, 0, PINYIN_INCOMPLETE_PINYIN);
 }
 
-inline const Pinyin *
-DoublePinyinContext::isPinyin (int i, int j)
+const Pinyin *
+DoublePinyinContext::lookupPinyin (int i, int j)
 {
     const Pinyin *pinyin = NULL;
     char sheng = ID_TO_SHENG (i);
@@ -447,6 +472,9 @@ DoublePinyinContext::updatePinyin (bool all)
         return retval;
     }
 
+    if (G_UNLIKELY (!m_pinyin_table_valid))
+        updatePinyinTable ();
+
     if (m_pinyin_len < m_cursor) {
         size_t len = m_pinyin_len;
         if (m_pinyin.empty () == false &&
@@ -511,9 +539,13 @@ DoublePinyinContext::setProperty (PropertyName name, const Variant &variant)
         }
 
         m_double_pinyin_schema = schema;
+        m_pinyin_table_valid = false;
         return true;
     }
 
+    if (name == PROPERTY_CONVERSION_OPTION)
+        m_pinyin_table_valid = false;
+
     return PhoneticContext::setProperty (name, variant);
 }
 
@@ -29,7 +29,8 @@ namespace PyZy {
 class DoublePinyinContext : public PinyinContext {
 
 public:
-    explicit DoublePinyinContext (PhoneticContext::Observer *observer);
+    DoublePinyinContext (PhoneticContext::Observer *observer,
+                         const DatabasePtr &database);
     virtual ~DoublePinyinContext ();
 
     virtual bool insert (char ch);
@@ -55,8 +56,18 @@ protected:
 private:
     const Pinyin *isPinyin (int i, int j);
     const Pinyin *isPinyin (int i);
+    const Pinyin *lookupPinyin (int i, int j);
+    const Pinyin *lookupPinyin (int i);
+    void updatePinyinTable (void);
 
     unsigned int m_double_pinyin_schema;
+
+    /* The pinyin of every pair of keys and of every single key, for the
+     * schema and the option. It is built again by updatePinyin () after
+     * either of them changed. */
+    bool m_pinyin_table_valid;
+    const Pinyin *m_pinyin_table[27][27];
+    const Pinyin *m_sheng_table[27];
 };
 
 };  // namespace PyZy
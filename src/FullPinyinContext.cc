@@ -29,8 +29,10 @@
 
 namespace PyZy {
 
-FullPinyinContext::FullPinyinContext (PhoneticContext::Observer *observer)
-  : PinyinContext (observer)
+FullPinyinContext::FullPinyinContext (PhoneticContext::Observer *observer,
+                                      const DatabasePtr &database)
+  : PinyinContext (observer, database),
+    m_parsed_option (0)
 {
 }
 
@@ -236,20 +238,38 @@ FullPinyinContext::moveCursorToEnd (void)
 void
 FullPinyinContext::updatePinyin (void)
 {
+    /* the leading segments the phrase editor may keep */
+    size_t changed = 0;
+
     if (G_UNLIKELY (m_text.empty ())) {
         m_pinyin.clear ();
         m_pinyin_len = 0;
     }
     else {
+        /* m_pinyin holds a prefix of the segments parsed last time, so only
+         * the syllables after the first changed byte are parsed again */
+        size_t edit = 0;
+        if (m_config.option == m_parsed_option) {
+            while (edit < m_cursor && edit < m_parsed_text.length () &&
+                   m_text[edit] == m_parsed_text[edit])
+                edit ++;
+        }
+
         m_pinyin_len = PinyinParser::parse (
             m_text,              // text
             m_cursor,            // text length
             m_config.option,     // option
             m_pinyin,            // result
-            MAX_PHRASE_LEN);     // max result length
+            MAX_PHRASE_LEN,      // max result length
+            edit,                // first changed byte
+            changed);            // first changed segment
+        if (m_config.option != m_parsed_option)
+            changed = 0;
+        m_parsed_text.assign (m_text, 0, m_cursor);
+        m_parsed_option = m_config.option;
     }
 
-    updatePhraseEditor ();
+    updatePhraseEditor (changed);
     update ();
 }
 
@@ -29,7 +29,8 @@ namespace PyZy {
 class FullPinyinContext : public PinyinContext {
 
 public:
-    explicit FullPinyinContext (PhoneticContext::Observer *observer);
+    FullPinyinContext (PhoneticContext::Observer *observer,
+                       const DatabasePtr &database);
     virtual ~FullPinyinContext (void);
 
 public:
@@ -50,6 +51,9 @@ public:
 protected:
     virtual void updatePinyin (void);
 
+private:
+    String m_parsed_text;           /* the text m_pinyin was parsed from */
+    unsigned int m_parsed_option;   /* and the option */
 };
 
 };  // namespace PyZy
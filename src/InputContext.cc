@@ -64,20 +64,38 @@ InputContext::finalize ()
     Database::finalize ();
 }
 
-InputContext *
-InputContext::create (InputContext::InputType type,
-                      InputContext::Observer * observer) {
+static InputContext *
+create_context (InputContext::InputType type,
+                InputContext::Observer * observer,
+                const DatabasePtr & database)
+{
     switch (type) {
-    case FULL_PINYIN:
-        return new FullPinyinContext (observer);
-    case DOUBLE_PINYIN:
-        return new DoublePinyinContext (observer);
-    case BOPOMOFO:
-        return new BopomofoContext (observer);
+    case InputContext::FULL_PINYIN:
+        return new FullPinyinContext (observer, database);
+    case InputContext::DOUBLE_PINYIN:
+        return new DoublePinyinContext (observer, database);
+    case InputContext::BOPOMOFO:
+        return new BopomofoContext (observer, database);
     default:
         g_warning ("unknown context type.\n");
         return NULL;
     }
 }
 
+InputContext *
+InputContext::create (InputContext::InputType type,
+                      InputContext::Observer * observer) {
+    return create_context (type, observer, Database::instance ());
+}
+
+InputContext *
+InputContext::create (InputContext::InputType type,
+                      InputContext::Observer * observer,
+                      const std::string & user_cache_dir) {
+    if (user_cache_dir.empty ()) {
+        g_error ("Error: user_cache_dir should not be empty");
+    }
+    return create_context (type, observer, Database::instance (user_cache_dir));
+}
+
 }  // namespace PyZy
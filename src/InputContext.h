@@ -418,6 +418,24 @@ public:
     static InputContext * create (InputContext::InputType type,
                                   InputContext::Observer * observer);
 
+    /**
+     * \brief Creates a new InputContext instance for another user.
+     * @param type The type of the input.
+     * @param observer Observer to get a notification from the InputContext
+     *        instance.
+     * @param user_cache_dir The directory of the user database. Contexts
+     *        created with the same directory share the database.
+     * @return instance of the InputContext.
+     *
+     * The system dictionary is shared by all users. Contexts of different
+     * users may be used from different threads at the same time, while
+     * the contexts of one user must be used from one thread at a time.
+     * You should take responsibility for deleting the instance.
+     */
+    static InputContext * create (InputContext::InputType type,
+                                  InputContext::Observer * observer,
+                                  const std::string & user_cache_dir);
+
     /**
      * \brief Returns a input text.
      * @return input text.
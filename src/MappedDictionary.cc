@@ -0,0 +1,296 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#include "MappedDictionary.h"
+
+#include <cstring>
+
+namespace PyZy {
+
+#define DICT_MAGIC          "PYZYDICT"
+#define DICT_MAGIC_LEN      (8)
+#define DICT_VERSION        (2)
+/* version 1 has no flags after the text offset and size */
+#define DICT_HEADER_SIZE_1  (DICT_MAGIC_LEN + 4 * 2 + MAX_PHRASE_LEN * 8 + 4 * 2)
+#define DICT_HEADER_SIZE    (DICT_HEADER_SIZE_1 + 4)
+
+#define DICT_FLAG_TRADITIONAL   (1 << 0)
+
+/* record: text offset, freq, and then sheng & yun ids padded to 4 bytes */
+#define DICT_RECORD_TEXT    (0)
+#define DICT_RECORD_FREQ    (4)
+#define DICT_RECORD_IDS     (8)
+
+static inline guint32
+read_uint32 (const guint8 *p)
+{
+    guint32 v;
+    std::memcpy (&v, p, sizeof (v));
+    return v;
+}
+
+static inline size_t
+record_size (size_t len)
+{
+    return DICT_RECORD_IDS + ((2 * len + 3) & ~3);
+}
+
+MappedDictionary::MappedDictionary (void)
+    : m_file (NULL),
+      m_text (NULL),
+      m_text_size (0),
+      m_flags (0)
+{
+    std::memset (m_tables, 0, sizeof (m_tables));
+}
+
+MappedDictionary::~MappedDictionary (void)
+{
+    close ();
+}
+
+bool
+MappedDictionary::open (const char *filename)
+{
+    close ();
+
+    GError *error = NULL;
+    m_file = g_mapped_file_new (filename, FALSE, &error);
+    if (m_file == NULL) {
+        g_warning ("can not map %s: %s", filename, error->message);
+        g_error_free (error);
+        return false;
+    }
+
+    do {
+        const guint8 *data = (const guint8 *) g_mapped_file_get_contents (m_file);
+        size_t length = g_mapped_file_get_length (m_file);
+
+        if (length < DICT_HEADER_SIZE_1 ||
+            std::memcmp (data, DICT_MAGIC, DICT_MAGIC_LEN) != 0)
+            break;
+
+        const guint8 *p = data + DICT_MAGIC_LEN;
+        guint32 version = read_uint32 (p);
+        if (version < 1 || version > DICT_VERSION ||
+            read_uint32 (p + 4) != MAX_PHRASE_LEN)
+            break;
+        if (version > 1 && length < DICT_HEADER_SIZE)
+            break;
+        p += 8;
+
+        size_t i;
+        for (i = 0; i < MAX_PHRASE_LEN; i++, p += 8) {
+            size_t offset = read_uint32 (p);
+            size_t count = read_uint32 (p + 4);
+            size_t size = record_size (i + 1);
+            if (offset > length || count > (length - offset) / size)
+                break;
+            m_tables[i].records = data + offset;
+            m_tables[i].count = count;
+            m_tables[i].record_size = size;
+        }
+        if (i != MAX_PHRASE_LEN)
+            break;
+
+        size_t text_offset = read_uint32 (p);
+        m_text_size = read_uint32 (p + 4);
+        if (m_text_size == 0 || text_offset > length ||
+            m_text_size > length - text_offset ||
+            data[text_offset + m_text_size - 1] != '\0')
+            break;
+        m_text = (const char *) data + text_offset;
+        m_flags = version > 1 ? read_uint32 (p + 8) : 0;
+
+        return true;
+    } while (0);
+
+    g_warning ("%s is not a valid phrase dictionary", filename);
+    close ();
+    return false;
+}
+
+void
+MappedDictionary::close (void)
+{
+    if (m_file != NULL) {
+        g_mapped_file_unref (m_file);
+        m_file = NULL;
+    }
+    m_text = NULL;
+    m_text_size = 0;
+    m_flags = 0;
+    std::memset (m_tables, 0, sizeof (m_tables));
+}
+
+bool
+MappedDictionary::traditional (void) const
+{
+    return (m_flags & DICT_FLAG_TRADITIONAL) != 0;
+}
+
+/* All records in [begin, end) share the bytes before column, so the
+ * column itself is sorted and can be searched with a binary search. */
+static inline size_t
+lower_bound (const guint8 *records,
+             size_t        size,
+             size_t        column,
+             size_t        begin,
+             size_t        end,
+             guint8        value)
+{
+    while (begin < end) {
+        size_t mid = begin + ((end - begin) >> 1);
+        if (records[mid * size + column] < value)
+            begin = mid + 1;
+        else
+            end = mid;
+    }
+    return begin;
+}
+
+static inline size_t
+upper_bound (const guint8 *records,
+             size_t        size,
+             size_t        column,
+             size_t        begin,
+             size_t        end,
+             guint8        value)
+{
+    while (begin < end) {
+        size_t mid = begin + ((end - begin) >> 1);
+        if (records[mid * size + column] <= value)
+            begin = mid + 1;
+        else
+            end = mid;
+    }
+    return begin;
+}
+
+/* Rows of one full pinyin id sequence, which are ordered by freq */
+class MappedRangeStream : public PhraseStream {
+public:
+    MappedRangeStream (const MappedDictionary &dict,
+                       size_t                  len,
+                       size_t                  begin,
+                       size_t                  end)
+        : m_dict (dict), m_len (len), m_pos (begin), m_end (end) { }
+
+    bool next (Phrase &phrase) {
+        if (m_pos == m_end)
+            return false;
+        m_dict.read (m_len, m_pos++, phrase);
+        return true;
+    }
+
+private:
+    const MappedDictionary &m_dict;
+    size_t m_len;
+    size_t m_pos;
+    size_t m_end;
+};
+
+void
+MappedDictionary::read (size_t len, size_t index, Phrase &phrase) const
+{
+    const Table &table = m_tables[len - 1];
+    const guint8 *record = table.records + index * table.record_size;
+    size_t text = read_uint32 (record + DICT_RECORD_TEXT);
+
+    g_strlcpy (phrase.phrase,
+               G_LIKELY (text < m_text_size) ? m_text + text : "",
+               sizeof (phrase.phrase));
+    phrase.freq = read_uint32 (record + DICT_RECORD_FREQ);
+    phrase.user_freq = 0;
+    phrase.len = len;
+    for (size_t i = 0; i < len; i++) {
+        phrase.pinyin_id[i].sheng = record[DICT_RECORD_IDS + i * 2];
+        phrase.pinyin_id[i].yun = record[DICT_RECORD_IDS + i * 2 + 1];
+    }
+}
+
+void
+MappedDictionary::lookupRange (const Table                  &table,
+                               const Condition              *conditions,
+                               size_t                        len,
+                               size_t                        pos,
+                               size_t                        begin,
+                               size_t                        end,
+                               std::vector<PhraseStreamPtr> &streams) const
+{
+    if (pos == len) {
+        streams.push_back (PhraseStreamPtr (new MappedRangeStream (*this, len, begin, end)));
+        return;
+    }
+
+    const Condition &cond = conditions[pos];
+    const size_t sheng_column = DICT_RECORD_IDS + pos * 2;
+    const size_t yun_column = sheng_column + 1;
+
+    for (size_t i = 0; i < cond.sheng_count; i++) {
+        size_t sheng_begin = lower_bound (table.records, table.record_size,
+                                          sheng_column, begin, end, cond.sheng[i]);
+        size_t sheng_end = upper_bound (table.records, table.record_size,
+                                        sheng_column, sheng_begin, end, cond.sheng[i]);
+        if (sheng_begin == sheng_end)
+            continue;
+
+        if (cond.yun_count > 0) {
+            for (size_t j = 0; j < cond.yun_count; j++) {
+                size_t yun_begin = lower_bound (table.records, table.record_size,
+                                                yun_column, sheng_begin, sheng_end, cond.yun[j]);
+                size_t yun_end = upper_bound (table.records, table.record_size,
+                                              yun_column, yun_begin, sheng_end, cond.yun[j]);
+                if (yun_begin != yun_end)
+                    lookupRange (table, conditions, len, pos + 1,
+                                 yun_begin, yun_end, streams);
+            }
+        }
+        else {
+            /* any yun: walk the distinct yun values in the range */
+            size_t yun_begin = sheng_begin;
+            while (yun_begin < sheng_end) {
+                guint8 yun = table.records[yun_begin * table.record_size + yun_column];
+                size_t yun_end = upper_bound (table.records, table.record_size,
+                                              yun_column, yun_begin, sheng_end, yun);
+                lookupRange (table, conditions, len, pos + 1,
+                             yun_begin, yun_end, streams);
+                yun_begin = yun_end;
+            }
+        }
+    }
+}
+
+void
+MappedDictionary::lookup (const Condition              *conditions,
+                          size_t                        len,
+                          std::vector<PhraseStreamPtr> &streams) const
+{
+    g_assert (len > 0 && len <= MAX_PHRASE_LEN);
+
+    if (G_UNLIKELY (!isOpen ()))
+        return;
+
+    const Table &table = m_tables[len - 1];
+    lookupRange (table, conditions, len, 0, 0, table.count, streams);
+}
+
+};  // namespace PyZy
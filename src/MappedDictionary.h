@@ -0,0 +1,121 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#ifndef __PYZY_MAPPED_DICTIONARY_H_
+#define __PYZY_MAPPED_DICTIONARY_H_
+
+#include <glib.h>
+#include <vector>
+
+#include "PhraseStream.h"
+#include "Types.h"
+
+namespace PyZy {
+
+/*
+ * Read-only phrase dictionary compiled by scripts/create_dict.py.
+ * The file is mapped into memory and searched in place, so no sqlite
+ * statement has to be prepared or stepped to look up system phrases.
+ */
+class MappedDictionary {
+public:
+    /* Accepted sheng and yun ids of one syllable, as a list to walk the
+     * index with and as a bitmask to test rows with. No yun at all means
+     * any yun is accepted. */
+    struct Condition {
+        unsigned char sheng[3];
+        size_t sheng_count;
+        unsigned char yun[2];
+        size_t yun_count;
+        guint32 sheng_mask;
+        guint64 yun_mask;
+
+        void reset (void) {
+            sheng_count = yun_count = 0;
+            sheng_mask = 0;
+            yun_mask = 0;
+        }
+
+        void addSheng (unsigned char id) {
+            if (sheng_mask & (1U << id))
+                return;
+            sheng_mask |= 1U << id;
+            sheng[sheng_count++] = id;
+        }
+
+        void addYun (unsigned char id) {
+            if (yun_mask & (G_GUINT64_CONSTANT (1) << id))
+                return;
+            yun_mask |= G_GUINT64_CONSTANT (1) << id;
+            yun[yun_count++] = id;
+        }
+
+        bool accepts (unsigned char s, unsigned char y) const {
+            return (sheng_mask & (1U << s)) != 0 &&
+                   (yun_mask == 0 || (yun_mask & (G_GUINT64_CONSTANT (1) << y)) != 0);
+        }
+    };
+
+    MappedDictionary (void);
+    ~MappedDictionary (void);
+
+    bool open (const char *filename);
+    void close (void);
+    bool isOpen (void) const { return m_file != NULL; }
+    /* the phrases are traditional Chinese already */
+    bool traditional (void) const;
+
+    /* Appends streams of the phrases of length len matching
+     * conditions[0..len). Every stream is ordered by freq, so they can be
+     * merged without sorting. */
+    void lookup (const Condition              *conditions,
+                 size_t                        len,
+                 std::vector<PhraseStreamPtr> &streams) const;
+
+private:
+    friend class MappedRangeStream;
+
+    struct Table {
+        const guint8 *records;
+        size_t count;
+        size_t record_size;
+    };
+
+    void lookupRange (const Table                  &table,
+                      const Condition              *conditions,
+                      size_t                        len,
+                      size_t                        pos,
+                      size_t                        begin,
+                      size_t                        end,
+                      std::vector<PhraseStreamPtr> &streams) const;
+    void read (size_t len, size_t index, Phrase &phrase) const;
+
+private:
+    GMappedFile *m_file;
+    const char *m_text;
+    size_t m_text_size;
+    guint32 m_flags;
+    Table m_tables[MAX_PHRASE_LEN];
+};
+
+};  // namespace PyZy
+
+#endif  // __PYZY_MAPPED_DICTIONARY_H_
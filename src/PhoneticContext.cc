@@ -23,12 +23,17 @@
 
 #include "Database.h"
 #include "PhraseEditor.h"
-#include "SimpTradConverter.h"
 
 namespace PyZy {
 
-PhoneticContext::PhoneticContext (PhoneticContext::Observer *observer)
-    : m_phrase_editor (m_config),
+/* longer special phrase commands shown as hints, at most */
+#define SPECIAL_PHRASE_HINTS    (4)
+
+PhoneticContext::PhoneticContext (PhoneticContext::Observer *observer,
+                                  const DatabasePtr &database)
+    : m_database (database),
+      m_phrase_editor (m_config, *database),
+      m_special_serial (0),
       m_observer (observer)
 {
     resetContext ();
@@ -43,6 +48,7 @@ PhoneticContext::updateSpecialPhrases (void)
 {
     size_t size = m_special_phrases.size ();
     m_special_phrases.clear ();
+    m_special_hints.clear ();
 
     if (!m_config.specialPhrases)
         return false;
@@ -54,9 +60,39 @@ PhoneticContext::updateSpecialPhrases (void)
     size_t end = m_cursor;
 
     if (begin < end) {
-        SpecialPhraseTable::instance ().lookup (
-            m_text.substr (begin, m_cursor - begin),
-            m_special_phrases);
+        const SpecialPhraseTable &table = SpecialPhraseTable::instance ();
+        const char *command = (const char *) m_text + begin;
+        const size_t len = end - begin;
+
+        /* keep the nodes of the prefix the command shares with the last
+         * one, and walk the trie only for the new characters */
+        size_t common = 0;
+        if (m_special_serial == table.serial ()) {
+            while (common < len && common < m_special_command.size () &&
+                   m_special_command[common] == command[common])
+                common ++;
+        }
+        m_special_serial = table.serial ();
+        m_special_command.resize (common);
+        m_special_command.append (command + common, len - common);
+        if (m_special_nodes.size () > common + 1)
+            m_special_nodes.resize (common + 1);
+        if (m_special_nodes.empty ())
+            m_special_nodes.push_back (0);
+
+        while (m_special_nodes.size () <= len) {
+            size_t node = table.child (m_special_nodes.back (),
+                                       command[m_special_nodes.size () - 1]);
+            if (node == 0)
+                break;
+            m_special_nodes.push_back (node);
+        }
+
+        if (m_special_nodes.size () == len + 1) {
+            table.lookup (m_special_nodes.back (), m_special_phrases);
+            table.complete (m_special_nodes.back (), SPECIAL_PHRASE_HINTS,
+                            m_special_hints);
+        }
     }
 
     return size != m_special_phrases.size () || size != 0;
@@ -117,6 +153,9 @@ PhoneticContext::resetContext (void)
     m_phrase_editor.reset ();
     m_special_phrases.clear ();
     m_selected_special_phrase.clear ();
+    m_special_command.clear ();
+    m_special_nodes.clear ();
+    m_special_hints.clear ();
     m_text.clear ();
     m_preedit_text.clear ();
     m_auxiliary_text.clear ();
@@ -263,14 +302,7 @@ PhoneticContext::getCandidate (size_t i, Candidate & candidate)
     }
 
     i -= m_special_phrases.size ();
-    if (m_config.modeSimp) {
-        candidate.text = m_phrase_editor.candidate (i).phrase;
-    } else {
-        String output;
-        SimpTradConverter::simpToTrad (m_phrase_editor.candidate (i).phrase,
-                                       output);
-        candidate.text = output;
-    }
+    candidate.text = m_phrase_editor.candidateText (i);
     candidate.type = m_phrase_editor.candidateIsUserPhrase (i)
         ? USER_PHRASE : NORMAL_PHRASE;
     return true;
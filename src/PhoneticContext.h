@@ -27,6 +27,7 @@
 
 #include "Config.h"
 #include "Const.h"
+#include "Database.h"
 #include "InputContext.h"
 #include "PhraseEditor.h"
 #include "PinyinArray.h"
@@ -51,7 +52,8 @@ struct Preedit {
 
 class PhoneticContext : public InputContext {
 public:
-    explicit PhoneticContext (PhoneticContext::Observer *observer);
+    PhoneticContext (PhoneticContext::Observer *observer,
+                     const DatabasePtr &database);
     virtual ~PhoneticContext (void);
 
     /* API of InputContext */
@@ -118,9 +120,9 @@ protected:
     virtual bool updateSpecialPhrases (void);
 
     /* inline functions */
-    void updatePhraseEditor (void)
+    void updatePhraseEditor (size_t changed = 0)
     {
-        m_phrase_editor.update (m_pinyin);
+        m_phrase_editor.update (m_pinyin, changed);
     }
 
     const char * textAfterPinyin () const
@@ -144,6 +146,7 @@ protected:
 
     /* variables */
     Config                      m_config;
+    DatabasePtr                 m_database;
     size_t                      m_cursor;
     size_t                      m_focused_candidate;
     PinyinArray                 m_pinyin;
@@ -152,6 +155,13 @@ protected:
     PhraseEditor                m_phrase_editor;
     std::vector<std::string>    m_special_phrases;
     std::string                 m_selected_special_phrase;
+    /* the command of m_special_phrases, and the trie node of each of its
+     * prefixes, as far as the table has them */
+    std::string                 m_special_command;
+    std::vector<size_t>         m_special_nodes;
+    unsigned int                m_special_serial;
+    /* longer commands starting with m_special_command, as hints */
+    std::vector<std::string>    m_special_hints;
     String                      m_text;
     Preedit                     m_preedit_text;
     std::string                 m_auxiliary_text;
@@ -21,20 +21,25 @@
  */
 #include "PhraseEditor.h"
 
+#include <cstring>
+
 #include "Config.h"
 #include "Database.h"
 #include "SimpTradConverter.h"
 
 namespace PyZy {
 
-PhraseEditor::PhraseEditor (const Config & config)
+PhraseEditor::PhraseEditor (const Config & config, Database & database)
     : m_config(config),
+      m_database (database),
       m_candidates (32),
       m_selected_phrases (8),
       m_selected_string (32),
       m_candidate_0_phrases (8),
       m_pinyin (16),
-      m_cursor (0)
+      m_cursor (0),
+      m_generation (0),
+      m_lattice (database)
 {
 }
 
@@ -43,11 +48,21 @@ PhraseEditor::~PhraseEditor (void)
 }
 
 bool
-PhraseEditor::update (const PinyinArray &pinyin)
+PhraseEditor::update (const PinyinArray &pinyin, size_t changed)
 {
     /* the size of pinyin must not bigger than MAX_PHRASE_LEN */
     g_assert (pinyin.size () <= MAX_PHRASE_LEN);
 
+    /* Nothing to look up again when no segment changed, as when a key
+     * only adds an apostrophe or text after the pinyin, unless a phrase
+     * is selected or the user phrases changed. The spans of the first
+     * changed segments are kept by m_lattice itself. */
+    if (changed == pinyin.size () && changed == m_pinyin.size () &&
+        m_cursor == 0 && m_generation == m_database.generation ()) {
+        m_pinyin = pinyin;
+        return false;
+    }
+
     m_pinyin = pinyin;
     m_cursor = 0;
 
@@ -61,7 +76,7 @@ PhraseEditor::update (const PinyinArray &pinyin)
 bool
 PhraseEditor::resetCandidate (size_t i)
 {
-    Database::instance ().remove (m_candidates[i]);
+    m_database.remove (m_candidates[i]);
 
     updateCandidates ();
     return true;
@@ -70,7 +85,7 @@ PhraseEditor::resetCandidate (size_t i)
 void
 PhraseEditor::commit (void)
 {
-    Database::instance ().commit (m_selected_phrases);
+    m_database.commit (m_selected_phrases);
     reset ();
 }
 
@@ -84,18 +99,12 @@ PhraseEditor::selectCandidate (size_t i)
         m_selected_phrases.insert (m_selected_phrases.end (),
                                    m_candidate_0_phrases.begin (),
                                    m_candidate_0_phrases.end ());
-        if (G_LIKELY (m_config.modeSimp))
-            m_selected_string << m_candidates[0].phrase;
-        else
-            SimpTradConverter::simpToTrad (m_candidates[0].phrase, m_selected_string);
+        m_selected_string << candidateText (0);
         m_cursor = m_pinyin.size ();
     }
     else {
         m_selected_phrases.push_back (m_candidates[i]);
-        if (G_LIKELY (m_config.modeSimp))
-            m_selected_string << m_candidates[i].phrase;
-        else
-            SimpTradConverter::simpToTrad (m_candidates[i].phrase, m_selected_string);
+        m_selected_string << candidateText (i);
         m_cursor += m_candidates[i].len;
     }
 
@@ -103,11 +112,31 @@ PhraseEditor::selectCandidate (size_t i)
     return true;
 }
 
+const char *
+PhraseEditor::candidateText (size_t i)
+{
+    if (G_LIKELY (m_config.modeSimp) || m_database.traditional ())
+        return m_candidates[i].phrase;
+
+    if (i >= m_candidate_texts.size ()) {
+        /* the candidates filled since the last conversion, in one go */
+        std::vector<String> phrases;
+        for (size_t j = m_candidate_texts.size (); j < m_candidates.size (); j++)
+            phrases.push_back (m_candidates[j].phrase);
+        std::vector<String> trads;
+        SimpTradConverter::simpToTrad (phrases, trads);
+        m_candidate_texts.insert (m_candidate_texts.end (), trads.begin (), trads.end ());
+    }
+    return m_candidate_texts[i];
+}
+
 void
 PhraseEditor::updateCandidates (void)
 {
     m_candidates.clear ();
+    m_candidate_texts.clear ();
     m_query.reset ();
+    m_generation = m_database.generation ();
     updateTheFirstCandidate ();
 
     if (G_UNLIKELY (m_pinyin.size () == 0))
@@ -121,7 +150,8 @@ PhraseEditor::updateCandidates (void)
         m_candidates.push_back (phrase);
     }
 
-    m_query.reset (new Query (m_pinyin,
+    m_query.reset (new Query (m_database,
+                              m_pinyin,
                               m_cursor,
                               m_pinyin.size () - m_cursor,
                               m_config.option));
@@ -131,27 +161,12 @@ PhraseEditor::updateCandidates (void)
 void
 PhraseEditor::updateTheFirstCandidate (void)
 {
-    size_t begin;
-    size_t end;
-
     m_candidate_0_phrases.clear ();
 
     if (G_UNLIKELY (m_pinyin.size () == 0))
         return;
 
-    begin = m_cursor;
-    end = m_pinyin.size ();
-
-    while (begin != end) {
-        int ret;
-        Query query (m_pinyin,
-                     begin,
-                     end - begin,
-                     m_config.option);
-        ret = query.fill (m_candidate_0_phrases, 1);
-        g_assert (ret == 1);
-        begin += m_candidate_0_phrases.back ().len;
-    }
+    m_lattice.bestPath (m_pinyin, m_cursor, m_config.option, m_candidate_0_phrases);
 }
 
 bool
@@ -161,8 +176,20 @@ PhraseEditor::fillCandidates (void)
         return false;
     }
 
+    size_t begin = m_candidates.size ();
     int ret = m_query->fill (m_candidates, FILL_GRAN);
 
+    /* the joined first candidate may also be a phrase of the database */
+    if (m_candidate_0_phrases.size () > 1) {
+        for (size_t i = begin; i < m_candidates.size (); i++) {
+            if (m_candidates[i].len == m_candidates[0].len &&
+                std::strcmp (m_candidates[i].phrase, m_candidates[0].phrase) == 0) {
+                m_candidates.erase (m_candidates.begin () + i);
+                break;
+            }
+        }
+    }
+
     if (G_UNLIKELY (ret < FILL_GRAN)) {
         /* got all candidates from query */
         m_query.reset ();
@@ -23,6 +23,7 @@
 #define __PYZY_PHRASE_EDITOR_H_
 
 #include "PhraseArray.h"
+#include "PhraseLattice.h"
 #include "PinyinArray.h"
 #include "String.h"
 #include "Util.h"
@@ -37,7 +38,7 @@ class Query;
 
 class PhraseEditor {
 public:
-    explicit PhraseEditor (const Config & config);
+    PhraseEditor (const Config & config, Database & database);
     ~PhraseEditor (void);
 
     const String & selectedString (void) const  { return m_selected_string; }
@@ -60,6 +61,10 @@ public:
         return m_candidates[i];
     }
 
+    /* the text of candidate i to show, in traditional Chinese unless
+     * modeSimp */
+    const char * candidateText (size_t i);
+
     bool fillCandidates (void);
 
     const PhraseArray & candidate0 (void) const
@@ -90,6 +95,7 @@ public:
     void reset (void)
     {
         m_candidates.clear ();
+        m_candidate_texts.clear ();
         m_selected_phrases.clear ();
         m_selected_string.truncate (0);
         m_candidate_0_phrases.clear ();
@@ -98,7 +104,9 @@ public:
         m_query.reset ();
     }
 
-    bool update (const PinyinArray &pinyin);
+    /* Sets the pinyin to convert. The first changed segments of it are
+     * the same as before, and the candidates are kept when all are. */
+    bool update (const PinyinArray &pinyin, size_t changed = 0);
     bool selectCandidate (size_t i);
     bool resetCandidate (size_t i);
     void commit (void);
@@ -119,13 +127,18 @@ private:
 
 private:
     const Config &m_config;
+    Database &m_database;
     PhraseArray m_candidates;           // candidates phrase array
+    std::vector<String> m_candidate_texts;  // traditional Chinese of the
+                                            // candidates converted so far
     PhraseArray m_selected_phrases;     // selected phrases, before cursor
     String      m_selected_string;      // selected phrases, in string format
     PhraseArray m_candidate_0_phrases;  // the first candidate in phrase array format
     PinyinArray m_pinyin;
     size_t m_cursor;
     std::shared_ptr<Query> m_query;
+    unsigned int m_generation;          // database generation of candidates
+    PhraseLattice m_lattice;
 };
 
 };  // namespace PyZy
@@ -0,0 +1,242 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#include "PhraseLattice.h"
+
+#include <algorithm>
+#include <climits>
+
+#include "Database.h"
+
+namespace PyZy {
+
+/* The freq column is the logarithm of the phrase count, in steps of 0.1%,
+ * so adding freq values multiplies probabilities. A span costs the
+ * logarithm of the total count of the system database in the same unit,
+ * which makes a path of fewer, longer phrases win unless its phrases are
+ * much rarer. */
+#define LATTICE_SPAN_COST           (15790)
+/* Every selection by the user makes a phrase about e times as likely */
+#define LATTICE_USER_FREQ_WEIGHT    (1000)
+#define LATTICE_USER_FREQ_MAX       (8)
+
+#define LATTICE_SCORE_NONE          (LONG_MIN)
+
+static inline long
+span_score (const Phrase &phrase)
+{
+    return (long) phrase.freq
+           + (long) MIN (phrase.user_freq, LATTICE_USER_FREQ_MAX) * LATTICE_USER_FREQ_WEIGHT
+           - LATTICE_SPAN_COST;
+}
+
+PhraseLattice::PhraseLattice (Database &database)
+    : m_database (database)
+{
+    reset ();
+}
+
+void
+PhraseLattice::reset (void)
+{
+    m_pinyin.clear ();
+    m_option = 0;
+    m_generation = 0;
+    m_spans.clear ();
+    m_begin = 0;
+    m_scored = 0;
+}
+
+const PhraseLattice::Span &
+PhraseLattice::span (const PinyinArray &pinyin, size_t begin, size_t len)
+{
+    Span & span = m_spans[begin * MAX_PHRASE_LEN + len - 1];
+    if (!span.looked_up) {
+        /* the first row of a span is its best phrase */
+        PhraseStreamPtr stream = m_database.query (pinyin, begin, len, -1, m_option);
+        span.found = stream.get () != NULL && stream->next (span.phrase);
+        span.looked_up = true;
+    }
+    return span;
+}
+
+/* Keeps the spans and scores of the syllables the new pinyin array shares
+ * with the old one */
+void
+PhraseLattice::update (const PinyinArray &pinyin, size_t begin, unsigned int option)
+{
+    const size_t end = pinyin.size ();
+    unsigned int generation = m_database.generation ();
+
+    size_t common = 0;
+    if (option == m_option && generation == m_generation) {
+        while (common < end && common < m_pinyin.size () &&
+               m_pinyin[common] == pinyin[common].pinyin)
+            common ++;
+    }
+
+    m_option = option;
+    m_generation = generation;
+    m_pinyin.resize (end);
+    for (size_t i = common; i < end; i++)
+        m_pinyin[i] = pinyin[i].pinyin;
+
+    /* forget the spans ending after the common syllables */
+    m_spans.resize (end * MAX_PHRASE_LEN);
+    for (size_t i = 0; i < end; i++) {
+        for (size_t len = 1; len <= MAX_PHRASE_LEN; len++) {
+            if (i + len > common)
+                m_spans[i * MAX_PHRASE_LEN + len - 1].looked_up = false;
+        }
+    }
+
+    if (begin != m_begin)
+        m_scored = begin;
+    m_begin = begin;
+    m_scored = MAX (begin, MIN (m_scored, common));
+    m_scores.resize (end + 1);
+    m_lengths.resize (end + 1);
+}
+
+void
+PhraseLattice::bestPath (const PinyinArray &pinyin,
+                         size_t             begin,
+                         unsigned int       option,
+                         PhraseArray       &phrases)
+{
+    const size_t end = pinyin.size ();
+
+    if (G_UNLIKELY (begin >= end))
+        return;
+
+    update (pinyin, begin, option);
+
+    if (m_scored == begin)
+        m_scores[begin] = 0;
+
+    for (size_t j = m_scored + 1; j <= end; j++) {
+        m_scores[j] = LATTICE_SCORE_NONE;
+        m_lengths[j] = 0;
+        /* try the longest span first, so it wins a tie */
+        for (size_t len = MIN (j - begin, MAX_PHRASE_LEN); len > 0; len--) {
+            size_t i = j - len;
+            if (m_scores[i] == LATTICE_SCORE_NONE)
+                continue;
+            const Span & s = span (pinyin, i, len);
+            if (!s.found)
+                continue;
+            long score = m_scores[i] + span_score (s.phrase);
+            if (score > m_scores[j]) {
+                m_scores[j] = score;
+                m_lengths[j] = len;
+            }
+        }
+    }
+    m_scored = end;
+
+    /* every syllable has phrases, so the end is always reached */
+    g_assert (m_scores[end] != LATTICE_SCORE_NONE);
+
+    size_t first = phrases.size ();
+    for (size_t j = end; j > begin; j -= m_lengths[j]) {
+        size_t len = m_lengths[j];
+        phrases.push_back (m_spans[(j - len) * MAX_PHRASE_LEN + len - 1].phrase);
+    }
+    std::reverse (phrases.begin () + first, phrases.end ());
+}
+
+namespace {
+
+/* the k-th best path to a syllable: its last span, the phrase of the span
+ * and the rank of the path before the span */
+struct RankedPath {
+    long score;
+    size_t len;
+    size_t phrase;
+    size_t rest;
+
+    bool operator < (const RankedPath &p) const
+    {
+        return score > p.score;
+    }
+};
+
+};
+
+void
+PhraseLattice::bestPaths (const PinyinArray        &pinyin,
+                          size_t                    begin,
+                          unsigned int              option,
+                          size_t                    n,
+                          std::vector<PhraseArray> &paths)
+{
+    const size_t end = pinyin.size ();
+
+    if (G_UNLIKELY (begin >= end || n == 0))
+        return;
+
+    std::vector<PhraseArray> spans (end * MAX_PHRASE_LEN);
+    std::vector<std::vector<RankedPath> > best (end + 1);
+    RankedPath first = { 0, 0, 0, 0 };
+    best[begin].push_back (first);
+
+    for (size_t j = begin + 1; j <= end; j++) {
+        std::vector<RankedPath> & list = best[j];
+        /* the longer spans first, so they win ties as in bestPath () */
+        for (size_t len = MIN (j - begin, MAX_PHRASE_LEN); len > 0; len--) {
+            size_t i = j - len;
+            if (best[i].empty ())
+                continue;
+
+            PhraseArray & phrases = spans[i * MAX_PHRASE_LEN + len - 1];
+            PhraseStreamPtr stream = m_database.query (pinyin, i, len, -1, option);
+            Phrase phrase;
+            while (stream.get () != NULL && phrases.size () < n && stream->next (phrase))
+                phrases.push_back (phrase);
+
+            for (size_t p = 0; p < phrases.size (); p++) {
+                for (size_t r = 0; r < best[i].size (); r++) {
+                    RankedPath path = { best[i][r].score + span_score (phrases[p]), len, p, r };
+                    list.push_back (path);
+                }
+            }
+        }
+        std::stable_sort (list.begin (), list.end ());
+        if (list.size () > n)
+            list.resize (n);
+    }
+
+    for (size_t k = 0; k < best[end].size (); k++) {
+        paths.push_back (PhraseArray ());
+        PhraseArray & path = paths.back ();
+
+        const RankedPath *p = &best[end][k];
+        for (size_t j = end; j > begin; ) {
+            size_t i = j - p->len;
+            path.push_back (spans[i * MAX_PHRASE_LEN + p->len - 1][p->phrase]);
+            p = &best[i][p->rest];
+            j = i;
+        }
+        std::reverse (path.begin (), path.end ());
+    }
+}
+
+};  // namespace PyZy
@@ -0,0 +1,90 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#ifndef __PYZY_PHRASE_LATTICE_H_
+#define __PYZY_PHRASE_LATTICE_H_
+
+#include <vector>
+
+#include "PhraseArray.h"
+#include "PinyinArray.h"
+
+namespace PyZy {
+
+class Database;
+
+/*
+ * Finds the best conversion of a pinyin array. Every span of syllables is
+ * an edge of the lattice, weighted by the first phrase of the span, and the
+ * path with the highest score is found by dynamic programming.
+ *
+ * The spans and the scores are kept by syllable position between calls,
+ * so when only the tail of the pinyin array changes, as it does on every
+ * keystroke, only the spans ending in the changed tail are looked up again.
+ */
+class PhraseLattice {
+public:
+    explicit PhraseLattice (Database &database);
+
+    /* Converts pinyin[begin, pinyin.size ()), and appends the phrases of
+     * the best path to phrases. */
+    void bestPath (const PinyinArray &pinyin,
+                   size_t             begin,
+                   unsigned int       option,
+                   PhraseArray       &phrases);
+
+    /* Appends up to n paths of pinyin[begin, pinyin.size ()), the best
+     * first, to paths. It takes up to n phrases of every span, and keeps no
+     * spans between calls. The first path is the one of bestPath (). */
+    void bestPaths (const PinyinArray        &pinyin,
+                    size_t                    begin,
+                    unsigned int              option,
+                    size_t                    n,
+                    std::vector<PhraseArray> &paths);
+
+    /* Forgets all spans, e.g. after the user database changed */
+    void reset (void);
+
+private:
+    struct Span {
+        Phrase phrase;
+        bool looked_up;
+        bool found;
+    };
+
+    const Span & span (const PinyinArray &pinyin, size_t begin, size_t len);
+    void update (const PinyinArray &pinyin, size_t begin, unsigned int option);
+
+private:
+    Database &m_database;
+    std::vector<const Pinyin *> m_pinyin;   // pinyin of the kept spans
+    unsigned int m_option;
+    unsigned int m_generation;      // generation of the database
+    std::vector<Span> m_spans;      // spans by begin and length
+    size_t m_begin;                 // begin of the scored paths
+    size_t m_scored;                // end of the valid scores
+    std::vector<long> m_scores;     // best score of the paths to a syllable
+    std::vector<size_t> m_lengths;  // length of the last span of the path
+};
+
+};  // namespace PyZy
+
+#endif  // __PYZY_PHRASE_LATTICE_H_
@@ -0,0 +1,108 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#include "PhraseStream.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace PyZy {
+
+bool
+PhraseRankBefore::operator () (const Phrase &a, const Phrase &b) const
+{
+    if (a.user_freq != b.user_freq)
+        return a.user_freq > b.user_freq;
+    if (a.freq != b.freq)
+        return a.freq > b.freq;
+    return std::strcmp (a.phrase, b.phrase) < 0;
+}
+
+bool
+ArrayPhraseStream::next (Phrase &phrase)
+{
+    if (m_next >= m_phrases.size ())
+        return false;
+    phrase = m_phrases[m_next++];
+    return true;
+}
+
+/* std::*_heap keeps the greatest head on top, so the head ranking first
+ * is the greatest one */
+bool
+MergePhraseStream::HeadLess::operator () (const Head &a, const Head &b) const
+{
+    return PhraseRankBefore () (b.phrase, a.phrase);
+}
+
+MergePhraseStream::MergePhraseStream (void)
+    : m_started (false)
+{
+}
+
+void
+MergePhraseStream::addSource (const PhraseStreamPtr &source)
+{
+    g_assert (!m_started);
+    m_sources.push_back (source);
+}
+
+inline bool
+MergePhraseStream::pull (size_t source)
+{
+    Head head;
+    if (!m_sources[source]->next (head.phrase)) {
+        m_sources[source].reset ();
+        return false;
+    }
+    head.source = source;
+    m_heap.push_back (head);
+    std::push_heap (m_heap.begin (), m_heap.end (), HeadLess ());
+    return true;
+}
+
+bool
+MergePhraseStream::next (Phrase &phrase)
+{
+    if (G_UNLIKELY (!m_started)) {
+        m_started = true;
+        m_heap.reserve (m_sources.size ());
+        for (size_t i = 0; i < m_sources.size (); i++)
+            pull (i);
+    }
+
+    while (!m_heap.empty ()) {
+        std::pop_heap (m_heap.begin (), m_heap.end (), HeadLess ());
+        size_t source = m_heap.back ().source;
+        phrase = m_heap.back ().phrase;
+        m_heap.pop_back ();
+        pull (source);
+
+        /* a phrase may come from the user database and the system one,
+         * or from several pinyin with fuzzy pinyin */
+        if (m_returned.insert (phrase.phrase).second)
+            return true;
+    }
+
+    return false;
+}
+
+};  // namespace PyZy
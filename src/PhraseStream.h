@@ -0,0 +1,93 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#ifndef __PYZY_PHRASE_STREAM_H_
+#define __PYZY_PHRASE_STREAM_H_
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Phrase.h"
+#include "Util.h"
+
+namespace PyZy {
+
+/* Phrases matching a query, ordered by user_freq and freq */
+class PhraseStream {
+public:
+    virtual ~PhraseStream (void) { }
+    virtual bool next (Phrase &phrase) = 0;
+};
+typedef std::shared_ptr<PhraseStream> PhraseStreamPtr;
+
+/* true if a ranks before b: by user_freq, freq and then the phrase text */
+struct PhraseRankBefore {
+    bool operator () (const Phrase &a, const Phrase &b) const;
+};
+
+/* Returns the phrases of an array, which must be ordered already */
+class ArrayPhraseStream : public PhraseStream {
+public:
+    ArrayPhraseStream (void) : m_next (0) { }
+
+    std::vector<Phrase> & phrases (void) { return m_phrases; }
+    bool next (Phrase &phrase);
+
+private:
+    std::vector<Phrase> m_phrases;
+    size_t m_next;
+};
+
+/*
+ * Merges ordered streams into one, ordered by user_freq, freq and the
+ * phrase text. A phrase is returned only once, from the stream ranking it
+ * highest. Rows are pulled from the sources only when they are needed, so
+ * the first rows cost O(count * log(sources)).
+ */
+class MergePhraseStream : public PhraseStream {
+public:
+    MergePhraseStream (void);
+
+    void addSource (const PhraseStreamPtr &source);
+    bool next (Phrase &phrase);
+
+private:
+    bool pull (size_t source);
+
+private:
+    struct Head {
+        Phrase phrase;
+        size_t source;
+    };
+    struct HeadLess {
+        bool operator () (const Head &a, const Head &b) const;
+    };
+
+    std::vector<PhraseStreamPtr> m_sources;
+    std::vector<Head> m_heap;
+    std::set<std::string> m_returned;
+    bool m_started;
+};
+
+};  // namespace PyZy
+
+#endif  // __PYZY_PHRASE_STREAM_H_
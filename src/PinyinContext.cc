@@ -20,12 +20,12 @@
  * USA
  */
 #include "PinyinContext.h"
-#include "SimpTradConverter.h"
 
 namespace PyZy {
 
-PinyinContext::PinyinContext (PhoneticContext::Observer * observer)
-    : PhoneticContext (observer)
+PinyinContext::PinyinContext (PhoneticContext::Observer *observer,
+                              const DatabasePtr &database)
+    : PhoneticContext (observer, database)
 {
 }
 
@@ -113,13 +113,11 @@ PinyinContext::updatePreeditText ()
                 m_buffer << textAfterCursor ();
             }
             else {
-                const Phrase & candidate = m_phrase_editor.candidate (index - m_special_phrases.size ());
+                const size_t i = index - m_special_phrases.size ();
+                const Phrase & candidate = m_phrase_editor.candidate (i);
                 if (m_text.size () == m_cursor) {
                     /* cursor at end */
-                    if (m_config.modeSimp)
-                        m_buffer << candidate;
-                    else
-                        SimpTradConverter::simpToTrad (candidate, m_buffer);
+                    m_buffer << m_phrase_editor.candidateText (i);
                     edit_end_word = m_buffer.utf8Length ();
                     edit_end_byte = m_buffer.size ();
 
@@ -197,6 +195,17 @@ PinyinContext::updateAuxiliaryText (void)
                 m_buffer  << '|' << textAfterCursor ();
             }
         }
+
+        /* the longer special phrase commands of the typed prefix */
+        if (!m_special_hints.empty ()) {
+            m_buffer << " [";
+            for (size_t i = 0; i < m_special_hints.size (); ++i) {
+                if (G_LIKELY (i != 0))
+                    m_buffer << ' ';
+                m_buffer << m_special_command << m_special_hints[i];
+            }
+            m_buffer << ']';
+        }
     }
     else {
         if (m_cursor < m_text.size ()) {
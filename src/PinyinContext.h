@@ -28,7 +28,8 @@ namespace PyZy {
 
 class PinyinContext : public PhoneticContext {
 public:
-    explicit PinyinContext (PhoneticContext::Observer *observer);
+    PinyinContext (PhoneticContext::Observer *observer,
+                   const DatabasePtr &database);
     virtual ~PinyinContext (void);
     virtual void commit (CommitType type);
 
@@ -0,0 +1,112 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#include "PinyinLattice.h"
+
+#include <algorithm>
+
+namespace PyZy {
+
+void
+PinyinLattice::clear (void)
+{
+    m_edges.clear ();
+    m_offsets.assign (1, 0);
+    m_begin = 0;
+    m_end = 0;
+}
+
+const PinyinLattice::Edge *
+PinyinLattice::edges (size_t node, size_t &count) const
+{
+    if (G_UNLIKELY (node + 1 >= m_offsets.size ())) {
+        count = 0;
+        return NULL;
+    }
+    count = m_offsets[node + 1] - m_offsets[node];
+    return &m_edges[m_offsets[node]];
+}
+
+namespace {
+
+/* a path to the end from a node: its first edge and the rank of the rest
+ * of it among the paths of the next node */
+struct Path {
+    int score;
+    size_t edge;
+    size_t rest;
+
+    bool operator < (const Path &p) const
+    {
+        return score > p.score;
+    }
+};
+
+};
+
+size_t
+PinyinLattice::bestPaths (size_t                     n,
+                          std::vector<PinyinArray>  &paths,
+                          std::vector<int>          &scores) const
+{
+    if (n == 0 || m_edges.empty ())
+        return 0;
+
+    /* the n best paths from every node to the end, from the end backwards */
+    std::vector<std::vector<Path> > best (m_end + 1);
+    Path last = { 0, m_edges.size (), 0 };
+    best[m_end].push_back (last);
+
+    for (size_t node = m_end; node-- > m_begin; ) {
+        std::vector<Path> & list = best[node];
+        for (size_t i = m_offsets[node]; i < m_offsets[node + 1]; i++) {
+            const std::vector<Path> & rest = best[m_edges[i].next];
+            for (size_t r = 0; r < rest.size (); r++) {
+                Path path = { m_edges[i].score + rest[r].score, i, r };
+                list.push_back (path);
+            }
+        }
+        if (list.size () > n) {
+            std::partial_sort (list.begin (), list.begin () + n, list.end ());
+            list.resize (n);
+        }
+        else {
+            std::sort (list.begin (), list.end ());
+        }
+    }
+
+    const std::vector<Path> & first = best[m_begin];
+    for (size_t k = 0; k < first.size (); k++) {
+        paths.push_back (PinyinArray ());
+        scores.push_back (first[k].score);
+
+        PinyinArray & path = paths.back ();
+        const Path *p = &first[k];
+        while (p->edge < m_edges.size ()) {
+            const Edge & edge = m_edges[p->edge];
+            path.push_back (edge.segment);
+            p = &best[edge.next][p->rest];
+        }
+    }
+    return first.size ();
+}
+
+};  // namespace PyZy
@@ -0,0 +1,78 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#ifndef __PYZY_PINYIN_LATTICE_H_
+#define __PYZY_PINYIN_LATTICE_H_
+
+#include <glib.h>
+#include <vector>
+
+#include "PinyinArray.h"
+
+namespace PyZy {
+
+/*
+ * Every segmentation of a pinyin text into syllables, built by
+ * PinyinParser::parseLattice. The nodes are byte offsets of the text, and
+ * a syllable is an edge from its first byte to the first byte of the next
+ * syllable, after any apostrophes. Only the syllables on a path from the
+ * first node to the last one are kept.
+ *
+ * A path scores the sum of the scores of its syllables, so the paths with
+ * fewer, complete and uncorrected syllables win.
+ */
+class PinyinLattice {
+public:
+    struct Edge {
+        PinyinSegment segment;  // the syllable
+        size_t next;            // node after the syllable
+        int score;              // score of the syllable
+    };
+
+    PinyinLattice (void) { clear (); }
+
+    void clear (void);
+
+    /* the first and the last node of the paths */
+    size_t begin (void) const { return m_begin; }
+    size_t end (void) const { return m_end; }
+
+    /* the syllables starting at node, count of them is set to count */
+    const Edge * edges (size_t node, size_t &count) const;
+
+    /* Appends the n paths with the highest scores to paths and their scores
+     * to scores, the best first. Returns the number of the paths. */
+    size_t bestPaths (size_t                     n,
+                      std::vector<PinyinArray>  &paths,
+                      std::vector<int>          &scores) const;
+
+private:
+    friend class PinyinParser;
+
+    std::vector<Edge> m_edges;      // syllables by first byte
+    std::vector<size_t> m_offsets;  // index of the first edge of each node
+    size_t m_begin;
+    size_t m_end;
+};
+
+};  // namespace PyZy
+
+#endif  // __PYZY_PINYIN_LATTICE_H_
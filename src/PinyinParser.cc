@@ -28,6 +28,22 @@
 
 namespace PyZy {
 
+/* A node of the trie of the texts in pinyin_table. The children of a node
+ * are consecutive, in the order of their letters. */
+struct PinyinTrieNode {
+    guint32 children;   /* bit c - 'a' is set if the node has a child for c */
+    guint16 first;      /* index of the first child in pinyin_trie */
+    gint16  pinyin;     /* index of the pinyin in pinyin_table, or -1 */
+};
+
+/* A node of the trie of the bopomofo of pinyin_table, the letters of which
+ * are U+3105 to U+3129 */
+struct BopomofoTrieNode {
+    guint64 children;   /* bit c - U+3105 is set if the node has a child for c */
+    guint16 first;      /* index of the first child in bopomofo_trie */
+    gint16  pinyin;     /* index of the pinyin in pinyin_table, or -1 */
+};
+
 #include "Bopomofo.h"
 #include "PinyinParserTable.h"
 
@@ -48,15 +64,20 @@ check_flags (const Pinyin *pinyin, unsigned int option)
     return true;
 }
 
-static int
-py_cmp (const void *p1, const void *p2)
+static inline const PinyinTrieNode *
+trie_child (const PinyinTrieNode *node, char c)
 {
-    const char *str = (const char *) p1;
-    const Pinyin *py = (const Pinyin *) p2;
+    if (G_UNLIKELY (c < 'a' || c > 'z'))
+        return NULL;
 
-    return std::strcmp (str, py->text);
+    guint32 bit = 1 << (c - 'a');
+    if ((node->children & bit) == 0)
+        return NULL;
+    return pinyin_trie + node->first + __builtin_popcount (node->children & (bit - 1));
 }
 
+/* Finds the pinyin of the len bytes at p, or the longest pinyin at p if len
+ * is negative, by walking down the trie of the pinyin texts once */
 // TODO(hsumita): Replace "int len" to "size_t len"
 static const Pinyin *
 is_pinyin (const char  *p,
@@ -64,90 +85,70 @@ is_pinyin (const char  *p,
            int          len,
            unsigned int option)
 {
-    char buf[8];
-    const Pinyin *result;
-
-    if (G_UNLIKELY (len > 6))
-        return NULL;
+    const PinyinTrieNode *node = pinyin_trie;
+    const Pinyin *result = NULL;
 
     if (G_UNLIKELY (len > end - p))
         return NULL;
 
     if (G_LIKELY (len > 0)) {
-        std::strncpy (buf, p, len);
-        buf[len] = 0;
-        result = (const Pinyin *) std::bsearch (buf, pinyin_table, G_N_ELEMENTS (pinyin_table),
-                                            sizeof (Pinyin), py_cmp);
-        if (check_flags (result, option))
-            return result;
+        for (end = p + len; p < end; p++) {
+            if ((node = trie_child (node, *p)) == NULL)
+                return NULL;
+        }
+        if (node->pinyin >= 0 && check_flags (&pinyin_table[node->pinyin], option))
+            return &pinyin_table[node->pinyin];
         return NULL;
     }
 
     /* len < 0 */
-    len = MIN (6, end - p);
-    std::strncpy (buf, p, len);
-
-    for (; len > 0; len --) {
-        buf[len] = 0;
-
-        result = (const Pinyin *) std::bsearch (buf, pinyin_table, G_N_ELEMENTS (pinyin_table),
-                                                sizeof (Pinyin), py_cmp);
-        if (G_UNLIKELY (check_flags (result, option))) {
-            return result;
-        }
+    for (; p < end; p++) {
+        if ((node = trie_child (node, *p)) == NULL)
+            break;
+        if (node->pinyin >= 0 && check_flags (&pinyin_table[node->pinyin], option))
+            result = &pinyin_table[node->pinyin];
     }
 
-    return NULL;
-}
-
-static int
-sp_cmp (const void *p1,
-        const void *p2)
-{
-    const Pinyin **pys = (const Pinyin **) p1;
-    const Pinyin **e = (const Pinyin **) p2;
-
-    int retval = pys[0] - e[0];
-
-    if (retval != 0)
-        return retval;
-    return pys[1] - e[1];
+    return result;
 }
 
+/* Finds the pair of p1 and p2 in special_table with its perfect hash */
 static const Pinyin **
 need_resplit(const Pinyin *p1,
              const Pinyin *p2)
 {
-    const Pinyin * pys[] = {p1, p2};
+    size_t key = (p1 - pinyin_table) * G_N_ELEMENTS (pinyin_table) + (p2 - pinyin_table);
+    size_t bucket = key % G_N_ELEMENTS (special_displacement);
+    size_t slot = (key / G_N_ELEMENTS (special_displacement) + special_displacement[bucket])
+                  % G_N_ELEMENTS (special_hash);
 
-    return (const Pinyin **) std::bsearch (pys, special_table, G_N_ELEMENTS (special_table),
-                                        sizeof (special_table[0]), sp_cmp);
+    int i = special_hash[slot];
+    if (i < 0 || special_table[i][0] != p1 || special_table[i][1] != p2)
+        return NULL;
+    return special_table[i];
 }
 
-size_t
-PinyinParser::parse (const String   &pinyin,
-                     size_t          len,
-                     unsigned int    option,
-                     PinyinArray    &result,
-                     size_t          max)
+/* Parses pinyin from p to end, appending the segments to result, which
+ * holds the segments before p */
+static size_t
+parse_pinyin (const char    *pinyin,
+              const char    *p,
+              const char    *end,
+              unsigned int   option,
+              PinyinArray   &result,
+              size_t         max)
 {
-    const char *p;
-    const char *end;
     const Pinyin *py;
     const Pinyin *prev_py;
     char prev_c;
 
-    result.clear ();
-
-    if (G_UNLIKELY (len < 0))
-        len = pinyin.size ();
-
-    p = pinyin;
-    end = p + len;
-
     prev_py = NULL;
-
     prev_c = 0;
+    if (!result.empty ()) {
+        prev_py = result.back ().pinyin;
+        prev_c = prev_py->text[prev_py->len - 1];
+    }
+
     for (; p < end && result.size () < max; ) {
         if (G_UNLIKELY (*p == '\'')) {
             prev_c = '\'';
@@ -217,79 +218,225 @@ PinyinParser::parse (const String   &pinyin,
         if (G_UNLIKELY (py == NULL))
             break;
 
-        result.append (py, p - (const char *) pinyin, py->len);
+        result.append (py, p - pinyin, py->len);
         p += py->len;
         prev_c = py->text[py->len - 1];
         prev_py = py;
     }
 
-    if (G_UNLIKELY (p == (const char *)pinyin))
+    if (G_UNLIKELY (p == pinyin))
         return 0;
 #if 0
     if (G_UNLIKELY (*(p - 1) == '\''))
         p --;
 #endif
-    return p - (const char *)pinyin;
+    return p - pinyin;
 }
 
-static const char * const
-id_map[] = {
-    "", "b", "c", "ch",
-    "d", "f", "g", "h",
-    "j", "k", "l", "m",
-    "n", "p", "q", "r",
-    "s", "sh", "t", "w",
-    "x", "y", "z", "zh",
-    "a", "ai", "an", "ang", "ao",
-    "e", "ei", "en", "eng", "er",
-    "i", "ia", "ian", "iang", "iao",
-    "ie", "in", "ing", "iong", "iu",
-    "o", "ong", "ou",
-    "u", "ua", "uai", "uan", "uang",
-    0, /* it should be ue or ve */
-    "ui", "un", "uo", "v"
-};
+size_t
+PinyinParser::parse (const String   &pinyin,
+                     size_t          len,
+                     unsigned int    option,
+                     PinyinArray    &result,
+                     size_t          max)
+{
+    const char *p;
+    const char *end;
 
-const Pinyin *
-PinyinParser::isPinyin (int sheng, int yun, unsigned int option)
+    result.clear ();
+
+    if (G_UNLIKELY (len < 0))
+        len = pinyin.size ();
+
+    p = pinyin;
+    end = p + len;
+
+    return parse_pinyin (p, p, end, option, result, max);
+}
+
+/* Whether the parse at q looks back at the syllable before q, because it
+ * may be split differently, e.g. "xian" + "g" + "an" */
+static inline bool
+look_back (const char *pinyin, size_t q)
 {
-    const Pinyin *result;
-    char buf[16];
-
-    std::strcpy (buf, id_map[sheng]);
-
-    if (yun == PINYIN_ID_UE) {
-        /* append ue or ve base on sheng */
-        switch (sheng) {
-        case PINYIN_ID_J:
-        case PINYIN_ID_Q:
-        case PINYIN_ID_X:
-        case PINYIN_ID_Y:
-            std::strcat (buf, "ue");
-            break;
-        default:
-            std::strcat (buf, "ve");
+    if (q == 0)
+        return false;
+
+    switch (pinyin[q - 1]) {
+    case 'r': case 'n': case 'g': case 'e':
+        break;
+    default:
+        return false;
+    }
+
+    switch (pinyin[q]) {
+    case 'i': case 'u': case 'v': case 'a': case 'e': case 'o': case 'r':
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t
+PinyinParser::parse (const String   &pinyin,
+                     size_t          len,
+                     unsigned int    option,
+                     PinyinArray    &result,
+                     size_t          max,
+                     size_t          edit,
+                     size_t         &changed)
+{
+    const char *p = pinyin;
+
+    if (G_UNLIKELY (len < 0))
+        len = pinyin.size ();
+    edit = MIN (edit, len);
+
+    /* Keeps a segment if the parse of it and of the segments before it read
+     * no byte from edit on. It reads at most the longest pinyin, 6 bytes,
+     * after the segment. The segment must also be left alone by the parse
+     * of the next one, so the bytes around its end must not start the look
+     * back of the r, n, g and e endings. */
+    size_t keep = MIN (result.size (), max);
+    while (keep > 0) {
+        const PinyinSegment &last = result[keep - 1];
+        size_t r = last.begin + last.len;
+        if (r + 6 <= edit && !look_back (p, r) && !look_back (p, r + 1))
             break;
+        keep --;
+    }
+
+    PinyinArray old;
+    old.assign (result.begin () + keep, result.end ());
+    result.resize (keep);
+
+    const char *begin = p;
+    if (keep > 0)
+        begin += result.back ().begin + result.back ().len;
+    size_t retval = parse_pinyin (p, begin, p + len, option, result, max);
+
+    changed = keep;
+    while (changed < result.size () && changed - keep < old.size () &&
+           result[changed] == old[changed - keep])
+        changed ++;
+
+    return retval;
+}
+
+/* Scores of the syllables of a PinyinLattice. Every syllable costs, so
+ * the segmentations with fewer syllables win, and a syllable costs more if
+ * it is incomplete, corrected or fuzzy. The syllables chosen by parse ()
+ * get a point more, which breaks the ties in favour of its segmentation. */
+#define LATTICE_SYLLABLE_SCORE      (-10)
+#define LATTICE_INCOMPLETE_SCORE    (-8)
+#define LATTICE_CORRECT_SCORE       (-3)
+#define LATTICE_FUZZY_SCORE         (-2)
+#define LATTICE_PARSE_SCORE         (1)
+
+static inline size_t
+skip_apostrophes (const char *pinyin, size_t i, size_t len)
+{
+    while (i < len && pinyin[i] == '\'')
+        i++;
+    return i;
+}
+
+static int
+syllable_score (const Pinyin *py)
+{
+    int score = LATTICE_SYLLABLE_SCORE;
+    if (py->flags & PINYIN_INCOMPLETE_PINYIN)
+        score += LATTICE_INCOMPLETE_SCORE;
+    if (py->flags & PINYIN_CORRECT_ALL)
+        score += LATTICE_CORRECT_SCORE;
+    if (py->flags & PINYIN_FUZZY_ALL)
+        score += LATTICE_FUZZY_SCORE;
+    return score;
+}
+
+void
+PinyinParser::parseLattice (const String   &pinyin,
+                            size_t          len,
+                            unsigned int    option,
+                            PinyinLattice  &lattice)
+{
+    const char *p = pinyin;
+
+    lattice.clear ();
+
+    if (G_UNLIKELY (len < 0))
+        len = pinyin.size ();
+
+    /* every syllable at every node reachable from the first one */
+    std::vector<PinyinLattice::Edge> edges;
+    std::vector<bool> reached (len + 1, false);
+    size_t begin = skip_apostrophes (p, 0, len);
+    size_t end = begin;
+
+    reached[begin] = true;
+    for (size_t i = begin; i < len; i++) {
+        if (!reached[i])
+            continue;
+        const PinyinTrieNode *node = pinyin_trie;
+        for (size_t j = i; j < len; j++) {
+            if ((node = trie_child (node, p[j])) == NULL)
+                break;
+            if (node->pinyin < 0 || !check_flags (&pinyin_table[node->pinyin], option))
+                continue;
+
+            const Pinyin *py = &pinyin_table[node->pinyin];
+            PinyinLattice::Edge edge;
+            edge.segment = PinyinSegment (py, i, py->len);
+            edge.next = skip_apostrophes (p, i + py->len, len);
+            edge.score = syllable_score (py);
+            edges.push_back (edge);
+
+            reached[edge.next] = true;
+            end = MAX (end, edge.next);
         }
     }
-    else {
-        std::strcat (buf, id_map[yun]);
+
+    PinyinArray parsed;
+    parse (pinyin, len, option, parsed, len);
+
+    /* keeps the syllables from which the last node is reachable */
+    std::vector<bool> alive (len + 1, false);
+    alive[end] = true;
+    for (size_t k = edges.size (); k-- > 0; ) {
+        if (alive[edges[k].next])
+            alive[edges[k].segment.begin] = true;
     }
 
-    result = (const Pinyin *) bsearch (buf, pinyin_table, G_N_ELEMENTS (pinyin_table),
-                                            sizeof (Pinyin), py_cmp);
-    if (check_flags (result, option))
-        return result;
-    return NULL;
+    lattice.m_begin = begin;
+    lattice.m_end = end;
+    lattice.m_offsets.assign (end + 2, 0);
+    for (size_t k = 0, s = 0; k < edges.size (); k++) {
+        PinyinLattice::Edge & edge = edges[k];
+        if (edge.next > end || !alive[edge.next])
+            continue;
+        while (s < parsed.size () && parsed[s].begin < edge.segment.begin)
+            s++;
+        if (s < parsed.size () && parsed[s] == edge.segment)
+            edge.score += LATTICE_PARSE_SCORE;
+        lattice.m_edges.push_back (edge);
+        lattice.m_offsets[edge.segment.begin + 1] = lattice.m_edges.size ();
+    }
+    /* nodes without syllables start where the node before them ends */
+    for (size_t i = 1; i < end + 2; i++)
+        lattice.m_offsets[i] = MAX (lattice.m_offsets[i], lattice.m_offsets[i - 1]);
 }
 
-static int
-bopomofo_cmp (const void *p1, const void *p2)
+const Pinyin *
+PinyinParser::isPinyin (int sheng, int yun, unsigned int option)
 {
-    const wchar_t *s1 = (wchar_t *) p1;
-    const Pinyin *s2 = *(const Pinyin **) p2;
+    if (G_UNLIKELY (sheng < 0 || sheng >= (int) G_N_ELEMENTS (sheng_yun_table) ||
+                    yun < 0 || yun >= (int) G_N_ELEMENTS (sheng_yun_table[0])))
+        return NULL;
 
-    return std::wcscmp (s1, s2->bopomofo);
+    int i = sheng_yun_table[sheng][yun];
+    if (i < 0 || !check_flags (&pinyin_table[i], option))
+        return NULL;
+    return &pinyin_table[i];
 }
 
 bool
@@ -301,6 +448,18 @@ PinyinParser::isBopomofoToneChar (const wchar_t ch)
         || ch == bopomofo_char[BOPOMOFO_TONE_5];
 }
 
+static inline const BopomofoTrieNode *
+bopomofo_trie_child (const BopomofoTrieNode *node, wchar_t c)
+{
+    if (G_UNLIKELY (c < 0x3105 || c > 0x3129))
+        return NULL;
+
+    guint64 bit = G_GUINT64_CONSTANT (1) << (c - 0x3105);
+    if ((node->children & bit) == 0)
+        return NULL;
+    return bopomofo_trie + node->first + __builtin_popcountll (node->children & (bit - 1));
+}
+
 size_t
 PinyinParser::parseBopomofo (const std::wstring &bopomofo,
                              size_t              len,
@@ -310,9 +469,6 @@ PinyinParser::parseBopomofo (const std::wstring &bopomofo,
 {
     std::wstring::const_iterator bpmf = bopomofo.begin();
     const std::wstring::const_iterator end = bpmf + len;
-    const Pinyin **bs_res = NULL;
-    wchar_t buf[MAX_BOPOMOFO_LEN + 1];
-    size_t i, j;
 
     result.clear ();
 
@@ -320,37 +476,37 @@ PinyinParser::parseBopomofo (const std::wstring &bopomofo,
         len = bopomofo.length ();
 
     for (; bpmf < end && result.size () < max;) {
-        for (i = MAX_BOPOMOFO_LEN; i > 0; i--){
-            if (bpmf + i > end)
-                continue;
-
-            for (j = 0; j < i; j++) {
-                wchar_t key = *(bpmf + j);
-
-                if (j == i - 1 && isBopomofoToneChar (key)) {
-                    break; /* ignore tone */
+        /* the longest syllable, which may end with a tone, that is ignored */
+        const BopomofoTrieNode *node = bopomofo_trie;
+        const Pinyin *py = NULL;
+        size_t i = 0;
+
+        for (size_t j = 0; j < MAX_BOPOMOFO_LEN && bpmf + j < end; j++) {
+            wchar_t key = *(bpmf + j);
+
+            if (isBopomofoToneChar (key)) {
+                if (node->pinyin >= 0 && check_flags (&pinyin_table[node->pinyin], option)) {
+                    py = &pinyin_table[node->pinyin];
+                    i = j + 1;
                 }
-
-                buf[j] = key;
+                break;
             }
 
-            buf[j] = '\0';
-            bs_res = (const Pinyin **) std::bsearch (buf,
-                                                     bopomofo_table,
-                                                     G_N_ELEMENTS (bopomofo_table),
-                                                     sizeof (bopomofo_table[0]),
-                                                     bopomofo_cmp);
-            if (bs_res != NULL && check_flags (*bs_res, option))
+            if ((node = bopomofo_trie_child (node, key)) == NULL)
                 break;
+            if (node->pinyin >= 0 && check_flags (&pinyin_table[node->pinyin], option)) {
+                py = &pinyin_table[node->pinyin];
+                i = j + 1;
+            }
         }
-        if (!(bs_res != NULL && check_flags (*bs_res, option)))
+        if (py == NULL)
             break;
 
-        result.append(*bs_res, bpmf - bopomofo.begin (), i);
+        result.append (py, bpmf - bopomofo.begin (), i);
         bpmf += i;
     }
 
     return bpmf - bopomofo.begin ();
-};
+}
 
 };  // namespace PyZy
@@ -23,6 +23,7 @@
 #define __PYZY_PINYIN_PARSER_H_
 
 #include "PinyinArray.h"
+#include "PinyinLattice.h"
 #include "String.h"
 
 namespace PyZy {
@@ -34,6 +35,23 @@ public:
                          unsigned int  option,      // option
                          PinyinArray  &result,      // store pinyin in result
                          size_t        max);        // max length of the result
+    /* Reparses pinyin, when result was parsed from a text whose first edit
+     * bytes are the same, with the same option and max. Only the segments
+     * that may depend on the bytes from edit on are parsed again, and the
+     * number of leading segments that did not change is set to changed. */
+    static size_t parse (const String &pinyin,      // pinyin string
+                         size_t        len,         // length of pinyin string
+                         unsigned int  option,      // option
+                         PinyinArray  &result,      // previous and new result
+                         size_t        max,         // max length of the result
+                         size_t        edit,        // first changed byte
+                         size_t       &changed);    // first changed segment
+    /* Finds every segmentation of pinyin into the syllables allowed by
+     * option, instead of the one parse () picks. */
+    static void parseLattice (const String  &pinyin,  // pinyin string
+                              size_t         len,     // length of pinyin string
+                              unsigned int   option,  // option
+                              PinyinLattice &lattice);// store syllables in lattice
     static const Pinyin * isPinyin (int sheng, int yun, unsigned int option);
     static size_t parseBopomofo (const std::wstring  &bopomofo,
                                  size_t               len,
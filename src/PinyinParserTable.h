@@ -6619,486 +6619,1607 @@ static const Pinyin pinyin_table[] = {
     },
 };
 
-static const Pinyin *bopomofo_table[] = {
-    &pinyin_table[7],    // "ㄅ" => "b"
-    &pinyin_table[8],    // "ㄅㄚ" => "ba"
-    &pinyin_table[29],   // "ㄅㄛ" => "bo"
-    &pinyin_table[10],   // "ㄅㄞ" => "bai"
-    &pinyin_table[16],   // "ㄅㄟ" => "bei"
-    &pinyin_table[14],   // "ㄅㄠ" => "bao"
-    &pinyin_table[12],   // "ㄅㄢ" => "ban"
-    &pinyin_table[18],   // "ㄅㄣ" => "ben"
-    &pinyin_table[13],   // "ㄅㄤ" => "bang"
-    &pinyin_table[19],   // "ㄅㄥ" => "beng"
-    &pinyin_table[20],   // "ㄅㄧ" => "bi"
-    &pinyin_table[24],   // "ㄅㄧㄝ" => "bie"
-    &pinyin_table[23],   // "ㄅㄧㄠ" => "biao"
-    &pinyin_table[21],   // "ㄅㄧㄢ" => "bian"
-    &pinyin_table[27],   // "ㄅㄧㄣ" => "bin"
-    &pinyin_table[22],   // "ㄅㄧㄤ" => "biang"
-    &pinyin_table[28],   // "ㄅㄧㄥ" => "bing"
-    &pinyin_table[30],   // "ㄅㄨ" => "bu"
-    &pinyin_table[403],  // "ㄆ" => "p"
-    &pinyin_table[404],  // "ㄆㄚ" => "pa"
-    &pinyin_table[425],  // "ㄆㄛ" => "po"
-    &pinyin_table[406],  // "ㄆㄞ" => "pai"
-    &pinyin_table[412],  // "ㄆㄟ" => "pei"
-    &pinyin_table[410],  // "ㄆㄠ" => "pao"
-    &pinyin_table[426],  // "ㄆㄡ" => "pou"
-    &pinyin_table[408],  // "ㄆㄢ" => "pan"
-    &pinyin_table[414],  // "ㄆㄣ" => "pen"
-    &pinyin_table[409],  // "ㄆㄤ" => "pang"
-    &pinyin_table[415],  // "ㄆㄥ" => "peng"
-    &pinyin_table[416],  // "ㄆㄧ" => "pi"
-    &pinyin_table[420],  // "ㄆㄧㄝ" => "pie"
-    &pinyin_table[419],  // "ㄆㄧㄠ" => "piao"
-    &pinyin_table[417],  // "ㄆㄧㄢ" => "pian"
-    &pinyin_table[423],  // "ㄆㄧㄣ" => "pin"
-    &pinyin_table[418],  // "ㄆㄧㄤ" => "piang"
-    &pinyin_table[424],  // "ㄆㄧㄥ" => "ping"
-    &pinyin_table[427],  // "ㄆㄨ" => "pu"
-    &pinyin_table[330],  // "ㄇ" => "m"
-    &pinyin_table[331],  // "ㄇㄚ" => "ma"
-    &pinyin_table[355],  // "ㄇㄛ" => "mo"
-    &pinyin_table[338],  // "ㄇㄜ" => "me"
-    &pinyin_table[333],  // "ㄇㄞ" => "mai"
-    &pinyin_table[340],  // "ㄇㄟ" => "mei"
-    &pinyin_table[337],  // "ㄇㄠ" => "mao"
-    &pinyin_table[356],  // "ㄇㄡ" => "mou"
-    &pinyin_table[335],  // "ㄇㄢ" => "man"
-    &pinyin_table[342],  // "ㄇㄣ" => "men"
-    &pinyin_table[336],  // "ㄇㄤ" => "mang"
-    &pinyin_table[343],  // "ㄇㄥ" => "meng"
-    &pinyin_table[344],  // "ㄇㄧ" => "mi"
-    &pinyin_table[348],  // "ㄇㄧㄝ" => "mie"
-    &pinyin_table[347],  // "ㄇㄧㄠ" => "miao"
-    &pinyin_table[354],  // "ㄇㄧㄡ" => "miu"
-    &pinyin_table[345],  // "ㄇㄧㄢ" => "mian"
-    &pinyin_table[351],  // "ㄇㄧㄣ" => "min"
-    &pinyin_table[346],  // "ㄇㄧㄤ" => "miang"
-    &pinyin_table[352],  // "ㄇㄧㄥ" => "ming"
-    &pinyin_table[357],  // "ㄇㄨ" => "mu"
-    &pinyin_table[132],  // "ㄈ" => "f"
-    &pinyin_table[133],  // "ㄈㄚ" => "fa"
-    &pinyin_table[146],  // "ㄈㄛ" => "fo"
-    &pinyin_table[140],  // "ㄈㄜ" => "fe"
-    &pinyin_table[135],  // "ㄈㄞ" => "fai"
-    &pinyin_table[142],  // "ㄈㄟ" => "fei"
-    &pinyin_table[139],  // "ㄈㄠ" => "fao"
-    &pinyin_table[149],  // "ㄈㄡ" => "fou"
-    &pinyin_table[137],  // "ㄈㄢ" => "fan"
-    &pinyin_table[144],  // "ㄈㄣ" => "fen"
-    &pinyin_table[138],  // "ㄈㄤ" => "fang"
-    &pinyin_table[145],  // "ㄈㄥ" => "feng"
-    &pinyin_table[150],  // "ㄈㄨ" => "fu"
-    &pinyin_table[151],  // "ㄈㄨㄚ" => "fua"
-    &pinyin_table[159],  // "ㄈㄨㄛ" => "fuo"
-    &pinyin_table[152],  // "ㄈㄨㄞ" => "fuai"
-    &pinyin_table[157],  // "ㄈㄨㄟ" => "fui"
-    &pinyin_table[153],  // "ㄈㄨㄢ" => "fuan"
-    &pinyin_table[158],  // "ㄈㄨㄣ" => "fun"
-    &pinyin_table[154],  // "ㄈㄨㄤ" => "fuang"
-    &pinyin_table[148],  // "ㄈㄨㄥ" => "fong"
-    &pinyin_table[89],   // "ㄉ" => "d"
-    &pinyin_table[90],   // "ㄉㄚ" => "da"
-    &pinyin_table[97],   // "ㄉㄜ" => "de"
-    &pinyin_table[92],   // "ㄉㄞ" => "dai"
-    &pinyin_table[99],   // "ㄉㄟ" => "dei"
-    &pinyin_table[96],   // "ㄉㄠ" => "dao"
-    &pinyin_table[119],  // "ㄉㄡ" => "dou"
-    &pinyin_table[94],   // "ㄉㄢ" => "dan"
-    &pinyin_table[101],  // "ㄉㄣ" => "den"
-    &pinyin_table[95],   // "ㄉㄤ" => "dang"
-    &pinyin_table[102],  // "ㄉㄥ" => "deng"
-    &pinyin_table[103],  // "ㄉㄧ" => "di"
-    &pinyin_table[104],  // "ㄉㄧㄚ" => "dia"
-    &pinyin_table[108],  // "ㄉㄧㄝ" => "die"
-    &pinyin_table[107],  // "ㄉㄧㄠ" => "diao"
-    &pinyin_table[114],  // "ㄉㄧㄡ" => "diu"
-    &pinyin_table[105],  // "ㄉㄧㄢ" => "dian"
-    &pinyin_table[111],  // "ㄉㄧㄣ" => "din"
-    &pinyin_table[106],  // "ㄉㄧㄤ" => "diang"
-    &pinyin_table[112],  // "ㄉㄧㄥ" => "ding"
-    &pinyin_table[120],  // "ㄉㄨ" => "du"
-    &pinyin_table[127],  // "ㄉㄨㄛ" => "duo"
-    &pinyin_table[125],  // "ㄉㄨㄟ" => "dui"
-    &pinyin_table[121],  // "ㄉㄨㄢ" => "duan"
-    &pinyin_table[126],  // "ㄉㄨㄣ" => "dun"
-    &pinyin_table[122],  // "ㄉㄨㄤ" => "duang"
-    &pinyin_table[118],  // "ㄉㄨㄥ" => "dong"
-    &pinyin_table[560],  // "ㄊ" => "t"
-    &pinyin_table[561],  // "ㄊㄚ" => "ta"
-    &pinyin_table[568],  // "ㄊㄜ" => "te"
-    &pinyin_table[563],  // "ㄊㄞ" => "tai"
-    &pinyin_table[567],  // "ㄊㄠ" => "tao"
-    &pinyin_table[586],  // "ㄊㄡ" => "tou"
-    &pinyin_table[565],  // "ㄊㄢ" => "tan"
-    &pinyin_table[571],  // "ㄊㄣ" => "ten"
-    &pinyin_table[566],  // "ㄊㄤ" => "tang"
-    &pinyin_table[572],  // "ㄊㄥ" => "teng"
-    &pinyin_table[573],  // "ㄊㄧ" => "ti"
-    &pinyin_table[577],  // "ㄊㄧㄝ" => "tie"
-    &pinyin_table[576],  // "ㄊㄧㄠ" => "tiao"
-    &pinyin_table[574],  // "ㄊㄧㄢ" => "tian"
-    &pinyin_table[580],  // "ㄊㄧㄣ" => "tin"
-    &pinyin_table[575],  // "ㄊㄧㄤ" => "tiang"
-    &pinyin_table[581],  // "ㄊㄧㄥ" => "ting"
-    &pinyin_table[587],  // "ㄊㄨ" => "tu"
-    &pinyin_table[594],  // "ㄊㄨㄛ" => "tuo"
-    &pinyin_table[592],  // "ㄊㄨㄟ" => "tui"
-    &pinyin_table[588],  // "ㄊㄨㄢ" => "tuan"
-    &pinyin_table[593],  // "ㄊㄨㄣ" => "tun"
-    &pinyin_table[589],  // "ㄊㄨㄤ" => "tuang"
-    &pinyin_table[585],  // "ㄊㄨㄥ" => "tong"
-    &pinyin_table[358],  // "ㄋ" => "n"
-    &pinyin_table[359],  // "ㄋㄚ" => "na"
-    &pinyin_table[386],  // "ㄋㄛ" => "no"
-    &pinyin_table[366],  // "ㄋㄜ" => "ne"
-    &pinyin_table[361],  // "ㄋㄞ" => "nai"
-    &pinyin_table[368],  // "ㄋㄟ" => "nei"
-    &pinyin_table[365],  // "ㄋㄠ" => "nao"
-    &pinyin_table[391],  // "ㄋㄡ" => "nou"
-    &pinyin_table[363],  // "ㄋㄢ" => "nan"
-    &pinyin_table[370],  // "ㄋㄣ" => "nen"
-    &pinyin_table[364],  // "ㄋㄤ" => "nang"
-    &pinyin_table[371],  // "ㄋㄥ" => "neng"
-    &pinyin_table[372],  // "ㄋㄧ" => "ni"
-    &pinyin_table[373],  // "ㄋㄧㄚ" => "nia"
-    &pinyin_table[379],  // "ㄋㄧㄝ" => "nie"
-    &pinyin_table[378],  // "ㄋㄧㄠ" => "niao"
-    &pinyin_table[385],  // "ㄋㄧㄡ" => "niu"
-    &pinyin_table[376],  // "ㄋㄧㄢ" => "nian"
-    &pinyin_table[382],  // "ㄋㄧㄣ" => "nin"
-    &pinyin_table[377],  // "ㄋㄧㄤ" => "niang"
-    &pinyin_table[383],  // "ㄋㄧㄥ" => "ning"
-    &pinyin_table[392],  // "ㄋㄨ" => "nu"
-    &pinyin_table[398],  // "ㄋㄨㄛ" => "nuo"
-    &pinyin_table[393],  // "ㄋㄨㄢ" => "nuan"
-    &pinyin_table[397],  // "ㄋㄨㄣ" => "nun"
-    &pinyin_table[394],  // "ㄋㄨㄤ" => "nuang"
-    &pinyin_table[390],  // "ㄋㄨㄥ" => "nong"
-    &pinyin_table[399],  // "ㄋㄩ" => "nv"
-    &pinyin_table[400],  // "ㄋㄩㄝ" => "nve"
-    &pinyin_table[285],  // "ㄌ" => "l"
-    &pinyin_table[286],  // "ㄌㄚ" => "la"
-    &pinyin_table[313],  // "ㄌㄛ" => "lo"
-    &pinyin_table[293],  // "ㄌㄜ" => "le"
-    &pinyin_table[288],  // "ㄌㄞ" => "lai"
-    &pinyin_table[295],  // "ㄌㄟ" => "lei"
-    &pinyin_table[292],  // "ㄌㄠ" => "lao"
-    &pinyin_table[318],  // "ㄌㄡ" => "lou"
-    &pinyin_table[290],  // "ㄌㄢ" => "lan"
-    &pinyin_table[297],  // "ㄌㄣ" => "len"
-    &pinyin_table[291],  // "ㄌㄤ" => "lang"
-    &pinyin_table[298],  // "ㄌㄥ" => "leng"
-    &pinyin_table[299],  // "ㄌㄧ" => "li"
-    &pinyin_table[300],  // "ㄌㄧㄚ" => "lia"
-    &pinyin_table[306],  // "ㄌㄧㄝ" => "lie"
-    &pinyin_table[305],  // "ㄌㄧㄠ" => "liao"
-    &pinyin_table[312],  // "ㄌㄧㄡ" => "liu"
-    &pinyin_table[303],  // "ㄌㄧㄢ" => "lian"
-    &pinyin_table[309],  // "ㄌㄧㄣ" => "lin"
-    &pinyin_table[304],  // "ㄌㄧㄤ" => "liang"
-    &pinyin_table[310],  // "ㄌㄧㄥ" => "ling"
-    &pinyin_table[319],  // "ㄌㄨ" => "lu"
-    &pinyin_table[327],  // "ㄌㄨㄛ" => "luo"
-    &pinyin_table[325],  // "ㄌㄨㄟ" => "lui"
-    &pinyin_table[320],  // "ㄌㄨㄢ" => "luan"
-    &pinyin_table[326],  // "ㄌㄨㄣ" => "lun"
-    &pinyin_table[321],  // "ㄌㄨㄤ" => "luang"
-    &pinyin_table[317],  // "ㄌㄨㄥ" => "long"
-    &pinyin_table[328],  // "ㄌㄩ" => "lv"
-    &pinyin_table[329],  // "ㄌㄩㄝ" => "lve"
-    &pinyin_table[160],  // "ㄍ" => "g"
-    &pinyin_table[161],  // "ㄍㄚ" => "ga"
-    &pinyin_table[168],  // "ㄍㄜ" => "ge"
-    &pinyin_table[163],  // "ㄍㄞ" => "gai"
-    &pinyin_table[170],  // "ㄍㄟ" => "gei"
-    &pinyin_table[167],  // "ㄍㄠ" => "gao"
-    &pinyin_table[178],  // "ㄍㄡ" => "gou"
-    &pinyin_table[165],  // "ㄍㄢ" => "gan"
-    &pinyin_table[172],  // "ㄍㄣ" => "gen"
-    &pinyin_table[166],  // "ㄍㄤ" => "gang"
-    &pinyin_table[173],  // "ㄍㄥ" => "geng"
-    &pinyin_table[179],  // "ㄍㄨ" => "gu"
-    &pinyin_table[180],  // "ㄍㄨㄚ" => "gua"
-    &pinyin_table[190],  // "ㄍㄨㄛ" => "guo"
-    &pinyin_table[182],  // "ㄍㄨㄞ" => "guai"
-    &pinyin_table[188],  // "ㄍㄨㄟ" => "gui"
-    &pinyin_table[184],  // "ㄍㄨㄢ" => "guan"
-    &pinyin_table[189],  // "ㄍㄨㄣ" => "gun"
-    &pinyin_table[185],  // "ㄍㄨㄤ" => "guang"
-    &pinyin_table[177],  // "ㄍㄨㄥ" => "gong"
-    &pinyin_table[254],  // "ㄎ" => "k"
-    &pinyin_table[255],  // "ㄎㄚ" => "ka"
-    &pinyin_table[262],  // "ㄎㄜ" => "ke"
-    &pinyin_table[257],  // "ㄎㄞ" => "kai"
-    &pinyin_table[264],  // "ㄎㄟ" => "kei"
-    &pinyin_table[261],  // "ㄎㄠ" => "kao"
-    &pinyin_table[272],  // "ㄎㄡ" => "kou"
-    &pinyin_table[259],  // "ㄎㄢ" => "kan"
-    &pinyin_table[266],  // "ㄎㄣ" => "ken"
-    &pinyin_table[260],  // "ㄎㄤ" => "kang"
-    &pinyin_table[267],  // "ㄎㄥ" => "keng"
-    &pinyin_table[273],  // "ㄎㄨ" => "ku"
-    &pinyin_table[274],  // "ㄎㄨㄚ" => "kua"
-    &pinyin_table[284],  // "ㄎㄨㄛ" => "kuo"
-    &pinyin_table[276],  // "ㄎㄨㄞ" => "kuai"
-    &pinyin_table[282],  // "ㄎㄨㄟ" => "kui"
-    &pinyin_table[278],  // "ㄎㄨㄢ" => "kuan"
-    &pinyin_table[283],  // "ㄎㄨㄣ" => "kun"
-    &pinyin_table[279],  // "ㄎㄨㄤ" => "kuang"
-    &pinyin_table[271],  // "ㄎㄨㄥ" => "kong"
-    &pinyin_table[191],  // "ㄏ" => "h"
-    &pinyin_table[192],  // "ㄏㄚ" => "ha"
-    &pinyin_table[205],  // "ㄏㄛ" => "ho"
-    &pinyin_table[199],  // "ㄏㄜ" => "he"
-    &pinyin_table[194],  // "ㄏㄞ" => "hai"
-    &pinyin_table[201],  // "ㄏㄟ" => "hei"
-    &pinyin_table[198],  // "ㄏㄠ" => "hao"
-    &pinyin_table[210],  // "ㄏㄡ" => "hou"
-    &pinyin_table[196],  // "ㄏㄢ" => "han"
-    &pinyin_table[203],  // "ㄏㄣ" => "hen"
-    &pinyin_table[197],  // "ㄏㄤ" => "hang"
-    &pinyin_table[204],  // "ㄏㄥ" => "heng"
-    &pinyin_table[211],  // "ㄏㄨ" => "hu"
-    &pinyin_table[212],  // "ㄏㄨㄚ" => "hua"
-    &pinyin_table[222],  // "ㄏㄨㄛ" => "huo"
-    &pinyin_table[214],  // "ㄏㄨㄞ" => "huai"
-    &pinyin_table[220],  // "ㄏㄨㄟ" => "hui"
-    &pinyin_table[216],  // "ㄏㄨㄢ" => "huan"
-    &pinyin_table[221],  // "ㄏㄨㄣ" => "hun"
-    &pinyin_table[217],  // "ㄏㄨㄤ" => "huang"
-    &pinyin_table[209],  // "ㄏㄨㄥ" => "hong"
-    &pinyin_table[223],  // "ㄐ" => "j"
-    &pinyin_table[224],  // "ㄐㄧ" => "ji"
-    &pinyin_table[225],  // "ㄐㄧㄚ" => "jia"
-    &pinyin_table[231],  // "ㄐㄧㄝ" => "jie"
-    &pinyin_table[230],  // "ㄐㄧㄠ" => "jiao"
-    &pinyin_table[241],  // "ㄐㄧㄡ" => "jiu"
-    &pinyin_table[228],  // "ㄐㄧㄢ" => "jian"
-    &pinyin_table[234],  // "ㄐㄧㄣ" => "jin"
-    &pinyin_table[229],  // "ㄐㄧㄤ" => "jiang"
-    &pinyin_table[235],  // "ㄐㄧㄥ" => "jing"
-    &pinyin_table[242],  // "ㄐㄩ" => "ju"
-    &pinyin_table[245],  // "ㄐㄩㄝ" => "jue"
-    &pinyin_table[243],  // "ㄐㄩㄢ" => "juan"
-    &pinyin_table[247],  // "ㄐㄩㄣ" => "jun"
-    &pinyin_table[244],  // "ㄐㄩㄤ" => "juang"
-    &pinyin_table[239],  // "ㄐㄩㄥ" => "jiong"
-    &pinyin_table[428],  // "ㄑ" => "q"
-    &pinyin_table[429],  // "ㄑㄧ" => "qi"
-    &pinyin_table[430],  // "ㄑㄧㄚ" => "qia"
-    &pinyin_table[436],  // "ㄑㄧㄝ" => "qie"
-    &pinyin_table[435],  // "ㄑㄧㄠ" => "qiao"
-    &pinyin_table[446],  // "ㄑㄧㄡ" => "qiu"
-    &pinyin_table[433],  // "ㄑㄧㄢ" => "qian"
-    &pinyin_table[439],  // "ㄑㄧㄣ" => "qin"
-    &pinyin_table[434],  // "ㄑㄧㄤ" => "qiang"
-    &pinyin_table[440],  // "ㄑㄧㄥ" => "qing"
-    &pinyin_table[447],  // "ㄑㄩ" => "qu"
-    &pinyin_table[450],  // "ㄑㄩㄝ" => "que"
-    &pinyin_table[448],  // "ㄑㄩㄢ" => "quan"
-    &pinyin_table[452],  // "ㄑㄩㄣ" => "qun"
-    &pinyin_table[449],  // "ㄑㄩㄤ" => "quang"
-    &pinyin_table[444],  // "ㄑㄩㄥ" => "qiong"
-    &pinyin_table[609],  // "ㄒ" => "x"
-    &pinyin_table[610],  // "ㄒㄧ" => "xi"
-    &pinyin_table[611],  // "ㄒㄧㄚ" => "xia"
-    &pinyin_table[617],  // "ㄒㄧㄝ" => "xie"
-    &pinyin_table[616],  // "ㄒㄧㄠ" => "xiao"
-    &pinyin_table[627],  // "ㄒㄧㄡ" => "xiu"
-    &pinyin_table[614],  // "ㄒㄧㄢ" => "xian"
-    &pinyin_table[620],  // "ㄒㄧㄣ" => "xin"
-    &pinyin_table[615],  // "ㄒㄧㄤ" => "xiang"
-    &pinyin_table[621],  // "ㄒㄧㄥ" => "xing"
-    &pinyin_table[628],  // "ㄒㄩ" => "xu"
-    &pinyin_table[631],  // "ㄒㄩㄝ" => "xue"
-    &pinyin_table[629],  // "ㄒㄩㄢ" => "xuan"
-    &pinyin_table[633],  // "ㄒㄩㄣ" => "xun"
-    &pinyin_table[630],  // "ㄒㄩㄤ" => "xuang"
-    &pinyin_table[625],  // "ㄒㄩㄥ" => "xiong"
-    &pinyin_table[699],  // "ㄓ" => "zhi"
-    &pinyin_table[686],  // "ㄓㄚ" => "zha"
-    &pinyin_table[693],  // "ㄓㄜ" => "zhe"
-    &pinyin_table[688],  // "ㄓㄞ" => "zhai"
-    &pinyin_table[695],  // "ㄓㄟ" => "zhei"
-    &pinyin_table[692],  // "ㄓㄠ" => "zhao"
-    &pinyin_table[704],  // "ㄓㄡ" => "zhou"
-    &pinyin_table[690],  // "ㄓㄢ" => "zhan"
-    &pinyin_table[697],  // "ㄓㄣ" => "zhen"
-    &pinyin_table[691],  // "ㄓㄤ" => "zhang"
-    &pinyin_table[698],  // "ㄓㄥ" => "zheng"
-    &pinyin_table[705],  // "ㄓㄨ" => "zhu"
-    &pinyin_table[706],  // "ㄓㄨㄚ" => "zhua"
-    &pinyin_table[716],  // "ㄓㄨㄛ" => "zhuo"
-    &pinyin_table[708],  // "ㄓㄨㄞ" => "zhuai"
-    &pinyin_table[714],  // "ㄓㄨㄟ" => "zhui"
-    &pinyin_table[710],  // "ㄓㄨㄢ" => "zhuan"
-    &pinyin_table[715],  // "ㄓㄨㄣ" => "zhun"
-    &pinyin_table[711],  // "ㄓㄨㄤ" => "zhuang"
-    &pinyin_table[703],  // "ㄓㄨㄥ" => "zhong"
-    &pinyin_table[57],   // "ㄔ" => "chi"
-    &pinyin_table[45],   // "ㄔㄚ" => "cha"
-    &pinyin_table[52],   // "ㄔㄜ" => "che"
-    &pinyin_table[47],   // "ㄔㄞ" => "chai"
-    &pinyin_table[51],   // "ㄔㄠ" => "chao"
-    &pinyin_table[62],   // "ㄔㄡ" => "chou"
-    &pinyin_table[49],   // "ㄔㄢ" => "chan"
-    &pinyin_table[55],   // "ㄔㄣ" => "chen"
-    &pinyin_table[50],   // "ㄔㄤ" => "chang"
-    &pinyin_table[56],   // "ㄔㄥ" => "cheng"
-    &pinyin_table[63],   // "ㄔㄨ" => "chu"
-    &pinyin_table[73],   // "ㄔㄨㄛ" => "chuo"
-    &pinyin_table[65],   // "ㄔㄨㄞ" => "chuai"
-    &pinyin_table[71],   // "ㄔㄨㄟ" => "chui"
-    &pinyin_table[67],   // "ㄔㄨㄢ" => "chuan"
-    &pinyin_table[72],   // "ㄔㄨㄣ" => "chun"
-    &pinyin_table[68],   // "ㄔㄨㄤ" => "chuang"
-    &pinyin_table[61],   // "ㄔㄨㄥ" => "chong"
-    &pinyin_table[528],  // "ㄕ" => "shi"
-    &pinyin_table[515],  // "ㄕㄚ" => "sha"
-    &pinyin_table[522],  // "ㄕㄜ" => "she"
-    &pinyin_table[517],  // "ㄕㄞ" => "shai"
-    &pinyin_table[524],  // "ㄕㄟ" => "shei"
-    &pinyin_table[521],  // "ㄕㄠ" => "shao"
-    &pinyin_table[531],  // "ㄕㄡ" => "shou"
-    &pinyin_table[519],  // "ㄕㄢ" => "shan"
-    &pinyin_table[526],  // "ㄕㄣ" => "shen"
-    &pinyin_table[520],  // "ㄕㄤ" => "shang"
-    &pinyin_table[527],  // "ㄕㄥ" => "sheng"
-    &pinyin_table[532],  // "ㄕㄨ" => "shu"
-    &pinyin_table[533],  // "ㄕㄨㄚ" => "shua"
-    &pinyin_table[543],  // "ㄕㄨㄛ" => "shuo"
-    &pinyin_table[535],  // "ㄕㄨㄞ" => "shuai"
-    &pinyin_table[541],  // "ㄕㄨㄟ" => "shui"
-    &pinyin_table[537],  // "ㄕㄨㄢ" => "shuan"
-    &pinyin_table[542],  // "ㄕㄨㄣ" => "shun"
-    &pinyin_table[538],  // "ㄕㄨㄤ" => "shuang"
-    &pinyin_table[530],  // "ㄕㄨㄥ" => "shong"
-    &pinyin_table[473],  // "ㄖ" => "ri"
-    &pinyin_table[460],  // "ㄖㄚ" => "ra"
-    &pinyin_table[483],  // "ㄖㄛ" => "ro"
-    &pinyin_table[467],  // "ㄖㄜ" => "re"
-    &pinyin_table[462],  // "ㄖㄞ" => "rai"
-    &pinyin_table[469],  // "ㄖㄟ" => "rei"
-    &pinyin_table[466],  // "ㄖㄠ" => "rao"
-    &pinyin_table[488],  // "ㄖㄡ" => "rou"
-    &pinyin_table[464],  // "ㄖㄢ" => "ran"
-    &pinyin_table[471],  // "ㄖㄣ" => "ren"
-    &pinyin_table[465],  // "ㄖㄤ" => "rang"
-    &pinyin_table[472],  // "ㄖㄥ" => "reng"
-    &pinyin_table[474],  // "ㄖㄧㄚ" => "ria"
-    &pinyin_table[478],  // "ㄖㄧㄝ" => "rie"
-    &pinyin_table[477],  // "ㄖㄧㄠ" => "riao"
-    &pinyin_table[482],  // "ㄖㄧㄡ" => "riu"
-    &pinyin_table[475],  // "ㄖㄧㄢ" => "rian"
-    &pinyin_table[479],  // "ㄖㄧㄣ" => "rin"
-    &pinyin_table[476],  // "ㄖㄧㄤ" => "riang"
-    &pinyin_table[480],  // "ㄖㄧㄥ" => "ring"
-    &pinyin_table[489],  // "ㄖㄨ" => "ru"
-    &pinyin_table[497],  // "ㄖㄨㄛ" => "ruo"
-    &pinyin_table[495],  // "ㄖㄨㄟ" => "rui"
-    &pinyin_table[490],  // "ㄖㄨㄢ" => "ruan"
-    &pinyin_table[496],  // "ㄖㄨㄣ" => "run"
-    &pinyin_table[491],  // "ㄖㄨㄤ" => "ruang"
-    &pinyin_table[487],  // "ㄖㄨㄥ" => "rong"
-    &pinyin_table[498],  // "ㄖㄩ" => "rv"
-    &pinyin_table[499],  // "ㄖㄩㄝ" => "rve"
-    &pinyin_table[717],  // "ㄗ" => "zi"
-    &pinyin_table[672],  // "ㄗㄚ" => "za"
-    &pinyin_table[679],  // "ㄗㄜ" => "ze"
-    &pinyin_table[674],  // "ㄗㄞ" => "zai"
-    &pinyin_table[681],  // "ㄗㄟ" => "zei"
-    &pinyin_table[678],  // "ㄗㄠ" => "zao"
-    &pinyin_table[722],  // "ㄗㄡ" => "zou"
-    &pinyin_table[676],  // "ㄗㄢ" => "zan"
-    &pinyin_table[683],  // "ㄗㄣ" => "zen"
-    &pinyin_table[677],  // "ㄗㄤ" => "zang"
-    &pinyin_table[684],  // "ㄗㄥ" => "zeng"
-    &pinyin_table[723],  // "ㄗㄨ" => "zu"
-    &pinyin_table[724],  // "ㄗㄨㄚ" => "zua"
-    &pinyin_table[732],  // "ㄗㄨㄛ" => "zuo"
-    &pinyin_table[725],  // "ㄗㄨㄞ" => "zuai"
-    &pinyin_table[730],  // "ㄗㄨㄟ" => "zui"
-    &pinyin_table[726],  // "ㄗㄨㄢ" => "zuan"
-    &pinyin_table[731],  // "ㄗㄨㄣ" => "zun"
-    &pinyin_table[727],  // "ㄗㄨㄤ" => "zuang"
-    &pinyin_table[721],  // "ㄗㄨㄥ" => "zong"
-    &pinyin_table[74],   // "ㄘ" => "ci"
-    &pinyin_table[32],   // "ㄘㄚ" => "ca"
-    &pinyin_table[39],   // "ㄘㄜ" => "ce"
-    &pinyin_table[34],   // "ㄘㄞ" => "cai"
-    &pinyin_table[38],   // "ㄘㄠ" => "cao"
-    &pinyin_table[79],   // "ㄘㄡ" => "cou"
-    &pinyin_table[36],   // "ㄘㄢ" => "can"
-    &pinyin_table[42],   // "ㄘㄣ" => "cen"
-    &pinyin_table[37],   // "ㄘㄤ" => "cang"
-    &pinyin_table[43],   // "ㄘㄥ" => "ceng"
-    &pinyin_table[80],   // "ㄘㄨ" => "cu"
-    &pinyin_table[88],   // "ㄘㄨㄛ" => "cuo"
-    &pinyin_table[81],   // "ㄘㄨㄞ" => "cuai"
-    &pinyin_table[86],   // "ㄘㄨㄟ" => "cui"
-    &pinyin_table[82],   // "ㄘㄨㄢ" => "cuan"
-    &pinyin_table[87],   // "ㄘㄨㄣ" => "cun"
-    &pinyin_table[83],   // "ㄘㄨㄤ" => "cuang"
-    &pinyin_table[78],   // "ㄘㄨㄥ" => "cong"
-    &pinyin_table[544],  // "ㄙ" => "si"
-    &pinyin_table[501],  // "ㄙㄚ" => "sa"
-    &pinyin_table[508],  // "ㄙㄜ" => "se"
-    &pinyin_table[503],  // "ㄙㄞ" => "sai"
-    &pinyin_table[510],  // "ㄙㄟ" => "sei"
-    &pinyin_table[507],  // "ㄙㄠ" => "sao"
-    &pinyin_table[549],  // "ㄙㄡ" => "sou"
-    &pinyin_table[505],  // "ㄙㄢ" => "san"
-    &pinyin_table[512],  // "ㄙㄣ" => "sen"
-    &pinyin_table[506],  // "ㄙㄤ" => "sang"
-    &pinyin_table[513],  // "ㄙㄥ" => "seng"
-    &pinyin_table[550],  // "ㄙㄨ" => "su"
-    &pinyin_table[551],  // "ㄙㄨㄚ" => "sua"
-    &pinyin_table[559],  // "ㄙㄨㄛ" => "suo"
-    &pinyin_table[552],  // "ㄙㄨㄞ" => "suai"
-    &pinyin_table[557],  // "ㄙㄨㄟ" => "sui"
-    &pinyin_table[553],  // "ㄙㄨㄢ" => "suan"
-    &pinyin_table[558],  // "ㄙㄨㄣ" => "sun"
-    &pinyin_table[554],  // "ㄙㄨㄤ" => "suang"
-    &pinyin_table[548],  // "ㄙㄨㄥ" => "song"
-    &pinyin_table[0],    // "ㄚ" => "a"
-    &pinyin_table[401],  // "ㄛ" => "o"
-    &pinyin_table[128],  // "ㄜ" => "e"
-    &pinyin_table[2],    // "ㄞ" => "ai"
-    &pinyin_table[129],  // "ㄟ" => "ei"
-    &pinyin_table[6],    // "ㄠ" => "ao"
-    &pinyin_table[402],  // "ㄡ" => "ou"
-    &pinyin_table[4],    // "ㄢ" => "an"
-    &pinyin_table[130],  // "ㄣ" => "en"
-    &pinyin_table[5],    // "ㄤ" => "ang"
-    &pinyin_table[131],  // "ㄦ" => "er"
-    &pinyin_table[648],  // "ㄧ" => "yi"
-    &pinyin_table[641],  // "ㄧㄚ" => "ya"
-    &pinyin_table[653],  // "ㄧㄛ" => "yo"
-    &pinyin_table[647],  // "ㄧㄝ" => "ye"
-    &pinyin_table[646],  // "ㄧㄠ" => "yao"
-    &pinyin_table[658],  // "ㄧㄡ" => "you"
-    &pinyin_table[644],  // "ㄧㄢ" => "yan"
-    &pinyin_table[651],  // "ㄧㄣ" => "yin"
-    &pinyin_table[645],  // "ㄧㄤ" => "yang"
-    &pinyin_table[652],  // "ㄧㄥ" => "ying"
-    &pinyin_table[661],  // "ㄧㄩㄤ" => "yuang"
-    &pinyin_table[608],  // "ㄨ" => "wu"
-    &pinyin_table[596],  // "ㄨㄚ" => "wa"
-    &pinyin_table[607],  // "ㄨㄛ" => "wo"
-    &pinyin_table[598],  // "ㄨㄞ" => "wai"
-    &pinyin_table[603],  // "ㄨㄟ" => "wei"
-    &pinyin_table[600],  // "ㄨㄢ" => "wan"
-    &pinyin_table[605],  // "ㄨㄣ" => "wen"
-    &pinyin_table[601],  // "ㄨㄤ" => "wang"
-    &pinyin_table[606],  // "ㄨㄥ" => "weng"
-    &pinyin_table[659],  // "ㄩ" => "yu"
-    &pinyin_table[662],  // "ㄩㄝ" => "yue"
-    &pinyin_table[660],  // "ㄩㄢ" => "yuan"
-    &pinyin_table[664],  // "ㄩㄣ" => "yun"
-    &pinyin_table[657],  // "ㄩㄥ" => "yong"
+static const PinyinTrieNode pinyin_trie[] = {
+    { 0x3cffeff, 1, -1 },            /* 0 "" */
+    { 0x0007140, 24, 0 },            /* 1 "a" */
+    { 0x0104111, 29, 7 },            /* 2 "b" */
+    { 0x0104191, 34, 31 },           /* 3 "c" */
+    { 0x0104111, 40, 89 },           /* 4 "d" */
+    { 0x0022100, 45, 128 },          /* 5 "e" */
+    { 0x0104011, 48, 132 },          /* 6 "f" */
+    { 0x0104011, 52, 160 },          /* 7 "g" */
+    { 0x0104011, 56, 191 },          /* 8 "h" */
+    { 0x0300100, 60, 223 },          /* 9 "j" */
+    { 0x0104011, 63, 254 },          /* 10 "k" */
+    { 0x0304111, 67, 285 },          /* 11 "l" */
+    { 0x0104111, 73, 330 },          /* 12 "m" */
+    { 0x0304111, 78, 358 },          /* 13 "n" */
+    { 0x0100000, 84, 401 },          /* 14 "o" */
+    { 0x0104111, 85, 403 },          /* 15 "p" */
+    { 0x0300100, 90, 428 },          /* 16 "q" */
+    { 0x0304111, 93, 459 },          /* 17 "r" */
+    { 0x0104191, 99, 500 },          /* 18 "s" */
+    { 0x0104111, 105, 560 },         /* 19 "t" */
+    { 0x0104011, 110, 595 },         /* 20 "w" */
+    { 0x0300100, 114, 609 },         /* 21 "x" */
+    { 0x0304111, 117, 640 },         /* 22 "y" */
+    { 0x0104191, 123, 671 },         /* 23 "z" */
+    { 0x0002000, 129, -1 },          /* 24 "ag" */
+    { 0x0000000, 0, 2 },             /* 25 "ai" */
+    { 0x0000040, 130, -1 },          /* 26 "am" */
+    { 0x0000040, 131, 4 },           /* 27 "an" */
+    { 0x0000000, 0, 6 },             /* 28 "ao" */
+    { 0x0007140, 132, 8 },           /* 29 "ba" */
+    { 0x0003140, 137, -1 },          /* 30 "be" */
+    { 0x0003051, 141, 20 },          /* 31 "bi" */
+    { 0x0000000, 0, 29 },            /* 32 "bo" */
+    { 0x0000000, 0, 30 },            /* 33 "bu" */
+    { 0x0007140, 146, 32 },          /* 34 "ca" */
+    { 0x0003040, 151, 39 },          /* 35 "ce" */
+    { 0x0104111, 154, 44 },          /* 36 "ch" */
+    { 0x0000000, 0, 74 },            /* 37 "ci" */
+    { 0x0103040, 159, -1 },          /* 38 "co" */
+    { 0x0006111, 163, 80 },          /* 39 "cu" */
+    { 0x0007140, 168, 90 },          /* 40 "da" */
+    { 0x0003140, 173, 97 },          /* 41 "de" */
+    { 0x0107051, 177, 103 },         /* 42 "di" */
+    { 0x0103040, 184, -1 },          /* 43 "do" */
+    { 0x0006111, 188, 120 },         /* 44 "du" */
+    { 0x0000000, 0, 129 },           /* 45 "ei" */
+    { 0x0000000, 0, 130 },           /* 46 "en" */
+    { 0x0000000, 0, 131 },           /* 47 "er" */
+    { 0x0007140, 193, 133 },         /* 48 "fa" */
+    { 0x0003140, 198, 140 },         /* 49 "fe" */
+    { 0x0102000, 202, 146 },         /* 50 "fo" */
+    { 0x0006111, 204, 150 },         /* 51 "fu" */
+    { 0x0007140, 209, 161 },         /* 52 "ga" */
+    { 0x0003140, 214, 168 },         /* 53 "ge" */
+    { 0x0103040, 218, -1 },          /* 54 "go" */
+    { 0x0006111, 222, 179 },         /* 55 "gu" */
+    { 0x0007140, 227, 192 },         /* 56 "ha" */
+    { 0x0003140, 232, 199 },         /* 57 "he" */
+    { 0x0103040, 236, 205 },         /* 58 "ho" */
+    { 0x0006111, 240, 211 },         /* 59 "hu" */
+    { 0x0107051, 245, 224 },         /* 60 "ji" */
+    { 0x0002011, 252, 242 },         /* 61 "ju" */
+    { 0x0002011, 255, 248 },         /* 62 "jv" */
+    { 0x0007140, 258, 255 },         /* 63 "ka" */
+    { 0x0003140, 263, 262 },         /* 64 "ke" */
+    { 0x0103040, 267, -1 },          /* 65 "ko" */
+    { 0x0006111, 271, 273 },         /* 66 "ku" */
+    { 0x0007140, 276, 286 },         /* 67 "la" */
+    { 0x0003140, 281, 293 },         /* 68 "le" */
+    { 0x0107051, 285, 299 },         /* 69 "li" */
+    { 0x0103040, 292, 313 },         /* 70 "lo" */
+    { 0x0006111, 296, 319 },         /* 71 "lu" */
+    { 0x0000010, 301, 328 },         /* 72 "lv" */
+    { 0x0007140, 302, 331 },         /* 73 "ma" */
+    { 0x0003140, 307, 338 },         /* 74 "me" */
+    { 0x0107051, 311, 344 },         /* 75 "mi" */
+    { 0x0100000, 318, 355 },         /* 76 "mo" */
+    { 0x0000000, 0, 357 },           /* 77 "mu" */
+    { 0x0007140, 319, 359 },         /* 78 "na" */
+    { 0x0003140, 324, 366 },         /* 79 "ne" */
+    { 0x0107051, 328, 372 },         /* 80 "ni" */
+    { 0x0103040, 335, 386 },         /* 81 "no" */
+    { 0x0006011, 339, 392 },         /* 82 "nu" */
+    { 0x0000010, 343, 399 },         /* 83 "nv" */
+    { 0x0000000, 0, 402 },           /* 84 "ou" */
+    { 0x0007140, 344, 404 },         /* 85 "pa" */
+    { 0x0003140, 349, -1 },          /* 86 "pe" */
+    { 0x0003051, 353, 416 },         /* 87 "pi" */
+    { 0x0100000, 358, 425 },         /* 88 "po" */
+    { 0x0000000, 0, 427 },           /* 89 "pu" */
+    { 0x0107051, 359, 429 },         /* 90 "qi" */
+    { 0x0002011, 366, 447 },         /* 91 "qu" */
+    { 0x0002011, 369, 453 },         /* 92 "qv" */
+    { 0x0007140, 372, 460 },         /* 93 "ra" */
+    { 0x0003140, 377, 467 },         /* 94 "re" */
+    { 0x0106011, 381, 473 },         /* 95 "ri" */
+    { 0x0103040, 386, 483 },         /* 96 "ro" */
+    { 0x0006111, 390, 489 },         /* 97 "ru" */
+    { 0x0000010, 395, 498 },         /* 98 "rv" */
+    { 0x0007140, 396, 501 },         /* 99 "sa" */
+    { 0x0003140, 401, 508 },         /* 100 "se" */
+    { 0x0104111, 405, 514 },         /* 101 "sh" */
+    { 0x0000000, 0, 544 },           /* 102 "si" */
+    { 0x0103040, 410, -1 },          /* 103 "so" */
+    { 0x0006111, 414, 550 },         /* 104 "su" */
+    { 0x0007140, 419, 561 },         /* 105 "ta" */
+    { 0x0003040, 424, 568 },         /* 106 "te" */
+    { 0x0003051, 427, 573 },         /* 107 "ti" */
+    { 0x0103040, 432, -1 },          /* 108 "to" */
+    { 0x0006111, 436, 587 },         /* 109 "tu" */
+    { 0x0003140, 441, 596 },         /* 110 "wa" */
+    { 0x0003140, 445, -1 },          /* 111 "we" */
+    { 0x0000000, 0, 607 },           /* 112 "wo" */
+    { 0x0000000, 0, 608 },           /* 113 "wu" */
+    { 0x0107051, 449, 610 },         /* 114 "xi" */
+    { 0x0002011, 456, 628 },         /* 115 "xu" */
+    { 0x0002011, 459, 634 },         /* 116 "xv" */
+    { 0x0007040, 462, 641 },         /* 117 "ya" */
+    { 0x0000000, 0, 647 },           /* 118 "ye" */
+    { 0x0003040, 466, 648 },         /* 119 "yi" */
+    { 0x0103040, 469, 653 },         /* 120 "yo" */
+    { 0x0002011, 473, 659 },         /* 121 "yu" */
+    { 0x0002011, 476, 665 },         /* 122 "yv" */
+    { 0x0007140, 479, 672 },         /* 123 "za" */
+    { 0x0003140, 484, 679 },         /* 124 "ze" */
+    { 0x0104111, 488, 685 },         /* 125 "zh" */
+    { 0x0000000, 0, 717 },           /* 126 "zi" */
+    { 0x0103040, 493, -1 },          /* 127 "zo" */
+    { 0x0006111, 497, 723 },         /* 128 "zu" */
+    { 0x0000000, 0, 1 },             /* 129 "agn" */
+    { 0x0000000, 0, 3 },             /* 130 "amg" */
+    { 0x0000000, 0, 5 },             /* 131 "ang" */
+    { 0x0002000, 502, -1 },          /* 132 "bag" */
+    { 0x0000000, 0, 10 },            /* 133 "bai" */
+    { 0x0000040, 503, -1 },          /* 134 "bam" */
+    { 0x0000040, 504, 12 },          /* 135 "ban" */
+    { 0x0000000, 0, 14 },            /* 136 "bao" */
+    { 0x0002000, 505, -1 },          /* 137 "beg" */
+    { 0x0000000, 0, 16 },            /* 138 "bei" */
+    { 0x0000040, 506, -1 },          /* 139 "bem" */
+    { 0x0000040, 507, 18 },          /* 140 "ben" */
+    { 0x0006000, 508, -1 },          /* 141 "bia" */
+    { 0x0000000, 0, 24 },            /* 142 "bie" */
+    { 0x0002000, 510, -1 },          /* 143 "big" */
+    { 0x0000040, 511, -1 },          /* 144 "bim" */
+    { 0x0000040, 512, 27 },          /* 145 "bin" */
+    { 0x0002000, 513, -1 },          /* 146 "cag" */
+    { 0x0000000, 0, 34 },            /* 147 "cai" */
+    { 0x0000040, 514, -1 },          /* 148 "cam" */
+    { 0x0000040, 515, 36 },          /* 149 "can" */
+    { 0x0000000, 0, 38 },            /* 150 "cao" */
+    { 0x0002000, 516, -1 },          /* 151 "ceg" */
+    { 0x0000040, 517, -1 },          /* 152 "cem" */
+    { 0x0000040, 518, 42 },          /* 153 "cen" */
+    { 0x0007140, 519, 45 },          /* 154 "cha" */
+    { 0x0003040, 524, 52 },          /* 155 "che" */
+    { 0x0000000, 0, 57 },            /* 156 "chi" */
+    { 0x0103040, 527, -1 },          /* 157 "cho" */
+    { 0x0006111, 531, 63 },          /* 158 "chu" */
+    { 0x0002000, 536, -1 },          /* 159 "cog" */
+    { 0x0000040, 537, -1 },          /* 160 "com" */
+    { 0x0000040, 538, 77 },          /* 161 "con" */
+    { 0x0000000, 0, 79 },            /* 162 "cou" */
+    { 0x0002100, 539, -1 },          /* 163 "cua" */
+    { 0x0002100, 541, -1 },          /* 164 "cue" */
+    { 0x0000000, 0, 86 },            /* 165 "cui" */
+    { 0x0000000, 0, 87 },            /* 166 "cun" */
+    { 0x0000000, 0, 88 },            /* 167 "cuo" */
+    { 0x0002000, 543, -1 },          /* 168 "dag" */
+    { 0x0000000, 0, 92 },            /* 169 "dai" */
+    { 0x0000040, 544, -1 },          /* 170 "dam" */
+    { 0x0000040, 545, 94 },          /* 171 "dan" */
+    { 0x0000000, 0, 96 },            /* 172 "dao" */
+    { 0x0002000, 546, -1 },          /* 173 "deg" */
+    { 0x0000000, 0, 99 },            /* 174 "dei" */
+    { 0x0000040, 547, -1 },          /* 175 "dem" */
+    { 0x0000040, 548, 101 },         /* 176 "den" */
+    { 0x0006000, 549, 104 },         /* 177 "dia" */
+    { 0x0000000, 0, 108 },           /* 178 "die" */
+    { 0x0002000, 551, -1 },          /* 179 "dig" */
+    { 0x0000040, 552, -1 },          /* 180 "dim" */
+    { 0x0000040, 553, 111 },         /* 181 "din" */
+    { 0x0100000, 554, -1 },          /* 182 "dio" */
+    { 0x0000000, 0, 114 },           /* 183 "diu" */
+    { 0x0002000, 555, -1 },          /* 184 "dog" */
+    { 0x0000040, 556, -1 },          /* 185 "dom" */
+    { 0x0000040, 557, 117 },         /* 186 "don" */
+    { 0x0000000, 0, 119 },           /* 187 "dou" */
+    { 0x0002000, 558, -1 },          /* 188 "dua" */
+    { 0x0002100, 559, -1 },          /* 189 "due" */
+    { 0x0000000, 0, 125 },           /* 190 "dui" */
+    { 0x0000000, 0, 126 },           /* 191 "dun" */
+    { 0x0000000, 0, 127 },           /* 192 "duo" */
+    { 0x0002000, 561, -1 },          /* 193 "fag" */
+    { 0x0000000, 0, 135 },           /* 194 "fai" */
+    { 0x0000040, 562, -1 },          /* 195 "fam" */
+    { 0x0000040, 563, 137 },         /* 196 "fan" */
+    { 0x0000000, 0, 139 },           /* 197 "fao" */
+    { 0x0002000, 564, -1 },          /* 198 "feg" */
+    { 0x0000000, 0, 142 },           /* 199 "fei" */
+    { 0x0000040, 565, -1 },          /* 200 "fem" */
+    { 0x0000040, 566, 144 },         /* 201 "fen" */
+    { 0x0000040, 567, 147 },         /* 202 "fon" */
+    { 0x0000000, 0, 149 },           /* 203 "fou" */
+    { 0x0002100, 568, 151 },         /* 204 "fua" */
+    { 0x0002100, 570, -1 },          /* 205 "fue" */
+    { 0x0000000, 0, 157 },           /* 206 "fui" */
+    { 0x0000000, 0, 158 },           /* 207 "fun" */
+    { 0x0000000, 0, 159 },           /* 208 "fuo" */
+    { 0x0002000, 572, -1 },          /* 209 "gag" */
+    { 0x0000000, 0, 163 },           /* 210 "gai" */
+    { 0x0000040, 573, -1 },          /* 211 "gam" */
+    { 0x0000040, 574, 165 },         /* 212 "gan" */
+    { 0x0000000, 0, 167 },           /* 213 "gao" */
+    { 0x0002000, 575, -1 },          /* 214 "geg" */
+    { 0x0000000, 0, 170 },           /* 215 "gei" */
+    { 0x0000040, 576, -1 },          /* 216 "gem" */
+    { 0x0000040, 577, 172 },         /* 217 "gen" */
+    { 0x0002000, 578, -1 },          /* 218 "gog" */
+    { 0x0000040, 579, -1 },          /* 219 "gom" */
+    { 0x0000040, 580, 176 },         /* 220 "gon" */
+    { 0x0000000, 0, 178 },           /* 221 "gou" */
+    { 0x0003140, 581, 180 },         /* 222 "gua" */
+    { 0x0002100, 585, -1 },          /* 223 "gue" */
+    { 0x0000000, 0, 188 },           /* 224 "gui" */
+    { 0x0000000, 0, 189 },           /* 225 "gun" */
+    { 0x0000000, 0, 190 },           /* 226 "guo" */
+    { 0x0002000, 587, -1 },          /* 227 "hag" */
+    { 0x0000000, 0, 194 },           /* 228 "hai" */
+    { 0x0000040, 588, -1 },          /* 229 "ham" */
+    { 0x0000040, 589, 196 },         /* 230 "han" */
+    { 0x0000000, 0, 198 },           /* 231 "hao" */
+    { 0x0002000, 590, -1 },          /* 232 "heg" */
+    { 0x0000000, 0, 201 },           /* 233 "hei" */
+    { 0x0000040, 591, -1 },          /* 234 "hem" */
+    { 0x0000040, 592, 203 },         /* 235 "hen" */
+    { 0x0002000, 593, -1 },          /* 236 "hog" */
+    { 0x0000040, 594, -1 },          /* 237 "hom" */
+    { 0x0000040, 595, 208 },         /* 238 "hon" */
+    { 0x0000000, 0, 210 },           /* 239 "hou" */
+    { 0x0003140, 596, 212 },         /* 240 "hua" */
+    { 0x0002100, 600, -1 },          /* 241 "hue" */
+    { 0x0000000, 0, 220 },           /* 242 "hui" */
+    { 0x0000000, 0, 221 },           /* 243 "hun" */
+    { 0x0000000, 0, 222 },           /* 244 "huo" */
+    { 0x0007040, 602, 225 },         /* 245 "jia" */
+    { 0x0000000, 0, 231 },           /* 246 "jie" */
+    { 0x0002000, 606, -1 },          /* 247 "jig" */
+    { 0x0000040, 607, -1 },          /* 248 "jim" */
+    { 0x0000040, 608, 234 },         /* 249 "jin" */
+    { 0x0103040, 609, -1 },          /* 250 "jio" */
+    { 0x0000000, 0, 241 },           /* 251 "jiu" */
+    { 0x0002000, 613, -1 },          /* 252 "jua" */
+    { 0x0002000, 614, 245 },         /* 253 "jue" */
+    { 0x0000000, 0, 247 },           /* 254 "jun" */
+    { 0x0002000, 615, -1 },          /* 255 "jva" */
+    { 0x0002000, 616, 251 },         /* 256 "jve" */
+    { 0x0000000, 0, 253 },           /* 257 "jvn" */
+    { 0x0002000, 617, -1 },          /* 258 "kag" */
+    { 0x0000000, 0, 257 },           /* 259 "kai" */
+    { 0x0000040, 618, -1 },          /* 260 "kam" */
+    { 0x0000040, 619, 259 },         /* 261 "kan" */
+    { 0x0000000, 0, 261 },           /* 262 "kao" */
+    { 0x0002000, 620, -1 },          /* 263 "keg" */
+    { 0x0000000, 0, 264 },           /* 264 "kei" */
+    { 0x0000040, 621, -1 },          /* 265 "kem" */
+    { 0x0000040, 622, 266 },         /* 266 "ken" */
+    { 0x0002000, 623, -1 },          /* 267 "kog" */
+    { 0x0000040, 624, -1 },          /* 268 "kom" */
+    { 0x0000040, 625, 270 },         /* 269 "kon" */
+    { 0x0000000, 0, 272 },           /* 270 "kou" */
+    { 0x0003140, 626, 274 },         /* 271 "kua" */
+    { 0x0002100, 630, -1 },          /* 272 "kue" */
+    { 0x0000000, 0, 282 },           /* 273 "kui" */
+    { 0x0000000, 0, 283 },           /* 274 "kun" */
+    { 0x0000000, 0, 284 },           /* 275 "kuo" */
+    { 0x0002000, 632, -1 },          /* 276 "lag" */
+    { 0x0000000, 0, 288 },           /* 277 "lai" */
+    { 0x0000040, 633, -1 },          /* 278 "lam" */
+    { 0x0000040, 634, 290 },         /* 279 "lan" */
+    { 0x0000000, 0, 292 },           /* 280 "lao" */
+    { 0x0002000, 635, -1 },          /* 281 "leg" */
+    { 0x0000000, 0, 295 },           /* 282 "lei" */
+    { 0x0000040, 636, -1 },          /* 283 "lem" */
+    { 0x0000040, 637, 297 },         /* 284 "len" */
+    { 0x0007040, 638, 300 },         /* 285 "lia" */
+    { 0x0000000, 0, 306 },           /* 286 "lie" */
+    { 0x0002000, 642, -1 },          /* 287 "lig" */
+    { 0x0000040, 643, -1 },          /* 288 "lim" */
+    { 0x0000040, 644, 309 },         /* 289 "lin" */
+    { 0x0100000, 645, -1 },          /* 290 "lio" */
+    { 0x0000000, 0, 312 },           /* 291 "liu" */
+    { 0x0002000, 646, -1 },          /* 292 "log" */
+    { 0x0000040, 647, -1 },          /* 293 "lom" */
+    { 0x0000040, 648, 316 },         /* 294 "lon" */
+    { 0x0000000, 0, 318 },           /* 295 "lou" */
+    { 0x0002000, 649, -1 },          /* 296 "lua" */
+    { 0x0002100, 650, 322 },         /* 297 "lue" */
+    { 0x0000000, 0, 325 },           /* 298 "lui" */
+    { 0x0000000, 0, 326 },           /* 299 "lun" */
+    { 0x0000000, 0, 327 },           /* 300 "luo" */
+    { 0x0000000, 0, 329 },           /* 301 "lve" */
+    { 0x0002000, 652, -1 },          /* 302 "mag" */
+    { 0x0000000, 0, 333 },           /* 303 "mai" */
+    { 0x0000040, 653, -1 },          /* 304 "mam" */
+    { 0x0000040, 654, 335 },         /* 305 "man" */
+    { 0x0000000, 0, 337 },           /* 306 "mao" */
+    { 0x0002000, 655, -1 },          /* 307 "meg" */
+    { 0x0000000, 0, 340 },           /* 308 "mei" */
+    { 0x0000040, 656, -1 },          /* 309 "mem" */
+    { 0x0000040, 657, 342 },         /* 310 "men" */
+    { 0x0006000, 658, -1 },          /* 311 "mia" */
+    { 0x0000000, 0, 348 },           /* 312 "mie" */
+    { 0x0002000, 660, -1 },          /* 313 "mig" */
+    { 0x0000040, 661, -1 },          /* 314 "mim" */
+    { 0x0000040, 662, 351 },         /* 315 "min" */
+    { 0x0100000, 663, -1 },          /* 316 "mio" */
+    { 0x0000000, 0, 354 },           /* 317 "miu" */
+    { 0x0000000, 0, 356 },           /* 318 "mou" */
+    { 0x0002000, 664, -1 },          /* 319 "nag" */
+    { 0x0000000, 0, 361 },           /* 320 "nai" */
+    { 0x0000040, 665, -1 },          /* 321 "nam" */
+    { 0x0000040, 666, 363 },         /* 322 "nan" */
+    { 0x0000000, 0, 365 },           /* 323 "nao" */
+    { 0x0002000, 667, -1 },          /* 324 "neg" */
+    { 0x0000000, 0, 368 },           /* 325 "nei" */
+    { 0x0000040, 668, -1 },          /* 326 "nem" */
+    { 0x0000040, 669, 370 },         /* 327 "nen" */
+    { 0x0007040, 670, 373 },         /* 328 "nia" */
+    { 0x0000000, 0, 379 },           /* 329 "nie" */
+    { 0x0002000, 674, -1 },          /* 330 "nig" */
+    { 0x0000040, 675, -1 },          /* 331 "nim" */
+    { 0x0000040, 676, 382 },         /* 332 "nin" */
+    { 0x0100000, 677, -1 },          /* 333 "nio" */
+    { 0x0000000, 0, 385 },           /* 334 "niu" */
+    { 0x0002000, 678, -1 },          /* 335 "nog" */
+    { 0x0000040, 679, -1 },          /* 336 "nom" */
+    { 0x0000040, 680, 389 },         /* 337 "non" */
+    { 0x0000000, 0, 391 },           /* 338 "nou" */
+    { 0x0002000, 681, -1 },          /* 339 "nua" */
+    { 0x0002000, 682, 395 },         /* 340 "nue" */
+    { 0x0000000, 0, 397 },           /* 341 "nun" */
+    { 0x0000000, 0, 398 },           /* 342 "nuo" */
+    { 0x0000000, 0, 400 },           /* 343 "nve" */
+    { 0x0002000, 683, -1 },          /* 344 "pag" */
+    { 0x0000000, 0, 406 },           /* 345 "pai" */
+    { 0x0000040, 684, -1 },          /* 346 "pam" */
+    { 0x0000040, 685, 408 },         /* 347 "pan" */
+    { 0x0000000, 0, 410 },           /* 348 "pao" */
+    { 0x0002000, 686, -1 },          /* 349 "peg" */
+    { 0x0000000, 0, 412 },           /* 350 "pei" */
+    { 0x0000040, 687, -1 },          /* 351 "pem" */
+    { 0x0000040, 688, 414 },         /* 352 "pen" */
+    { 0x0006000, 689, -1 },          /* 353 "pia" */
+    { 0x0000000, 0, 420 },           /* 354 "pie" */
+    { 0x0002000, 691, -1 },          /* 355 "pig" */
+    { 0x0000040, 692, -1 },          /* 356 "pim" */
+    { 0x0000040, 693, 423 },         /* 357 "pin" */
+    { 0x0000000, 0, 426 },           /* 358 "pou" */
+    { 0x0007040, 694, 430 },         /* 359 "qia" */
+    { 0x0000000, 0, 436 },           /* 360 "qie" */
+    { 0x0002000, 698, -1 },          /* 361 "qig" */
+    { 0x0000040, 699, -1 },          /* 362 "qim" */
+    { 0x0000040, 700, 439 },         /* 363 "qin" */
+    { 0x0103040, 701, -1 },          /* 364 "qio" */
+    { 0x0000000, 0, 446 },           /* 365 "qiu" */
+    { 0x0002000, 705, -1 },          /* 366 "qua" */
+    { 0x0002000, 706, 450 },         /* 367 "que" */
+    { 0x0000000, 0, 452 },           /* 368 "qun" */
+    { 0x0002000, 707, -1 },          /* 369 "qva" */
+    { 0x0002000, 708, 456 },         /* 370 "qve" */
+    { 0x0000000, 0, 458 },           /* 371 "qvn" */
+    { 0x0002000, 709, -1 },          /* 372 "rag" */
+    { 0x0000000, 0, 462 },           /* 373 "rai" */
+    { 0x0000040, 710, -1 },          /* 374 "ram" */
+    { 0x0000040, 711, 464 },         /* 375 "ran" */
+    { 0x0000000, 0, 466 },           /* 376 "rao" */
+    { 0x0002000, 712, -1 },          /* 377 "reg" */
+    { 0x0000000, 0, 469 },           /* 378 "rei" */
+    { 0x0000040, 713, -1 },          /* 379 "rem" */
+    { 0x0000040, 714, 471 },         /* 380 "ren" */
+    { 0x0006000, 715, 474 },         /* 381 "ria" */
+    { 0x0000000, 0, 478 },           /* 382 "rie" */
+    { 0x0000040, 717, 479 },         /* 383 "rin" */
+    { 0x0100000, 718, -1 },          /* 384 "rio" */
+    { 0x0000000, 0, 482 },           /* 385 "riu" */
+    { 0x0002000, 719, -1 },          /* 386 "rog" */
+    { 0x0000040, 720, -1 },          /* 387 "rom" */
+    { 0x0000040, 721, 486 },         /* 388 "ron" */
+    { 0x0000000, 0, 488 },           /* 389 "rou" */
+    { 0x0002000, 722, -1 },          /* 390 "rua" */
+    { 0x0002100, 723, 492 },         /* 391 "rue" */
+    { 0x0000000, 0, 495 },           /* 392 "rui" */
+    { 0x0000000, 0, 496 },           /* 393 "run" */
+    { 0x0000000, 0, 497 },           /* 394 "ruo" */
+    { 0x0000000, 0, 499 },           /* 395 "rve" */
+    { 0x0002000, 725, -1 },          /* 396 "sag" */
+    { 0x0000000, 0, 503 },           /* 397 "sai" */
+    { 0x0000040, 726, -1 },          /* 398 "sam" */
+    { 0x0000040, 727, 505 },         /* 399 "san" */
+    { 0x0000000, 0, 507 },           /* 400 "sao" */
+    { 0x0002000, 728, -1 },          /* 401 "seg" */
+    { 0x0000000, 0, 510 },           /* 402 "sei" */
+    { 0x0000040, 729, -1 },          /* 403 "sem" */
+    { 0x0000040, 730, 512 },         /* 404 "sen" */
+    { 0x0007140, 731, 515 },         /* 405 "sha" */
+    { 0x0003140, 736, 522 },         /* 406 "she" */
+    { 0x0000000, 0, 528 },           /* 407 "shi" */
+    { 0x0102000, 740, -1 },          /* 408 "sho" */
+    { 0x0006111, 742, 532 },         /* 409 "shu" */
+    { 0x0002000, 747, -1 },          /* 410 "sog" */
+    { 0x0000040, 748, -1 },          /* 411 "som" */
+    { 0x0000040, 749, 547 },         /* 412 "son" */
+    { 0x0000000, 0, 549 },           /* 413 "sou" */
+    { 0x0002100, 750, 551 },         /* 414 "sua" */
+    { 0x0002100, 752, -1 },          /* 415 "sue" */
+    { 0x0000000, 0, 557 },           /* 416 "sui" */
+    { 0x0000000, 0, 558 },           /* 417 "sun" */
+    { 0x0000000, 0, 559 },           /* 418 "suo" */
+    { 0x0002000, 754, -1 },          /* 419 "tag" */
+    { 0x0000000, 0, 563 },           /* 420 "tai" */
+    { 0x0000040, 755, -1 },          /* 421 "tam" */
+    { 0x0000040, 756, 565 },         /* 422 "tan" */
+    { 0x0000000, 0, 567 },           /* 423 "tao" */
+    { 0x0002000, 757, -1 },          /* 424 "teg" */
+    { 0x0000040, 758, -1 },          /* 425 "tem" */
+    { 0x0000040, 759, 571 },         /* 426 "ten" */
+    { 0x0006000, 760, -1 },          /* 427 "tia" */
+    { 0x0000000, 0, 577 },           /* 428 "tie" */
+    { 0x0002000, 762, -1 },          /* 429 "tig" */
+    { 0x0000040, 763, -1 },          /* 430 "tim" */
+    { 0x0000040, 764, 580 },         /* 431 "tin" */
+    { 0x0002000, 765, -1 },          /* 432 "tog" */
+    { 0x0000040, 766, -1 },          /* 433 "tom" */
+    { 0x0000040, 767, 584 },         /* 434 "ton" */
+    { 0x0000000, 0, 586 },           /* 435 "tou" */
+    { 0x0002000, 768, -1 },          /* 436 "tua" */
+    { 0x0002100, 769, -1 },          /* 437 "tue" */
+    { 0x0000000, 0, 592 },           /* 438 "tui" */
+    { 0x0000000, 0, 593 },           /* 439 "tun" */
+    { 0x0000000, 0, 594 },           /* 440 "tuo" */
+    { 0x0002000, 771, -1 },          /* 441 "wag" */
+    { 0x0000000, 0, 598 },           /* 442 "wai" */
+    { 0x0000040, 772, -1 },          /* 443 "wam" */
+    { 0x0000040, 773, 600 },         /* 444 "wan" */
+    { 0x0002000, 774, -1 },          /* 445 "weg" */
+    { 0x0000000, 0, 603 },           /* 446 "wei" */
+    { 0x0000040, 775, -1 },          /* 447 "wem" */
+    { 0x0000040, 776, 605 },         /* 448 "wen" */
+    { 0x0007040, 777, 611 },         /* 449 "xia" */
+    { 0x0000000, 0, 617 },           /* 450 "xie" */
+    { 0x0002000, 781, -1 },          /* 451 "xig" */
+    { 0x0000040, 782, -1 },          /* 452 "xim" */
+    { 0x0000040, 783, 620 },         /* 453 "xin" */
+    { 0x0103040, 784, -1 },          /* 454 "xio" */
+    { 0x0000000, 0, 627 },           /* 455 "xiu" */
+    { 0x0002000, 788, -1 },          /* 456 "xua" */
+    { 0x0002000, 789, 631 },         /* 457 "xue" */
+    { 0x0000000, 0, 633 },           /* 458 "xun" */
+    { 0x0002000, 790, -1 },          /* 459 "xva" */
+    { 0x0002000, 791, 637 },         /* 460 "xve" */
+    { 0x0000000, 0, 639 },           /* 461 "xvn" */
+    { 0x0002000, 792, -1 },          /* 462 "yag" */
+    { 0x0000040, 793, -1 },          /* 463 "yam" */
+    { 0x0000040, 794, 644 },         /* 464 "yan" */
+    { 0x0000000, 0, 646 },           /* 465 "yao" */
+    { 0x0002000, 795, -1 },          /* 466 "yig" */
+    { 0x0000040, 796, -1 },          /* 467 "yim" */
+    { 0x0000040, 797, 651 },         /* 468 "yin" */
+    { 0x0002000, 798, -1 },          /* 469 "yog" */
+    { 0x0000040, 799, -1 },          /* 470 "yom" */
+    { 0x0000040, 800, 656 },         /* 471 "yon" */
+    { 0x0000000, 0, 658 },           /* 472 "you" */
+    { 0x0002000, 801, -1 },          /* 473 "yua" */
+    { 0x0002000, 802, 662 },         /* 474 "yue" */
+    { 0x0000000, 0, 664 },           /* 475 "yun" */
+    { 0x0002000, 803, -1 },          /* 476 "yva" */
+    { 0x0002000, 804, 668 },         /* 477 "yve" */
+    { 0x0000000, 0, 670 },           /* 478 "yvn" */
+    { 0x0002000, 805, -1 },          /* 479 "zag" */
+    { 0x0000000, 0, 674 },           /* 480 "zai" */
+    { 0x0000040, 806, -1 },          /* 481 "zam" */
+    { 0x0000040, 807, 676 },         /* 482 "zan" */
+    { 0x0000000, 0, 678 },           /* 483 "zao" */
+    { 0x0002000, 808, -1 },          /* 484 "zeg" */
+    { 0x0000000, 0, 681 },           /* 485 "zei" */
+    { 0x0000040, 809, -1 },          /* 486 "zem" */
+    { 0x0000040, 810, 683 },         /* 487 "zen" */
+    { 0x0007140, 811, 686 },         /* 488 "zha" */
+    { 0x0003140, 816, 693 },         /* 489 "zhe" */
+    { 0x0000000, 0, 699 },           /* 490 "zhi" */
+    { 0x0103040, 820, -1 },          /* 491 "zho" */
+    { 0x0006111, 824, 705 },         /* 492 "zhu" */
+    { 0x0002000, 829, -1 },          /* 493 "zog" */
+    { 0x0000040, 830, -1 },          /* 494 "zom" */
+    { 0x0000040, 831, 720 },         /* 495 "zon" */
+    { 0x0000000, 0, 722 },           /* 496 "zou" */
+    { 0x0002100, 832, 724 },         /* 497 "zua" */
+    { 0x0002100, 834, -1 },          /* 498 "zue" */
+    { 0x0000000, 0, 730 },           /* 499 "zui" */
+    { 0x0000000, 0, 731 },           /* 500 "zun" */
+    { 0x0000000, 0, 732 },           /* 501 "zuo" */
+    { 0x0000000, 0, 9 },             /* 502 "bagn" */
+    { 0x0000000, 0, 11 },            /* 503 "bamg" */
+    { 0x0000000, 0, 13 },            /* 504 "bang" */
+    { 0x0000000, 0, 15 },            /* 505 "begn" */
+    { 0x0000000, 0, 17 },            /* 506 "bemg" */
+    { 0x0000000, 0, 19 },            /* 507 "beng" */
+    { 0x0000040, 836, 21 },          /* 508 "bian" */
+    { 0x0000000, 0, 23 },            /* 509 "biao" */
+    { 0x0000000, 0, 25 },            /* 510 "bign" */
+    { 0x0000000, 0, 26 },            /* 511 "bimg" */
+    { 0x0000000, 0, 28 },            /* 512 "bing" */
+    { 0x0000000, 0, 33 },            /* 513 "cagn" */
+    { 0x0000000, 0, 35 },            /* 514 "camg" */
+    { 0x0000000, 0, 37 },            /* 515 "cang" */
+    { 0x0000000, 0, 40 },            /* 516 "cegn" */
+    { 0x0000000, 0, 41 },            /* 517 "cemg" */
+    { 0x0000000, 0, 43 },            /* 518 "ceng" */
+    { 0x0002000, 837, -1 },          /* 519 "chag" */
+    { 0x0000000, 0, 47 },            /* 520 "chai" */
+    { 0x0000040, 838, -1 },          /* 521 "cham" */
+    { 0x0000040, 839, 49 },          /* 522 "chan" */
+    { 0x0000000, 0, 51 },            /* 523 "chao" */
+    { 0x0002000, 840, -1 },          /* 524 "cheg" */
+    { 0x0000040, 841, -1 },          /* 525 "chem" */
+    { 0x0000040, 842, 55 },          /* 526 "chen" */
+    { 0x0002000, 843, -1 },          /* 527 "chog" */
+    { 0x0000040, 844, -1 },          /* 528 "chom" */
+    { 0x0000040, 845, 60 },          /* 529 "chon" */
+    { 0x0000000, 0, 62 },            /* 530 "chou" */
+    { 0x0003140, 846, -1 },          /* 531 "chua" */
+    { 0x0002100, 850, -1 },          /* 532 "chue" */
+    { 0x0000000, 0, 71 },            /* 533 "chui" */
+    { 0x0000000, 0, 72 },            /* 534 "chun" */
+    { 0x0000000, 0, 73 },            /* 535 "chuo" */
+    { 0x0000000, 0, 75 },            /* 536 "cogn" */
+    { 0x0000000, 0, 76 },            /* 537 "comg" */
+    { 0x0000000, 0, 78 },            /* 538 "cong" */
+    { 0x0000000, 0, 81 },            /* 539 "cuai" */
+    { 0x0000040, 852, 82 },          /* 540 "cuan" */
+    { 0x0000000, 0, 84 },            /* 541 "cuei" */
+    { 0x0000000, 0, 85 },            /* 542 "cuen" */
+    { 0x0000000, 0, 91 },            /* 543 "dagn" */
+    { 0x0000000, 0, 93 },            /* 544 "damg" */
+    { 0x0000000, 0, 95 },            /* 545 "dang" */
+    { 0x0000000, 0, 98 },            /* 546 "degn" */
+    { 0x0000000, 0, 100 },           /* 547 "demg" */
+    { 0x0000000, 0, 102 },           /* 548 "deng" */
+    { 0x0000040, 853, 105 },         /* 549 "dian" */
+    { 0x0000000, 0, 107 },           /* 550 "diao" */
+    { 0x0000000, 0, 109 },           /* 551 "dign" */
+    { 0x0000000, 0, 110 },           /* 552 "dimg" */
+    { 0x0000000, 0, 112 },           /* 553 "ding" */
+    { 0x0000000, 0, 113 },           /* 554 "diou" */
+    { 0x0000000, 0, 115 },           /* 555 "dogn" */
+    { 0x0000000, 0, 116 },           /* 556 "domg" */
+    { 0x0000000, 0, 118 },           /* 557 "dong" */
+    { 0x0000040, 854, 121 },         /* 558 "duan" */
+    { 0x0000000, 0, 123 },           /* 559 "duei" */
+    { 0x0000000, 0, 124 },           /* 560 "duen" */
+    { 0x0000000, 0, 134 },           /* 561 "fagn" */
+    { 0x0000000, 0, 136 },           /* 562 "famg" */
+    { 0x0000000, 0, 138 },           /* 563 "fang" */
+    { 0x0000000, 0, 141 },           /* 564 "fegn" */
+    { 0x0000000, 0, 143 },           /* 565 "femg" */
+    { 0x0000000, 0, 145 },           /* 566 "feng" */
+    { 0x0000000, 0, 148 },           /* 567 "fong" */
+    { 0x0000000, 0, 152 },           /* 568 "fuai" */
+    { 0x0000040, 855, 153 },         /* 569 "fuan" */
+    { 0x0000000, 0, 155 },           /* 570 "fuei" */
+    { 0x0000000, 0, 156 },           /* 571 "fuen" */
+    { 0x0000000, 0, 162 },           /* 572 "gagn" */
+    { 0x0000000, 0, 164 },           /* 573 "gamg" */
+    { 0x0000000, 0, 166 },           /* 574 "gang" */
+    { 0x0000000, 0, 169 },           /* 575 "gegn" */
+    { 0x0000000, 0, 171 },           /* 576 "gemg" */
+    { 0x0000000, 0, 173 },           /* 577 "geng" */
+    { 0x0000000, 0, 174 },           /* 578 "gogn" */
+    { 0x0000000, 0, 175 },           /* 579 "gomg" */
+    { 0x0000000, 0, 177 },           /* 580 "gong" */
+    { 0x0002000, 856, -1 },          /* 581 "guag" */
+    { 0x0000000, 0, 182 },           /* 582 "guai" */
+    { 0x0000040, 857, -1 },          /* 583 "guam" */
+    { 0x0000040, 858, 184 },         /* 584 "guan" */
+    { 0x0000000, 0, 186 },           /* 585 "guei" */
+    { 0x0000000, 0, 187 },           /* 586 "guen" */
+    { 0x0000000, 0, 193 },           /* 587 "hagn" */
+    { 0x0000000, 0, 195 },           /* 588 "hamg" */
+    { 0x0000000, 0, 197 },           /* 589 "hang" */
+    { 0x0000000, 0, 200 },           /* 590 "hegn" */
+    { 0x0000000, 0, 202 },           /* 591 "hemg" */
+    { 0x0000000, 0, 204 },           /* 592 "heng" */
+    { 0x0000000, 0, 206 },           /* 593 "hogn" */
+    { 0x0000000, 0, 207 },           /* 594 "homg" */
+    { 0x0000000, 0, 209 },           /* 595 "hong" */
+    { 0x0002000, 859, -1 },          /* 596 "huag" */
+    { 0x0000000, 0, 214 },           /* 597 "huai" */
+    { 0x0000040, 860, -1 },          /* 598 "huam" */
+    { 0x0000040, 861, 216 },         /* 599 "huan" */
+    { 0x0000000, 0, 218 },           /* 600 "huei" */
+    { 0x0000000, 0, 219 },           /* 601 "huen" */
+    { 0x0002000, 862, -1 },          /* 602 "jiag" */
+    { 0x0000040, 863, -1 },          /* 603 "jiam" */
+    { 0x0000040, 864, 228 },         /* 604 "jian" */
+    { 0x0000000, 0, 230 },           /* 605 "jiao" */
+    { 0x0000000, 0, 232 },           /* 606 "jign" */
+    { 0x0000000, 0, 233 },           /* 607 "jimg" */
+    { 0x0000000, 0, 235 },           /* 608 "jing" */
+    { 0x0002000, 865, -1 },          /* 609 "jiog" */
+    { 0x0000040, 866, -1 },          /* 610 "jiom" */
+    { 0x0000040, 867, 238 },         /* 611 "jion" */
+    { 0x0000000, 0, 240 },           /* 612 "jiou" */
+    { 0x0000040, 868, 243 },         /* 613 "juan" */
+    { 0x0000000, 0, 246 },           /* 614 "juen" */
+    { 0x0000040, 869, 249 },         /* 615 "jvan" */
+    { 0x0000000, 0, 252 },           /* 616 "jven" */
+    { 0x0000000, 0, 256 },           /* 617 "kagn" */
+    { 0x0000000, 0, 258 },           /* 618 "kamg" */
+    { 0x0000000, 0, 260 },           /* 619 "kang" */
+    { 0x0000000, 0, 263 },           /* 620 "kegn" */
+    { 0x0000000, 0, 265 },           /* 621 "kemg" */
+    { 0x0000000, 0, 267 },           /* 622 "keng" */
+    { 0x0000000, 0, 268 },           /* 623 "kogn" */
+    { 0x0000000, 0, 269 },           /* 624 "komg" */
+    { 0x0000000, 0, 271 },           /* 625 "kong" */
+    { 0x0002000, 870, -1 },          /* 626 "kuag" */
+    { 0x0000000, 0, 276 },           /* 627 "kuai" */
+    { 0x0000040, 871, -1 },          /* 628 "kuam" */
+    { 0x0000040, 872, 278 },         /* 629 "kuan" */
+    { 0x0000000, 0, 280 },           /* 630 "kuei" */
+    { 0x0000000, 0, 281 },           /* 631 "kuen" */
+    { 0x0000000, 0, 287 },           /* 632 "lagn" */
+    { 0x0000000, 0, 289 },           /* 633 "lamg" */
+    { 0x0000000, 0, 291 },           /* 634 "lang" */
+    { 0x0000000, 0, 294 },           /* 635 "legn" */
+    { 0x0000000, 0, 296 },           /* 636 "lemg" */
+    { 0x0000000, 0, 298 },           /* 637 "leng" */
+    { 0x0002000, 873, -1 },          /* 638 "liag" */
+    { 0x0000040, 874, -1 },          /* 639 "liam" */
+    { 0x0000040, 875, 303 },         /* 640 "lian" */
+    { 0x0000000, 0, 305 },           /* 641 "liao" */
+    { 0x0000000, 0, 307 },           /* 642 "lign" */
+    { 0x0000000, 0, 308 },           /* 643 "limg" */
+    { 0x0000000, 0, 310 },           /* 644 "ling" */
+    { 0x0000000, 0, 311 },           /* 645 "liou" */
+    { 0x0000000, 0, 314 },           /* 646 "logn" */
+    { 0x0000000, 0, 315 },           /* 647 "lomg" */
+    { 0x0000000, 0, 317 },           /* 648 "long" */
+    { 0x0000040, 876, 320 },         /* 649 "luan" */
+    { 0x0000000, 0, 323 },           /* 650 "luei" */
+    { 0x0000000, 0, 324 },           /* 651 "luen" */
+    { 0x0000000, 0, 332 },           /* 652 "magn" */
+    { 0x0000000, 0, 334 },           /* 653 "mamg" */
+    { 0x0000000, 0, 336 },           /* 654 "mang" */
+    { 0x0000000, 0, 339 },           /* 655 "megn" */
+    { 0x0000000, 0, 341 },           /* 656 "memg" */
+    { 0x0000000, 0, 343 },           /* 657 "meng" */
+    { 0x0000040, 877, 345 },         /* 658 "mian" */
+    { 0x0000000, 0, 347 },           /* 659 "miao" */
+    { 0x0000000, 0, 349 },           /* 660 "mign" */
+    { 0x0000000, 0, 350 },           /* 661 "mimg" */
+    { 0x0000000, 0, 352 },           /* 662 "ming" */
+    { 0x0000000, 0, 353 },           /* 663 "miou" */
+    { 0x0000000, 0, 360 },           /* 664 "nagn" */
+    { 0x0000000, 0, 362 },           /* 665 "namg" */
+    { 0x0000000, 0, 364 },           /* 666 "nang" */
+    { 0x0000000, 0, 367 },           /* 667 "negn" */
+    { 0x0000000, 0, 369 },           /* 668 "nemg" */
+    { 0x0000000, 0, 371 },           /* 669 "neng" */
+    { 0x0002000, 878, -1 },          /* 670 "niag" */
+    { 0x0000040, 879, -1 },          /* 671 "niam" */
+    { 0x0000040, 880, 376 },         /* 672 "nian" */
+    { 0x0000000, 0, 378 },           /* 673 "niao" */
+    { 0x0000000, 0, 380 },           /* 674 "nign" */
+    { 0x0000000, 0, 381 },           /* 675 "nimg" */
+    { 0x0000000, 0, 383 },           /* 676 "ning" */
+    { 0x0000000, 0, 384 },           /* 677 "niou" */
+    { 0x0000000, 0, 387 },           /* 678 "nogn" */
+    { 0x0000000, 0, 388 },           /* 679 "nomg" */
+    { 0x0000000, 0, 390 },           /* 680 "nong" */
+    { 0x0000040, 881, 393 },         /* 681 "nuan" */
+    { 0x0000000, 0, 396 },           /* 682 "nuen" */
+    { 0x0000000, 0, 405 },           /* 683 "pagn" */
+    { 0x0000000, 0, 407 },           /* 684 "pamg" */
+    { 0x0000000, 0, 409 },           /* 685 "pang" */
+    { 0x0000000, 0, 411 },           /* 686 "pegn" */
+    { 0x0000000, 0, 413 },           /* 687 "pemg" */
+    { 0x0000000, 0, 415 },           /* 688 "peng" */
+    { 0x0000040, 882, 417 },         /* 689 "pian" */
+    { 0x0000000, 0, 419 },           /* 690 "piao" */
+    { 0x0000000, 0, 421 },           /* 691 "pign" */
+    { 0x0000000, 0, 422 },           /* 692 "pimg" */
+    { 0x0000000, 0, 424 },           /* 693 "ping" */
+    { 0x0002000, 883, -1 },          /* 694 "qiag" */
+    { 0x0000040, 884, -1 },          /* 695 "qiam" */
+    { 0x0000040, 885, 433 },         /* 696 "qian" */
+    { 0x0000000, 0, 435 },           /* 697 "qiao" */
+    { 0x0000000, 0, 437 },           /* 698 "qign" */
+    { 0x0000000, 0, 438 },           /* 699 "qimg" */
+    { 0x0000000, 0, 440 },           /* 700 "qing" */
+    { 0x0002000, 886, -1 },          /* 701 "qiog" */
+    { 0x0000040, 887, -1 },          /* 702 "qiom" */
+    { 0x0000040, 888, 443 },         /* 703 "qion" */
+    { 0x0000000, 0, 445 },           /* 704 "qiou" */
+    { 0x0000040, 889, 448 },         /* 705 "quan" */
+    { 0x0000000, 0, 451 },           /* 706 "quen" */
+    { 0x0000040, 890, 454 },         /* 707 "qvan" */
+    { 0x0000000, 0, 457 },           /* 708 "qven" */
+    { 0x0000000, 0, 461 },           /* 709 "ragn" */
+    { 0x0000000, 0, 463 },           /* 710 "ramg" */
+    { 0x0000000, 0, 465 },           /* 711 "rang" */
+    { 0x0000000, 0, 468 },           /* 712 "regn" */
+    { 0x0000000, 0, 470 },           /* 713 "remg" */
+    { 0x0000000, 0, 472 },           /* 714 "reng" */
+    { 0x0000040, 891, 475 },         /* 715 "rian" */
+    { 0x0000000, 0, 477 },           /* 716 "riao" */
+    { 0x0000000, 0, 480 },           /* 717 "ring" */
+    { 0x0000000, 0, 481 },           /* 718 "riou" */
+    { 0x0000000, 0, 484 },           /* 719 "rogn" */
+    { 0x0000000, 0, 485 },           /* 720 "romg" */
+    { 0x0000000, 0, 487 },           /* 721 "rong" */
+    { 0x0000040, 892, 490 },         /* 722 "ruan" */
+    { 0x0000000, 0, 493 },           /* 723 "ruei" */
+    { 0x0000000, 0, 494 },           /* 724 "ruen" */
+    { 0x0000000, 0, 502 },           /* 725 "sagn" */
+    { 0x0000000, 0, 504 },           /* 726 "samg" */
+    { 0x0000000, 0, 506 },           /* 727 "sang" */
+    { 0x0000000, 0, 509 },           /* 728 "segn" */
+    { 0x0000000, 0, 511 },           /* 729 "semg" */
+    { 0x0000000, 0, 513 },           /* 730 "seng" */
+    { 0x0002000, 893, -1 },          /* 731 "shag" */
+    { 0x0000000, 0, 517 },           /* 732 "shai" */
+    { 0x0000040, 894, -1 },          /* 733 "sham" */
+    { 0x0000040, 895, 519 },         /* 734 "shan" */
+    { 0x0000000, 0, 521 },           /* 735 "shao" */
+    { 0x0002000, 896, -1 },          /* 736 "sheg" */
+    { 0x0000000, 0, 524 },           /* 737 "shei" */
+    { 0x0000040, 897, -1 },          /* 738 "shem" */
+    { 0x0000040, 898, 526 },         /* 739 "shen" */
+    { 0x0000040, 899, 529 },         /* 740 "shon" */
+    { 0x0000000, 0, 531 },           /* 741 "shou" */
+    { 0x0003140, 900, 533 },         /* 742 "shua" */
+    { 0x0002100, 904, -1 },          /* 743 "shue" */
+    { 0x0000000, 0, 541 },           /* 744 "shui" */
+    { 0x0000000, 0, 542 },           /* 745 "shun" */
+    { 0x0000000, 0, 543 },           /* 746 "shuo" */
+    { 0x0000000, 0, 545 },           /* 747 "sogn" */
+    { 0x0000000, 0, 546 },           /* 748 "somg" */
+    { 0x0000000, 0, 548 },           /* 749 "song" */
+    { 0x0000000, 0, 552 },           /* 750 "suai" */
+    { 0x0000040, 906, 553 },         /* 751 "suan" */
+    { 0x0000000, 0, 555 },           /* 752 "suei" */
+    { 0x0000000, 0, 556 },           /* 753 "suen" */
+    { 0x0000000, 0, 562 },           /* 754 "tagn" */
+    { 0x0000000, 0, 564 },           /* 755 "tamg" */
+    { 0x0000000, 0, 566 },           /* 756 "tang" */
+    { 0x0000000, 0, 569 },           /* 757 "tegn" */
+    { 0x0000000, 0, 570 },           /* 758 "temg" */
+    { 0x0000000, 0, 572 },           /* 759 "teng" */
+    { 0x0000040, 907, 574 },         /* 760 "tian" */
+    { 0x0000000, 0, 576 },           /* 761 "tiao" */
+    { 0x0000000, 0, 578 },           /* 762 "tign" */
+    { 0x0000000, 0, 579 },           /* 763 "timg" */
+    { 0x0000000, 0, 581 },           /* 764 "ting" */
+    { 0x0000000, 0, 582 },           /* 765 "togn" */
+    { 0x0000000, 0, 583 },           /* 766 "tomg" */
+    { 0x0000000, 0, 585 },           /* 767 "tong" */
+    { 0x0000040, 908, 588 },         /* 768 "tuan" */
+    { 0x0000000, 0, 590 },           /* 769 "tuei" */
+    { 0x0000000, 0, 591 },           /* 770 "tuen" */
+    { 0x0000000, 0, 597 },           /* 771 "wagn" */
+    { 0x0000000, 0, 599 },           /* 772 "wamg" */
+    { 0x0000000, 0, 601 },           /* 773 "wang" */
+    { 0x0000000, 0, 602 },           /* 774 "wegn" */
+    { 0x0000000, 0, 604 },           /* 775 "wemg" */
+    { 0x0000000, 0, 606 },           /* 776 "weng" */
+    { 0x0002000, 909, -1 },          /* 777 "xiag" */
+    { 0x0000040, 910, -1 },          /* 778 "xiam" */
+    { 0x0000040, 911, 614 },         /* 779 "xian" */
+    { 0x0000000, 0, 616 },           /* 780 "xiao" */
+    { 0x0000000, 0, 618 },           /* 781 "xign" */
+    { 0x0000000, 0, 619 },           /* 782 "ximg" */
+    { 0x0000000, 0, 621 },           /* 783 "xing" */
+    { 0x0002000, 912, -1 },          /* 784 "xiog" */
+    { 0x0000040, 913, -1 },          /* 785 "xiom" */
+    { 0x0000040, 914, 624 },         /* 786 "xion" */
+    { 0x0000000, 0, 626 },           /* 787 "xiou" */
+    { 0x0000040, 915, 629 },         /* 788 "xuan" */
+    { 0x0000000, 0, 632 },           /* 789 "xuen" */
+    { 0x0000040, 916, 635 },         /* 790 "xvan" */
+    { 0x0000000, 0, 638 },           /* 791 "xven" */
+    { 0x0000000, 0, 642 },           /* 792 "yagn" */
+    { 0x0000000, 0, 643 },           /* 793 "yamg" */
+    { 0x0000000, 0, 645 },           /* 794 "yang" */
+    { 0x0000000, 0, 649 },           /* 795 "yign" */
+    { 0x0000000, 0, 650 },           /* 796 "yimg" */
+    { 0x0000000, 0, 652 },           /* 797 "ying" */
+    { 0x0000000, 0, 654 },           /* 798 "yogn" */
+    { 0x0000000, 0, 655 },           /* 799 "yomg" */
+    { 0x0000000, 0, 657 },           /* 800 "yong" */
+    { 0x0000040, 917, 660 },         /* 801 "yuan" */
+    { 0x0000000, 0, 663 },           /* 802 "yuen" */
+    { 0x0000040, 918, 666 },         /* 803 "yvan" */
+    { 0x0000000, 0, 669 },           /* 804 "yven" */
+    { 0x0000000, 0, 673 },           /* 805 "zagn" */
+    { 0x0000000, 0, 675 },           /* 806 "zamg" */
+    { 0x0000000, 0, 677 },           /* 807 "zang" */
+    { 0x0000000, 0, 680 },           /* 808 "zegn" */
+    { 0x0000000, 0, 682 },           /* 809 "zemg" */
+    { 0x0000000, 0, 684 },           /* 810 "zeng" */
+    { 0x0002000, 919, -1 },          /* 811 "zhag" */
+    { 0x0000000, 0, 688 },           /* 812 "zhai" */
+    { 0x0000040, 920, -1 },          /* 813 "zham" */
+    { 0x0000040, 921, 690 },         /* 814 "zhan" */
+    { 0x0000000, 0, 692 },           /* 815 "zhao" */
+    { 0x0002000, 922, -1 },          /* 816 "zheg" */
+    { 0x0000000, 0, 695 },           /* 817 "zhei" */
+    { 0x0000040, 923, -1 },          /* 818 "zhem" */
+    { 0x0000040, 924, 697 },         /* 819 "zhen" */
+    { 0x0002000, 925, -1 },          /* 820 "zhog" */
+    { 0x0000040, 926, -1 },          /* 821 "zhom" */
+    { 0x0000040, 927, 702 },         /* 822 "zhon" */
+    { 0x0000000, 0, 704 },           /* 823 "zhou" */
+    { 0x0003140, 928, 706 },         /* 824 "zhua" */
+    { 0x0002100, 932, -1 },          /* 825 "zhue" */
+    { 0x0000000, 0, 714 },           /* 826 "zhui" */
+    { 0x0000000, 0, 715 },           /* 827 "zhun" */
+    { 0x0000000, 0, 716 },           /* 828 "zhuo" */
+    { 0x0000000, 0, 718 },           /* 829 "zogn" */
+    { 0x0000000, 0, 719 },           /* 830 "zomg" */
+    { 0x0000000, 0, 721 },           /* 831 "zong" */
+    { 0x0000000, 0, 725 },           /* 832 "zuai" */
+    { 0x0000040, 934, 726 },         /* 833 "zuan" */
+    { 0x0000000, 0, 728 },           /* 834 "zuei" */
+    { 0x0000000, 0, 729 },           /* 835 "zuen" */
+    { 0x0000000, 0, 22 },            /* 836 "biang" */
+    { 0x0000000, 0, 46 },            /* 837 "chagn" */
+    { 0x0000000, 0, 48 },            /* 838 "chamg" */
+    { 0x0000000, 0, 50 },            /* 839 "chang" */
+    { 0x0000000, 0, 53 },            /* 840 "chegn" */
+    { 0x0000000, 0, 54 },            /* 841 "chemg" */
+    { 0x0000000, 0, 56 },            /* 842 "cheng" */
+    { 0x0000000, 0, 58 },            /* 843 "chogn" */
+    { 0x0000000, 0, 59 },            /* 844 "chomg" */
+    { 0x0000000, 0, 61 },            /* 845 "chong" */
+    { 0x0002000, 935, -1 },          /* 846 "chuag" */
+    { 0x0000000, 0, 65 },            /* 847 "chuai" */
+    { 0x0000040, 936, -1 },          /* 848 "chuam" */
+    { 0x0000040, 937, 67 },          /* 849 "chuan" */
+    { 0x0000000, 0, 69 },            /* 850 "chuei" */
+    { 0x0000000, 0, 70 },            /* 851 "chuen" */
+    { 0x0000000, 0, 83 },            /* 852 "cuang" */
+    { 0x0000000, 0, 106 },           /* 853 "diang" */
+    { 0x0000000, 0, 122 },           /* 854 "duang" */
+    { 0x0000000, 0, 154 },           /* 855 "fuang" */
+    { 0x0000000, 0, 181 },           /* 856 "guagn" */
+    { 0x0000000, 0, 183 },           /* 857 "guamg" */
+    { 0x0000000, 0, 185 },           /* 858 "guang" */
+    { 0x0000000, 0, 213 },           /* 859 "huagn" */
+    { 0x0000000, 0, 215 },           /* 860 "huamg" */
+    { 0x0000000, 0, 217 },           /* 861 "huang" */
+    { 0x0000000, 0, 226 },           /* 862 "jiagn" */
+    { 0x0000000, 0, 227 },           /* 863 "jiamg" */
+    { 0x0000000, 0, 229 },           /* 864 "jiang" */
+    { 0x0000000, 0, 236 },           /* 865 "jiogn" */
+    { 0x0000000, 0, 237 },           /* 866 "jiomg" */
+    { 0x0000000, 0, 239 },           /* 867 "jiong" */
+    { 0x0000000, 0, 244 },           /* 868 "juang" */
+    { 0x0000000, 0, 250 },           /* 869 "jvang" */
+    { 0x0000000, 0, 275 },           /* 870 "kuagn" */
+    { 0x0000000, 0, 277 },           /* 871 "kuamg" */
+    { 0x0000000, 0, 279 },           /* 872 "kuang" */
+    { 0x0000000, 0, 301 },           /* 873 "liagn" */
+    { 0x0000000, 0, 302 },           /* 874 "liamg" */
+    { 0x0000000, 0, 304 },           /* 875 "liang" */
+    { 0x0000000, 0, 321 },           /* 876 "luang" */
+    { 0x0000000, 0, 346 },           /* 877 "miang" */
+    { 0x0000000, 0, 374 },           /* 878 "niagn" */
+    { 0x0000000, 0, 375 },           /* 879 "niamg" */
+    { 0x0000000, 0, 377 },           /* 880 "niang" */
+    { 0x0000000, 0, 394 },           /* 881 "nuang" */
+    { 0x0000000, 0, 418 },           /* 882 "piang" */
+    { 0x0000000, 0, 431 },           /* 883 "qiagn" */
+    { 0x0000000, 0, 432 },           /* 884 "qiamg" */
+    { 0x0000000, 0, 434 },           /* 885 "qiang" */
+    { 0x0000000, 0, 441 },           /* 886 "qiogn" */
+    { 0x0000000, 0, 442 },           /* 887 "qiomg" */
+    { 0x0000000, 0, 444 },           /* 888 "qiong" */
+    { 0x0000000, 0, 449 },           /* 889 "quang" */
+    { 0x0000000, 0, 455 },           /* 890 "qvang" */
+    { 0x0000000, 0, 476 },           /* 891 "riang" */
+    { 0x0000000, 0, 491 },           /* 892 "ruang" */
+    { 0x0000000, 0, 516 },           /* 893 "shagn" */
+    { 0x0000000, 0, 518 },           /* 894 "shamg" */
+    { 0x0000000, 0, 520 },           /* 895 "shang" */
+    { 0x0000000, 0, 523 },           /* 896 "shegn" */
+    { 0x0000000, 0, 525 },           /* 897 "shemg" */
+    { 0x0000000, 0, 527 },           /* 898 "sheng" */
+    { 0x0000000, 0, 530 },           /* 899 "shong" */
+    { 0x0002000, 938, -1 },          /* 900 "shuag" */
+    { 0x0000000, 0, 535 },           /* 901 "shuai" */
+    { 0x0000040, 939, -1 },          /* 902 "shuam" */
+    { 0x0000040, 940, 537 },         /* 903 "shuan" */
+    { 0x0000000, 0, 539 },           /* 904 "shuei" */
+    { 0x0000000, 0, 540 },           /* 905 "shuen" */
+    { 0x0000000, 0, 554 },           /* 906 "suang" */
+    { 0x0000000, 0, 575 },           /* 907 "tiang" */
+    { 0x0000000, 0, 589 },           /* 908 "tuang" */
+    { 0x0000000, 0, 612 },           /* 909 "xiagn" */
+    { 0x0000000, 0, 613 },           /* 910 "xiamg" */
+    { 0x0000000, 0, 615 },           /* 911 "xiang" */
+    { 0x0000000, 0, 622 },           /* 912 "xiogn" */
+    { 0x0000000, 0, 623 },           /* 913 "xiomg" */
+    { 0x0000000, 0, 625 },           /* 914 "xiong" */
+    { 0x0000000, 0, 630 },           /* 915 "xuang" */
+    { 0x0000000, 0, 636 },           /* 916 "xvang" */
+    { 0x0000000, 0, 661 },           /* 917 "yuang" */
+    { 0x0000000, 0, 667 },           /* 918 "yvang" */
+    { 0x0000000, 0, 687 },           /* 919 "zhagn" */
+    { 0x0000000, 0, 689 },           /* 920 "zhamg" */
+    { 0x0000000, 0, 691 },           /* 921 "zhang" */
+    { 0x0000000, 0, 694 },           /* 922 "zhegn" */
+    { 0x0000000, 0, 696 },           /* 923 "zhemg" */
+    { 0x0000000, 0, 698 },           /* 924 "zheng" */
+    { 0x0000000, 0, 700 },           /* 925 "zhogn" */
+    { 0x0000000, 0, 701 },           /* 926 "zhomg" */
+    { 0x0000000, 0, 703 },           /* 927 "zhong" */
+    { 0x0002000, 941, -1 },          /* 928 "zhuag" */
+    { 0x0000000, 0, 708 },           /* 929 "zhuai" */
+    { 0x0000040, 942, -1 },          /* 930 "zhuam" */
+    { 0x0000040, 943, 710 },         /* 931 "zhuan" */
+    { 0x0000000, 0, 712 },           /* 932 "zhuei" */
+    { 0x0000000, 0, 713 },           /* 933 "zhuen" */
+    { 0x0000000, 0, 727 },           /* 934 "zuang" */
+    { 0x0000000, 0, 64 },            /* 935 "chuagn" */
+    { 0x0000000, 0, 66 },            /* 936 "chuamg" */
+    { 0x0000000, 0, 68 },            /* 937 "chuang" */
+    { 0x0000000, 0, 534 },           /* 938 "shuagn" */
+    { 0x0000000, 0, 536 },           /* 939 "shuamg" */
+    { 0x0000000, 0, 538 },           /* 940 "shuang" */
+    { 0x0000000, 0, 707 },           /* 941 "zhuagn" */
+    { 0x0000000, 0, 709 },           /* 942 "zhuamg" */
+    { 0x0000000, 0, 711 },           /* 943 "zhuang" */
+};
+
+static const gint16 sheng_yun_table[24][57] = {
+    {   /* "" */
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        0, 2, 4, 5, 6, 128, 129, 130, -1, 131, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, 401, -1, 402, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    },
+    {   /* "b" */
+        7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        8, 10, 12, 13, 14, -1, 16, 18, 19, -1, 20, -1,
+        21, 22, 23, 24, 27, 28, -1, -1, 29, -1, -1, 30,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    },
+    {   /* "c" */
+        31, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        32, 34, 36, 37, 38, 39, -1, 42, 43, -1, 74, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, 78, 79, 80,
+        -1, 81, 82, 83, -1, 86, 87, 88, -1,
+    },
+    {   /* "ch" */
+        44, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        45, 47, 49, 50, 51, 52, -1, 55, 56, -1, 57, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, 61, 62, 63,
+        -1, 65, 67, 68, -1, 71, 72, 73, -1,
+    },
+    {   /* "d" */
+        89, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        90, 92, 94, 95, 96, 97, 99, 101, 102, -1, 103, 104,
+        105, 106, 107, 108, 111, 112, -1, 114, -1, 118, 119, 120,
+        -1, -1, 121, 122, -1, 125, 126, 127, -1,
+    },
+    {   /* "f" */
+        132, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        133, 135, 137, 138, 139, 140, 142, 144, 145, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, 146, 148, 149, 150,
+        151, 152, 153, 154, -1, 157, 158, 159, -1,
+    },
+    {   /* "g" */
+        160, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        161, 163, 165, 166, 167, 168, 170, 172, 173, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, 177, 178, 179,
+        180, 182, 184, 185, -1, 188, 189, 190, -1,
+    },
+    {   /* "h" */
+        191, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        192, 194, 196, 197, 198, 199, 201, 203, 204, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, 205, 209, 210, 211,
+        212, 214, 216, 217, -1, 220, 221, 222, -1,
+    },
+    {   /* "j" */
+        223, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 224, 225,
+        228, 229, 230, 231, 234, 235, 239, 241, -1, -1, -1, 242,
+        -1, -1, 243, 244, 245, -1, 247, -1, 248,
+    },
+    {   /* "k" */
+        254, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        255, 257, 259, 260, 261, 262, 264, 266, 267, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, 271, 272, 273,
+        274, 276, 278, 279, -1, 282, 283, 284, -1,
+    },
+    {   /* "l" */
+        285, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        286, 288, 290, 291, 292, 293, 295, 297, 298, -1, 299, 300,
+        303, 304, 305, 306, 309, 310, -1, 312, 313, 317, 318, 319,
+        -1, -1, 320, 321, 329, 325, 326, 327, 328,
+    },
+    {   /* "m" */
+        330, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        331, 333, 335, 336, 337, 338, 340, 342, 343, -1, 344, -1,
+        345, 346, 347, 348, 351, 352, -1, 354, 355, -1, 356, 357,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    },
+    {   /* "n" */
+        358, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        359, 361, 363, 364, 365, 366, 368, 370, 371, -1, 372, 373,
+        376, 377, 378, 379, 382, 383, -1, 385, 386, 390, 391, 392,
+        -1, -1, 393, 394, 400, -1, 397, 398, 399,
+    },
+    {   /* "p" */
+        403, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        404, 406, 408, 409, 410, -1, 412, 414, 415, -1, 416, -1,
+        417, 418, 419, 420, 423, 424, -1, -1, 425, -1, 426, 427,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    },
+    {   /* "q" */
+        428, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 429, 430,
+        433, 434, 435, 436, 439, 440, 444, 446, -1, -1, -1, 447,
+        -1, -1, 448, 449, 450, -1, 452, -1, 453,
+    },
+    {   /* "r" */
+        459, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        460, 462, 464, 465, 466, 467, 469, 471, 472, -1, 473, 474,
+        475, 476, 477, 478, 479, 480, -1, 482, 483, 487, 488, 489,
+        -1, -1, 490, 491, 499, 495, 496, 497, 498,
+    },
+    {   /* "s" */
+        500, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        501, 503, 505, 506, 507, 508, 510, 512, 513, -1, 544, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, 548, 549, 550,
+        551, 552, 553, 554, -1, 557, 558, 559, -1,
+    },
+    {   /* "sh" */
+        514, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        515, 517, 519, 520, 521, 522, 524, 526, 527, -1, 528, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, 530, 531, 532,
+        533, 535, 537, 538, -1, 541, 542, 543, -1,
+    },
+    {   /* "t" */
+        560, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        561, 563, 565, 566, 567, 568, -1, 571, 572, -1, 573, -1,
+        574, 575, 576, 577, 580, 581, -1, -1, -1, 585, 586, 587,
+        -1, -1, 588, 589, -1, 592, 593, 594, -1,
+    },
+    {   /* "w" */
+        595, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        596, 598, 600, 601, -1, -1, 603, 605, 606, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, 607, -1, -1, 608,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    },
+    {   /* "x" */
+        609, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 610, 611,
+        614, 615, 616, 617, 620, 621, 625, 627, -1, -1, -1, 628,
+        -1, -1, 629, 630, 631, -1, 633, -1, 634,
+    },
+    {   /* "y" */
+        640, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        641, -1, 644, 645, 646, 647, -1, -1, -1, -1, 648, -1,
+        -1, -1, -1, -1, 651, 652, -1, -1, 653, 657, 658, 659,
+        -1, -1, 660, 661, 662, -1, 664, -1, 665,
+    },
+    {   /* "z" */
+        671, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        672, 674, 676, 677, 678, 679, 681, 683, 684, -1, 717, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, 721, 722, 723,
+        724, 725, 726, 727, -1, 730, 731, 732, -1,
+    },
+    {   /* "zh" */
+        685, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        686, 688, 690, 691, 692, 693, 695, 697, 698, -1, 699, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, 703, 704, 705,
+        706, 708, 710, 711, -1, 714, 715, 716, -1,
+    },
+};
+
+static const BopomofoTrieNode bopomofo_trie[] = {
+    { G_GUINT64_CONSTANT (0x1efeffffff), 1, -1 },    /* 0 "" */
+    { G_GUINT64_CONSTANT (0x0dee600000), 36, 7 },    /* 1 "ㄅ" */
+    { G_GUINT64_CONSTANT (0x0dfe600000), 47, 403 },  /* 2 "ㄆ" */
+    { G_GUINT64_CONSTANT (0x0dfee00000), 59, 330 },  /* 3 "ㄇ" */
+    { G_GUINT64_CONSTANT (0x09fee00000), 72, 132 },  /* 4 "ㄈ" */
+    { G_GUINT64_CONSTANT (0x0dfea00000), 84, 89 },   /* 5 "ㄉ" */
+    { G_GUINT64_CONSTANT (0x0dfaa00000), 96, 560 },  /* 6 "ㄊ" */
+    { G_GUINT64_CONSTANT (0x1dfee00000), 107, 358 }, /* 7 "ㄋ" */
+    { G_GUINT64_CONSTANT (0x1dfee00000), 121, 285 }, /* 8 "ㄌ" */
+    { G_GUINT64_CONSTANT (0x09fea00000), 135, 160 }, /* 9 "ㄍ" */
+    { G_GUINT64_CONSTANT (0x09fea00000), 146, 254 }, /* 10 "ㄎ" */
+    { G_GUINT64_CONSTANT (0x09fee00000), 157, 191 }, /* 11 "ㄏ" */
+    { G_GUINT64_CONSTANT (0x1400000000), 169, 223 }, /* 12 "ㄐ" */
+    { G_GUINT64_CONSTANT (0x1400000000), 171, 428 }, /* 13 "ㄑ" */
+    { G_GUINT64_CONSTANT (0x1400000000), 173, 609 }, /* 14 "ㄒ" */
+    { G_GUINT64_CONSTANT (0x09fea00000), 175, 699 }, /* 15 "ㄓ" */
+    { G_GUINT64_CONSTANT (0x09faa00000), 186, 57 },  /* 16 "ㄔ" */
+    { G_GUINT64_CONSTANT (0x09fea00000), 196, 528 }, /* 17 "ㄕ" */
+    { G_GUINT64_CONSTANT (0x1dfee00000), 207, 473 }, /* 18 "ㄖ" */
+    { G_GUINT64_CONSTANT (0x09fea00000), 221, 717 }, /* 19 "ㄗ" */
+    { G_GUINT64_CONSTANT (0x09faa00000), 232, 74 },  /* 20 "ㄘ" */
+    { G_GUINT64_CONSTANT (0x09fea00000), 242, 544 }, /* 21 "ㄙ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 0 },     /* 22 "ㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 401 },   /* 23 "ㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 128 },   /* 24 "ㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 2 },     /* 25 "ㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 129 },   /* 26 "ㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 6 },     /* 27 "ㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 402 },   /* 28 "ㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 4 },     /* 29 "ㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 130 },   /* 30 "ㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 5 },     /* 31 "ㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 131 },   /* 32 "ㄦ" */
+    { G_GUINT64_CONSTANT (0x11f9600000), 253, 648 }, /* 33 "ㄧ" */
+    { G_GUINT64_CONSTANT (0x01e6600000), 263, 608 }, /* 34 "ㄨ" */
+    { G_GUINT64_CONSTANT (0x0161000000), 271, 659 }, /* 35 "ㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 8 },     /* 36 "ㄅㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 29 },    /* 37 "ㄅㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 10 },    /* 38 "ㄅㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 16 },    /* 39 "ㄅㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 14 },    /* 40 "ㄅㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 12 },    /* 41 "ㄅㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 18 },    /* 42 "ㄅㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 13 },    /* 43 "ㄅㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 19 },    /* 44 "ㄅㄥ" */
+    { G_GUINT64_CONSTANT (0x01e9000000), 275, 20 },  /* 45 "ㄅㄧ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 30 },    /* 46 "ㄅㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 404 },   /* 47 "ㄆㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 425 },   /* 48 "ㄆㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 406 },   /* 49 "ㄆㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 412 },   /* 50 "ㄆㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 410 },   /* 51 "ㄆㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 426 },   /* 52 "ㄆㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 408 },   /* 53 "ㄆㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 414 },   /* 54 "ㄆㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 409 },   /* 55 "ㄆㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 415 },   /* 56 "ㄆㄥ" */
+    { G_GUINT64_CONSTANT (0x01e9000000), 281, 416 }, /* 57 "ㄆㄧ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 427 },   /* 58 "ㄆㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 331 },   /* 59 "ㄇㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 355 },   /* 60 "ㄇㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 338 },   /* 61 "ㄇㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 333 },   /* 62 "ㄇㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 340 },   /* 63 "ㄇㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 337 },   /* 64 "ㄇㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 356 },   /* 65 "ㄇㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 335 },   /* 66 "ㄇㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 342 },   /* 67 "ㄇㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 336 },   /* 68 "ㄇㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 343 },   /* 69 "ㄇㄥ" */
+    { G_GUINT64_CONSTANT (0x01f9000000), 287, 344 }, /* 70 "ㄇㄧ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 357 },   /* 71 "ㄇㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 133 },   /* 72 "ㄈㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 146 },   /* 73 "ㄈㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 140 },   /* 74 "ㄈㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 135 },   /* 75 "ㄈㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 142 },   /* 76 "ㄈㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 139 },   /* 77 "ㄈㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 149 },   /* 78 "ㄈㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 137 },   /* 79 "ㄈㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 144 },   /* 80 "ㄈㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 138 },   /* 81 "ㄈㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 145 },   /* 82 "ㄈㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000), 294, 150 }, /* 83 "ㄈㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 90 },    /* 84 "ㄉㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 97 },    /* 85 "ㄉㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 92 },    /* 86 "ㄉㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 99 },    /* 87 "ㄉㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 96 },    /* 88 "ㄉㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 119 },   /* 89 "ㄉㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 94 },    /* 90 "ㄉㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 101 },   /* 91 "ㄉㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 95 },    /* 92 "ㄉㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 102 },   /* 93 "ㄉㄥ" */
+    { G_GUINT64_CONSTANT (0x01f9200000), 302, 103 }, /* 94 "ㄉㄧ" */
+    { G_GUINT64_CONSTANT (0x01e4400000), 310, 120 }, /* 95 "ㄉㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 561 },   /* 96 "ㄊㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 568 },   /* 97 "ㄊㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 563 },   /* 98 "ㄊㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 567 },   /* 99 "ㄊㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 586 },   /* 100 "ㄊㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 565 },   /* 101 "ㄊㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 571 },   /* 102 "ㄊㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 566 },   /* 103 "ㄊㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 572 },   /* 104 "ㄊㄥ" */
+    { G_GUINT64_CONSTANT (0x01e9000000), 316, 573 }, /* 105 "ㄊㄧ" */
+    { G_GUINT64_CONSTANT (0x01e4400000), 322, 587 }, /* 106 "ㄊㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 359 },   /* 107 "ㄋㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 386 },   /* 108 "ㄋㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 366 },   /* 109 "ㄋㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 361 },   /* 110 "ㄋㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 368 },   /* 111 "ㄋㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 365 },   /* 112 "ㄋㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 391 },   /* 113 "ㄋㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 363 },   /* 114 "ㄋㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 370 },   /* 115 "ㄋㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 364 },   /* 116 "ㄋㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 371 },   /* 117 "ㄋㄥ" */
+    { G_GUINT64_CONSTANT (0x01f9200000), 328, 372 }, /* 118 "ㄋㄧ" */
+    { G_GUINT64_CONSTANT (0x01e0400000), 336, 392 }, /* 119 "ㄋㄨ" */
+    { G_GUINT64_CONSTANT (0x0001000000), 341, 399 }, /* 120 "ㄋㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 286 },   /* 121 "ㄌㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 313 },   /* 122 "ㄌㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 293 },   /* 123 "ㄌㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 288 },   /* 124 "ㄌㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 295 },   /* 125 "ㄌㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 292 },   /* 126 "ㄌㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 318 },   /* 127 "ㄌㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 290 },   /* 128 "ㄌㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 297 },   /* 129 "ㄌㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 291 },   /* 130 "ㄌㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 298 },   /* 131 "ㄌㄥ" */
+    { G_GUINT64_CONSTANT (0x01f9200000), 342, 299 }, /* 132 "ㄌㄧ" */
+    { G_GUINT64_CONSTANT (0x01e4400000), 350, 319 }, /* 133 "ㄌㄨ" */
+    { G_GUINT64_CONSTANT (0x0001000000), 356, 328 }, /* 134 "ㄌㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 161 },   /* 135 "ㄍㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 168 },   /* 136 "ㄍㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 163 },   /* 137 "ㄍㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 170 },   /* 138 "ㄍㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 167 },   /* 139 "ㄍㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 178 },   /* 140 "ㄍㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 165 },   /* 141 "ㄍㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 172 },   /* 142 "ㄍㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 166 },   /* 143 "ㄍㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 173 },   /* 144 "ㄍㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000), 357, 179 }, /* 145 "ㄍㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 255 },   /* 146 "ㄎㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 262 },   /* 147 "ㄎㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 257 },   /* 148 "ㄎㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 264 },   /* 149 "ㄎㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 261 },   /* 150 "ㄎㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 272 },   /* 151 "ㄎㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 259 },   /* 152 "ㄎㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 266 },   /* 153 "ㄎㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 260 },   /* 154 "ㄎㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 267 },   /* 155 "ㄎㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000), 365, 273 }, /* 156 "ㄎㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 192 },   /* 157 "ㄏㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 205 },   /* 158 "ㄏㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 199 },   /* 159 "ㄏㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 194 },   /* 160 "ㄏㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 201 },   /* 161 "ㄏㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 198 },   /* 162 "ㄏㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 210 },   /* 163 "ㄏㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 196 },   /* 164 "ㄏㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 203 },   /* 165 "ㄏㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 197 },   /* 166 "ㄏㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 204 },   /* 167 "ㄏㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000), 373, 211 }, /* 168 "ㄏㄨ" */
+    { G_GUINT64_CONSTANT (0x01f9200000), 381, 224 }, /* 169 "ㄐㄧ" */
+    { G_GUINT64_CONSTANT (0x01e1000000), 389, 242 }, /* 170 "ㄐㄩ" */
+    { G_GUINT64_CONSTANT (0x01f9200000), 394, 429 }, /* 171 "ㄑㄧ" */
+    { G_GUINT64_CONSTANT (0x01e1000000), 402, 447 }, /* 172 "ㄑㄩ" */
+    { G_GUINT64_CONSTANT (0x01f9200000), 407, 610 }, /* 173 "ㄒㄧ" */
+    { G_GUINT64_CONSTANT (0x01e1000000), 415, 628 }, /* 174 "ㄒㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 686 },   /* 175 "ㄓㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 693 },   /* 176 "ㄓㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 688 },   /* 177 "ㄓㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 695 },   /* 178 "ㄓㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 692 },   /* 179 "ㄓㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 704 },   /* 180 "ㄓㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 690 },   /* 181 "ㄓㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 697 },   /* 182 "ㄓㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 691 },   /* 183 "ㄓㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 698 },   /* 184 "ㄓㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000), 420, 705 }, /* 185 "ㄓㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 45 },    /* 186 "ㄔㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 52 },    /* 187 "ㄔㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 47 },    /* 188 "ㄔㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 51 },    /* 189 "ㄔㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 62 },    /* 190 "ㄔㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 49 },    /* 191 "ㄔㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 55 },    /* 192 "ㄔㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 50 },    /* 193 "ㄔㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 56 },    /* 194 "ㄔㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6400000), 428, 63 },  /* 195 "ㄔㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 515 },   /* 196 "ㄕㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 522 },   /* 197 "ㄕㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 517 },   /* 198 "ㄕㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 524 },   /* 199 "ㄕㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 521 },   /* 200 "ㄕㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 531 },   /* 201 "ㄕㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 519 },   /* 202 "ㄕㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 526 },   /* 203 "ㄕㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 520 },   /* 204 "ㄕㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 527 },   /* 205 "ㄕㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000), 435, 532 }, /* 206 "ㄕㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 460 },   /* 207 "ㄖㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 483 },   /* 208 "ㄖㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 467 },   /* 209 "ㄖㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 462 },   /* 210 "ㄖㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 469 },   /* 211 "ㄖㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 466 },   /* 212 "ㄖㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 488 },   /* 213 "ㄖㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 464 },   /* 214 "ㄖㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 471 },   /* 215 "ㄖㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 465 },   /* 216 "ㄖㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 472 },   /* 217 "ㄖㄥ" */
+    { G_GUINT64_CONSTANT (0x01f9200000), 443, -1 },  /* 218 "ㄖㄧ" */
+    { G_GUINT64_CONSTANT (0x01e4400000), 451, 489 }, /* 219 "ㄖㄨ" */
+    { G_GUINT64_CONSTANT (0x0001000000), 457, 498 }, /* 220 "ㄖㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 672 },   /* 221 "ㄗㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 679 },   /* 222 "ㄗㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 674 },   /* 223 "ㄗㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 681 },   /* 224 "ㄗㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 678 },   /* 225 "ㄗㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 722 },   /* 226 "ㄗㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 676 },   /* 227 "ㄗㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 683 },   /* 228 "ㄗㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 677 },   /* 229 "ㄗㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 684 },   /* 230 "ㄗㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000), 458, 723 }, /* 231 "ㄗㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 32 },    /* 232 "ㄘㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 39 },    /* 233 "ㄘㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 34 },    /* 234 "ㄘㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 38 },    /* 235 "ㄘㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 79 },    /* 236 "ㄘㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 36 },    /* 237 "ㄘㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 42 },    /* 238 "ㄘㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 37 },    /* 239 "ㄘㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 43 },    /* 240 "ㄘㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6400000), 466, 80 },  /* 241 "ㄘㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 501 },   /* 242 "ㄙㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 508 },   /* 243 "ㄙㄜ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 503 },   /* 244 "ㄙㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 510 },   /* 245 "ㄙㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 507 },   /* 246 "ㄙㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 549 },   /* 247 "ㄙㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 505 },   /* 248 "ㄙㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 512 },   /* 249 "ㄙㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 506 },   /* 250 "ㄙㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 513 },   /* 251 "ㄙㄥ" */
+    { G_GUINT64_CONSTANT (0x01e6600000), 473, 550 }, /* 252 "ㄙㄨ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 641 },   /* 253 "ㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 653 },   /* 254 "ㄧㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 647 },   /* 255 "ㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 646 },   /* 256 "ㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 658 },   /* 257 "ㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 644 },   /* 258 "ㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 651 },   /* 259 "ㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 645 },   /* 260 "ㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 652 },   /* 261 "ㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0080000000), 481, -1 },  /* 262 "ㄧㄩ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 596 },   /* 263 "ㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 607 },   /* 264 "ㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 598 },   /* 265 "ㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 603 },   /* 266 "ㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 600 },   /* 267 "ㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 605 },   /* 268 "ㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 601 },   /* 269 "ㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 606 },   /* 270 "ㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 662 },   /* 271 "ㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 660 },   /* 272 "ㄩㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 664 },   /* 273 "ㄩㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 657 },   /* 274 "ㄩㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 24 },    /* 275 "ㄅㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 23 },    /* 276 "ㄅㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 21 },    /* 277 "ㄅㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 27 },    /* 278 "ㄅㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 22 },    /* 279 "ㄅㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 28 },    /* 280 "ㄅㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 420 },   /* 281 "ㄆㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 419 },   /* 282 "ㄆㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 417 },   /* 283 "ㄆㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 423 },   /* 284 "ㄆㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 418 },   /* 285 "ㄆㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 424 },   /* 286 "ㄆㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 348 },   /* 287 "ㄇㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 347 },   /* 288 "ㄇㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 354 },   /* 289 "ㄇㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 345 },   /* 290 "ㄇㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 351 },   /* 291 "ㄇㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 346 },   /* 292 "ㄇㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 352 },   /* 293 "ㄇㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 151 },   /* 294 "ㄈㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 159 },   /* 295 "ㄈㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 152 },   /* 296 "ㄈㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 157 },   /* 297 "ㄈㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 153 },   /* 298 "ㄈㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 158 },   /* 299 "ㄈㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 154 },   /* 300 "ㄈㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 148 },   /* 301 "ㄈㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 104 },   /* 302 "ㄉㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 108 },   /* 303 "ㄉㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 107 },   /* 304 "ㄉㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 114 },   /* 305 "ㄉㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 105 },   /* 306 "ㄉㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 111 },   /* 307 "ㄉㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 106 },   /* 308 "ㄉㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 112 },   /* 309 "ㄉㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 127 },   /* 310 "ㄉㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 125 },   /* 311 "ㄉㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 121 },   /* 312 "ㄉㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 126 },   /* 313 "ㄉㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 122 },   /* 314 "ㄉㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 118 },   /* 315 "ㄉㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 577 },   /* 316 "ㄊㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 576 },   /* 317 "ㄊㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 574 },   /* 318 "ㄊㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 580 },   /* 319 "ㄊㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 575 },   /* 320 "ㄊㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 581 },   /* 321 "ㄊㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 594 },   /* 322 "ㄊㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 592 },   /* 323 "ㄊㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 588 },   /* 324 "ㄊㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 593 },   /* 325 "ㄊㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 589 },   /* 326 "ㄊㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 585 },   /* 327 "ㄊㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 373 },   /* 328 "ㄋㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 379 },   /* 329 "ㄋㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 378 },   /* 330 "ㄋㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 385 },   /* 331 "ㄋㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 376 },   /* 332 "ㄋㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 382 },   /* 333 "ㄋㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 377 },   /* 334 "ㄋㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 383 },   /* 335 "ㄋㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 398 },   /* 336 "ㄋㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 393 },   /* 337 "ㄋㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 397 },   /* 338 "ㄋㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 394 },   /* 339 "ㄋㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 390 },   /* 340 "ㄋㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 400 },   /* 341 "ㄋㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 300 },   /* 342 "ㄌㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 306 },   /* 343 "ㄌㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 305 },   /* 344 "ㄌㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 312 },   /* 345 "ㄌㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 303 },   /* 346 "ㄌㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 309 },   /* 347 "ㄌㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 304 },   /* 348 "ㄌㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 310 },   /* 349 "ㄌㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 327 },   /* 350 "ㄌㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 325 },   /* 351 "ㄌㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 320 },   /* 352 "ㄌㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 326 },   /* 353 "ㄌㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 321 },   /* 354 "ㄌㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 317 },   /* 355 "ㄌㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 329 },   /* 356 "ㄌㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 180 },   /* 357 "ㄍㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 190 },   /* 358 "ㄍㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 182 },   /* 359 "ㄍㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 188 },   /* 360 "ㄍㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 184 },   /* 361 "ㄍㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 189 },   /* 362 "ㄍㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 185 },   /* 363 "ㄍㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 177 },   /* 364 "ㄍㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 274 },   /* 365 "ㄎㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 284 },   /* 366 "ㄎㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 276 },   /* 367 "ㄎㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 282 },   /* 368 "ㄎㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 278 },   /* 369 "ㄎㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 283 },   /* 370 "ㄎㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 279 },   /* 371 "ㄎㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 271 },   /* 372 "ㄎㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 212 },   /* 373 "ㄏㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 222 },   /* 374 "ㄏㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 214 },   /* 375 "ㄏㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 220 },   /* 376 "ㄏㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 216 },   /* 377 "ㄏㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 221 },   /* 378 "ㄏㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 217 },   /* 379 "ㄏㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 209 },   /* 380 "ㄏㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 225 },   /* 381 "ㄐㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 231 },   /* 382 "ㄐㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 230 },   /* 383 "ㄐㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 241 },   /* 384 "ㄐㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 228 },   /* 385 "ㄐㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 234 },   /* 386 "ㄐㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 229 },   /* 387 "ㄐㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 235 },   /* 388 "ㄐㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 245 },   /* 389 "ㄐㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 243 },   /* 390 "ㄐㄩㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 247 },   /* 391 "ㄐㄩㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 244 },   /* 392 "ㄐㄩㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 239 },   /* 393 "ㄐㄩㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 430 },   /* 394 "ㄑㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 436 },   /* 395 "ㄑㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 435 },   /* 396 "ㄑㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 446 },   /* 397 "ㄑㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 433 },   /* 398 "ㄑㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 439 },   /* 399 "ㄑㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 434 },   /* 400 "ㄑㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 440 },   /* 401 "ㄑㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 450 },   /* 402 "ㄑㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 448 },   /* 403 "ㄑㄩㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 452 },   /* 404 "ㄑㄩㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 449 },   /* 405 "ㄑㄩㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 444 },   /* 406 "ㄑㄩㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 611 },   /* 407 "ㄒㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 617 },   /* 408 "ㄒㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 616 },   /* 409 "ㄒㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 627 },   /* 410 "ㄒㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 614 },   /* 411 "ㄒㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 620 },   /* 412 "ㄒㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 615 },   /* 413 "ㄒㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 621 },   /* 414 "ㄒㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 631 },   /* 415 "ㄒㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 629 },   /* 416 "ㄒㄩㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 633 },   /* 417 "ㄒㄩㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 630 },   /* 418 "ㄒㄩㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 625 },   /* 419 "ㄒㄩㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 706 },   /* 420 "ㄓㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 716 },   /* 421 "ㄓㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 708 },   /* 422 "ㄓㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 714 },   /* 423 "ㄓㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 710 },   /* 424 "ㄓㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 715 },   /* 425 "ㄓㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 711 },   /* 426 "ㄓㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 703 },   /* 427 "ㄓㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 73 },    /* 428 "ㄔㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 65 },    /* 429 "ㄔㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 71 },    /* 430 "ㄔㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 67 },    /* 431 "ㄔㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 72 },    /* 432 "ㄔㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 68 },    /* 433 "ㄔㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 61 },    /* 434 "ㄔㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 533 },   /* 435 "ㄕㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 543 },   /* 436 "ㄕㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 535 },   /* 437 "ㄕㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 541 },   /* 438 "ㄕㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 537 },   /* 439 "ㄕㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 542 },   /* 440 "ㄕㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 538 },   /* 441 "ㄕㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 530 },   /* 442 "ㄕㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 474 },   /* 443 "ㄖㄧㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 478 },   /* 444 "ㄖㄧㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 477 },   /* 445 "ㄖㄧㄠ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 482 },   /* 446 "ㄖㄧㄡ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 475 },   /* 447 "ㄖㄧㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 479 },   /* 448 "ㄖㄧㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 476 },   /* 449 "ㄖㄧㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 480 },   /* 450 "ㄖㄧㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 497 },   /* 451 "ㄖㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 495 },   /* 452 "ㄖㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 490 },   /* 453 "ㄖㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 496 },   /* 454 "ㄖㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 491 },   /* 455 "ㄖㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 487 },   /* 456 "ㄖㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 499 },   /* 457 "ㄖㄩㄝ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 724 },   /* 458 "ㄗㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 732 },   /* 459 "ㄗㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 725 },   /* 460 "ㄗㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 730 },   /* 461 "ㄗㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 726 },   /* 462 "ㄗㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 731 },   /* 463 "ㄗㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 727 },   /* 464 "ㄗㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 721 },   /* 465 "ㄗㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 88 },    /* 466 "ㄘㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 81 },    /* 467 "ㄘㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 86 },    /* 468 "ㄘㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 82 },    /* 469 "ㄘㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 87 },    /* 470 "ㄘㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 83 },    /* 471 "ㄘㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 78 },    /* 472 "ㄘㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 551 },   /* 473 "ㄙㄨㄚ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 559 },   /* 474 "ㄙㄨㄛ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 552 },   /* 475 "ㄙㄨㄞ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 557 },   /* 476 "ㄙㄨㄟ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 553 },   /* 477 "ㄙㄨㄢ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 558 },   /* 478 "ㄙㄨㄣ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 554 },   /* 479 "ㄙㄨㄤ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 548 },   /* 480 "ㄙㄨㄥ" */
+    { G_GUINT64_CONSTANT (0x0000000000), 0, 661 },   /* 481 "ㄧㄩㄤ" */
 };
 
 static const Pinyin *special_table[][4] = {
@@ -8087,3 +9208,138 @@ static const Pinyin *special_table[][4] = {
     { &pinyin_table[731],  &pinyin_table[128],  &pinyin_table[723],  &pinyin_table[366],  }, /* zun e => zu ne */
     { &pinyin_table[731],  &pinyin_table[129],  &pinyin_table[723],  &pinyin_table[368],  }, /* zun ei => zu nei */
 };
+
+static const guint16 special_displacement[] = {
+    18, 3, 3, 0, 2, 4, 6, 9, 10, 14, 0, 4,
+    0, 8, 2, 10, 0, 11, 7, 5, 0, 4, 1, 2,
+    5, 7, 11, 65, 73, 0, 1, 3, 2, 10, 0, 16,
+    3, 0, 18, 11, 1, 2, 0, 5, 5, 6, 8, 2,
+    3, 2, 5, 61, 10, 2, 0, 3, 11, 14, 15, 0,
+    0, 9, 3, 8, 4, 2, 1, 0, 3, 19, 0, 5,
+    4, 0, 4, 3, 9, 2, 9, 0, 72, 85, 73, 0,
+    2, 1, 8, 88, 6, 8, 7, 66, 79, 4, 1, 2,
+    0, 1, 26, 5, 11, 24, 2, 1, 22, 2, 5, 3,
+    4, 17, 4, 8, 2, 0, 59, 60, 94, 5, 6, 48,
+    5, 0, 1, 9, 11, 1, 7, 12, 5, 0, 4, 1,
+    13, 5, 13, 1, 9, 10, 33, 150, 2, 152, 0, 8,
+    9, 3, 6, 7, 150, 0, 153, 3, 154, 2, 4, 24,
+    26, 5, 6, 0, 17, 13, 5, 2, 12, 14, 15, 20,
+    2, 0, 16, 0, 7, 92, 20, 3, 4, 6, 16, 0,
+    5, 18, 12, 61, 0, 2, 10, 9, 5, 10, 11, 12,
+    0, 8, 13, 2, 8, 9, 2, 6, 26, 16, 23, 0,
+    12, 5, 1, 6, 3, 4, 5, 2, 8, 234, 3, 7,
+    31, 9, 14, 3, 15, 38, 22, 7, 2, 30, 32, 14,
+    3, 6, 7, 0, 18, 7, 17, 4, 12, 5, 18, 39,
+    39, 0, 7, 19, 21, 3, 8, 11, 0, 3, 6, 11,
+    1, 10, 17, 16, 4, 6, 104, 18, 120, 0, 0, 1,
+    202, 203, 3, 0, 0, 0, 0, 149, 0, 0, 197, 15,
+    11, 44, 0, 0, 0, 0, 12, 0, 4, 1, 48, 3,
+    0, 0, 21, 59, 42, 43, 9, 4, 8, 0, 0, 2,
+    5, 33, 2, 8, 14, 13, 14, 1, 3, 4, 9, 33,
+    59, 0, 6, 3, 8, 7, 56, 1, 1, 23, 116, 0,
+    5, 11, 1, 24, 0, 283, 7, 0, 61, 107, 24, 171,
+    1, 55, 0, 4, 1, 0, 5, 9, 49, 14, 33, 3,
+    10, 0, 6, 8, 10, 11, 0, 0, 41, 65, 0, 15,
+    6, 8, 0, 0, 5, 17, 6, 24, 4, 5, 2, 5,
+    9, 0, 222, 22, 0, 24, 1, 5, 7, 5, 20, 36,
+    38, 156, 84, 6, 14, 4, 91, 7, 11, 8, 0, 0,
+    0, 0, 0, 227, 232, 0, 0, 0, 317, 3, 81, 7,
+    27, 6, 4, 40, 88, 7, 18, 8, 41, 42, 5, 0,
+    9, 309, 10, 4, 16, 0, 3, 5, 9, 6, 12, 56,
+    0, 120, 130, 40, 35, 16, 21, 5, 45, 4, 7, 2,
+    9, 11, 41, 3, 79, 1, 0, 0, 0, 122, 8, 56,
+    0, 0, 125, 126, 137, 282, 22, 8, 2, 93, 102, 12,
+    11, 8, 14, 15, 18, 11, 32, 34, 0, 65, 44, 9,
+    23, 5, 211, 19, 0, 7, 194, 0, 44, 0, 7, 16,
+    17, 13, 12, 3, 14, 25, 30, 51, 86, 0, 42, 130,
+    6, 83, 23, 221, 222, 0, 3, 398,
+};
+
+static const gint16 special_hash[] = {
+    963, 956, 967, 960, 965, 4, 2, 6, 7, 12, 966, 10,
+    11, 952, 0, 8, 954, 976, 15, 21, 24, 19, 22, 970,
+    971, 23, 13, 30, 25, 26, 27, 28, 17, 980, 32, 35,
+    43, 979, 48, 47, 50, 42, 46, 16, 29, 31, 49, 52,
+    34, 37, 977, 39, 55, 57, 54, 18, 969, 972, 973, 60,
+    63, 61, 67, 62, 65, 64, 981, 40, 68, 41, 71, 73,
+    70, 66, 20, 72, 76, 78, 968, 74, 77, 86, 974, 79,
+    85, 75, 958, 88, 827, 87, 975, 3, 5, 45, 56, 9,
+    14, 89, 95, 90, 92, 93, 69, 101, 96, 100, 94, 91,
+    97, 98, 33, 99, 58, 59, 80, 931, 81, 933, 103, 110,
+    108, 109, 102, 104, 106, 944, 878, 105, 945, 947, 107, 51,
+    53, 852, 115, 36, 116, 123, 119, 117, 120, 125, 114, 113,
+    118, 127, 121, 134, 128, 124, 122, 38, 141, 129, 142, 140,
+    144, 126, 138, 150, 152, 151, 139, 143, 111, 136, 146, 935,
+    936, 149, 145, 978, 948, 147, 154, 155, 148, 130, 162, 156,
+    165, 167, 163, 157, 133, 161, 160, 174, 177, 169, 171, 175,
+    166, 176, 170, 173, 172, 184, 180, 179, 178, 181, 183, 164,
+    168, 182, 185, 888, 187, 44, 192, 200, 112, 188, 194, 196,
+    198, 193, 199, 189, 191, 186, 195, 158, 153, 197, 207, 1,
+    201, 204, 205, 203, 209, 206, 82, 135, 210, 214, 213, 218,
+    219, 215, 137, 211, 208, 217, 222, 224, 202, 982, 223, 221,
+    231, 226, 983, 227, 225, 220, 228, 216, 905, 212, 920, 190,
+    131, 237, 235, 236, 238, 233, 242, 234, 240, 243, 132, 955,
+    159, 232, 241, 229, 244, 230, 253, 248, 249, 250, 245, 247,
+    251, 252, 255, 254, 262, 259, 260, 256, 246, 263, 264, 83,
+    84, 257, 261, 239, 265, 858, -1, -1, -1, 270, 268, 278,
+    271, 275, 266, 272, 269, 280, 276, 273, 267, 279, 281, 282,
+    277, -1, 287, 286, 292, 284, 290, -1, 289, 291, 283, 285,
+    298, 303, 294, 299, 293, 295, 300, 274, 296, 297, 301, 302,
+    288, 307, 312, 306, 315, 314, 321, 325, 323, 317, 311, 320,
+    324, 304, 326, 318, 305, 308, 322, -1, -1, 258, -1, -1,
+    329, 330, 319, 332, 327, 328, 316, 334, 333, 340, 342, 343,
+    338, 335, 347, 345, 348, 336, 337, 309, 310, 331, 349, 344,
+    339, 341, 346, 355, 350, 352, 353, -1, -1, 356, 358, 357,
+    360, 354, 351, 359, 313, -1, -1, 364, 362, 363, 366, 367,
+    372, 370, 361, 369, 368, 381, 375, 376, 378, 365, 377, 379,
+    380, 373, 383, 387, -1, -1, 390, 389, 384, 385, 388, 397,
+    393, 399, 401, 400, 394, 374, 391, 392, 398, 404, 411, 405,
+    406, 407, 402, 414, 412, 371, 413, 420, 403, 395, 417, 419,
+    424, 428, 423, 425, 422, 429, 386, 426, 410, 418, 427, 433,
+    415, 437, 439, 430, 441, 438, 443, 442, 436, 444, 440, 448,
+    447, 449, 445, 458, 460, 453, 461, 462, 455, 450, 463, 467,
+    470, 471, 472, 456, 465, 459, 468, 454, 431, 408, 435, 451,
+    466, 452, 416, 434, 464, 477, 481, 480, 478, 479, 482, 473,
+    475, 486, 446, 483, 484, 490, 487, 488, 491, 494, 432, 500,
+    498, 503, 476, 485, 499, 492, 493, 509, 513, 504, 512, 516,
+    510, 489, 505, 382, 457, 495, 396, 409, 474, 496, 511, 497,
+    517, 521, 523, 518, 532, 522, 527, 534, 535, 536, 533, 520,
+    524, 528, 529, 530, 531, 501, 519, 421, 540, 543, 541, 539,
+    544, 526, 514, 515, 546, 538, 549, 537, 550, 542, 548, 525,
+    556, 558, 551, 560, 561, 555, 547, 562, 559, 568, 565, 572,
+    552, 553, 566, 567, 569, 570, 564, 563, 554, 578, 581, 579,
+    576, 577, 580, 582, 574, 573, 593, 557, 584, 586, 585, 587,
+    590, 592, 591, 583, 571, 575, 598, 599, 600, 608, 601, 597,
+    606, 594, 595, 602, 617, 612, 604, 607, 611, 613, 614, 605,
+    609, 615, 616, 610, 603, 618, 545, 619, 622, 502, 620, 506,
+    507, 589, 624, 626, 627, 621, 625, 634, 629, 631, 628, 508,
+    596, 635, 641, 623, 642, 637, 643, 636, 638, 640, 588, 630,
+    639, 469, 633, -1, -1, -1, 648, 651, 652, 650, 654, 646,
+    653, 649, 659, 645, 658, 655, 660, 656, 661, -1, -1, -1,
+    657, 647, 663, -1, 669, 671, 662, 666, 670, 664, 644, 667,
+    665, 678, 683, 674, 673, 675, 677, 676, 684, 679, 685, 686,
+    695, 689, 696, 687, 682, 691, 693, 672, 694, 688, 699, 668,
+    697, 700, 632, 701, 703, 690, 692, 702, 680, 698, 681, -1,
+    -1, -1, 710, 704, 707, 709, 706, 705, -1, 716, 715, -1,
+    -1, -1, 712, -1, -1, -1, -1, -1, -1, 711, -1, 713,
+    714, 719, 717, 723, 718, 721, 720, 730, 728, 724, 731, -1,
+    725, 727, 722, 729, 708, 732, 736, 735, 739, 741, 742, 738,
+    733, 744, 751, 726, 747, 749, 750, 760, 754, 756, 758, 737,
+    752, 759, 764, 770, 765, 767, 768, 762, 745, 757, 746, 769,
+    766, 748, 763, 771, 773, 755, 776, 753, 779, 777, 774, 781,
+    772, 786, 778, 775, 743, 787, 740, 788, 791, 780, 793, 790,
+    734, 792, 785, 796, 802, 797, 761, 800, 798, 782, 789, 795,
+    794, 799, 783, 805, 808, 803, 811, 801, 804, 809, 812, 806,
+    814, 818, 819, 821, 820, 822, 824, 813, 815, 810, 816, 784,
+    -1, 829, 832, 830, 831, 843, 833, 844, 836, 846, 840, 838,
+    841, 823, 847, 845, 842, 834, -1, 807, 828, -1, 839, 856,
+    826, 851, 853, 850, 817, 857, 854, 835, 860, 867, 861, 859,
+    862, 863, 869, 868, 873, 872, 875, 876, 877, 825, 884, 874,
+    880, 892, 893, 891, 894, 890, 904, 864, 899, 901, 900, 879,
+    881, 882, 897, 865, 895, 866, 883, 885, 909, 914, 917, 908,
+    910, 907, 911, 912, 915, 919, 855, 925, 922, 921, 929, 926,
+    924, 918, 923, 896, 916, 927, 934, 932, 837, 930, 906, 903,
+    928, 937, 943, 941, 942, 939, 946, 951, 940, 886, 902, 848,
+    887, 898, 950, 870, 871, 938, 949, 889, 849, 913, 962, 957,
+    961, 959, 953, 964,
+};
@@ -0,0 +1,102 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#ifndef __PYZY_SQL_STMT_H_
+#define __PYZY_SQL_STMT_H_
+
+#include <glib.h>
+#include <sqlite3.h>
+
+#include "String.h"
+#include "Util.h"
+
+namespace PyZy {
+
+class SQLStmt {
+public:
+    SQLStmt (sqlite3 *db)
+        : m_db (db), m_stmt (NULL) {
+        g_assert (m_db != NULL);
+    }
+
+    ~SQLStmt () {
+        if (m_stmt != NULL) {
+            if (sqlite3_finalize (m_stmt) != SQLITE_OK) {
+                g_warning ("destroy sqlite stmt failed!");
+            }
+        }
+    }
+
+    bool prepare (const String &sql) {
+        if (sqlite3_prepare_v2 (m_db,
+                             sql.c_str (),
+                             sql.size (),
+                             &m_stmt,
+                             NULL) != SQLITE_OK) {
+            g_warning ("parse sql failed!\n %s", sql.c_str ());
+            return false;
+        }
+
+        return true;
+    }
+
+    bool step (void) {
+        switch (sqlite3_step (m_stmt)) {
+        case SQLITE_ROW:
+            return true;
+        case SQLITE_DONE:
+            return false;
+        default:
+            g_warning ("sqlites step error!");
+            return false;
+        }
+    }
+
+    bool bindInt (int index, int value) {
+        return sqlite3_bind_int (m_stmt, index, value) == SQLITE_OK;
+    }
+
+    bool bindText (int index, const char *value) {
+        return sqlite3_bind_text (m_stmt, index, value, -1, SQLITE_TRANSIENT) == SQLITE_OK;
+    }
+
+    void reset (void) {
+        sqlite3_reset (m_stmt);
+    }
+
+    const char *columnText (int col) {
+        return (const char *) sqlite3_column_text (m_stmt, col);
+    }
+
+    int columnInt (int col) {
+        return sqlite3_column_int (m_stmt, col);
+    }
+
+private:
+    sqlite3 *m_db;
+    sqlite3_stmt *m_stmt;
+};
+
+typedef std::shared_ptr<SQLStmt> SQLStmtPtr;
+
+};  // namespace PyZy
+
+#endif  // __PYZY_SQL_STMT_H_
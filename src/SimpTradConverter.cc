@@ -26,11 +26,13 @@
 #  include "config.h"
 #endif
 
+#include <errno.h>
+#include <unistd.h>
+#include <cstring>
+#include <vector>
+
 #ifdef HAVE_OPENCC
 #  include <opencc.h>
-#else
-#  include <cstring>
-#  include <cstdlib>
 #endif
 
 #include "String.h"
@@ -39,10 +41,12 @@ namespace PyZy {
 
 #ifdef HAVE_OPENCC
 
+/* An opencc handle with the buffers of its conversions. A handle is used
+ * by one thread at a time, and kept in a pool for the next conversions. */
 class opencc {
-    static const int BUFFER_SIZE = 64;
+    static const size_t BUFFER_SIZE = 1024;
 public:
-    opencc (void)
+    opencc (void) : m_out (BUFFER_SIZE)
     {
         m_od = opencc_open (OPENCC_DEFAULT_CONFIG_SIMP_TO_TRAD);
         g_assert (m_od != NULL);
@@ -53,127 +57,450 @@ public:
         opencc_close(m_od);
     }
 
-    void convert (const char *in, String &out)
+    /* takes a handle from the pool, or opens one when all are in use */
+    static opencc * acquire (void);
+    static void release (opencc *cc);
+
+    void clear (void)
+    {
+        m_in.clear ();
+    }
+
+    /* adds the characters of a valid utf-8 text to convert */
+    void add (const char *in, size_t len)
+    {
+        const char *end = in + len;
+        for (; in < end; in = g_utf8_next_char (in))
+            m_in.push_back (g_utf8_get_char (in));
+    }
+
+    void add (unichar ch)
     {
-        long n_char;
-        unichar *in_ucs4 = g_utf8_to_ucs4_fast (in, -1, &n_char);
+        m_in.push_back (ch);
+    }
 
-        ucs4_t *pinbuf = (ucs4_t *)in_ucs4;
-        size_t inbuf_left = n_char;
+    /* Converts the characters added, and appends them to outs[0]. After
+     * every '\n', they are appended to the next out. */
+    void convert (String *outs)
+    {
+        ucs4_t *pinbuf = m_in.empty () ? NULL : &m_in[0];
+        size_t inbuf_left = m_in.size ();
         while (inbuf_left != 0) {
-            ucs4_t *poutbuf = (ucs4_t *)m_buffer;
-            size_t outbuf_left = BUFFER_SIZE;
+            ucs4_t *poutbuf = &m_out[0];
+            size_t outbuf_left = m_out.size ();
             size_t retval = opencc_convert(m_od, &pinbuf, &inbuf_left, &poutbuf, &outbuf_left);
             if (retval == (size_t) -1) {
                 /* append left chars in pinbuf */
                 g_warning ("opencc_convert return failed");
-                out << (unichar *) pinbuf;
+                append (pinbuf, inbuf_left, outs);
                 break;
             }
-            *poutbuf = L'\0';
-            out << m_buffer;
+            append (&m_out[0], poutbuf - &m_out[0], outs);
         }
-        g_free (in_ucs4);
     }
+
+private:
+    static void append (const ucs4_t *chars, size_t len, String *&outs)
+    {
+        for (size_t i = 0; i < len; i++) {
+            if (chars[i] == '\n')
+                outs ++;
+            else
+                outs->appendUnichar (chars[i]);
+        }
+    }
+
 private:
     opencc_t m_od;
-    unichar m_buffer[BUFFER_SIZE + 1];
+    std::vector<ucs4_t> m_in;
+    std::vector<ucs4_t> m_out;
 };
 
-void
-SimpTradConverter::simpToTrad (const char *in, String &out)
+namespace {
+
+struct OpenCCPool {
+    GMutex lock;
+    std::vector<opencc *> handles;
+
+    OpenCCPool (void) { g_mutex_init (&lock); }
+    ~OpenCCPool (void)
+    {
+        for (size_t i = 0; i < handles.size (); i++)
+            delete handles[i];
+        g_mutex_clear (&lock);
+    }
+};
+
+OpenCCPool opencc_pool;
+
+};
+
+opencc *
+opencc::acquire (void)
 {
-    static opencc opencc;
-    opencc.convert (in, out);
+    opencc *cc = NULL;
+    g_mutex_lock (&opencc_pool.lock);
+    if (!opencc_pool.handles.empty ()) {
+        cc = opencc_pool.handles.back ();
+        opencc_pool.handles.pop_back ();
+    }
+    g_mutex_unlock (&opencc_pool.lock);
+    return cc != NULL ? cc : new opencc ();
 }
 
-#else
+void
+opencc::release (opencc *cc)
+{
+    g_mutex_lock (&opencc_pool.lock);
+    opencc_pool.handles.push_back (cc);
+    g_mutex_unlock (&opencc_pool.lock);
+}
 
-static int _xcmp (const char *p1, const char *p2, const char *str)
+void
+SimpTradConverter::simpToTrad (const char *in, size_t len, String &out)
 {
-    for (;;) {
-        // both reach end
-        if (p1 == p2 && *str == '\0')
-            return 0;
-        // p1 reaches end
-        if (p1 == p2)
-            return -1;
-        // str reaches end
-        if (*str == '\0')
-            return 1;
-
-        if (*p1 < *str)
-            return -1;
-        if (*p1 > *str)
-            return 1;
-
-        p1 ++; str ++;
-    };
+    opencc *cc = opencc::acquire ();
+    const char *end = in + len;
+
+    while (in < end) {
+        /* the lines of a text are converted one by one */
+        const char *line_end = (const char *) std::memchr (in, '\n', end - in);
+        if (line_end == NULL)
+            line_end = end;
+        const char *valid;
+        g_utf8_validate (in, line_end - in, &valid);
+        if (valid != in) {
+            cc->clear ();
+            cc->add (in, valid - in);
+            cc->convert (&out);
+        }
+        /* append an invalid byte or a '\n' as it is */
+        if (valid != end)
+            out.append (valid++, 1);
+        in = valid;
+    }
+    opencc::release (cc);
 }
 
-static int _cmp (const void * p1, const void * p2)
+void
+SimpTradConverter::simpToTrad (const std::vector<String> &texts,
+                               std::vector<String>       &trads)
 {
-    const char **pp = (const char **) p1;
-    const char **s2 = (const char **) p2;
+    trads.resize (texts.size ());
 
-    return _xcmp (pp[0], pp[1], s2[0]);
+    for (size_t i = 0; i < texts.size (); i++) {
+        if (!g_utf8_validate (texts[i].data (), texts[i].size (), NULL) ||
+            texts[i].find ('\n') != String::npos) {
+            for (size_t j = 0; j < texts.size (); j++)
+                simpToTrad (texts[j].data (), texts[j].size (), trads[j]);
+            return;
+        }
+    }
+
+    /* all the texts in one conversion, separated by '\n' */
+    opencc *cc = opencc::acquire ();
+    cc->clear ();
+    for (size_t i = 0; i < texts.size (); i++) {
+        if (i != 0)
+            cc->add ('\n');
+        cc->add (texts[i].data (), texts[i].size ());
+    }
+    if (!texts.empty ())
+        cc->convert (&trads[0]);
+    opencc::release (cc);
+}
+
+/* the characters a document block keeps for the next block, as the
+ * phrases of the opencc dictionaries are not known */
+#define SIMP_TO_TRAD_CARRY_LEN (16)
+
+/* Whether a text may be cut at p. opencc looks up phrases of its own, so
+ * any character boundary will do. */
+static bool
+can_cut (const char *begin, const char *p, const char *end, bool more)
+{
+    return p != end && (*p & 0xc0) != 0x80;
 }
 
+#else
+
+/* A node of the double array trie of the utf-8 bytes of the simplified
+ * texts. The child of node s for byte c is t = base + c of s, if check of
+ * t is s. trad is the index of the text node t ends in simp_to_trad, or
+ * -1 */
+struct SimpTradNode {
+    gint32 base;
+    gint32 check;
+    gint16 trad;
+};
+
 #include "SimpTradConverterTable.h"
 
 void
-SimpTradConverter::simpToTrad (const char *in, String &out)
+SimpTradConverter::simpToTrad (const char *in, size_t len, String &out)
 {
-    const char *pend;
-    const char *pp[2];
-    size_t len;
-    size_t begin;
-
-    if (!g_utf8_validate (in, -1 , NULL)) {
-        g_warning ("\%s\" is not an utf8 string!", in);
-        g_assert_not_reached ();
-    }
-
-    begin = 0;
-    pend = in + std::strlen (in);
-    len = g_utf8_strlen (in, -1);   // length in charactoers
-    pp[0] = in;
-
-    while (pp[0] != pend) {
-        size_t slen  = std::min (len - begin, static_cast<size_t>(SIMP_TO_TRAD_MAX_LEN)); // the length of sub string in character
-        pp[1] = g_utf8_offset_to_pointer (pp[0], slen);    // the end of sub string
-
-        for (;;) {
-            const char **result;
-            result = (const char **) std::bsearch (pp, simp_to_trad,
-                                            G_N_ELEMENTS (simp_to_trad), sizeof (simp_to_trad[0]),
-                                            _cmp);
-
-            if (result != NULL) {
-                // found item in table,
-                // append the trad to out and adjust pointers
-                out << result[1];
-                pp[0] = pp[1];
-                begin += slen;
+    const guchar *p = (const guchar *) in;
+    const guchar *pend = p + len;
+
+    while (p != pend) {
+        /* the longest simplified text from p */
+        const char *trad = NULL;
+        const guchar *end = p;
+        gint32 node = 0;
+        for (const guchar *q = p; q != pend; q++) {
+            gint32 child = simp_to_trad_trie[node].base + *q;
+            if (child >= (gint32) G_N_ELEMENTS (simp_to_trad_trie) ||
+                simp_to_trad_trie[child].check != node)
                 break;
+            node = child;
+            if (simp_to_trad_trie[node].trad >= 0) {
+                trad = simp_to_trad[simp_to_trad_trie[node].trad][1];
+                end = q + 1;
             }
+        }
 
-            if (slen == 1) {
-                // if only one character left,
-                // append origin character to out and adjust pointers
-                out.append (pp[0], pp[1] - pp[0]);
-                pp[0] = pp[1];
-                begin += 1;
+        if (trad != NULL) {
+            out << trad;
+            p = end;
+        }
+        else {
+            /* append the character as it is */
+            const guchar *next = p + 1;
+            while (next != pend && (*next & 0xc0) == 0x80)
+                next ++;
+            out.append ((const char *) p, next - p);
+            p = next;
+        }
+    }
+}
+
+void
+SimpTradConverter::simpToTrad (const std::vector<String> &texts,
+                               std::vector<String>       &trads)
+{
+    trads.resize (texts.size ());
+    for (size_t i = 0; i < texts.size (); i++)
+        simpToTrad (texts[i].data (), texts[i].size (), trads[i]);
+}
+
+/* the characters a document block keeps for the next block */
+#define SIMP_TO_TRAD_CARRY_LEN SIMP_TO_TRAD_MAX_LEN
+
+/* Whether a text may be cut at p, so that the pieces convert as the whole
+ * text does: no simplified text of the table from before p goes on after
+ * it. With more, the text goes on after end, so a text reaching end may go
+ * on too. */
+static bool
+can_cut (const char *begin, const char *p, const char *end, bool more)
+{
+    if (p != end && (*p & 0xc0) == 0x80)
+        return false;
+
+    /* the texts from the characters before p, which are shorter than
+     * SIMP_TO_TRAD_MAX_LEN characters */
+    const guchar *s = (const guchar *) p;
+    for (size_t n = 1; n < SIMP_TO_TRAD_MAX_LEN && s != (const guchar *) begin; n++) {
+        do {
+            s --;
+        } while (s != (const guchar *) begin && (*s & 0xc0) == 0x80);
+
+        gint32 node = 0;
+        for (const guchar *q = s; ; q++) {
+            if (q == (const guchar *) end) {
+                if (more)
+                    return false;
                 break;
             }
-
-            // if more than on characters left,
-            // adjust pp[1] to previous character
-            pp[1] = g_utf8_prev_char (pp[1]);
-            slen--;
+            gint32 child = simp_to_trad_trie[node].base + *q;
+            if (child >= (gint32) G_N_ELEMENTS (simp_to_trad_trie) ||
+                simp_to_trad_trie[child].check != node)
+                break;
+            node = child;
+            if (simp_to_trad_trie[node].trad >= 0 && q >= (const guchar *) p)
+                return false;
         }
     }
+    return true;
 }
 #endif  // HAVE_OPENCC
 
+void
+SimpTradConverter::simpToTrad (const char *in, String &out)
+{
+    simpToTrad (in, std::strlen (in), out);
+}
+
+/* the bytes a thread converts at a time */
+#define SIMP_TO_TRAD_PIECE_SIZE (256 * 1024)
+/* the bytes after the piece size to look for a place to cut the piece */
+#define SIMP_TO_TRAD_CUT_WINDOW (4096)
+
+namespace {
+
+struct Piece {
+    const char *begin;
+    const char *end;
+    String out;
+};
+
+struct Pieces {
+    std::vector<Piece> pieces;
+    size_t next;
+    GMutex lock;
+};
+
+gpointer
+convert_pieces (gpointer data)
+{
+    Pieces *pieces = static_cast<Pieces *> (data);
+    for (;;) {
+        g_mutex_lock (&pieces->lock);
+        size_t i = pieces->next++;
+        g_mutex_unlock (&pieces->lock);
+        if (i >= pieces->pieces.size ())
+            break;
+        Piece &piece = pieces->pieces[i];
+        SimpTradConverter::simpToTrad (piece.begin, piece.end - piece.begin, piece.out);
+    }
+    return NULL;
+}
+
+/* The end of the piece from begin: after the first ascii byte from
+ * begin + size on, which no simplified text has, or else at the first
+ * place the text can be cut within SIMP_TO_TRAD_CUT_WINDOW bytes, or else
+ * before the next character, so a text without ascii bytes is cut too */
+const char *
+piece_end (const char *begin, const char *end, size_t size)
+{
+    if ((size_t) (end - begin) <= size)
+        return end;
+
+    const char *window = begin + size + MIN (SIMP_TO_TRAD_CUT_WINDOW,
+                                             (size_t) (end - begin) - size);
+    for (const char *p = begin + size - 1; p != window; p++) {
+        if ((*p & 0x80) == 0)
+            return p + 1;
+    }
+    for (const char *p = begin + size; p != window; p++) {
+        if (can_cut (begin, p, end, false))
+            return p;
+    }
+
+    const char *p = window;
+    while (p != end && (*p & 0xc0) == 0x80)
+        p ++;
+    return p;
+}
+
+/* The end of the part of a block to convert now. The rest may be the
+ * beginning of a simplified text going on in the next block, so it is at
+ * most the last SIMP_TO_TRAD_CARRY_LEN characters. */
+size_t
+block_end (const String &block)
+{
+    const char *begin = block.data ();
+    const char *end = begin + block.size ();
+
+    const char *last = end;
+    for (size_t n = 0; n < SIMP_TO_TRAD_CARRY_LEN && last != begin; n++) {
+        do {
+            last --;
+        } while (last != begin && (*last & 0xc0) == 0x80);
+    }
+
+    for (const char *p = end - 1; p > last; p--) {
+        if ((p[-1] & 0x80) == 0 || can_cut (begin, p, end, true))
+            return p - begin;
+    }
+    return last - begin;
+}
+
+};
+
+void
+SimpTradConverter::simpToTrad (const char  *in,
+                               size_t       len,
+                               String      &out,
+                               size_t       threads)
+{
+    if (threads == 0)
+        threads = MAX (g_get_num_processors (), 1U);
+
+    Pieces pieces;
+    const char *end = in + len;
+    for (const char *p = in; p != end; ) {
+        Piece piece;
+        piece.begin = p;
+        piece.end = p = piece_end (p, end, SIMP_TO_TRAD_PIECE_SIZE);
+        pieces.pieces.push_back (piece);
+    }
+
+    if (threads == 1 || pieces.pieces.size () <= 1) {
+        simpToTrad (in, len, out);
+        return;
+    }
+
+    pieces.next = 0;
+    g_mutex_init (&pieces.lock);
+    std::vector<GThread *> workers;
+    threads = MIN (threads, pieces.pieces.size ());
+    for (size_t i = 1; i < threads; i++)
+        workers.push_back (g_thread_new ("pyzy-simptrad", convert_pieces, &pieces));
+    convert_pieces (&pieces);
+    for (size_t i = 0; i < workers.size (); i++)
+        g_thread_join (workers[i]);
+    g_mutex_clear (&pieces.lock);
+
+    for (size_t i = 0; i < pieces.pieces.size (); i++)
+        out.append (pieces.pieces[i].out);
+}
+
+bool
+SimpTradConverter::simpToTrad (int in_fd, int out_fd, size_t threads)
+{
+    if (threads == 0)
+        threads = MAX (g_get_num_processors (), 1U);
+
+    const size_t block_size = threads * SIMP_TO_TRAD_PIECE_SIZE * 4;
+    std::vector<char> buffer (block_size);
+    String block;
+    String out;
+    bool eof = false;
+
+    while (!eof) {
+        /* fill the block, a pipe may return less at a time */
+        size_t size = 0;
+        while (size < block_size && !eof) {
+            ssize_t n = ::read (in_fd, &buffer[size], block_size - size);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n < 0) {
+                g_warning ("can not read the document to convert");
+                return false;
+            }
+            eof = (n == 0);
+            size += n;
+        }
+        block.append (&buffer[0], size);
+
+        /* a simplified text may go on in the next block */
+        size_t len = eof ? block.size () : block_end (block);
+        out.clear ();
+        simpToTrad (block.data (), len, out, threads);
+        block.erase (0, len);
+
+        for (size_t written = 0; written < out.size (); ) {
+            ssize_t n = ::write (out_fd, out.data () + written, out.size () - written);
+            if (n < 0 && errno == EINTR)
+                continue;
+            if (n < 0) {
+                g_warning ("can not write the converted document");
+                return false;
+            }
+            written += n;
+        }
+    }
+    return true;
+}
+
 };  // namespace PyZy
@@ -22,13 +22,35 @@
 #ifndef __PYZY_SIMP_TRAD_CONVERTER_H_
 #define __PYZY_SIMP_TRAD_CONVERTER_H_
 
-namespace PyZy {
+#include <cstddef>
+#include <vector>
+
+#include "String.h"
 
-class String;
+namespace PyZy {
 
 class SimpTradConverter {
 public:
     static void simpToTrad (const char *in, String &out);
+    /* Converts len bytes, which may hold invalid utf-8 and NUL bytes.
+     * The bytes that are not utf-8 characters are copied as they are. */
+    static void simpToTrad (const char *in, size_t len, String &out);
+    /* Converts many texts, like the candidates of a page, at once.
+     * trads[i] gets the conversion of texts[i] appended. */
+    static void simpToTrad (const std::vector<String> &texts,
+                            std::vector<String>       &trads);
+    /* Converts a document with threads threads, 0 for one for every
+     * processor. The document is cut into pieces after ascii bytes, which
+     * no simplified text holds, or where no simplified text goes over the
+     * cut, so the result is the same as with one thread. */
+    static void simpToTrad (const char  *in,
+                            size_t       len,
+                            String      &out,
+                            size_t       threads);
+    /* Converts everything read from in_fd and writes it to out_fd, a
+     * block at a time, keeping at most the longest simplified text of a
+     * block for the next one */
+    static bool simpToTrad (int in_fd, int out_fd, size_t threads);
 };
 
 };  // namespace PyZy
@@ -7425,3 +7425,5399 @@ static const char *simp_to_trad[][2] = {
     { "龟", "龜" },
 };
 #define SIMP_TO_TRAD_MAX_LEN (6)
+
+static const SimpTradNode simp_to_trad_trie[] = {
+    { 1, 0, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 }, { 0, -1, -1 },
+    { 0, -1, -1 }, { 1, 228, -1 }, { 5278, 419, -1 }, { 5535, 458, -1 },
+    { 5563, 464, -1 }, { 5576, 466, -1 }, { 10628, 498, -1 }, { 10656, 717, -1 },
+    { 309, 129, -1 }, { 5558, 464, -1 }, { 10547, 1902, -1 }, { 429, 186, -1 },
+    { 712, 186, 202 }, { 3881, 304, -1 }, { 1894, 186, -1 }, { 443, 186, 210 },
+    { 0, 380, 4474 }, { 0, 526, 7068 }, { 0, 304, 3057 }, { 534, 186, 213 },
+    { 0, 267, 1934 }, { 1146, 239, -1 }, { 3032, 289, -1 }, { 549, 186, 215 },
+    { 2421, 267, 1935 }, { 5272, 416, -1 }, { 2226, 260, -1 }, { 5275, 416, -1 },
+    { 2444, 267, -1 }, { 2228, 260, 1803 }, { 1029, 235, -1 }, { 2450, 268, -1 },
+    { 1613, 186, -1 }, { 0, 288, 2350 }, { 554, 186, -1 }, { 0, 186, 223 },
+    { 568, 186, 224 }, { 5277, 417, -1 }, { 0, 288, 2351 }, { 1039, 235, -1 },
+    { 0, 450, 5586 }, { 596, 186, 226 }, { 1011, 192, -1 }, { 3416, 235, -1 },
+    { 0, 261, 1805 }, { 0, 277, 2168 }, { 0, 341, 3896 }, { 1124, 238, -1 },
+    { 2163, 256, -1 }, { 0, 375, 4441 }, { 1048, 235, -1 }, { 609, 186, 228 },
+    { 621, 186, 230 }, { 5578, 467, -1 }, { 1145, 238, -1 }, { 5012, 368, -1 },
+    { 2208, 258, -1 }, { 425, 229, -1 }, { 3, 229, -1 }, { 454, 229, -1 },
+    { 491, 229, -1 }, { 532, 229, -1 }, { 566, 229, -1 }, { 570, 229, -1 },
+    { 38, 229, -1 }, { 622, 186, -1 }, { 0, 239, 759 }, { 1012, 192, -1 },
+    { 0, 415, 4920 }, { 2250, 261, -1 }, { 0, 235, 731 }, { 1025, 192, -1 },
+    { 5534, 457, -1 }, { 0, 192, 704 }, { 1059, 235, 732 }, { 2630, 276, -1 },
+    { 0, 192, 705 }, { 5558, 463, -1 }, { 0, 192, 706 }, { 0, 192, 707 },
+    { 0, 192, 708 }, { 0, 256, 1762 }, { 0, 258, 1792 }, { 1380, 192, 709 },
+    { 2086, 192, -1 }, { 1027, 192, -1 }, { 0, 256, 1763 }, { 0, 256, 1764 },
+    { 0, 256, 1765 }, { 5011, 368, -1 }, { 0, 258, 1793 }, { 5581, 470, -1 },
+    { 5015, 369, -1 }, { 0, 276, 2165 }, { 0, 276, 2166 }, { 0, 276, 2167 },
+    { 5582, 471, -1 }, { 2166, 256, -1 }, { 0, 256, 1767 }, { 5016, 369, -1 },
+    { 1, 0, -1 }, { 1, 0, -1 }, { 107, 0, -1 }, { 171, 0, -1 },
+    { 234, 0, -1 }, { 298, 0, -1 }, { 362, 0, -1 }, { 12, 230, -1 },
+    { 599, 230, -1 }, { 481, 230, -1 }, { 1, 230, -1 }, { 3, 230, -1 },
+    { 631, 230, -1 }, { 688, 230, -1 }, { 740, 230, -1 }, { 764, 230, -1 },
+    { 814, 230, -1 }, { 836, 230, -1 }, { 615, 230, -1 }, { 873, 230, -1 },
+    { 907, 230, -1 }, { 961, 230, -1 }, { 981, 230, -1 }, { 1036, 230, -1 },
+    { 1076, 230, -1 }, { 1093, 230, -1 }, { 1134, 230, -1 }, { 671, 230, -1 },
+    { 42, 230, -1 }, { 925, 230, -1 }, { 39, 230, -1 }, { 632, 230, -1 },
+    { 1, 230, -1 }, { 9, 230, -1 }, { 1137, 230, -1 }, { 503, 230, -1 },
+    { 1177, 230, -1 }, { 1210, 230, -1 }, { 703, 230, -1 }, { 3, 230, -1 },
+    { 1, 230, -1 }, { 354, 230, -1 }, { 705, 230, -1 }, { 1228, 230, -1 },
+    { 1261, 230, -1 }, { 852, 230, -1 }, { 674, 230, -1 }, { 831, 230, -1 },
+    { 41, 230, -1 }, { 3, 230, -1 }, { 396, 230, -1 }, { 424, 230, -1 },
+    { 622, 230, -1 }, { 1300, 230, -1 }, { 1341, 230, -1 }, { 1401, 230, -1 },
+    { 1379, 230, -1 }, { 1421, 230, -1 }, { 1027, 230, -1 }, { 427, 230, -1 },
+    { 9, 230, -1 }, { 4, 230, -1 }, { 1426, 230, -1 }, { 1484, 230, -1 },
+    { 1059, 230, -1 }, { 1522, 230, -1 }, { 460, 230, -1 }, { 1554, 230, -1 },
+    { 1456, 230, -1 }, { 1572, 230, -1 }, { 1352, 230, -1 }, { 1614, 231, -1 },
+    { 1628, 231, -1 }, { 1591, 231, -1 }, { 1653, 231, -1 }, { 1202, 231, -1 },
+    { 1, 231, -1 }, { 5633, 476, -1 }, { 701, 231, -1 }, { 1695, 231, -1 },
+    { 1721, 231, -1 }, { 1762, 231, -1 }, { 1801, 231, -1 }, { 1841, 231, -1 },
+    { 1874, 231, -1 }, { 1878, 231, -1 }, { 1258, 231, -1 }, { 1939, 231, -1 },
+    { 1887, 231, -1 }, { 1510, 231, -1 }, { 552, 231, -1 }, { 843, 231, -1 },
+    { 1930, 231, -1 }, { 1970, 231, -1 }, { 1987, 231, -1 }, { 1730, 231, -1 },
+    { 2026, 231, -1 }, { 756, 231, -1 }, { 800, 231, -1 }, { 2042, 231, -1 },
+    { 2090, 231, -1 }, { 2128, 231, -1 }, { 1245, 231, -1 }, { 2169, 231, -1 },
+    { 2107, 231, -1 }, { 1083, 231, -1 }, { 1958, 231, -1 }, { 2022, 231, -1 },
+    { 493, 231, -1 }, { 612, 231, -1 }, { 496, 231, -1 }, { 871, 231, -1 },
+    { 711, 231, -1 }, { 5, 231, -1 }, { 0, 499, 6470 }, { 975, 231, -1 },
+    { 1185, 231, -1 }, { 2186, 231, -1 }, { 2212, 231, -1 }, { 2061, 231, -1 },
+    { 1401, 231, -1 }, { 2235, 231, -1 }, { 2248, 231, -1 }, { 2056, 231, -1 },
+    { 2310, 231, -1 }, { 2331, 231, -1 }, { 2342, 231, -1 }, { 2384, 231, -1 },
+    { 780, 231, -1 }, { 841, 231, -1 }, { 2396, 231, -1 }, { 1013, 231, -1 },
+    { 2432, 231, -1 }, { 399, 231, -1 }, { 440, 231, -1 }, { 2399, 232, -1 },
+    { 2457, 232, -1 }, { 2466, 232, -1 }, { 923, 232, -1 }, { 527, 232, -1 },
+    { 45, 232, -1 }, { 78, 232, -1 }, { 920, 232, -1 }, { 2474, 232, -1 },
+    { 612, 232, -1 }, { 2492, 232, -1 }, { 2530, 232, -1 }, { 4, 232, -1 },
+    { 1293, 232, -1 }, { 1074, 232, -1 }, { 1656, 232, -1 }, { 347, 232, -1 },
+    { 2, 232, -1 }, { 690, 232, -1 }, { 2539, 232, -1 }, { 749, 232, -1 },
+    { 2568, 232, -1 }, { 2598, 232, -1 }, { 2604, 232, -1 }, { 1126, 232, -1 },
+    { 1575, 232, -1 }, { 2627, 232, -1 }, { 755, 232, -1 }, { 1125, 232, -1 },
+    { 1332, 232, -1 }, { 2627, 232, -1 }, { 2200, 232, -1 }, { 1488, 232, -1 },
+    { 1153, 232, -1 }, { 1007, 232, -1 }, { 876, 232, -1 }, { 2629, 232, -1 },
+    { 1664, 232, -1 }, { 2691, 232, -1 }, { 1910, 232, -1 }, { 1291, 232, -1 },
+    { 2683, 232, -1 }, { 1200, 232, -1 }, { 1797, 232, -1 }, { 2189, 232, -1 },
+    { 2693, 232, -1 }, { 972, 232, -1 }, { 870, 232, -1 }, { 1230, 232, -1 },
+    { 2714, 232, -1 }, { 1827, 232, -1 }, { 1038, 232, -1 }, { 13, 232, -1 },
+    { 8, 232, -1 }, { 8, 232, -1 }, { 0, 500, 6471 }, { 1, 232, -1 },
+    { 2730, 232, -1 }, { 2794, 232, -1 }, { 2858, 232, -1 }, { 1707, 232, -1 },
+    { 1405, 232, -1 }, { 1124, 232, -1 }, { 2911, 233, -1 }, { 2914, 233, -1 },
+    { 2928, 233, -1 }, { 2972, 233, -1 }, { 2993, 233, -1 }, { 2937, 233, -1 },
+    { 484, 233, -1 }, { 1253, 233, -1 }, { 3016, 233, -1 }, { 2290, 233, -1 },
+    { 2522, 233, -1 }, { 3055, 233, -1 }, { 3075, 233, -1 }, { 3100, 233, -1 },
+    { 3116, 233, -1 }, { 409, 233, -1 }, { 3047, 233, -1 }, { 543, 233, -1 },
+    { 1357, 233, -1 }, { 2524, 233, -1 }, { 1394, 233, -1 }, { 398, 233, -1 },
+    { 1016, 233, -1 }, { 470, 233, -1 }, { 18, 233, -1 }, { 3135, 233, -1 },
+    { 2334, 233, -1 }, { 3173, 233, -1 }, { 2382, 233, -1 }, { 2921, 233, -1 },
+    { 0, 502, 6472 }, { 13, 233, -1 }, { 2, 233, -1 }, { 3164, 233, -1 },
+    { 2413, 233, -1 }, { 2027, 233, -1 }, { 597, 233, -1 }, { 14, 233, -1 },
+    { 3, 233, -1 }, { 3225, 233, -1 }, { 5, 233, -1 }, { 12, 233, -1 },
+    { 348, 233, -1 }, { 0, 504, 6473 }, { 36, 233, -1 }, { 58, 233, -1 },
+    { 3240, 233, -1 }, { 3304, 233, -1 }, { 3368, 233, -1 }, { 571, 233, -1 },
+    { 122, 233, -1 }, { 678, 233, -1 }, { 3395, 233, -1 }, { 3459, 233, -1 },
+    { 1513, 233, -1 }, { 3493, 233, -1 }, { 1909, 233, -1 }, { 1376, 233, -1 },
+    { 1478, 233, -1 }, { 0, 468, 5746 }, { 0, 468, 5747 }, { 3515, 233, -1 },
+    { 3578, 233, -1 }, { 3621, 233, -1 }, { 3655, 234, -1 }, { 2217, 234, -1 },
+    { 3660, 234, -1 }, { 3706, 234, -1 }, { 650, 234, -1 }, { 3711, 234, -1 },
+    { 519, 234, -1 }, { 2932, 234, -1 }, { 1, 567, -1 }, { 162, 234, -1 },
+    { 244, 234, -1 }, { 2463, 269, -1 }, { 266, 234, -1 }, { 6141, 575, -1 },
+    { 296, 234, -1 }, { 5051, 379, -1 }, { 5577, 468, -1 }, { 2470, 269, 1940 },
+    { 3769, 234, -1 }, { 3833, 234, -1 }, { 3897, 234, -1 }, { 3960, 234, -1 },
+    { 2489, 269, -1 }, { 3979, 234, -1 }, { 4042, 234, -1 }, { 3494, 234, -1 },
+    { 1583, 234, -1 }, { 3705, 234, -1 }, { 3106, 234, -1 }, { 1530, 234, -1 },
+    { 2990, 234, -1 }, { 3206, 234, -1 }, { 2500, 269, -1 }, { 4021, 234, -1 },
+    { 4106, 234, -1 }, { 3507, 234, -1 }, { 4, 234, -1 }, { 4109, 234, -1 },
+    { 4173, 234, -1 }, { 5050, 379, 4471 }, { 0, 379, 4473 }, { 4155, 234, -1 },
+    { 4219, 234, -1 }, { 4252, 234, -1 }, { 1662, 234, -1 }, { 2152, 234, -1 },
+    { 2639, 278, -1 }, { 6033, 136, -1 }, { 6083, 136, -1 }, { 641, 234, -1 },
+    { 4287, 234, -1 }, { 4346, 234, -1 }, { 0, 278, 2171 }, { 6096, 579, -1 },
+    { 0, 278, 2172 }, { 4969, 361, -1 }, { 4350, 234, -1 }, { 4413, 234, -1 },
+    { 902, 234, -1 }, { 2620, 234, -1 }, { 4427, 234, -1 }, { 1262, 234, -1 },
+    { 4462, 234, -1 }, { 1671, 185, -1 }, { 6112, 587, -1 }, { 0, 361, 4292 },
+    { 876, 185, -1 }, { 0, 287, 2346 }, { 0, 287, 2347 }, { 6145, 590, -1 },
+    { 1749, 185, 28 }, { 2639, 279, -1 }, { 1798, 185, -1 }, { 1400, 185, -1 },
+    { 1625, 185, -1 }, { 5481, 441, -1 }, { 2094, 185, -1 }, { 269, 185, 69 },
+    { 4971, 362, -1 }, { 5482, 441, -1 }, { 2644, 185, -1 }, { 6186, 592, -1 },
+    { 526, 185, 119 }, { 0, 278, 2173 }, { 2650, 279, -1 }, { 272, 185, -1 },
+    { 0, 447, 5573 }, { 3010, 287, -1 }, { 5511, 447, 5574 }, { 315, 185, 125 },
+    { 0, 185, 127 }, { 435, 185, 128 }, { 487, 185, 133 }, { 6170, 605, -1 },
+    { 4973, 361, -1 }, { 0, 362, 4296 }, { 0, 362, 4297 }, { 326, 185, 137 },
+    { 1974, 187, -1 }, { 2349, 185, 139 }, { 331, 185, 146 }, { 1418, 187, 238 },
+    { 338, 185, 148 }, { 626, 187, -1 }, { 1074, 187, -1 }, { 807, 185, 150 },
+    { 2997, 187, 249 }, { 0, 187, 431 }, { 2370, 185, -1 }, { 2952, 187, 432 },
+    { 0, 287, 2349 }, { 2817, 185, 173 }, { 2183, 187, -1 }, { 679, 187, -1 },
+    { 2658, 279, -1 }, { 353, 185, 189 }, { 6219, 609, -1 }, { 0, 279, 2177 },
+    { 641, 187, 453 }, { 374, 185, -1 }, { 384, 185, -1 }, { 562, 185, 193 },
+    { 495, 185, -1 }, { 5515, 449, -1 }, { 0, 185, 199 }, { 0, 185, 200 },
+    { 6221, 610, -1 }, { 0, 449, 5584 }, { 718, 187, -1 }, { 784, 188, -1 },
+    { 740, 187, -1 }, { 0, 187, 460 }, { 3389, 294, -1 }, { 0, 187, 461 },
+    { 0, 188, 475 }, { 3111, 188, -1 }, { 1938, 188, -1 }, { 5400, 432, -1 },
+    { 728, 187, -1 }, { 0, 432, 5279 }, { 0, 294, 2700 }, { 4784, 336, -1 },
+    { 0, 187, 464 }, { 658, 188, 500 }, { 5516, 449, -1 }, { 0, 187, 465 },
+    { 661, 188, 503 }, { 0, 263, 1868 }, { 0, 188, 505 }, { 2387, 263, -1 },
+    { 2033, 187, -1 }, { 770, 188, -1 }, { 3403, 294, -1 }, { 673, 188, -1 },
+    { 797, 188, -1 }, { 851, 187, 470 }, { 0, 237, 746 }, { 4789, 336, -1 },
+    { 0, 237, 747 }, { 0, 237, 748 }, { 0, 237, 749 }, { 0, 338, 3878 },
+    { 5403, 432, -1 }, { 1090, 237, -1 }, { 5758, 496, -1 }, { 0, 338, 3879 },
+    { 0, 338, 3880 }, { 6186, 139, -1 }, { 5760, 496, -1 }, { 1134, 237, -1 },
+    { 1096, 237, -1 }, { 674, 188, 511 }, { 2322, 263, -1 }, { 691, 188, 514 },
+    { 6152, 581, -1 }, { 6109, 581, -1 }, { 2282, 263, 1875 }, { 696, 188, -1 },
+    { 1113, 237, -1 }, { 5005, 367, -1 }, { 2447, 189, -1 }, { 2287, 263, -1 },
+    { 6235, 143, -1 }, { 701, 188, -1 }, { 0, 188, 518 }, { 756, 189, -1 },
+    { 6189, 143, -1 }, { 781, 189, -1 }, { 749, 188, -1 }, { 2320, 263, -1 },
+    { 4555, 318, -1 }, { 0, 336, 3872 }, { 968, 188, -1 }, { 0, 189, 533 },
+    { 814, 189, 534 }, { 1502, 189, -1 }, { 883, 189, 541 }, { 0, 189, 546 },
+    { 0, 263, 1883 }, { 0, 263, 1884 }, { 0, 189, 547 }, { 0, 189, 548 },
+    { 823, 189, 549 }, { 4561, 318, -1 }, { 5010, 367, -1 }, { 5011, 367, -1 },
+    { 822, 189, 551 }, { 0, 189, 553 }, { 0, 189, 554 }, { 0, 189, 555 },
+    { 857, 190, -1 }, { 5008, 367, -1 }, { 838, 189, 556 }, { 0, 189, 558 },
+    { 5490, 443, -1 }, { 5631, 475, -1 }, { 5490, 443, -1 }, { 870, 190, -1 },
+    { 877, 190, -1 }, { 888, 190, -1 }, { 0, 318, 3382 }, { 954, 191, -1 },
+    { 847, 189, -1 }, { 893, 190, 564 }, { 4561, 318, -1 }, { 898, 190, -1 },
+    { 6175, 582, -1 }, { 6, 582, -1 }, { 4562, 318, -1 }, { 3165, 190, -1 },
+    { 5490, 443, 5528 }, { 907, 190, -1 }, { 925, 190, -1 }, { 6181, 612, -1 },
+    { 6184, 612, -1 }, { 957, 191, -1 }, { 972, 190, -1 }, { 1127, 191, -1 },
+    { 6224, 612, -1 }, { 2613, 190, -1 }, { 0, 191, 688 }, { 0, 190, 681 },
+    { 5632, 475, -1 }, { 0, 191, 689 }, { 1367, 236, -1 }, { 995, 191, 690 },
+    { 0, 191, 692 }, { 0, 191, 693 }, { 0, 191, 694 }, { 0, 191, 695 },
+    { 0, 191, 696 }, { 1067, 236, -1 }, { 0, 191, 697 }, { 5553, 462, -1 },
+    { 0, 337, 3873 }, { 939, 190, -1 }, { 1590, 246, -1 }, { 0, 337, 3874 },
+    { 0, 337, 3875 }, { 0, 337, 3876 }, { 0, 372, 4408 }, { 1001, 191, -1 },
+    { 0, 462, 5698 }, { 1071, 236, -1 }, { 1604, 246, 1151 }, { 1077, 236, -1 },
+    { 6097, 572, -1 }, { 951, 190, -1 }, { 6092, 572, -1 }, { 1150, 240, -1 },
+    { 2213, 259, -1 }, { 1002, 191, -1 }, { 1157, 240, -1 }, { 6227, 147, -1 },
+    { 1166, 240, -1 }, { 1187, 240, -1 }, { 2659, 280, -1 }, { 1210, 240, -1 },
+    { 1189, 240, -1 }, { 2215, 259, -1 }, { 1483, 240, -1 }, { 0, 236, 741 },
+    { 1215, 240, -1 }, { 2831, 280, -1 }, { 2659, 280, -1 }, { 0, 280, 2183 },
+    { 0, 240, 777 }, { 0, 462, 5699 }, { 6203, 151, -1 }, { 1680, 246, -1 },
+    { 4790, 337, -1 }, { 0, 240, 778 }, { 1079, 236, -1 }, { 6257, 162, -1 },
+    { 0, 259, 1797 }, { 1780, 240, 779 }, { 0, 236, 743 }, { 5747, 494, -1 },
+    { 2677, 280, 2184 }, { 0, 236, 744 }, { 0, 236, 745 }, { 6229, 611, -1 },
+    { 0, 280, 2186 }, { 6210, 611, -1 }, { 0, 372, 4409 }, { 0, 372, 4410 },
+    { 0, 259, 1798 }, { 5027, 372, 4411 }, { 6260, 164, -1 }, { 1226, 240, -1 },
+    { 2146, 255, -1 }, { 1616, 246, -1 }, { 2419, 240, -1 }, { 1360, 240, -1 },
+    { 2530, 240, -1 }, { 1665, 246, -1 }, { 2149, 255, -1 }, { 0, 240, 804 },
+    { 1230, 240, -1 }, { 2220, 259, 1799 }, { 1262, 240, 806 }, { 1230, 240, 810 },
+    { 2221, 259, -1 }, { 1244, 240, -1 }, { 5634, 477, -1 }, { 1252, 240, -1 },
+    { 0, 240, 814 }, { 0, 241, 819 }, { 0, 240, 815 }, { 1259, 240, -1 },
+    { 1270, 240, 817 }, { 1553, 241, 820 }, { 2622, 274, -1 }, { 5749, 494, -1 },
+    { 0, 241, 824 }, { 0, 274, 2137 }, { 0, 255, 1754 }, { 6220, 169, -1 },
+    { 0, 241, 825 }, { 5962, 539, 7205 }, { 3661, 274, -1 }, { 0, 255, 1755 },
+    { 0, 539, 7208 }, { 0, 255, 1756 }, { 2465, 266, -1 }, { 0, 255, 1757 },
+    { 0, 381, 4475 }, { 3890, 306, -1 }, { 6260, 179, -1 }, { 1276, 241, -1 },
+    { 5635, 477, -1 }, { 1277, 241, 827 }, { 2382, 266, -1 }, { 1281, 241, 829 },
+    { 1700, 241, 831 }, { 2386, 266, -1 }, { 0, 306, 3059 }, { 0, 306, 3060 },
+    { 2151, 255, -1 }, { 3904, 306, 3061 }, { 6253, 180, -1 }, { 2473, 266, -1 },
+    { 1292, 241, -1 }, { 1309, 241, -1 }, { 6220, 193, -1 }, { 0, 266, 1928 },
+    { 0, 266, 1929 }, { 0, 266, 1930 }, { 6217, 593, -1 }, { 0, 274, 2153 },
+    { 1589, 241, -1 }, { 2156, 255, -1 }, { 5637, 477, -1 }, { 0, 241, 842 },
+    { 5053, 381, -1 }, { 0, 381, 4477 }, { 3510, 241, 843 }, { 1313, 241, 892 },
+    { 1602, 242, 898 }, { 0, 241, 894 }, { 1318, 241, -1 }, { 1322, 241, -1 },
+    { 6256, 608, -1 }, { 5054, 381, -1 }, { 3530, 242, -1 }, { 0, 241, 897 },
+    { 0, 340, 3892 }, { 1324, 242, 934 }, { 0, 266, 1931 }, { 2508, 270, 1944 },
+    { 1328, 242, -1 }, { 0, 270, 1947 }, { 5075, 383, 4508 }, { 1331, 242, 937 },
+    { 2499, 270, 1948 }, { 0, 242, 939 }, { 0, 325, 3593 }, { 2506, 270, 1950 },
+    { 0, 340, 3893 }, { 2415, 266, -1 }, { 2516, 270, -1 }, { 6364, 633, -1 },
+    { 3906, 306, -1 }, { 6370, 636, -1 }, { 5130, 390, -1 }, { 0, 242, 940 },
+    { 0, 340, 3894 }, { 1353, 242, -1 }, { 1430, 243, -1 }, { 0, 340, 3895 },
+    { 3017, 242, 942 }, { 4654, 325, -1 }, { 5078, 383, -1 }, { 6368, 643, -1 },
+    { 0, 242, 958 }, { 0, 243, 1011 }, { 6384, 661, -1 }, { 4655, 325, -1 },
+    { 6247, 603, -1 }, { 1407, 243, -1 }, { 3631, 243, 1013 }, { 0, 242, 959 },
+    { 6301, 603, -1 }, { 1655, 242, 960 }, { 5136, 390, -1 }, { 0, 242, 967 },
+    { 1712, 243, 1040 }, { 0, 243, 1044 }, { 1764, 243, 1045 }, { 1496, 243, 1049 },
+    { 6384, 663, -1 }, { 0, 390, 4626 }, { 2652, 242, -1 }, { 0, 325, 3599 },
+    { 0, 243, 1052 }, { 1389, 242, -1 }, { 3596, 242, -1 }, { 1393, 242, 1001 },
+    { 6379, 667, -1 }, { 0, 383, 4511 }, { 4948, 356, -1 }, { 0, 242, 1004 },
+    { 4951, 356, -1 }, { 1435, 243, -1 }, { 6379, 673, -1 }, { 2891, 243, 1054 },
+    { 4656, 325, -1 }, { 0, 243, 1064 }, { 3102, 243, -1 }, { 4953, 356, -1 },
+    { 6185, 140, -1 }, { 6232, 140, -1 }, { 0, 244, 1110 }, { 5137, 390, -1 },
+    { 0, 244, 1111 }, { 1726, 244, -1 }, { 3985, 243, -1 }, { 6305, 618, -1 },
+    { 6316, 618, -1 }, { 0, 243, 1103 }, { 1456, 243, -1 }, { 1469, 243, -1 },
+    { 1521, 244, -1 }, { 0, 243, 1108 }, { 4951, 356, -1 }, { 0, 243, 1109 },
+    { 6273, 628, -1 }, { 4657, 326, -1 }, { 0, 244, 1117 }, { 0, 244, 1118 },
+    { 2623, 275, -1 }, { 6314, 628, -1 }, { 1507, 244, -1 }, { 0, 275, 2155 },
+    { 0, 275, 2156 }, { 0, 275, 2157 }, { 0, 275, 2158 }, { 0, 275, 2159 },
+    { 6269, 620, -1 }, { 6270, 620, -1 }, { 0, 356, 4248 }, { 0, 356, 4249 },
+    { 0, 357, 4250 }, { 1550, 245, -1 }, { 0, 357, 4251 }, { 0, 357, 4252 },
+    { 4661, 326, -1 }, { 6339, 678, -1 }, { 4661, 326, -1 }, { 1509, 244, 1120 },
+    { 4667, 326, -1 }, { 1509, 244, 1122 }, { 2617, 273, -1 }, { 1533, 244, -1 },
+    { 1539, 244, -1 }, { 6407, 675, -1 }, { 0, 273, 2128 }, { 0, 273, 2129 },
+    { 0, 273, 2130 }, { 0, 319, 3387 }, { 4661, 326, -1 }, { 2495, 245, -1 },
+    { 1544, 244, -1 }, { 0, 245, 1134 }, { 1551, 245, 1135 }, { 1557, 245, -1 },
+    { 1650, 245, -1 }, { 0, 245, 1140 }, { 0, 245, 1141 }, { 6369, 641, -1 },
+    { 4953, 357, -1 }, { 0, 247, 1159 }, { 2609, 273, -1 }, { 6358, 641, -1 },
+    { 1562, 245, 1142 }, { 2613, 273, -1 }, { 1810, 247, -1 }, { 1578, 245, -1 },
+    { 0, 275, 2160 }, { 2625, 275, 2161 }, { 6364, 677, -1 }, { 0, 275, 2163 },
+    { 6291, 619, -1 }, { 0, 245, 1145 }, { 0, 245, 1146 }, { 1582, 245, 1147 },
+    { 1628, 247, -1 }, { 6329, 619, -1 }, { 4563, 319, -1 }, { 4953, 357, -1 },
+    { 0, 410, 4855 }, { 0, 273, 2133 }, { 0, 273, 2134 }, { 0, 273, 2135 },
+    { 1642, 247, -1 }, { 4563, 319, -1 }, { 6362, 644, -1 }, { 0, 245, 1149 },
+    { 4567, 319, -1 }, { 6372, 644, -1 }, { 4568, 319, -1 }, { 5244, 410, -1 },
+    { 4791, 339, -1 }, { 4568, 319, -1 }, { 1645, 247, -1 }, { 6155, 595, -1 },
+    { 2887, 248, -1 }, { 6189, 595, -1 }, { 2943, 248, -1 }, { 0, 247, 1169 },
+    { 6207, 595, -1 }, { 4795, 339, 3884 }, { 1686, 248, -1 }, { 1676, 247, -1 },
+    { 6375, 684, -1 }, { 1696, 248, -1 }, { 0, 339, 3889 }, { 0, 247, 1171 },
+    { 0, 339, 3890 }, { 1848, 248, 1190 }, { 0, 248, 1193 }, { 6381, 692, -1 },
+    { 4789, 339, -1 }, { 6420, 696, -1 }, { 5244, 410, -1 }, { 3638, 257, -1 },
+    { 2930, 248, 1194 }, { 1721, 248, 1198 }, { 2979, 248, -1 }, { 0, 247, 1172 },
+    { 1818, 247, 1173 }, { 1801, 248, -1 }, { 5167, 398, -1 }, { 1733, 248, -1 },
+    { 5168, 398, 4699 }, { 1743, 248, -1 }, { 5168, 398, -1 }, { 3998, 248, -1 },
+    { 0, 548, 7347 }, { 1752, 248, 1326 }, { 6432, 702, -1 }, { 1904, 248, 1328 },
+    { 0, 366, 4371 }, { 0, 366, 4372 }, { 1754, 248, -1 }, { 0, 366, 4373 },
+    { 5005, 366, -1 }, { 6390, 712, -1 }, { 1861, 248, 1340 }, { 6284, 645, -1 },
+    { 6332, 645, -1 }, { 2177, 257, -1 }, { 2188, 257, -1 }, { 1759, 248, -1 },
+    { 5004, 366, -1 }, { 6390, 700, -1 }, { 0, 548, 7348 }, { 0, 248, 1345 },
+    { 1779, 248, -1 }, { 5973, 548, -1 }, { 4165, 248, -1 }, { 1812, 249, 1380 },
+    { 2190, 257, -1 }, { 0, 248, 1379 }, { 0, 249, 1382 }, { 4171, 249, 1383 },
+    { 5018, 370, -1 }, { 5019, 370, 4389 }, { 0, 249, 1399 }, { 6444, 707, -1 },
+    { 0, 249, 1400 }, { 0, 249, 1401 }, { 0, 249, 1402 }, { 0, 370, 4391 },
+    { 6048, 556, -1 }, { 6095, 556, -1 }, { 6108, 556, -1 }, { 6402, 708, -1 },
+    { 2203, 257, 1787 }, { 5017, 370, -1 }, { 0, 249, 1403 }, { 1834, 250, 1423 },
+    { 6428, 686, -1 }, { 2024, 249, -1 }, { 0, 257, 1789 }, { 0, 257, 1790 },
+    { 6433, 686, -1 }, { 0, 409, 4851 }, { 6446, 709, -1 }, { 0, 409, 4852 },
+    { 1865, 249, -1 }, { 2191, 250, 1425 }, { 1871, 250, -1 }, { 0, 249, 1412 },
+    { 0, 249, 1413 }, { 6445, 713, -1 }, { 4177, 250, 1433 }, { 0, 249, 1414 },
+    { 6429, 715, -1 }, { 1825, 249, 1415 }, { 0, 249, 1417 }, { 1842, 250, -1 },
+    { 1850, 250, -1 }, { 1921, 250, 1491 }, { 0, 250, 1495 }, { 1829, 249, 1418 },
+    { 5166, 397, -1 }, { 0, 343, 3897 }, { 6400, 721, -1 }, { 0, 343, 3898 },
+    { 6444, 721, -1 }, { 0, 250, 1496 }, { 4796, 343, 3899 }, { 4960, 359, -1 },
+    { 2106, 250, -1 }, { 3090, 250, -1 }, { 0, 409, 4853 }, { 1855, 250, -1 },
+    { 5509, 448, -1 }, { 0, 409, 4854 }, { 1874, 250, -1 }, { 4375, 250, -1 },
+    { 1885, 249, 1420 }, { 4799, 343, -1 }, { 6492, 722, -1 }, { 1886, 250, -1 },
+    { 1914, 250, -1 }, { 1998, 250, -1 }, { 1890, 250, -1 }, { 0, 286, 2339 },
+    { 4963, 359, -1 }, { 4799, 343, -1 }, { 4965, 359, -1 }, { 3058, 250, 1535 },
+    { 1902, 250, 1542 }, { 2272, 251, -1 }, { 0, 250, 1544 }, { 4393, 251, -1 },
+    { 1961, 251, -1 }, { 5513, 448, -1 }, { 0, 250, 1545 }, { 6479, 745, -1 },
+    { 2481, 251, -1 }, { 5514, 448, -1 }, { 4399, 251, -1 }, { 5167, 397, -1 },
+    { 1912, 251, -1 }, { 0, 359, 4277 }, { 4405, 251, 1613 }, { 5164, 397, -1 },
+    { 6477, 757, -1 }, { 2246, 251, -1 }, { 6427, 711, -1 }, { 0, 251, 1640 },
+    { 4966, 359, -1 }, { 1929, 251, 1641 }, { 6483, 725, -1 }, { 0, 251, 1643 },
+    { 0, 286, 2340 }, { 0, 292, 2400 }, { 0, 448, 5581 }, { 0, 286, 2341 },
+    { 0, 286, 2342 }, { 0, 286, 2343 }, { 1933, 251, -1 }, { 1947, 251, -1 },
+    { 6340, 682, -1 }, { 6396, 682, -1 }, { 5265, 414, -1 }, { 0, 251, 1646 },
+    { 5263, 414, -1 }, { 6458, 726, -1 }, { 6456, 726, -1 }, { 3004, 286, -1 },
+    { 0, 251, 1647 }, { 5268, 414, 4908 }, { 1979, 252, -1 }, { 1954, 251, -1 },
+    { 0, 251, 1649 }, { 5268, 414, -1 }, { 4411, 252, -1 }, { 0, 251, 1650 },
+    { 4768, 333, -1 }, { 5272, 414, -1 }, { 3009, 286, -1 }, { 5041, 377, -1 },
+    { 0, 251, 1651 }, { 0, 292, 2401 }, { 0, 377, 4455 }, { 0, 377, 4456 },
+    { 0, 252, 1676 }, { 2004, 251, -1 }, { 0, 252, 1677 }, { 0, 252, 1678 },
+    { 6448, 735, -1 }, { 0, 252, 1679 }, { 0, 252, 1680 }, { 1983, 252, 1681 },
+    { 0, 252, 1683 }, { 0, 252, 1684 }, { 6501, 751, -1 }, { 0, 252, 1685 },
+    { 0, 252, 1686 }, { 2048, 253, -1 }, { 6493, 761, -1 }, { 2049, 253, -1 },
+    { 0, 253, 1697 }, { 4449, 292, -1 }, { 3504, 292, -1 }, { 4455, 292, -1 },
+    { 6500, 170, -1 }, { 4461, 292, 2615 }, { 2054, 253, -1 }, { 3523, 292, -1 },
+    { 2013, 252, -1 }, { 6490, 195, -1 }, { 0, 253, 1699 }, { 5041, 377, -1 },
+    { 0, 253, 1700 }, { 4767, 333, 3833 }, { 3579, 292, 2654 }, { 4770, 333, -1 },
+    { 0, 377, 4458 }, { 5143, 391, -1 }, { 0, 391, 4639 }, { 6507, 199, -1 },
+    { 6531, 213, -1 }, { 0, 253, 1701 }, { 4772, 333, -1 }, { 4772, 333, -1 },
+    { 6479, 158, -1 }, { 2056, 253, -1 }, { 2199, 254, -1 }, { 2101, 254, -1 },
+    { 2009, 252, -1 }, { 2063, 253, -1 }, { 2131, 254, -1 }, { 6485, 167, -1 },
+    { 2065, 253, -1 }, { 0, 391, 4640 }, { 0, 391, 4641 }, { 0, 333, 3840 },
+    { 2084, 253, -1 }, { 5339, 425, -1 }, { 2276, 262, -1 }, { 2112, 254, 1738 },
+    { 0, 425, 5154 }, { 4416, 253, -1 }, { 6492, 178, -1 }, { 0, 254, 1740 },
+    { 0, 254, 1741 }, { 0, 254, 1742 }, { 0, 254, 1743 }, { 0, 254, 1744 },
+    { 0, 387, 4549 }, { 0, 254, 1745 }, { 5143, 391, -1 }, { 0, 254, 1746 },
+    { 6513, 202, -1 }, { 0, 387, 4550 }, { 0, 254, 1747 }, { 0, 254, 1748 },
+    { 3653, 262, -1 }, { 0, 254, 1749 }, { 0, 396, 4688 }, { 4421, 262, -1 },
+    { 6513, 741, -1 }, { 0, 387, 4551 }, { 5164, 396, -1 }, { 2256, 262, 1846 },
+    { 6514, 753, -1 }, { 5342, 425, -1 }, { 6222, 594, -1 }, { 6267, 594, -1 },
+    { 2116, 254, -1 }, { 6224, 594, -1 }, { 6571, 755, -1 }, { 2124, 254, -1 },
+    { 0, 396, 4690 }, { 0, 396, 4691 }, { 2290, 262, 1848 }, { 5343, 425, -1 },
+    { 6522, 782, -1 }, { 3116, 262, -1 }, { 0, 262, 1857 }, { 5091, 387, -1 },
+    { 5097, 387, -1 }, { 0, 262, 1858 }, { 0, 262, 1859 }, { 6524, 653, -1 },
+    { 2290, 264, 1885 }, { 2354, 264, -1 }, { 2297, 264, -1 }, { 2267, 262, -1 },
+    { 6533, 660, -1 }, { 4804, 344, -1 }, { 2308, 262, 1861 }, { 2274, 262, 1865 },
+    { 0, 264, 1891 }, { 5161, 396, -1 }, { 0, 396, 4693 }, { 2308, 264, 1892 },
+    { 2375, 264, 1894 }, { 0, 264, 1898 }, { 0, 264, 1899 }, { 0, 264, 1900 },
+    { 0, 264, 1901 }, { 0, 264, 1902 }, { 3873, 303, -1 }, { 5218, 405, -1 },
+    { 2394, 265, -1 }, { 2344, 264, -1 }, { 0, 265, 1909 }, { 2360, 264, -1 },
+    { 0, 265, 1910 }, { 3896, 303, -1 }, { 6588, 668, -1 }, { 4807, 344, -1 },
+    { 4805, 344, -1 }, { 2378, 265, -1 }, { 5217, 405, 4792 }, { 4811, 344, -1 },
+    { 6538, 175, -1 }, { 5220, 405, -1 }, { 2360, 264, -1 }, { 6434, 727, -1 },
+    { 0, 265, 1912 }, { 6488, 727, -1 }, { 5221, 405, 4795 }, { 0, 411, 4858 },
+    { 0, 271, 1953 }, { 3880, 303, -1 }, { 0, 303, 3050 }, { 2520, 271, 1954 },
+    { 6526, 659, -1 }, { 5224, 405, -1 }, { 0, 303, 3051 }, { 6561, 659, -1 },
+    { 0, 303, 3052 }, { 4427, 271, 1956 }, { 4805, 344, -1 }, { 2959, 271, -1 },
+    { 4809, 344, -1 }, { 0, 344, 3920 }, { 6552, 182, -1 }, { 5224, 405, -1 },
+    { 2425, 265, 1913 }, { 6581, 149, -1 }, { 2524, 271, -1 }, { 0, 265, 1916 },
+    { 6576, 759, -1 }, { 0, 265, 1917 }, { 2552, 271, -1 }, { 0, 265, 1918 },
+    { 2555, 271, -1 }, { 5225, 405, -1 }, { 6600, 762, -1 }, { 2525, 271, 2038 },
+    { 0, 265, 1919 }, { 4735, 330, -1 }, { 0, 272, 2094 }, { 0, 272, 2095 },
+    { 4736, 330, -1 }, { 4078, 303, 3053 }, { 0, 551, 7377 }, { 4433, 271, -1 },
+    { 2595, 272, -1 }, { 2563, 271, -1 }, { 2587, 271, -1 }, { 6571, 764, -1 },
+    { 2546, 272, 2098 }, { 4739, 330, 3770 }, { 4532, 314, -1 }, { 2535, 271, -1 },
+    { 2566, 272, -1 }, { 0, 330, 3775 }, { 5992, 551, 7378 }, { 0, 551, 7381 },
+    { 2570, 271, 2073 }, { 5245, 411, -1 }, { 0, 411, 4860 }, { 2578, 272, 2101 },
+    { 4439, 271, 2077 }, { 0, 271, 2091 }, { 2537, 271, 2092 }, { 6548, 765, -1 },
+    { 5406, 433, -1 }, { 0, 411, 4861 }, { 0, 411, 4862 }, { 4533, 314, -1 },
+    { 5403, 433, -1 }, { 6606, 768, -1 }, { 4740, 330, -1 }, { 5407, 433, -1 },
+    { 4739, 330, -1 }, { 5203, 403, -1 }, { 2597, 272, 2103 }, { 4534, 314, -1 },
+    { 4535, 314, -1 }, { 0, 281, 2187 }, { 5040, 376, -1 }, { 4537, 314, -1 },
+    { 5042, 376, -1 }, { 5408, 433, -1 }, { 0, 330, 3778 }, { 2688, 281, -1 },
+    { 0, 403, 4763 }, { 3021, 281, -1 }, { 0, 376, 4447 }, { 6598, 767, -1 },
+    { 2603, 272, -1 }, { 2605, 272, -1 }, { 5206, 403, -1 }, { 6605, 767, -1 },
+    { 6560, 772, -1 }, { 3151, 272, -1 }, { 2606, 272, -1 }, { 0, 314, 3339 },
+    { 0, 376, 4448 }, { 0, 314, 3340 }, { 3408, 272, -1 }, { 2689, 281, -1 },
+    { 2713, 281, -1 }, { 5988, 551, 7382 }, { 2715, 281, -1 }, { 6586, 799, -1 },
+    { 2730, 281, -1 }, { 2847, 281, 2199 }, { 2737, 281, 2203 }, { 6641, 808, -1 },
+    { 0, 281, 2205 }, { 0, 281, 2206 }, { 6655, 811, -1 }, { 2741, 281, -1 },
+    { 5123, 392, -1 }, { 5132, 392, -1 }, { 2749, 281, -1 }, { 0, 376, 4449 },
+    { 5042, 376, 4450 }, { 0, 376, 4452 }, { 0, 281, 2209 }, { 2763, 281, 2210 },
+    { 6603, 813, -1 }, { 2811, 282, -1 }, { 5207, 403, 4765 }, { 2811, 282, -1 },
+    { 2868, 282, -1 }, { 5210, 403, -1 }, { 0, 392, 4647 }, { 0, 376, 4453 },
+    { 2772, 281, -1 }, { 2840, 282, -1 }, { 2916, 281, -1 }, { 4485, 298, -1 },
+    { 6653, 815, -1 }, { 2784, 281, -1 }, { 0, 298, 2952 }, { 2875, 282, -1 },
+    { 6609, 819, -1 }, { 3441, 281, 2221 }, { 0, 281, 2225 }, { 6600, 810, -1 },
+    { 0, 444, 5530 }, { 6610, 810, -1 }, { 0, 444, 5531 }, { 0, 298, 2953 },
+    { 0, 444, 5532 }, { 0, 444, 5533 }, { 0, 282, 2233 }, { 5136, 392, -1 },
+    { 6623, 820, -1 }, { 5147, 392, 4651 }, { 2922, 282, -1 }, { 3541, 298, -1 },
+    { 6609, 839, -1 }, { 3690, 298, -1 }, { 6626, 841, -1 }, { 2922, 284, -1 },
+    { 2932, 284, -1 }, { 0, 284, 2301 }, { 5496, 444, -1 }, { 5146, 392, -1 },
+    { 3556, 298, -1 }, { 5501, 444, -1 }, { 6648, 843, -1 }, { 2838, 282, -1 },
+    { 0, 284, 2302 }, { 0, 284, 2303 }, { 3542, 284, -1 }, { 3572, 298, 2962 },
+    { 6618, 852, -1 }, { 0, 483, 6107 }, { 0, 483, 6108 }, { 3604, 298, -1 },
+    { 0, 446, 5568 }, { 2850, 282, -1 }, { 2937, 282, 2238 }, { 2854, 282, -1 },
+    { 0, 282, 2245 }, { 2861, 282, 2246 }, { 3052, 283, -1 }, { 4832, 348, -1 },
+    { 2861, 282, 2248 }, { 2866, 283, -1 }, { 5334, 424, 5142 }, { 2878, 283, 2253 },
+    { 4836, 348, 3968 }, { 2948, 284, 2307 }, { 4841, 348, 3977 }, { 2903, 283, -1 },
+    { 2966, 284, 2309 }, { 6660, 853, -1 }, { 0, 298, 2967 }, { 6662, 867, -1 },
+    { 3517, 283, -1 }, { 0, 284, 2311 }, { 3081, 283, -1 }, { 5339, 424, -1 },
+    { 6629, 870, -1 }, { 2919, 283, 2265 }, { 2970, 285, 2325 }, { 0, 285, 2327 },
+    { 0, 483, 6109 }, { 0, 283, 2267 }, { 2986, 284, -1 }, { 6657, 871, -1 },
+    { 4443, 284, -1 }, { 6671, 877, -1 }, { 0, 283, 2268 }, { 0, 290, 2353 },
+    { 6684, 880, -1 }, { 4838, 348, -1 }, { 4840, 348, -1 }, { 6704, 883, -1 },
+    { 0, 424, 5149 }, { 4845, 348, 3981 }, { 5341, 424, 5150 }, { 0, 483, 6110 },
+    { 0, 283, 2269 }, { 5342, 424, -1 }, { 0, 284, 2324 }, { 0, 285, 2328 },
+    { 0, 285, 2329 }, { 0, 285, 2330 }, { 0, 285, 2331 }, { 0, 285, 2332 },
+    { 0, 285, 2333 }, { 0, 446, 5569 }, { 3157, 283, -1 }, { 0, 446, 5570 },
+    { 0, 446, 5571 }, { 0, 283, 2273 }, { 0, 446, 5572 }, { 3042, 290, -1 },
+    { 6709, 897, -1 }, { 3912, 283, 2274 }, { 4845, 348, 3986 }, { 3375, 290, -1 },
+    { 6591, 803, -1 }, { 6637, 803, -1 }, { 3589, 283, 2287 }, { 3044, 290, -1 },
+    { 3053, 290, -1 }, { 3074, 290, -1 }, { 0, 285, 2334 }, { 0, 290, 2361 },
+    { 6545, 734, -1 }, { 6558, 734, -1 }, { 3002, 285, -1 }, { 6555, 734, -1 },
+    { 3084, 285, -1 }, { 0, 290, 2362 }, { 3574, 296, 2740 }, { 3566, 296, 2743 },
+    { 3090, 290, -1 }, { 3585, 296, 2748 }, { 3099, 290, -1 }, { 5668, 484, -1 },
+    { 6459, 211, -1 }, { 3104, 290, -1 }, { 6495, 211, -1 }, { 6491, 211, -1 },
+    { 0, 285, 2338 }, { 0, 291, 2366 }, { 3558, 291, -1 }, { 4186, 291, -1 },
+    { 0, 395, 4680 }, { 0, 291, 2379 }, { 3450, 296, -1 }, { 6697, 925, -1 },
+    { 3124, 291, 2380 }, { 0, 484, 6112 }, { 0, 296, 2753 }, { 6749, 927, -1 },
+    { 3138, 291, -1 }, { 3968, 296, -1 }, { 6741, 927, -1 }, { 0, 291, 2383 },
+    { 0, 291, 2384 }, { 3457, 296, -1 }, { 6094, 563, -1 }, { 6084, 563, -1 },
+    { 6119, 563, -1 }, { 3463, 296, -1 }, { 0, 484, 6113 }, { 6714, 909, -1 },
+    { 3145, 291, 2385 }, { 0, 395, 4681 }, { 0, 395, 4682 }, { 5159, 395, 4683 },
+    { 0, 291, 2388 }, { 3170, 291, -1 }, { 0, 317, 3367 }, { 0, 296, 2765 },
+    { 3468, 296, -1 }, { 4552, 317, -1 }, { 5663, 480, -1 }, { 6238, 591, -1 },
+    { 6255, 591, -1 }, { 6221, 591, -1 }, { 3183, 291, 2390 }, { 0, 291, 2393 },
+    { 0, 480, 6084 }, { 5674, 484, 6114 }, { 4467, 293, -1 }, { 0, 317, 3369 },
+    { 3210, 293, 2680 }, { 3188, 291, -1 }, { 3199, 291, 2395 }, { 6798, 898, -1 },
+    { 5162, 395, -1 }, { 0, 291, 2397 }, { 5161, 395, 4686 }, { 6755, 898, -1 },
+    { 4549, 317, -1 }, { 6786, 933, -1 }, { 0, 293, 2683 }, { 0, 293, 2684 },
+    { 4553, 317, -1 }, { 0, 293, 2685 }, { 3645, 293, 2686 }, { 0, 291, 2398 },
+    { 0, 291, 2399 }, { 3215, 293, -1 }, { 4556, 317, -1 }, { 3241, 293, 2691 },
+    { 5879, 519, -1 }, { 0, 519, 6920 }, { 3276, 293, -1 }, { 4557, 317, -1 },
+    { 0, 293, 2694 }, { 3297, 293, 2695 }, { 3835, 295, 2702 }, { 0, 519, 6921 },
+    { 0, 295, 2709 }, { 3402, 295, 2710 }, { 4473, 295, -1 }, { 6787, 950, -1 },
+    { 5880, 519, -1 }, { 3322, 293, -1 }, { 5666, 480, 6085 }, { 0, 317, 3376 },
+    { 5885, 519, -1 }, { 0, 317, 3377 }, { 0, 317, 3378 }, { 0, 519, 6956 },
+    { 0, 317, 3379 }, { 0, 480, 6087 }, { 6846, 951, -1 }, { 0, 295, 2717 },
+    { 3824, 297, -1 }, { 4479, 297, -1 }, { 6833, 951, -1 }, { 3420, 295, -1 },
+    { 0, 297, 2820 }, { 3381, 293, -1 }, { 3426, 295, -1 }, { 5101, 388, -1 },
+    { 3602, 297, -1 }, { 5102, 388, -1 }, { 5103, 388, -1 }, { 3489, 297, -1 },
+    { 6606, 770, -1 }, { 6611, 770, -1 }, { 3525, 295, 2720 }, { 6615, 770, -1 },
+    { 3495, 297, -1 }, { 5853, 516, -1 }, { 3505, 297, -1 }, { 3552, 295, 2724 },
+    { 0, 388, 4581 }, { 0, 297, 2827 }, { 5106, 388, -1 }, { 3515, 297, -1 },
+    { 0, 295, 2729 }, { 6820, 919, -1 }, { 0, 516, 6872 }, { 5854, 516, 6873 },
+    { 6815, 919, -1 }, { 0, 295, 2730 }, { 6373, 685, -1 }, { 6423, 685, -1 },
+    { 3767, 301, -1 }, { 3810, 297, -1 }, { 6388, 685, -1 }, { 3429, 295, -1 },
+    { 6806, 962, -1 }, { 3787, 301, -1 }, { 6857, 979, -1 }, { 3667, 295, 2732 },
+    { 3438, 295, 2736 }, { 6854, 981, -1 }, { 3623, 299, 2968 }, { 0, 299, 2972 },
+    { 0, 299, 2973 }, { 0, 299, 2974 }, { 0, 299, 2975 }, { 0, 299, 2976 },
+    { 0, 299, 2977 }, { 5107, 388, -1 }, { 6847, 952, -1 }, { 3861, 301, -1 },
+    { 5109, 388, 4587 }, { 0, 388, 4590 }, { 6834, 952, -1 }, { 3535, 297, -1 },
+    { 3608, 299, -1 }, { 0, 301, 3017 }, { 3684, 300, -1 }, { 3799, 301, -1 },
+    { 3612, 299, -1 }, { 6809, 983, -1 }, { 0, 301, 3019 }, { 4092, 301, 3020 },
+    { 0, 301, 3024 }, { 0, 516, 6876 }, { 0, 301, 3025 }, { 3691, 300, 2992 },
+    { 6866, 984, -1 }, { 4038, 301, -1 }, { 0, 299, 2981 }, { 3648, 299, -1 },
+    { 0, 516, 6877 }, { 5852, 516, 6878 }, { 3721, 300, 2994 }, { 3819, 301, -1 },
+    { 6864, 992, -1 }, { 3740, 300, -1 }, { 6812, 973, -1 }, { 3651, 299, -1 },
+    { 6884, 994, -1 }, { 3751, 299, -1 }, { 6660, 821, -1 }, { 6647, 821, -1 },
+    { 3664, 299, -1 }, { 3678, 299, -1 }, { 3846, 302, -1 }, { 5045, 378, -1 },
+    { 3856, 302, -1 }, { 6883, 995, -1 }, { 5048, 378, -1 }, { 4061, 302, 3031 },
+    { 0, 400, 4712 }, { 5178, 400, -1 }, { 6887, 1004, -1 }, { 5952, 534, -1 },
+    { 0, 400, 4715 }, { 0, 400, 4716 }, { 5954, 534, -1 }, { 0, 378, 4466 },
+    { 0, 378, 4467 }, { 0, 299, 2988 }, { 0, 299, 2989 }, { 3759, 300, -1 },
+    { 3746, 300, -1 }, { 0, 299, 2990 }, { 6844, 1007, -1 }, { 3755, 300, 3000 },
+    { 5955, 534, -1 }, { 5956, 534, 7197 }, { 4159, 300, 3002 }, { 6896, 1015, -1 },
+    { 0, 300, 3006 }, { 0, 300, 3007 }, { 0, 300, 3008 }, { 0, 300, 3009 },
+    { 0, 300, 3010 }, { 0, 300, 3011 }, { 6674, 860, -1 }, { 6658, 860, -1 },
+    { 0, 302, 3034 }, { 0, 302, 3035 }, { 0, 302, 3036 }, { 6904, 746, -1 },
+    { 0, 302, 3037 }, { 0, 302, 3038 }, { 0, 302, 3039 }, { 0, 302, 3040 },
+    { 0, 302, 3041 }, { 0, 307, 3064 }, { 6626, 868, -1 }, { 6680, 868, -1 },
+    { 3867, 302, -1 }, { 3869, 302, -1 }, { 0, 307, 3065 }, { 6868, 754, -1 },
+    { 5046, 378, -1 }, { 0, 423, 5132 }, { 4019, 307, 3066 }, { 3914, 307, -1 },
+    { 3948, 307, -1 }, { 6200, 160, -1 }, { 6242, 160, -1 }, { 6249, 160, -1 },
+    { 0, 378, 4469 }, { 6212, 160, -1 }, { 0, 307, 3071 }, { 4074, 307, 3072 },
+    { 6903, 801, -1 }, { 4209, 308, -1 }, { 4002, 308, -1 }, { 0, 400, 4717 },
+    { 5333, 423, 5133 }, { 6074, 564, -1 }, { 5177, 400, -1 }, { 6100, 564, -1 },
+    { 6091, 564, -1 }, { 6124, 564, -1 }, { 0, 423, 5137 }, { 6871, 1016, -1 },
+    { 4490, 308, -1 }, { 0, 423, 5138 }, { 4131, 308, -1 }, { 4496, 308, -1 },
+    { 4624, 323, -1 }, { 3960, 307, -1 }, { 4254, 308, 3117 }, { 3962, 307, 3077 },
+    { 4501, 308, -1 }, { 0, 423, 5139 }, { 0, 307, 3079 }, { 6897, 1024, -1 },
+    { 4626, 323, -1 }, { 4507, 308, -1 }, { 6889, 1034, -1 }, { 4067, 307, -1 },
+    { 4016, 308, -1 }, { 4631, 323, -1 }, { 0, 307, 3082 }, { 4026, 308, -1 },
+    { 6842, 996, -1 }, { 5332, 423, -1 }, { 6882, 996, -1 }, { 0, 323, 3554 },
+    { 6762, 913, -1 }, { 6729, 913, -1 }, { 3986, 307, -1 }, { 0, 423, 5141 },
+    { 0, 308, 3164 }, { 4632, 323, -1 }, { 0, 308, 3165 }, { 0, 308, 3166 },
+    { 4027, 308, 3167 }, { 0, 308, 3169 }, { 6860, 805, -1 }, { 4633, 323, -1 },
+    { 4042, 308, -1 }, { 0, 308, 3171 }, { 6873, 805, -1 }, { 6043, 553, -1 },
+    { 6099, 553, -1 }, { 6093, 553, -1 }, { 1, 553, -1 }, { 4060, 308, -1 },
+    { 6088, 553, -1 }, { 6871, 1043, -1 }, { 4138, 308, -1 }, { 4082, 309, -1 },
+    { 6853, 779, -1 }, { 4243, 309, -1 }, { 6886, 779, -1 }, { 4088, 309, -1 },
+    { 4084, 308, -1 }, { 4269, 309, -1 }, { 4512, 309, -1 }, { 6892, 1042, -1 },
+    { 0, 309, 3198 }, { 0, 309, 3199 }, { 0, 323, 3563 }, { 6917, 1042, -1 },
+    { 4636, 323, 3564 }, { 0, 309, 3200 }, { 0, 309, 3201 }, { 0, 309, 3202 },
+    { 4104, 309, 3203 }, { 6927, 1045, -1 }, { 4121, 309, 3205 }, { 0, 309, 3207 },
+    { 0, 406, 4803 }, { 6659, 844, -1 }, { 6626, 844, -1 }, { 4197, 310, -1 },
+    { 6663, 844, -1 }, { 4182, 309, -1 }, { 4329, 310, 3218 }, { 4206, 310, -1 },
+    { 5228, 406, 4804 }, { 4211, 310, -1 }, { 4380, 310, -1 }, { 4125, 309, -1 },
+    { 6725, 916, -1 }, { 6792, 916, -1 }, { 5225, 406, -1 }, { 4143, 309, -1 },
+    { 6793, 916, -1 }, { 5228, 406, 4807 }, { 0, 406, 4809 }, { 4191, 309, -1 },
+    { 4232, 310, -1 }, { 4297, 310, -1 }, { 6934, 1057, -1 }, { 4228, 309, -1 },
+    { 4238, 310, -1 }, { 4195, 309, -1 }, { 4255, 310, -1 }, { 6842, 945, -1 },
+    { 0, 413, 4879 }, { 4261, 310, -1 }, { 6857, 945, -1 }, { 6828, 945, -1 },
+    { 0, 310, 3235 }, { 6900, 1063, -1 }, { 0, 413, 4880 }, { 0, 310, 3236 },
+    { 0, 310, 3237 }, { 5253, 413, -1 }, { 0, 310, 3238 }, { 0, 310, 3239 },
+    { 4263, 310, 3240 }, { 4267, 310, 3242 }, { 0, 310, 3244 }, { 4520, 311, 3261 },
+    { 6901, 1065, -1 }, { 4277, 310, -1 }, { 4278, 310, -1 }, { 4284, 310, -1 },
+    { 5258, 413, -1 }, { 6058, 560, -1 }, { 6098, 560, -1 }, { 6107, 560, -1 },
+    { 6075, 560, -1 }, { 4294, 311, -1 }, { 6929, 1069, -1 }, { 0, 406, 4810 },
+    { 6917, 1074, -1 }, { 0, 406, 4811 }, { 4308, 311, -1 }, { 0, 406, 4812 },
+    { 6973, 1083, -1 }, { 4516, 310, -1 }, { 6935, 1083, -1 }, { 4287, 310, -1 },
+    { 4344, 310, -1 }, { 6755, 918, -1 }, { 6805, 918, -1 }, { 0, 311, 3276 },
+    { 0, 311, 3277 }, { 6795, 918, -1 }, { 0, 311, 3278 }, { 0, 311, 3279 },
+    { 0, 311, 3280 }, { 0, 311, 3281 }, { 0, 311, 3282 }, { 0, 311, 3283 },
+    { 0, 311, 3284 }, { 0, 311, 3285 }, { 4322, 311, 3286 }, { 6936, 1088, -1 },
+    { 4333, 312, -1 }, { 6611, 785, -1 }, { 6629, 785, -1 }, { 4341, 312, -1 },
+    { 6571, 785, -1 }, { 6608, 785, -1 }, { 5260, 413, -1 }, { 4359, 312, -1 },
+    { 4322, 311, -1 }, { 4358, 312, -1 }, { 4491, 313, -1 }, { 4545, 316, 3353 },
+    { 0, 316, 3355 }, { 4542, 316, 3356 }, { 4546, 316, 3358 }, { 0, 316, 3361 },
+    { 4518, 313, -1 }, { 0, 316, 3362 }, { 6061, 562, -1 }, { 6116, 562, -1 },
+    { 6115, 562, -1 }, { 6067, 562, -1 }, { 4388, 311, -1 }, { 6907, 1061, -1 },
+    { 4521, 312, 3302 }, { 0, 312, 3305 }, { 6950, 1061, -1 }, { 0, 312, 3306 },
+    { 4526, 312, 3307 }, { 4386, 312, 3312 }, { 5199, 402, -1 }, { 6912, 1006, -1 },
+    { 6911, 1006, -1 }, { 4525, 313, -1 }, { 6873, 1006, -1 }, { 4528, 313, -1 },
+    { 0, 402, 4754 }, { 7000, 1091, -1 }, { 4530, 313, -1 }, { 0, 482, 6102 },
+    { 4457, 312, 3314 }, { 0, 482, 6103 }, { 6916, 1060, -1 }, { 6905, 1060, -1 },
+    { 0, 402, 4755 }, { 6978, 1129, -1 }, { 4548, 316, -1 }, { 4471, 312, -1 },
+    { 4483, 312, -1 }, { 0, 313, 3325 }, { 0, 313, 3326 }, { 7021, 1135, -1 },
+    { 4546, 316, -1 }, { 0, 313, 3327 }, { 0, 313, 3328 }, { 4571, 320, -1 },
+    { 0, 313, 3329 }, { 6995, 1111, -1 }, { 0, 313, 3330 }, { 0, 315, 3341 },
+    { 0, 315, 3342 }, { 0, 315, 3343 }, { 4572, 320, 3398 }, { 4550, 316, -1 },
+    { 0, 315, 3344 }, { 0, 402, 4756 }, { 7086, 1131, -1 }, { 4570, 320, -1 },
+    { 6887, 1049, -1 }, { 6929, 1049, -1 }, { 4533, 315, -1 }, { 0, 482, 6104 },
+    { 7089, 1132, -1 }, { 0, 482, 6105 }, { 4537, 315, -1 }, { 4574, 320, -1 },
+    { 0, 482, 6106 }, { 0, 320, 3403 }, { 0, 334, 3841 }, { 7058, 1147, -1 },
+    { 0, 334, 3842 }, { 5201, 402, 4757 }, { 6958, 1078, -1 }, { 6953, 1078, -1 },
+    { 4575, 320, -1 }, { 4577, 320, -1 }, { 6972, 1120, -1 }, { 4775, 334, -1 },
+    { 4577, 320, -1 }, { 5200, 402, -1 }, { 7018, 1120, -1 }, { 5204, 402, -1 },
+    { 7087, 1122, -1 }, { 7060, 1122, -1 }, { 4578, 320, -1 }, { 4537, 315, -1 },
+    { 4776, 334, -1 }, { 4588, 321, -1 }, { 4582, 320, 3409 }, { 7111, 1150, -1 },
+    { 4582, 320, -1 }, { 0, 321, 3421 }, { 4585, 320, -1 }, { 4540, 315, -1 },
+    { 4543, 315, -1 }, { 4584, 320, -1 }, { 6981, 1152, -1 }, { 7127, 1155, -1 },
+    { 4604, 322, -1 }, { 0, 321, 3422 }, { 7041, 1152, -1 }, { 7130, 1158, -1 },
+    { 4605, 322, -1 }, { 4591, 321, -1 }, { 6185, 142, -1 }, { 6185, 142, -1 },
+    { 6239, 142, -1 }, { 0, 315, 3351 }, { 4607, 322, -1 }, { 6231, 142, -1 },
+    { 4541, 315, -1 }, { 4776, 334, -1 }, { 4604, 322, -1 }, { 7098, 1164, -1 },
+    { 4777, 334, -1 }, { 6971, 1071, -1 }, { 6942, 1071, -1 }, { 4780, 334, -1 },
+    { 7020, 1071, -1 }, { 6940, 1071, -1 }, { 4609, 322, -1 }, { 0, 321, 3495 },
+    { 7165, 1176, -1 }, { 4592, 321, -1 }, { 7086, 1156, -1 }, { 4597, 321, 3497 },
+    { 4784, 334, -1 }, { 7095, 1156, -1 }, { 4598, 321, -1 }, { 4612, 322, 3516 },
+    { 4596, 321, -1 }, { 7047, 1133, -1 }, { 7042, 1133, -1 }, { 0, 335, 3861 },
+    { 4616, 322, -1 }, { 7101, 1133, -1 }, { 4618, 322, 3528 }, { 4602, 321, -1 },
+    { 5554, 461, -1 }, { 4636, 324, -1 }, { 7226, 1185, -1 }, { 4600, 321, -1 },
+    { 5554, 461, 5691 }, { 0, 461, 5693 }, { 7186, 1194, -1 }, { 4786, 335, -1 },
+    { 4614, 322, -1 }, { 4640, 324, 3568 }, { 6306, 626, -1 }, { 6348, 626, -1 },
+    { 6336, 626, -1 }, { 4616, 322, 3536 }, { 0, 322, 3539 }, { 6341, 626, -1 },
+    { 4642, 324, 3570 }, { 0, 324, 3581 }, { 0, 324, 3582 }, { 4644, 324, 3583 },
+    { 0, 324, 3586 }, { 7191, 1195, -1 }, { 4668, 327, -1 }, { 4673, 327, -1 },
+    { 4644, 324, -1 }, { 0, 335, 3863 }, { 0, 335, 3864 }, { 4664, 327, -1 },
+    { 4649, 324, -1 }, { 0, 351, 4061 }, { 0, 335, 3865 }, { 7188, 1207, -1 },
+    { 4884, 351, -1 }, { 0, 461, 5694 }, { 0, 461, 5695 }, { 0, 461, 5696 },
+    { 7147, 1168, -1 }, { 7136, 1168, -1 }, { 4646, 324, -1 }, { 0, 335, 3866 },
+    { 0, 347, 3953 }, { 4675, 327, -1 }, { 4786, 335, -1 }, { 4672, 327, -1 },
+    { 4651, 324, -1 }, { 4649, 324, -1 }, { 4886, 351, 4063 }, { 6265, 588, -1 },
+    { 6243, 588, -1 }, { 6269, 588, -1 }, { 6263, 588, -1 }, { 4890, 351, -1 },
+    { 7256, 1206, -1 }, { 4825, 347, 3954 }, { 4678, 327, -1 }, { 4887, 351, -1 },
+    { 4680, 327, -1 }, { 4678, 327, -1 }, { 4683, 327, -1 }, { 7241, 1227, -1 },
+    { 4653, 324, -1 }, { 4681, 327, 3647 }, { 4695, 328, 3682 }, { 4686, 327, -1 },
+    { 4699, 328, 3684 }, { 0, 328, 3688 }, { 4691, 327, -1 }, { 0, 347, 3956 },
+    { 4700, 328, 3689 }, { 4826, 347, -1 }, { 4890, 351, -1 }, { 7112, 1157, -1 },
+    { 4695, 327, 3678 }, { 7166, 1157, -1 }, { 0, 347, 3958 }, { 7154, 1157, -1 },
+    { 4698, 328, -1 }, { 7247, 1221, -1 }, { 4704, 328, -1 }, { 4705, 328, -1 },
+    { 7265, 1221, -1 }, { 4759, 332, -1 }, { 7294, 1264, -1 }, { 0, 347, 3959 },
+    { 4761, 332, -1 }, { 4831, 347, -1 }, { 7299, 1244, -1 }, { 7278, 1244, -1 },
+    { 0, 351, 4080 }, { 4833, 347, -1 }, { 4703, 328, -1 }, { 4763, 332, -1 },
+    { 4707, 328, -1 }, { 4708, 328, -1 }, { 4709, 328, -1 }, { 4711, 328, 3701 },
+    { 4764, 332, -1 }, { 7072, 1113, -1 }, { 6989, 1113, -1 }, { 4712, 328, 3703 },
+    { 6967, 1113, -1 }, { 0, 329, 3748 }, { 4709, 328, 3705 }, { 0, 328, 3707 },
+    { 0, 329, 3749 }, { 6277, 640, -1 }, { 6321, 640, -1 }, { 6293, 640, -1 },
+    { 6335, 640, -1 }, { 4714, 328, -1 }, { 4717, 328, 3710 }, { 0, 332, 3819 },
+    { 0, 332, 3820 }, { 4765, 332, 3821 }, { 0, 332, 3823 }, { 0, 332, 3824 },
+    { 4765, 332, 3825 }, { 0, 332, 3827 }, { 0, 332, 3828 }, { 0, 332, 3829 },
+    { 0, 332, 3830 }, { 7309, 1233, -1 }, { 7254, 1235, -1 }, { 4728, 329, -1 },
+    { 4721, 328, -1 }, { 4724, 328, -1 }, { 5955, 535, -1 }, { 7300, 1242, -1 },
+    { 4715, 329, -1 }, { 4730, 329, -1 }, { 0, 329, 3756 }, { 0, 535, 7200 },
+    { 7272, 1261, -1 }, { 0, 535, 7201 }, { 0, 329, 3757 }, { 4731, 329, 3758 },
+    { 7281, 1265, -1 }, { 0, 329, 3760 }, { 7261, 1268, -1 }, { 5958, 535, -1 },
+    { 0, 329, 3761 }, { 0, 331, 3779 }, { 0, 329, 3762 }, { 0, 329, 3763 },
+    { 5958, 535, -1 }, { 0, 329, 3764 }, { 0, 331, 3780 }, { 4733, 329, -1 },
+    { 4743, 331, 3781 }, { 0, 331, 3788 }, { 4747, 331, 3789 }, { 0, 331, 3791 },
+    { 4747, 331, 3792 }, { 0, 331, 3794 }, { 4730, 329, -1 }, { 0, 331, 3795 },
+    { 4748, 331, 3796 }, { 7300, 1272, -1 }, { 4750, 331, 3798 }, { 0, 345, 3921 },
+    { 6502, 212, -1 }, { 6531, 212, -1 }, { 6532, 212, -1 }, { 4751, 331, 3801 },
+    { 4753, 331, -1 }, { 0, 345, 3922 }, { 6082, 566, -1 }, { 6134, 566, -1 },
+    { 6131, 566, -1 }, { 4815, 345, 3923 }, { 6129, 566, -1 }, { 6144, 566, -1 },
+    { 0, 394, 4668 }, { 5152, 394, 4669 }, { 4756, 331, -1 }, { 7283, 1263, -1 },
+    { 0, 345, 3926 }, { 0, 345, 3927 }, { 5231, 407, 4813 }, { 7050, 1144, -1 },
+    { 4812, 345, -1 }, { 5236, 407, -1 }, { 7103, 1144, -1 }, { 7104, 1144, -1 },
+    { 0, 345, 3929 }, { 4816, 346, 3935 }, { 0, 346, 3937 }, { 0, 407, 4827 },
+    { 0, 407, 4828 }, { 7318, 1275, -1 }, { 0, 407, 4829 }, { 0, 345, 3930 },
+    { 5158, 394, -1 }, { 7335, 1304, -1 }, { 0, 394, 4672 }, { 0, 394, 4673 },
+    { 4754, 331, 3807 }, { 4822, 346, -1 }, { 0, 394, 4674 }, { 4823, 346, -1 },
+    { 7341, 1307, -1 }, { 4757, 331, -1 }, { 4821, 346, -1 }, { 0, 331, 3813 },
+    { 7334, 1266, -1 }, { 0, 346, 3943 }, { 7289, 1266, -1 }, { 4826, 346, -1 },
+    { 5723, 491, -1 }, { 0, 346, 3945 }, { 4815, 345, 3931 }, { 4827, 346, -1 },
+    { 5728, 491, 6266 }, { 4817, 345, -1 }, { 5237, 407, -1 }, { 4850, 349, -1 },
+    { 4852, 349, -1 }, { 0, 346, 3949 }, { 0, 407, 4831 }, { 7331, 800, -1 },
+    { 5159, 394, -1 }, { 4815, 345, -1 }, { 7291, 806, -1 }, { 5237, 407, 4832 },
+    { 4866, 350, -1 }, { 7293, 848, -1 }, { 0, 491, 6270 }, { 4828, 346, -1 },
+    { 7289, 861, -1 }, { 5727, 491, -1 }, { 0, 394, 4676 }, { 5157, 394, 4677 },
+    { 4843, 349, -1 }, { 7323, 861, -1 }, { 0, 394, 4679 }, { 5730, 491, -1 },
+    { 7339, 176, -1 }, { 0, 346, 3952 }, { 0, 349, 4001 }, { 7295, 225, -1 },
+    { 4858, 349, 4002 }, { 4868, 350, -1 }, { 0, 349, 4010 }, { 4851, 349, 4011 },
+    { 0, 349, 4013 }, { 0, 349, 4014 }, { 0, 349, 4015 }, { 4868, 350, -1 },
+    { 0, 349, 4016 }, { 0, 349, 4017 }, { 0, 350, 4027 }, { 7324, 1081, -1 },
+    { 5730, 491, -1 }, { 4870, 350, -1 }, { 4871, 350, -1 }, { 6227, 602, -1 },
+    { 6296, 602, -1 }, { 6288, 602, -1 }, { 4860, 349, -1 }, { 6269, 602, -1 },
+    { 4876, 350, -1 }, { 7315, 1082, -1 }, { 4873, 350, 4046 }, { 7361, 1092, -1 },
+    { 4861, 349, -1 }, { 7065, 1121, -1 }, { 4862, 349, -1 }, { 7077, 1121, -1 },
+    { 7057, 1121, -1 }, { 4877, 350, -1 }, { 4865, 349, -1 }, { 4881, 350, -1 },
+    { 7309, 1262, -1 }, { 7315, 1262, -1 }, { 0, 350, 4051 }, { 0, 350, 4052 },
+    { 0, 350, 4053 }, { 7329, 1108, -1 }, { 0, 350, 4054 }, { 4880, 350, 4055 },
+    { 0, 350, 4057 }, { 4883, 350, 4058 }, { 0, 350, 4060 }, { 4895, 352, -1 },
+    { 7371, 184, -1 }, { 0, 352, 4083 }, { 7362, 760, -1 }, { 4895, 352, 4084 },
+    { 0, 352, 4086 }, { 0, 352, 4087 }, { 0, 352, 4088 }, { 7384, 769, -1 },
+    { 0, 352, 4089 }, { 0, 352, 4090 }, { 7378, 809, -1 }, { 0, 352, 4091 },
+    { 0, 352, 4092 }, { 0, 352, 4093 }, { 7381, 812, -1 }, { 4898, 352, 4094 },
+    { 0, 352, 4097 }, { 4900, 352, 4098 }, { 0, 352, 4100 }, { 7328, 154, -1 },
+    { 7380, 157, -1 }, { 4913, 353, 4111 }, { 0, 452, 5600 }, { 5522, 452, 5601 },
+    { 0, 452, 5603 }, { 5419, 435, -1 }, { 0, 435, 5322 }, { 4916, 353, -1 },
+    { 5422, 435, -1 }, { 5424, 435, 5324 }, { 4927, 354, -1 }, { 4921, 353, -1 },
+    { 5523, 452, -1 }, { 5426, 435, -1 }, { 5426, 435, -1 }, { 7238, 1181, -1 },
+    { 0, 435, 5328 }, { 7208, 1181, -1 }, { 7178, 1181, -1 }, { 4900, 352, -1 },
+    { 4903, 352, -1 }, { 4932, 354, -1 }, { 7344, 197, -1 }, { 0, 452, 5605 },
+    { 4906, 352, -1 }, { 7366, 1299, -1 }, { 0, 353, 4146 }, { 4929, 354, -1 },
+    { 0, 353, 4147 }, { 0, 353, 4148 }, { 0, 353, 4149 }, { 0, 353, 4150 },
+    { 0, 353, 4151 }, { 4911, 352, -1 }, { 0, 353, 4152 }, { 0, 353, 4153 },
+    { 7366, 1323, -1 }, { 0, 353, 4154 }, { 0, 353, 4155 }, { 0, 353, 4156 },
+    { 0, 353, 4157 }, { 7135, 1165, -1 }, { 7124, 1165, -1 }, { 4932, 354, -1 },
+    { 7137, 1165, -1 }, { 7367, 1274, -1 }, { 0, 452, 5606 }, { 7428, 1327, -1 },
+    { 7384, 1274, -1 }, { 4901, 353, -1 }, { 4905, 353, -1 }, { 7429, 666, -1 },
+    { 5528, 454, -1 }, { 4933, 354, -1 }, { 4935, 354, -1 }, { 4925, 353, -1 },
+    { 7441, 671, -1 }, { 4940, 355, -1 }, { 7391, 1320, -1 }, { 4938, 354, -1 },
+    { 7358, 1310, -1 }, { 4941, 354, -1 }, { 4942, 355, 4181 }, { 7409, 1310, -1 },
+    { 0, 355, 4183 }, { 0, 355, 4184 }, { 0, 355, 4185 }, { 4954, 358, -1 },
+    { 0, 355, 4186 }, { 0, 355, 4187 }, { 7454, 1322, -1 }, { 0, 454, 5623 },
+    { 0, 355, 4188 }, { 0, 454, 5624 }, { 0, 355, 4189 }, { 0, 355, 4190 },
+    { 7374, 1326, -1 }, { 7420, 1326, -1 }, { 5526, 454, -1 }, { 4972, 363, -1 },
+    { 7455, 1331, -1 }, { 4959, 358, -1 }, { 0, 363, 4299 }, { 5530, 454, 5626 },
+    { 4944, 355, -1 }, { 0, 460, 5675 }, { 0, 460, 5676 }, { 0, 358, 4257 },
+    { 7391, 679, -1 }, { 7443, 679, -1 }, { 0, 358, 4258 }, { 7434, 662, -1 },
+    { 5547, 460, -1 }, { 0, 355, 4192 }, { 0, 358, 4259 }, { 7437, 662, -1 },
+    { 0, 358, 4260 }, { 4960, 358, 4261 }, { 0, 358, 4264 }, { 4945, 355, -1 },
+    { 0, 358, 4265 }, { 0, 358, 4266 }, { 0, 358, 4267 }, { 5548, 460, -1 },
+    { 0, 358, 4268 }, { 4961, 358, 4269 }, { 0, 360, 4279 }, { 4967, 360, 4280 },
+    { 4947, 355, -1 }, { 0, 460, 5680 }, { 4977, 363, -1 }, { 0, 360, 4282 },
+    { 0, 363, 4305 }, { 0, 360, 4283 }, { 0, 363, 4306 }, { 4978, 363, -1 },
+    { 7454, 1341, -1 }, { 6111, 589, -1 }, { 6172, 589, -1 }, { 6176, 589, -1 },
+    { 4979, 363, 4309 }, { 6172, 589, -1 }, { 6138, 589, -1 }, { 7413, 1321, -1 },
+    { 5553, 460, -1 }, { 0, 364, 4313 }, { 0, 460, 5688 }, { 7441, 1321, -1 },
+    { 4968, 360, 4284 }, { 0, 363, 4311 }, { 0, 363, 4312 }, { 4979, 364, -1 },
+    { 7454, 1343, -1 }, { 7465, 1354, -1 }, { 0, 364, 4315 }, { 0, 365, 4345 },
+    { 0, 365, 4346 }, { 0, 365, 4347 }, { 6156, 598, -1 }, { 6187, 598, -1 },
+    { 6196, 598, -1 }, { 6174, 598, -1 }, { 6208, 598, -1 }, { 4980, 364, -1 },
+    { 7435, 1332, -1 }, { 4966, 360, -1 }, { 4970, 360, -1 }, { 4982, 364, 4317 },
+    { 7425, 1332, -1 }, { 5018, 371, -1 }, { 7462, 1349, -1 }, { 7443, 842, -1 },
+    { 0, 360, 4290 }, { 0, 364, 4319 }, { 0, 364, 4320 }, { 0, 371, 4394 },
+    { 7425, 639, -1 }, { 7406, 639, -1 }, { 4990, 365, -1 }, { 7474, 845, -1 },
+    { 7434, 639, -1 }, { 0, 365, 4350 }, { 5031, 373, -1 }, { 7457, 1340, -1 },
+    { 5032, 373, -1 }, { 4991, 365, 4351 }, { 7461, 1340, -1 }, { 5020, 371, -1 },
+    { 0, 373, 4417 }, { 5023, 371, -1 }, { 4999, 365, -1 }, { 4986, 364, -1 },
+    { 0, 365, 4355 }, { 4992, 365, 4356 }, { 0, 365, 4358 }, { 0, 365, 4359 },
+    { 5033, 373, -1 }, { 5002, 365, 4360 }, { 5005, 365, 4368 }, { 0, 365, 4370 },
+    { 0, 371, 4398 }, { 4984, 364, -1 }, { 4989, 364, 4324 }, { 5023, 371, -1 },
+    { 7477, 889, -1 }, { 4994, 364, 4329 }, { 0, 364, 4344 }, { 6583, 802, -1 },
+    { 6630, 802, -1 }, { 6637, 802, -1 }, { 0, 373, 4419 }, { 6621, 802, -1 },
+    { 5429, 436, 5329 }, { 7482, 152, -1 }, { 7439, 1376, -1 }, { 5026, 371, 4400 },
+    { 5502, 445, -1 }, { 7414, 1376, -1 }, { 0, 436, 5332 }, { 5029, 371, -1 },
+    { 0, 371, 4407 }, { 0, 374, 4430 }, { 5499, 445, -1 }, { 5426, 436, -1 },
+    { 5034, 373, 4420 }, { 0, 373, 4423 }, { 0, 373, 4424 }, { 0, 373, 4425 },
+    { 0, 373, 4426 }, { 5031, 373, 4427 }, { 0, 373, 4429 }, { 5055, 382, -1 },
+    { 0, 374, 4431 }, { 0, 436, 5334 }, { 7431, 156, -1 }, { 6374, 670, -1 },
+    { 6377, 670, -1 }, { 6386, 670, -1 }, { 0, 436, 5335 }, { 0, 374, 4432 },
+    { 6419, 670, -1 }, { 5503, 445, 5558 }, { 7474, 159, -1 }, { 0, 445, 5560 },
+    { 0, 445, 5561 }, { 5036, 374, -1 }, { 5039, 374, -1 }, { 0, 445, 5562 },
+    { 0, 436, 5336 }, { 0, 445, 5563 }, { 0, 445, 5564 }, { 0, 374, 4435 },
+    { 7425, 501, -1 }, { 5057, 382, -1 }, { 7462, 834, -1 }, { 5056, 382, -1 },
+    { 5507, 445, -1 }, { 7465, 834, -1 }, { 5059, 382, -1 }, { 5431, 436, -1 },
+    { 0, 374, 4436 }, { 0, 374, 4437 }, { 0, 374, 4438 }, { 7482, 507, -1 },
+    { 5040, 374, 4439 }, { 7447, 851, -1 }, { 7476, 851, -1 }, { 5055, 382, -1 },
+    { 5062, 382, -1 }, { 7143, 1172, -1 }, { 7209, 1172, -1 }, { 5078, 384, -1 },
+    { 7175, 1172, -1 }, { 5080, 384, -1 }, { 7199, 1172, -1 }, { 5064, 382, -1 },
+    { 5062, 382, -1 }, { 5066, 382, -1 }, { 0, 384, 4515 }, { 0, 384, 4516 },
+    { 5069, 382, 4495 }, { 7428, 512, -1 }, { 5075, 382, -1 }, { 6827, 991, -1 },
+    { 6882, 991, -1 }, { 6877, 991, -1 }, { 5073, 382, 4506 }, { 0, 384, 4517 },
+    { 0, 384, 4518 }, { 0, 384, 4519 }, { 7441, 522, -1 }, { 5084, 385, -1 },
+    { 7487, 884, -1 }, { 5086, 385, -1 }, { 0, 385, 4532 }, { 0, 385, 4533 },
+    { 5086, 385, -1 }, { 0, 386, 4542 }, { 7436, 879, -1 }, { 7488, 887, -1 },
+    { 0, 384, 4520 }, { 7464, 879, -1 }, { 0, 384, 4521 }, { 0, 384, 4522 },
+    { 5087, 385, 4535 }, { 0, 384, 4523 }, { 5081, 384, -1 }, { 5087, 385, -1 },
+    { 0, 384, 4525 }, { 7493, 890, -1 }, { 7446, 1363, -1 }, { 5975, 549, -1 },
+    { 5980, 549, 7354 }, { 7497, 1378, -1 }, { 7526, 1387, -1 }, { 0, 386, 4543 },
+    { 0, 386, 4544 }, { 0, 549, 7362 }, { 6592, 804, -1 }, { 6648, 804, -1 },
+    { 6648, 804, -1 }, { 5112, 389, -1 }, { 6610, 804, -1 }, { 5114, 389, -1 },
+    { 7498, 1403, -1 }, { 5982, 549, -1 }, { 0, 385, 4539 }, { 7574, 1414, -1 },
+    { 0, 385, 4540 }, { 0, 385, 4541 }, { 0, 389, 4593 }, { 5115, 389, 4594 },
+    { 5117, 389, 4598 }, { 5114, 389, -1 }, { 0, 386, 4545 }, { 0, 386, 4546 },
+    { 7580, 1400, -1 }, { 0, 389, 4601 }, { 5115, 389, 4602 }, { 5120, 389, 4605 },
+    { 7455, 1382, -1 }, { 7550, 1382, -1 }, { 5118, 389, -1 }, { 5150, 393, -1 },
+    { 7521, 1384, -1 }, { 7473, 1384, -1 }, { 5173, 399, -1 }, { 5173, 399, -1 },
+    { 7523, 1384, -1 }, { 0, 549, 7365 }, { 0, 549, 7366 }, { 0, 399, 4706 },
+    { 7581, 1397, -1 }, { 7511, 1397, -1 }, { 0, 386, 4547 }, { 0, 386, 4548 },
+    { 7593, 1404, -1 }, { 5175, 399, -1 }, { 0, 393, 4655 }, { 7565, 1408, -1 },
+    { 5151, 393, -1 }, { 5152, 393, -1 }, { 5178, 399, -1 }, { 7575, 1408, -1 },
+    { 0, 399, 4709 }, { 5122, 389, -1 }, { 5153, 393, -1 }, { 5125, 389, -1 },
+    { 7575, 1411, -1 }, { 0, 393, 4665 }, { 0, 549, 7367 }, { 5127, 389, -1 },
+    { 0, 399, 4710 }, { 0, 399, 4711 }, { 5204, 404, 4775 }, { 7491, 1398, -1 },
+    { 7568, 1398, -1 }, { 0, 393, 4666 }, { 0, 393, 4667 }, { 5182, 401, -1 },
+    { 5184, 401, -1 }, { 5241, 408, 4837 }, { 5184, 401, 4723 }, { 7544, 1396, -1 },
+    { 0, 404, 4777 }, { 0, 401, 4726 }, { 7592, 1426, -1 }, { 7538, 1396, -1 },
+    { 0, 404, 4778 }, { 5211, 404, -1 }, { 5186, 401, -1 }, { 7547, 1440, -1 },
+    { 5188, 401, 4734 }, { 7548, 1441, -1 }, { 5215, 404, -1 }, { 7613, 1446, -1 },
+    { 5189, 401, -1 }, { 5190, 401, -1 }, { 7612, 1002, -1 }, { 0, 404, 4784 },
+    { 5213, 404, 4785 }, { 6445, 729, -1 }, { 6466, 729, -1 }, { 6460, 729, -1 },
+    { 5244, 408, -1 }, { 7616, 1005, -1 }, { 6465, 729, -1 }, { 7596, 982, -1 },
+    { 0, 404, 4787 }, { 0, 404, 4788 }, { 7590, 982, -1 }, { 5248, 412, -1 },
+    { 7621, 822, -1 }, { 7605, 960, -1 }, { 5245, 408, -1 }, { 7613, 1009, -1 },
+    { 0, 404, 4789 }, { 5195, 401, -1 }, { 7585, 203, -1 }, { 0, 408, 4845 },
+    { 0, 408, 4846 }, { 0, 408, 4847 }, { 0, 408, 4848 }, { 0, 408, 4849 },
+    { 0, 408, 4850 }, { 5251, 412, -1 }, { 5195, 401, 4743 }, { 5194, 401, 4750 },
+    { 7640, 536, -1 }, { 7592, 561, -1 }, { 0, 412, 4866 }, { 0, 412, 4867 },
+    { 6087, 570, -1 }, { 6158, 570, -1 }, { 6160, 570, -1 }, { 6126, 570, -1 },
+    { 6176, 570, -1 }, { 6159, 570, -1 }, { 0, 412, 4868 }, { 7592, 574, -1 },
+    { 0, 401, 4752 }, { 6746, 922, -1 }, { 6786, 922, -1 }, { 6780, 922, -1 },
+    { 5250, 412, 4869 }, { 6723, 922, -1 }, { 7590, 604, -1 }, { 7600, 766, -1 },
+    { 0, 412, 4871 }, { 7650, 774, -1 }, { 0, 420, 4926 }, { 5280, 420, 4927 },
+    { 5283, 420, 4931 }, { 0, 420, 4936 }, { 5288, 420, 4937 }, { 0, 420, 4940 },
+    { 5281, 420, 4941 }, { 0, 420, 4943 }, { 0, 420, 4944 }, { 0, 420, 4945 },
+    { 5290, 420, 4946 }, { 0, 420, 4948 }, { 0, 420, 4949 }, { 0, 420, 4950 },
+    { 5253, 412, -1 }, { 5290, 420, 4951 }, { 0, 420, 4953 }, { 0, 420, 4954 },
+    { 0, 420, 4955 }, { 5292, 420, 4956 }, { 7654, 788, -1 }, { 5292, 420, 4958 },
+    { 0, 420, 4960 }, { 0, 420, 4961 }, { 5293, 420, 4962 }, { 0, 420, 4964 },
+    { 0, 420, 4965 }, { 7621, 1435, -1 }, { 7654, 1451, -1 }, { 0, 420, 4966 },
+    { 0, 420, 4967 }, { 0, 420, 4968 }, { 0, 421, 4969 }, { 0, 421, 4970 },
+    { 0, 421, 4971 }, { 0, 421, 4972 }, { 5291, 421, 4973 }, { 0, 421, 4975 },
+    { 5297, 421, 4976 }, { 0, 421, 4981 }, { 0, 421, 4982 }, { 0, 421, 4983 },
+    { 0, 421, 4984 }, { 0, 421, 4985 }, { 0, 421, 4986 }, { 0, 421, 4987 },
+    { 0, 421, 4988 }, { 5297, 421, 4989 }, { 0, 421, 4991 }, { 5300, 421, 4992 },
+    { 0, 421, 4994 }, { 5303, 421, 4995 }, { 7658, 1452, -1 }, { 5304, 421, 5002 },
+    { 7668, 1454, -1 }, { 0, 421, 5004 }, { 5306, 421, 5005 }, { 0, 421, 5007 },
+    { 0, 421, 5008 }, { 0, 421, 5009 }, { 5304, 421, 5010 }, { 0, 421, 5012 },
+    { 5308, 421, 5013 }, { 0, 421, 5015 }, { 0, 421, 5016 }, { 0, 421, 5017 },
+    { 0, 421, 5018 }, { 5309, 421, 5019 }, { 7615, 1456, -1 }, { 0, 421, 5033 },
+    { 0, 421, 5034 }, { 0, 421, 5035 }, { 0, 421, 5036 }, { 0, 421, 5037 },
+    { 5315, 421, 5038 }, { 0, 421, 5040 }, { 7623, 1458, -1 }, { 0, 421, 5041 },
+    { 0, 421, 5042 }, { 0, 421, 5043 }, { 0, 421, 5044 }, { 7630, 1463, -1 },
+    { 0, 421, 5045 }, { 0, 421, 5046 }, { 5313, 421, 5047 }, { 0, 421, 5049 },
+    { 0, 421, 5050 }, { 5317, 421, -1 }, { 5319, 421, 5059 }, { 7626, 1466, -1 },
+    { 0, 421, 5061 }, { 0, 421, 5062 }, { 0, 421, 5063 }, { 0, 421, 5064 },
+    { 5322, 421, 5065 }, { 5323, 421, 5067 }, { 0, 422, 5069 }, { 0, 422, 5070 },
+    { 0, 422, 5071 }, { 0, 422, 5072 }, { 0, 422, 5073 }, { 0, 422, 5074 },
+    { 0, 422, 5075 }, { 0, 422, 5076 }, { 0, 422, 5077 }, { 5324, 422, 5078 },
+    { 7676, 1471, -1 }, { 0, 422, 5080 }, { 0, 422, 5081 }, { 0, 422, 5082 },
+    { 0, 422, 5083 }, { 0, 422, 5084 }, { 7628, 1480, -1 }, { 0, 422, 5085 },
+    { 0, 422, 5086 }, { 5325, 422, 5087 }, { 0, 422, 5090 }, { 0, 422, 5091 },
+    { 5326, 422, 5092 }, { 0, 422, 5097 }, { 0, 422, 5098 }, { 0, 422, 5099 },
+    { 0, 422, 5100 }, { 0, 422, 5101 }, { 5324, 422, 5102 }, { 5328, 422, 5104 },
+    { 7679, 1485, -1 }, { 0, 422, 5107 }, { 5328, 422, 5108 }, { 0, 422, 5110 },
+    { 0, 422, 5111 }, { 0, 422, 5112 }, { 0, 422, 5113 }, { 0, 422, 5114 },
+    { 0, 422, 5115 }, { 0, 422, 5116 }, { 0, 422, 5117 }, { 5330, 422, 5118 },
+    { 0, 422, 5120 }, { 0, 422, 5121 }, { 0, 422, 5122 }, { 0, 422, 5123 },
+    { 0, 422, 5124 }, { 0, 422, 5125 }, { 0, 422, 5126 }, { 0, 422, 5127 },
+    { 0, 422, 5128 }, { 0, 422, 5129 }, { 0, 422, 5130 }, { 0, 422, 5131 },
+    { 5346, 426, -1 }, { 7687, 1473, -1 }, { 5350, 426, -1 }, { 7690, 1475, -1 },
+    { 0, 427, 5175 }, { 6163, 601, -1 }, { 6220, 601, -1 }, { 6223, 601, -1 },
+    { 6190, 601, -1 }, { 6217, 601, -1 }, { 6223, 601, -1 }, { 5351, 426, -1 },
+    { 5351, 426, -1 }, { 0, 427, 5176 }, { 0, 427, 5177 }, { 0, 427, 5178 },
+    { 0, 455, 5629 }, { 0, 455, 5630 }, { 0, 455, 5631 }, { 0, 428, 5184 },
+    { 5354, 426, -1 }, { 7603, 773, -1 }, { 5353, 427, 5179 }, { 5530, 455, 5632 },
+    { 7652, 773, -1 }, { 5359, 428, -1 }, { 5352, 427, -1 }, { 5762, 497, -1 },
+    { 7639, 1481, -1 }, { 5764, 497, -1 }, { 0, 497, 6434 }, { 7698, 1515, -1 },
+    { 5768, 497, -1 }, { 5773, 497, -1 }, { 5778, 497, -1 }, { 5397, 431, 5263 },
+    { 7664, 1457, -1 }, { 5781, 497, -1 }, { 0, 426, 5171 }, { 7691, 1525, -1 },
+    { 7672, 1457, -1 }, { 5394, 431, -1 }, { 5358, 428, -1 }, { 0, 427, 5182 },
+    { 0, 427, 5183 }, { 5359, 428, -1 }, { 5397, 431, -1 }, { 7692, 1527, -1 },
+    { 0, 428, 5192 }, { 5363, 428, -1 }, { 5355, 426, -1 }, { 7655, 1529, -1 },
+    { 5365, 428, 5194 }, { 5364, 428, -1 }, { 7683, 1532, -1 }, { 0, 426, 5173 },
+    { 7639, 1476, -1 }, { 7692, 1476, -1 }, { 0, 426, 5174 }, { 7688, 1533, -1 },
+    { 0, 429, 5204 }, { 0, 429, 5205 }, { 5364, 428, 5197 }, { 5366, 429, -1 },
+    { 7700, 1487, -1 }, { 7670, 1487, -1 }, { 0, 429, 5208 }, { 7704, 1535, -1 },
+    { 5364, 428, 5200 }, { 0, 455, 5635 }, { 0, 431, 5271 }, { 0, 455, 5636 },
+    { 5371, 429, -1 }, { 5397, 431, -1 }, { 5372, 429, -1 }, { 6870, 1036, -1 },
+    { 6925, 1036, -1 }, { 6924, 1036, -1 }, { 0, 428, 5202 }, { 0, 428, 5203 },
+    { 6816, 935, -1 }, { 6829, 935, -1 }, { 6804, 935, -1 }, { 6829, 935, -1 },
+    { 0, 431, 5273 }, { 0, 431, 5274 }, { 0, 431, 5275 }, { 5402, 431, 5276 },
+    { 5370, 429, 5211 }, { 5877, 520, -1 }, { 5381, 430, 5231 }, { 5381, 430, -1 },
+    { 7702, 1539, -1 }, { 5376, 429, -1 }, { 0, 430, 5234 }, { 0, 520, 6958 },
+    { 5384, 430, 5235 }, { 0, 430, 5249 }, { 5389, 430, 5250 }, { 0, 429, 5224 },
+    { 0, 430, 5253 }, { 0, 430, 5254 }, { 0, 429, 5225 }, { 0, 429, 5226 },
+    { 7629, 1482, -1 }, { 7682, 1482, -1 }, { 5406, 434, -1 }, { 5389, 430, 5255 },
+    { 7720, 1549, -1 }, { 7683, 1482, -1 }, { 0, 434, 5287 }, { 7690, 1502, -1 },
+    { 7660, 1502, -1 }, { 5890, 520, -1 }, { 5378, 429, 5227 }, { 7738, 1507, -1 },
+    { 5411, 434, -1 }, { 5413, 434, -1 }, { 6887, 1056, -1 }, { 6889, 1056, -1 },
+    { 6941, 1056, -1 }, { 5379, 429, -1 }, { 5417, 434, -1 }, { 5888, 520, -1 },
+    { 7747, 1508, -1 }, { 0, 520, 6961 }, { 7700, 1526, -1 }, { 7698, 1526, -1 },
+    { 0, 520, 6962 }, { 7676, 1526, -1 }, { 5392, 430, 5258 }, { 6873, 1038, -1 },
+    { 6921, 1038, -1 }, { 6926, 1038, -1 }, { 5418, 434, -1 }, { 0, 430, 5261 },
+    { 6919, 1038, -1 }, { 0, 430, 5262 }, { 7744, 1537, -1 }, { 0, 434, 5313 },
+    { 6258, 599, -1 }, { 6272, 599, -1 }, { 6230, 599, -1 }, { 6294, 599, -1 },
+    { 0, 437, 5345 }, { 6254, 599, -1 }, { 5418, 434, -1 }, { 7443, 1371, -1 },
+    { 7489, 1371, -1 }, { 7505, 1371, -1 }, { 0, 437, 5346 }, { 0, 437, 5347 },
+    { 5420, 434, 5315 }, { 0, 434, 5317 }, { 0, 437, 5348 }, { 0, 437, 5349 },
+    { 5436, 437, 5350 }, { 0, 437, 5354 }, { 5437, 437, 5355 }, { 7721, 1540, -1 },
+    { 5435, 437, -1 }, { 5421, 434, -1 }, { 7765, 1550, -1 }, { 0, 434, 5320 },
+    { 5482, 442, 5512 }, { 5443, 438, -1 }, { 5449, 438, -1 }, { 6894, 1058, -1 },
+    { 6926, 1058, -1 }, { 6898, 1058, -1 }, { 6910, 1058, -1 }, { 0, 442, 5515 },
+    { 5486, 442, 5516 }, { 5487, 442, 5518 }, { 5488, 442, 5520 }, { 0, 442, 5522 },
+    { 7746, 1554, -1 }, { 5452, 438, 5377 }, { 0, 438, 5379 }, { 7749, 1554, -1 },
+    { 0, 438, 5380 }, { 5441, 437, -1 }, { 0, 437, 5362 }, { 0, 438, 5381 },
+    { 0, 438, 5382 }, { 6233, 596, -1 }, { 6294, 596, -1 }, { 6358, 596, -1 },
+    { 6385, 596, -1 }, { 6416, 596, -1 }, { 6449, 596, -1 }, { 7718, 1598, -1 },
+    { 5443, 437, -1 }, { 7744, 1203, -1 }, { 0, 439, 5388 }, { 5867, 518, 6905 },
+    { 5489, 442, -1 }, { 5457, 439, -1 }, { 7722, 1214, -1 }, { 7717, 577, -1 },
+    { 5443, 437, 5364 }, { 5870, 518, -1 }, { 0, 438, 5383 }, { 5873, 518, -1 },
+    { 5458, 439, 5393 }, { 6664, 900, -1 }, { 6715, 900, -1 }, { 6747, 900, -1 },
+    { 6690, 900, -1 }, { 0, 440, 5495 }, { 6707, 900, -1 }, { 7618, 1437, -1 },
+    { 7641, 1437, -1 }, { 7667, 1437, -1 }, { 0, 439, 5397 }, { 0, 439, 5398 },
+    { 0, 439, 5399 }, { 5455, 438, -1 }, { 5459, 439, 5400 }, { 0, 439, 5402 },
+    { 0, 439, 5403 }, { 5465, 439, 5404 }, { 7740, 150, -1 }, { 0, 439, 5418 },
+    { 0, 439, 5419 }, { 0, 439, 5420 }, { 5467, 439, 5421 }, { 5466, 439, 5423 },
+    { 0, 439, 5425 }, { 0, 439, 5426 }, { 0, 439, 5427 }, { 0, 439, 5428 },
+    { 5474, 440, -1 }, { 0, 439, 5429 }, { 7729, 1583, -1 }, { 5472, 439, 5430 },
+    { 7775, 1591, -1 }, { 5516, 451, -1 }, { 0, 451, 5589 }, { 0, 518, 6914 },
+    { 0, 451, 5590 }, { 7697, 1530, -1 }, { 7777, 1592, -1 }, { 5474, 439, -1 },
+    { 5873, 518, -1 }, { 7685, 1530, -1 }, { 7093, 1163, -1 }, { 7155, 1163, -1 },
+    { 7150, 1163, -1 }, { 0, 451, 5591 }, { 5878, 518, -1 }, { 7123, 1163, -1 },
+    { 5537, 459, -1 }, { 0, 440, 5497 }, { 0, 440, 5498 }, { 0, 440, 5499 },
+    { 0, 440, 5500 }, { 5533, 459, 5641 }, { 0, 440, 5501 }, { 5479, 440, 5502 },
+    { 0, 440, 5504 }, { 0, 440, 5505 }, { 0, 440, 5506 }, { 7771, 1593, -1 },
+    { 5540, 459, -1 }, { 5477, 440, -1 }, { 5515, 451, 5592 }, { 0, 451, 5594 },
+    { 5524, 453, -1 }, { 5518, 451, 5595 }, { 7711, 1546, -1 }, { 0, 453, 5608 },
+    { 0, 459, 5645 }, { 7719, 1600, -1 }, { 7718, 1546, -1 }, { 0, 453, 5609 },
+    { 5525, 453, 5610 }, { 7712, 1600, -1 }, { 7053, 1145, -1 }, { 7773, 1604, -1 },
+    { 7086, 1145, -1 }, { 5523, 453, -1 }, { 7073, 1145, -1 }, { 7094, 1145, -1 },
+    { 0, 451, 5597 }, { 0, 451, 5598 }, { 0, 451, 5599 }, { 5539, 459, -1 },
+    { 7739, 1606, -1 }, { 5541, 459, 5647 }, { 6779, 938, -1 }, { 6841, 938, -1 },
+    { 5545, 459, -1 }, { 6813, 938, -1 }, { 6841, 938, -1 }, { 6818, 938, -1 },
+    { 5539, 459, 5672 }, { 7781, 1609, -1 }, { 0, 459, 5674 }, { 6301, 625, -1 },
+    { 6471, 625, -1 }, { 6369, 625, -1 }, { 6321, 625, -1 }, { 6339, 625, -1 },
+    { 7360, 1313, -1 }, { 7425, 1313, -1 }, { 7400, 1313, -1 }, { 5527, 453, 5613 },
+    { 7385, 1313, -1 }, { 0, 453, 5615 }, { 0, 453, 5616 }, { 0, 453, 5617 },
+    { 0, 453, 5618 }, { 0, 453, 5619 }, { 5563, 465, 5713 }, { 5562, 465, 5716 },
+    { 7783, 1620, -1 }, { 5564, 465, 5718 }, { 0, 465, 5720 }, { 0, 465, 5721 },
+    { 0, 465, 5722 }, { 0, 465, 5723 }, { 0, 465, 5724 }, { 0, 465, 5725 },
+    { 0, 465, 5726 }, { 0, 465, 5727 }, { 7737, 1624, -1 }, { 0, 465, 5728 },
+    { 0, 465, 5729 }, { 0, 465, 5730 }, { 0, 465, 5731 }, { 5565, 465, -1 },
+    { 5892, 521, 6963 }, { 0, 521, 6965 }, { 7753, 1636, -1 }, { 5893, 521, 6966 },
+    { 0, 521, 6969 }, { 0, 521, 6970 }, { 0, 521, 6971 }, { 5568, 465, -1 },
+    { 7575, 1445, -1 }, { 7607, 1445, -1 }, { 7604, 1445, -1 }, { 0, 465, 5734 },
+    { 7613, 1445, -1 }, { 5894, 521, -1 }, { 7722, 1578, -1 }, { 0, 521, 6974 },
+    { 5570, 465, -1 }, { 7716, 1578, -1 }, { 7723, 1578, -1 }, { 5567, 465, 5739 },
+    { 6459, 719, -1 }, { 6432, 719, -1 }, { 6517, 719, -1 }, { 6540, 719, -1 },
+    { 6556, 719, -1 }, { 6586, 719, -1 }, { 6596, 719, -1 }, { 7783, 1641, -1 },
+    { 0, 465, 5741 }, { 5581, 472, 5754 }, { 5585, 472, 5756 }, { 0, 472, 5758 },
+    { 5587, 472, 5759 }, { 0, 472, 5761 }, { 0, 472, 5762 }, { 0, 472, 5763 },
+    { 0, 472, 5764 }, { 0, 472, 5765 }, { 0, 472, 5766 }, { 0, 472, 5767 },
+    { 7785, 1650, -1 }, { 0, 472, 5768 }, { 0, 472, 5769 }, { 0, 472, 5770 },
+    { 0, 472, 5771 }, { 7788, 1657, -1 }, { 0, 472, 5772 }, { 0, 472, 5773 },
+    { 0, 472, 5774 }, { 0, 472, 5775 }, { 0, 472, 5776 }, { 0, 472, 5777 },
+    { 5587, 472, 5778 }, { 0, 472, 5781 }, { 0, 472, 5782 }, { 7741, 1658, -1 },
+    { 0, 472, 5783 }, { 0, 472, 5784 }, { 0, 472, 5785 }, { 0, 472, 5786 },
+    { 0, 473, 5787 }, { 0, 473, 5788 }, { 0, 473, 5789 }, { 0, 473, 5790 },
+    { 5588, 473, 5791 }, { 0, 473, 5793 }, { 0, 473, 5794 }, { 7848, 1656, -1 },
+    { 0, 473, 5795 }, { 0, 473, 5796 }, { 0, 473, 5797 }, { 0, 473, 5798 },
+    { 0, 473, 5799 }, { 5592, 473, 5800 }, { 0, 473, 5804 }, { 0, 473, 5805 },
+    { 7866, 1673, -1 }, { 5593, 473, 5806 }, { 0, 473, 5808 }, { 0, 473, 5809 },
+    { 5592, 473, 5810 }, { 5596, 473, 5812 }, { 0, 473, 5815 }, { 5598, 473, 5816 },
+    { 0, 473, 5821 }, { 0, 473, 5822 }, { 5603, 473, 5823 }, { 0, 473, 5826 },
+    { 0, 473, 5827 }, { 5594, 473, 5828 }, { 0, 473, 5830 }, { 0, 473, 5831 },
+    { 0, 473, 5832 }, { 0, 473, 5833 }, { 0, 473, 5834 }, { 0, 473, 5835 },
+    { 0, 473, 5836 }, { 5596, 473, 5837 }, { 5605, 473, 5839 }, { 0, 473, 5842 },
+    { 0, 473, 5843 }, { 0, 473, 5844 }, { 7877, 1675, -1 }, { 0, 473, 5845 },
+    { 5604, 473, 5846 }, { 5609, 473, 5848 }, { 0, 473, 5852 }, { 0, 473, 5853 },
+    { 0, 473, 5854 }, { 5609, 473, 5855 }, { 0, 473, 5857 }, { 0, 473, 5858 },
+    { 5609, 473, 5859 }, { 0, 473, 5861 }, { 0, 473, 5862 }, { 5612, 473, 5863 },
+    { 5615, 473, 5866 }, { 0, 473, 5868 }, { 0, 473, 5869 }, { 0, 473, 5870 },
+    { 0, 473, 5871 }, { 0, 473, 5872 }, { 5616, 473, 5873 }, { 0, 473, 5876 },
+    { 0, 474, 5877 }, { 5617, 474, 5878 }, { 0, 474, 5880 }, { 5618, 474, 5881 },
+    { 0, 474, 5885 }, { 0, 474, 5886 }, { 0, 474, 5887 }, { 0, 474, 5888 },
+    { 5619, 474, 5889 }, { 7838, 1678, -1 }, { 0, 474, 5891 }, { 5620, 474, 5892 },
+    { 0, 474, 5894 }, { 0, 474, 5895 }, { 0, 474, 5896 }, { 0, 474, 5897 },
+    { 0, 474, 5898 }, { 0, 474, 5899 }, { 0, 474, 5900 }, { 0, 474, 5901 },
+    { 0, 474, 5902 }, { 0, 474, 5903 }, { 0, 474, 5904 }, { 0, 474, 5905 },
+    { 0, 474, 5906 }, { 0, 474, 5907 }, { 0, 474, 5908 }, { 0, 474, 5909 },
+    { 0, 474, 5910 }, { 0, 474, 5911 }, { 7884, 1681, -1 }, { 0, 474, 5912 },
+    { 0, 474, 5913 }, { 0, 474, 5914 }, { 5622, 474, 5915 }, { 0, 474, 5917 },
+    { 0, 474, 5918 }, { 0, 474, 5919 }, { 0, 474, 5920 }, { 0, 474, 5921 },
+    { 0, 474, 5922 }, { 0, 474, 5923 }, { 0, 474, 5924 }, { 0, 474, 5925 },
+    { 5620, 474, 5926 }, { 0, 474, 5929 }, { 0, 474, 5930 }, { 0, 474, 5931 },
+    { 0, 474, 5932 }, { 0, 474, 5933 }, { 0, 474, 5934 }, { 0, 474, 5935 },
+    { 0, 474, 5936 }, { 0, 474, 5937 }, { 0, 474, 5938 }, { 5626, 474, -1 },
+    { 0, 478, 5971 }, { 0, 478, 5972 }, { 5637, 478, 5973 }, { 7884, 1689, -1 },
+    { 0, 478, 5975 }, { 0, 478, 5976 }, { 0, 478, 5977 }, { 5638, 478, 5978 },
+    { 0, 478, 5980 }, { 0, 478, 5981 }, { 0, 478, 5982 }, { 5638, 478, 5983 },
+    { 0, 478, 5985 }, { 5639, 478, 5986 }, { 0, 478, 5988 }, { 0, 478, 5989 },
+    { 5642, 478, 5990 }, { 0, 478, 5993 }, { 0, 478, 5994 }, { 0, 478, 5995 },
+    { 0, 478, 5996 }, { 0, 478, 5997 }, { 0, 478, 5998 }, { 0, 478, 5999 },
+    { 5644, 478, 6000 }, { 0, 478, 6004 }, { 0, 478, 6005 }, { 0, 478, 6006 },
+    { 5645, 478, 6007 }, { 0, 478, 6009 }, { 5643, 478, 6010 }, { 0, 478, 6012 },
+    { 0, 478, 6013 }, { 5647, 478, 6014 }, { 0, 478, 6016 }, { 0, 479, 6017 },
+    { 0, 479, 6018 }, { 0, 479, 6019 }, { 0, 479, 6020 }, { 0, 479, 6021 },
+    { 0, 479, 6022 }, { 0, 479, 6023 }, { 0, 479, 6024 }, { 5644, 479, 6025 },
+    { 0, 479, 6027 }, { 0, 479, 6028 }, { 0, 479, 6029 }, { 5649, 479, 6030 },
+    { 0, 479, 6034 }, { 0, 479, 6035 }, { 5648, 479, 6036 }, { 0, 479, 6038 },
+    { 7751, 1587, -1 }, { 7723, 1587, -1 }, { 0, 479, 6039 }, { 0, 479, 6040 },
+    { 0, 479, 6041 }, { 0, 479, 6042 }, { 7845, 1705, -1 }, { 0, 479, 6043 },
+    { 0, 479, 6044 }, { 0, 479, 6045 }, { 0, 479, 6046 }, { 0, 479, 6047 },
+    { 0, 479, 6048 }, { 5653, 479, 6049 }, { 7888, 622, -1 }, { 0, 479, 6066 },
+    { 0, 479, 6067 }, { 5659, 479, 6068 }, { 0, 479, 6070 }, { 5658, 479, -1 },
+    { 0, 481, 6088 }, { 0, 481, 6089 }, { 5842, 515, -1 }, { 0, 515, 6854 },
+    { 5843, 515, 6855 }, { 0, 515, 6857 }, { 5846, 515, 6858 }, { 0, 515, 6862 },
+    { 7893, 642, -1 }, { 5667, 481, -1 }, { 7920, 1685, -1 }, { 5849, 515, -1 },
+    { 7563, 1450, -1 }, { 7608, 1450, -1 }, { 7600, 1450, -1 }, { 7578, 1450, -1 },
+    { 5661, 479, 6073 }, { 5663, 479, 6078 }, { 5664, 479, -1 }, { 0, 515, 6864 },
+    { 6484, 171, -1 }, { 6536, 171, -1 }, { 6565, 171, -1 }, { 6534, 171, -1 },
+    { 6494, 171, -1 }, { 5914, 525, 7042 }, { 7914, 1703, -1 }, { 0, 481, 6092 },
+    { 0, 525, 7051 }, { 0, 525, 7052 }, { 0, 525, 7053 }, { 7923, 1706, -1 },
+    { 0, 525, 7054 }, { 7896, 1735, -1 }, { 5847, 515, -1 }, { 5918, 525, 7055 },
+    { 0, 525, 7059 }, { 0, 515, 6866 }, { 0, 515, 6867 }, { 0, 515, 6868 },
+    { 5851, 515, -1 }, { 5923, 525, 7060 }, { 5924, 525, -1 }, { 7953, 1740, -1 },
+    { 5667, 481, -1 }, { 7632, 1489, -1 }, { 7648, 1489, -1 }, { 7666, 1489, -1 },
+    { 5670, 481, -1 }, { 5852, 515, -1 }, { 0, 481, 6097 }, { 0, 525, 7067 },
+    { 0, 481, 6098 }, { 0, 481, 6099 }, { 0, 481, 6100 }, { 7976, 1618, -1 },
+    { 0, 481, 6101 }, { 5675, 487, 6116 }, { 0, 487, 6120 }, { 5673, 487, 6121 },
+    { 5675, 487, 6123 }, { 7936, 1629, -1 }, { 0, 487, 6125 }, { 5680, 487, 6126 },
+    { 0, 487, 6130 }, { 5682, 487, 6131 }, { 0, 487, 6134 }, { 0, 487, 6135 },
+    { 7984, 1633, -1 }, { 0, 487, 6136 }, { 0, 487, 6137 }, { 0, 487, 6138 },
+    { 0, 487, 6139 }, { 0, 487, 6140 }, { 7956, 1644, -1 }, { 0, 487, 6141 },
+    { 0, 487, 6142 }, { 0, 487, 6143 }, { 5682, 487, 6144 }, { 0, 487, 6147 },
+    { 0, 487, 6148 }, { 0, 487, 6149 }, { 0, 487, 6150 }, { 0, 488, 6151 },
+    { 0, 488, 6152 }, { 0, 488, 6153 }, { 0, 488, 6154 }, { 0, 488, 6155 },
+    { 0, 488, 6156 }, { 0, 488, 6157 }, { 0, 488, 6158 }, { 0, 488, 6159 },
+    { 0, 488, 6160 }, { 0, 488, 6161 }, { 8007, 1711, -1 }, { 0, 488, 6162 },
+    { 0, 488, 6163 }, { 0, 488, 6164 }, { 0, 488, 6165 }, { 0, 488, 6166 },
+    { 7976, 1716, -1 }, { 0, 488, 6167 }, { 0, 488, 6168 }, { 0, 488, 6169 },
+    { 0, 488, 6170 }, { 0, 488, 6171 }, { 0, 488, 6172 }, { 0, 488, 6173 },
+    { 0, 488, 6174 }, { 7800, 1238, -1 }, { 7757, 1238, -1 }, { 8035, 1718, -1 },
+    { 5683, 488, 6175 }, { 5687, 488, -1 }, { 6626, 866, -1 }, { 6683, 866, -1 },
+    { 6678, 866, -1 }, { 6705, 866, -1 }, { 6663, 866, -1 }, { 6698, 866, -1 },
+    { 8040, 1723, -1 }, { 7660, 1544, -1 }, { 7714, 1544, -1 }, { 5687, 488, 6191 },
+    { 7674, 1544, -1 }, { 5692, 488, 6193 }, { 0, 489, 6199 }, { 5694, 489, -1 },
+    { 7888, 1243, -1 }, { 7893, 1714, -1 }, { 7930, 1714, -1 }, { 7777, 1243, -1 },
+    { 5694, 489, 6201 }, { 0, 489, 6204 }, { 6665, 874, -1 }, { 6736, 874, -1 },
+    { 6742, 874, -1 }, { 6741, 874, -1 }, { 6656, 874, -1 }, { 0, 488, 6195 },
+    { 8051, 1755, -1 }, { 0, 489, 6205 }, { 5695, 489, -1 }, { 5692, 488, 6196 },
+    { 0, 488, 6198 }, { 5696, 489, -1 }, { 8071, 1503, -1 }, { 7705, 1518, -1 },
+    { 7717, 1518, -1 }, { 5698, 489, 6209 }, { 5700, 489, 6213 }, { 7745, 1518, -1 },
+    { 5701, 489, 6221 }, { 5705, 489, 6223 }, { 0, 489, 6226 }, { 5708, 489, 6227 },
+    { 0, 489, 6233 }, { 7904, 1719, -1 }, { 7891, 1719, -1 }, { 5714, 490, -1 },
+    { 8038, 1512, -1 }, { 0, 490, 6245 }, { 5701, 489, -1 }, { 7776, 1614, -1 },
+    { 5732, 492, -1 }, { 5713, 490, -1 }, { 0, 489, 6235 }, { 7783, 1614, -1 },
+    { 0, 490, 6247 }, { 0, 490, 6248 }, { 5718, 490, -1 }, { 7967, 1603, -1 },
+    { 5715, 490, -1 }, { 7943, 1603, -1 }, { 5717, 490, -1 }, { 5729, 492, -1 },
+    { 0, 489, 6236 }, { 5721, 490, 6252 }, { 7899, 1602, -1 }, { 7910, 1602, -1 },
+    { 5711, 489, -1 }, { 8095, 1519, -1 }, { 0, 489, 6241 }, { 0, 492, 6276 },
+    { 7779, 1250, -1 }, { 5722, 490, -1 }, { 5709, 489, -1 }, { 7841, 1250, -1 },
+    { 7847, 1250, -1 }, { 5723, 490, -1 }, { 7971, 1605, -1 }, { 5720, 490, -1 },
+    { 7956, 1605, -1 }, { 0, 492, 6277 }, { 7733, 1590, -1 }, { 7718, 1590, -1 },
+    { 7691, 1590, -1 }, { 0, 490, 6262 }, { 7739, 1590, -1 }, { 5735, 492, -1 },
+    { 6694, 926, -1 }, { 6800, 926, -1 }, { 6749, 926, -1 }, { 6731, 926, -1 },
+    { 6742, 926, -1 }, { 6736, 926, -1 }, { 7955, 1708, -1 }, { 8024, 1708, -1 },
+    { 0, 492, 6283 }, { 8094, 1523, -1 }, { 0, 492, 6284 }, { 5741, 493, -1 },
+    { 8050, 1756, -1 }, { 5737, 492, -1 }, { 5853, 517, -1 }, { 5856, 517, -1 },
+    { 5859, 517, -1 }, { 8093, 1760, -1 }, { 0, 490, 6263 }, { 5725, 490, -1 },
+    { 5736, 493, -1 }, { 0, 492, 6286 }, { 0, 492, 6287 }, { 0, 492, 6288 },
+    { 0, 517, 6891 }, { 0, 493, 6330 }, { 0, 493, 6331 }, { 5738, 493, 6332 },
+    { 5750, 495, -1 }, { 0, 493, 6335 }, { 5862, 517, -1 }, { 8071, 1742, -1 },
+    { 8098, 1742, -1 }, { 5754, 495, -1 }, { 5742, 493, -1 }, { 6721, 910, -1 },
+    { 6813, 910, -1 }, { 6806, 910, -1 }, { 6752, 910, -1 }, { 6816, 910, -1 },
+    { 6722, 910, -1 }, { 0, 517, 6897 }, { 7302, 1055, -1 }, { 7356, 1055, -1 },
+    { 5748, 495, 6351 }, { 7350, 1055, -1 }, { 7304, 1055, -1 }, { 7341, 1055, -1 },
+    { 0, 493, 6337 }, { 0, 493, 6338 }, { 7860, 1670, -1 }, { 5863, 517, -1 },
+    { 5755, 495, -1 }, { 8072, 1771, -1 }, { 7839, 1670, -1 }, { 5747, 493, -1 },
+    { 8105, 1779, -1 }, { 7335, 1292, -1 }, { 7392, 1292, -1 }, { 7392, 1292, -1 },
+    { 0, 517, 6900 }, { 7394, 1292, -1 }, { 7374, 1292, -1 }, { 5869, 517, -1 },
+    { 0, 495, 6354 }, { 7575, 830, -1 }, { 0, 493, 6340 }, { 7617, 830, -1 },
+    { 7623, 830, -1 }, { 7634, 830, -1 }, { 7596, 830, -1 }, { 5856, 517, 6903 },
+    { 7910, 1739, -1 }, { 8108, 1784, -1 }, { 7941, 1739, -1 }, { 7946, 1739, -1 },
+    { 0, 495, 6355 }, { 0, 495, 6356 }, { 5758, 495, 6357 }, { 0, 508, 6474 },
+    { 0, 508, 6475 }, { 0, 508, 6476 }, { 5772, 508, 6477 }, { 0, 508, 6479 },
+    { 0, 508, 6480 }, { 0, 508, 6481 }, { 0, 508, 6482 }, { 8114, 1785, -1 },
+    { 0, 508, 6483 }, { 0, 508, 6484 }, { 8087, 1758, -1 }, { 0, 508, 6485 },
+    { 0, 508, 6486 }, { 0, 508, 6487 }, { 0, 508, 6488 }, { 8034, 1505, -1 },
+    { 0, 508, 6489 }, { 8120, 1767, -1 }, { 0, 508, 6490 }, { 8085, 1505, -1 },
+    { 0, 508, 6491 }, { 0, 508, 6492 }, { 0, 508, 6493 }, { 0, 508, 6494 },
+    { 5787, 508, 6495 }, { 0, 508, 6555 }, { 0, 508, 6556 }, { 5782, 508, 6557 },
+    { 0, 508, 6560 }, { 0, 508, 6561 }, { 0, 508, 6562 }, { 0, 508, 6563 },
+    { 0, 508, 6564 }, { 0, 508, 6565 }, { 5792, 508, 6566 }, { 0, 508, 6568 },
+    { 0, 508, 6569 }, { 0, 508, 6570 }, { 0, 508, 6571 }, { 0, 508, 6572 },
+    { 0, 508, 6573 }, { 0, 508, 6574 }, { 5793, 508, 6575 }, { 0, 508, 6579 },
+    { 0, 508, 6580 }, { 0, 508, 6581 }, { 0, 508, 6582 }, { 0, 508, 6583 },
+    { 8103, 1774, -1 }, { 0, 508, 6584 }, { 0, 508, 6585 }, { 0, 508, 6586 },
+    { 0, 508, 6587 }, { 0, 508, 6588 }, { 0, 508, 6589 }, { 0, 508, 6590 },
+    { 0, 508, 6591 }, { 0, 509, 6592 }, { 5793, 509, 6593 }, { 0, 509, 6598 },
+    { 0, 509, 6599 }, { 0, 509, 6600 }, { 0, 509, 6601 }, { 0, 509, 6602 },
+    { 8071, 1777, -1 }, { 0, 509, 6603 }, { 0, 509, 6604 }, { 0, 509, 6605 },
+    { 0, 509, 6606 }, { 0, 509, 6607 }, { 0, 509, 6608 }, { 0, 509, 6609 },
+    { 8125, 1804, -1 }, { 0, 509, 6610 }, { 0, 509, 6611 }, { 0, 509, 6612 },
+    { 8051, 1781, -1 }, { 8070, 1781, -1 }, { 0, 509, 6613 }, { 0, 509, 6614 },
+    { 0, 509, 6615 }, { 8126, 1807, -1 }, { 0, 509, 6616 }, { 8074, 1803, -1 },
+    { 0, 509, 6617 }, { 5795, 509, 6618 }, { 5800, 509, 6622 }, { 8085, 1803, -1 },
+    { 0, 509, 6624 }, { 0, 509, 6625 }, { 0, 509, 6626 }, { 0, 509, 6627 },
+    { 0, 509, 6628 }, { 0, 509, 6629 }, { 0, 509, 6630 }, { 8129, 1732, -1 },
+    { 0, 509, 6631 }, { 0, 509, 6632 }, { 0, 509, 6633 }, { 0, 509, 6634 },
+    { 0, 509, 6635 }, { 0, 509, 6636 }, { 0, 509, 6637 }, { 0, 509, 6638 },
+    { 5797, 509, 6639 }, { 0, 509, 6641 }, { 0, 509, 6642 }, { 5802, 509, 6643 },
+    { 0, 509, 6649 }, { 0, 509, 6650 }, { 0, 509, 6651 }, { 5803, 509, 6652 },
+    { 0, 509, 6655 }, { 5801, 509, 6656 }, { 0, 509, 6658 }, { 5803, 509, 6659 },
+    { 8140, 1737, -1 }, { 0, 509, 6661 }, { 0, 509, 6662 }, { 0, 509, 6663 },
+    { 0, 509, 6664 }, { 0, 510, 6665 }, { 0, 510, 6666 }, { 0, 510, 6667 },
+    { 8141, 1759, -1 }, { 0, 510, 6668 }, { 5808, 510, 6669 }, { 0, 510, 6671 },
+    { 0, 510, 6672 }, { 5807, 510, 6673 }, { 0, 510, 6677 }, { 0, 510, 6678 },
+    { 0, 510, 6679 }, { 0, 510, 6680 }, { 7993, 1733, -1 }, { 8011, 1733, -1 },
+    { 8038, 1733, -1 }, { 0, 510, 6681 }, { 0, 510, 6682 }, { 0, 510, 6683 },
+    { 0, 510, 6684 }, { 0, 510, 6685 }, { 0, 510, 6686 }, { 0, 510, 6687 },
+    { 0, 510, 6688 }, { 8121, 1775, -1 }, { 0, 510, 6689 }, { 0, 510, 6690 },
+    { 0, 510, 6691 }, { 7971, 1700, -1 }, { 7985, 1700, -1 }, { 0, 510, 6692 },
+    { 0, 510, 6693 }, { 8002, 1700, -1 }, { 0, 510, 6694 }, { 0, 510, 6695 },
+    { 0, 510, 6696 }, { 5811, 510, 6697 }, { 0, 510, 6702 }, { 5810, 510, 6703 },
+    { 7899, 1682, -1 }, { 0, 510, 6705 }, { 0, 510, 6706 }, { 7895, 1682, -1 },
+    { 7904, 1682, -1 }, { 0, 510, 6707 }, { 0, 510, 6708 }, { 0, 510, 6709 },
+    { 0, 510, 6710 }, { 0, 510, 6711 }, { 0, 510, 6712 }, { 5811, 510, 6713 },
+    { 8110, 1786, -1 }, { 0, 510, 6715 }, { 0, 510, 6716 }, { 0, 510, 6717 },
+    { 0, 510, 6718 }, { 0, 510, 6719 }, { 0, 510, 6720 }, { 0, 510, 6721 },
+    { 5813, 510, 6722 }, { 0, 510, 6724 }, { 8127, 1788, -1 }, { 0, 510, 6725 },
+    { 0, 511, 6726 }, { 0, 511, 6727 }, { 0, 511, 6728 }, { 8142, 1751, -1 },
+    { 0, 511, 6729 }, { 8132, 1751, -1 }, { 0, 511, 6730 }, { 0, 511, 6731 },
+    { 8153, 1832, -1 }, { 0, 511, 6732 }, { 0, 511, 6733 }, { 8127, 1833, -1 },
+    { 0, 511, 6734 }, { 0, 511, 6735 }, { 8144, 1338, -1 }, { 0, 511, 6736 },
+    { 0, 511, 6737 }, { 0, 511, 6738 }, { 0, 511, 6739 }, { 0, 511, 6740 },
+    { 0, 511, 6741 }, { 8157, 1361, -1 }, { 0, 511, 6742 }, { 0, 511, 6743 },
+    { 0, 511, 6744 }, { 0, 511, 6745 }, { 8159, 141, -1 }, { 0, 511, 6746 },
+    { 0, 511, 6747 }, { 0, 511, 6748 }, { 0, 511, 6749 }, { 0, 511, 6750 },
+    { 8138, 837, -1 }, { 0, 511, 6751 }, { 0, 511, 6752 }, { 0, 511, 6753 },
+    { 0, 511, 6754 }, { 8156, 1345, -1 }, { 0, 511, 6755 }, { 0, 511, 6756 },
+    { 0, 511, 6757 }, { 8133, 1345, -1 }, { 0, 511, 6758 }, { 0, 511, 6759 },
+    { 0, 511, 6760 }, { 0, 511, 6761 }, { 8136, 849, -1 }, { 0, 511, 6762 },
+    { 5817, 511, 6763 }, { 0, 511, 6765 }, { 8158, 892, -1 }, { 0, 511, 6766 },
+    { 7670, 1585, -1 }, { 7724, 1585, -1 }, { 0, 511, 6767 }, { 7696, 1585, -1 },
+    { 7728, 1585, -1 }, { 7691, 1585, -1 }, { 8160, 1839, -1 }, { 5818, 513, 6773 },
+    { 0, 513, 6777 }, { 0, 513, 6778 }, { 0, 513, 6779 }, { 5817, 511, 6768 },
+    { 0, 513, 6780 }, { 0, 513, 6781 }, { 5821, 513, 6782 }, { 0, 513, 6785 },
+    { 0, 513, 6786 }, { 5824, 513, 6787 }, { 0, 513, 6791 }, { 5822, 513, 6792 },
+    { 5822, 513, 6794 }, { 0, 513, 6796 }, { 5826, 513, 6797 }, { 0, 513, 6799 },
+    { 5827, 513, 6800 }, { 5829, 513, 6804 }, { 0, 513, 6806 }, { 0, 513, 6807 },
+    { 0, 513, 6808 }, { 0, 513, 6809 }, { 0, 514, 6810 }, { 0, 514, 6811 },
+    { 0, 514, 6812 }, { 5830, 514, 6813 }, { 0, 514, 6815 }, { 0, 514, 6816 },
+    { 0, 514, 6817 }, { 8169, 1840, -1 }, { 0, 514, 6818 }, { 0, 514, 6819 },
+    { 0, 514, 6820 }, { 0, 514, 6821 }, { 0, 514, 6822 }, { 0, 514, 6823 },
+    { 0, 514, 6824 }, { 0, 514, 6825 }, { 0, 514, 6826 }, { 0, 514, 6827 },
+    { 0, 514, 6828 }, { 8162, 1865, -1 }, { 0, 514, 6829 }, { 0, 514, 6830 },
+    { 0, 514, 6831 }, { 0, 514, 6832 }, { 8130, 1867, -1 }, { 0, 514, 6833 },
+    { 0, 514, 6834 }, { 7935, 1625, -1 }, { 7985, 1625, -1 }, { 8011, 1625, -1 },
+    { 7997, 1625, -1 }, { 0, 514, 6835 }, { 0, 523, 6975 }, { 0, 523, 6976 },
+    { 0, 523, 6977 }, { 0, 523, 6978 }, { 5895, 523, 6979 }, { 5892, 523, 6981 },
+    { 5897, 523, 6983 }, { 0, 523, 6993 }, { 0, 523, 6994 }, { 0, 523, 6995 },
+    { 0, 523, 6996 }, { 6791, 946, -1 }, { 6877, 946, -1 }, { 6848, 946, -1 },
+    { 6857, 946, -1 }, { 6835, 946, -1 }, { 6880, 946, -1 }, { 8174, 1886, -1 },
+    { 5834, 514, -1 }, { 5839, 514, 6842 }, { 5841, 514, 6845 }, { 0, 514, 6850 },
+    { 0, 514, 6851 }, { 6960, 1067, -1 }, { 6905, 1067, -1 }, { 6970, 1067, -1 },
+    { 7002, 1067, -1 }, { 6980, 1067, -1 }, { 7014, 1067, -1 }, { 7028, 1067, -1 },
+    { 8174, 1850, -1 }, { 5836, 514, -1 }, { 0, 524, 6997 }, { 0, 524, 6998 },
+    { 5900, 524, 6999 }, { 0, 524, 7002 }, { 5904, 524, 7003 }, { 0, 524, 7005 },
+    { 5905, 524, 7006 }, { 0, 524, 7009 }, { 0, 524, 7010 }, { 0, 524, 7011 },
+    { 5902, 524, 7012 }, { 8182, 1876, -1 }, { 0, 524, 7014 }, { 0, 524, 7015 },
+    { 8110, 1838, -1 }, { 0, 524, 7016 }, { 0, 524, 7017 }, { 0, 524, 7018 },
+    { 8165, 1838, -1 }, { 0, 524, 7019 }, { 0, 524, 7020 }, { 8168, 1879, -1 },
+    { 0, 524, 7021 }, { 0, 524, 7022 }, { 5905, 524, 7023 }, { 8227, 1892, -1 },
+    { 0, 524, 7025 }, { 0, 524, 7026 }, { 5906, 524, 7027 }, { 5910, 524, 7029 },
+    { 0, 524, 7032 }, { 0, 524, 7033 }, { 5912, 524, 7034 }, { 0, 524, 7036 },
+    { 0, 524, 7037 }, { 8105, 1769, -1 }, { 5912, 524, 7038 }, { 8149, 1769, -1 },
+    { 0, 524, 7040 }, { 0, 524, 7041 }, { 5929, 527, 7069 }, { 8212, 1896, -1 },
+    { 0, 527, 7077 }, { 0, 527, 7078 }, { 0, 527, 7079 }, { 0, 527, 7080 },
+    { 0, 527, 7081 }, { 0, 527, 7082 }, { 5915, 527, 7083 }, { 0, 527, 7087 },
+    { 0, 527, 7088 }, { 0, 527, 7089 }, { 0, 527, 7090 }, { 5920, 527, 7091 },
+    { 8184, 1903, -1 }, { 0, 527, 7093 }, { 0, 527, 7094 }, { 0, 527, 7095 },
+    { 0, 527, 7096 }, { 8103, 1791, -1 }, { 8139, 1791, -1 }, { 0, 527, 7097 },
+    { 8164, 1875, -1 }, { 5927, 527, 7098 }, { 0, 527, 7100 }, { 8147, 1875, -1 },
+    { 0, 527, 7101 }, { 0, 528, 7102 }, { 0, 528, 7103 }, { 8139, 1847, -1 },
+    { 8154, 1847, -1 }, { 5927, 528, 7104 }, { 0, 528, 7106 }, { 5931, 528, 7107 },
+    { 8136, 1393, -1 }, { 0, 528, 7110 }, { 8165, 1393, -1 }, { 0, 528, 7111 },
+    { 0, 528, 7112 }, { 8239, 1912, -1 }, { 0, 528, 7113 }, { 8249, 1907, -1 },
+    { 0, 528, 7114 }, { 0, 528, 7115 }, { 0, 528, 7116 }, { 0, 528, 7117 },
+    { 8244, 1911, -1 }, { 0, 528, 7118 }, { 8113, 1763, -1 }, { 5936, 528, -1 },
+    { 8141, 1763, -1 }, { 8131, 1763, -1 }, { 5937, 528, -1 }, { 5938, 531, 7122 },
+    { 0, 531, 7126 }, { 0, 531, 7127 }, { 0, 531, 7128 }, { 0, 531, 7129 },
+    { 0, 531, 7130 }, { 8258, 1924, -1 }, { 0, 531, 7131 }, { 0, 531, 7132 },
+    { 0, 531, 7133 }, { 0, 531, 7134 }, { 0, 531, 7135 }, { 0, 531, 7136 },
+    { 0, 531, 7137 }, { 0, 531, 7138 }, { 5939, 531, 7139 }, { 0, 531, 7141 },
+    { 0, 531, 7142 }, { 0, 531, 7143 }, { 0, 531, 7144 }, { 5939, 532, 7145 },
+    { 0, 532, 7147 }, { 5941, 532, 7148 }, { 8257, 1926, -1 }, { 0, 532, 7150 },
+    { 0, 532, 7151 }, { 0, 532, 7152 }, { 0, 532, 7153 }, { 0, 532, 7154 },
+    { 8223, 1939, -1 }, { 0, 532, 7155 }, { 0, 532, 7156 }, { 0, 532, 7157 },
+    { 8186, 1862, -1 }, { 8148, 1862, -1 }, { 0, 532, 7158 }, { 0, 532, 7159 },
+    { 0, 532, 7160 }, { 0, 532, 7161 }, { 0, 532, 7162 }, { 8210, 1906, -1 },
+    { 8229, 1906, -1 }, { 0, 532, 7163 }, { 0, 532, 7164 }, { 0, 532, 7165 },
+    { 8217, 1943, -1 }, { 0, 532, 7166 }, { 0, 532, 7167 }, { 0, 532, 7168 },
+    { 0, 532, 7169 }, { 0, 532, 7170 }, { 0, 532, 7171 }, { 0, 532, 7172 },
+    { 0, 532, 7173 }, { 0, 532, 7174 }, { 0, 532, 7175 }, { 0, 532, 7176 },
+    { 0, 532, 7177 }, { 0, 533, 7183 }, { 0, 532, 7178 }, { 5944, 532, -1 },
+    { 8073, 1810, -1 }, { 8115, 1810, -1 }, { 8111, 1810, -1 }, { 0, 533, 7184 },
+    { 0, 533, 7185 }, { 6943, 1090, -1 }, { 7068, 1090, -1 }, { 7062, 1090, -1 },
+    { 6992, 1090, -1 }, { 7066, 1090, -1 }, { 7057, 1090, -1 }, { 6951, 1095, -1 },
+    { 7082, 1095, -1 }, { 7035, 1095, -1 }, { 7001, 1095, -1 }, { 6962, 1095, -1 },
+    { 5947, 533, -1 }, { 7045, 1126, -1 }, { 7120, 1126, -1 }, { 7114, 1126, -1 },
+    { 7156, 1126, -1 }, { 7137, 1126, -1 }, { 7184, 1126, -1 }, { 8259, 1933, -1 },
+    { 8235, 1933, -1 }, { 5945, 533, -1 }, { 7733, 1615, -1 }, { 7734, 1615, -1 },
+    { 0, 540, 7209 }, { 0, 540, 7210 }, { 7745, 1615, -1 }, { 7793, 1615, -1 },
+    { 8224, 1947, -1 }, { 0, 540, 7211 }, { 0, 540, 7212 }, { 0, 540, 7213 },
+    { 8269, 1953, -1 }, { 5946, 533, -1 }, { 0, 540, 7214 }, { 5948, 533, -1 },
+    { 0, 540, 7215 }, { 0, 540, 7216 }, { 8267, 1931, -1 }, { 0, 540, 7217 },
+    { 0, 540, 7218 }, { 0, 540, 7219 }, { 8230, 1935, -1 }, { 0, 540, 7220 },
+    { 0, 540, 7221 }, { 8124, 1849, -1 }, { 8170, 1849, -1 }, { 8175, 1849, -1 },
+    { 5951, 533, -1 }, { 0, 540, 7222 }, { 0, 540, 7223 }, { 0, 540, 7224 },
+    { 8258, 1937, -1 }, { 0, 540, 7225 }, { 0, 540, 7226 }, { 0, 540, 7227 },
+    { 0, 540, 7228 }, { 0, 540, 7229 }, { 0, 540, 7230 }, { 0, 540, 7231 },
+    { 0, 540, 7232 }, { 0, 540, 7233 }, { 0, 540, 7234 }, { 0, 540, 7235 },
+    { 0, 540, 7236 }, { 8277, 1951, -1 }, { 0, 540, 7237 }, { 8238, 1951, -1 },
+    { 0, 540, 7238 }, { 0, 540, 7239 }, { 8273, 1948, -1 }, { 0, 540, 7240 },
+    { 0, 540, 7241 }, { 0, 540, 7242 }, { 0, 540, 7243 }, { 8297, 1952, -1 },
+    { 0, 540, 7244 }, { 0, 540, 7245 }, { 0, 540, 7246 }, { 5956, 540, 7247 },
+    { 8216, 1909, -1 }, { 8233, 1909, -1 }, { 0, 540, 7249 }, { 8243, 1909, -1 },
+    { 0, 540, 7250 }, { 0, 541, 7251 }, { 0, 541, 7252 }, { 0, 541, 7253 },
+    { 0, 541, 7254 }, { 0, 541, 7255 }, { 8141, 1866, -1 }, { 8197, 1866, -1 },
+    { 8196, 1866, -1 }, { 8278, 1954, -1 }, { 0, 541, 7256 }, { 0, 541, 7257 },
+    { 0, 541, 7258 }, { 0, 541, 7259 }, { 0, 541, 7260 }, { 8299, 1957, -1 },
+    { 8252, 1968, -1 }, { 0, 541, 7261 }, { 0, 541, 7262 }, { 0, 541, 7263 },
+    { 0, 541, 7264 }, { 0, 541, 7265 }, { 8196, 1913, -1 }, { 8263, 1969, -1 },
+    { 8234, 1913, -1 }, { 8253, 1913, -1 }, { 0, 541, 7266 }, { 0, 541, 7267 },
+    { 0, 541, 7268 }, { 0, 541, 7269 }, { 8297, 1973, -1 }, { 8256, 1974, -1 },
+    { 0, 541, 7270 }, { 0, 546, 7271 }, { 5964, 546, 7272 }, { 5966, 546, 7274 },
+    { 0, 546, 7282 }, { 5963, 546, 7283 }, { 8301, 1975, -1 }, { 0, 546, 7285 },
+    { 0, 546, 7286 }, { 8270, 1991, -1 }, { 0, 546, 7287 }, { 0, 546, 7288 },
+    { 0, 546, 7289 }, { 0, 546, 7290 }, { 0, 546, 7291 }, { 0, 546, 7292 },
+    { 8306, 1981, -1 }, { 0, 546, 7293 }, { 8287, 1949, -1 }, { 0, 546, 7294 },
+    { 0, 546, 7295 }, { 0, 546, 7296 }, { 8270, 1949, -1 }, { 0, 546, 7297 },
+    { 0, 546, 7298 }, { 0, 546, 7299 }, { 0, 546, 7300 }, { 0, 546, 7301 },
+    { 0, 546, 7302 }, { 8294, 1986, -1 }, { 8309, 1986, -1 }, { 0, 546, 7303 },
+    { 0, 546, 7304 }, { 5969, 546, 7305 }, { 0, 547, 7309 }, { 0, 547, 7310 },
+    { 0, 547, 7311 }, { 5968, 547, 7312 }, { 5973, 547, 7314 }, { 0, 547, 7316 },
+    { 0, 547, 7317 }, { 0, 547, 7318 }, { 0, 547, 7319 }, { 0, 547, 7320 },
+    { 8303, 2006, -1 }, { 0, 547, 7321 }, { 8320, 2016, -1 }, { 0, 547, 7322 },
+    { 0, 547, 7323 }, { 8227, 1934, -1 }, { 0, 547, 7324 }, { 8276, 1934, -1 },
+    { 8259, 1934, -1 }, { 8237, 1934, -1 }, { 0, 547, 7325 }, { 8327, 2008, -1 },
+    { 0, 547, 7326 }, { 0, 547, 7327 }, { 0, 550, 7368 }, { 0, 547, 7328 },
+    { 0, 550, 7369 }, { 0, 547, 7329 }, { 8323, 2011, -1 }, { 0, 547, 7330 },
+    { 8265, 1992, -1 }, { 8315, 1992, -1 }, { 5982, 550, -1 }, { 8291, 1992, -1 },
+    { 0, 547, 7331 }, { 5974, 547, 7332 }, { 0, 550, 7371 }, { 0, 547, 7335 },
+    { 0, 547, 7336 }, { 0, 547, 7337 }, { 0, 547, 7338 }, { 0, 547, 7339 },
+    { 0, 547, 7340 }, { 0, 547, 7341 }, { 0, 547, 7342 }, { 5986, 550, -1 },
+    { 8279, 2015, -1 }, { 5971, 547, 7343 }, { 0, 552, 7385 }, { 8313, 2017, -1 },
+    { 0, 547, 7345 }, { 0, 552, 7386 }, { 0, 552, 7387 }, { 0, 552, 7388 },
+    { 0, 552, 7389 }, { 0, 552, 7390 }, { 0, 552, 7391 }, { 0, 552, 7392 },
+    { 0, 552, 7393 }, { 0, 552, 7394 }, { 0, 552, 7395 }, { 0, 547, 7346 },
+    { 7147, 1151, -1 }, { 7125, 1151, -1 }, { 7107, 1151, -1 }, { 7104, 1151, -1 },
+    { 7131, 1151, -1 }, { 8291, 1938, -1 }, { 8268, 1938, -1 }, { 8240, 1938, -1 },
+    { 0, 550, 7374 }, { 8271, 1938, -1 }, { 5990, 550, -1 }, { 5995, 552, 7396 },
+    { 0, 552, 7400 }, { 0, 552, 7401 }, { 8307, 2030, -1 }, { 8304, 2037, -1 },
+    { 8334, 2030, -1 }, { 0, 552, 7402 }, { 7147, 1167, -1 }, { 7161, 1167, -1 },
+    { 7162, 1167, -1 }, { 7182, 1167, -1 }, { 7190, 1167, -1 }, { 7163, 1174, -1 },
+    { 7218, 1174, -1 }, { 7247, 1174, -1 }, { 7195, 1174, -1 }, { 7230, 1174, -1 },
+    { 7227, 1174, -1 }, { 7151, 1178, -1 }, { 7245, 1178, -1 }, { 7176, 1178, -1 },
+    { 7231, 1178, -1 }, { 7248, 1178, -1 }, { 7232, 1178, -1 }, { 7230, 1210, -1 },
+    { 7272, 1210, -1 }, { 7306, 1210, -1 }, { 7276, 1210, -1 }, { 7294, 1210, -1 },
+    { 7283, 1210, -1 }, { 7311, 1277, -1 }, { 7322, 1277, -1 }, { 7314, 1277, -1 },
+    { 7328, 1277, -1 }, { 7302, 1277, -1 }, { 7399, 1295, -1 }, { 7383, 1295, -1 },
+    { 7394, 1295, -1 }, { 7408, 1295, -1 }, { 7419, 1295, -1 }, { 7441, 1369, -1 },
+    { 7502, 1369, -1 }, { 7492, 1369, -1 }, { 7515, 1369, -1 }, { 7505, 1369, -1 },
+    { 7522, 1369, -1 }, { 7472, 1395, -1 }, { 7555, 1395, -1 }, { 7565, 1395, -1 },
+    { 7537, 1395, -1 }, { 7538, 1395, -1 }, { 7559, 1395, -1 }, { 7532, 1412, -1 },
+    { 7578, 1412, -1 }, { 7540, 1412, -1 }, { 7590, 1412, -1 }, { 7590, 1412, -1 },
+    { 7709, 1556, -1 }, { 7728, 1556, -1 }, { 7698, 1556, -1 }, { 7751, 1556, -1 },
+    { 7758, 1556, -1 }, { 7747, 1237, -1 }, { 7806, 1237, -1 }, { 7860, 1237, -1 },
+    { 7918, 1237, -1 }, { 7971, 1237, -1 }, { 8012, 1237, -1 }, { 7752, 1239, -1 },
+    { 7803, 1239, -1 }, { 8291, 2048, -1 }, { 8293, 2048, -1 }, { 7770, 1239, -1 },
+    { 7822, 1239, -1 }, { 7780, 1241, -1 }, { 7987, 1241, -1 }, { 7848, 1241, -1 },
+    { 7838, 1241, -1 }, { 7835, 1241, -1 }, { 7806, 1241, -1 }, { 7797, 1654, -1 },
+    { 8008, 1654, -1 }, { 7864, 1654, -1 }, { 7836, 1654, -1 }, { 7850, 1654, -1 },
+    { 7881, 1654, -1 }, { 7873, 1686, -1 }, { 7873, 1686, -1 }, { 7902, 1686, -1 },
+    { 8322, 2055, -1 }, { 7928, 1686, -1 }, { 7891, 1686, -1 }, { 7993, 1701, -1 },
+    { 8060, 1701, -1 }, { 8063, 1701, -1 }, { 8037, 1701, -1 }, { 8078, 1701, -1 },
+    { 8067, 1701, -1 }, { 8005, 1483, -1 }, { 8351, 2056, -1 }, { 8076, 1483, -1 },
+    { 8035, 1483, -1 }, { 8074, 1483, -1 }, { 8082, 1483, -1 }, { 8181, 1860, -1 },
+    { 8178, 1860, -1 }, { 8323, 2018, -1 }, { 8156, 1860, -1 }, { 8183, 1860, -1 },
+    { 8139, 1863, -1 }, { 8169, 1863, -1 }, { 8189, 1863, -1 }, { 8147, 1863, -1 },
+    { 8197, 1863, -1 }, { 8181, 1863, -1 }, { 8204, 1868, -1 }, { 8201, 1868, -1 },
+    { 8175, 1868, -1 }, { 8171, 1868, -1 }, { 8191, 1868, -1 }, { 8170, 1873, -1 },
+    { 8218, 1873, -1 }, { 8203, 1873, -1 }, { 8216, 1873, -1 }, { 8202, 1873, -1 },
+    { 8185, 1873, -1 }, { 8262, 1914, -1 }, { 8258, 1914, -1 }, { 8246, 1914, -1 },
+    { 8235, 1914, -1 }, { 8302, 1989, -1 }, { 8294, 1989, -1 }, { 8297, 1989, -1 },
+    { 8318, 1989, -1 }, { 8310, 1971, -1 }, { 8286, 2032, -1 }, { 8313, 2024, -1 },
+    { 8266, 1971, -1 }, { 8311, 1971, -1 }, { 8315, 2032, -1 }, { 8330, 2036, -1 },
+    { 8312, 2041, -1 }, { 8301, 2036, -1 }, { 8334, 2036, -1 }, { 8329, 2043, -1 },
+    { 8356, 2046, -1 }, { 8316, 1402, -1 }, { 8347, 1419, -1 }, { 8306, 1427, -1 },
+    { 8349, 1428, -1 }, { 8312, 1431, -1 }, { 8340, 2078, -1 }, { 8348, 2082, -1 },
+    { 8360, 1428, -1 }, { 8370, 2103, -1 }, { 8352, 2111, -1 }, { 8316, 2112, -1 },
+    { 8320, 2112, -1 }, { 8365, 2128, -1 }, { 8372, 2019, -1 }, { 8364, 2021, -1 },
+    { 8366, 2022, -1 }, { 8356, 2054, -1 }, { 8371, 2022, -1 }, { 8379, 2060, -1 },
+    { 8352, 2071, -1 }, { 8373, 1645, -1 }, { 8357, 1664, -1 }, { 8370, 2071, -1 },
+    { 8375, 1668, -1 }, { 8337, 1674, -1 }, { 8374, 1668, -1 }, { 8373, 1679, -1 },
+    { 8367, 680, -1 }, { 8336, 693, -1 }, { 8384, 714, -1 }, { 8343, 718, -1 },
+    { 8345, 1018, -1 }, { 8374, 1018, -1 }, { 8388, 718, -1 }, { 8390, 1025, -1 },
+    { 8343, 1028, -1 }, { 8393, 1030, -1 }, { 8378, 1033, -1 }, { 8351, 2063, -1 },
+    { 8395, 1033, -1 }, { 8347, 2070, -1 }, { 8398, 2075, -1 }, { 8367, 2083, -1 },
+    { 8358, 2092, -1 }, { 8356, 2093, -1 }, { 8402, 2083, -1 }, { 8390, 2096, -1 },
+    { 8407, 2102, -1 }, { 8404, 2093, -1 }, { 8364, 2106, -1 }, { 8376, 2106, -1 },
+    { 8414, 2108, -1 }, { 8361, 2106, -1 }, { 8410, 2110, -1 }, { 8406, 2108, -1 },
+    { 8413, 2113, -1 }, { 8365, 2105, -1 }, { 8428, 2105, -1 }, { 8373, 2121, -1 },
+    { 8430, 2121, -1 }, { 8453, 2121, -1 }, { 8442, 2121, -1 }, { 8502, 2121, -1 },
+    { 8473, 2121, -1 }, { 8405, 2141, -1 }, { 8418, 2143, -1 }, { 8422, 2146, -1 },
+    { 8425, 2146, -1 }, { 8408, 2148, -1 }, { 8375, 2155, -1 }, { 8432, 2155, -1 },
+    { 8434, 2159, -1 }, { 8379, 2116, -1 }, { 8392, 2116, -1 }, { 8388, 2120, -1 },
+    { 8429, 2126, -1 }, { 8443, 2130, -1 }, { 8389, 2126, -1 }, { 8426, 2138, -1 },
+    { 8396, 2147, -1 }, { 8397, 2147, -1 }, { 8438, 2147, -1 }, { 8426, 2164, -1 },
+    { 8447, 2147, -1 }, { 8499, 2152, -1 }, { 8439, 2152, -1 }, { 8455, 2154, -1 },
+    { 8417, 2154, -1 }, { 8474, 2169, -1 }, { 8461, 2154, -1 }, { 8458, 2154, -1 },
+    { 8425, 1864, -1 }, { 8479, 1864, -1 }, { 8476, 1864, -1 }, { 8445, 1872, -1 },
+    { 8512, 1864, -1 }, { 8482, 1872, -1 }, { 8504, 1872, -1 }, { 8511, 1872, -1 },
+    { 8514, 1877, -1 }, { 8506, 1889, -1 }, { 8525, 1895, -1 }, { 8502, 1895, -1 },
+    { 8459, 1889, -1 }, { 8514, 1895, -1 }, { 8493, 1895, -1 }, { 8496, 1920, -1 },
+    { 8521, 2157, -1 }, { 8522, 2165, -1 }, { 8476, 2172, -1 }, { 8510, 2172, -1 },
+    { 8532, 2172, -1 }, { 8535, 2172, -1 }, { 8506, 2172, -1 }, { 8482, 2172, -1 },
+    { 8534, 2175, -1 }, { 8525, 2180, -1 }, { 8530, 2184, -1 }, { 8528, 2194, -1 },
+    { 8541, 2200, -1 }, { 8541, 2201, -1 }, { 8493, 2216, -1 }, { 8550, 901, -1 },
+    { 8524, 907, -1 }, { 8531, 907, -1 }, { 8543, 936, -1 }, { 8538, 957, -1 },
+    { 8552, 907, -1 }, { 8507, 976, -1 }, { 8518, 978, -1 }, { 8548, 990, -1 },
+    { 8549, 978, -1 }, { 8555, 978, -1 }, { 8571, 978, -1 }, { 8512, 980, -1 },
+    { 8573, 2183, -1 }, { 8563, 2178, -1 }, { 8528, 980, -1 }, { 8562, 2178, -1 },
+    { 8557, 980, -1 }, { 8524, 2179, -1 }, { 8577, 2179, -1 }, { 8579, 2179, -1 },
+    { 8571, 2197, -1 }, { 8573, 2199, -1 }, { 8561, 2197, -1 }, { 8592, 2210, -1 },
+    { 8568, 2210, -1 }, { 8541, 2212, -1 }, { 8588, 2213, -1 }, { 8576, 2210, -1 },
+    { 8541, 2214, -1 }, { 8551, 2217, -1 }, { 8546, 2219, -1 }, { 8586, 2219, -1 },
+    { 8598, 2219, -1 }, { 8592, 2219, -1 }, { 8600, 2219, -1 }, { 8547, 2222, -1 },
+    { 8601, 2222, -1 }, { 8601, 2222, -1 }, { 8610, 2222, -1 }, { 8571, 2222, -1 },
+    { 8615, 2222, -1 }, { 8586, 2228, -1 }, { 8562, 2228, -1 }, { 8600, 2218, -1 },
+    { 8610, 2220, -1 }, { 8583, 2224, -1 }, { 8566, 2232, -1 }, { 8630, 2232, -1 },
+    { 8598, 2220, -1 }, { 8574, 2234, -1 }, { 8587, 2235, -1 }, { 8635, 2246, -1 },
+    { 8592, 2248, -1 }, { 8627, 2249, -1 }, { 8627, 2235, -1 }, { 8614, 2250, -1 },
+    { 8592, 2251, -1 }, { 8615, 2255, -1 }, { 8625, 2258, -1 }, { 8596, 2265, -1 },
+    { 8636, 2284, -1 }, { 8595, 2266, -1 }, { 8617, 2266, -1 }, { 8625, 2265, -1 },
+    { 8649, 2266, -1 }, { 8603, 2280, -1 }, { 8661, 2280, -1 }, { 8661, 2280, -1 },
+    { 8620, 2280, -1 }, { 8659, 2280, -1 }, { 8660, 2280, -1 }, { 8638, 2281, -1 },
+    { 8656, 2281, -1 }, { 8628, 2279, -1 }, { 8622, 2285, -1 }, { 8627, 2285, -1 },
+    { 8627, 2291, -1 }, { 8659, 2279, -1 }, { 8630, 2303, -1 }, { 8670, 2310, -1 },
+    { 8676, 1389, -1 }, { 8679, 1392, -1 }, { 8649, 1392, -1 }, { 8640, 1401, -1 },
+    { 8683, 1401, -1 }, { 8668, 1401, -1 }, { 8666, 1422, -1 }, { 8654, 1424, -1 },
+    { 8695, 2304, -1 }, { 8674, 2304, -1 }, { 8659, 2304, -1 }, { 8698, 2304, -1 },
+    { 8691, 2306, -1 }, { 8674, 2308, -1 }, { 8681, 2312, -1 }, { 8654, 2314, -1 },
+    { 8679, 2314, -1 }, { 8683, 2319, -1 }, { 8710, 2320, -1 }, { 8685, 2320, -1 },
+    { 8659, 2330, -1 }, { 8712, 2330, -1 }, { 8710, 2352, -1 }, { 8701, 2357, -1 },
+    { 8701, 2237, -1 }, { 8714, 2357, -1 }, { 8720, 2357, -1 }, { 8701, 2240, -1 },
+    { 8724, 2247, -1 }, { 8675, 2252, -1 }, { 8676, 2269, -1 }, { 8700, 2272, -1 },
+    { 8679, 1212, -1 }, { 8681, 1249, -1 }, { 8705, 1212, -1 }, { 8683, 1251, -1 },
+    { 8732, 1249, -1 }, { 8735, 1258, -1 }, { 8720, 1259, -1 }, { 8692, 1259, -1 },
+    { 8736, 2095, -1 }, { 8700, 2104, -1 }, { 8718, 2129, -1 }, { 8717, 2132, -1 },
+    { 8687, 2135, -1 }, { 8734, 2135, -1 }, { 8719, 2135, -1 }, { 8726, 2135, -1 },
+    { 8713, 2135, -1 }, { 8735, 2135, -1 }, { 8724, 2144, -1 }, { 8742, 2163, -1 },
+    { 8729, 2198, -1 }, { 8733, 631, -1 }, { 8703, 647, -1 }, { 8705, 780, -1 },
+    { 8755, 1032, -1 }, { 8729, 1032, -1 }, { 8761, 1052, -1 }, { 8753, 1032, -1 },
+    { 8760, 1041, -1 }, { 8738, 1041, -1 }, { 8713, 1142, -1 }, { 8711, 1153, -1 },
+    { 8738, 1153, -1 }, { 8746, 1153, -1 }, { 8774, 1153, -1 }, { 8759, 1161, -1 },
+    { 8750, 1153, -1 }, { 8762, 1325, -1 }, { 8759, 1348, -1 }, { 8768, 1370, -1 },
+    { 8763, 1347, -1 }, { 8762, 1325, -1 }, { 8759, 1347, -1 }, { 8752, 1347, -1 },
+    { 8772, 1351, -1 }, { 8767, 1351, -1 }, { 8784, 1372, -1 }, { 8731, 2325, -1 },
+    { 8746, 2336, -1 }, { 8773, 2366, -1 }, { 8740, 2369, -1 }, { 8791, 2325, -1 },
+    { 8779, 2377, -1 }, { 8780, 2341, -1 }, { 8744, 2353, -1 }, { 8786, 2353, -1 },
+    { 8789, 2355, -1 }, { 8792, 2358, -1 }, { 8791, 2353, -1 }, { 8765, 2363, -1 },
+    { 8792, 2367, -1 }, { 8794, 2383, -1 }, { 8807, 2209, -1 }, { 8808, 2225, -1 },
+    { 8805, 2241, -1 }, { 8790, 2241, -1 }, { 8801, 2245, -1 }, { 8785, 1531, -1 },
+    { 8807, 2241, -1 }, { 8809, 1536, -1 }, { 8808, 1536, -1 }, { 8774, 1536, -1 },
+    { 8761, 1536, -1 }, { 8797, 1536, -1 }, { 8765, 1538, -1 }, { 8819, 1561, -1 },
+    { 8807, 1562, -1 }, { 8772, 1565, -1 }, { 8806, 1565, -1 }, { 8783, 1586, -1 },
+    { 8840, 2388, -1 }, { 8822, 1565, -1 }, { 8807, 1565, -1 }, { 8822, 2371, -1 },
+    { 8791, 2371, -1 }, { 8811, 2371, -1 }, { 8788, 2372, -1 }, { 8839, 2371, -1 },
+    { 8849, 2399, -1 }, { 8842, 2372, -1 }, { 8790, 2396, -1 }, { 8842, 2396, -1 },
+    { 8840, 2396, -1 }, { 8803, 2414, -1 }, { 8838, 2396, -1 }, { 8833, 2420, -1 },
+    { 8853, 2422, -1 }, { 8847, 2414, -1 }, { 8827, 2420, -1 }, { 8800, 2426, -1 },
+    { 8815, 2380, -1 }, { 8847, 2397, -1 }, { 8805, 2403, -1 }, { 8854, 2409, -1 },
+    { 8851, 2410, -1 }, { 8832, 2410, -1 }, { 8841, 2418, -1 }, { 8836, 2409, -1 },
+    { 8812, 2416, -1 }, { 8866, 2416, -1 }, { 8849, 2416, -1 }, { 8856, 2416, -1 },
+    { 8871, 2416, -1 }, { 8849, 2416, -1 }, { 8877, 2425, -1 }, { 8834, 2427, -1 },
+    { 8870, 2435, -1 }, { 8828, 2437, -1 }, { 8829, 2188, -1 }, { 8840, 2202, -1 },
+    { 8878, 2202, -1 }, { 8884, 2202, -1 }, { 8885, 2202, -1 }, { 8875, 2207, -1 },
+    { 8874, 2211, -1 }, { 8889, 2207, -1 }, { 8881, 2226, -1 }, { 8895, 2226, -1 },
+    { 8832, 2439, -1 }, { 8842, 2443, -1 }, { 8844, 2455, -1 }, { 8883, 2439, -1 },
+    { 8873, 2455, -1 }, { 8888, 2457, -1 }, { 8851, 2479, -1 }, { 8911, 2509, -1 },
+    { 8892, 2479, -1 }, { 8850, 2480, -1 }, { 8891, 2480, -1 }, { 8895, 2480, -1 },
+    { 8880, 2484, -1 }, { 8921, 2510, -1 }, { 8898, 2484, -1 }, { 8858, 2493, -1 },
+    { 8858, 2493, -1 }, { 8859, 2493, -1 }, { 8899, 2461, -1 }, { 8898, 2461, -1 },
+    { 8891, 2461, -1 }, { 8910, 2461, -1 }, { 8925, 2461, -1 }, { 8920, 2467, -1 },
+    { 8922, 2467, -1 }, { 8871, 2471, -1 }, { 8935, 2471, -1 }, { 8908, 2471, -1 },
+    { 8915, 2471, -1 }, { 8892, 2471, -1 }, { 8886, 2515, -1 }, { 8887, 2470, -1 },
+    { 8935, 2470, -1 }, { 8897, 2470, -1 }, { 8917, 2470, -1 }, { 8922, 2470, -1 },
+    { 8901, 2481, -1 }, { 8951, 2487, -1 }, { 8936, 2503, -1 }, { 8922, 2513, -1 },
+    { 8947, 2503, -1 }, { 8955, 2513, -1 }, { 8967, 2514, -1 }, { 8922, 2519, -1 },
+    { 8916, 2519, -1 }, { 8915, 2521, -1 }, { 8926, 2517, -1 }, { 8946, 2521, -1 },
+    { 8921, 2522, -1 }, { 8972, 2544, -1 }, { 8971, 2559, -1 }, { 8929, 2568, -1 },
+    { 8987, 2568, -1 }, { 8974, 2568, -1 }, { 8988, 2568, -1 }, { 8996, 2568, -1 },
+    { 8999, 2568, -1 }, { 8983, 930, -1 }, { 8951, 932, -1 }, { 8933, 939, -1 },
+    { 9004, 954, -1 }, { 8990, 1000, -1 }, { 8982, 1019, -1 }, { 9009, 2527, -1 },
+    { 9013, 2541, -1 }, { 8980, 2557, -1 }, { 9006, 2557, -1 }, { 8964, 2565, -1 },
+    { 9007, 1143, -1 }, { 8982, 1160, -1 }, { 9017, 1160, -1 }, { 9011, 1162, -1 },
+    { 8969, 1184, -1 }, { 8975, 2567, -1 }, { 9030, 2588, -1 }, { 9030, 2605, -1 },
+    { 8984, 2606, -1 }, { 9022, 545, -1 }, { 9030, 584, -1 }, { 9034, 568, -1 },
+    { 9035, 2539, -1 }, { 9033, 584, -1 }, { 8994, 2570, -1 }, { 9042, 2570, -1 },
+    { 9009, 2570, -1 }, { 9043, 2570, -1 }, { 9039, 2575, -1 }, { 9045, 2580, -1 },
+    { 9030, 2591, -1 }, { 9031, 2603, -1 }, { 9048, 2607, -1 }, { 9054, 2631, -1 },
+    { 9050, 2641, -1 }, { 9059, 2641, -1 }, { 9052, 2642, -1 }, { 9066, 2618, -1 },
+    { 9062, 2625, -1 }, { 9024, 2633, -1 }, { 9059, 2642, -1 }, { 9061, 2645, -1 },
+    { 9022, 2645, -1 }, { 9037, 2645, -1 }, { 9059, 2645, -1 }, { 9066, 2645, -1 },
+    { 9022, 2630, -1 }, { 9055, 2630, -1 }, { 9026, 2637, -1 }, { 9068, 2637, -1 },
+    { 9041, 2637, -1 }, { 9026, 2638, -1 }, { 9032, 1076, -1 }, { 9057, 2637, -1 },
+    { 9050, 1084, -1 }, { 9078, 669, -1 }, { 9063, 669, -1 }, { 9088, 694, -1 },
+    { 9037, 695, -1 }, { 9067, 701, -1 }, { 9068, 183, -1 }, { 9085, 217, -1 },
+    { 9084, 220, -1 }, { 9093, 227, -1 }, { 9046, 227, -1 }, { 9057, 1096, -1 },
+    { 9077, 1097, -1 }, { 9092, 1109, -1 }, { 9067, 2609, -1 }, { 9063, 2627, -1 },
+    { 9094, 2629, -1 }, { 9068, 2643, -1 }, { 9057, 2655, -1 }, { 9108, 2629, -1 },
+    { 9082, 797, -1 }, { 9064, 2655, -1 }, { 9108, 2659, -1 }, { 9097, 2659, -1 },
+    { 9108, 2622, -1 }, { 9061, 2624, -1 }, { 9125, 2636, -1 }, { 9113, 2664, -1 },
+    { 9121, 2669, -1 }, { 9123, 2685, -1 }, { 9065, 2664, -1 }, { 9074, 2686, -1 },
+    { 9075, 2704, -1 }, { 9118, 1430, -1 }, { 9072, 1432, -1 }, { 9119, 1432, -1 },
+    { 9080, 1468, -1 }, { 9135, 1215, -1 }, { 9131, 1247, -1 }, { 9110, 1787, -1 },
+    { 9084, 1790, -1 }, { 9126, 1790, -1 }, { 9098, 1790, -1 }, { 9125, 1836, -1 },
+    { 9082, 505, -1 }, { 9100, 529, -1 }, { 9100, 864, -1 }, { 9139, 873, -1 },
+    { 9132, 2671, -1 }, { 9092, 2693, -1 }, { 9102, 2695, -1 }, { 9142, 2707, -1 },
+    { 9142, 2698, -1 }, { 9122, 2695, -1 }, { 9144, 2698, -1 }, { 9141, 2708, -1 },
+    { 9134, 2698, -1 }, { 9100, 2715, -1 }, { 9128, 2716, -1 }, { 9146, 2717, -1 },
+    { 9111, 2715, -1 }, { 9153, 2715, -1 }, { 9157, 2720, -1 }, { 9135, 2720, -1 },
+    { 9108, 2720, -1 }, { 9134, 2720, -1 }, { 9150, 2720, -1 }, { 9110, 2722, -1 },
+    { 9144, 2726, -1 }, { 9118, 882, -1 }, { 9151, 2722, -1 }, { 9160, 902, -1 },
+    { 9147, 2711, -1 }, { 9171, 2713, -1 }, { 9153, 2746, -1 }, { 9128, 2713, -1 },
+    { 9121, 2731, -1 }, { 9121, 2731, -1 }, { 9180, 2731, -1 }, { 9185, 2733, -1 },
+    { 9184, 2736, -1 }, { 9177, 2733, -1 }, { 9167, 2744, -1 }, { 9128, 2747, -1 },
+    { 9188, 1315, -1 }, { 9164, 1315, -1 }, { 9144, 1315, -1 }, { 9193, 1315, -1 },
+    { 9190, 1315, -1 }, { 9137, 1316, -1 }, { 9184, 1316, -1 }, { 9195, 1316, -1 },
+    { 9198, 1316, -1 }, { 9195, 1316, -1 }, { 9196, 1707, -1 }, { 9202, 1709, -1 },
+    { 9197, 1710, -1 }, { 9182, 1710, -1 }, { 9189, 1707, -1 }, { 9199, 1722, -1 },
+    { 9207, 1749, -1 }, { 9187, 1749, -1 }, { 9212, 1752, -1 }, { 9211, 1752, -1 },
+    { 9212, 1749, -1 }, { 9206, 2761, -1 }, { 9162, 2763, -1 }, { 9163, 2771, -1 },
+    { 9212, 2771, -1 }, { 9217, 2771, -1 }, { 9219, 2772, -1 }, { 9221, 2773, -1 },
+    { 9222, 2778, -1 }, { 9203, 2779, -1 }, { 9179, 2782, -1 }, { 9176, 2805, -1 },
+    { 9258, 1464, -1 }, { 9224, 2779, -1 }, { 9228, 2807, -1 }, { 9221, 2807, -1 },
+    { 9233, 2811, -1 }, { 9219, 2811, -1 }, { 9186, 894, -1 }, { 9237, 894, -1 },
+    { 9210, 1465, -1 }, { 9217, 894, -1 }, { 9214, 894, -1 }, { 9230, 894, -1 },
+    { 9193, 914, -1 }, { 9243, 914, -1 }, { 9195, 943, -1 }, { 9238, 1499, -1 },
+    { 9225, 943, -1 }, { 9243, 943, -1 }, { 9250, 943, -1 }, { 9201, 1253, -1 },
+    { 9255, 1253, -1 }, { 9207, 1286, -1 }, { 9235, 1286, -1 }, { 9252, 1253, -1 },
+    { 9255, 1253, -1 }, { 9259, 1501, -1 }, { 9251, 1511, -1 }, { 9212, 2783, -1 },
+    { 9264, 2800, -1 }, { 9265, 2801, -1 }, { 9266, 2806, -1 }, { 9240, 2806, -1 },
+    { 9244, 2329, -1 }, { 9264, 2806, -1 }, { 9258, 2806, -1 }, { 9272, 2348, -1 },
+    { 9220, 2376, -1 }, { 9234, 2387, -1 }, { 9250, 1639, -1 }, { 9227, 1660, -1 },
+    { 9261, 1662, -1 }, { 9223, 1298, -1 }, { 9269, 1329, -1 }, { 9280, 1136, -1 },
+    { 9281, 1175, -1 }, { 9274, 1179, -1 }, { 9289, 1175, -1 }, { 9281, 1062, -1 },
+    { 9241, 1064, -1 }, { 9288, 1066, -1 }, { 9281, 2786, -1 }, { 9242, 2787, -1 },
+    { 9242, 2797, -1 }, { 9244, 2786, -1 }, { 9272, 2787, -1 }, { 9285, 2802, -1 },
+    { 9258, 1793, -1 }, { 9256, 1854, -1 }, { 9290, 1793, -1 }, { 9290, 2819, -1 },
+    { 9250, 2820, -1 }, { 9293, 2822, -1 }, { 9285, 2820, -1 }, { 9308, 2830, -1 },
+    { 9287, 2830, -1 }, { 9256, 2832, -1 }, { 9293, 2832, -1 }, { 9287, 2830, -1 },
+    { 9266, 2832, -1 }, { 9303, 2836, -1 }, { 9284, 2837, -1 }, { 9300, 2837, -1 },
+    { 9261, 2857, -1 }, { 9290, 2866, -1 }, { 9272, 2867, -1 }, { 9274, 2866, -1 },
+    { 9321, 2866, -1 }, { 9297, 2038, -1 }, { 9314, 2089, -1 }, { 9319, 2089, -1 },
+    { 9282, 2097, -1 }, { 9270, 2099, -1 }, { 9272, 1425, -1 }, { 9278, 1442, -1 },
+    { 9320, 1474, -1 }, { 9322, 2814, -1 }, { 9281, 1477, -1 }, { 9273, 1474, -1 },
+    { 9328, 1477, -1 }, { 9303, 2829, -1 }, { 9328, 1477, -1 }, { 9321, 1477, -1 },
+    { 9333, 2834, -1 }, { 9325, 2834, -1 }, { 9343, 2840, -1 }, { 9335, 1339, -1 },
+    { 9324, 1350, -1 }, { 9297, 1353, -1 }, { 9340, 1339, -1 }, { 9333, 1358, -1 },
+    { 9297, 1365, -1 }, { 9299, 1375, -1 }, { 9351, 1385, -1 }, { 9330, 1385, -1 },
+    { 9316, 1385, -1 }, { 9305, 1936, -1 }, { 9356, 1942, -1 }, { 9325, 1945, -1 },
+    { 9356, 2334, -1 }, { 9315, 2334, -1 }, { 9315, 2334, -1 }, { 9367, 2334, -1 },
+    { 9368, 2334, -1 }, { 9335, 2337, -1 }, { 9366, 2370, -1 }, { 9365, 2379, -1 },
+    { 9345, 2379, -1 }, { 9329, 2379, -1 }, { 9320, 2821, -1 }, { 9350, 2821, -1 },
+    { 9334, 2821, -1 }, { 9373, 2844, -1 }, { 9324, 2854, -1 }, { 9337, 1031, -1 },
+    { 9370, 1054, -1 }, { 9336, 1409, -1 }, { 9374, 2851, -1 }, { 9341, 2851, -1 },
+    { 9382, 2865, -1 }, { 9352, 2884, -1 }, { 9388, 2904, -1 }, { 9368, 2904, -1 },
+    { 9396, 2904, -1 }, { 9392, 2904, -1 }, { 9393, 1965, -1 }, { 9344, 1976, -1 },
+    { 9347, 2014, -1 }, { 9394, 2014, -1 }, { 9406, 2014, -1 }, { 9379, 2014, -1 },
+    { 9347, 2014, -1 }, { 9405, 2014, -1 }, { 9395, 1198, -1 }, { 9385, 1198, -1 },
+    { 9386, 1200, -1 }, { 9380, 1209, -1 }, { 9385, 1198, -1 }, { 9357, 1205, -1 },
+    { 9410, 1205, -1 }, { 9393, 1213, -1 }, { 9415, 153, -1 }, { 9403, 1213, -1 },
+    { 9416, 1213, -1 }, { 9398, 155, -1 }, { 9421, 165, -1 }, { 9393, 130, -1 },
+    { 9371, 2891, -1 }, { 9406, 2891, -1 }, { 9430, 2896, -1 }, { 9412, 130, -1 },
+    { 9420, 2892, -1 }, { 9431, 2891, -1 }, { 9377, 2892, -1 }, { 9428, 2892, -1 },
+    { 9421, 2892, -1 }, { 9405, 2894, -1 }, { 9433, 2894, -1 }, { 9430, 2900, -1 },
+    { 9418, 2905, -1 }, { 9385, 2909, -1 }, { 9404, 2911, -1 }, { 9440, 2914, -1 },
+    { 9443, 2926, -1 }, { 9395, 2928, -1 }, { 9414, 2928, -1 }, { 9428, 2937, -1 },
+    { 9451, 2928, -1 }, { 9448, 2928, -1 }, { 9449, 2939, -1 }, { 9399, 2941, -1 },
+    { 9446, 2941, -1 }, { 9454, 2941, -1 }, { 9430, 2943, -1 }, { 9457, 2946, -1 },
+    { 9461, 2950, -1 }, { 9410, 2952, -1 }, { 9465, 2957, -1 }, { 9461, 2957, -1 },
+    { 9455, 2957, -1 }, { 9460, 2957, -1 }, { 9448, 2957, -1 }, { 9413, 2964, -1 },
+    { 9424, 2974, -1 }, { 9415, 2977, -1 }, { 9432, 2977, -1 }, { 9470, 2977, -1 },
+    { 9453, 2977, -1 }, { 9479, 2977, -1 }, { 9424, 2978, -1 }, { 9470, 2984, -1 },
+    { 9471, 2985, -1 }, { 9480, 2995, -1 }, { 9483, 3005, -1 }, { 9482, 3008, -1 },
+    { 9487, 3014, -1 }, { 9487, 3015, -1 }, { 9476, 3018, -1 }, { 9484, 3008, -1 },
+    { 9467, 3027, -1 }, { 9489, 3015, -1 }, { 9437, 1852, -1 }, { 9445, 1852, -1 },
+    { 9464, 1881, -1 }, { 9455, 1534, -1 }, { 9496, 1852, -1 }, { 9453, 1547, -1 },
+    { 9502, 1547, -1 }, { 9450, 1566, -1 }, { 9458, 1569, -1 }, { 9454, 1273, -1 },
+    { 9462, 1301, -1 }, { 9490, 1311, -1 }, { 9461, 3040, -1 }, { 9482, 3040, -1 },
+    { 9493, 3040, -1 }, { 9515, 3040, -1 }, { 9506, 3040, -1 }, { 9463, 3042, -1 },
+    { 9521, 3051, -1 }, { 9506, 3052, -1 }, { 9468, 3060, -1 }, { 9470, 3090, -1 },
+    { 9481, 3062, -1 }, { 9506, 3066, -1 }, { 9516, 3060, -1 }, { 9478, 3065, -1 },
+    { 9478, 3065, -1 }, { 9507, 3065, -1 }, { 9475, 3065, -1 }, { 9531, 3082, -1 },
+    { 9538, 3085, -1 }, { 9510, 3089, -1 }, { 9528, 3092, -1 }, { 9501, 3093, -1 },
+    { 9545, 3102, -1 }, { 9510, 3108, -1 }, { 9537, 3103, -1 }, { 9545, 3103, -1 },
+    { 9525, 3112, -1 }, { 9539, 3114, -1 }, { 9553, 3128, -1 }, { 9536, 3128, -1 },
+    { 9499, 3133, -1 }, { 9542, 3133, -1 }, { 9532, 3133, -1 }, { 9548, 3154, -1 },
+    { 9557, 3161, -1 }, { 9552, 3133, -1 }, { 9557, 3130, -1 }, { 9530, 3131, -1 },
+    { 9511, 3136, -1 }, { 9560, 3136, -1 }, { 9522, 3136, -1 }, { 9545, 3136, -1 },
+    { 9525, 3136, -1 }, { 9555, 3136, -1 }, { 9529, 3138, -1 }, { 9525, 3147, -1 },
+    { 9575, 3147, -1 }, { 9563, 3170, -1 }, { 9523, 3081, -1 }, { 9532, 3081, -1 },
+    { 9531, 3170, -1 }, { 9523, 3075, -1 }, { 9564, 3075, -1 }, { 9535, 3075, -1 },
+    { 9539, 3075, -1 }, { 9557, 3086, -1 }, { 9584, 3113, -1 }, { 9586, 3127, -1 },
+    { 9580, 627, -1 }, { 9565, 652, -1 }, { 9537, 1416, -1 }, { 9549, 1420, -1 },
+    { 9590, 1423, -1 }, { 9553, 1433, -1 }, { 9553, 3146, -1 }, { 9560, 1423, -1 },
+    { 9545, 3156, -1 }, { 9547, 3157, -1 }, { 9599, 3157, -1 }, { 9596, 3157, -1 },
+    { 9587, 3157, -1 }, { 9554, 3157, -1 }, { 9595, 3162, -1 }, { 9593, 3174, -1 },
+    { 9557, 3186, -1 }, { 9596, 3192, -1 }, { 9604, 3201, -1 }, { 9608, 2465, -1 },
+    { 9581, 2468, -1 }, { 9610, 2469, -1 }, { 9602, 3201, -1 }, { 9611, 2473, -1 },
+    { 9600, 2474, -1 }, { 9568, 2652, -1 }, { 9619, 2663, -1 }, { 9586, 2652, -1 },
+    { 9620, 2699, -1 }, { 9623, 2699, -1 }, { 9608, 2699, -1 }, { 9623, 2699, -1 },
+    { 9619, 2699, -1 }, { 9623, 3196, -1 }, { 9612, 3196, -1 }, { 9619, 3198, -1 },
+    { 9637, 3200, -1 }, { 9639, 3196, -1 }, { 9589, 3221, -1 }, { 9625, 3221, -1 },
+    { 9637, 3232, -1 }, { 9635, 3221, -1 }, { 9642, 3221, -1 }, { 9635, 3240, -1 },
+    { 9649, 3205, -1 }, { 9591, 3206, -1 }, { 9628, 3206, -1 }, { 9658, 3206, -1 },
+    { 9635, 3206, -1 }, { 9605, 3217, -1 }, { 9650, 3206, -1 }, { 9602, 3257, -1 },
+    { 9657, 3257, -1 }, { 9610, 3237, -1 }, { 9610, 3237, -1 }, { 9620, 3244, -1 },
+    { 9636, 3257, -1 }, { 9655, 3237, -1 }, { 9663, 3244, -1 }, { 9634, 3244, -1 },
+    { 9614, 3258, -1 }, { 9616, 3261, -1 }, { 9638, 3261, -1 }, { 9648, 3261, -1 },
+    { 9677, 3261, -1 }, { 9674, 3261, -1 }, { 9650, 3266, -1 }, { 9681, 3267, -1 },
+    { 9633, 3275, -1 }, { 9704, 3275, -1 }, { 9722, 3275, -1 }, { 9765, 3275, -1 },
+    { 9686, 3275, -1 }, { 9729, 3275, -1 }, { 9680, 3283, -1 }, { 9662, 3272, -1 },
+    { 9681, 3299, -1 }, { 9684, 3305, -1 }, { 9643, 565, -1 }, { 9692, 3204, -1 },
+    { 9668, 569, -1 }, { 9699, 565, -1 }, { 9688, 569, -1 }, { 9649, 3212, -1 },
+    { 9680, 3213, -1 }, { 9695, 3214, -1 }, { 9696, 3236, -1 }, { 9713, 704, -1 },
+    { 9680, 706, -1 }, { 9719, 3236, -1 }, { 9711, 704, -1 }, { 9726, 720, -1 },
+    { 9673, 1510, -1 }, { 9696, 1510, -1 }, { 9739, 1510, -1 }, { 9712, 1510, -1 },
+    { 9734, 1510, -1 }, { 9744, 1510, -1 }, { 9718, 1513, -1 }, { 9740, 2656, -1 },
+    { 9758, 2662, -1 }, { 9710, 2681, -1 }, { 9753, 2656, -1 }, { 9726, 2656, -1 },
+    { 9752, 2696, -1 }, { 9740, 2696, -1 }, { 9723, 1148, -1 }, { 9754, 2696, -1 },
+    { 9759, 578, -1 }, { 9723, 578, -1 }, { 9767, 1169, -1 }, { 9770, 1173, -1 },
+    { 9773, 613, -1 }, { 9782, 634, -1 }, { 9771, 3277, -1 }, { 9771, 613, -1 },
+    { 9794, 3306, -1 }, { 9762, 3277, -1 }, { 9769, 3309, -1 }, { 9783, 2463, -1 },
+    { 9791, 2472, -1 }, { 9787, 3308, -1 }, { 9746, 3316, -1 }, { 9780, 3321, -1 },
+    { 9749, 3347, -1 }, { 9801, 2512, -1 }, { 9753, 2512, -1 }, { 9802, 2538, -1 },
+    { 9784, 2543, -1 }, { 9776, 2543, -1 }, { 9785, 3063, -1 }, { 9802, 200, -1 },
+    { 9762, 131, -1 }, { 9759, 3292, -1 }, { 9804, 3297, -1 }, { 9810, 3292, -1 },
+    { 9766, 3304, -1 }, { 9818, 3304, -1 }, { 9768, 3327, -1 }, { 9777, 3329, -1 },
+    { 9830, 3336, -1 }, { 9816, 3329, -1 }, { 9829, 3332, -1 }, { 9826, 3332, -1 },
+    { 9818, 3332, -1 }, { 9818, 3332, -1 }, { 9834, 3332, -1 }, { 9805, 2552, -1 },
+    { 9832, 2552, -1 }, { 9833, 2563, -1 }, { 9827, 2584, -1 }, { 9839, 2156, -1 },
+    { 9838, 2160, -1 }, { 9797, 743, -1 }, { 9839, 2584, -1 }, { 9843, 205, -1 },
+    { 9833, 205, -1 }, { 9838, 137, -1 }, { 9841, 205, -1 }, { 9802, 132, -1 },
+    { 9856, 132, -1 }, { 9831, 3354, -1 }, { 9816, 3354, -1 }, { 9863, 3355, -1 },
+    { 9859, 3357, -1 }, { 9856, 3371, -1 }, { 9838, 3379, -1 }, { 9859, 3388, -1 },
+    { 9845, 3391, -1 }, { 9852, 3388, -1 }, { 9863, 3388, -1 }, { 9850, 3388, -1 },
+    { 9822, 133, -1 }, { 9845, 133, -1 }, { 9825, 181, -1 }, { 9856, 506, -1 },
+    { 9820, 133, -1 }, { 9830, 219, -1 }, { 9832, 224, -1 }, { 9874, 3401, -1 },
+    { 9880, 224, -1 }, { 9858, 224, -1 }, { 9890, 3402, -1 }, { 9877, 224, -1 },
+    { 9892, 3404, -1 }, { 9896, 3424, -1 }, { 9851, 3436, -1 }, { 9876, 3424, -1 },
+    { 9842, 3445, -1 }, { 9847, 3445, -1 }, { 9856, 3445, -1 }, { 9855, 3449, -1 },
+    { 9854, 3452, -1 }, { 9900, 3453, -1 }, { 9852, 3455, -1 }, { 9909, 3461, -1 },
+    { 9896, 3453, -1 }, { 9899, 3469, -1 }, { 9858, 3455, -1 }, { 9894, 3455, -1 },
+    { 9852, 3458, -1 }, { 9887, 3458, -1 }, { 9856, 3470, -1 }, { 9868, 3470, -1 },
+    { 9900, 3476, -1 }, { 9863, 3477, -1 }, { 9886, 3481, -1 }, { 9894, 3477, -1 },
+    { 9895, 3484, -1 }, { 9909, 3487, -1 }, { 9917, 3487, -1 }, { 9866, 3488, -1 },
+    { 9867, 3494, -1 }, { 9867, 3494, -1 }, { 9873, 3497, -1 }, { 9924, 3499, -1 },
+    { 9872, 3504, -1 }, { 9878, 3507, -1 }, { 9900, 3499, -1 }, { 9923, 3530, -1 },
+    { 9884, 3540, -1 }, { 9931, 3540, -1 }, { 9881, 3551, -1 }, { 9913, 3551, -1 },
+    { 9919, 3551, -1 }, { 9936, 3551, -1 }, { 9939, 3551, -1 }, { 9945, 3551, -1 },
+    { 9892, 705, -1 }, { 9889, 732, -1 }, { 9947, 305, -1 }, { 9939, 814, -1 },
+    { 9940, 840, -1 }, { 9896, 862, -1 }, { 9959, 3554, -1 }, { 9944, 3559, -1 },
+    { 9933, 3563, -1 }, { 9919, 3565, -1 }, { 9907, 3568, -1 }, { 9908, 3568, -1 },
+    { 9907, 3576, -1 }, { 9912, 3576, -1 }, { 9954, 3580, -1 }, { 9956, 3582, -1 },
+    { 9954, 3585, -1 }, { 9934, 3595, -1 }, { 9960, 3599, -1 }, { 9955, 3599, -1 },
+    { 9925, 3602, -1 }, { 9927, 3617, -1 }, { 9964, 3617, -1 }, { 9973, 3617, -1 },
+    { 9927, 3617, -1 }, { 9948, 3617, -1 }, { 9958, 3617, -1 }, { 9932, 3621, -1 },
+    { 9968, 3623, -1 }, { 9938, 3623, -1 }, { 9958, 3640, -1 }, { 9996, 3640, -1 },
+    { 9992, 3641, -1 }, { 9984, 3642, -1 }, { 9946, 1646, -1 }, { 9948, 1690, -1 },
+    { 9973, 3641, -1 }, { 9997, 3633, -1 }, { 9963, 3668, -1 }, { 9994, 3633, -1 },
+    { 9975, 3672, -1 }, { 10009, 1607, -1 }, { 9998, 3672, -1 }, { 9956, 1653, -1 },
+    { 9956, 3681, -1 }, { 10007, 3683, -1 }, { 9972, 3681, -1 }, { 9959, 3684, -1 },
+    { 10010, 3681, -1 }, { 10007, 3687, -1 }, { 10014, 3687, -1 }, { 9997, 3689, -1 },
+    { 9996, 3702, -1 }, { 9978, 3736, -1 }, { 9965, 3702, -1 }, { 9972, 3737, -1 },
+    { 10021, 3737, -1 }, { 10013, 3747, -1 }, { 10010, 3737, -1 }, { 9989, 3737, -1 },
+    { 10030, 3737, -1 }, { 10023, 3749, -1 }, { 9989, 3767, -1 }, { 10013, 3751, -1 },
+    { 10012, 3756, -1 }, { 10019, 3766, -1 }, { 10015, 3769, -1 }, { 10039, 3773, -1 },
+    { 9990, 3774, -1 }, { 10033, 3774, -1 }, { 10041, 3776, -1 }, { 10037, 3773, -1 },
+    { 10059, 3786, -1 }, { 10046, 3774, -1 }, { 10042, 3777, -1 }, { 10001, 3777, -1 },
+    { 10002, 3779, -1 }, { 10046, 3779, -1 }, { 10062, 3810, -1 }, { 10010, 3779, -1 },
+    { 10008, 3804, -1 }, { 10055, 3779, -1 }, { 10010, 3783, -1 }, { 10053, 3804, -1 },
+    { 10023, 3804, -1 }, { 10069, 3783, -1 }, { 10055, 3789, -1 }, { 10059, 3794, -1 },
+    { 10074, 3796, -1 }, { 10014, 3798, -1 }, { 10050, 3801, -1 }, { 10064, 3809, -1 },
+    { 10072, 3813, -1 }, { 10063, 3815, -1 }, { 10025, 3843, -1 }, { 10071, 2364, -1 },
+    { 10024, 2368, -1 }, { 10030, 2385, -1 }, { 10031, 2391, -1 }, { 10043, 2408, -1 },
+    { 10073, 2368, -1 }, { 10053, 3788, -1 }, { 10083, 3799, -1 }, { 10034, 3823, -1 },
+    { 10079, 3823, -1 }, { 10037, 3837, -1 }, { 10046, 3844, -1 }, { 10100, 3851, -1 },
+    { 10086, 3823, -1 }, { 10036, 3835, -1 }, { 10086, 3835, -1 }, { 10096, 3835, -1 },
+    { 10102, 3835, -1 }, { 10095, 3835, -1 }, { 10108, 3835, -1 }, { 10094, 3858, -1 },
+    { 10101, 3879, -1 }, { 10116, 787, -1 }, { 10114, 823, -1 }, { 10115, 3852, -1 },
+    { 10081, 3852, -1 }, { 10130, 3868, -1 }, { 10117, 3852, -1 }, { 10103, 3857, -1 },
+    { 10107, 3857, -1 }, { 10108, 3876, -1 }, { 10136, 3857, -1 }, { 10131, 3902, -1 },
+    { 10112, 654, -1 }, { 10113, 658, -1 }, { 10094, 3067, -1 }, { 10158, 3067, -1 },
+    { 10176, 3067, -1 }, { 10202, 3067, -1 }, { 10225, 3067, -1 }, { 10162, 3067, -1 },
+    { 10130, 3069, -1 }, { 10195, 3072, -1 }, { 10147, 3072, -1 }, { 10112, 3072, -1 },
+    { 10149, 3072, -1 }, { 10176, 3072, -1 }, { 10156, 3073, -1 }, { 10165, 3073, -1 },
+    { 10104, 3073, -1 }, { 10163, 3906, -1 }, { 10151, 3073, -1 }, { 10138, 3074, -1 },
+    { 10122, 3074, -1 }, { 10120, 3077, -1 }, { 10165, 3077, -1 }, { 10176, 3931, -1 },
+    { 10157, 3931, -1 }, { 10192, 3077, -1 }, { 10195, 3077, -1 }, { 10189, 3928, -1 },
+    { 10247, 3928, -1 }, { 10264, 3928, -1 }, { 10301, 3928, -1 }, { 10265, 3928, -1 },
+    { 10287, 3928, -1 }, { 10140, 3938, -1 }, { 10152, 3946, -1 }, { 10183, 3962, -1 },
+    { 10207, 3989, -1 }, { 10230, 3946, -1 }, { 10212, 3962, -1 }, { 10206, 3989, -1 },
+    { 10205, 3989, -1 }, { 10241, 3990, -1 }, { 10238, 4008, -1 }, { 10282, 4011, -1 },
+    { 10248, 4015, -1 }, { 10236, 4015, -1 }, { 10247, 4017, -1 }, { 10232, 4011, -1 },
+    { 10247, 4019, -1 }, { 10215, 4030, -1 }, { 10251, 4033, -1 }, { 10271, 4033, -1 },
+    { 10289, 4061, -1 }, { 10220, 4063, -1 }, { 10274, 4061, -1 }, { 10291, 4075, -1 },
+    { 10292, 4084, -1 }, { 10241, 4136, -1 }, { 10312, 4151, -1 }, { 10295, 4147, -1 },
+    { 10286, 4151, -1 }, { 10304, 4151, -1 }, { 10276, 4159, -1 }, { 10314, 4147, -1 },
+    { 10320, 4154, -1 }, { 10316, 4154, -1 }, { 10327, 4157, -1 }, { 10326, 4160, -1 },
+    { 10318, 4157, -1 }, { 10306, 4162, -1 }, { 10308, 4164, -1 }, { 10305, 4164, -1 },
+    { 10322, 4164, -1 }, { 10329, 4165, -1 }, { 10330, 4173, -1 }, { 10329, 4220, -1 },
+    { 10320, 4220, -1 }, { 10338, 4233, -1 }, { 10334, 4220, -1 }, { 10328, 4220, -1 },
+    { 10335, 4221, -1 }, { 10326, 4221, -1 }, { 10338, 4222, -1 }, { 10303, 4222, -1 },
+    { 10305, 3626, -1 }, { 10301, 3628, -1 }, { 10351, 4222, -1 }, { 10352, 3630, -1 },
+    { 10332, 3630, -1 }, { 10359, 3630, -1 }, { 10349, 3635, -1 }, { 10357, 3658, -1 },
+    { 10349, 3664, -1 }, { 10360, 3673, -1 }, { 10360, 1717, -1 }, { 10362, 1727, -1 },
+    { 10362, 1773, -1 }, { 10364, 3838, -1 }, { 10316, 3839, -1 }, { 10321, 3840, -1 },
+    { 10372, 3840, -1 }, { 10385, 3895, -1 }, { 10353, 3840, -1 }, { 10311, 3854, -1 },
+    { 10379, 3854, -1 }, { 10321, 3854, -1 }, { 10344, 3875, -1 }, { 10328, 3854, -1 },
+    { 10380, 3875, -1 }, { 10327, 3887, -1 }, { 10375, 3887, -1 }, { 10381, 3235, -1 },
+    { 10362, 3241, -1 }, { 10345, 3284, -1 }, { 10383, 3241, -1 }, { 10350, 3243, -1 },
+    { 10346, 3243, -1 }, { 10384, 3243, -1 }, { 10341, 3243, -1 }, { 10389, 3290, -1 },
+    { 10354, 1676, -1 }, { 10393, 1688, -1 }, { 10414, 3129, -1 }, { 10393, 1676, -1 },
+    { 10377, 1676, -1 }, { 10351, 1692, -1 }, { 10402, 1692, -1 }, { 10391, 1692, -1 },
+    { 10411, 1692, -1 }, { 10399, 1692, -1 }, { 10380, 1692, -1 }, { 10414, 3153, -1 },
+    { 10361, 3163, -1 }, { 10366, 3372, -1 }, { 10418, 3375, -1 }, { 10418, 3385, -1 },
+    { 10370, 4206, -1 }, { 10412, 4207, -1 }, { 10417, 4208, -1 }, { 10402, 4208, -1 },
+    { 10418, 4208, -1 }, { 10433, 4208, -1 }, { 10408, 4208, -1 }, { 10388, 4236, -1 },
+    { 10389, 4236, -1 }, { 10439, 4238, -1 }, { 10417, 4240, -1 }, { 10418, 4244, -1 },
+    { 10407, 4258, -1 }, { 10416, 4240, -1 }, { 10442, 4262, -1 }, { 10393, 4263, -1 },
+    { 10449, 4263, -1 }, { 10402, 4266, -1 }, { 10431, 4270, -1 }, { 10451, 3649, -1 },
+    { 10469, 4282, -1 }, { 10456, 3649, -1 }, { 10454, 3649, -1 }, { 10461, 3649, -1 },
+    { 10414, 3659, -1 }, { 10464, 4287, -1 }, { 10459, 3659, -1 }, { 10438, 3659, -1 },
+    { 10466, 3665, -1 }, { 10466, 3665, -1 }, { 10433, 3666, -1 }, { 10443, 3665, -1 },
+    { 10430, 4297, -1 }, { 10471, 3666, -1 }, { 10433, 4274, -1 }, { 10433, 4274, -1 },
+    { 10451, 4305, -1 }, { 10469, 4274, -1 }, { 10446, 4274, -1 }, { 10442, 4307, -1 },
+    { 10485, 4307, -1 }, { 10478, 4323, -1 }, { 10437, 4326, -1 }, { 10438, 4327, -1 },
+    { 10468, 4327, -1 }, { 10490, 4342, -1 }, { 10465, 4327, -1 }, { 10488, 4347, -1 },
+    { 10473, 4349, -1 }, { 10474, 4387, -1 }, { 10494, 4413, -1 }, { 10503, 4387, -1 },
+    { 10498, 4404, -1 }, { 10450, 4404, -1 }, { 10507, 4425, -1 }, { 10478, 4425, -1 },
+    { 10509, 4427, -1 }, { 10484, 4440, -1 }, { 10485, 1795, -1 }, { 10500, 1798, -1 },
+    { 10501, 1808, -1 }, { 10502, 1809, -1 }, { 10509, 2282, -1 }, { 10458, 2295, -1 },
+    { 10492, 2300, -1 }, { 10492, 4471, -1 }, { 10489, 2300, -1 }, { 10466, 829, -1 },
+    { 10495, 829, -1 }, { 10513, 4510, -1 }, { 10472, 4511, -1 }, { 10517, 4511, -1 },
+    { 10516, 4513, -1 }, { 10523, 4545, -1 }, { 10524, 4511, -1 }, { 10502, 4541, -1 },
+    { 10489, 4541, -1 }, { 10525, 4541, -1 }, { 10533, 4546, -1 }, { 10526, 4577, -1 },
+    { 10516, 4589, -1 }, { 10531, 1089, -1 }, { 10540, 1089, -1 }, { 10506, 2751, -1 },
+    { 10540, 2751, -1 }, { 10535, 2752, -1 }, { 10525, 2752, -1 }, { 10542, 2765, -1 },
+    { 10506, 2752, -1 }, { 10538, 2752, -1 }, { 10549, 2765, -1 }, { 10552, 4574, -1 },
+    { 10533, 4587, -1 }, { 10553, 1453, -1 }, { 10548, 4587, -1 }, { 10555, 4614, -1 },
+    { 10529, 4614, -1 }, { 10506, 1406, -1 }, { 10546, 537, -1 }, { 10551, 1406, -1 },
+    { 10554, 4615, -1 }, { 10547, 4615, -1 }, { 10530, 538, -1 }, { 10531, 1899, -1 },
+    { 10537, 4615, -1 }, { 10565, 1899, -1 }, { 10572, 1901, -1 }, { 10550, 1899, -1 },
+    { 10551, 1899, -1 }, { 10527, 1900, -1 }, { 10572, 1900, -1 }, { 10561, 1900, -1 },
+    { 10585, 1904, -1 }, { 10566, 1104, -1 }, { 10551, 1105, -1 }, { 10589, 1106, -1 },
+    { 10593, 1978, -1 }, { 10558, 1978, -1 }, { 10563, 1900, -1 }, { 10571, 1900, -1 },
+    { 10588, 1979, -1 }, { 10582, 1106, -1 }, { 10578, 1900, -1 }, { 10572, 1977, -1 },
+    { 10544, 1980, -1 }, { 10567, 1977, -1 }, { 10582, 2026, -1 }, { 10602, 2027, -1 },
+    { 10598, 2028, -1 }, { 10570, 1901, -1 }, { 10582, 2029, -1 }, { 10535, 1900, -1 },
+    { 10613, 1630, -1 }, { 10553, 1631, -1 }, { 10580, 1979, -1 }, { 10567, 2027, -1 },
+    { 10569, 1632, -1 }, { 10601, 1853, -1 }, { 10618, 1855, -1 }, { 10543, 1900, -1 },
+    { 10558, 1856, -1 }, { 10574, 1857, -1 }, { 10606, 2322, -1 }, { 10613, 2323, -1 },
+    { 10607, 2324, -1 }, { 10619, 2323, -1 }, { 10586, 2326, -1 }, { 10623, 2872, -1 },
+    { 10609, 2327, -1 }, { 10630, 2872, -1 }, { 10615, 2875, -1 }, { 10594, 2323, -1 },
+    { 10644, 756, -1 }, { 10600, 2872, -1 }, { 10617, 2323, -1 }, { 10629, 2327, -1 },
+    { 10597, 2027, -1 }, { 10609, 2324, -1 }, { 10668, 758, -1 }, { 10549, 1978, -1 },
+    { 10535, 1900, -1 }, { 10664, 543, -1 }, { 10640, 664, -1 }, { 10675, 2877, -1 },
+    { 10660, 2874, -1 }, { 10608, 2874, -1 }, { 10674, 503, -1 }, { 10600, 2873, -1 },
+    { 10629, 2327, -1 }, { 10637, 665, -1 }, { 10555, 1632, -1 }, { 10633, 2873, -1 },
+    { 10681, 554, -1 }, { 10651, 664, -1 }, { 10624, 2873, -1 }, { 10560, 1857, -1 },
+    { 10675, 2577, -1 }, { 10597, 2873, -1 }, { 10635, 2873, -1 }, { 10612, 2875, -1 },
+    { 10613, 2873, -1 }, { 10579, 2326, -1 }, { 10610, 2027, -1 }, { 10607, 2327, -1 },
+    { 10618, 2876, -1 }, { 10610, 2323, -1 }, { 10623, 2877, -1 }, { 10640, 716, -1 },
+    { 10672, 2877, -1 }, { 10689, 2579, -1 }, { 10602, 2873, -1 }, { 10659, 2578, -1 },
+    { 10620, 2874, -1 }, { 10662, 2874, -1 }, { 10678, 716, -1 }, { 10579, 2323, -1 },
+    { 10610, 2874, -1 }, { 10603, 2873, -1 }, { 10600, 2873, -1 }, { 10602, 2873, -1 },
+    { 10649, 2873, -1 }, { 10690, 2581, -1 }, { 10673, 2582, -1 }, { 10645, 503, -1 },
+    { 10606, 2873, -1 }, { 10660, 2876, -1 }, { 10641, 664, -1 }, { 10689, 559, -1 },
+    { 10676, 571, -1 }, { 10608, 2874, -1 }, { 10643, 2873, -1 }, { 10648, 2874, -1 },
+    { 10661, 2578, -1 }, { 10664, 2876, -1 }, { 10623, 2874, -1 }, { 10663, 1035, -1 },
+    { 10670, 1037, -1 }, { 10607, 2873, -1 }, { 10698, 1040, -1 }, { 10696, 2598, -1 },
+    { 10677, 2876, -1 }, { 10703, 2599, -1 }, { 10709, 2600, -1 }, { 10655, 2601, -1 },
+    { 10642, 2873, -1 }, { 10671, 2602, -1 }, { 10677, 3045, -1 }, { 10667, 2876, -1 },
+    { 10720, 3046, -1 }, { 10680, 1040, -1 }, { 10721, 3047, -1 }, { 10699, 3048, -1 },
+    { 10619, 2876, -1 }, { 10674, 3049, -1 }, { 10724, 3050, -1 }, { 10673, 583, -1 },
+    { 10687, 606, -1 }, { 10698, 3046, -1 }, { 10688, 616, -1 }, { 10674, 3046, -1 },
+    { 10730, 791, -1 }, { 10664, 2599, -1 }, { 10650, 2876, -1 }, { 10737, 793, -1 },
+    { 10733, 723, -1 }, { 10690, 724, -1 }, { 10710, 728, -1 }, { 10734, 657, -1 },
+    { 10737, 940, -1 }, { 10712, 941, -1 }, { 10721, 2122, -1 }, { 10746, 2123, -1 },
+    { 10724, 2124, -1 }, { 10718, 2127, -1 }, { 10733, 672, -1 }, { 10726, 676, -1 },
+    { 10712, 763, -1 }, { 10702, 778, -1 }, { 10679, 3050, -1 }, { 10720, 3047, -1 },
+    { 10732, 1841, -1 }, { 10714, 1842, -1 }, { 10743, 1843, -1 }, { 10660, 3046, -1 },
+    { 10703, 1845, -1 }, { 10730, 1841, -1 }, { 10748, 783, -1 }, { 10703, 3047, -1 },
+    { 10697, 798, -1 }, { 10699, 827, -1 }, { 10667, 3046, -1 }, { 10708, 838, -1 },
+    { 10746, 850, -1 }, { 10732, 854, -1 }, { 10755, 2203, -1 }, { 10740, 2204, -1 },
+    { 10760, 850, -1 }, { 10714, 2205, -1 }, { 10732, 2206, -1 }, { 10763, 1647, -1 },
+    { 10758, 1647, -1 }, { 10749, 1648, -1 }, { 10687, 3046, -1 }, { 10739, 1649, -1 },
+    { 10717, 858, -1 }, { 10758, 1302, -1 }, { 10735, 1303, -1 }, { 10751, 1302, -1 },
+    { 10724, 1305, -1 }, { 10905, 3181, -1 }, { 10875, 3182, -1 }, { 10877, 3185, -1 },
+    { 10912, 2411, -1 }, { 10762, 3225, -1 }, { 10741, 941, -1 }, { 10766, 3225, -1 },
+    { 10780, 3225, -1 }, { 10756, 3225, -1 }, { 10759, 3225, -1 }, { 10776, 3226, -1 },
+    { 10875, 3183, -1 }, { 10928, 2413, -1 }, { 10880, 3183, -1 }, { 10777, 3226, -1 },
+    { 10776, 3226, -1 }, { 10778, 3226, -1 }, { 10931, 2415, -1 }, { 10880, 2412, -1 },
+    { 10895, 908, -1 }, { 10773, 3226, -1 }, { 10770, 3226, -1 }, { 10761, 3226, -1 },
+    { 10934, 912, -1 }, { 10784, 3226, -1 }, { 10789, 3226, -1 }, { 10897, 2412, -1 },
+    { 10787, 3226, -1 }, { 10799, 3226, -1 }, { 10866, 3180, -1 }, { 10911, 3180, -1 },
+    { 10909, 3180, -1 }, { 10889, 2415, -1 }, { 10933, 872, -1 }, { 10906, 3180, -1 },
+    { 10910, 3181, -1 }, { 10740, 3226, -1 }, { 10791, 3226, -1 }, { 10789, 3226, -1 },
+    { 10944, 947, -1 }, { 10925, 948, -1 }, { 10800, 3226, -1 }, { 10934, 968, -1 },
+    { 10948, 969, -1 }, { 10936, 956, -1 }, { 10768, 3226, -1 }, { 10799, 3226, -1 },
+    { 10923, 961, -1 }, { 10792, 3226, -1 }, { 10785, 3226, -1 }, { 10938, 2261, -1 },
+    { 10954, 2262, -1 }, { 10907, 2263, -1 }, { 10927, 3183, -1 }, { 10801, 3226, -1 },
+    { 10758, 3226, -1 }, { 10794, 3226, -1 }, { 10805, 3226, -1 }, { 10774, 3226, -1 },
+    { 10917, 2264, -1 }, { 10934, 1079, -1 }, { 10889, 2412, -1 }, { 10918, 1080, -1 },
+    { 10953, 1012, -1 }, { 10924, 1017, -1 }, { 10819, 3226, -1 }, { 10766, 3226, -1 },
+    { 10772, 3226, -1 }, { 10793, 3226, -1 }, { 10816, 3226, -1 }, { 10815, 3226, -1 },
+    { 10833, 3226, -1 }, { 10813, 3226, -1 }, { 10808, 3227, -1 }, { 10905, 3339, -1 },
+    { 10958, 3339, -1 }, { 10967, 3342, -1 }, { 10902, 3339, -1 }, { 10826, 3227, -1 },
+    { 10918, 3343, -1 }, { 10973, 2166, -1 }, { 10822, 3227, -1 }, { 10960, 2171, -1 },
+    { 10950, 2168, -1 }, { 10966, 2167, -1 }, { 10794, 3227, -1 }, { 10974, 891, -1 },
+    { 10894, 948, -1 }, { 10976, 893, -1 }, { 10978, 999, -1 }, { 10962, 3341, -1 },
+    { 10959, 1003, -1 }, { 10967, 903, -1 }, { 10978, 1026, -1 }, { 10827, 3227, -1 },
+    { 10831, 3227, -1 }, { 10949, 2168, -1 }, { 10830, 3227, -1 }, { 10806, 3227, -1 },
+    { 10927, 2167, -1 }, { 10946, 1029, -1 }, { 10844, 3227, -1 }, { 10811, 3227, -1 },
+    { 10806, 3227, -1 }, { 10985, 920, -1 }, { 10833, 3227, -1 }, { 10845, 3228, -1 },
+    { 10950, 928, -1 }, { 10809, 3228, -1 }, { 10815, 3228, -1 }, { 10832, 3227, -1 },
+    { 10991, 906, -1 }, { 10967, 934, -1 }, { 10850, 3227, -1 }, { 10864, 3228, -1 },
+    { 10978, 977, -1 }, { 10973, 1196, -1 }, { 10818, 3227, -1 }, { 10819, 3227, -1 },
+    { 10947, 1197, -1 }, { 10826, 3228, -1 }, { 10799, 3227, -1 }, { 10850, 3227, -1 },
+    { 10959, 2677, -1 }, { 10826, 3227, -1 }, { 10850, 3227, -1 }, { 10821, 3227, -1 },
+    { 10837, 3227, -1 }, { 10938, 3341, -1 }, { 10977, 985, -1 }, { 10842, 3227, -1 },
+    { 10860, 3229, -1 }, { 10955, 906, -1 }, { 10833, 3227, -1 }, { 11005, 2680, -1 },
+    { 10864, 3227, -1 }, { 10833, 3227, -1 }, { 11007, 2680, -1 }, { 10874, 3228, -1 },
+    { 10879, 3228, -1 }, { 10984, 2676, -1 }, { 11009, 1010, -1 }, { 10848, 3229, -1 },
+    { 10869, 3228, -1 }, { 10851, 3229, -1 }, { 10974, 2675, -1 }, { 10955, 1044, -1 },
+    { 10989, 2675, -1 }, { 10989, 1730, -1 }, { 10982, 1734, -1 }, { 10977, 2676, -1 },
+    { 10844, 3229, -1 }, { 10850, 3228, -1 }, { 11002, 1731, -1 }, { 11002, 1731, -1 },
+    { 11007, 1116, -1 }, { 10984, 1112, -1 }, { 11007, 1051, -1 }, { 11000, 1053, -1 },
+    { 11007, 1112, -1 }, { 10975, 1070, -1 }, { 10967, 1077, -1 }, { 10869, 3228, -1 },
+    { 11007, 1085, -1 }, { 10858, 3229, -1 }, { 10887, 3230, -1 }, { 11019, 1099, -1 },
+    { 10847, 3230, -1 }, { 10832, 3229, -1 }, { 10966, 1107, -1 }, { 11013, 1118, -1 },
+    { 10897, 3230, -1 }, { 11025, 1125, -1 }, { 10981, 1128, -1 }, { 11023, 3392, -1 },
+    { 10871, 3229, -1 }, { 11098, 1138, -1 }, { 11091, 1140, -1 }, { 11120, 1201, -1 },
+    { 10859, 3229, -1 }, { 11119, 1202, -1 }, { 10869, 3229, -1 }, { 11123, 2843, -1 },
+    { 10893, 3229, -1 }, { 10870, 3229, -1 }, { 10893, 3229, -1 }, { 11086, 2842, -1 },
+    { 11125, 2846, -1 }, { 10887, 3230, -1 }, { 10920, 3340, -1 }, { 10891, 3229, -1 },
+    { 10886, 3230, -1 }, { 10905, 3230, -1 }, { 10891, 3230, -1 }, { 10877, 3229, -1 },
+    { 10903, 3230, -1 }, { 11091, 1171, -1 }, { 11090, 1180, -1 }, { 10875, 3230, -1 },
+    { 10902, 3230, -1 }, { 10968, 1112, -1 }, { 11139, 1182, -1 }, { 10952, 3340, -1 },
+    { 11031, 3393, -1 }, { 11003, 3393, -1 }, { 11024, 3393, -1 }, { 11092, 1186, -1 },
+    { 11010, 3393, -1 }, { 10870, 3230, -1 }, { 10917, 3230, -1 }, { 11014, 3393, -1 },
+    { 11118, 1355, -1 }, { 11124, 1357, -1 }, { 10910, 3340, -1 }, { 11117, 1154, -1 },
+    { 10869, 3230, -1 }, { 11088, 2841, -1 }, { 11096, 2841, -1 }, { 11077, 2841, -1 },
+    { 11130, 2841, -1 }, { 11093, 1224, -1 }, { 11105, 1234, -1 }, { 10926, 3340, -1 },
+    { 10899, 3230, -1 }, { 10963, 3340, -1 }, { 10954, 3340, -1 }, { 11123, 1154, -1 },
+    { 10939, 3340, -1 }, { 11121, 1240, -1 }, { 11118, 1230, -1 }, { 11113, 1245, -1 },
+    { 11131, 1255, -1 }, { 11025, 3394, -1 }, { 11150, 1608, -1 }, { 10970, 3340, -1 },
+    { 11032, 3394, -1 }, { 11103, 2842, -1 }, { 11034, 3394, -1 }, { 11105, 1610, -1 },
+    { 11112, 1611, -1 }, { 11042, 3394, -1 }, { 10996, 3394, -1 }, { 11020, 3394, -1 },
+    { 11041, 3394, -1 }, { 11069, 1154, -1 }, { 11049, 3394, -1 }, { 11111, 2316, -1 },
+    { 10918, 3340, -1 }, { 11100, 2317, -1 }, { 11000, 3394, -1 }, { 11128, 2318, -1 },
+    { 11039, 3394, -1 }, { 11112, 1256, -1 }, { 11108, 1260, -1 }, { 11029, 3394, -1 },
+    { 11038, 3395, -1 }, { 11147, 1267, -1 }, { 11012, 3395, -1 }, { 11128, 3644, -1 },
+    { 11027, 3394, -1 }, { 11007, 3394, -1 }, { 11125, 3645, -1 }, { 11170, 3648, -1 },
+    { 11119, 1278, -1 }, { 11163, 1288, -1 }, { 11126, 1154, -1 }, { 11016, 3394, -1 },
+    { 11010, 3394, -1 }, { 11037, 3394, -1 }, { 11122, 3647, -1 }, { 11036, 3394, -1 },
+    { 11036, 3394, -1 }, { 11062, 3394, -1 }, { 11097, 1230, -1 }, { 11083, 3396, -1 },
+    { 11160, 1596, -1 }, { 11021, 3395, -1 }, { 11048, 3394, -1 }, { 11172, 3647, -1 },
+    { 11056, 3395, -1 }, { 11049, 3395, -1 }, { 11066, 3395, -1 }, { 11154, 1597, -1 },
+    { 11132, 1599, -1 }, { 11029, 3395, -1 }, { 11130, 1296, -1 }, { 11079, 3396, -1 },
+    { 11177, 1300, -1 }, { 11072, 3395, -1 }, { 11157, 3646, -1 }, { 11059, 3394, -1 },
+    { 11062, 3396, -1 }, { 11028, 3394, -1 }, { 11151, 1312, -1 }, { 11128, 1306, -1 },
+    { 11117, 3647, -1 }, { 11131, 1319, -1 }, { 11130, 1364, -1 }, { 11160, 3645, -1 },
+    { 11016, 3395, -1 }, { 11043, 3395, -1 }, { 11078, 3395, -1 }, { 11066, 3395, -1 },
+    { 11065, 3395, -1 }, { 11159, 1367, -1 }, { 11050, 3395, -1 }, { 11055, 3395, -1 },
+    { 11085, 3397, -1 }, { 11111, 3646, -1 }, { 11175, 1324, -1 }, { 11177, 1346, -1 },
+    { 11049, 3395, -1 }, { 11184, 1352, -1 }, { 11081, 3396, -1 }, { 11058, 3397, -1 },
+    { 11135, 1374, -1 }, { 11058, 3398, -1 }, { 11155, 1377, -1 }, { 11096, 3398, -1 },
+    { 11146, 1380, -1 }, { 11098, 3397, -1 }, { 11049, 3396, -1 }, { 11140, 1386, -1 },
+    { 11158, 1399, -1 }, { 11171, 1415, -1 }, { 11134, 3646, -1 }, { 11165, 1439, -1 },
+    { 11191, 1443, -1 }, { 11147, 1421, -1 }, { 11146, 1712, -1 }, { 11054, 3396, -1 },
+    { 11039, 3396, -1 }, { 11056, 3396, -1 }, { 11066, 3396, -1 }, { 11064, 3398, -1 },
+    { 11167, 1713, -1 }, { 11082, 3397, -1 }, { 11207, 1444, -1 }, { 11059, 3398, -1 },
+    { 11108, 3398, -1 }, { 11086, 3397, -1 }, { 11207, 2009, -1 }, { 11066, 3398, -1 },
+    { 11159, 1715, -1 }, { 11211, 2010, -1 }, { 11089, 3398, -1 }, { 11106, 3398, -1 },
+    { 11047, 3397, -1 }, { 11182, 1306, -1 }, { 11185, 2012, -1 }, { 11172, 1713, -1 },
+    { 11044, 3397, -1 }, { 11203, 1715, -1 }, { 11072, 3397, -1 }, { 11173, 1713, -1 },
+    { 11208, 2013, -1 }, { 11157, 2013, -1 }, { 11188, 1712, -1 }, { 11165, 1455, -1 },
+    { 11191, 2647, -1 }, { 11175, 2648, -1 }, { 11205, 2649, -1 }, { 11168, 2009, -1 },
+    { 11101, 3397, -1 }, { 11187, 2651, -1 }, { 11215, 1588, -1 }, { 11217, 1589, -1 },
+    { 11197, 1588, -1 }, { 11200, 2758, -1 }, { 11176, 2759, -1 }, { 11169, 2759, -1 },
+    { 11146, 1713, -1 }, { 11215, 2760, -1 }, { 11175, 2762, -1 }, { 11219, 1459, -1 },
+    { 11213, 1491, -1 }, { 11174, 1493, -1 }, { 11182, 1462, -1 }, { 11186, 2759, -1 },
+    { 11211, 1472, -1 }, { 11234, 1484, -1 }, { 11184, 1488, -1 }, { 11189, 1500, -1 },
+    { 11186, 1782, -1 }, { 11220, 1783, -1 }, { 11219, 1504, -1 }, { 11222, 1506, -1 },
+    { 11215, 1514, -1 }, { 11241, 1929, -1 }, { 11232, 1930, -1 }, { 11195, 2648, -1 },
+    { 11203, 1932, -1 }, { 11244, 1520, -1 }, { 11227, 1541, -1 }, { 11238, 1782, -1 },
+    { 11209, 1818, -1 }, { 11218, 1819, -1 }, { 11247, 3738, -1 }, { 11241, 3739, -1 },
+    { 11278, 1543, -1 }, { 11246, 1548, -1 }, { 11269, 1555, -1 }, { 11279, 1830, -1 },
+    { 11249, 3739, -1 }, { 11229, 3739, -1 }, { 11204, 3739, -1 }, { 11216, 3739, -1 },
+    { 11266, 3740, -1 }, { 11238, 3739, -1 }, { 11174, 1589, -1 }, { 11288, 1831, -1 },
+    { 11246, 3740, -1 }, { 11255, 3739, -1 }, { 11232, 3739, -1 }, { 11242, 3740, -1 },
+    { 11304, 1557, -1 }, { 11292, 3742, -1 }, { 11314, 1560, -1 }, { 11306, 3762, -1 },
+    { 11287, 3762, -1 }, { 11281, 3743, -1 }, { 11303, 1563, -1 }, { 11279, 3740, -1 },
+    { 11298, 3762, -1 }, { 11231, 3741, -1 }, { 11213, 1818, -1 }, { 11281, 1584, -1 },
+    { 11242, 3739, -1 }, { 11223, 3739, -1 }, { 11200, 1819, -1 }, { 11268, 3739, -1 },
+    { 11239, 3742, -1 }, { 11244, 1929, -1 }, { 11287, 3743, -1 }, { 11230, 3739, -1 },
+    { 11332, 3245, -1 }, { 11297, 3758, -1 }, { 11344, 3246, -1 }, { 11244, 3743, -1 },
+    { 11257, 3742, -1 }, { 11281, 3758, -1 }, { 11290, 3742, -1 }, { 11297, 3758, -1 },
+    { 11280, 3758, -1 }, { 11247, 3740, -1 }, { 11303, 3246, -1 }, { 11241, 3740, -1 },
+    { 11229, 3741, -1 }, { 11286, 3743, -1 }, { 11287, 3741, -1 }, { 11299, 3248, -1 },
+    { 11319, 3250, -1 }, { 11237, 3741, -1 }, { 11242, 3739, -1 }, { 11334, 1885, -1 },
+    { 11248, 3759, -1 }, { 11284, 3740, -1 }, { 11261, 3759, -1 }, { 11271, 3761, -1 },
+    { 11307, 3759, -1 }, { 11279, 3741, -1 }, { 11270, 3739, -1 }, { 11290, 3741, -1 },
+    { 11339, 2885, -1 }, { 11351, 1619, -1 }, { 11366, 3824, -1 }, { 11338, 3827, -1 },
+    { 11390, 3828, -1 }, { 11292, 3760, -1 }, { 11359, 2881, -1 }, { 11278, 3760, -1 },
+    { 11357, 3829, -1 }, { 11374, 3826, -1 }, { 11377, 1623, -1 }, { 11365, 1626, -1 },
+    { 11330, 3246, -1 }, { 11261, 3759, -1 }, { 11323, 1884, -1 }, { 11229, 3741, -1 },
+    { 11277, 3760, -1 }, { 11272, 3760, -1 }, { 11296, 3760, -1 }, { 11325, 3761, -1 },
+    { 11278, 3761, -1 }, { 11350, 1884, -1 }, { 11346, 3247, -1 }, { 11320, 2881, -1 },
+    { 11311, 3759, -1 }, { 11370, 1663, -1 }, { 11285, 3761, -1 }, { 11378, 1635, -1 },
+    { 11326, 3247, -1 }, { 11404, 3859, -1 }, { 11347, 1884, -1 }, { 11399, 3859, -1 },
+    { 11341, 3247, -1 }, { 11422, 3862, -1 }, { 11293, 3759, -1 }, { 11345, 3247, -1 },
+    { 11404, 3864, -1 }, { 11292, 3247, -1 }, { 11379, 1940, -1 }, { 11312, 2882, -1 },
+    { 11354, 2882, -1 }, { 11350, 2881, -1 }, { 11327, 2883, -1 }, { 11343, 2883, -1 },
+    { 11350, 2883, -1 }, { 11269, 3759, -1 }, { 11283, 3759, -1 }, { 11357, 2882, -1 },
+    { 11307, 3759, -1 }, { 11420, 1941, -1 }, { 11400, 3862, -1 }, { 11270, 3761, -1 },
+    { 11283, 3761, -1 }, { 11312, 2881, -1 }, { 11361, 2883, -1 }, { 11376, 1944, -1 },
+    { 11321, 3825, -1 }, { 11334, 3826, -1 }, { 11354, 1659, -1 }, { 11323, 2883, -1 },
+    { 11347, 2881, -1 }, { 11346, 3825, -1 }, { 11347, 3825, -1 }, { 11389, 1659, -1 },
+    { 11383, 1993, -1 }, { 11355, 3825, -1 }, { 11422, 1994, -1 }, { 11369, 2882, -1 },
+    { 11328, 2882, -1 }, { 11362, 3861, -1 }, { 11351, 3860, -1 }, { 11363, 2882, -1 },
+    { 11349, 3860, -1 }, { 11360, 3860, -1 }, { 11429, 1997, -1 }, { 11369, 3860, -1 },
+    { 11367, 3863, -1 }, { 11418, 3863, -1 }, { 11330, 2882, -1 }, { 11351, 3860, -1 },
+    { 11383, 1725, -1 }, { 11383, 1728, -1 }, { 11389, 1665, -1 }, { 11405, 3120, -1 },
+    { 11362, 2882, -1 }, { 11446, 3122, -1 }, { 11372, 1659, -1 }, { 11379, 3861, -1 },
+    { 11395, 3123, -1 }, { 11444, 3330, -1 }, { 11398, 3121, -1 }, { 11378, 3861, -1 },
+    { 11421, 3121, -1 }, { 11433, 3331, -1 }, { 11454, 3333, -1 }, { 11384, 1659, -1 },
+    { 11422, 3334, -1 }, { 11415, 3335, -1 }, { 11453, 1687, -1 }, { 11401, 4213, -1 },
+    { 11435, 4217, -1 }, { 11414, 3863, -1 }, { 11406, 4213, -1 }, { 11460, 1702, -1 },
+    { 11433, 4213, -1 }, { 11444, 3335, -1 }, { 11367, 3861, -1 }, { 11393, 3331, -1 },
+    { 11456, 4215, -1 }, { 11475, 1955, -1 }, { 11395, 3860, -1 }, { 11479, 1698, -1 },
+    { 11460, 1958, -1 }, { 11435, 1959, -1 }, { 11478, 1750, -1 }, { 11462, 1754, -1 },
+    { 11493, 1736, -1 }, { 11444, 1738, -1 }, { 11468, 4216, -1 }, { 11452, 1741, -1 },
+    { 11443, 4217, -1 }, { 11379, 3863, -1 }, { 11475, 1761, -1 }, { 11447, 1768, -1 },
+    { 11491, 1776, -1 }, { 11454, 1778, -1 }, { 11437, 3120, -1 }, { 11389, 3860, -1 },
+    { 11384, 3120, -1 }, { 11425, 3121, -1 }, { 11436, 4214, -1 }, { 11421, 3863, -1 },
+    { 11452, 4218, -1 }, { 11485, 1768, -1 }, { 11464, 1698, -1 }, { 11416, 4214, -1 },
+    { 11461, 4216, -1 }, { 11497, 2723, -1 }, { 11463, 4214, -1 }, { 11496, 2724, -1 },
+    { 11448, 2725, -1 }, { 11466, 1780, -1 }, { 11459, 1789, -1 }, { 11418, 3123, -1 },
+    { 11444, 4214, -1 }, { 11472, 1880, -1 }, { 11408, 3334, -1 }, { 11466, 1882, -1 },
+    { 11466, 4214, -1 }, { 11467, 4216, -1 }, { 11454, 4218, -1 }, { 11452, 4215, -1 },
+    { 11481, 1794, -1 }, { 11468, 4215, -1 }, { 11417, 4216, -1 }, { 11430, 3331, -1 },
+    { 11406, 4214, -1 }, { 11490, 1806, -1 }, { 11489, 1811, -1 }, { 11516, 1823, -1 },
+    { 11458, 4216, -1 }, { 11445, 4218, -1 }, { 11476, 4218, -1 }, { 11486, 1835, -1 },
+    { 11513, 1908, -1 }, { 11462, 4214, -1 }, { 11468, 1910, -1 }, { 11425, 4216, -1 },
+    { 11474, 1848, -1 }, { 11472, 1894, -1 }, { 11522, 1898, -1 }, { 11519, 2039, -1 },
+    { 11513, 2040, -1 }, { 11473, 2042, -1 }, { 11470, 1859, -1 }, { 11520, 1894, -1 },
+    { 11500, 1871, -1 }, { 11519, 1874, -1 }, { 11507, 2725, -1 }, { 11462, 1768, -1 },
+    { 11483, 1905, -1 }, { 11487, 2050, -1 }, { 11501, 2051, -1 }, { 11511, 3115, -1 },
+    { 11479, 3116, -1 }, { 11525, 3117, -1 }, { 11515, 3171, -1 }, { 11529, 3173, -1 },
+    { 11499, 3172, -1 }, { 11505, 3176, -1 }, { 11521, 1915, -1 }, { 11447, 4214, -1 },
+    { 11496, 3116, -1 }, { 11496, 1919, -1 }, { 11506, 1925, -1 }, { 11512, 2076, -1 },
+    { 11533, 2077, -1 }, { 11537, 3158, -1 }, { 11502, 3159, -1 }, { 11480, 1871, -1 },
+    { 11512, 3172, -1 }, { 11495, 1915, -1 }, { 11534, 3160, -1 }, { 11548, 1950, -1 },
+    { 11511, 3207, -1 }, { 11526, 3208, -1 }, { 11503, 3209, -1 }, { 11543, 3210, -1 },
+    { 11554, 2031, -1 }, { 11555, 2034, -1 }, { 11546, 1961, -1 }, { 11560, 1972, -1 },
+    { 11558, 4225, -1 }, { 11566, 4226, -1 }, { 11538, 4226, -1 }, { 11572, 4226, -1 },
+    { 11625, 1982, -1 }, { 11544, 4226, -1 }, { 11557, 4226, -1 }, { 11508, 4226, -1 },
+    { 11570, 4226, -1 }, { 11649, 2137, -1 }, { 11522, 2039, -1 }, { 11552, 4227, -1 },
+    { 11514, 3208, -1 }, { 11629, 1984, -1 }, { 11672, 2090, -1 }, { 11573, 4227, -1 },
+    { 11507, 3208, -1 }, { 11656, 2091, -1 }, { 11579, 4227, -1 }, { 11621, 2133, -1 },
+    { 11551, 4227, -1 }, { 11634, 1988, -1 }, { 11564, 4227, -1 }, { 11594, 4227, -1 },
+    { 11578, 4227, -1 }, { 11571, 4227, -1 }, { 11576, 4227, -1 }, { 11642, 1990, -1 },
+    { 11625, 2133, -1 }, { 11533, 4227, -1 }, { 11625, 2134, -1 }, { 11677, 2134, -1 },
+    { 11676, 2007, -1 }, { 11553, 4227, -1 }, { 11639, 4229, -1 }, { 11678, 4396, -1 },
+    { 11651, 2137, -1 }, { 11571, 4227, -1 }, { 11575, 4227, -1 }, { 11657, 2134, -1 },
+    { 11608, 4229, -1 }, { 11674, 4393, -1 }, { 11551, 4228, -1 }, { 11685, 2045, -1 },
+    { 11677, 4393, -1 }, { 11589, 4229, -1 }, { 11595, 4227, -1 }, { 11538, 4227, -1 },
+    { 11688, 4399, -1 }, { 11652, 4229, -1 }, { 11696, 4402, -1 }, { 11707, 4403, -1 },
+    { 11689, 4402, -1 }, { 11712, 2256, -1 }, { 11637, 4230, -1 }, { 11568, 4228, -1 },
+    { 11611, 4228, -1 }, { 11731, 2094, -1 }, { 11588, 4227, -1 }, { 11601, 4227, -1 },
+    { 11602, 4229, -1 }, { 11608, 4230, -1 }, { 11671, 2136, -1 }, { 11570, 4228, -1 },
+    { 11580, 4228, -1 }, { 11645, 4230, -1 }, { 11598, 4227, -1 }, { 11555, 4227, -1 },
+    { 11597, 4227, -1 }, { 11647, 4231, -1 }, { 11620, 4228, -1 }, { 11628, 4230, -1 },
+    { 11586, 4227, -1 }, { 11594, 4228, -1 }, { 11709, 2254, -1 }, { 11653, 2136, -1 },
+    { 11717, 2098, -1 }, { 11692, 4396, -1 }, { 11591, 4229, -1 }, { 11724, 2053, -1 },
+    { 11597, 4229, -1 }, { 11639, 4229, -1 }, { 11643, 4229, -1 }, { 11727, 2059, -1 },
+    { 11728, 2114, -1 }, { 11740, 2254, -1 }, { 11605, 4228, -1 }, { 11671, 2136, -1 },
+    { 11740, 2118, -1 }, { 11619, 4228, -1 }, { 11655, 4396, -1 }, { 11599, 4230, -1 },
+    { 11671, 4396, -1 }, { 11622, 4228, -1 }, { 11716, 2065, -1 }, { 11613, 4231, -1 },
+    { 11685, 4401, -1 }, { 11716, 4398, -1 }, { 11697, 4401, -1 }, { 11697, 4402, -1 },
+    { 11644, 4231, -1 }, { 11611, 4228, -1 }, { 11663, 4231, -1 }, { 11691, 4401, -1 },
+    { 11594, 4228, -1 }, { 11625, 4231, -1 }, { 11646, 4231, -1 }, { 11659, 4230, -1 },
+    { 11659, 4230, -1 }, { 11628, 4231, -1 }, { 11688, 4395, -1 }, { 11649, 4231, -1 },
+    { 11630, 4394, -1 }, { 11658, 4394, -1 }, { 11701, 4397, -1 }, { 11730, 2421, -1 },
+    { 11662, 4398, -1 }, { 11658, 4230, -1 }, { 11656, 4394, -1 }, { 11683, 2253, -1 },
+    { 11727, 2423, -1 }, { 11659, 4397, -1 }, { 11638, 4394, -1 }, { 11681, 4394, -1 },
+    { 11735, 2424, -1 }, { 11735, 2253, -1 }, { 11715, 4401, -1 }, { 11724, 4400, -1 },
+    { 11707, 2101, -1 }, { 11655, 4395, -1 }, { 11662, 4398, -1 }, { 11669, 4395, -1 },
+    { 11708, 4398, -1 }, { 11707, 2100, -1 }, { 11800, 2074, -1 }, { 11637, 4394, -1 },
+    { 11669, 4394, -1 }, { 11678, 4400, -1 }, { 11790, 2080, -1 }, { 11668, 4400, -1 },
+    { 11694, 4397, -1 }, { 11750, 4405, -1 }, { 11710, 4405, -1 }, { 11798, 2149, -1 },
+    { 11815, 2150, -1 }, { 11802, 2153, -1 }, { 11645, 4395, -1 }, { 11769, 2335, -1 },
+    { 11763, 2338, -1 }, { 11681, 4395, -1 }, { 11785, 3318, -1 }, { 11809, 2339, -1 },
+    { 11798, 3323, -1 }, { 11768, 3320, -1 }, { 11773, 3320, -1 }, { 11797, 3322, -1 },
+    { 11643, 4394, -1 }, { 11779, 3320, -1 }, { 11717, 2253, -1 }, { 11669, 4397, -1 },
+    { 11799, 2087, -1 }, { 11719, 4400, -1 }, { 11791, 2339, -1 }, { 11745, 2100, -1 },
+    { 11678, 4394, -1 }, { 11753, 4406, -1 }, { 11770, 4407, -1 }, { 11666, 4397, -1 },
+    { 11695, 4400, -1 }, { 11800, 2107, -1 }, { 11670, 4400, -1 }, { 11700, 4394, -1 },
+    { 11721, 4406, -1 }, { 11709, 4406, -1 }, { 11825, 4605, -1 }, { 11777, 4606, -1 },
+    { 11771, 3322, -1 }, { 11759, 4406, -1 }, { 11833, 4608, -1 }, { 11759, 4409, -1 },
+    { 11742, 4409, -1 }, { 11771, 4409, -1 }, { 11795, 2115, -1 }, { 11716, 4407, -1 },
+    { 11838, 4607, -1 }, { 11806, 2142, -1 }, { 11723, 4407, -1 }, { 11805, 2145, -1 },
+    { 11816, 2119, -1 }, { 11840, 3286, -1 }, { 11755, 4406, -1 }, { 11811, 3288, -1 },
+    { 11770, 4409, -1 }, { 11782, 4604, -1 }, { 11806, 3291, -1 }, { 11774, 4409, -1 },
+    { 11710, 4406, -1 }, { 11829, 2227, -1 }, { 11709, 4406, -1 }, { 11753, 4406, -1 },
+    { 11801, 4604, -1 }, { 11835, 2131, -1 }, { 11796, 4607, -1 }, { 11758, 4407, -1 },
+    { 11726, 4407, -1 }, { 11767, 4409, -1 }, { 11731, 4408, -1 }, { 11800, 2229, -1 },
+    { 11843, 2227, -1 }, { 11759, 4406, -1 }, { 11800, 3287, -1 }, { 11819, 2501, -1 },
+    { 11818, 2231, -1 }, { 11859, 2502, -1 }, { 11782, 4407, -1 }, { 11721, 4406, -1 },
+    { 11734, 4406, -1 }, { 11723, 4406, -1 }, { 11770, 4406, -1 }, { 11765, 4406, -1 },
+    { 11761, 4406, -1 }, { 11751, 4408, -1 }, { 11845, 2229, -1 }, { 11816, 2231, -1 },
+    { 11807, 2504, -1 }, { 11787, 4408, -1 }, { 11835, 4622, -1 }, { 11743, 4408, -1 },
+    { 11823, 2115, -1 }, { 11837, 2231, -1 }, { 11801, 4623, -1 }, { 11865, 4624, -1 },
+    { 11811, 4604, -1 }, { 11791, 4409, -1 }, { 11788, 4408, -1 }, { 11819, 4625, -1 },
+    { 11811, 2192, -1 }, { 11856, 4626, -1 }, { 11840, 2193, -1 }, { 11759, 4409, -1 },
+    { 11732, 4408, -1 }, { 11729, 4408, -1 }, { 11795, 4410, -1 }, { 11847, 2709, -1 },
+    { 11877, 2712, -1 }, { 11741, 4410, -1 }, { 11871, 2714, -1 }, { 11875, 4633, -1 },
+    { 11786, 4604, -1 }, { 11800, 4410, -1 }, { 11844, 4626, -1 }, { 11785, 4410, -1 },
+    { 11779, 4410, -1 }, { 11775, 4410, -1 }, { 11743, 4408, -1 }, { 11774, 4408, -1 },
+    { 11867, 2710, -1 }, { 11777, 4408, -1 }, { 11832, 3287, -1 }, { 11840, 4627, -1 },
+    { 11842, 4627, -1 }, { 11762, 4410, -1 }, { 11818, 4628, -1 }, { 11868, 2710, -1 },
+    { 11905, 4630, -1 }, { 11895, 2140, -1 }, { 11897, 2140, -1 }, { 11752, 4410, -1 },
+    { 11793, 4410, -1 }, { 11877, 4635, -1 }, { 11904, 4631, -1 }, { 11827, 4628, -1 },
+    { 11861, 4630, -1 }, { 11861, 4628, -1 }, { 11884, 4631, -1 }, { 11863, 4631, -1 },
+    { 11912, 4631, -1 }, { 11945, 2477, -1 }, { 11883, 4628, -1 }, { 11928, 4638, -1 },
+    { 11876, 4628, -1 }, { 11905, 2478, -1 }, { 11933, 2158, -1 }, { 11894, 2162, -1 },
+    { 11832, 4625, -1 }, { 11885, 4632, -1 }, { 11828, 4628, -1 }, { 11893, 2177, -1 },
+    { 11904, 4636, -1 }, { 11887, 2187, -1 }, { 11871, 4632, -1 }, { 11892, 4634, -1 },
+    { 11845, 4629, -1 }, { 11851, 4630, -1 }, { 11835, 4628, -1 }, { 11856, 4628, -1 },
+    { 11859, 4629, -1 }, { 11902, 4634, -1 }, { 11840, 4629, -1 }, { 11894, 4629, -1 },
+    { 11909, 4634, -1 }, { 11910, 4632, -1 }, { 11934, 2233, -1 }, { 11860, 4628, -1 },
+    { 11856, 4628, -1 }, { 11880, 4629, -1 }, { 11821, 2710, -1 }, { 11848, 2710, -1 },
+    { 11920, 2236, -1 }, { 11892, 4629, -1 }, { 11877, 4629, -1 }, { 11880, 4636, -1 },
+    { 11940, 2208, -1 }, { 11896, 4634, -1 }, { 11853, 4628, -1 }, { 11895, 4638, -1 },
+    { 11895, 4629, -1 }, { 11900, 4631, -1 }, { 11900, 4631, -1 }, { 11843, 4628, -1 },
+    { 11865, 4629, -1 }, { 11914, 4637, -1 }, { 11857, 4631, -1 }, { 11925, 4634, -1 },
+    { 11883, 4632, -1 }, { 11882, 2475, -1 }, { 11905, 4639, -1 }, { 11920, 4637, -1 },
+    { 11945, 4639, -1 }, { 11951, 4640, -1 }, { 11961, 4644, -1 }, { 11920, 4634, -1 },
+    { 11844, 4629, -1 }, { 11873, 4636, -1 }, { 11944, 2215, -1 }, { 11887, 4629, -1 },
+    { 11923, 2475, -1 }, { 11923, 4637, -1 }, { 11953, 4643, -1 }, { 11914, 4642, -1 },
+    { 11944, 2475, -1 }, { 11919, 4643, -1 }, { 11879, 4634, -1 }, { 11892, 4634, -1 },
+    { 11902, 2233, -1 }, { 11967, 4642, -1 }, { 11921, 4641, -1 }, { 11930, 2243, -1 },
+    { 11906, 4640, -1 }, { 11910, 4641, -1 }, { 11979, 2238, -1 }, { 11947, 4642, -1 },
+    { 11922, 4641, -1 }, { 11969, 2242, -1 }, { 11970, 2277, -1 }, { 11962, 2242, -1 },
+    { 11982, 2278, -1 }, { 11943, 4640, -1 }, { 11963, 2283, -1 }, { 11951, 2288, -1 },
+    { 11958, 2292, -1 }, { 11960, 4642, -1 }, { 11968, 2294, -1 }, { 11927, 2313, -1 },
+    { 11953, 4645, -1 }, { 12005, 2428, -1 }, { 11963, 4647, -1 }, { 11955, 2429, -1 },
+    { 11939, 4645, -1 }, { 11935, 4645, -1 }, { 12000, 4648, -1 }, { 11939, 4646, -1 },
+    { 12010, 2331, -1 }, { 12003, 2362, -1 }, { 11923, 2243, -1 }, { 11940, 4645, -1 },
+    { 11990, 2345, -1 }, { 11981, 4649, -1 }, { 11906, 4641, -1 }, { 11962, 4645, -1 },
+    { 12002, 4647, -1 }, { 11943, 4643, -1 }, { 12010, 2349, -1 }, { 11982, 4648, -1 },
+    { 11978, 2360, -1 }, { 12008, 2356, -1 }, { 11926, 2277, -1 }, { 12014, 2375, -1 },
+    { 11975, 2378, -1 }, { 11970, 2381, -1 }, { 12002, 2384, -1 }, { 11953, 4649, -1 },
+    { 11994, 2389, -1 }, { 12023, 2392, -1 }, { 11944, 4641, -1 }, { 12000, 4648, -1 },
+    { 12011, 2395, -1 }, { 11973, 2242, -1 }, { 11969, 4649, -1 }, { 11980, 3866, -1 },
+    { 12026, 3866, -1 }, { 11974, 3867, -1 }, { 11993, 3869, -1 }, { 11948, 4647, -1 },
+    { 11971, 4647, -1 }, { 11935, 4641, -1 }, { 12017, 2360, -1 }, { 12031, 3870, -1 },
+    { 12011, 2407, -1 }, { 11956, 4645, -1 }, { 11945, 4646, -1 }, { 11962, 4646, -1 },
+    { 11996, 2417, -1 }, { 11972, 4645, -1 }, { 11937, 4646, -1 }, { 11945, 4646, -1 },
+    { 12008, 3871, -1 }, { 11968, 4646, -1 }, { 11991, 3871, -1 }, { 11980, 4646, -1 },
+    { 12043, 2419, -1 }, { 12030, 2433, -1 }, { 11989, 3871, -1 }, { 11973, 4646, -1 },
+    { 12002, 2440, -1 }, { 12032, 2442, -1 }, { 11999, 2447, -1 }, { 12029, 2450, -1 },
+    { 12042, 2454, -1 }, { 11993, 2459, -1 }, { 11982, 3871, -1 }, { 12042, 2460, -1 },
+    { 12003, 2482, -1 }, { 11980, 3867, -1 }, { 12050, 2505, -1 }, { 12045, 2508, -1 },
+    { 12036, 3881, -1 }, { 12010, 3871, -1 }, { 12039, 3871, -1 }, { 12004, 3882, -1 },
+    { 12057, 3882, -1 }, { 12051, 3883, -1 }, { 12053, 3885, -1 }, { 12033, 3886, -1 },
+    { 12059, 4650, -1 }, { 12068, 4651, -1 }, { 12065, 4651, -1 }, { 12022, 3882, -1 },
+    { 12032, 4652, -1 }, { 12011, 3869, -1 }, { 12052, 4653, -1 }, { 12080, 2485, -1 },
+    { 12027, 3869, -1 }, { 12063, 4650, -1 }, { 12041, 2520, -1 }, { 12053, 4650, -1 },
+    { 12086, 2523, -1 }, { 12084, 3344, -1 }, { 12058, 4650, -1 }, { 12071, 4654, -1 },
+    { 12027, 4654, -1 }, { 12052, 4653, -1 }, { 12079, 3346, -1 }, { 12080, 4652, -1 },
+    { 12094, 3348, -1 }, { 12062, 3345, -1 }, { 12084, 4654, -1 }, { 12064, 4650, -1 },
+    { 12103, 2496, -1 }, { 12046, 4654, -1 }, { 12040, 3345, -1 }, { 12094, 2536, -1 },
+    { 11997, 2447, -1 }, { 12099, 2536, -1 }, { 12101, 2537, -1 }, { 12096, 2507, -1 },
+    { 12076, 4651, -1 }, { 12057, 2507, -1 }, { 12078, 2616, -1 }, { 12022, 4651, -1 },
+    { 12111, 2617, -1 }, { 12101, 2620, -1 }, { 12060, 2551, -1 }, { 12042, 4654, -1 },
+    { 12103, 2555, -1 }, { 12102, 2511, -1 }, { 12106, 2516, -1 }, { 12101, 2548, -1 },
+    { 12108, 2549, -1 }, { 12108, 2518, -1 }, { 12043, 4654, -1 }, { 12121, 2583, -1 },
+    { 12024, 4652, -1 }, { 12061, 4652, -1 }, { 12081, 4654, -1 }, { 12033, 4653, -1 },
+    { 12088, 2549, -1 }, { 12063, 4652, -1 }, { 12063, 4650, -1 }, { 12094, 2587, -1 },
+    { 12040, 4650, -1 }, { 12114, 2530, -1 }, { 12075, 2540, -1 }, { 12040, 4653, -1 },
+    { 12101, 2604, -1 }, { 12100, 2608, -1 }, { 12128, 2576, -1 }, { 12099, 2592, -1 },
+    { 12132, 2593, -1 }, { 12044, 4653, -1 }, { 12095, 2616, -1 }, { 12120, 2583, -1 },
+    { 12117, 2623, -1 }, { 12132, 2626, -1 }, { 12133, 2610, -1 }, { 12124, 2654, -1 },
+    { 12107, 2657, -1 }, { 12129, 2694, -1 }, { 12105, 2697, -1 }, { 12090, 2611, -1 },
+    { 12113, 2604, -1 }, { 12131, 2619, -1 }, { 12111, 2705, -1 }, { 12133, 2706, -1 },
+    { 12140, 2644, -1 }, { 12134, 2653, -1 }, { 12149, 2674, -1 }, { 12103, 2682, -1 },
+    { 12128, 2692, -1 }, { 12140, 2703, -1 }, { 12122, 2721, -1 }, { 12146, 2730, -1 },
+    { 12099, 2738, -1 }, { 12122, 2741, -1 }, { 12145, 2732, -1 }, { 12146, 2739, -1 },
+    { 12158, 2749, -1 }, { 12120, 2750, -1 }, { 12129, 4655, -1 }, { 12121, 4655, -1 },
+    { 12133, 4655, -1 }, { 12204, 3187, -1 }, { 12151, 4655, -1 }, { 12216, 3188, -1 },
+    { 12132, 4655, -1 }, { 12173, 2753, -1 }, { 12118, 2549, -1 }, { 12163, 4656, -1 },
+    { 12142, 4656, -1 }, { 12107, 4656, -1 }, { 12163, 4656, -1 }, { 12212, 2780, -1 },
+    { 12222, 2780, -1 }, { 12137, 4657, -1 }, { 12153, 4659, -1 }, { 12123, 4656, -1 },
+    { 12206, 2780, -1 }, { 12155, 4656, -1 }, { 12165, 4656, -1 }, { 12150, 4656, -1 },
+    { 12143, 4657, -1 }, { 12186, 4657, -1 }, { 12204, 4660, -1 }, { 12152, 4657, -1 },
+    { 12134, 4657, -1 }, { 12183, 3188, -1 }, { 12226, 2784, -1 }, { 12191, 4657, -1 },
+    { 12188, 3189, -1 }, { 12180, 2785, -1 }, { 12225, 2788, -1 }, { 12227, 2754, -1 },
+    { 12214, 4661, -1 }, { 12258, 2793, -1 }, { 12097, 2644, -1 }, { 12145, 4658, -1 },
+    { 12161, 4657, -1 }, { 12174, 4656, -1 }, { 12163, 4656, -1 }, { 12175, 4657, -1 },
+    { 12165, 4660, -1 }, { 12158, 4656, -1 }, { 12153, 4658, -1 }, { 12140, 4658, -1 },
+    { 12137, 4657, -1 }, { 12196, 4657, -1 }, { 12211, 4660, -1 }, { 12157, 4656, -1 },
+    { 12148, 4656, -1 }, { 12125, 4656, -1 }, { 12260, 2815, -1 }, { 12159, 4659, -1 },
+    { 12202, 4659, -1 }, { 12168, 4660, -1 }, { 12188, 4658, -1 }, { 12219, 2764, -1 },
+    { 12182, 2781, -1 }, { 12170, 2753, -1 }, { 12181, 4659, -1 }, { 12132, 4656, -1 },
+    { 12245, 4664, -1 }, { 12170, 3189, -1 }, { 12169, 4656, -1 }, { 12201, 2781, -1 },
+    { 12205, 4664, -1 }, { 12192, 2781, -1 }, { 12220, 4665, -1 }, { 12205, 4659, -1 },
+    { 12163, 4659, -1 }, { 12234, 4662, -1 }, { 12199, 4662, -1 }, { 12241, 4665, -1 },
+    { 12236, 4662, -1 }, { 12139, 4658, -1 }, { 12188, 4663, -1 }, { 12222, 4663, -1 },
+    { 12238, 2816, -1 }, { 12226, 4666, -1 }, { 12255, 4665, -1 }, { 12222, 4666, -1 },
+    { 12253, 2799, -1 }, { 12212, 4664, -1 }, { 12260, 2803, -1 }, { 12264, 4668, -1 },
+    { 12254, 2816, -1 }, { 12232, 4662, -1 }, { 12248, 2792, -1 }, { 12257, 4669, -1 },
+    { 12212, 4667, -1 }, { 12233, 4663, -1 }, { 12216, 4667, -1 }, { 12226, 4665, -1 },
+    { 12198, 4663, -1 }, { 12205, 4663, -1 }, { 12234, 4671, -1 }, { 12254, 2792, -1 },
+    { 12263, 2767, -1 }, { 12247, 2792, -1 }, { 12227, 4670, -1 }, { 12225, 4670, -1 },
+    { 12270, 2823, -1 }, { 12231, 2827, -1 }, { 12266, 2776, -1 }, { 12266, 2796, -1 },
+    { 12244, 2808, -1 }, { 12260, 2826, -1 }, { 12287, 2831, -1 }, { 12289, 2833, -1 },
+    { 12259, 2831, -1 }, { 12214, 2792, -1 }, { 12294, 3381, -1 }, { 12253, 3380, -1 },
+    { 12194, 4662, -1 }, { 12290, 3380, -1 }, { 12251, 4668, -1 }, { 12263, 3384, -1 },
+    { 12241, 3382, -1 }, { 12243, 4668, -1 }, { 12295, 2835, -1 }, { 12291, 3636, -1 },
+    { 12209, 2799, -1 }, { 12294, 3380, -1 }, { 12290, 3638, -1 }, { 12252, 3639, -1 },
+    { 12222, 4668, -1 }, { 12303, 3637, -1 }, { 12287, 2847, -1 }, { 12279, 2850, -1 },
+    { 12303, 2838, -1 }, { 12271, 2845, -1 }, { 12295, 2852, -1 }, { 12291, 3889, -1 },
+    { 12320, 3892, -1 }, { 12272, 3894, -1 }, { 12328, 3893, -1 }, { 12262, 3637, -1 },
+    { 12300, 3381, -1 }, { 12254, 4671, -1 }, { 12213, 2792, -1 }, { 12314, 3891, -1 },
+    { 12285, 2853, -1 }, { 12275, 3891, -1 }, { 12329, 2855, -1 }, { 12255, 4671, -1 },
+    { 12330, 2858, -1 }, { 12280, 3891, -1 }, { 12276, 3893, -1 }, { 12283, 2868, -1 },
+    { 12283, 2869, -1 }, { 12284, 2879, -1 }, { 12322, 3891, -1 }, { 12316, 2886, -1 },
+    { 12337, 3061, -1 }, { 12322, 3893, -1 }, { 12257, 3637, -1 }, { 12329, 3894, -1 },
+    { 12268, 3381, -1 }, { 12331, 2887, -1 }, { 12326, 2887, -1 }, { 12333, 3064, -1 },
+    { 12322, 2889, -1 }, { 12335, 2910, -1 }, { 12259, 3381, -1 }, { 12298, 3382, -1 },
+    { 12312, 3891, -1 }, { 12262, 3637, -1 }, { 12325, 3891, -1 }, { 12323, 2917, -1 },
+    { 12341, 3251, -1 }, { 12318, 3252, -1 }, { 12337, 3253, -1 }, { 12312, 2918, -1 },
+    { 12347, 2942, -1 }, { 12341, 2958, -1 }, { 12306, 3892, -1 }, { 12350, 2944, -1 },
+    { 12303, 2944, -1 }, { 12277, 2868, -1 }, { 12353, 3076, -1 }, { 12350, 3080, -1 },
+    { 12313, 2966, -1 }, { 12360, 2971, -1 }, { 12309, 2979, -1 }, { 12354, 2996, -1 },
+    { 12311, 3002, -1 }, { 12351, 3144, -1 }, { 12306, 2942, -1 }, { 12317, 3145, -1 },
+    { 12363, 3144, -1 }, { 12345, 3144, -1 }, { 12362, 3149, -1 }, { 12372, 3016, -1 },
+    { 12322, 3144, -1 }, { 12351, 3669, -1 }, { 12316, 3670, -1 }, { 12316, 3671, -1 },
+    { 12355, 3041, -1 }, { 12328, 3043, -1 }, { 12374, 3096, -1 }, { 12376, 3097, -1 },
+    { 12358, 3068, -1 }, { 12377, 3104, -1 }, { 12362, 3105, -1 }, { 12354, 3151, -1 },
+    { 12337, 3152, -1 }, { 12381, 3071, -1 }, { 12372, 3079, -1 }, { 12384, 3166, -1 },
+    { 12367, 3167, -1 }, { 12352, 3169, -1 }, { 12362, 3087, -1 }, { 12338, 3091, -1 },
+    { 12361, 3094, -1 }, { 12382, 3281, -1 }, { 12363, 3285, -1 }, { 12377, 3099, -1 },
+    { 12351, 2942, -1 }, { 12367, 3107, -1 }, { 12386, 3132, -1 }, { 12395, 3745, -1 },
+    { 12377, 3745, -1 }, { 12371, 3746, -1 }, { 12356, 3076, -1 }, { 12355, 3748, -1 },
+    { 12375, 3310, -1 }, { 12401, 3314, -1 }, { 12365, 3148, -1 }, { 12399, 3386, -1 },
+    { 12408, 3389, -1 }, { 12362, 3746, -1 }, { 12400, 3390, -1 }, { 12400, 4140, -1 },
+    { 12373, 4141, -1 }, { 12388, 4143, -1 }, { 12414, 4143, -1 }, { 12386, 4144, -1 },
+    { 12421, 4145, -1 }, { 12399, 3820, -1 }, { 12417, 3818, -1 }, { 12402, 3822, -1 },
+    { 12369, 3145, -1 }, { 12389, 3819, -1 }, { 12384, 3819, -1 }, { 12399, 3818, -1 },
+    { 12394, 3746, -1 }, { 12423, 3155, -1 }, { 12419, 3822, -1 }, { 12392, 4145, -1 },
+    { 12380, 3818, -1 }, { 12403, 3164, -1 }, { 12421, 3771, -1 }, { 12437, 3772, -1 },
+    { 12427, 3775, -1 }, { 12416, 3178, -1 }, { 12379, 3199, -1 }, { 12428, 3216, -1 },
+    { 12431, 3219, -1 }, { 12396, 4143, -1 }, { 12415, 4143, -1 }, { 12393, 4672, -1 },
+    { 12441, 4674, -1 }, { 12404, 4672, -1 }, { 12446, 4673, -1 }, { 12399, 4673, -1 },
+    { 12405, 4675, -1 }, { 12441, 4676, -1 }, { 12392, 3202, -1 }, { 12442, 4672, -1 },
+    { 12405, 3231, -1 }, { 12406, 3313, -1 }, { 12439, 3317, -1 }, { 12429, 3233, -1 },
+    { 12415, 3238, -1 }, { 12410, 4141, -1 }, { 12398, 3239, -1 }, { 12413, 3262, -1 },
+    { 12407, 4144, -1 }, { 12408, 3274, -1 }, { 12434, 3604, -1 }, { 12409, 3605, -1 },
+    { 12419, 4673, -1 }, { 12367, 3818, -1 }, { 12414, 3276, -1 }, { 12417, 3282, -1 },
+    { 12413, 4141, -1 }, { 12462, 3303, -1 }, { 12438, 3319, -1 }, { 12452, 3328, -1 },
+    { 12461, 3337, -1 }, { 12442, 3787, -1 }, { 12463, 3791, -1 }, { 12462, 4414, -1 },
+    { 12473, 4415, -1 }, { 12423, 4418, -1 }, { 12460, 4419, -1 }, { 12478, 3356, -1 },
+    { 12386, 3818, -1 }, { 12435, 3366, -1 }, { 12467, 3374, -1 }, { 12471, 3399, -1 },
+    { 12469, 3412, -1 }, { 12433, 3417, -1 }, { 12454, 3427, -1 }, { 12480, 4677, -1 },
+    { 12484, 4677, -1 }, { 12489, 4677, -1 }, { 12494, 4677, -1 }, { 12680, 3733, -1 },
+    { 12678, 3734, -1 }, { 12481, 3374, -1 }, { 12433, 4678, -1 }, { 12653, 4683, -1 },
+    { 12450, 4678, -1 }, { 12497, 4678, -1 }, { 12486, 4678, -1 }, { 12464, 4678, -1 },
+    { 12473, 4678, -1 }, { 12684, 4684, -1 }, { 12636, 4687, -1 }, { 12464, 4678, -1 },
+    { 12425, 4419, -1 }, { 12459, 4678, -1 }, { 12498, 4678, -1 }, { 12491, 4678, -1 },
+    { 12499, 4678, -1 }, { 12496, 4678, -1 }, { 12469, 4678, -1 }, { 12482, 4678, -1 },
+    { 12419, 3303, -1 }, { 12680, 4688, -1 }, { 12493, 4678, -1 }, { 12681, 4694, -1 },
+    { 12510, 4678, -1 }, { 12495, 4678, -1 }, { 12520, 4678, -1 }, { 12516, 4678, -1 },
+    { 12693, 4689, -1 }, { 12673, 4693, -1 }, { 12655, 4689, -1 }, { 12666, 4692, -1 },
+    { 12708, 3755, -1 }, { 12724, 3808, -1 }, { 12475, 4678, -1 }, { 12478, 4678, -1 },
+    { 12524, 4678, -1 }, { 12525, 4678, -1 }, { 12510, 4678, -1 }, { 12486, 3412, -1 },
+    { 12679, 4694, -1 }, { 12713, 3811, -1 }, { 12687, 3812, -1 }, { 12520, 4678, -1 },
+    { 12525, 4678, -1 }, { 12718, 4695, -1 }, { 12532, 4678, -1 }, { 12526, 4678, -1 },
+    { 12689, 4698, -1 }, { 12721, 3878, -1 }, { 12735, 4699, -1 }, { 12669, 4691, -1 },
+    { 12517, 4679, -1 }, { 12491, 4678, -1 }, { 12741, 3439, -1 }, { 12494, 4678, -1 },
+    { 12738, 3439, -1 }, { 12738, 3874, -1 }, { 12533, 4678, -1 }, { 12530, 4678, -1 },
+    { 12528, 4678, -1 }, { 12544, 4679, -1 }, { 12534, 4679, -1 }, { 12668, 4691, -1 },
+    { 12680, 4697, -1 }, { 12741, 3448, -1 }, { 12550, 4679, -1 }, { 12658, 4691, -1 },
+    { 12678, 4698, -1 }, { 12693, 4692, -1 }, { 12559, 4679, -1 }, { 12524, 4679, -1 },
+    { 12518, 4679, -1 }, { 12699, 4691, -1 }, { 12542, 4679, -1 }, { 12520, 4679, -1 },
+    { 12744, 3474, -1 }, { 12692, 4697, -1 }, { 12548, 4679, -1 }, { 12670, 4693, -1 },
+    { 12729, 4700, -1 }, { 12555, 4679, -1 }, { 12545, 4679, -1 }, { 12522, 4679, -1 },
+    { 12542, 4679, -1 }, { 12707, 3752, -1 }, { 12571, 4679, -1 }, { 12707, 3505, -1 },
+    { 12648, 4692, -1 }, { 12695, 4699, -1 }, { 12671, 4693, -1 }, { 12695, 4692, -1 },
+    { 12744, 3526, -1 }, { 12707, 4691, -1 }, { 12728, 3555, -1 }, { 12756, 3610, -1 },
+    { 12747, 3618, -1 }, { 12518, 4679, -1 }, { 12710, 4700, -1 }, { 12756, 3632, -1 },
+    { 12719, 4067, -1 }, { 12546, 4679, -1 }, { 12549, 4679, -1 }, { 12761, 4068, -1 },
+    { 12560, 4679, -1 }, { 12584, 4679, -1 }, { 12545, 4679, -1 }, { 12753, 4064, -1 },
+    { 12555, 4679, -1 }, { 12526, 4679, -1 }, { 12760, 4064, -1 }, { 12544, 4680, -1 },
+    { 12584, 4679, -1 }, { 12548, 4680, -1 }, { 12749, 3874, -1 }, { 12719, 4700, -1 },
+    { 12550, 4680, -1 }, { 12558, 4680, -1 }, { 12549, 4680, -1 }, { 12589, 4680, -1 },
+    { 12756, 3634, -1 }, { 12753, 4701, -1 }, { 12721, 4702, -1 }, { 12710, 4703, -1 },
+    { 12758, 4705, -1 }, { 12698, 3752, -1 }, { 12594, 4680, -1 }, { 12714, 4706, -1 },
+    { 12752, 3650, -1 }, { 12770, 3655, -1 }, { 12578, 4680, -1 }, { 12563, 4680, -1 },
+    { 12571, 4680, -1 }, { 12769, 3754, -1 }, { 12573, 4680, -1 }, { 12577, 4680, -1 },
+    { 12609, 4680, -1 }, { 12667, 3752, -1 }, { 12554, 4680, -1 }, { 12616, 4680, -1 },
+    { 12575, 4680, -1 }, { 12769, 3753, -1 }, { 12763, 3753, -1 }, { 12740, 3782, -1 },
+    { 12775, 3657, -1 }, { 12732, 3781, -1 }, { 12558, 4680, -1 }, { 12769, 3896, -1 },
+    { 12754, 3898, -1 }, { 12736, 4067, -1 }, { 12557, 4680, -1 }, { 12740, 3899, -1 },
+    { 12766, 3802, -1 }, { 12764, 4064, -1 }, { 12604, 4680, -1 }, { 12613, 4680, -1 },
+    { 12745, 3781, -1 }, { 12561, 4680, -1 }, { 12756, 3667, -1 }, { 12738, 3803, -1 },
+    { 12615, 4680, -1 }, { 12618, 4680, -1 }, { 12579, 4680, -1 }, { 12611, 4681, -1 },
+    { 12796, 3797, -1 }, { 12627, 4681, -1 }, { 12787, 3795, -1 }, { 12631, 4681, -1 },
+    { 12578, 4680, -1 }, { 12626, 4680, -1 }, { 12572, 4680, -1 }, { 12743, 3814, -1 },
+    { 12597, 4680, -1 }, { 12590, 4681, -1 }, { 12620, 4681, -1 }, { 12602, 4681, -1 },
+    { 12634, 4681, -1 }, { 12798, 3816, -1 }, { 12616, 4681, -1 }, { 12609, 4681, -1 },
+    { 12739, 3795, -1 }, { 12778, 3679, -1 }, { 12733, 3667, -1 }, { 12763, 4197, -1 },
+    { 12658, 4690, -1 }, { 12605, 4681, -1 }, { 12796, 3685, -1 }, { 12648, 4690, -1 },
+    { 12628, 4681, -1 }, { 12670, 4690, -1 }, { 12639, 4681, -1 }, { 12784, 4198, -1 },
+    { 12797, 3692, -1 }, { 12776, 3698, -1 }, { 12681, 4690, -1 }, { 12691, 4690, -1 },
+    { 12650, 4681, -1 }, { 12751, 4200, -1 }, { 12649, 4681, -1 }, { 12800, 4053, -1 },
+    { 12777, 4054, -1 }, { 12803, 4057, -1 }, { 12740, 3667, -1 }, { 12846, 3830, -1 },
+    { 12599, 4682, -1 }, { 12643, 4682, -1 }, { 12701, 4696, -1 }, { 12625, 4682, -1 },
+    { 12614, 4681, -1 }, { 12625, 4682, -1 }, { 12655, 4682, -1 }, { 12656, 4682, -1 },
+    { 12792, 4199, -1 }, { 12862, 3718, -1 }, { 12743, 4198, -1 }, { 12624, 4681, -1 },
+    { 12599, 4681, -1 }, { 12706, 4696, -1 }, { 12608, 4681, -1 }, { 12802, 4199, -1 },
+    { 12776, 3795, -1 }, { 12656, 4681, -1 }, { 12774, 4200, -1 }, { 12810, 3831, -1 },
+    { 12676, 4690, -1 }, { 12819, 3724, -1 }, { 12633, 4681, -1 }, { 12686, 4696, -1 },
+    { 12605, 4682, -1 }, { 12751, 3679, -1 }, { 12666, 4682, -1 }, { 12618, 4682, -1 },
+    { 12661, 4682, -1 }, { 12641, 4682, -1 }, { 12671, 4690, -1 }, { 12689, 4696, -1 },
+    { 12846, 3735, -1 }, { 12860, 3744, -1 }, { 12643, 4682, -1 }, { 12789, 4710, -1 },
+    { 12683, 4690, -1 }, { 12634, 4682, -1 }, { 12674, 4682, -1 }, { 12758, 4707, -1 },
+    { 12781, 4707, -1 }, { 12717, 4696, -1 }, { 12700, 4696, -1 }, { 12826, 4038, -1 },
+    { 12785, 4707, -1 }, { 12804, 4710, -1 }, { 12866, 4039, -1 }, { 12862, 4040, -1 },
+    { 12794, 4708, -1 }, { 12623, 4682, -1 }, { 12656, 4682, -1 }, { 12794, 4709, -1 },
+    { 12843, 3764, -1 }, { 12814, 4708, -1 }, { 12851, 4713, -1 }, { 12849, 4712, -1 },
+    { 12773, 4708, -1 }, { 12743, 4199, -1 }, { 12751, 4199, -1 }, { 12791, 4708, -1 },
+    { 12824, 4709, -1 }, { 12791, 4708, -1 }, { 12811, 4709, -1 }, { 12813, 4708, -1 },
+    { 12812, 4708, -1 }, { 12831, 4710, -1 }, { 12812, 4708, -1 }, { 12824, 4711, -1 },
+    { 12814, 4715, -1 }, { 12816, 3831, -1 }, { 12826, 4710, -1 }, { 12785, 4709, -1 },
+    { 12832, 4709, -1 }, { 12834, 4709, -1 }, { 12819, 4716, -1 }, { 12846, 4717, -1 },
+    { 12793, 4708, -1 }, { 12868, 4718, -1 }, { 12882, 3770, -1 }, { 12833, 3919, -1 },
+    { 12876, 3923, -1 }, { 12855, 3770, -1 }, { 12854, 4712, -1 }, { 12786, 4708, -1 },
+    { 12828, 4710, -1 }, { 12883, 3784, -1 }, { 12889, 3805, -1 }, { 12880, 3833, -1 },
+    { 12842, 3833, -1 }, { 12805, 4708, -1 }, { 12847, 4712, -1 }, { 12818, 4718, -1 },
+    { 12856, 3855, -1 }, { 12885, 3856, -1 }, { 12802, 4708, -1 }, { 12891, 3836, -1 },
+    { 12883, 3841, -1 }, { 12850, 4712, -1 }, { 12899, 3877, -1 }, { 12852, 3880, -1 },
+    { 12840, 4709, -1 }, { 12902, 3980, -1 }, { 12854, 3981, -1 }, { 12893, 3897, -1 },
+    { 12867, 3856, -1 }, { 12905, 3911, -1 }, { 12777, 4708, -1 }, { 12884, 3914, -1 },
+    { 12813, 4708, -1 }, { 12897, 3921, -1 }, { 12812, 4708, -1 }, { 12878, 3952, -1 },
+    { 12804, 4711, -1 }, { 12816, 4711, -1 }, { 12848, 4711, -1 }, { 12819, 4711, -1 },
+    { 12895, 3968, -1 }, { 12879, 3770, -1 }, { 12808, 4711, -1 }, { 12884, 3770, -1 },
+    { 12875, 3987, -1 }, { 12857, 3991, -1 }, { 12900, 3976, -1 }, { 12890, 3985, -1 },
+    { 12912, 4388, -1 }, { 12893, 4389, -1 }, { 12865, 4390, -1 }, { 12816, 4711, -1 },
+    { 12824, 4711, -1 }, { 12799, 4711, -1 }, { 12871, 3999, -1 }, { 12918, 4020, -1 },
+    { 12888, 4091, -1 }, { 12889, 4093, -1 }, { 12912, 4028, -1 }, { 12923, 4322, -1 },
+    { 12923, 4324, -1 }, { 12895, 4325, -1 }, { 12910, 4269, -1 }, { 12845, 3833, -1 },
+    { 12927, 4271, -1 }, { 12906, 4049, -1 }, { 12880, 4076, -1 }, { 12879, 4086, -1 },
+    { 12902, 4293, -1 }, { 12902, 4294, -1 }, { 12923, 4096, -1 }, { 12912, 4099, -1 },
+    { 12928, 4102, -1 }, { 12926, 4125, -1 }, { 12906, 4129, -1 }, { 12923, 4109, -1 },
+    { 12890, 4308, -1 }, { 12931, 4310, -1 }, { 12932, 4114, -1 }, { 12883, 4120, -1 },
+    { 12923, 4134, -1 }, { 12906, 4125, -1 }, { 12944, 4138, -1 }, { 12907, 4248, -1 },
+    { 12937, 4252, -1 }, { 12903, 4146, -1 }, { 12940, 4177, -1 }, { 12911, 4303, -1 },
+    { 12930, 4304, -1 }, { 12938, 4189, -1 }, { 12901, 4194, -1 }, { 12940, 4296, -1 },
+    { 12918, 4299, -1 }, { 12947, 4219, -1 }, { 12943, 4437, -1 }, { 12929, 4438, -1 },
+    { 12938, 4439, -1 }, { 12932, 4232, -1 }, { 12931, 4304, -1 }, { 12930, 4719, -1 },
+    { 12942, 4720, -1 }, { 12928, 4722, -1 }, { 12957, 4723, -1 }, { 12959, 4360, -1 },
+    { 12900, 4125, -1 }, { 12938, 4361, -1 }, { 12946, 4360, -1 }, { 12965, 4724, -1 },
+    { 12931, 4725, -1 }, { 12966, 4726, -1 }, { 12865, 4091, -1 }, { 12945, 4727, -1 },
+    { 12989, 4729, -1 }, { 12959, 4728, -1 }, { 12963, 4482, -1 }, { 12948, 4483, -1 },
+    { 13001, 4732, -1 }, { 12974, 4484, -1 }, { 12917, 4725, -1 }, { 12905, 4720, -1 },
+    { 12964, 4484, -1 }, { 12974, 4734, -1 }, { 13024, 4740, -1 }, { 12937, 4730, -1 },
+    { 12939, 4731, -1 }, { 12949, 4728, -1 }, { 12939, 4719, -1 }, { 12949, 4725, -1 },
+    { 12940, 4725, -1 }, { 12963, 4730, -1 }, { 12991, 4245, -1 }, { 12948, 4733, -1 },
+    { 12957, 4730, -1 }, { 12926, 4726, -1 }, { 12946, 4736, -1 }, { 12977, 4731, -1 },
+    { 13014, 4737, -1 }, { 12943, 4725, -1 }, { 12957, 4733, -1 }, { 12958, 4735, -1 },
+    { 13001, 4735, -1 }, { 12984, 4735, -1 }, { 12998, 4255, -1 }, { 12988, 4736, -1 },
+    { 12930, 4728, -1 }, { 12975, 4736, -1 }, { 13000, 4736, -1 }, { 12953, 4736, -1 },
+    { 13001, 4736, -1 }, { 12982, 4737, -1 }, { 12959, 4738, -1 }, { 13017, 4738, -1 },
+    { 12999, 4259, -1 }, { 12999, 4275, -1 }, { 13024, 4739, -1 }, { 12922, 4360, -1 },
+    { 12980, 4728, -1 }, { 13009, 4288, -1 }, { 13022, 4367, -1 }, { 12986, 4313, -1 },
+    { 12950, 4360, -1 }, { 13012, 4739, -1 }, { 12934, 4728, -1 }, { 13013, 4368, -1 },
+    { 13040, 4315, -1 }, { 12986, 4472, -1 }, { 12977, 4736, -1 }, { 13020, 4473, -1 },
+    { 12997, 4475, -1 }, { 12998, 4320, -1 }, { 13013, 4498, -1 }, { 13035, 4500, -1 },
+    { 12983, 4739, -1 }, { 12948, 4730, -1 }, { 12990, 4738, -1 }, { 12981, 4736, -1 },
+    { 12997, 4739, -1 }, { 13022, 4739, -1 }, { 13001, 4501, -1 }, { 13048, 4742, -1 },
+    { 12999, 4741, -1 }, { 13037, 4743, -1 }, { 13037, 4744, -1 }, { 13031, 4333, -1 },
+    { 13047, 4350, -1 }, { 13040, 4412, -1 }, { 13048, 4411, -1 }, { 13036, 4356, -1 },
+    { 13011, 4736, -1 }, { 13018, 4741, -1 }, { 13043, 4741, -1 }, { 13036, 4372, -1 },
+    { 12999, 4368, -1 }, { 13020, 4420, -1 }, { 13027, 4457, -1 }, { 13010, 4459, -1 },
+    { 13056, 4424, -1 }, { 13043, 4430, -1 }, { 13055, 4557, -1 }, { 13071, 4559, -1 },
+    { 13077, 4560, -1 }, { 13047, 4561, -1 }, { 13054, 4434, -1 }, { 13021, 4444, -1 },
+    { 13009, 4742, -1 }, { 13005, 4743, -1 }, { 13052, 4742, -1 }, { 13014, 4411, -1 },
+    { 13070, 4609, -1 }, { 13076, 4610, -1 }, { 13047, 4611, -1 }, { 13037, 4741, -1 },
+    { 13050, 4613, -1 }, { 13033, 4462, -1 }, { 13069, 4526, -1 }, { 13028, 4530, -1 },
+    { 13005, 4743, -1 }, { 13045, 4467, -1 }, { 13037, 4485, -1 }, { 13037, 4741, -1 },
+    { 13066, 4491, -1 }, { 13041, 4492, -1 }, { 12996, 4741, -1 }, { 13037, 4499, -1 },
+    { 13076, 4506, -1 }, { 13044, 4507, -1 }, { 13049, 4514, -1 }, { 13044, 4745, -1 },
+    { 13075, 4746, -1 }, { 13069, 4747, -1 }, { 13101, 4748, -1 }, { 13036, 4745, -1 },
+    { 13096, 4517, -1 }, { 13094, 4572, -1 }, { 13100, 4573, -1 }, { 13055, 4575, -1 },
+    { 13102, 4749, -1 }, { 13054, 4749, -1 }, { 13090, 4748, -1 }, { 13076, 4752, -1 },
+    { 13094, 4524, -1 }, { 13084, 4753, -1 }, { 13079, 4537, -1 }, { 13096, 4538, -1 },
+    { 13114, 4552, -1 }, { 13088, 4554, -1 }, { 13072, 4618, -1 }, { 13104, 4620, -1 },
+    { 13113, 4563, -1 }, { 13048, 4749, -1 }, { 13112, 4570, -1 }, { 13040, 4746, -1 },
+    { 13082, 4753, -1 }, { 13099, 4588, -1 }, { 13099, 4591, -1 }, { 13084, 4750, -1 },
+    { 13101, 4754, -1 }, { 13119, 4755, -1 }, { 13077, 4757, -1 }, { 13093, 4758, -1 },
+    { 13081, 4619, -1 }, { 13125, 4685, -1 }, { 13093, 4686, -1 }, { 13110, 4704, -1 },
+    { 13111, 4618, -1 }, { 13085, 4714, -1 }, { 13118, 4721, -1 }, { 13107, 4751, -1 },
+    { 13072, 4747, -1 }, { 13086, 4756, -1 }, { 13149, 4759, -1 }, { 13145, 4760, -1 },
+    { 13075, 4570, -1 }, { 13137, 4761, -1 }, { 13138, 4762, -1 }, { 13106, 4763, -1 },
+    { 13140, 4764, -1 }, { 13128, 4760, -1 }, { 13106, 4749, -1 }, { 13151, 4768, -1 },
+    { 13143, 4765, -1 }, { 13128, 4766, -1 }, { 13140, 4767, -1 }, { 13071, 4749, -1 },
+    { 13118, 4769, -1 }, { 13060, 4749, -1 }, { 13142, 4770, -1 }, { 13096, 4620, -1 },
+    { 13141, 4771, -1 }, { 13117, 4772, -1 }, { 13121, 4773, -1 }, { 13151, 4761, -1 },
+    { 13115, 4774, -1 }, { 13115, 4620, -1 }, { 13139, 4775, -1 }, { 13164, 4776, -1 },
+    { 13139, 4778, -1 }, { 13147, 4777, -1 }, { 13167, 4779, -1 }, { 13126, 4780, -1 },
+    { 13145, 4783, -1 }, { 13167, 4781, -1 }, { 13119, 4782, -1 }, { 13176, 4784, -1 },
+    { 13149, 4786, -1 }, { 13100, 4768, -1 }, { 13128, 4785, -1 }, { 13160, 4787, -1 },
+    { 13150, 4788, -1 }, { 13157, 4789, -1 }, { 13128, 4786, -1 }, { 13169, 4790, -1 },
+    { 13137, 4791, -1 }, { 13141, 4794, -1 }, { 13139, 4792, -1 }, { 13184, 4793, -1 },
+    { 13136, 4795, -1 }, { 13191, 4796, -1 }, { 13161, 4797, -1 }, { 13132, 4798, -1 },
+    { 13162, 4800, -1 }, { 13186, 4799, -1 }, { 13136, 4801, -1 }, { 13152, 4802, -1 },
+    { 13162, 4803, -1 }, { 13171, 4800, -1 }, { 13198, 4806, -1 }, { 13152, 4804, -1 },
+    { 13179, 4805, -1 }, { 13172, 4809, -1 }, { 13154, 4807, -1 }, { 13146, 4808, -1 },
+    { 13194, 4810, -1 }, { 13186, 4811, -1 }, { 13168, 4813, -1 }, { 13194, 4812, -1 },
+    { 13181, 4815, -1 }, { 13196, 4814, -1 }, { 13168, 4816, -1 }, { 13215, 4817, -1 },
+    { 13188, 4818, -1 }, { 13208, 4819, -1 }, { 13202, 4820, -1 }, { 13213, 4819, -1 },
+    { 13265, 4825, -1 }, { 13270, 4826, -1 }, { 13276, 4828, -1 }, { 13270, 4829, -1 },
+    { 13282, 4827, -1 }, { 13229, 4830, -1 }, { 13217, 4820, -1 }, { 13261, 4831, -1 },
+    { 13197, 4820, -1 }, { 13298, 4833, -1 }, { 13282, 4832, -1 }, { 13260, 4834, -1 },
+    { 13245, 4835, -1 }, { 13194, 4820, -1 }, { 13217, 4820, -1 }, { 13250, 4832, -1 },
+    { 13283, 4838, -1 }, { 13223, 4820, -1 }, { 13293, 4837, -1 }, { 13243, 4822, -1 },
+    { 13254, 4822, -1 }, { 13224, 4822, -1 }, { 13176, 4820, -1 }, { 13300, 4839, -1 },
+    { 13272, 4836, -1 }, { 13282, 4840, -1 }, { 13182, 4820, -1 }, { 13307, 4841, -1 },
+    { 13264, 4844, -1 }, { 13224, 4821, -1 }, { 13222, 4821, -1 }, { 13242, 4821, -1 },
+    { 13298, 4846, -1 }, { 13188, 4820, -1 }, { 13180, 4820, -1 }, { 13195, 4822, -1 },
+    { 13210, 4814, -1 }, { 13311, 4847, -1 }, { 13198, 4822, -1 }, { 13262, 4822, -1 },
+    { 13308, 4842, -1 }, { 13262, 4848, -1 }, { 13272, 4850, -1 }, { 13238, 4821, -1 },
+    { 13290, 4851, -1 }, { 13221, 4820, -1 }, { 13185, 4821, -1 }, { 13192, 4821, -1 },
+    { 13285, 4827, -1 }, { 13262, 4822, -1 }, { 13209, 4821, -1 }, { 13272, 4843, -1 },
+    { 13308, 4852, -1 }, { 13195, 4820, -1 }, { 13253, 4836, -1 }, { 13223, 4820, -1 },
+    { 13287, 4853, -1 }, { 13289, 4842, -1 }, { 13232, 4820, -1 }, { 13196, 4820, -1 },
+    { 13292, 4849, -1 }, { 13236, 4820, -1 }, { 13280, 4850, -1 }, { 13271, 4831, -1 },
+    { 13228, 4824, -1 }, { 13272, 4849, -1 }, { 13211, 4821, -1 }, { 13198, 4821, -1 },
+    { 13238, 4824, -1 }, { 13231, 4821, -1 }, { 13252, 4823, -1 }, { 13278, 4854, -1 },
+    { 13231, 4821, -1 }, { 13237, 4823, -1 }, { 13240, 4823, -1 }, { 13331, 4855, -1 },
+    { 13267, 4824, -1 }, { 13287, 4857, -1 }, { 13219, 4823, -1 }, { 13220, 4823, -1 },
+    { 13280, 4845, -1 }, { 13307, 4845, -1 }, { 13218, 4823, -1 }, { 13264, 4823, -1 },
+    { 13333, 4858, -1 }, { 13309, 4856, -1 }, { 13325, 4859, -1 }, { 13327, 4860, -1 },
+    { 13333, 4861, -1 }, { 13292, 4864, -1 }, { 13222, 4824, -1 }, { 13315, 4856, -1 },
+    { 13311, 4857, -1 }, { 13306, 4863, -1 }, { 13334, 4862, -1 }, { 13298, 4865, -1 },
+    { 13278, 4853, -1 }, { 13251, 4824, -1 }, { 13273, 4824, -1 }, { 13321, 4866, -1 },
+    { 13289, 4867, -1 }, { 13263, 4823, -1 }, { 13315, 4868, -1 }, { 13342, 4869, -1 },
+    { 13314, 4870, -1 }, { 13289, 4871, -1 }, { 13324, 4873, -1 }, { 13322, 4874, -1 },
+    { 13337, 4872, -1 }, { 13342, 4875, -1 }, { 13303, 4876, -1 }, { 13331, 4877, -1 },
+    { 13298, 4845, -1 }, { 13346, 4878, -1 }, { 13333, 4879, -1 }, { 13321, 4880, -1 },
+    { 13314, 4881, -1 }, { 13246, 4823, -1 }, { 13317, 4882, -1 }, { 13361, 4883, -1 },
+    { 13321, 4884, -1 }, { 13347, 4885, -1 }, { 13303, 4874, -1 }, { 13221, 4823, -1 },
+    { 13242, 4823, -1 }, { 13336, 4872, -1 }, { 13288, 4863, -1 }, { 13360, 4888, -1 },
+    { 13328, 4856, -1 }, { 13301, 4862, -1 }, { 13312, 4845, -1 }, { 13357, 4887, -1 },
+    { 13346, 4886, -1 }, { 13359, 4889, -1 }, { 13353, 4890, -1 }, { 13302, 4871, -1 },
+    { 13356, 4886, -1 }, { 13347, 4892, -1 }, { 13368, 4893, -1 }, { 13381, 4895, -1 },
+    { 13364, 4894, -1 }, { 13326, 4898, -1 }, { 13343, 4873, -1 }, { 13358, 4900, -1 },
+    { 13338, 4891, -1 }, { 13385, 4897, -1 }, { 13389, 4899, -1 }, { 13359, 4893, -1 },
+    { 13382, 4903, -1 }, { 13340, 4885, -1 }, { 13382, 4901, -1 }, { 13388, 4901, -1 },
+    { 13390, 4902, -1 }, { 13370, 4901, -1 }, { 13356, 4896, -1 }, { 13390, 4904, -1 },
+    { 13379, 4892, -1 }, { 13335, 4894, -1 }, { 13405, 4906, -1 }, { 13375, 4905, -1 },
+    { 13380, 4902, -1 }, { 13353, 4907, -1 }, { 13380, 4911, -1 }, { 13323, 4876, -1 },
+    { 13351, 4894, -1 }, { 13403, 4908, -1 }, { 13362, 4909, -1 }, { 13377, 4894, -1 },
+    { 13354, 4907, -1 }, { 13366, 4910, -1 }, { 13409, 4908, -1 }, { 13413, 4912, -1 },
+    { 13379, 4913, -1 }, { 13399, 4914, -1 }, { 13410, 4915, -1 }, { 13363, 4916, -1 },
+    { 13415, 4917, -1 }, { 13376, 4918, -1 }, { 13382, 4919, -1 }, { 13379, 4903, -1 },
+    { 13408, 4921, -1 }, { 13367, 4902, -1 }, { 13353, 4903, -1 }, { 13403, 4920, -1 },
+    { 13344, 4893, -1 }, { 13383, 4923, -1 }, { 13381, 4922, -1 }, { 13415, 4924, -1 },
+    { 13399, 4925, -1 }, { 13413, 4926, -1 }, { 13428, 4924, -1 }, { 13399, 4923, -1 },
+    { 13421, 4917, -1 }, { 13406, 4927, -1 }, { 13442, 4928, -1 }, { 13418, 4932, -1 },
+    { 13437, 4929, -1 }, { 13424, 4930, -1 }, { 13420, 4931, -1 }, { 13406, 4933, -1 },
+    { 13441, 4934, -1 }, { 13414, 4924, -1 }, { 13447, 4938, -1 }, { 13459, 4935, -1 },
+    { 13404, 4917, -1 }, { 13384, 4922, -1 }, { 13450, 4936, -1 }, { 13398, 4902, -1 },
+    { 13433, 4924, -1 }, { 13413, 4921, -1 }, { 13445, 4937, -1 }, { 13457, 4939, -1 },
+    { 13412, 4915, -1 }, { 13454, 4934, -1 }, { 13392, 4920, -1 }, { 13401, 4920, -1 },
+    { 13406, 4918, -1 }, { 13414, 4940, -1 }, { 13391, 4917, -1 }, { 13452, 4941, -1 },
+    { 13461, 4942, -1 }, { 13417, 4943, -1 }, { 13434, 4947, -1 }, { 13431, 4945, -1 },
+    { 13401, 4924, -1 }, { 13469, 4946, -1 }, { 13414, 4948, -1 }, { 13472, 4949, -1 },
+    { 13473, 4954, -1 }, { 13467, 4949, -1 }, { 13405, 4922, -1 }, { 13489, 4953, -1 },
+    { 13379, 4920, -1 }, { 13445, 4924, -1 }, { 13471, 4950, -1 }, { 13501, 4955, -1 },
+    { 13474, 4951, -1 }, { 13469, 4956, -1 }, { 13472, 4951, -1 }, { 13435, 4950, -1 },
+    { 13452, 4952, -1 }, { 13428, 4928, -1 }, { 13488, 4957, -1 }, { 13475, 4951, -1 },
+    { 13441, 4950, -1 }, { 13473, 4961, -1 }, { 13495, 4958, -1 }, { 13475, 4952, -1 },
+    { 13474, 4952, -1 }, { 13489, 4944, -1 }, { 13451, 4951, -1 }, { 13468, 4950, -1 },
+    { 13459, 4959, -1 }, { 13506, 4960, -1 }, { 13485, 4953, -1 }, { 13461, 4962, -1 },
+    { 13481, 4963, -1 }, { 13447, 4950, -1 }, { 13425, 4951, -1 }, { 13471, 4964, -1 },
+    { 13468, 4951, -1 }, { 13456, 4944, -1 }, { 13497, 4965, -1 }, { 13452, 4966, -1 },
+    { 13506, 4967, -1 }, { 13440, 4954, -1 }, { 13469, 4968, -1 }, { 13468, 4969, -1 },
+    { 13519, 4970, -1 }, { 13503, 4971, -1 }, { 13516, 4972, -1 }, { 13518, 4973, -1 },
+    { 13464, 4974, -1 }, { 13475, 4975, -1 }, { 13511, 4976, -1 }, { 13418, 4950, -1 },
+    { 13528, 4977, -1 }, { 13469, 4951, -1 }, { 13524, 4978, -1 }, { 13481, 4979, -1 },
+    { 13442, 4953, -1 }, { 13531, 4980, -1 }, { 13444, 4951, -1 }, { 13511, 4981, -1 },
+    { 13473, 4982, -1 }, { 13512, 4983, -1 }, { 13529, 4984, -1 }, { 13531, 4985, -1 },
+    { 13451, 4953, -1 }, { 13480, 4950, -1 }, { 13536, 4986, -1 }, { 13517, 4987, -1 },
+    { 13438, 4950, -1 }, { 13485, 4973, -1 }, { 13538, 4989, -1 }, { 13530, 4990, -1 },
+    { 13502, 4968, -1 }, { 13537, 4988, -1 }, { 13538, 4991, -1 }, { 13513, 4992, -1 },
+    { 13497, 4993, -1 }, { 13498, 4994, -1 }, { 13548, 4995, -1 }, { 13540, 4996, -1 },
+    { 13502, 4998, -1 }, { 13496, 4997, -1 }, { 13540, 4992, -1 }, { 13541, 5000, -1 },
+    { 13504, 4999, -1 }, { 13505, 5001, -1 }, { 13533, 5002, -1 }, { 13498, 5003, -1 },
+    { 13504, 5004, -1 }, { 13543, 5005, -1 }, { 13508, 5006, -1 }, { 13538, 5007, -1 },
+    { 13543, 5008, -1 }, { 13515, 5009, -1 }, { 13517, 5010, -1 }, { 13509, 5011, -1 },
+    { 13554, 5012, -1 }, { 13559, 5014, -1 }, { 13518, 5010, -1 }, { 13536, 5013, -1 },
+    { 13546, 5013, -1 }, { 13559, 5015, -1 }, { 13500, 4972, -1 }, { 13542, 5016, -1 },
+    { 13573, 5017, -1 }, { 13575, 5018, -1 }, { 13530, 5019, -1 }, { 13527, 5020, -1 },
+    { 13533, 5021, -1 }, { 13580, 5023, -1 }, { 13534, 5024, -1 }, { 13580, 5025, -1 },
+    { 13581, 5022, -1 }, { 13533, 5026, -1 }, { 13554, 5027, -1 }, { 13560, 5011, -1 },
+    { 13586, 5025, -1 }, { 13574, 5028, -1 }, { 13566, 5029, -1 }, { 13552, 5030, -1 },
+    { 13568, 5032, -1 }, { 13572, 5031, -1 }, { 13584, 5033, -1 }, { 13548, 5009, -1 },
+    { 13568, 5037, -1 }, { 13549, 5036, -1 }, { 13574, 5038, -1 }, { 13563, 5009, -1 },
+    { 13507, 5011, -1 }, { 13602, 5039, -1 }, { 13542, 5011, -1 }, { 13563, 5034, -1 },
+    { 13590, 5040, -1 }, { 13582, 5041, -1 }, { 13583, 5035, -1 }, { 13595, 5042, -1 },
+    { 13583, 5043, -1 }, { 13557, 5047, -1 }, { 13555, 5044, -1 }, { 13588, 5045, -1 },
+    { 13604, 5046, -1 }, { 13582, 5048, -1 }, { 13583, 5049, -1 }, { 13539, 5029, -1 },
+    { 13598, 5050, -1 }, { 13539, 5028, -1 }, { 13602, 5051, -1 }, { 13614, 5054, -1 },
+    { 13576, 5052, -1 }, { 13572, 5053, -1 }, { 13614, 5055, -1 }, { 13604, 5056, -1 },
+    { 13600, 5057, -1 }, { 13608, 5057, -1 }, { 13625, 5058, -1 }, { 13626, 5059, -1 },
+    { 13622, 5060, -1 }, { 13597, 5061, -1 }, { 13619, 5064, -1 }, { 13626, 5062, -1 },
+    { 13597, 5063, -1 }, { 13626, 5065, -1 }, { 13600, 5066, -1 }, { 13593, 5061, -1 },
+    { 13616, 5067, -1 }, { 13607, 5056, -1 }, { 13584, 5024, -1 }, { 13625, 5068, -1 },
+    { 13637, 5069, -1 }, { 13607, 5070, -1 }, { 13633, 5071, -1 }, { 13629, 5072, -1 },
+    { 13636, 5073, -1 }, { 13586, 5066, -1 }, { 13573, 5063, -1 }, { 13595, 5056, -1 },
+    { 13638, 5067, -1 }, { 13614, 5074, -1 }, { 13619, 5067, -1 }, { 13602, 5077, -1 },
+    { 13616, 5078, -1 }, { 13639, 5075, -1 }, { 13643, 5079, -1 }, { 13603, 5080, -1 },
+    { 13659, 5081, -1 }, { 13605, 5080, -1 }, { 13659, 5083, -1 }, { 13662, 5082, -1 },
+    { 13602, 5080, -1 }, { 13662, 5085, -1 }, { 13658, 5080, -1 }, { 13652, 5076, -1 },
+    { 13654, 5086, -1 }, { 13660, 5087, -1 }, { 13644, 5088, -1 }, { 13623, 5090, -1 },
+    { 13670, 5084, -1 }, { 13621, 5089, -1 }, { 13661, 5093, -1 }, { 13651, 5091, -1 },
+    { 13641, 5094, -1 }, { 13668, 5092, -1 }, { 13630, 5095, -1 }, { 13628, 5096, -1 },
+    { 13647, 5097, -1 }, { 13624, 5098, -1 }, { 13627, 5099, -1 }, { 13610, 5083, -1 },
+    { 13610, 5062, -1 }, { 13648, 5103, -1 }, { 13666, 5100, -1 }, { 13635, 5101, -1 },
+    { 13675, 5104, -1 }, { 13698, 5109, -1 }, { 13669, 5104, -1 }, { 13604, 5079, -1 },
+    { 13675, 5105, -1 }, { 13676, 5106, -1 }, { 13635, 5088, -1 }, { 13668, 5108, -1 },
+    { 13661, 5107, -1 }, { 13624, 5079, -1 }, { 13678, 5107, -1 }, { 13697, 5102, -1 },
+    { 13700, 5110, -1 }, { 13684, 5106, -1 }, { 13682, 5111, -1 }, { 13656, 5112, -1 },
+    { 13681, 5113, -1 }, { 13649, 5114, -1 }, { 13652, 5115, -1 }, { 13664, 5116, -1 },
+    { 13659, 5117, -1 }, { 13665, 5118, -1 }, { 13698, 5119, -1 }, { 13656, 5121, -1 },
+    { 13687, 5120, -1 }, { 13716, 5122, -1 }, { 13721, 5124, -1 }, { 13718, 5123, -1 },
+    { 13690, 5127, -1 }, { 13724, 5125, -1 }, { 13650, 5102, -1 }, { 13617, 5087, -1 },
+    { 13683, 5126, -1 }, { 13674, 5128, -1 }, { 13639, 5105, -1 }, { 13710, 5129, -1 },
+    { 13687, 5130, -1 }, { 13696, 5132, -1 }, { 13674, 5133, -1 }, { 13679, 5134, -1 },
+    { 13699, 5135, -1 }, { 13671, 5136, -1 }, { 13660, 5108, -1 }, { 13701, 5138, -1 },
+    { 13663, 5105, -1 }, { 13690, 5123, -1 }, { 13725, 5139, -1 }, { 13686, 5140, -1 },
+    { 13675, 5141, -1 }, { 13648, 5108, -1 }, { 13680, 5108, -1 }, { 13730, 5143, -1 },
+    { 13748, 5144, -1 }, { 13734, 5142, -1 }, { 13745, 5147, -1 }, { 13704, 5145, -1 },
+    { 13697, 5148, -1 }, { 13720, 5146, -1 }, { 13656, 5116, -1 }, { 13751, 5149, -1 },
+    { 13703, 5142, -1 }, { 13720, 5152, -1 }, { 13691, 5116, -1 }, { 13737, 5146, -1 },
+    { 13674, 5116, -1 }, { 13706, 5116, -1 }, { 13694, 5142, -1 }, { 13701, 5142, -1 },
+    { 13717, 5131, -1 }, { 13729, 5151, -1 }, { 13724, 5142, -1 }, { 13747, 5137, -1 },
+    { 13725, 5150, -1 }, { 13665, 5116, -1 }, { 13705, 5150, -1 }, { 13723, 5154, -1 },
+    { 13771, 5155, -1 }, { 13714, 5153, -1 }, { 13701, 5146, -1 }, { 13752, 5156, -1 },
+    { 13714, 5121, -1 }, { 13685, 5143, -1 }, { 13736, 5144, -1 }, { 13748, 5150, -1 },
+    { 13777, 5157, -1 }, { 13689, 5144, -1 }, { 13695, 5145, -1 }, { 13743, 5153, -1 },
+    { 13731, 5158, -1 }, { 13729, 5142, -1 }, { 13713, 5145, -1 }, { 13758, 5151, -1 },
+    { 13711, 5143, -1 }, { 13745, 5159, -1 }, { 13757, 5160, -1 }, { 13780, 5161, -1 },
+    { 13735, 5162, -1 }, { 13760, 5164, -1 }, { 13736, 5163, -1 }, { 13770, 5158, -1 },
+    { 13754, 5165, -1 }, { 13728, 5166, -1 }, { 13762, 5159, -1 }, { 13740, 5167, -1 },
+    { 13780, 5168, -1 }, { 13777, 5169, -1 }, { 13740, 5171, -1 }, { 13757, 5170, -1 },
+    { 13743, 5172, -1 }, { 13698, 5146, -1 }, { 13745, 5173, -1 }, { 13742, 5174, -1 },
+    { 13772, 5177, -1 }, { 13695, 5146, -1 }, { 13800, 5177, -1 }, { 13805, 5177, -1 },
+    { 13727, 5156, -1 }, { 13768, 5175, -1 }, { 13782, 5175, -1 }, { 13793, 5175, -1 },
+    { 13775, 5175, -1 }, { 13749, 5175, -1 }, { 13830, 5181, -1 }, { 13770, 5175, -1 },
+    { 13751, 5176, -1 }, { 13750, 5176, -1 }, { 13807, 5183, -1 }, { 13802, 5176, -1 },
+    { 13760, 5177, -1 }, { 13766, 5176, -1 }, { 13787, 5177, -1 }, { 13810, 5180, -1 },
+    { 13808, 5178, -1 }, { 13801, 5176, -1 }, { 13782, 5178, -1 }, { 13796, 5182, -1 },
+    { 13770, 5179, -1 }, { 13821, 5179, -1 }, { 13812, 5177, -1 }, { 13845, 5184, -1 },
+    { 13822, 5185, -1 }, { 13796, 5179, -1 }, { 13809, 5182, -1 }, { 13814, 5186, -1 },
+    { 13848, 5187, -1 }, { 13819, 5188, -1 }, { 13763, 5176, -1 }, { 13778, 5178, -1 },
+    { 13800, 5189, -1 }, { 13793, 5190, -1 }, { 13852, 5191, -1 }, { 13813, 5180, -1 },
+    { 13822, 5192, -1 }, { 13805, 5194, -1 }, { 13803, 5177, -1 }, { 13799, 5195, -1 },
+    { 13770, 5177, -1 }, { 13805, 5196, -1 }, { 13766, 5178, -1 }, { 13844, 5197, -1 },
+    { 13815, 5178, -1 }, { 13818, 5179, -1 }, { 13804, 5193, -1 }, { 13826, 5193, -1 },
+    { 13793, 5176, -1 }, { 13776, 5176, -1 }, { 13848, 5198, -1 }, { 13824, 5179, -1 },
+    { 13762, 5176, -1 }, { 13853, 5199, -1 }, { 13854, 5200, -1 }, { 13834, 5193, -1 },
+    { 13842, 5201, -1 }, { 13822, 5180, -1 }, { 13785, 5179, -1 }, { 13782, 5179, -1 },
+    { 13838, 5180, -1 }, { 13820, 5202, -1 }, { 13836, 5205, -1 }, { 13837, 5203, -1 },
+    { 13824, 5204, -1 }, { 13832, 5179, -1 }, { 13807, 5176, -1 }, { 13818, 5206, -1 },
+    { 13793, 5179, -1 }, { 13813, 5207, -1 }, { 13812, 5208, -1 }, { 13830, 5208, -1 },
+    { 13829, 5209, -1 }, { 13852, 5210, -1 }, { 13831, 5211, -1 }, { 13847, 5212, -1 },
+    { 13848, 5213, -1 }, { 13836, 5214, -1 }, { 13830, 5215, -1 }, { 13838, 5216, -1 },
+    { 13837, 5217, -1 }, { 13877, 5218, -1 }, { 13877, 5222, -1 }, { 13837, 5223, -1 },
+    { 13849, 5225, -1 }, { 13838, 5223, -1 }, { 13878, 5224, -1 }, { 13869, 5224, -1 },
+    { 13854, 5226, -1 }, { 13886, 5227, -1 }, { 13851, 5219, -1 }, { 13852, 5220, -1 },
+    { 13856, 5223, -1 }, { 13859, 5222, -1 }, { 13812, 5198, -1 }, { 13858, 5228, -1 },
+    { 13891, 5229, -1 }, { 13860, 5221, -1 }, { 13911, 5230, -1 }, { 13895, 5231, -1 },
+    { 13870, 5227, -1 }, { 13881, 5232, -1 }, { 13881, 5235, -1 }, { 13891, 5233, -1 },
+    { 13862, 5218, -1 }, { 13867, 5234, -1 }, { 13918, 5236, -1 }, { 13872, 5237, -1 },
+    { 13886, 5238, -1 }, { 13884, 5239, -1 }, { 13874, 5240, -1 }, { 13916, 5239, -1 },
+    { 13891, 5241, -1 }, { 13878, 5242, -1 }, { 13880, 5243, -1 }, { 13911, 5244, -1 },
+    { 13897, 5245, -1 }, { 13891, 5239, -1 }, { 13874, 5246, -1 }, { 13905, 5247, -1 },
+    { 13884, 5248, -1 }, { 13900, 5249, -1 }, { 13871, 5223, -1 }, { 13934, 5250, -1 },
+    { 13873, 5251, -1 }, { 13894, 5252, -1 }, { 13928, 5255, -1 }, { 13859, 5226, -1 },
+    { 13888, 5253, -1 }, { 13939, 5254, -1 }, { 13901, 5231, -1 }, { 13881, 5257, -1 },
+    { 13898, 5258, -1 }, { 13887, 5223, -1 }, { 13935, 5259, -1 }, { 13858, 5223, -1 },
+    { 13942, 5256, -1 }, { 13913, 5260, -1 }, { 13863, 5223, -1 }, { 13856, 5219, -1 },
+    { 13924, 5261, -1 }, { 13917, 5262, -1 }, { 13917, 5263, -1 }, { 13919, 5266, -1 },
+    { 13939, 5264, -1 }, { 13904, 5265, -1 }, { 13946, 5267, -1 }, { 13939, 5268, -1 },
+    { 13951, 5269, -1 }, { 13933, 5270, -1 }, { 13912, 5270, -1 }, { 13946, 5271, -1 },
+    { 13906, 5272, -1 }, { 13911, 5273, -1 }, { 13952, 5274, -1 }, { 13959, 5275, -1 },
+    { 13966, 5276, -1 }, { 13950, 5277, -1 }, { 13936, 5278, -1 }, { 13939, 5279, -1 },
+    { 13970, 5280, -1 }, { 13910, 5281, -1 }, { 13964, 5282, -1 }, { 13920, 5283, -1 },
+    { 13961, 5284, -1 }, { 13968, 5285, -1 }, { 13925, 5286, -1 }, { 13944, 5289, -1 },
+    { 13952, 5288, -1 }, { 13941, 5290, -1 }, { 13975, 5292, -1 }, { 13937, 5287, -1 },
+    { 13968, 5291, -1 }, { 13963, 5288, -1 }, { 13982, 5293, -1 }, { 13932, 5296, -1 },
+    { 13976, 5297, -1 }, { 13949, 5294, -1 }, { 13976, 5295, -1 }, { 13941, 5298, -1 },
+    { 13987, 5299, -1 }, { 13892, 5260, -1 }, { 13932, 5300, -1 }, { 13956, 5301, -1 },
+    { 13966, 5302, -1 }, { 13992, 5303, -1 }, { 13941, 5258, -1 }, { 13959, 5306, -1 },
+    { 13956, 5277, -1 }, { 14000, 5304, -1 }, { 13945, 5305, -1 }, { 13985, 5307, -1 },
+    { 13941, 5308, -1 }, { 13957, 5271, -1 }, { 13950, 5309, -1 }, { 13946, 5311, -1 },
+    { 13958, 5310, -1 }, { 13953, 5288, -1 }, { 13982, 5312, -1 }, { 14008, 5313, -1 },
+    { 14002, 5314, -1 }, { 13986, 5315, -1 }, { 13960, 5299, -1 }, { 13958, 5317, -1 },
+    { 14006, 5316, -1 }, { 13958, 5318, -1 }, { 13998, 5318, -1 }, { 13960, 5319, -1 },
+    { 13975, 5321, -1 }, { 13998, 5320, -1 }, { 14014, 5322, -1 }, { 14019, 5320, -1 },
+    { 13991, 5323, -1 }, { 14013, 5324, -1 }, { 14003, 5325, -1 }, { 13987, 5326, -1 },
+    { 13972, 5328, -1 }, { 14026, 5330, -1 }, { 13976, 5298, -1 }, { 14003, 5320, -1 },
+    { 14016, 5327, -1 }, { 13985, 5329, -1 }, { 14006, 5327, -1 }, { 14007, 5334, -1 },
+    { 13988, 5329, -1 }, { 14034, 5331, -1 }, { 13976, 5334, -1 }, { 14036, 5332, -1 },
+    { 14044, 5333, -1 }, { 14029, 5332, -1 }, { 14029, 5335, -1 }, { 13993, 5336, -1 },
+    { 13986, 5337, -1 }, { 13994, 5331, -1 }, { 14017, 5324, -1 }, { 14037, 5340, -1 },
+    { 14007, 5338, -1 }, { 14027, 5339, -1 }, { 14042, 5341, -1 }, { 14028, 5342, -1 },
+    { 14029, 5343, -1 }, { 14019, 5344, -1 }, { 14037, 5345, -1 }, { 14003, 5346, -1 },
+    { 14046, 5347, -1 }, { 14052, 5348, -1 }, { 14031, 5349, -1 }, { 14050, 5353, -1 },
+    { 14033, 5350, -1 }, { 14014, 5351, -1 }, { 14015, 5354, -1 }, { 14029, 5355, -1 },
+    { 13994, 5317, -1 }, { 14016, 5328, -1 }, { 14056, 5356, -1 }, { 14018, 5356, -1 },
+    { 14029, 5348, -1 }, { 14047, 5357, -1 }, { 14060, 5358, -1 }, { 13981, 5329, -1 },
+    { 14066, 5359, -1 }, { 13971, 5320, -1 }, { 14073, 5361, -1 }, { 14034, 5362, -1 },
+    { 14044, 5363, -1 }, { 14034, 5364, -1 }, { 14023, 5365, -1 }, { 14054, 5366, -1 },
+    { 14029, 5366, -1 }, { 14026, 5368, -1 }, { 14054, 5368, -1 }, { 14040, 5332, -1 },
+    { 14035, 5369, -1 }, { 14071, 5370, -1 }, { 14046, 5371, -1 }, { 14022, 5372, -1 },
+    { 14075, 5372, -1 }, { 14038, 5375, -1 }, { 14076, 5376, -1 }, { 14034, 5373, -1 },
+    { 14091, 5374, -1 }, { 14086, 5352, -1 }, { 14082, 5360, -1 }, { 14094, 5367, -1 },
+    { 14071, 5377, -1 }, { 14071, 5378, -1 }, { 14093, 5379, -1 }, { 14066, 5380, -1 },
+    { 14068, 5381, -1 }, { 14069, 5382, -1 }, { 14101, 5383, -1 }, { 14054, 5385, -1 },
+    { 14074, 5386, -1 }, { 14066, 5384, -1 }, { 14044, 5385, -1 }, { 14082, 5380, -1 },
+    { 14053, 5387, -1 }, { 14089, 5388, -1 }, { 14054, 5389, -1 }, { 14064, 5390, -1 },
+    { 14061, 5391, -1 }, { 14080, 5392, -1 }, { 14090, 5393, -1 }, { 14083, 5394, -1 },
+    { 14061, 5395, -1 }, { 14062, 5396, -1 }, { 14015, 5356, -1 }, { 14057, 5398, -1 },
+    { 14087, 5397, -1 }, { 14116, 5399, -1 }, { 14090, 5400, -1 }, { 14109, 5401, -1 },
+    { 14105, 5402, -1 }, { 14093, 5405, -1 }, { 14068, 5403, -1 }, { 14104, 5406, -1 },
+    { 14122, 5404, -1 }, { 14117, 5407, -1 }, { 14078, 5408, -1 }, { 14082, 5410, -1 },
+    { 14075, 5409, -1 }, { 14114, 5411, -1 }, { 14121, 5412, -1 }, { 14110, 5414, -1 },
+    { 14118, 5413, -1 }, { 14130, 5415, -1 }, { 14104, 5416, -1 }, { 14091, 5419, -1 },
+    { 14136, 5417, -1 }, { 14083, 5418, -1 }, { 14091, 5420, -1 }, { 14144, 5421, -1 },
+    { 14066, 5372, -1 }, { 14108, 5422, -1 }, { 14118, 5423, -1 }, { 14146, 5424, -1 },
+    { 14150, 5425, -1 }, { 14135, 5415, -1 }, { 14098, 5427, -1 }, { 14122, 5415, -1 },
+    { 14153, 5428, -1 }, { 14125, 5426, -1 }, { 14094, 5429, -1 }, { 14125, 5430, -1 },
+    { 14144, 5431, -1 }, { 14084, 5414, -1 }, { 14104, 5432, -1 }, { 14133, 5413, -1 },
+    { 14159, 5433, -1 }, { 14140, 5434, -1 }, { 14147, 5435, -1 }, { 14146, 5436, -1 },
+    { 14103, 5439, -1 }, { 14120, 5438, -1 }, { 14146, 5440, -1 }, { 14139, 5443, -1 },
+    { 14140, 5437, -1 }, { 14135, 5442, -1 }, { 14141, 5438, -1 }, { 14086, 5416, -1 },
+    { 14099, 5415, -1 }, { 14152, 5425, -1 }, { 14144, 5442, -1 }, { 14122, 5441, -1 },
+    { 14125, 5444, -1 }, { 14161, 5445, -1 }, { 14164, 5446, -1 }, { 14163, 5447, -1 },
+    { 14175, 5450, -1 }, { 14179, 5448, -1 }, { 14130, 5449, -1 }, { 14158, 5451, -1 },
+    { 14176, 5452, -1 }, { 14179, 5453, -1 }, { 14152, 5454, -1 }, { 14131, 5454, -1 },
+    { 14163, 5455, -1 }, { 14125, 5456, -1 }, { 14138, 5457, -1 }, { 14177, 5458, -1 },
+    { 14187, 5459, -1 }, { 14178, 5460, -1 }, { 14162, 5461, -1 }, { 14154, 5462, -1 },
+    { 14169, 5460, -1 }, { 14161, 5463, -1 }, { 14162, 5464, -1 }, { 14190, 5465, -1 },
+    { 14179, 5460, -1 }, { 14172, 5466, -1 }, { 14207, 5468, -1 }, { 14145, 5467, -1 },
+    { 14185, 5469, -1 }, { 14155, 5470, -1 }, { 14158, 5471, -1 }, { 14194, 5472, -1 },
+    { 14206, 5473, -1 }, { 14165, 5474, -1 }, { 14199, 5475, -1 }, { 14184, 5476, -1 },
+    { 14163, 5477, -1 }, { 14168, 5478, -1 }, { 14158, 5479, -1 }, { 14207, 5473, -1 },
+    { 14197, 5473, -1 }, { 14150, 5444, -1 }, { 14167, 5480, -1 }, { 14161, 5481, -1 },
+    { 14150, 5464, -1 }, { 14141, 5464, -1 }, { 14173, 5467, -1 }, { 14217, 5482, -1 },
+    { 14170, 5482, -1 }, { 14164, 5483, -1 }, { 14167, 5484, -1 }, { 14176, 5485, -1 },
+    { 14218, 5486, -1 }, { 14181, 5487, -1 }, { 14211, 5489, -1 }, { 14222, 5488, -1 },
+    { 14136, 5463, -1 }, { 14219, 5488, -1 }, { 14237, 5490, -1 }, { 14227, 5490, -1 },
+    { 14240, 5491, -1 }, { 14213, 5492, -1 }, { 14230, 5494, -1 }, { 14164, 5460, -1 },
+    { 14233, 5493, -1 }, { 14196, 5495, -1 }, { 14216, 5498, -1 }, { 14217, 5496, -1 },
+    { 14197, 5499, -1 }, { 14201, 5500, -1 }, { 14183, 5460, -1 }, { 14227, 5497, -1 },
+    { 14230, 5501, -1 }, { 14209, 5489, -1 }, { 14220, 5503, -1 }, { 14226, 5504, -1 },
+    { 14248, 5502, -1 }, { 14251, 5501, -1 }, { 14254, 5505, -1 }, { 14191, 5490, -1 },
+    { 14210, 5506, -1 }, { 14252, 5507, -1 }, { 14235, 5511, -1 }, { 14202, 5491, -1 },
+    { 14242, 5508, -1 }, { 14238, 5509, -1 }, { 14268, 5513, -1 }, { 14253, 5512, -1 },
+    { 14220, 5514, -1 }, { 14222, 5515, -1 }, { 14223, 5491, -1 }, { 14242, 5516, -1 },
+    { 14232, 5493, -1 }, { 14232, 5517, -1 }, { 14265, 5518, -1 }, { 14245, 5510, -1 },
+    { 14272, 5519, -1 }, { 14175, 5482, -1 }, { 14227, 5520, -1 }, { 14280, 5521, -1 },
+    { 14232, 5522, -1 }, { 14269, 5523, -1 }, { 14272, 5524, -1 }, { 14272, 5525, -1 },
+    { 14285, 5526, -1 }, { 14228, 5528, -1 }, { 14198, 5485, -1 }, { 14237, 5529, -1 },
+    { 14281, 5527, -1 }, { 14233, 5489, -1 }, { 14277, 5530, -1 }, { 14267, 5531, -1 },
+    { 14268, 5531, -1 }, { 14277, 5532, -1 }, { 14259, 5503, -1 }, { 14282, 5533, -1 },
+    { 14296, 5534, -1 }, { 14244, 5535, -1 }, { 14253, 5536, -1 }, { 14250, 5537, -1 },
+    { 14286, 5538, -1 }, { 14249, 5539, -1 }, { 14259, 5541, -1 }, { 14303, 5540, -1 },
+    { 14310, 5542, -1 }, { 14193, 5500, -1 }, { 14289, 5543, -1 }, { 14256, 5544, -1 },
+    { 14301, 5545, -1 }, { 14301, 5546, -1 }, { 14302, 5542, -1 }, { 14303, 5547, -1 },
+    { 14267, 5538, -1 }, { 14303, 5540, -1 }, { 14322, 5548, -1 }, { 14268, 5549, -1 },
+    { 14311, 5550, -1 }, { 14309, 5551, -1 }, { 14310, 5552, -1 }, { 14274, 5553, -1 },
+    { 14280, 5546, -1 }, { 14279, 5554, -1 }, { 14277, 5555, -1 }, { 14326, 5559, -1 },
+    { 14320, 5546, -1 }, { 14274, 5541, -1 }, { 14283, 5556, -1 }, { 14282, 5557, -1 },
+    { 14325, 5561, -1 }, { 14315, 5555, -1 }, { 14315, 5558, -1 }, { 14316, 5560, -1 },
+    { 14317, 5562, -1 }, { 14285, 5563, -1 }, { 14303, 5559, -1 }, { 14330, 5566, -1 },
+    { 14343, 5564, -1 }, { 14284, 5548, -1 }, { 14285, 5565, -1 }, { 14254, 5532, -1 },
+    { 14258, 5539, -1 }, { 14328, 5567, -1 }, { 14293, 5568, -1 }, { 14325, 5569, -1 },
+    { 14329, 5567, -1 }, { 14255, 5541, -1 }, { 14334, 5570, -1 }, { 14316, 5568, -1 },
+    { 14321, 5571, -1 }, { 14332, 5568, -1 }, { 14297, 5572, -1 }, { 14292, 5573, -1 },
+    { 14350, 5574, -1 }, { 14329, 5575, -1 }, { 14297, 5576, -1 }, { 14306, 5577, -1 },
+    { 14337, 5578, -1 }, { 14362, 5579, -1 }, { 14353, 5580, -1 }, { 14280, 5538, -1 },
+    { 14342, 5581, -1 }, { 14331, 5582, -1 }, { 14312, 5586, -1 }, { 14343, 5583, -1 },
+    { 14310, 5584, -1 }, { 14363, 5585, -1 }, { 14342, 5587, -1 }, { 14322, 5588, -1 },
+    { 14311, 5589, -1 }, { 14318, 5590, -1 }, { 14364, 5591, -1 }, { 14308, 5575, -1 },
+    { 14355, 5575, -1 }, { 14376, 5592, -1 }, { 14355, 5593, -1 }, { 14362, 5594, -1 },
+    { 14343, 5573, -1 }, { 14329, 5554, -1 }, { 14363, 5595, -1 }, { 14335, 5596, -1 },
+    { 14363, 5597, -1 }, { 14367, 5596, -1 }, { 14337, 5598, -1 }, { 14324, 5589, -1 },
+    { 14373, 5599, -1 }, { 14338, 5600, -1 }, { 14370, 5601, -1 }, { 14327, 5602, -1 },
+    { 14343, 5603, -1 }, { 14373, 5604, -1 }, { 14379, 5605, -1 }, { 14384, 5609, -1 },
+    { 14341, 5606, -1 }, { 14344, 5607, -1 }, { 14390, 5608, -1 }, { 14353, 5610, -1 },
+    { 14403, 5611, -1 }, { 14362, 5613, -1 }, { 14360, 5606, -1 }, { 14377, 5612, -1 },
+    { 14357, 5612, -1 }, { 14401, 5612, -1 }, { 14361, 5614, -1 }, { 14410, 5615, -1 },
+    { 14402, 5616, -1 }, { 14367, 5617, -1 }, { 14401, 5618, -1 }, { 14392, 5613, -1 },
+    { 14379, 5619, -1 }, { 14360, 5620, -1 }, { 14404, 5621, -1 }, { 14367, 5624, -1 },
+    { 14412, 5625, -1 }, { 14373, 5626, -1 }, { 14407, 5627, -1 }, { 14406, 5628, -1 },
+    { 14402, 5622, -1 }, { 14338, 5609, -1 }, { 14368, 5618, -1 }, { 14376, 5605, -1 },
+    { 14360, 5606, -1 }, { 14378, 5623, -1 }, { 14389, 5629, -1 }, { 14418, 5630, -1 },
+    { 14382, 5631, -1 }, { 14386, 5632, -1 }, { 14372, 5633, -1 }, { 14353, 5609, -1 },
+    { 14429, 5634, -1 }, { 14381, 5635, -1 }, { 14383, 5636, -1 }, { 14429, 5639, -1 },
+    { 14433, 5637, -1 }, { 14385, 5638, -1 }, { 14391, 5640, -1 }, { 14429, 5641, -1 },
+    { 14434, 5643, -1 }, { 14387, 5613, -1 }, { 14385, 5642, -1 }, { 14423, 5644, -1 },
+    { 14404, 5646, -1 }, { 14446, 5647, -1 }, { 14406, 5648, -1 }, { 14420, 5649, -1 },
+    { 14413, 5645, -1 }, { 14385, 5642, -1 }, { 14352, 5608, -1 }, { 14419, 5645, -1 },
+    { 14384, 5642, -1 }, { 14441, 5645, -1 }, { 14410, 5644, -1 }, { 14421, 5650, -1 },
+    { 14433, 5654, -1 }, { 14418, 5651, -1 }, { 14388, 5613, -1 }, { 14409, 5613, -1 },
+    { 14408, 5643, -1 }, { 14416, 5652, -1 }, { 14453, 5653, -1 }, { 14455, 5655, -1 },
+    { 14430, 5656, -1 }, { 14446, 5657, -1 }, { 14422, 5659, -1 }, { 14425, 5642, -1 },
+    { 14426, 5658, -1 }, { 14419, 5660, -1 }, { 14426, 5661, -1 }, { 14472, 5662, -1 },
+    { 14432, 5663, -1 }, { 14449, 5664, -1 }, { 14465, 5665, -1 }, { 14471, 5660, -1 },
+    { 14436, 5666, -1 }, { 14394, 5643, -1 }, { 14483, 5669, -1 }, { 14479, 5667, -1 },
+    { 14474, 5668, -1 }, { 14438, 5642, -1 }, { 14437, 5670, -1 }, { 14465, 5671, -1 },
+    { 14442, 5673, -1 }, { 14478, 5674, -1 }, { 14459, 5672, -1 }, { 14454, 5675, -1 },
+    { 14432, 5676, -1 }, { 14483, 5677, -1 }, { 14399, 5642, -1 }, { 14443, 5678, -1 },
+    { 14450, 5680, -1 }, { 14486, 5682, -1 }, { 14459, 5679, -1 }, { 14446, 5642, -1 },
+    { 14437, 5664, -1 }, { 14427, 5642, -1 }, { 14454, 5681, -1 }, { 14480, 5683, -1 },
+    { 14474, 5684, -1 }, { 14474, 5688, -1 }, { 14482, 5685, -1 }, { 14447, 5686, -1 },
+    { 14495, 5689, -1 }, { 14507, 5687, -1 }, { 14454, 5690, -1 }, { 14477, 5691, -1 },
+    { 14477, 5692, -1 }, { 14473, 5678, -1 }, { 14477, 5693, -1 }, { 14466, 5694, -1 },
+    { 14511, 5694, -1 }, { 14484, 5695, -1 }, { 14423, 5660, -1 }, { 14451, 5679, -1 },
+    { 14493, 5679, -1 }, { 14471, 5696, -1 }, { 14495, 5697, -1 }, { 14482, 5698, -1 },
+    { 14528, 5699, -1 }, { 14512, 5694, -1 }, { 14457, 5679, -1 }, { 14494, 5697, -1 },
+    { 14482, 5678, -1 }, { 14511, 5700, -1 }, { 14543, 5706, -1 }, { 14559, 5707, -1 },
+    { 14564, 5704, -1 }, { 14552, 5708, -1 }, { 14558, 5704, -1 }, { 14469, 5694, -1 },
+    { 14502, 5695, -1 }, { 14562, 5709, -1 }, { 14527, 5704, -1 }, { 14573, 5704, -1 },
+    { 14547, 5710, -1 }, { 14546, 5713, -1 }, { 14487, 5695, -1 }, { 14550, 5712, -1 },
+    { 14572, 5714, -1 }, { 14574, 5711, -1 }, { 14553, 5715, -1 }, { 14574, 5716, -1 },
+    { 14462, 5695, -1 }, { 14475, 5701, -1 }, { 14603, 5717, -1 }, { 14589, 5718, -1 },
+    { 14484, 5701, -1 }, { 14531, 5701, -1 }, { 14507, 5701, -1 }, { 14503, 5684, -1 },
+    { 14530, 5701, -1 }, { 14515, 5701, -1 }, { 14535, 5701, -1 }, { 14571, 5704, -1 },
+    { 14525, 5701, -1 }, { 14488, 5701, -1 }, { 14512, 5702, -1 }, { 14539, 5701, -1 },
+    { 14561, 5721, -1 }, { 14535, 5701, -1 }, { 14576, 5719, -1 }, { 14605, 5722, -1 },
+    { 14595, 5720, -1 }, { 14610, 5723, -1 }, { 14490, 5702, -1 }, { 14601, 5724, -1 },
+    { 14561, 5725, -1 }, { 14613, 5730, -1 }, { 14567, 5705, -1 }, { 14583, 5728, -1 },
+    { 14571, 5705, -1 }, { 14586, 5728, -1 }, { 14543, 5704, -1 }, { 14568, 5727, -1 },
+    { 14491, 5701, -1 }, { 14621, 5727, -1 }, { 14609, 5727, -1 }, { 14546, 5702, -1 },
+    { 14498, 5702, -1 }, { 14538, 5701, -1 }, { 14613, 5726, -1 }, { 14579, 5705, -1 },
+    { 14530, 5705, -1 }, { 14507, 5701, -1 }, { 14495, 5701, -1 }, { 14540, 5702, -1 },
+    { 14601, 5728, -1 }, { 14547, 5701, -1 }, { 14610, 5725, -1 }, { 14614, 5731, -1 },
+    { 14599, 5734, -1 }, { 14557, 5702, -1 }, { 14556, 5705, -1 }, { 14574, 5735, -1 },
+    { 14540, 5701, -1 }, { 14633, 5732, -1 }, { 14526, 5701, -1 }, { 14577, 5726, -1 },
+    { 14529, 5701, -1 }, { 14635, 5733, -1 }, { 14538, 5705, -1 }, { 14619, 5736, -1 },
+    { 14555, 5726, -1 }, { 14575, 5737, -1 }, { 14506, 5702, -1 }, { 14565, 5729, -1 },
+    { 14502, 5702, -1 }, { 14594, 5739, -1 }, { 14555, 5703, -1 }, { 14596, 5740, -1 },
+    { 14510, 5702, -1 }, { 14587, 5741, -1 }, { 14526, 5702, -1 }, { 14552, 5703, -1 },
+    { 14591, 5738, -1 }, { 14558, 5703, -1 }, { 14625, 5742, -1 }, { 14615, 5743, -1 },
+    { 14511, 5703, -1 }, { 14528, 5703, -1 }, { 14605, 5729, -1 }, { 14638, 5744, -1 },
+    { 14595, 5726, -1 }, { 14620, 5747, -1 }, { 14592, 5745, -1 }, { 14567, 5703, -1 },
+    { 14552, 5703, -1 }, { 14625, 5746, -1 }, { 14564, 5726, -1 }, { 14590, 5749, -1 },
+    { 14520, 5703, -1 }, { 14610, 5748, -1 }, { 14611, 5750, -1 }, { 14638, 5751, -1 },
+    { 14566, 5729, -1 }, { 14613, 5752, -1 }, { 14637, 5753, -1 }, { 14605, 5754, -1 },
+    { 14555, 5703, -1 }, { 14613, 5755, -1 }, { 14607, 5756, -1 }, { 14648, 5758, -1 },
+    { 14652, 5757, -1 }, { 14649, 5759, -1 }, { 14511, 5703, -1 }, { 14525, 5703, -1 },
+    { 14654, 5760, -1 }, { 14618, 5761, -1 }, { 14650, 5762, -1 }, { 14566, 5703, -1 },
+    { 14554, 5703, -1 }, { 14645, 5757, -1 }, { 14652, 5763, -1 }, { 14617, 5764, -1 },
+    { 14643, 5765, -1 }, { 14609, 5767, -1 }, { 14639, 5766, -1 }, { 14514, 5703, -1 },
+    { 14660, 5768, -1 }, { 14618, 5769, -1 }, { 14562, 5703, -1 }, { 14638, 5770, -1 },
+    { 14634, 5771, -1 }, { 14628, 5773, -1 }, { 14649, 5774, -1 }, { 14651, 5775, -1 },
+    { 14676, 5776, -1 }, { 14619, 5762, -1 }, { 14662, 5778, -1 }, { 14646, 5774, -1 },
+    { 14665, 5777, -1 }, { 14685, 5772, -1 }, { 14658, 5779, -1 }, { 14687, 5780, -1 },
+    { 14688, 5781, -1 }, { 14682, 5778, -1 }, { 14684, 5782, -1 }, { 14677, 5774, -1 },
+    { 14684, 5776, -1 }, { 14665, 5776, -1 }, { 14691, 5786, -1 }, { 14650, 5783, -1 },
+    { 14682, 5784, -1 }, { 14676, 5773, -1 }, { 14677, 5785, -1 }, { 14679, 5777, -1 },
+    { 14687, 5778, -1 }, { 14634, 5778, -1 }, { 14667, 5790, -1 }, { 14623, 5775, -1 },
+    { 14676, 5787, -1 }, { 14703, 5787, -1 }, { 14694, 5788, -1 }, { 14707, 5791, -1 },
+    { 14670, 5787, -1 }, { 14705, 5792, -1 }, { 14667, 5792, -1 }, { 14689, 5782, -1 },
+    { 14629, 5774, -1 }, { 14697, 5789, -1 }, { 14672, 5793, -1 }, { 14720, 5789, -1 },
+    { 14690, 5794, -1 }, { 14686, 5792, -1 }, { 14716, 5795, -1 }, { 14721, 5796, -1 },
+    { 14664, 5797, -1 }, { 14677, 5798, -1 }, { 14710, 5799, -1 }, { 14701, 5801, -1 },
+    { 14682, 5802, -1 }, { 14723, 5803, -1 }, { 14672, 5800, -1 }, { 14648, 5777, -1 },
+    { 14715, 5804, -1 }, { 14694, 5805, -1 }, { 14693, 5808, -1 }, { 14718, 5806, -1 },
+    { 14727, 5807, -1 }, { 14643, 5774, -1 }, { 14720, 5809, -1 }, { 14659, 5774, -1 },
+    { 14716, 5810, -1 }, { 14657, 5788, -1 }, { 14702, 5812, -1 }, { 14682, 5774, -1 },
+    { 14641, 5774, -1 }, { 14660, 5787, -1 }, { 14682, 5813, -1 }, { 14710, 5815, -1 },
+    { 14651, 5783, -1 }, { 14688, 5811, -1 }, { 14689, 5814, -1 }, { 14738, 5816, -1 },
+    { 14682, 5817, -1 }, { 14702, 5819, -1 }, { 14707, 5818, -1 }, { 14723, 5820, -1 },
+    { 14699, 5821, -1 }, { 14743, 5822, -1 }, { 14711, 5823, -1 }, { 14722, 5824, -1 },
+    { 14699, 5825, -1 }, { 14707, 5828, -1 }, { 14738, 5826, -1 }, { 14727, 5830, -1 },
+    { 14727, 5831, -1 }, { 14731, 5826, -1 }, { 14758, 5832, -1 }, { 14708, 5833, -1 },
+    { 14749, 5827, -1 }, { 14731, 5829, -1 }, { 14762, 5834, -1 }, { 14724, 5835, -1 },
+    { 14748, 5836, -1 }, { 14749, 5837, -1 }, { 14758, 5839, -1 }, { 14713, 5838, -1 },
+    { 14770, 5840, -1 }, { 14744, 5841, -1 }, { 14748, 5842, -1 }, { 14748, 5843, -1 },
+    { 14749, 5844, -1 }, { 14774, 5845, -1 }, { 14726, 5846, -1 }, { 14771, 5847, -1 },
+    { 14724, 5847, -1 }, { 14739, 5850, -1 }, { 14779, 5848, -1 }, { 14731, 5849, -1 },
+    { 14768, 5851, -1 }, { 14753, 5852, -1 }, { 14777, 5853, -1 }, { 14727, 5854, -1 },
+    { 14767, 5854, -1 }, { 14743, 5855, -1 }, { 14754, 5856, -1 }, { 14761, 5839, -1 },
+    { 14758, 5854, -1 }, { 14753, 5857, -1 }, { 14787, 5859, -1 }, { 14750, 5858, -1 },
+    { 14738, 5855, -1 }, { 14760, 5860, -1 }, { 14777, 5858, -1 }, { 14810, 5861, -1 },
+    { 14793, 5858, -1 }, { 14792, 5856, -1 }, { 14758, 5862, -1 }, { 14799, 5863, -1 },
+    { 14800, 5864, -1 }, { 14790, 5865, -1 }, { 14774, 5855, -1 }, { 14758, 5866, -1 },
+    { 14803, 5867, -1 }, { 14766, 5868, -1 }, { 14749, 5857, -1 }, { 14769, 5869, -1 },
+    { 14772, 5870, -1 }, { 14767, 5871, -1 }, { 14767, 5872, -1 }, { 14793, 5874, -1 },
+    { 14823, 5875, -1 }, { 14773, 5873, -1 }, { 14813, 5876, -1 }, { 14791, 5877, -1 },
+    { 14767, 5859, -1 }, { 14766, 5857, -1 }, { 14823, 5873, -1 }, { 14781, 5878, -1 },
+    { 14816, 5878, -1 }, { 14808, 5879, -1 }, { 14802, 5880, -1 }, { 14779, 5882, -1 },
+    { 14778, 5859, -1 }, { 14814, 5882, -1 }, { 14794, 5883, -1 }, { 14820, 5881, -1 },
+    { 14818, 5881, -1 }, { 14746, 5857, -1 }, { 14780, 5857, -1 }, { 14748, 5858, -1 },
+    { 14794, 5881, -1 }, { 14826, 5884, -1 }, { 14832, 5885, -1 }, { 14755, 5858, -1 },
+    { 14844, 5886, -1 }, { 14822, 5887, -1 }, { 14786, 5885, -1 }, { 14830, 5885, -1 },
+    { 14801, 5888, -1 }, { 14798, 5889, -1 }, { 14849, 5890, -1 }, { 14820, 5891, -1 },
+    { 14800, 5892, -1 }, { 14829, 5885, -1 }, { 14821, 5896, -1 }, { 14852, 5893, -1 },
+    { 14819, 5894, -1 }, { 14810, 5895, -1 }, { 14844, 5897, -1 }, { 14829, 5899, -1 },
+    { 14801, 5898, -1 }, { 14863, 5900, -1 }, { 14815, 5885, -1 }, { 14832, 5902, -1 },
+    { 14866, 5901, -1 }, { 14818, 5903, -1 }, { 14850, 5904, -1 }, { 14845, 5906, -1 },
+    { 14847, 5890, -1 }, { 14859, 5908, -1 }, { 14827, 5883, -1 }, { 14869, 5905, -1 },
+    { 14844, 5893, -1 }, { 14842, 5907, -1 }, { 14826, 5909, -1 }, { 14851, 5910, -1 },
+    { 14847, 5911, -1 }, { 14817, 5912, -1 }, { 14821, 5914, -1 }, { 14874, 5913, -1 },
+    { 14824, 5915, -1 }, { 14867, 5916, -1 }, { 14841, 5918, -1 }, { 14826, 5902, -1 },
+    { 14851, 5920, -1 }, { 14856, 5915, -1 }, { 14822, 5911, -1 }, { 14871, 5917, -1 },
+    { 14853, 5910, -1 }, { 14856, 5919, -1 }, { 14878, 5921, -1 }, { 14888, 5922, -1 },
+    { 14867, 5923, -1 }, { 14892, 5924, -1 }, { 14863, 5925, -1 }, { 14849, 5926, -1 },
+    { 14898, 5931, -1 }, { 14852, 5927, -1 }, { 14794, 5891, -1 }, { 14898, 5928, -1 },
+    { 14866, 5929, -1 }, { 14855, 5916, -1 }, { 14882, 5928, -1 }, { 14861, 5919, -1 },
+    { 14872, 5927, -1 }, { 14897, 5933, -1 }, { 14880, 5930, -1 }, { 14873, 5918, -1 },
+    { 14850, 5934, -1 }, { 14858, 5935, -1 }, { 14906, 5936, -1 }, { 14884, 5937, -1 },
+    { 14847, 5924, -1 }, { 14859, 5939, -1 }, { 14912, 5941, -1 }, { 14866, 5932, -1 },
+    { 14879, 5933, -1 }, { 14862, 5940, -1 }, { 14875, 5943, -1 }, { 14851, 5916, -1 },
+    { 14922, 5944, -1 }, { 14871, 5938, -1 }, { 14901, 5942, -1 }, { 14898, 5943, -1 },
+    { 14888, 5945, -1 }, { 14897, 5946, -1 }, { 14912, 5947, -1 }, { 14893, 5948, -1 },
+    { 14900, 5949, -1 }, { 14902, 5950, -1 }, { 14927, 5951, -1 }, { 14883, 5952, -1 },
+    { 14830, 5916, -1 }, { 14907, 5953, -1 }, { 14885, 5954, -1 }, { 14937, 5955, -1 },
+    { 14909, 5956, -1 }, { 14939, 5960, -1 }, { 14888, 5957, -1 }, { 14928, 5958, -1 },
+    { 14925, 5959, -1 }, { 14906, 5961, -1 }, { 14936, 5962, -1 }, { 14941, 5963, -1 },
+    { 14895, 5964, -1 }, { 14940, 5968, -1 }, { 14909, 5964, -1 }, { 14939, 5965, -1 },
+    { 14944, 5969, -1 }, { 14952, 5970, -1 }, { 14944, 5971, -1 }, { 14938, 5970, -1 },
+    { 14927, 5971, -1 }, { 14878, 5951, -1 }, { 14932, 5966, -1 }, { 14929, 5972, -1 },
+    { 14913, 5937, -1 }, { 14928, 5972, -1 }, { 14947, 5971, -1 }, { 14942, 5967, -1 },
+    { 14908, 5971, -1 }, { 14942, 5972, -1 }, { 14965, 5974, -1 }, { 14982, 5974, -1 },
+    { 14960, 5975, -1 }, { 14923, 5973, -1 }, { 14970, 5973, -1 }, { 14967, 5974, -1 },
+    { 14939, 5970, -1 }, { 14978, 5976, -1 }, { 14933, 5970, -1 }, { 14929, 5970, -1 },
+    { 14930, 5977, -1 }, { 14945, 5978, -1 }, { 14931, 5951, -1 }, { 14942, 5979, -1 },
+    { 14914, 5971, -1 }, { 14968, 5972, -1 }, { 14944, 5971, -1 }, { 14933, 5951, -1 },
+    { 14981, 5973, -1 }, { 14945, 5980, -1 }, { 14951, 5982, -1 }, { 14940, 5974, -1 },
+    { 14972, 5983, -1 }, { 14932, 5974, -1 }, { 14951, 5984, -1 }, { 14941, 5981, -1 },
+    { 14886, 5960, -1 }, { 14943, 5985, -1 }, { 14950, 5986, -1 }, { 14952, 5987, -1 },
+    { 14955, 5988, -1 }, { 14929, 5972, -1 }, { 14981, 5989, -1 }, { 15029, 5996, -1 },
+    { 14948, 5971, -1 }, { 14938, 5971, -1 }, { 14961, 5971, -1 }, { 14922, 5971, -1 },
+    { 14949, 5970, -1 }, { 14956, 5986, -1 }, { 14998, 5990, -1 }, { 14962, 5990, -1 },
+    { 15075, 5999, -1 }, { 15077, 6000, -1 }, { 14995, 5990, -1 }, { 14997, 5990, -1 },
+    { 15073, 5998, -1 }, { 14980, 5990, -1 }, { 14986, 5967, -1 }, { 14976, 5983, -1 },
+    { 14944, 5972, -1 }, { 14959, 5972, -1 }, { 15061, 5995, -1 }, { 15005, 5991, -1 },
+    { 15042, 6002, -1 }, { 15079, 6004, -1 }, { 14967, 5991, -1 }, { 14970, 5974, -1 },
+    { 14986, 5991, -1 }, { 15054, 5995, -1 }, { 14959, 5991, -1 }, { 15067, 6006, -1 },
+    { 14959, 5991, -1 }, { 14997, 5991, -1 }, { 15075, 6003, -1 }, { 15076, 6003, -1 },
+    { 15067, 6001, -1 }, { 15076, 6007, -1 }, { 15049, 6008, -1 }, { 15089, 6009, -1 },
+    { 15090, 6010, -1 }, { 15072, 5995, -1 }, { 15053, 6000, -1 }, { 15078, 6005, -1 },
+    { 15115, 6011, -1 }, { 14990, 5991, -1 }, { 14982, 5991, -1 }, { 14985, 5992, -1 },
+    { 15005, 5992, -1 }, { 15068, 5995, -1 }, { 15004, 5992, -1 }, { 15169, 6012, -1 },
+    { 15085, 6002, -1 }, { 15005, 5992, -1 }, { 14975, 5992, -1 }, { 14962, 5991, -1 },
+    { 14977, 5992, -1 }, { 15061, 5995, -1 }, { 15007, 5992, -1 }, { 15042, 6001, -1 },
+    { 15030, 5998, -1 }, { 15058, 6013, -1 }, { 15011, 5992, -1 }, { 15168, 6021, -1 },
+    { 15106, 6013, -1 }, { 15061, 6001, -1 }, { 15015, 5997, -1 }, { 15003, 5993, -1 },
+    { 15017, 5992, -1 }, { 15018, 5992, -1 }, { 15168, 6022, -1 }, { 15034, 6000, -1 },
+    { 15171, 6023, -1 }, { 15081, 6014, -1 }, { 15026, 5993, -1 }, { 15126, 6024, -1 },
+    { 14983, 5992, -1 }, { 15009, 5993, -1 }, { 15178, 6027, -1 }, { 15003, 5991, -1 },
+    { 15002, 5991, -1 }, { 15045, 6003, -1 }, { 15011, 5993, -1 }, { 15151, 6028, -1 },
+    { 15017, 5992, -1 }, { 15070, 6013, -1 }, { 14981, 5992, -1 }, { 15106, 6013, -1 },
+    { 15039, 5993, -1 }, { 15028, 5993, -1 }, { 15147, 6026, -1 }, { 15027, 5997, -1 },
+    { 15171, 6026, -1 }, { 14994, 5993, -1 }, { 15044, 5993, -1 }, { 15006, 5994, -1 },
+    { 15069, 6014, -1 }, { 15004, 5994, -1 }, { 15012, 5994, -1 }, { 15010, 5994, -1 },
+    { 15051, 5994, -1 }, { 15035, 5993, -1 }, { 15171, 6025, -1 }, { 14991, 5993, -1 },
+    { 15079, 5997, -1 }, { 15106, 6015, -1 }, { 15067, 6015, -1 }, { 15055, 5994, -1 },
+    { 15093, 6016, -1 }, { 15129, 6029, -1 }, { 15101, 6015, -1 }, { 15077, 5997, -1 },
+    { 15071, 6016, -1 }, { 15062, 5997, -1 }, { 15039, 5993, -1 }, { 15045, 5997, -1 },
+    { 15153, 6030, -1 }, { 15155, 6035, -1 }, { 15052, 5994, -1 }, { 15091, 6016, -1 },
+    { 15002, 5993, -1 }, { 15029, 5993, -1 }, { 15107, 6016, -1 }, { 15175, 6032, -1 },
+    { 15144, 6033, -1 }, { 15163, 6034, -1 }, { 15112, 6016, -1 }, { 15157, 6036, -1 },
+    { 15122, 6017, -1 }, { 15104, 6017, -1 }, { 15109, 6019, -1 }, { 15003, 5994, -1 },
+    { 15066, 5994, -1 }, { 15192, 6037, -1 }, { 15192, 6038, -1 }, { 15086, 6016, -1 },
+    { 15143, 6042, -1 }, { 15023, 5994, -1 }, { 15121, 6025, -1 }, { 15169, 6041, -1 },
+    { 15107, 6016, -1 }, { 15135, 6017, -1 }, { 15127, 6016, -1 }, { 15087, 6016, -1 },
+    { 15069, 6016, -1 }, { 15093, 6017, -1 }, { 15186, 6039, -1 }, { 15132, 6020, -1 },
+    { 15062, 5994, -1 }, { 15128, 6031, -1 }, { 15180, 6031, -1 }, { 15193, 6043, -1 },
+    { 15135, 6017, -1 }, { 15137, 6040, -1 }, { 15146, 6044, -1 }, { 15100, 6019, -1 },
+    { 15082, 6016, -1 }, { 15199, 6039, -1 }, { 15147, 6019, -1 }, { 15117, 6019, -1 },
+    { 15189, 6045, -1 }, { 15085, 6017, -1 }, { 15094, 6016, -1 }, { 15092, 6018, -1 },
+    { 15113, 6017, -1 }, { 15094, 6016, -1 }, { 15180, 6048, -1 }, { 15179, 6049, -1 },
+    { 15100, 6016, -1 }, { 15124, 6016, -1 }, { 15093, 6016, -1 }, { 15203, 6047, -1 },
+    { 15156, 6020, -1 }, { 15158, 6019, -1 }, { 15114, 6017, -1 }, { 15139, 6018, -1 },
+    { 15131, 6020, -1 }, { 15099, 6018, -1 }, { 15137, 6031, -1 }, { 15177, 6046, -1 },
+    { 15112, 6020, -1 }, { 15203, 6051, -1 }, { 15156, 6052, -1 }, { 15119, 6019, -1 },
+    { 15133, 6017, -1 }, { 15149, 6040, -1 }, { 15204, 6046, -1 }, { 15148, 6018, -1 },
+    { 15129, 6018, -1 }, { 15184, 6053, -1 }, { 15213, 6054, -1 }, { 15187, 6056, -1 },
+    { 15208, 6050, -1 }, { 15215, 6055, -1 }, { 15186, 6040, -1 }, { 15223, 6057, -1 },
+    { 15110, 6018, -1 }, { 15224, 6058, -1 }, { 15185, 6059, -1 }, { 15139, 6031, -1 },
+    { 15195, 6060, -1 }, { 15224, 6061, -1 }, { 15225, 6062, -1 }, { 15132, 6020, -1 },
+    { 15181, 6063, -1 }, { 15213, 6064, -1 }, { 15230, 6066, -1 }, { 15154, 6020, -1 },
+    { 15226, 6067, -1 }, { 15229, 6068, -1 }, { 15199, 6069, -1 }, { 15190, 6047, -1 },
+    { 15231, 6070, -1 }, { 15208, 6071, -1 }, { 15239, 6074, -1 }, { 15235, 6065, -1 },
+    { 15202, 6072, -1 }, { 15187, 6073, -1 }, { 15194, 6075, -1 }, { 15094, 6018, -1 },
+    { 15236, 6076, -1 }, { 15186, 6077, -1 }, { 15115, 6018, -1 }, { 15236, 6078, -1 },
+    { 15203, 6079, -1 }, { 15239, 6080, -1 }, { 15200, 6081, -1 }, { 15245, 6082, -1 },
+    { 15180, 6064, -1 }, { 15220, 6083, -1 }, { 15241, 6084, -1 }, { 15203, 6085, -1 },
+    { 15201, 6086, -1 }, { 15225, 6090, -1 }, { 15263, 6091, -1 }, { 15221, 6083, -1 },
+    { 15253, 6085, -1 }, { 15199, 6087, -1 }, { 15233, 6088, -1 }, { 15201, 6087, -1 },
+    { 15214, 6088, -1 }, { 15254, 6092, -1 }, { 15225, 6087, -1 }, { 15163, 6054, -1 },
+    { 15255, 6093, -1 }, { 15247, 6095, -1 }, { 15248, 6094, -1 }, { 15260, 6096, -1 },
+    { 15248, 6097, -1 }, { 15239, 6088, -1 }, { 15232, 6098, -1 }, { 15197, 6063, -1 },
+    { 15263, 6089, -1 }, { 15273, 6099, -1 }, { 15254, 6100, -1 }, { 15188, 6070, -1 },
+    { 15245, 6102, -1 }, { 15261, 6103, -1 }, { 15248, 6104, -1 }, { 15269, 6105, -1 },
+    { 15265, 6106, -1 }, { 15266, 6101, -1 }, { 15252, 6107, -1 }, { 15236, 6108, -1 },
+    { 15229, 6111, -1 }, { 15278, 6112, -1 }, { 15256, 6109, -1 }, { 15237, 6113, -1 },
+    { 15288, 6115, -1 }, { 15232, 6113, -1 }, { 15236, 6113, -1 }, { 15260, 6117, -1 },
+    { 15255, 6116, -1 }, { 15267, 6092, -1 }, { 15287, 6114, -1 }, { 15284, 6118, -1 },
+    { 15291, 6114, -1 }, { 15258, 6118, -1 }, { 15311, 6118, -1 }, { 15270, 6115, -1 },
+    { 15278, 6115, -1 }, { 15307, 6110, -1 }, { 15266, 6119, -1 }, { 15290, 6120, -1 },
+    { 15318, 6121, -1 }, { 15319, 6123, -1 }, { 15269, 6122, -1 }, { 15227, 6088, -1 },
+    { 15323, 6124, -1 }, { 15260, 6114, -1 }, { 15297, 6125, -1 }, { 15285, 6114, -1 },
+    { 15312, 6126, -1 }, { 15280, 6116, -1 }, { 15273, 6127, -1 }, { 15279, 6114, -1 },
+    { 15302, 6129, -1 }, { 15260, 6116, -1 }, { 15302, 6128, -1 }, { 15279, 6131, -1 },
+    { 15265, 6115, -1 }, { 15277, 6130, -1 }, { 15309, 6132, -1 }, { 15306, 6116, -1 },
+    { 15296, 6115, -1 }, { 15263, 6122, -1 }, { 15325, 6128, -1 }, { 15286, 6133, -1 },
+    { 15310, 6134, -1 }, { 15304, 6127, -1 }, { 15320, 6137, -1 }, { 15284, 6135, -1 },
+    { 15282, 6136, -1 }, { 15278, 6123, -1 }, { 15342, 6138, -1 }, { 15345, 6139, -1 },
+    { 15297, 6116, -1 }, { 15330, 6140, -1 }, { 15297, 6130, -1 }, { 15298, 6141, -1 },
+    { 15274, 6114, -1 }, { 15300, 6116, -1 }, { 15300, 6116, -1 }, { 15326, 6142, -1 },
+    { 15295, 6143, -1 }, { 15314, 6145, -1 }, { 15353, 6146, -1 }, { 15337, 6143, -1 },
+    { 15346, 6147, -1 }, { 15249, 6116, -1 }, { 15303, 6148, -1 }, { 15257, 6116, -1 },
+    { 15327, 6150, -1 }, { 15337, 6151, -1 }, { 15349, 6152, -1 }, { 15349, 6153, -1 },
+    { 15352, 6155, -1 }, { 15315, 6154, -1 }, { 15352, 6157, -1 }, { 15321, 6143, -1 },
+    { 15350, 6158, -1 }, { 15352, 6159, -1 }, { 15354, 6161, -1 }, { 15324, 6162, -1 },
+    { 15357, 6162, -1 }, { 15361, 6144, -1 }, { 15376, 6149, -1 }, { 15329, 6156, -1 },
+    { 15340, 6160, -1 }, { 15318, 6159, -1 }, { 15326, 6163, -1 }, { 15313, 6159, -1 },
+    { 15370, 6164, -1 }, { 15341, 6165, -1 }, { 15335, 6166, -1 }, { 15336, 6167, -1 },
+    { 15342, 6144, -1 }, { 15381, 6168, -1 }, { 15348, 6170, -1 }, { 15375, 6169, -1 },
+    { 15333, 6157, -1 }, { 15357, 6171, -1 }, { 15391, 6172, -1 }, { 15365, 6173, -1 },
+    { 15347, 6175, -1 }, { 15364, 6176, -1 }, { 15393, 6177, -1 }, { 15302, 6146, -1 },
+    { 15304, 6143, -1 }, { 15382, 6174, -1 }, { 15367, 6178, -1 }, { 15342, 6179, -1 },
+    { 15369, 6180, -1 }, { 15341, 6181, -1 }, { 15342, 6182, -1 }, { 15388, 6183, -1 },
+    { 15389, 6184, -1 }, { 15390, 6185, -1 }, { 15355, 6186, -1 }, { 15377, 6173, -1 },
+    { 15408, 6187, -1 }, { 15362, 6188, -1 }, { 15371, 6190, -1 }, { 15362, 6191, -1 },
+    { 15351, 6192, -1 }, { 15355, 6189, -1 }, { 15383, 6193, -1 }, { 15373, 6144, -1 },
+    { 15387, 6194, -1 }, { 15358, 6198, -1 }, { 15408, 6194, -1 }, { 15344, 6173, -1 },
+    { 15376, 6195, -1 }, { 15366, 6195, -1 }, { 15392, 6196, -1 }, { 15416, 6199, -1 },
+    { 15418, 6200, -1 }, { 15423, 6201, -1 }, { 15410, 6197, -1 }, { 15365, 6165, -1 },
+    { 15422, 6202, -1 }, { 15412, 6203, -1 }, { 15420, 6203, -1 }, { 15410, 6204, -1 },
+    { 15385, 6205, -1 }, { 15384, 6206, -1 }, { 15425, 6206, -1 }, { 15394, 6207, -1 },
+    { 15378, 6208, -1 }, { 15431, 6209, -1 }, { 15421, 6209, -1 }, { 15411, 6198, -1 },
+    { 15390, 6210, -1 }, { 15418, 6212, -1 }, { 15364, 6195, -1 }, { 15347, 6176, -1 },
+    { 15411, 6213, -1 }, { 15426, 6211, -1 }, { 15394, 6214, -1 }, { 15433, 6215, -1 },
+    { 15396, 6216, -1 }, { 15400, 6218, -1 }, { 15442, 6219, -1 }, { 15448, 6220, -1 },
+    { 15446, 6221, -1 }, { 15440, 6223, -1 }, { 15403, 6217, -1 }, { 15399, 6224, -1 },
+    { 15436, 6217, -1 }, { 15432, 6225, -1 }, { 15397, 6228, -1 }, { 0, 6222, 0 },
+    { 0, 6226, 1 }, { 15356, 6227, -1 }, { 15358, 6229, -1 }, { 0, 6231, 4 },
+    { 0, 6232, 5 }, { 0, 6233, 6 }, { 0, 6234, 7 }, { 0, 6235, 9 },
+    { 15361, 6242, -1 }, { 0, 6243, 13 }, { 15359, 6246, -1 }, { 15359, 6255, -1 },
+    { 15360, 6263, -1 }, { 15367, 6284, -1 }, { 0, 6230, 20 }, { 15365, 6253, -1 },
+    { 15368, 138, -1 }, { 0, 6284, 19 }, { 15365, 6236, -1 }, { 0, 6237, 24 },
+    { 15389, 6209, -1 }, { 0, 6238, 25 }, { 15370, 6239, -1 }, { 15361, 6263, -1 },
+    { 0, 6245, 27 }, { 0, 6247, 29 }, { 0, 6249, 30 }, { 0, 6240, 31 },
+    { 0, 6241, 32 }, { 15371, 6283, -1 }, { 0, 6244, 34 }, { 0, 6258, 35 },
+    { 15360, 6235, -1 }, { 0, 6242, 12 }, { 15371, 6248, -1 }, { 0, 6250, 37 },
+    { 0, 6251, 38 }, { 0, 6259, 39 }, { 0, 6280, 40 }, { 15374, 6306, -1 },
+    { 0, 6252, 42 }, { 15374, 6254, -1 }, { 0, 6256, 44 }, { 0, 6257, 45 },
+    { 0, 6260, 46 }, { 15371, 6294, -1 }, { 15373, 6261, -1 }, { 0, 6262, 49 },
+    { 0, 6264, 50 }, { 0, 6265, 51 }, { 15373, 6299, -1 }, { 0, 6266, 53 },
+    { 15378, 6267, -1 }, { 0, 6269, 55 }, { 0, 6275, 56 }, { 0, 6278, 57 },
+    { 15376, 6309, -1 }, { 15381, 6319, 59 }, { 15359, 6234, -1 }, { 0, 6268, 61 },
+    { 0, 6281, 62 }, { 15378, 6270, -1 }, { 0, 6305, 64 }, { 15382, 6272, -1 },
+    { 0, 6279, 66 }, { 15379, 6292, -1 }, { 15384, 6307, -1 }, { 15385, 134, -1 },
+    { 0, 6271, 71 }, { 0, 6273, 73 }, { 0, 6277, 76 }, { 15386, 6291, -1 },
+    { 0, 6273, 74 }, { 15388, 6295, -1 }, { 0, 6298, 80 }, { 0, 6301, 81 },
+    { 0, 6302, 82 }, { 0, 6304, 83 }, { 0, 6314, 84 }, { 0, 6321, 85 },
+    { 15388, 6322, -1 }, { 0, 6323, 88 }, { 15390, 6323, -1 }, { 0, 6322, 87 },
+    { 0, 6324, 90 }, { 0, 6328, 91 }, { 15387, 6334, -1 }, { 15391, 6341, -1 },
+    { 0, 6348, 94 }, { 0, 6288, 95 }, { 0, 6289, 96 }, { 0, 6316, 97 },
+    { 0, 6317, 98 }, { 0, 6320, 99 }, { 15386, 6271, -1 }, { 0, 6333, 100 },
+    { 0, 6335, 101 }, { 0, 6338, 103 }, { 0, 6274, 104 }, { 0, 6303, 105 },
+    { 0, 6295, 79 }, { 15394, 6335, -1 }, { 0, 6308, 106 }, { 0, 6329, 107 },
+    { 0, 6337, 108 }, { 0, 6344, 109 }, { 0, 6351, 110 }, { 15392, 6356, -1 },
+    { 0, 6366, 114 }, { 0, 6287, 116 }, { 0, 6310, 117 }, { 0, 6312, 118 },
+    { 0, 6276, 120 }, { 15391, 6282, -1 }, { 15395, 6290, -1 }, { 15393, 6327, -1 },
+    { 0, 6273, 75 }, { 0, 6285, 126 }, { 15395, 6286, -1 }, { 15396, 6297, -1 },
+    { 0, 6330, 131 }, { 0, 6293, 132 }, { 0, 6311, 134 }, { 0, 6318, 135 },
+    { 0, 6351, 111 }, { 15401, 135, -1 }, { 0, 6296, 138 }, { 0, 6366, 115 },
+    { 0, 6300, 140 }, { 0, 6315, 141 }, { 15401, 6336, -1 }, { 0, 6313, 143 },
+    { 15403, 6325, -1 }, { 15403, 6326, -1 }, { 15405, 6331, -1 }, { 0, 6332, 149 },
+    { 15406, 6339, -1 }, { 0, 6340, 163 }, { 0, 6342, 164 }, { 15408, 6353, 165 },
+    { 0, 6351, 112 }, { 0, 6343, 167 }, { 15408, 6345, -1 }, { 0, 6365, 169 },
+    { 15409, 6346, -1 }, { 0, 6347, 171 }, { 0, 6349, 172 }, { 0, 6350, 174 },
+    { 0, 6352, 175 }, { 0, 6361, 176 }, { 0, 6363, 177 }, { 0, 6387, 178 },
+    { 0, 6394, 179 }, { 0, 6406, 180 }, { 0, 6354, 181 }, { 0, 6383, 182 },
+    { 15415, 6391, -1 }, { 0, 6355, 184 }, { 0, 6357, 185 }, { 0, 6358, 186 },
+    { 0, 6382, 187 }, { 15414, 6359, -1 }, { 0, 6360, 191 }, { 0, 6362, 192 },
+    { 0, 6364, 194 }, { 0, 6367, 195 }, { 0, 6382, 188 }, { 0, 6368, 196 },
+    { 0, 6369, 197 }, { 15415, 6370, -1 }, { 15417, 6371, -1 }, { 0, 6372, 203 },
+    { 0, 6373, 204 }, { 0, 6418, 205 }, { 0, 6374, 206 }, { 0, 6375, 207 },
+    { 0, 6376, 208 }, { 0, 6377, 209 }, { 0, 6378, 211 }, { 15414, 6379, -1 },
+    { 15415, 6380, -1 }, { 0, 6381, 216 }, { 15421, 6384, -1 }, { 0, 6389, 218 },
+    { 0, 6385, 219 }, { 0, 6386, 220 }, { 0, 6388, 221 }, { 15421, 6390, -1 },
+    { 0, 6392, 225 }, { 0, 6393, 227 }, { 0, 6395, 229 }, { 0, 6396, 231 },
+    { 0, 6400, 232 }, { 15422, 6397, -1 }, { 15423, 6398, -1 }, { 0, 6399, 235 },
+    { 0, 6401, 236 }, { 15423, 6402, -1 }, { 15424, 6403, -1 }, { 15425, 6404, -1 },
+    { 0, 6405, 242 }, { 15426, 6407, -1 }, { 0, 6408, 244 }, { 0, 6409, 245 },
+    { 0, 6411, 246 }, { 0, 6410, 247 }, { 15424, 6412, -1 }, { 0, 6417, 250 },
+    { 0, 6419, 252 }, { 15429, 6420, -1 }, { 15432, 6421, -1 }, { 15425, 6419, -1 },
+    { 15434, 6422, -1 }, { 15437, 6423, -1 }, { 15437, 6427, -1 }, { 15434, 6421, -1 },
+    { 15439, 6427, -1 }, { 15441, 6428, -1 }, { 15444, 6429, -1 }, { 0, 6433, 275 },
+    { 15442, 6434, -1 }, { 15449, 6435, -1 }, { 15430, 6420, -1 }, { 15449, 6437, -1 },
+    { 15450, 6437, -1 }, { 0, 6428, 268 }, { 0, 6438, 283 }, { 15455, 6440, -1 },
+    { 15454, 6441, -1 }, { 15455, 6449, -1 }, { 15456, 6450, -1 }, { 0, 6428, 269 },
+    { 0, 6451, 290 }, { 0, 6454, 292 }, { 15460, 6459, -1 }, { 15458, 6458, -1 },
+    { 15443, 6428, -1 }, { 15460, 6458, -1 }, { 15436, 6422, -1 }, { 0, 6461, 299 },
+    { 15466, 6468, -1 }, { 0, 6462, 300 }, { 15445, 6429, -1 }, { 0, 6451, 291 },
+    { 0, 6462, 301 }, { 15461, 6467, -1 }, { 0, 6469, 307 }, { 0, 6417, 251 },
+    { 15468, 6470, -1 }, { 15462, 6467, -1 }, { 15471, 6470, -1 }, { 0, 6471, 316 },
+    { 0, 6478, 317 }, { 15471, 6470, -1 }, { 15473, 6479, -1 }, { 15473, 6480, -1 },
+    { 15477, 6481, -1 }, { 15473, 6479, -1 }, { 15431, 6420, -1 }, { 15478, 6482, -1 },
+    { 15450, 6437, -1 }, { 0, 6483, 325 }, { 0, 6484, 326 }, { 15454, 6437, -1 },
+    { 15482, 6485, -1 }, { 0, 6486, 332 }, { 15481, 6494, -1 }, { 15463, 6467, -1 },
+    { 15481, 6491, -1 }, { 0, 6498, 337 }, { 0, 6507, 338 }, { 0, 6508, 339 },
+    { 15486, 6510, -1 }, { 15480, 6485, -1 }, { 15490, 6511, -1 }, { 15491, 6514, -1 },
+    { 15493, 6515, -1 }, { 0, 6516, 350 }, { 15493, 6518, -1 }, { 0, 6523, 355 },
+    { 0, 6526, 356 }, { 0, 6530, 358 }, { 15498, 6531, -1 }, { 15499, 6534, -1 },
+    { 0, 6478, 318 }, { 15465, 6467, -1 }, { 0, 6511, 347 }, { 15498, 6535, -1 },
+    { 0, 6537, 365 }, { 0, 6538, 367 }, { 15505, 6539, -1 }, { 15479, 6484, -1 },
+    { 0, 6540, 372 }, { 0, 6491, 334 }, { 15506, 6543, -1 }, { 15504, 6546, -1 },
+    { 0, 6548, 376 }, { 0, 6549, 378 }, { 15508, 6519, -1 }, { 15511, 6521, -1 },
+    { 15512, 6522, -1 }, { 15512, 6527, -1 }, { 0, 6533, 385 }, { 0, 6551, 386 },
+    { 0, 6539, 371 }, { 15489, 6510, -1 }, { 15486, 6508, -1 }, { 15515, 6552, -1 },
+    { 15516, 6556, -1 }, { 15498, 6535, -1 }, { 15516, 6565, -1 }, { 15520, 6575, -1 },
+    { 15520, 6544, -1 }, { 15520, 6555, -1 }, { 15522, 6557, -1 }, { 15503, 6537, -1 },
+    { 15480, 6484, -1 }, { 15520, 6564, -1 }, { 15496, 6518, -1 }, { 0, 6577, 396 },
+    { 15504, 6538, -1 }, { 0, 6518, 354 }, { 15519, 6557, -1 }, { 15523, 6581, -1 },
+    { 0, 6588, 398 }, { 0, 6592, 399 }, { 15524, 6594, -1 }, { 0, 6592, 400 },
+    { 15506, 6548, -1 }, { 0, 6596, 402 }, { 0, 6597, 404 }, { 0, 6598, 405 },
+    { 0, 6603, 406 }, { 15529, 6607, -1 }, { 15528, 6578, -1 }, { 15496, 6526, -1 },
+    { 15531, 6580, -1 }, { 15532, 6584, -1 }, { 0, 6601, 413 }, { 15533, 6604, -1 },
+    { 15535, 6605, 415 }, { 0, 6606, 417 }, { 15536, 6608, -1 }, { 15538, 6611, -1 },
+    { 15539, 6612, -1 }, { 0, 6621, 425 }, { 15541, 6622, -1 }, { 15530, 6578, -1 },
+    { 15542, 6628, -1 }, { 15532, 6606, -1 }, { 15527, 6596, -1 }, { 15544, 6636, -1 },
+    { 0, 6442, 433 }, { 0, 6443, 434 }, { 0, 6444, 435 }, { 0, 6447, 436 },
+    { 15544, 6413, -1 }, { 15541, 6612, -1 }, { 0, 6448, 438 }, { 0, 6414, 439 },
+    { 0, 6612, 424 }, { 0, 6424, 440 }, { 0, 6426, 441 }, { 15548, 6466, -1 },
+    { 0, 6415, 443 }, { 0, 6416, 444 }, { 0, 6431, 445 }, { 0, 6439, 446 },
+    { 0, 6474, 447 }, { 15537, 6608, -1 }, { 0, 6425, 448 }, { 15546, 6430, -1 },
+    { 0, 6445, 450 }, { 15548, 6432, -1 }, { 0, 6436, 452 }, { 15550, 6446, -1 },
+    { 0, 6452, 455 }, { 0, 6453, 456 }, { 0, 6500, 457 }, { 0, 6455, 458 },
+    { 15552, 6456, -1 }, { 0, 6457, 462 }, { 0, 6460, 463 }, { 0, 6463, 466 },
+    { 0, 6464, 467 }, { 0, 6465, 468 }, { 15552, 6472, -1 }, { 0, 6473, 471 },
+    { 0, 6475, 472 }, { 0, 6476, 473 }, { 15549, 6477, -1 }, { 0, 6487, 476 },
+    { 0, 6488, 477 }, { 0, 6490, 479 }, { 0, 6602, 480 }, { 0, 6615, 481 },
+    { 15553, 6626, -1 }, { 0, 6635, 483 }, { 0, 6637, 484 }, { 0, 6638, 485 },
+    { 0, 6488, 478 }, { 0, 6640, 486 }, { 0, 6647, 487 }, { 0, 6660, 489 },
+    { 0, 6503, 490 }, { 0, 6541, 491 }, { 0, 6489, 492 }, { 15553, 6492, -1 },
+    { 0, 6493, 494 }, { 0, 6497, 495 }, { 0, 6512, 496 }, { 0, 6496, 497 },
+    { 0, 6509, 498 }, { 0, 6495, 499 }, { 15556, 6499, -1 }, { 0, 6647, 488 },
+    { 0, 6501, 504 }, { 15557, 6502, -1 }, { 0, 6504, 507 }, { 0, 6505, 508 },
+    { 0, 6506, 509 }, { 0, 6513, 510 }, { 0, 6524, 512 }, { 0, 6545, 513 },
+    { 15558, 6517, -1 }, { 0, 6520, 516 }, { 0, 6525, 517 }, { 15556, 6528, -1 },
+    { 0, 6529, 521 }, { 0, 6532, 522 }, { 15560, 6558, -1 }, { 15561, 6560, -1 },
+    { 15562, 6553, -1 }, { 15560, 6563, -1 }, { 15565, 6536, -1 }, { 15565, 6547, -1 },
+    { 0, 6550, 530 }, { 0, 6542, 531 }, { 0, 6554, 532 }, { 0, 6559, 535 },
+    { 0, 6561, 536 }, { 0, 6566, 538 }, { 0, 6567, 539 }, { 0, 6562, 540 },
+    { 0, 6569, 542 }, { 0, 6572, 543 }, { 0, 6613, 544 }, { 0, 6568, 545 },
+    { 15568, 6570, -1 }, { 15566, 6571, -1 }, { 0, 6573, 557 }, { 0, 6574, 559 },
+    { 0, 6576, 560 }, { 0, 6579, 561 }, { 0, 6582, 562 }, { 0, 6583, 563 },
+    { 0, 6585, 565 }, { 0, 6586, 566 }, { 0, 6587, 567 }, { 0, 6616, 568 },
+    { 0, 6617, 573 }, { 0, 6620, 578 }, { 0, 6616, 569 }, { 0, 6618, 574 },
+    { 0, 6618, 575 }, { 0, 6623, 579 }, { 0, 6645, 580 }, { 0, 6648, 581 },
+    { 0, 6616, 570 }, { 0, 6561, 537 }, { 0, 6616, 571 }, { 0, 6650, 582 },
+    { 0, 6618, 576 }, { 0, 6653, 587 }, { 0, 6654, 590 }, { 0, 6655, 591 },
+    { 0, 6656, 592 }, { 0, 6653, 588 }, { 0, 6658, 593 }, { 0, 6662, 594 },
+    { 0, 6664, 595 }, { 0, 6667, 596 }, { 0, 6672, 597 }, { 0, 6673, 598 },
+    { 0, 6679, 599 }, { 0, 6616, 572 }, { 0, 6680, 600 }, { 0, 6681, 601 },
+    { 0, 6650, 583 }, { 0, 6683, 602 }, { 0, 6684, 603 }, { 0, 6685, 604 },
+    { 0, 6690, 605 }, { 0, 6703, 608 }, { 0, 6705, 609 }, { 0, 6668, 610 },
+    { 0, 6670, 611 }, { 0, 6689, 612 }, { 0, 6692, 613 }, { 0, 6693, 615 },
+    { 0, 6690, 606 }, { 0, 6694, 616 }, { 0, 6697, 617 }, { 0, 6701, 619 },
+    { 0, 6697, 618 }, { 0, 6650, 584 }, { 0, 6712, 621 }, { 0, 6650, 585 },
+    { 0, 6713, 622 }, { 0, 6714, 623 }, { 0, 6618, 577 }, { 0, 6653, 589 },
+    { 0, 6715, 624 }, { 0, 6716, 625 }, { 0, 6650, 586 }, { 0, 6718, 626 },
+    { 0, 6692, 614 }, { 15566, 6719, 627 }, { 0, 6724, 630 }, { 0, 6687, 631 },
+    { 0, 6699, 634 }, { 0, 6704, 635 }, { 0, 6726, 636 }, { 0, 6734, 637 },
+    { 0, 6743, 638 }, { 0, 6744, 639 }, { 0, 6745, 640 }, { 0, 6746, 641 },
+    { 0, 6720, 642 }, { 0, 6727, 643 }, { 0, 6733, 644 }, { 0, 6749, 645 },
+    { 0, 6753, 646 }, { 0, 6760, 647 }, { 0, 6764, 648 }, { 0, 6766, 649 },
+    { 0, 6729, 652 }, { 0, 6690, 607 }, { 0, 6776, 650 }, { 0, 6731, 653 },
+    { 0, 6747, 654 }, { 0, 6751, 656 }, { 0, 6747, 655 }, { 0, 6752, 657 },
+    { 0, 6719, 629 }, { 15568, 6755, 659 }, { 0, 6758, 662 }, { 0, 6755, 661 },
+    { 0, 6759, 663 }, { 15570, 6589, -1 }, { 0, 6590, 666 }, { 0, 6627, 667 },
+    { 15568, 6639, -1 }, { 15571, 6657, -1 }, { 0, 6701, 620 }, { 0, 6687, 632 },
+    { 0, 6687, 633 }, { 0, 6776, 651 }, { 0, 6678, 670 }, { 15574, 6591, -1 },
+    { 15575, 6593, -1 }, { 15577, 6629, -1 }, { 0, 6630, 674 }, { 0, 6631, 675 },
+    { 0, 6632, 676 }, { 0, 6759, 664 }, { 0, 6752, 658 }, { 0, 6599, 677 },
+    { 0, 6649, 678 }, { 0, 6595, 679 }, { 0, 6600, 680 }, { 0, 6609, 682 },
+    { 15576, 6610, -1 }, { 0, 6614, 684 }, { 0, 6619, 685 }, { 15579, 6624, -1 },
+    { 0, 6625, 687 }, { 0, 6633, 691 }, { 0, 6642, 698 }, { 0, 6686, 699 },
+    { 0, 6634, 700 }, { 0, 6641, 701 }, { 15578, 6643, -1 }, { 0, 6644, 703 },
+    { 0, 6646, 710 }, { 0, 6651, 711 }, { 15581, 6652, -1 }, { 15580, 6659, -1 },
+    { 0, 6661, 715 }, { 15582, 6663, -1 }, { 0, 6665, 717 }, { 15583, 6666, -1 },
+    { 0, 6669, 719 }, { 0, 6671, 720 }, { 0, 6674, 721 }, { 15585, 6711, -1 },
+    { 0, 6702, 723 }, { 0, 6721, 724 }, { 0, 6738, 725 }, { 0, 6682, 726 },
+    { 0, 6691, 727 }, { 15587, 6708, -1 }, { 0, 6675, 729 }, { 0, 6676, 730 },
+    { 0, 6677, 733 }, { 0, 6688, 734 }, { 0, 6695, 735 }, { 0, 6696, 736 },
+    { 0, 6698, 737 }, { 0, 6700, 738 }, { 0, 6707, 739 }, { 0, 6761, 740 },
+    { 15588, 6706, -1 }, { 0, 6709, 750 }, { 0, 6710, 751 }, { 15587, 6717, -1 },
+    { 15590, 6722, -1 }, { 15590, 6723, -1 }, { 0, 6725, 755 }, { 0, 6728, 756 },
+    { 15591, 6730, -1 }, { 0, 6732, 760 }, { 0, 6735, 761 }, { 0, 6736, 762 },
+    { 0, 6737, 763 }, { 0, 6739, 764 }, { 0, 6740, 765 }, { 15590, 6741, -1 },
+    { 15595, 6742, -1 }, { 0, 6770, 769 }, { 0, 6748, 770 }, { 0, 6763, 771 },
+    { 0, 6767, 772 }, { 0, 6784, 773 }, { 0, 6756, 774 }, { 0, 6765, 775 },
+    { 0, 6750, 776 }, { 0, 6754, 780 }, { 15595, 6775, -1 }, { 15593, 6757, -1 },
+    { 0, 6762, 783 }, { 0, 6768, 784 }, { 0, 6769, 785 }, { 0, 6771, 786 },
+    { 0, 6772, 787 }, { 0, 6773, 788 }, { 15594, 6803, -1 }, { 0, 6774, 790 },
+    { 0, 6777, 791 }, { 0, 6778, 792 }, { 0, 6780, 794 }, { 0, 6779, 795 },
+    { 0, 6822, 797 }, { 0, 6781, 798 }, { 0, 6782, 799 }, { 0, 6783, 800 },
+    { 0, 6791, 801 }, { 0, 6785, 802 }, { 0, 6786, 803 }, { 15599, 6787, -1 },
+    { 15601, 6788, -1 }, { 15599, 6789, 808 }, { 0, 6790, 811 }, { 15594, 6778, -1 },
+    { 0, 6792, 812 }, { 0, 6793, 813 }, { 0, 6794, 816 }, { 0, 6795, 818 },
+    { 0, 6796, 821 }, { 0, 6779, 796 }, { 0, 6807, 822 }, { 0, 6797, 823 },
+    { 0, 6798, 826 }, { 15602, 6799, -1 }, { 15603, 6800, -1 }, { 0, 6801, 832 },
+    { 0, 6845, 833 }, { 15604, 6802, -1 }, { 0, 6804, 835 }, { 0, 6805, 836 },
+    { 0, 6806, 837 }, { 15601, 6808, -1 }, { 15602, 6838, -1 }, { 15603, 6809, -1 },
+    { 0, 6842, 841 }, { 0, 6810, 844 }, { 0, 6810, 845 }, { 0, 6811, 846 },
+    { 0, 6816, 847 }, { 15608, 6817, 848 }, { 0, 6818, 851 }, { 0, 6818, 852 },
+    { 0, 6819, 853 }, { 0, 6821, 855 }, { 0, 6825, 858 }, { 0, 6826, 860 },
+    { 15605, 6840, -1 }, { 0, 6841, 862 }, { 0, 6843, 863 }, { 0, 6847, 864 },
+    { 15610, 6866, -1 }, { 0, 6874, 867 }, { 0, 6819, 854 }, { 0, 6820, 868 },
+    { 0, 6824, 869 }, { 0, 6827, 870 }, { 0, 6821, 856 }, { 0, 6835, 871 },
+    { 0, 6817, 850 }, { 0, 6857, 873 }, { 15606, 6847, -1 }, { 0, 6859, 874 },
+    { 0, 6869, 875 }, { 0, 6837, 876 }, { 0, 6860, 877 }, { 0, 6862, 878 },
+    { 0, 6821, 857 }, { 0, 6865, 879 }, { 0, 6873, 880 }, { 0, 6875, 881 },
+    { 0, 6891, 882 }, { 0, 6829, 883 }, { 0, 6844, 884 }, { 0, 6852, 885 },
+    { 0, 6833, 888 }, { 0, 6854, 886 }, { 0, 6846, 889 }, { 0, 6851, 890 },
+    { 0, 6861, 891 }, { 0, 6812, 893 }, { 0, 6813, 895 }, { 0, 6814, 896 },
+    { 0, 6815, 899 }, { 0, 6823, 900 }, { 15612, 6849, -1 }, { 0, 6853, 903 },
+    { 0, 6855, 904 }, { 0, 6856, 905 }, { 15613, 6849, -1 }, { 0, 6868, 906 },
+    { 15611, 6870, -1 }, { 15615, 6872, -1 }, { 0, 6825, 859 }, { 15616, 6889, -1 },
+    { 0, 6835, 872 }, { 0, 6854, 887 }, { 0, 6900, 911 }, { 0, 6910, 913 },
+    { 15617, 6921, -1 }, { 0, 6922, 915 }, { 0, 6924, 916 }, { 0, 6881, 917 },
+    { 0, 6883, 919 }, { 15619, 6892, -1 }, { 0, 6893, 922 }, { 0, 6894, 923 },
+    { 0, 6871, 925 }, { 0, 6895, 926 }, { 0, 6896, 927 }, { 0, 6902, 928 },
+    { 0, 6872, 909 }, { 0, 6927, 929 }, { 0, 6928, 930 }, { 0, 6831, 931 },
+    { 0, 6832, 932 }, { 15620, 6836, -1 }, { 0, 6828, 935 }, { 15621, 6830, -1 },
+    { 15619, 6834, -1 }, { 0, 6839, 941 }, { 0, 6848, 943 }, { 0, 6894, 924 },
+    { 15622, 6850, -1 }, { 0, 6858, 949 }, { 0, 6888, 950 }, { 0, 6898, 951 },
+    { 0, 6904, 952 }, { 0, 6908, 953 }, { 0, 6911, 954 }, { 0, 6913, 955 },
+    { 0, 6863, 956 }, { 15626, 6864, -1 }, { 15624, 6890, 961 }, { 15616, 6881, -1 },
+    { 0, 6897, 963 }, { 0, 6906, 965 }, { 0, 6867, 966 }, { 0, 6882, 968 },
+    { 0, 6899, 969 }, { 0, 6848, 944 }, { 0, 6917, 970 }, { 0, 6900, 912 },
+    { 15627, 6929, -1 }, { 0, 6936, 972 }, { 0, 6915, 973 }, { 0, 6916, 974 },
+    { 0, 6923, 975 }, { 0, 6943, 976 }, { 0, 6944, 977 }, { 0, 6947, 978 },
+    { 0, 6954, 979 }, { 0, 6960, 980 }, { 0, 6918, 983 }, { 0, 6919, 984 },
+    { 0, 6850, 946 }, { 0, 6920, 985 }, { 0, 6930, 986 }, { 0, 6935, 987 },
+    { 0, 6876, 988 }, { 15624, 6877, -1 }, { 0, 6897, 964 }, { 0, 6878, 990 },
+    { 0, 6932, 991 }, { 0, 6937, 992 }, { 0, 6960, 981 }, { 15627, 6938, -1 },
+    { 15626, 6941, -1 }, { 0, 6885, 995 }, { 0, 6933, 996 }, { 15631, 6879, -1 },
+    { 15630, 6880, -1 }, { 0, 6884, 1000 }, { 0, 6886, 1002 }, { 0, 6850, 947 },
+    { 0, 6887, 1003 }, { 15630, 6934, -1 }, { 15632, 6962, -1 }, { 15631, 6939, -1 },
+    { 15633, 6971, -1 }, { 0, 6901, 1010 }, { 0, 6850, 948 }, { 0, 6903, 1012 },
+    { 15637, 6905, -1 }, { 0, 6907, 1018 }, { 0, 6946, 1019 }, { 0, 6948, 1020 },
+    { 0, 6949, 1021 }, { 0, 6951, 1022 }, { 0, 6955, 1023 }, { 0, 6986, 1024 },
+    { 15639, 7003, -1 }, { 0, 6945, 1026 }, { 0, 6905, 1015 }, { 0, 6905, 1016 },
+    { 15641, 6963, -1 }, { 15638, 6905, -1 }, { 0, 6967, 1028 }, { 0, 6982, 1029 },
+    { 0, 6960, 982 }, { 0, 6939, 1007 }, { 0, 6909, 1030 }, { 0, 6926, 1031 },
+    { 0, 6952, 1032 }, { 0, 6953, 1033 }, { 0, 6977, 1034 }, { 0, 6997, 1035 },
+    { 0, 7007, 1037 }, { 15639, 6912, -1 }, { 15642, 6914, -1 }, { 15644, 6925, -1 },
+    { 15645, 6931, -1 }, { 0, 6940, 1046 }, { 0, 6997, 1036 }, { 15647, 6942, -1 },
+    { 0, 6950, 1048 }, { 0, 6956, 1050 }, { 0, 6957, 1051 }, { 0, 6958, 1053 },
+    { 15646, 6959, -1 }, { 0, 7002, 1056 }, { 0, 7004, 1057 }, { 0, 6966, 1058 },
+    { 0, 6968, 1059 }, { 0, 7005, 1060 }, { 0, 6961, 1061 }, { 0, 6964, 1062 },
+    { 0, 7007, 1038 }, { 0, 7019, 1063 }, { 0, 6965, 1065 }, { 0, 6969, 1066 },
+    { 0, 6983, 1067 }, { 0, 7031, 1068 }, { 0, 6970, 1069 }, { 0, 6972, 1070 },
+    { 0, 7022, 1071 }, { 0, 6973, 1073 }, { 0, 6981, 1074 }, { 0, 6975, 1075 },
+    { 0, 6978, 1076 }, { 0, 6980, 1077 }, { 0, 7006, 1078 }, { 0, 7022, 1072 },
+    { 0, 7011, 1079 }, { 0, 7014, 1081 }, { 0, 7020, 1082 }, { 0, 7024, 1083 },
+    { 0, 7032, 1084 }, { 0, 7041, 1085 }, { 0, 7067, 1086 }, { 0, 7011, 1080 },
+    { 0, 6984, 1087 }, { 0, 7027, 1088 }, { 0, 7029, 1089 }, { 0, 6994, 1090 },
+    { 0, 6994, 1091 }, { 0, 7012, 1092 }, { 0, 7025, 1093 }, { 0, 7030, 1094 },
+    { 0, 7036, 1095 }, { 0, 7043, 1096 }, { 0, 6976, 1097 }, { 0, 6996, 1098 },
+    { 0, 7008, 1099 }, { 0, 7026, 1100 }, { 0, 7037, 1101 }, { 0, 7038, 1102 },
+    { 0, 6974, 1104 }, { 15644, 6987, -1 }, { 15645, 7010, -1 }, { 0, 6979, 1107 },
+    { 0, 6985, 1112 }, { 0, 6988, 1113 }, { 0, 6989, 1114 }, { 0, 6990, 1115 },
+    { 0, 6991, 1116 }, { 15647, 6992, -1 }, { 0, 6993, 1121 }, { 0, 6995, 1123 },
+    { 0, 6998, 1124 }, { 15651, 6999, -1 }, { 0, 7009, 1126 }, { 0, 7055, 1127 },
+    { 0, 7000, 1128 }, { 15651, 7001, -1 }, { 15654, 7013, -1 }, { 15654, 7015, -1 },
+    { 0, 7016, 1132 }, { 15655, 7054, -1 }, { 15656, 7017, -1 }, { 0, 7018, 1137 },
+    { 0, 7021, 1138 }, { 0, 7023, 1139 }, { 0, 7028, 1143 }, { 0, 7033, 1144 },
+    { 15657, 7034, -1 }, { 0, 7035, 1150 }, { 0, 7039, 1152 }, { 0, 7040, 1153 },
+    { 0, 7042, 1154 }, { 0, 7044, 1155 }, { 0, 7045, 1156 }, { 15657, 7051, -1 },
+    { 15656, 7046, -1 }, { 0, 7047, 1160 }, { 0, 7098, 1161 }, { 0, 7048, 1162 },
+    { 0, 7049, 1163 }, { 0, 7050, 1164 }, { 15658, 7052, -1 }, { 0, 7075, 1167 },
+    { 0, 7053, 1168 }, { 0, 7056, 1170 }, { 0, 7057, 1174 }, { 15657, 7058, -1 },
+    { 0, 7059, 1176 }, { 0, 7060, 1177 }, { 0, 7068, 1178 }, { 0, 7061, 1179 },
+    { 0, 7062, 1180 }, { 0, 7064, 1181 }, { 15661, 7076, -1 }, { 0, 7063, 1184 },
+    { 15665, 7065, -1 }, { 0, 7066, 1186 }, { 0, 7077, 1187 }, { 0, 7069, 1188 },
+    { 0, 7070, 1189 }, { 15661, 7071, -1 }, { 0, 7072, 1192 }, { 0, 7073, 1195 },
+    { 0, 7074, 1196 }, { 15664, 7078, -1 }, { 0, 7079, 1199 }, { 15663, 7080, -1 },
+    { 15666, 7081, -1 }, { 15665, 7100, -1 }, { 0, 7104, 1204 }, { 0, 7082, 1205 },
+    { 0, 7083, 1206 }, { 0, 7084, 1207 }, { 0, 7085, 1208 }, { 15671, 7086, -1 },
+    { 0, 7087, 1210 }, { 0, 7088, 1211 }, { 0, 7089, 1212 }, { 0, 7090, 1227 },
+    { 0, 7093, 1233 }, { 0, 7089, 1213 }, { 0, 7094, 1234 }, { 15677, 7095, -1 },
+    { 0, 7094, 1235 }, { 0, 7089, 1214 }, { 0, 7096, 1238 }, { 0, 7089, 1215 },
+    { 15668, 7089, -1 }, { 0, 7089, 1217 }, { 0, 7091, 1228 }, { 15673, 7089, -1 },
+    { 15675, 7099, -1 }, { 0, 7103, 1240 }, { 0, 7103, 1241 }, { 0, 7108, 1247 },
+    { 0, 7091, 1229 }, { 0, 7106, 1245 }, { 0, 7108, 1248 }, { 0, 7110, 1249 },
+    { 15672, 7089, -1 }, { 0, 7112, 1256 }, { 0, 7114, 1260 }, { 15680, 7117, -1 },
+    { 0, 7091, 1230 }, { 0, 7113, 1258 }, { 0, 7089, 1221 }, { 0, 7111, 1250 },
+    { 0, 7121, 1262 }, { 0, 7111, 1251 }, { 0, 7125, 1263 }, { 0, 7135, 1271 },
+    { 15682, 7154, -1 }, { 15677, 7147, -1 }, { 0, 7089, 1222 }, { 0, 7146, 1272 },
+    { 0, 7111, 1252 }, { 0, 7146, 1273 }, { 15683, 7155, -1 }, { 0, 7156, 1280 },
+    { 0, 7089, 1223 }, { 0, 7160, 1282 }, { 0, 7130, 1284 }, { 0, 7089, 1224 },
+    { 0, 7147, 1276 }, { 0, 7103, 1242 }, { 0, 7143, 1285 }, { 0, 7126, 1265 },
+    { 0, 7103, 1243 }, { 0, 7111, 1253 }, { 0, 7103, 1244 }, { 0, 7113, 1259 },
+    { 0, 7144, 1286 }, { 0, 7134, 1268 }, { 15685, 7151, -1 }, { 0, 7126, 1266 },
+    { 0, 7089, 1225 }, { 0, 7089, 1226 }, { 0, 7111, 1254 }, { 0, 7106, 1246 },
+    { 0, 7152, 1288 }, { 15684, 7158, 1289 }, { 15676, 7091, -1 }, { 0, 7161, 1291 },
+    { 15680, 7125, -1 }, { 0, 7126, 1267 }, { 0, 7134, 1269 }, { 0, 7091, 1232 },
+    { 0, 7156, 1281 }, { 0, 7112, 1257 }, { 0, 7174, 1292 }, { 0, 7177, 1293 },
+    { 0, 7177, 1294 }, { 0, 7160, 1283 }, { 0, 7111, 1255 }, { 0, 7181, 1295 },
+    { 0, 7189, 1296 }, { 0, 7192, 1297 }, { 0, 7122, 1298 }, { 0, 7134, 1270 },
+    { 0, 7128, 1299 }, { 0, 7146, 1274 }, { 0, 7147, 1277 }, { 0, 7133, 1300 },
+    { 0, 7137, 1301 }, { 0, 7148, 1302 }, { 0, 7166, 1303 }, { 0, 7168, 1304 },
+    { 0, 7169, 1305 }, { 0, 7170, 1306 }, { 0, 7142, 1307 }, { 15686, 7149, -1 },
+    { 0, 7153, 1310 }, { 0, 7159, 1312 }, { 0, 7179, 1313 }, { 15686, 7195, -1 },
+    { 15685, 7196, -1 }, { 0, 7205, 1317 }, { 0, 7157, 1318 }, { 0, 7183, 1319 },
+    { 0, 7188, 1320 }, { 0, 7190, 1321 }, { 0, 7193, 1322 }, { 0, 7194, 1323 },
+    { 0, 7197, 1324 }, { 15688, 7199, -1 }, { 15691, 7092, -1 }, { 0, 7107, 1329 },
+    { 0, 7116, 1330 }, { 0, 7118, 1331 }, { 0, 7119, 1332 }, { 0, 7127, 1333 },
+    { 0, 7150, 1334 }, { 0, 7163, 1335 }, { 0, 7175, 1336 }, { 0, 7097, 1337 },
+    { 0, 7124, 1338 }, { 0, 7101, 1339 }, { 15691, 7102, -1 }, { 15688, 7105, -1 },
+    { 0, 7109, 1343 }, { 15691, 7115, -1 }, { 15692, 7120, -1 }, { 0, 7129, 1347 },
+    { 0, 7132, 1348 }, { 0, 7200, 1349 }, { 0, 7153, 1311 }, { 0, 7201, 1350 },
+    { 0, 7206, 1351 }, { 0, 7210, 1352 }, { 0, 7211, 1353 }, { 0, 7223, 1354 },
+    { 15691, 7224, -1 }, { 0, 7244, 1356 }, { 0, 7252, 1357 }, { 15693, 7259, -1 },
+    { 0, 7198, 1359 }, { 0, 7217, 1360 }, { 0, 7219, 1361 }, { 0, 7234, 1362 },
+    { 0, 7237, 1363 }, { 0, 7123, 1364 }, { 0, 7165, 1365 }, { 0, 7178, 1366 },
+    { 0, 7180, 1367 }, { 0, 7202, 1368 }, { 0, 7195, 1315 }, { 0, 7209, 1370 },
+    { 0, 7228, 1371 }, { 0, 7247, 1372 }, { 0, 7255, 1374 }, { 0, 7185, 1375 },
+    { 15696, 7204, -1 }, { 0, 7218, 1377 }, { 0, 7220, 1378 }, { 15695, 7202, -1 },
+    { 0, 7247, 1373 }, { 0, 7131, 1381 }, { 0, 7136, 1384 }, { 0, 7215, 1385 },
+    { 15695, 7225, -1 }, { 0, 7227, 1387 }, { 0, 7249, 1388 }, { 0, 7256, 1389 },
+    { 0, 7258, 1390 }, { 0, 7184, 1391 }, { 0, 7186, 1392 }, { 0, 7191, 1393 },
+    { 0, 7214, 1394 }, { 15701, 7138, -1 }, { 0, 7140, 1396 }, { 0, 7187, 1397 },
+    { 0, 7139, 1398 }, { 0, 7207, 1404 }, { 0, 7213, 1405 }, { 0, 7246, 1406 },
+    { 0, 7162, 1407 }, { 0, 7173, 1408 }, { 0, 7141, 1409 }, { 15697, 7145, -1 },
+    { 0, 7164, 1411 }, { 0, 7167, 1416 }, { 0, 7171, 1419 }, { 0, 7172, 1421 },
+    { 0, 7176, 1422 }, { 0, 7182, 1424 }, { 0, 7203, 1426 }, { 15700, 7208, -1 },
+    { 0, 7212, 1428 }, { 0, 7221, 1429 }, { 15703, 7251, 1430 }, { 0, 7216, 1432 },
+    { 15704, 7229, -1 }, { 0, 7230, 1438 }, { 15707, 7253, -1 }, { 0, 7260, 1440 },
+    { 0, 7261, 1441 }, { 0, 7265, 1442 }, { 0, 7278, 1443 }, { 0, 7284, 1444 },
+    { 0, 7286, 1445 }, { 0, 7287, 1446 }, { 0, 7297, 1447 }, { 15704, 7303, -1 },
+    { 0, 7304, 1449 }, { 0, 7305, 1450 }, { 0, 7306, 1451 }, { 0, 7307, 1452 },
+    { 0, 7308, 1453 }, { 0, 7254, 1455 }, { 0, 7271, 1456 }, { 0, 7229, 1436 },
+    { 0, 7274, 1457 }, { 15707, 7291, -1 }, { 15709, 7308, -1 }, { 0, 7292, 1459 },
+    { 0, 7302, 1460 }, { 0, 7294, 1461 }, { 0, 7309, 1462 }, { 0, 7313, 1463 },
+    { 15711, 7315, -1 }, { 0, 7322, 1465 }, { 0, 7328, 1466 }, { 0, 7329, 1467 },
+    { 0, 7342, 1468 }, { 0, 7343, 1469 }, { 0, 7345, 1470 }, { 0, 7267, 1471 },
+    { 0, 7268, 1472 }, { 0, 7269, 1473 }, { 0, 7280, 1474 }, { 0, 7283, 1475 },
+    { 0, 7293, 1476 }, { 15712, 7321, -1 }, { 0, 7327, 1478 }, { 0, 7330, 1479 },
+    { 0, 7333, 1481 }, { 0, 7337, 1482 }, { 0, 7339, 1483 }, { 0, 7340, 1484 },
+    { 15703, 7229, -1 }, { 0, 7341, 1485 }, { 0, 7349, 1486 }, { 0, 7355, 1487 },
+    { 0, 7356, 1488 }, { 0, 7222, 1489 }, { 0, 7226, 1490 }, { 0, 7231, 1492 },
+    { 0, 7232, 1493 }, { 0, 7233, 1494 }, { 0, 7330, 1480 }, { 0, 7235, 1497 },
+    { 15714, 7236, -1 }, { 0, 7239, 1499 }, { 0, 7250, 1500 }, { 15715, 7238, -1 },
+    { 15716, 7241, -1 }, { 0, 7242, 1503 }, { 15716, 7245, -1 }, { 15718, 7243, -1 },
+    { 0, 7264, 1506 }, { 15715, 7240, 1507 }, { 0, 7248, 1509 }, { 0, 7257, 1510 },
+    { 0, 7281, 1511 }, { 0, 7288, 1512 }, { 0, 7320, 1513 }, { 0, 7336, 1514 },
+    { 15715, 7262, -1 }, { 0, 7263, 1516 }, { 15718, 7272, -1 }, { 0, 7290, 1518 },
+    { 0, 7266, 1519 }, { 15721, 7270, -1 }, { 0, 7316, 1521 }, { 15722, 7273, -1 },
+    { 15723, 7275, -1 }, { 0, 7285, 1524 }, { 0, 7296, 1525 }, { 0, 7295, 1526 },
+    { 0, 7310, 1527 }, { 0, 7300, 1528 }, { 0, 7311, 1529 }, { 0, 7317, 1530 },
+    { 15725, 7276, -1 }, { 15728, 7277, -1 }, { 15726, 7298, -1 }, { 15727, 7346, -1 },
+    { 15730, 7279, -1 }, { 0, 7282, 1540 }, { 0, 7289, 1543 }, { 0, 7282, 1541 },
+    { 0, 7299, 1546 }, { 0, 7301, 1547 }, { 0, 7312, 1548 }, { 0, 7314, 1549 },
+    { 15731, 7318, -1 }, { 15733, 7319, -1 }, { 0, 7323, 1552 }, { 15729, 7372, -1 },
+    { 15733, 7325, -1 }, { 15733, 7338, -1 }, { 15733, 7324, -1 }, { 0, 7326, 1558 },
+    { 0, 7331, 1559 }, { 0, 7344, 1560 }, { 0, 7351, 1561 }, { 0, 7394, 1562 },
+    { 0, 7395, 1563 }, { 0, 7332, 1564 }, { 0, 7334, 1565 }, { 0, 7347, 1566 },
+    { 0, 7348, 1567 }, { 15734, 7350, -1 }, { 0, 7359, 1569 }, { 0, 7361, 1570 },
+    { 0, 7366, 1572 }, { 0, 7368, 1573 }, { 0, 7374, 1575 }, { 0, 7382, 1576 },
+    { 0, 7383, 1577 }, { 0, 7391, 1578 }, { 0, 7392, 1579 }, { 0, 7402, 1581 },
+    { 0, 7407, 1582 }, { 0, 7380, 1583 }, { 0, 7384, 1584 }, { 15737, 7386, 1585 },
+    { 15738, 7387, 1587 }, { 0, 7361, 1571 }, { 0, 7393, 1589 }, { 0, 7397, 1590 },
+    { 0, 7398, 1591 }, { 0, 7404, 1592 }, { 0, 7408, 1593 }, { 0, 7420, 1594 },
+    { 0, 7423, 1595 }, { 0, 7352, 1596 }, { 0, 7360, 1597 }, { 0, 7381, 1598 },
+    { 0, 7392, 1580 }, { 15741, 7358, -1 }, { 15742, 7362, -1 }, { 15742, 7363, -1 },
+    { 15744, 7364, -1 }, { 0, 7405, 1603 }, { 0, 7406, 1605 }, { 15742, 7410, -1 },
+    { 0, 7373, 1607 }, { 0, 7378, 1608 }, { 0, 7389, 1609 }, { 0, 7412, 1610 },
+    { 0, 7353, 1611 }, { 0, 7368, 1574 }, { 0, 7354, 1612 }, { 0, 7335, 1614 },
+    { 0, 7379, 1615 }, { 15743, 7385, -1 }, { 15747, 7388, -1 }, { 0, 7401, 1619 },
+    { 0, 7411, 1620 }, { 15746, 7419, -1 }, { 15747, 7430, -1 }, { 0, 7431, 1623 },
+    { 15750, 7357, -1 }, { 0, 7405, 1604 }, { 15751, 7376, -1 }, { 0, 7399, 1627 },
+    { 0, 7421, 1628 }, { 0, 7409, 1629 }, { 0, 7415, 1630 }, { 0, 7425, 1631 },
+    { 0, 7367, 1632 }, { 15754, 7403, -1 }, { 0, 7413, 1635 }, { 0, 7424, 1636 },
+    { 0, 7428, 1637 }, { 0, 7365, 1638 }, { 0, 7369, 1639 }, { 0, 7370, 1642 },
+    { 0, 7371, 1644 }, { 0, 7375, 1645 }, { 15755, 7377, -1 }, { 0, 7390, 1652 },
+    { 0, 7432, 1653 }, { 0, 7396, 1654 }, { 0, 7400, 1655 }, { 15758, 7414, -1 },
+    { 0, 7416, 1657 }, { 0, 7417, 1659 }, { 0, 7436, 1660 }, { 0, 7445, 1661 },
+    { 0, 7434, 1662 }, { 0, 7437, 1663 }, { 15758, 7440, -1 }, { 0, 7466, 1665 },
+    { 0, 7482, 1666 }, { 0, 7493, 1667 }, { 0, 7427, 1668 }, { 0, 7433, 1669 },
+    { 0, 7439, 1670 }, { 0, 7449, 1671 }, { 0, 7426, 1672 }, { 15756, 7429, -1 },
+    { 0, 7469, 1674 }, { 15760, 7418, -1 }, { 0, 7422, 1682 }, { 0, 7441, 1687 },
+    { 0, 7443, 1688 }, { 15759, 7485, -1 }, { 15762, 7435, -1 }, { 15764, 7462, 1691 },
+    { 0, 7438, 1693 }, { 15764, 7442, -1 }, { 0, 7474, 1695 }, { 0, 7444, 1696 },
+    { 15761, 7446, -1 }, { 0, 7447, 1702 }, { 15766, 7448, -1 }, { 0, 7450, 1704 },
+    { 15764, 7451, -1 }, { 0, 7452, 1706 }, { 0, 7456, 1707 }, { 0, 7457, 1708 },
+    { 15767, 7463, -1 }, { 0, 7467, 1710 }, { 0, 7497, 1711 }, { 0, 7501, 1712 },
+    { 0, 7459, 1713 }, { 0, 7498, 1714 }, { 0, 7499, 1715 }, { 0, 7502, 1716 },
+    { 0, 7503, 1717 }, { 0, 7505, 1718 }, { 0, 7507, 1719 }, { 0, 7416, 1658 },
+    { 0, 7511, 1720 }, { 15766, 7454, -1 }, { 0, 7468, 1722 }, { 0, 7491, 1723 },
+    { 0, 7492, 1724 }, { 0, 7458, 1725 }, { 15770, 7471, 1726 }, { 0, 7483, 1728 },
+    { 0, 7465, 1729 }, { 0, 7479, 1730 }, { 15768, 7486, -1 }, { 0, 7453, 1732 },
+    { 0, 7455, 1733 }, { 0, 7460, 1734 }, { 0, 7472, 1735 }, { 0, 7494, 1736 },
+    { 0, 7461, 1737 }, { 0, 7464, 1739 }, { 0, 7470, 1750 }, { 0, 7473, 1751 },
+    { 0, 7475, 1752 }, { 0, 7476, 1753 }, { 0, 7477, 1758 }, { 0, 7478, 1759 },
+    { 15769, 7480, -1 }, { 0, 7481, 1761 }, { 0, 7484, 1766 }, { 0, 7487, 1768 },
+    { 0, 7488, 1769 }, { 0, 7489, 1770 }, { 0, 7521, 1771 }, { 0, 7490, 1772 },
+    { 0, 7537, 1773 }, { 0, 7540, 1774 }, { 0, 7495, 1775 }, { 0, 7504, 1776 },
+    { 0, 7506, 1777 }, { 0, 7510, 1778 }, { 0, 7518, 1779 }, { 0, 7525, 1780 },
+    { 0, 7526, 1782 }, { 15770, 7496, -1 }, { 0, 7500, 1785 }, { 0, 7508, 1786 },
+    { 0, 7509, 1788 }, { 0, 7512, 1791 }, { 15773, 7513, -1 }, { 0, 7514, 1795 },
+    { 0, 7560, 1796 }, { 0, 7515, 1800 }, { 0, 7516, 1801 }, { 0, 7525, 1781 },
+    { 15775, 7517, -1 }, { 0, 7519, 1804 }, { 0, 7520, 1806 }, { 15774, 7522, -1 },
+    { 0, 7523, 1808 }, { 0, 7524, 1809 }, { 15778, 7527, 1810 }, { 15779, 7528, -1 },
+    { 0, 7535, 1813 }, { 0, 7529, 1814 }, { 15781, 7530, -1 }, { 15778, 7531, -1 },
+    { 15780, 7532, -1 }, { 0, 7541, 1819 }, { 0, 7543, 1820 }, { 0, 7546, 1821 },
+    { 0, 7555, 1822 }, { 0, 7586, 1823 }, { 15784, 7588, -1 }, { 0, 7533, 1825 },
+    { 0, 7534, 1826 }, { 0, 7564, 1827 }, { 0, 7567, 1828 }, { 0, 7536, 1829 },
+    { 0, 7551, 1830 }, { 15781, 7580, -1 }, { 0, 7581, 1832 }, { 0, 7585, 1833 },
+    { 0, 7538, 1834 }, { 0, 7549, 1835 }, { 0, 7583, 1836 }, { 0, 7591, 1837 },
+    { 0, 7597, 1838 }, { 15785, 7547, -1 }, { 0, 7548, 1840 }, { 0, 7554, 1841 },
+    { 0, 7557, 1842 }, { 15784, 7571, -1 }, { 0, 7578, 1844 }, { 0, 7582, 1845 },
+    { 0, 7539, 1847 }, { 15789, 7542, -1 }, { 0, 7544, 1850 }, { 0, 7545, 1851 },
+    { 0, 7553, 1852 }, { 15790, 7558, -1 }, { 0, 7550, 1855 }, { 0, 7552, 1856 },
+    { 0, 7556, 1860 }, { 15789, 7559, -1 }, { 0, 7561, 1863 }, { 0, 7562, 1864 },
+    { 0, 7563, 1866 }, { 0, 7565, 1867 }, { 0, 7566, 1869 }, { 15787, 7598, -1 },
+    { 0, 7568, 1871 }, { 0, 7569, 1872 }, { 0, 7570, 1873 }, { 0, 7572, 1874 },
+    { 0, 7573, 1876 }, { 15793, 7574, -1 }, { 15794, 7575, -1 }, { 15795, 7576, -1 },
+    { 0, 7584, 1880 }, { 15796, 7634, -1 }, { 0, 7577, 1886 }, { 15793, 7579, -1 },
+    { 0, 7599, 1888 }, { 0, 7587, 1889 }, { 0, 7589, 1890 }, { 0, 7590, 1893 },
+    { 15796, 7592, -1 }, { 0, 7608, 1896 }, { 0, 7593, 1897 }, { 0, 7594, 1903 },
+    { 15796, 7595, 1904 }, { 0, 7596, 1906 }, { 0, 7600, 1907 }, { 0, 7601, 1908 },
+    { 0, 7602, 1911 }, { 0, 7603, 1914 }, { 0, 7604, 1915 }, { 15800, 7605, -1 },
+    { 15801, 7606, -1 }, { 0, 7634, 1882 }, { 15802, 7607, -1 }, { 0, 7609, 1925 },
+    { 15802, 7610, -1 }, { 15803, 7611, -1 }, { 0, 7612, 1932 }, { 0, 7662, 1933 },
+    { 15803, 7613, -1 }, { 0, 7614, 1937 }, { 0, 7615, 1938 }, { 0, 7616, 1939 },
+    { 0, 7617, 1941 }, { 0, 7618, 1942 }, { 15806, 7619, -1 }, { 0, 7620, 1945 },
+    { 0, 7621, 1946 }, { 0, 7622, 1949 }, { 0, 7623, 1951 }, { 0, 7624, 1952 },
+    { 0, 7625, 1955 }, { 0, 7626, 1957 }, { 15806, 7627, -1 }, { 15809, 7628, -1 },
+    { 0, 7630, 1961 }, { 0, 7632, 1962 }, { 15807, 7635, -1 }, { 0, 7636, 1964 },
+    { 15811, 7637, -1 }, { 15812, 7638, -1 }, { 15808, 7628, -1 }, { 0, 7643, 1973 },
+    { 0, 7645, 1974 }, { 0, 7646, 1978 }, { 0, 7647, 1980 }, { 0, 7665, 1981 },
+    { 0, 7666, 1983 }, { 0, 7669, 1984 }, { 0, 7646, 1979 }, { 15814, 7645, -1 },
+    { 15812, 7675, -1 }, { 0, 7676, 1986 }, { 15816, 7677, -1 }, { 15814, 7687, -1 },
+    { 0, 7690, 1989 }, { 0, 7641, 1990 }, { 0, 7638, 1970 }, { 0, 7648, 1991 },
+    { 0, 7649, 1992 }, { 0, 7651, 1993 }, { 0, 7652, 1994 }, { 0, 7655, 1995 },
+    { 0, 7645, 1976 }, { 0, 7636, 1965 }, { 0, 7664, 1996 }, { 0, 7667, 1997 },
+    { 15816, 7672, -1 }, { 0, 7673, 1999 }, { 0, 7663, 2001 }, { 0, 7670, 2002 },
+    { 0, 7671, 2003 }, { 0, 7682, 2004 }, { 0, 7701, 2005 }, { 0, 7642, 2006 },
+    { 0, 7638, 1971 }, { 0, 7679, 2007 }, { 0, 7680, 2008 }, { 0, 7673, 2000 },
+    { 0, 7686, 2013 }, { 0, 7645, 1977 }, { 15816, 7695, -1 }, { 0, 7696, 2015 },
+    { 0, 7680, 2009 }, { 0, 7650, 2016 }, { 0, 7668, 2017 }, { 0, 7680, 2010 },
+    { 0, 7674, 2018 }, { 0, 7638, 1972 }, { 15822, 7629, -1 }, { 0, 7681, 2019 },
+    { 0, 7665, 1982 }, { 0, 7681, 2020 }, { 0, 7631, 2023 }, { 0, 7680, 2011 },
+    { 15819, 7653, -1 }, { 15820, 7656, -1 }, { 0, 7689, 2026 }, { 0, 7633, 2027 },
+    { 15826, 7685, -1 }, { 0, 7639, 2029 }, { 0, 7640, 2030 }, { 0, 7644, 2031 },
+    { 0, 7684, 2032 }, { 0, 7691, 2033 }, { 0, 7693, 2034 }, { 15823, 7654, -1 },
+    { 0, 7657, 2036 }, { 0, 7658, 2037 }, { 15827, 7659, -1 }, { 0, 7660, 2040 },
+    { 0, 7697, 2041 }, { 0, 7698, 2042 }, { 0, 7700, 2043 }, { 15825, 7713, -1 },
+    { 0, 7740, 2046 }, { 15829, 7702, -1 }, { 15831, 7703, -1 }, { 15832, 7717, -1 },
+    { 0, 7720, 2050 }, { 15829, 7721, -1 }, { 15834, 7688, -1 }, { 15835, 7692, -1 },
+    { 15832, 7709, -1 }, { 0, 7694, 2055 }, { 15837, 7699, -1 }, { 15834, 7706, -1 },
+    { 0, 7719, 2058 }, { 0, 7705, 2059 }, { 0, 7707, 2060 }, { 15839, 7714, -1 },
+    { 0, 7723, 2062 }, { 0, 7725, 2063 }, { 15841, 7737, -1 }, { 15839, 7766, -1 },
+    { 0, 7680, 2012 }, { 15842, 7661, -1 }, { 0, 7678, 2069 }, { 15843, 7704, -1 },
+    { 0, 7712, 2071 }, { 0, 7683, 2072 }, { 0, 7708, 2074 }, { 15844, 7748, -1 },
+    { 0, 7710, 2076 }, { 0, 7716, 2078 }, { 0, 7718, 2079 }, { 0, 7711, 2080 },
+    { 15827, 7700, -1 }, { 15844, 7742, -1 }, { 0, 7745, 2083 }, { 0, 7752, 2084 },
+    { 0, 7715, 2085 }, { 0, 7726, 2086 }, { 0, 7727, 2087 }, { 0, 7722, 2088 },
+    { 0, 7765, 2089 }, { 0, 7771, 2090 }, { 0, 7724, 2093 }, { 0, 7728, 2096 },
+    { 0, 7729, 2097 }, { 0, 7730, 2099 }, { 0, 7731, 2100 }, { 0, 7732, 2102 },
+    { 0, 7733, 2104 }, { 0, 7734, 2105 }, { 0, 7736, 2106 }, { 0, 7735, 2107 },
+    { 0, 7739, 2108 }, { 0, 7741, 2109 }, { 0, 7749, 2110 }, { 0, 7738, 2111 },
+    { 0, 7764, 2112 }, { 0, 7784, 2113 }, { 0, 7790, 2114 }, { 0, 7744, 2115 },
+    { 0, 7791, 2116 }, { 0, 7743, 2117 }, { 15848, 7746, -1 }, { 15847, 7742, -1 },
+    { 0, 7747, 2119 }, { 0, 7753, 2120 }, { 0, 7763, 2121 }, { 15850, 7782, -1 },
+    { 0, 7793, 2123 }, { 0, 7750, 2124 }, { 0, 7751, 2125 }, { 15850, 7754, -1 },
+    { 15852, 7755, -1 }, { 0, 7756, 2131 }, { 0, 7757, 2132 }, { 0, 7758, 2136 },
+    { 0, 7759, 2138 }, { 15851, 7767, -1 }, { 15850, 7769, -1 }, { 0, 7773, 2141 },
+    { 0, 7778, 2142 }, { 0, 7792, 2143 }, { 0, 7794, 2144 }, { 0, 7760, 2146 },
+    { 0, 7802, 2147 }, { 15851, 7762, -1 }, { 0, 7774, 2149 }, { 0, 7781, 2150 },
+    { 0, 7761, 2151 }, { 0, 7783, 2152 }, { 0, 7768, 2154 }, { 0, 7770, 2162 },
+    { 0, 7772, 2164 }, { 0, 7775, 2169 }, { 15851, 7805, -1 }, { 0, 7776, 2174 },
+    { 0, 7777, 2175 }, { 0, 7779, 2176 }, { 15857, 7785, -1 }, { 0, 7786, 2179 },
+    { 0, 7780, 2180 }, { 15854, 7787, -1 }, { 0, 7788, 2182 }, { 0, 7789, 2185 },
+    { 15858, 7795, -1 }, { 15855, 7796, -1 }, { 15857, 7797, -1 }, { 15858, 7798, -1 },
+    { 15858, 7799, -1 }, { 0, 7800, 2193 }, { 15864, 7814, -1 }, { 0, 7844, 2195 },
+    { 0, 7803, 2196 }, { 0, 7804, 2197 }, { 0, 7801, 2198 }, { 0, 7806, 2200 },
+    { 0, 7850, 2201 }, { 0, 7794, 2145 }, { 15864, 7807, -1 }, { 0, 7808, 2204 },
+    { 0, 7809, 2207 }, { 0, 7810, 2208 }, { 0, 7811, 2211 }, { 0, 7812, 2212 },
+    { 0, 7813, 2213 }, { 0, 7816, 2214 }, { 0, 7817, 2215 }, { 0, 7820, 2216 },
+    { 0, 7815, 2217 }, { 0, 7868, 2218 }, { 0, 7818, 2219 }, { 0, 7819, 2220 },
+    { 0, 7821, 2222 }, { 15864, 7822, -1 }, { 0, 7823, 2224 }, { 0, 7824, 2226 },
+    { 0, 7825, 2227 }, { 0, 7826, 2228 }, { 0, 7827, 2229 }, { 0, 7828, 2230 },
+    { 15862, 7829, -1 }, { 0, 7830, 2232 }, { 0, 7831, 2234 }, { 0, 7832, 2235 },
+    { 0, 7833, 2236 }, { 15867, 7834, -1 }, { 15865, 7835, 2239 }, { 0, 7836, 2242 },
+    { 0, 7837, 2243 }, { 0, 7838, 2244 }, { 0, 7839, 2247 }, { 0, 7840, 2249 },
+    { 0, 7841, 2250 }, { 15866, 7842, -1 }, { 0, 7843, 2252 }, { 0, 7845, 2254 },
+    { 0, 7846, 2255 }, { 0, 7847, 2256 }, { 15871, 7848, -1 }, { 0, 7849, 2259 },
+    { 0, 7857, 2260 }, { 15868, 7872, -1 }, { 15869, 7851, -1 }, { 0, 7852, 2263 },
+    { 0, 7853, 2264 }, { 15874, 7854, -1 }, { 15875, 7855, -1 }, { 0, 7856, 2271 },
+    { 0, 7858, 2272 }, { 15874, 7859, -1 }, { 0, 7860, 2276 }, { 15878, 7901, -1 },
+    { 15879, 7912, -1 }, { 0, 7861, 2279 }, { 0, 7862, 2280 }, { 15877, 7885, -1 },
+    { 15878, 7886, -1 }, { 0, 7863, 2283 }, { 0, 7904, 2284 }, { 15879, 7864, -1 },
+    { 0, 7875, 2286 }, { 0, 7866, 2288 }, { 0, 7871, 2290 }, { 15880, 7876, -1 },
+    { 0, 7909, 2292 }, { 0, 7924, 2293 }, { 0, 7869, 2294 }, { 0, 7870, 2295 },
+    { 0, 7865, 2296 }, { 0, 7867, 2297 }, { 15884, 7874, -1 }, { 0, 7873, 2299 },
+    { 15885, 7877, -1 }, { 15882, 7878, -1 }, { 0, 7879, 2305 }, { 0, 7880, 2306 },
+    { 0, 7881, 2308 }, { 15887, 7882, -1 }, { 0, 7883, 2312 }, { 0, 7884, 2313 },
+    { 0, 7887, 2314 }, { 15884, 7889, -1 }, { 0, 7895, 2316 }, { 0, 7890, 2317 },
+    { 0, 7891, 2318 }, { 15885, 7908, -1 }, { 0, 7847, 2257 }, { 15887, 7888, -1 },
+    { 0, 7892, 2321 }, { 0, 7893, 2322 }, { 15890, 7893, -1 }, { 15893, 7894, -1 },
+    { 0, 7896, 2335 }, { 0, 7897, 2336 }, { 0, 7898, 2337 }, { 0, 7899, 2344 },
+    { 0, 7900, 2345 }, { 0, 7902, 2348 }, { 0, 7903, 2352 }, { 0, 7905, 2354 },
+    { 0, 7906, 2355 }, { 0, 7907, 2356 }, { 0, 7910, 2357 }, { 15893, 7911, -1 },
+    { 0, 7913, 2359 }, { 0, 7956, 2360 }, { 0, 7914, 2363 }, { 15881, 7866, -1 },
+    { 15894, 7915, -1 }, { 0, 7916, 2365 }, { 0, 7917, 2367 }, { 0, 7918, 2368 },
+    { 0, 7919, 2369 }, { 0, 7920, 2370 }, { 15891, 7921, 2371 }, { 0, 7922, 2373 },
+    { 15896, 7948, -1 }, { 0, 7923, 2381 }, { 15896, 7925, -1 }, { 0, 7926, 2386 },
+    { 0, 7937, 2387 }, { 15901, 7927, -1 }, { 15903, 7928, -1 }, { 0, 7975, 2392 },
+    { 0, 7929, 2394 }, { 0, 7930, 2396 }, { 0, 7931, 2402 }, { 15903, 7931, -1 },
+    { 0, 7932, 2409 }, { 15905, 7931, -1 }, { 15908, 7934, -1 }, { 0, 7933, 2411 },
+    { 0, 7938, 2419 }, { 0, 7941, 2422 }, { 0, 7940, 2420 }, { 0, 7942, 2424 },
+    { 0, 7933, 2412 }, { 15909, 7943, -1 }, { 0, 7947, 2430 }, { 0, 7944, 2427 },
+    { 0, 7932, 2410 }, { 0, 7940, 2421 }, { 0, 7941, 2423 }, { 0, 7949, 2431 },
+    { 15909, 7950, -1 }, { 0, 7931, 2406 }, { 0, 7933, 2413 }, { 0, 7952, 2438 },
+    { 0, 7951, 2436 }, { 0, 7950, 2434 }, { 0, 7949, 2432 }, { 0, 7951, 2437 },
+    { 0, 7933, 2414 }, { 0, 7953, 2441 }, { 0, 7954, 2444 }, { 0, 7955, 2445 },
+    { 0, 7958, 2447 }, { 0, 7950, 2435 }, { 15905, 7931, 2407 }, { 15910, 7944, 2428 },
+    { 0, 7960, 2448 }, { 15913, 7961, -1 }, { 15912, 7962, -1 }, { 0, 7970, 2455 },
+    { 0, 7933, 2415 }, { 0, 7971, 2456 }, { 15914, 7971, -1 }, { 15915, 7963, -1 },
+    { 0, 7972, 2458 }, { 0, 7953, 2442 }, { 0, 7974, 2462 }, { 0, 7973, 2460 },
+    { 0, 7979, 2463 }, { 0, 7980, 2465 }, { 0, 7982, 2467 }, { 0, 7933, 2416 },
+    { 15915, 7983, -1 }, { 0, 7953, 2443 }, { 0, 7955, 2446 }, { 0, 7989, 2470 },
+    { 15917, 7991, 2471 }, { 15906, 7942, -1 }, { 0, 7963, 2453 }, { 0, 7933, 2417 },
+    { 0, 7994, 2473 }, { 0, 7995, 2475 }, { 0, 7952, 2439 }, { 0, 7996, 2476 },
+    { 0, 7963, 2454 }, { 0, 7973, 2461 }, { 0, 7988, 2477 }, { 0, 7979, 2464 },
+    { 15917, 7988, 2478 }, { 0, 7997, 2480 }, { 0, 7998, 2482 }, { 0, 8002, 2483 },
+    { 0, 7952, 2440 }, { 15920, 8006, -1 }, { 0, 8007, 2487 }, { 15915, 7997, -1 },
+    { 0, 7994, 2474 }, { 15922, 8008, -1 }, { 15922, 8006, -1 }, { 0, 8010, 2490 },
+    { 0, 7962, 2451 }, { 0, 8011, 2491 }, { 0, 8014, 2492 }, { 0, 8017, 2493 },
+    { 15923, 8017, -1 }, { 0, 8018, 2496 }, { 0, 8019, 2498 }, { 0, 8020, 2499 },
+    { 0, 8022, 2500 }, { 0, 8033, 2501 }, { 0, 8037, 2502 }, { 0, 7980, 2466 },
+    { 0, 8038, 2503 }, { 0, 7972, 2459 }, { 0, 8038, 2504 }, { 0, 8040, 2505 },
+    { 0, 8002, 2484 }, { 0, 8041, 2507 }, { 0, 8042, 2509 }, { 0, 8044, 2511 },
+    { 0, 7982, 2468 }, { 0, 8045, 2513 }, { 0, 8048, 2514 }, { 15923, 8047, -1 },
+    { 0, 8018, 2497 }, { 0, 8049, 2516 }, { 0, 8052, 2517 }, { 0, 8053, 2519 },
+    { 0, 8055, 2524 }, { 15926, 8062, -1 }, { 0, 8041, 2508 }, { 0, 8052, 2518 },
+    { 0, 8067, 2531 }, { 0, 8042, 2510 }, { 0, 8017, 2495 }, { 15927, 8054, -1 },
+    { 15929, 8066, -1 }, { 0, 8054, 2521 }, { 0, 8054, 2522 }, { 0, 8044, 2512 },
+    { 0, 8068, 2532 }, { 15929, 8066, -1 }, { 0, 8054, 2523 }, { 0, 8070, 2533 },
+    { 0, 8071, 2536 }, { 15931, 8072, 2538 }, { 0, 8074, 2540 }, { 0, 8070, 2534 },
+    { 15931, 8075, 2541 }, { 15931, 8076, -1 }, { 0, 8082, 2544 }, { 0, 8040, 2506 },
+    { 0, 8086, 2545 }, { 0, 8090, 2546 }, { 0, 8091, 2547 }, { 15932, 8093, -1 },
+    { 0, 8096, 2549 }, { 0, 8097, 2551 }, { 0, 8066, 2529 }, { 15932, 8098, -1 },
+    { 0, 8104, 2554 }, { 0, 8105, 2556 }, { 0, 8106, 2560 }, { 0, 8066, 2530 },
+    { 15933, 8105, -1 }, { 15937, 8108, -1 }, { 0, 8099, 2562 }, { 0, 8070, 2535 },
+    { 15936, 8101, -1 }, { 0, 8103, 2566 }, { 15930, 8071, -1 }, { 0, 8109, 2567 },
+    { 0, 8110, 2568 }, { 0, 8104, 2555 }, { 15936, 8111, -1 }, { 0, 8112, 2571 },
+    { 0, 8114, 2572 }, { 0, 8105, 2558 }, { 15939, 8115, -1 }, { 0, 8121, 2575 },
+    { 0, 8124, 2576 }, { 0, 8126, 2577 }, { 15941, 8132, -1 }, { 0, 8134, 2580 },
+    { 0, 8144, 2581 }, { 0, 8151, 2582 }, { 15942, 8152, -1 }, { 0, 8154, 2585 },
+    { 15936, 8111, -1 }, { 0, 8157, 2586 }, { 15945, 8162, -1 }, { 0, 8140, 2589 },
+    { 0, 8101, 2564 }, { 0, 8096, 2550 }, { 0, 8141, 2590 }, { 0, 8151, 2583 },
+    { 0, 8101, 2565 }, { 0, 8143, 2591 }, { 0, 8146, 2594 }, { 0, 8145, 2592 },
+    { 15946, 8164, -1 }, { 0, 8147, 2595 }, { 0, 8115, 2574 }, { 0, 8147, 2596 },
+    { 0, 8166, 2598 }, { 0, 8167, 2599 }, { 15949, 8168, -1 }, { 0, 8169, 2601 },
+    { 0, 8174, 2603 }, { 0, 8097, 2552 }, { 15944, 8145, -1 }, { 0, 8177, 2604 },
+    { 0, 8178, 2605 }, { 0, 8105, 2559 }, { 15949, 8169, -1 }, { 0, 8189, 2607 },
+    { 0, 8190, 2608 }, { 0, 8132, 2579 }, { 0, 7935, 2609 }, { 15950, 7936, -1 },
+    { 15947, 7939, -1 }, { 0, 8178, 2606 }, { 0, 7945, 2612 }, { 0, 7946, 2613 },
+    { 0, 7957, 2614 }, { 15953, 7964, -1 }, { 0, 7966, 2619 }, { 0, 8120, 2620 },
+    { 0, 8123, 2622 }, { 0, 8125, 2623 }, { 15954, 8130, -1 }, { 0, 8131, 2629 },
+    { 15957, 8160, -1 }, { 0, 8170, 2634 }, { 0, 8176, 2635 }, { 0, 7987, 2636 },
+    { 0, 8131, 2630 }, { 15957, 7999, -1 }, { 15961, 8003, -1 }, { 0, 8009, 2639 },
+    { 0, 8029, 2640 }, { 0, 7967, 2641 }, { 0, 8005, 2642 }, { 0, 8024, 2643 },
+    { 0, 8027, 2644 }, { 0, 8130, 2628 }, { 15962, 7965, -1 }, { 0, 8015, 2646 },
+    { 0, 8026, 2647 }, { 0, 7959, 2648 }, { 0, 8120, 2621 }, { 0, 7976, 2649 },
+    { 0, 8021, 2650 }, { 15958, 8131, 2631 }, { 0, 8061, 2651 }, { 0, 8073, 2652 },
+    { 15960, 7968, -1 }, { 0, 7969, 2655 }, { 0, 7977, 2656 }, { 0, 7978, 2657 },
+    { 0, 7981, 2658 }, { 0, 8142, 2661 }, { 0, 8153, 2662 }, { 0, 8163, 2664 },
+    { 15960, 8171, -1 }, { 0, 8181, 2666 }, { 0, 8182, 2667 }, { 0, 8000, 2669 },
+    { 0, 8013, 2671 }, { 0, 7984, 2672 }, { 0, 8004, 2673 }, { 15962, 7986, -1 },
+    { 0, 8025, 2675 }, { 0, 8016, 2676 }, { 0, 8016, 2677 }, { 0, 8000, 2670 },
+    { 0, 8034, 2678 }, { 0, 8051, 2679 }, { 0, 8153, 2663 }, { 0, 7990, 2681 },
+    { 0, 7992, 2682 }, { 15966, 7993, -1 }, { 0, 8050, 2688 }, { 15954, 7964, -1 },
+    { 0, 7985, 2689 }, { 0, 8001, 2690 }, { 0, 8182, 2668 }, { 0, 7981, 2659 },
+    { 0, 8012, 2692 }, { 0, 8023, 2693 }, { 0, 8028, 2696 }, { 0, 8030, 2697 },
+    { 0, 8031, 2698 }, { 0, 8032, 2699 }, { 0, 8035, 2701 }, { 0, 8043, 2703 },
+    { 0, 8046, 2704 }, { 0, 8089, 2705 }, { 0, 8036, 2706 }, { 0, 8085, 2707 },
+    { 0, 8039, 2708 }, { 0, 8056, 2711 }, { 0, 8057, 2712 }, { 0, 8058, 2713 },
+    { 0, 8059, 2714 }, { 0, 8060, 2715 }, { 15967, 8063, -1 }, { 0, 8064, 2718 },
+    { 0, 8065, 2719 }, { 0, 7981, 2660 }, { 15969, 8077, -1 }, { 15970, 8078, -1 },
+    { 0, 8069, 2723 }, { 15966, 8081, -1 }, { 0, 8092, 2726 }, { 15969, 8079, 2727 },
+    { 15973, 8080, -1 }, { 15973, 8083, -1 }, { 15974, 8084, -1 }, { 0, 8087, 2735 },
+    { 0, 8094, 2737 }, { 0, 8118, 2738 }, { 0, 8138, 2739 }, { 0, 8088, 2741 },
+    { 0, 8095, 2742 }, { 0, 8102, 2744 }, { 0, 8116, 2745 }, { 0, 8156, 2746 },
+    { 0, 8100, 2747 }, { 0, 8107, 2749 }, { 0, 8113, 2750 }, { 15975, 8117, -1 },
+    { 15974, 8165, -1 }, { 0, 8119, 2754 }, { 0, 8127, 2755 }, { 0, 8150, 2756 },
+    { 15976, 8148, -1 }, { 0, 8155, 2758 }, { 0, 8197, 2759 }, { 0, 8198, 2760 },
+    { 0, 8133, 2761 }, { 0, 8158, 2762 }, { 15977, 8122, -1 }, { 0, 8128, 2764 },
+    { 15979, 8129, -1 }, { 0, 8135, 2767 }, { 15978, 8136, -1 }, { 0, 8137, 2769 },
+    { 0, 8179, 2770 }, { 0, 8180, 2771 }, { 0, 8184, 2772 }, { 0, 8188, 2773 },
+    { 0, 8193, 2774 }, { 0, 8196, 2776 }, { 0, 8199, 2777 }, { 0, 8201, 2778 },
+    { 0, 8203, 2779 }, { 15978, 8204, -1 }, { 0, 8206, 2785 }, { 0, 8204, 2783 },
+    { 0, 8216, 2786 }, { 0, 8223, 2787 }, { 0, 8203, 2780 }, { 0, 8229, 2788 },
+    { 0, 8234, 2789 }, { 0, 8246, 2790 }, { 0, 8248, 2791 }, { 0, 8250, 2792 },
+    { 0, 8191, 2793 }, { 0, 8200, 2794 }, { 0, 8202, 2795 }, { 0, 8211, 2796 },
+    { 0, 8212, 2797 }, { 0, 8213, 2798 }, { 0, 8240, 2799 }, { 0, 8175, 2800 },
+    { 0, 8185, 2801 }, { 0, 8205, 2802 }, { 0, 8210, 2804 }, { 0, 8224, 2805 },
+    { 0, 8207, 2806 }, { 0, 8252, 2807 }, { 0, 8253, 2808 }, { 0, 8254, 2809 },
+    { 0, 8255, 2810 }, { 0, 8258, 2811 }, { 0, 8267, 2812 }, { 0, 8268, 2813 },
+    { 0, 8269, 2814 }, { 0, 8203, 2781 }, { 0, 8195, 2815 }, { 0, 8204, 2784 },
+    { 0, 8222, 2817 }, { 15982, 8230, -1 }, { 0, 8237, 2819 }, { 0, 8139, 2821 },
+    { 0, 8159, 2822 }, { 0, 8195, 2816 }, { 0, 8209, 2823 }, { 0, 8193, 2775 },
+    { 15983, 8149, -1 }, { 0, 8161, 2825 }, { 15982, 8172, -1 }, { 15985, 8173, -1 },
+    { 0, 8183, 2829 }, { 0, 8186, 2830 }, { 0, 8187, 2832 }, { 0, 8192, 2833 },
+    { 0, 8194, 2834 }, { 0, 8208, 2835 }, { 15987, 8214, -1 }, { 0, 8215, 2947 },
+    { 15988, 8217, 2949 }, { 15993, 8231, -1 }, { 0, 8218, 2954 }, { 0, 8221, 2955 },
+    { 0, 8186, 2831 }, { 0, 8257, 2956 }, { 0, 8259, 2957 }, { 0, 8219, 2958 },
+    { 15994, 8220, 2959 }, { 0, 8225, 2961 }, { 0, 8226, 2963 }, { 15995, 8227, -1 },
+    { 0, 8228, 2965 }, { 0, 8215, 2948 }, { 0, 8205, 2803 }, { 0, 8279, 2966 },
+    { 0, 8232, 2969 }, { 0, 8233, 2970 }, { 0, 8244, 2971 }, { 15994, 8235, 2978 },
+    { 15997, 8236, -1 }, { 15997, 8238, -1 }, { 15996, 8239, -1 }, { 0, 8241, 2984 },
+    { 0, 8242, 2985 }, { 15999, 8243, -1 }, { 0, 8245, 2987 }, { 0, 8247, 2991 },
+    { 16002, 8249, -1 }, { 0, 8251, 2995 }, { 16003, 8256, -1 }, { 16001, 8260, -1 },
+    { 0, 8261, 2998 }, { 0, 8262, 2999 }, { 0, 8263, 3001 }, { 0, 8264, 3003 },
+    { 0, 8265, 3004 }, { 16005, 8266, -1 }, { 0, 8270, 3012 }, { 0, 8271, 3013 },
+    { 16002, 8272, -1 }, { 0, 8326, 3015 }, { 0, 8273, 3016 }, { 16006, 8274, -1 },
+    { 0, 8275, 3021 }, { 16006, 8276, -1 }, { 0, 8277, 3023 }, { 0, 8278, 3026 },
+    { 0, 8280, 3027 }, { 0, 8281, 3028 }, { 0, 8282, 3029 }, { 0, 8283, 3030 },
+    { 0, 8284, 3032 }, { 0, 8285, 3033 }, { 16008, 8286, -1 }, { 0, 8287, 3043 },
+    { 0, 8288, 3044 }, { 16009, 8289, -1 }, { 0, 8297, 3046 }, { 16010, 8320, -1 },
+    { 0, 8290, 3048 }, { 16008, 8291, -1 }, { 0, 8292, 3054 }, { 16011, 8293, -1 },
+    { 16012, 8294, -1 }, { 0, 8295, 3058 }, { 0, 8296, 3062 }, { 0, 8298, 3063 },
+    { 16014, 8299, -1 }, { 0, 8300, 3068 }, { 0, 8301, 3069 }, { 16015, 8302, -1 },
+    { 16015, 8303, -1 }, { 0, 8304, 3074 }, { 0, 8314, 3075 }, { 0, 8305, 3076 },
+    { 0, 8306, 3078 }, { 16017, 8307, -1 }, { 0, 8308, 3081 }, { 0, 8309, 3083 },
+    { 16019, 8310, 3084 }, { 0, 8311, 3086 }, { 0, 8312, 3087 }, { 16016, 8313, -1 },
+    { 16019, 8315, -1 }, { 16020, 8342, -1 }, { 0, 8316, 3091 }, { 0, 8335, 3092 },
+    { 0, 8317, 3093 }, { 16022, 8318, 3094 }, { 16023, 8319, -1 }, { 0, 8322, 3097 },
+    { 0, 8371, 3098 }, { 16025, 8376, -1 }, { 0, 8321, 3100 }, { 0, 8323, 3101 },
+    { 0, 8323, 3102 }, { 0, 8324, 3103 }, { 0, 8334, 3104 }, { 0, 8343, 3105 },
+    { 0, 8344, 3106 }, { 16025, 8353, -1 }, { 0, 8325, 3108 }, { 0, 8349, 3109 },
+    { 0, 8327, 3110 }, { 0, 8329, 3111 }, { 0, 8341, 3112 }, { 0, 8360, 3113 },
+    { 0, 8372, 3114 }, { 0, 8378, 3115 }, { 0, 8328, 3116 }, { 16025, 8330, -1 },
+    { 16027, 8331, 3119 }, { 0, 8333, 3121 }, { 0, 8336, 3122 }, { 16028, 8339, -1 },
+    { 16025, 8345, -1 }, { 0, 8348, 3125 }, { 16030, 8389, 3126 }, { 0, 8340, 3129 },
+    { 0, 8351, 3130 }, { 16027, 8332, -1 }, { 0, 8389, 3128 }, { 0, 8347, 3132 },
+    { 16032, 8354, -1 }, { 0, 8337, 3134 }, { 0, 8355, 3135 }, { 0, 8356, 3136 },
+    { 0, 8357, 3140 }, { 16032, 8350, -1 }, { 0, 8359, 3142 }, { 16031, 8361, -1 },
+    { 0, 8356, 3137 }, { 0, 8362, 3144 }, { 0, 8363, 3145 }, { 0, 8364, 3146 },
+    { 0, 8382, 3147 }, { 0, 8391, 3148 }, { 0, 8404, 3149 }, { 0, 8352, 3150 },
+    { 0, 8365, 3151 }, { 0, 8366, 3152 }, { 0, 8367, 3153 }, { 0, 8390, 3154 },
+    { 0, 8370, 3155 }, { 0, 8377, 3156 }, { 0, 8388, 3157 }, { 0, 8392, 3158 },
+    { 0, 8338, 3161 }, { 0, 8393, 3159 }, { 16034, 8346, -1 }, { 0, 8358, 3163 },
+    { 0, 8368, 3168 }, { 0, 8369, 3170 }, { 16036, 8373, -1 }, { 0, 8374, 3173 },
+    { 0, 8379, 3174 }, { 0, 8356, 3138 }, { 0, 8393, 3160 }, { 0, 8408, 3175 },
+    { 0, 8375, 3176 }, { 0, 8380, 3177 }, { 0, 8381, 3178 }, { 0, 8383, 3179 },
+    { 0, 8384, 3180 }, { 0, 8385, 3181 }, { 0, 8386, 3182 }, { 16034, 8387, -1 },
+    { 0, 8394, 3184 }, { 0, 8396, 3185 }, { 0, 8405, 3186 }, { 0, 8406, 3187 },
+    { 0, 8427, 3188 }, { 0, 8435, 3189 }, { 0, 8438, 3190 }, { 0, 8395, 3191 },
+    { 0, 8420, 3192 }, { 0, 8422, 3193 }, { 0, 8397, 3194 }, { 0, 8356, 3139 },
+    { 0, 8421, 3195 }, { 0, 8432, 3196 }, { 0, 8398, 3197 }, { 0, 8399, 3204 },
+    { 0, 8400, 3206 }, { 0, 8402, 3208 }, { 16037, 8423, -1 }, { 16035, 8401, -1 },
+    { 16039, 8403, -1 }, { 0, 8407, 3212 }, { 0, 8409, 3213 }, { 16039, 8410, -1 },
+    { 0, 8411, 3215 }, { 0, 8412, 3216 }, { 16041, 8413, -1 }, { 16039, 8414, -1 },
+    { 16040, 8415, -1 }, { 0, 8416, 3221 }, { 16043, 8417, -1 }, { 0, 8418, 3223 },
+    { 0, 8419, 3224 }, { 16045, 8424, -1 }, { 0, 8425, 3226 }, { 0, 8426, 3227 },
+    { 0, 8428, 3228 }, { 0, 8429, 3229 }, { 0, 8430, 3230 }, { 0, 8431, 3231 },
+    { 0, 8433, 3232 }, { 0, 8434, 3233 }, { 0, 8436, 3234 }, { 0, 8437, 3241 },
+    { 0, 8439, 3243 }, { 0, 8440, 3245 }, { 0, 8441, 3246 }, { 0, 8442, 3247 },
+    { 0, 8443, 3248 }, { 0, 8447, 3249 }, { 0, 8444, 3250 }, { 0, 8467, 3251 },
+    { 16047, 8445, -1 }, { 0, 8484, 3253 }, { 16048, 8446, -1 }, { 0, 8454, 3255 },
+    { 0, 8448, 3256 }, { 16046, 8449, -1 }, { 0, 8450, 3259 }, { 16052, 8451, -1 },
+    { 0, 8452, 3262 }, { 0, 8453, 3263 }, { 0, 8465, 3264 }, { 0, 8494, 3265 },
+    { 0, 8499, 3267 }, { 0, 8501, 3268 }, { 0, 8455, 3269 }, { 0, 8457, 3270 },
+    { 0, 8468, 3272 }, { 0, 8456, 3273 }, { 16051, 8458, -1 }, { 0, 8459, 3275 },
+    { 0, 8460, 3287 }, { 0, 8461, 3288 }, { 0, 8462, 3289 }, { 0, 8480, 3290 },
+    { 0, 8463, 3291 }, { 0, 8457, 3271 }, { 0, 8503, 3293 }, { 0, 8464, 3297 },
+    { 0, 8509, 3295 }, { 0, 8466, 3298 }, { 0, 8494, 3266 }, { 0, 8488, 3299 },
+    { 0, 8469, 3300 }, { 16054, 8470, -1 }, { 0, 8471, 3303 }, { 0, 8472, 3304 },
+    { 0, 8473, 3308 }, { 0, 8503, 3294 }, { 0, 8509, 3296 }, { 0, 8474, 3310 },
+    { 0, 8475, 3311 }, { 16054, 8476, -1 }, { 0, 8477, 3315 }, { 16052, 8478, -1 },
+    { 0, 8479, 3317 }, { 0, 8481, 3318 }, { 0, 8482, 3319 }, { 16052, 8483, -1 },
+    { 0, 8485, 3321 }, { 16054, 8486, -1 }, { 16058, 8487, -1 }, { 0, 8463, 3292 },
+    { 0, 8493, 3324 }, { 16059, 8489, -1 }, { 16060, 8507, -1 }, { 0, 8490, 3333 },
+    { 0, 8491, 3334 }, { 0, 8492, 3335 }, { 0, 8495, 3336 }, { 0, 8521, 3337 },
+    { 0, 8496, 3338 }, { 0, 8473, 3309 }, { 0, 8497, 3345 }, { 0, 8498, 3346 },
+    { 16060, 8500, -1 }, { 0, 8502, 3348 }, { 0, 8504, 3349 }, { 16058, 8505, -1 },
+    { 0, 8506, 3352 }, { 0, 8508, 3354 }, { 0, 8510, 3357 }, { 16060, 8511, -1 },
+    { 0, 8512, 3360 }, { 16061, 8513, -1 }, { 0, 8514, 3364 }, { 0, 8515, 3365 },
+    { 0, 8516, 3366 }, { 0, 8517, 3368 }, { 0, 8518, 3370 }, { 16065, 8519, -1 },
+    { 0, 8520, 3372 }, { 16066, 8526, -1 }, { 0, 8522, 3374 }, { 0, 8523, 3375 },
+    { 0, 8524, 3380 }, { 16063, 8525, -1 }, { 0, 8527, 3383 }, { 16068, 8528, 3384 },
+    { 0, 8529, 3386 }, { 0, 8530, 3388 }, { 0, 8531, 3389 }, { 0, 8532, 3390 },
+    { 0, 8533, 3391 }, { 0, 8534, 3392 }, { 0, 8535, 3393 }, { 0, 8536, 3394 },
+    { 16068, 8541, -1 }, { 16066, 8537, -1 }, { 16071, 8538, -1 }, { 0, 8539, 3400 },
+    { 16068, 8540, -1 }, { 0, 8542, 3402 }, { 0, 8543, 3404 }, { 0, 8537, 3397 },
+    { 0, 8544, 3405 }, { 0, 8545, 3406 }, { 0, 8546, 3407 }, { 0, 8547, 3408 },
+    { 16070, 8548, -1 }, { 16070, 8549, -1 }, { 16075, 8550, -1 }, { 0, 8551, 3413 },
+    { 0, 8552, 3414 }, { 16074, 8553, -1 }, { 0, 8596, 3417 }, { 0, 8554, 3418 },
+    { 16076, 8555, -1 }, { 16077, 8556, -1 }, { 0, 8557, 3423 }, { 0, 8559, 3426 },
+    { 0, 8558, 3428 }, { 16076, 8557, -1 }, { 0, 8559, 3427 }, { 16080, 8566, -1 },
+    { 0, 8568, 3431 }, { 0, 8574, 3437 }, { 0, 8573, 3433 }, { 0, 8577, 3438 },
+    { 0, 8582, 3439 }, { 0, 8573, 3434 }, { 16084, 8586, -1 }, { 0, 8593, 3441 },
+    { 0, 8594, 3442 }, { 0, 8605, 3443 }, { 0, 8613, 3444 }, { 16084, 8615, -1 },
+    { 0, 8618, 3446 }, { 0, 8619, 3448 }, { 0, 8553, 3416 }, { 16083, 8621, -1 },
+    { 0, 8589, 3451 }, { 0, 8590, 3452 }, { 0, 8591, 3454 }, { 0, 8606, 3457 },
+    { 0, 8607, 3458 }, { 0, 8603, 3455 }, { 16086, 8610, -1 }, { 0, 8568, 3432 },
+    { 16082, 8573, -1 }, { 0, 8626, 3460 }, { 0, 8627, 3461 }, { 0, 8629, 3462 },
+    { 0, 8632, 3463 }, { 0, 8618, 3447 }, { 16089, 8580, -1 }, { 0, 8579, 3464 },
+    { 0, 8581, 3470 }, { 16087, 8595, -1 }, { 0, 8598, 3472 }, { 0, 8621, 3450 },
+    { 16080, 8566, -1 }, { 0, 8603, 3456 }, { 0, 8599, 3473 }, { 16090, 8609, -1 },
+    { 16088, 8630, -1 }, { 0, 8633, 3477 }, { 0, 8634, 3478 }, { 0, 8638, 3479 },
+    { 16087, 8579, -1 }, { 0, 8557, 3425 }, { 0, 8579, 3467 }, { 0, 8639, 3480 },
+    { 0, 8642, 3481 }, { 0, 8643, 3482 }, { 16090, 8661, -1 }, { 0, 8677, 3484 },
+    { 0, 8683, 3485 }, { 0, 8684, 3486 }, { 16093, 8624, -1 }, { 16085, 8590, -1 },
+    { 16093, 8628, -1 }, { 0, 8636, 3490 }, { 0, 8650, 3491 }, { 0, 8624, 3488 },
+    { 0, 8657, 3492 }, { 16092, 8658, -1 }, { 16098, 8560, -1 }, { 0, 8561, 3498 },
+    { 0, 8564, 3499 }, { 0, 8608, 3500 }, { 0, 8562, 3501 }, { 16099, 8563, -1 },
+    { 16095, 8565, -1 }, { 0, 8567, 3504 }, { 0, 8623, 3505 }, { 0, 8570, 3506 },
+    { 0, 8657, 3493 }, { 0, 8575, 3507 }, { 0, 8580, 3469 }, { 16100, 8569, -1 },
+    { 0, 8571, 3509 }, { 0, 8572, 3510 }, { 0, 8584, 3511 }, { 16098, 8614, -1 },
+    { 16100, 8576, -1 }, { 0, 8578, 3514 }, { 0, 8583, 3515 }, { 0, 8585, 3517 },
+    { 16104, 8587, -1 }, { 16103, 8600, -1 }, { 16105, 8617, -1 }, { 16106, 8588, -1 },
+    { 0, 8640, 3522 }, { 0, 8641, 3523 }, { 16103, 8672, -1 }, { 16108, 8690, -1 },
+    { 0, 8592, 3527 }, { 0, 8597, 3529 }, { 0, 8601, 3530 }, { 0, 8602, 3531 },
+    { 0, 8622, 3532 }, { 16106, 8604, 3533 }, { 0, 8611, 3535 }, { 0, 8620, 3537 },
+    { 16106, 8625, -1 }, { 16111, 8612, 3540 }, { 0, 8616, 3542 }, { 0, 8656, 3543 },
+    { 0, 8631, 3544 }, { 0, 8645, 3545 }, { 0, 8651, 3546 }, { 0, 8688, 3547 },
+    { 0, 8635, 3548 }, { 16112, 8637, -1 }, { 16113, 8652, -1 }, { 0, 8690, 3526 },
+    { 0, 8644, 3551 }, { 0, 8646, 3552 }, { 16114, 8647, -1 }, { 0, 8648, 3555 },
+    { 16112, 8649, -1 }, { 16112, 8654, -1 }, { 16113, 8689, -1 }, { 16114, 8653, -1 },
+    { 0, 8686, 3560 }, { 0, 8655, 3561 }, { 16118, 8659, -1 }, { 16117, 8660, -1 },
+    { 0, 8662, 3567 }, { 0, 8663, 3569 }, { 0, 8664, 3571 }, { 0, 8665, 3572 },
+    { 0, 8695, 3573 }, { 0, 8668, 3574 }, { 0, 8685, 3575 }, { 0, 8666, 3576 },
+    { 0, 8702, 3577 }, { 0, 8667, 3578 }, { 0, 8682, 3579 }, { 0, 8669, 3580 },
+    { 16119, 8670, -1 }, { 16120, 8723, -1 }, { 0, 8671, 3587 }, { 0, 8673, 3588 },
+    { 0, 8674, 3589 }, { 16124, 8675, -1 }, { 0, 8676, 3591 }, { 0, 8678, 3592 },
+    { 16121, 8679, -1 }, { 16122, 8680, -1 }, { 0, 8681, 3596 }, { 16123, 8709, -1 },
+    { 0, 8687, 3598 }, { 16127, 8692, -1 }, { 0, 8696, 3601 }, { 0, 8691, 3602 },
+    { 0, 8693, 3603 }, { 0, 8694, 3604 }, { 0, 8697, 3605 }, { 16128, 8716, -1 },
+    { 0, 8698, 3607 }, { 0, 8707, 3608 }, { 0, 8744, 3609 }, { 16130, 8700, -1 },
+    { 0, 8717, 3611 }, { 0, 8724, 3612 }, { 0, 8727, 3613 }, { 16127, 8699, -1 },
+    { 0, 8701, 3615 }, { 0, 8703, 3616 }, { 0, 8704, 3617 }, { 0, 8705, 3618 },
+    { 16132, 8706, -1 }, { 16134, 8710, -1 }, { 0, 8711, 3621 }, { 0, 8713, 3622 },
+    { 0, 8712, 3623 }, { 16134, 8720, -1 }, { 16133, 8741, -1 }, { 0, 8767, 3628 },
+    { 16134, 8708, -1 }, { 16138, 8739, -1 }, { 16138, 8742, -1 }, { 0, 8714, 3632 },
+    { 16138, 8715, -1 }, { 16138, 8718, -1 }, { 0, 8719, 3637 }, { 16142, 8721, -1 },
+    { 0, 8728, 3639 }, { 0, 8725, 3640 }, { 0, 8730, 3642 }, { 0, 8722, 3643 },
+    { 0, 8726, 3644 }, { 0, 8729, 3645 }, { 0, 8731, 3646 }, { 0, 8732, 3648 },
+    { 16142, 8733, -1 }, { 16144, 8734, -1 }, { 16148, 8772, -1 }, { 16144, 8725, -1 },
+    { 0, 8735, 3652 }, { 16148, 8736, -1 }, { 16131, 8720, 3625 }, { 0, 8752, 3654 },
+    { 0, 8764, 3655 }, { 16146, 8778, -1 }, { 0, 8737, 3657 }, { 0, 8776, 3658 },
+    { 16149, 8738, -1 }, { 0, 8743, 3660 }, { 0, 8774, 3661 }, { 0, 8775, 3662 },
+    { 16152, 8792, -1 }, { 0, 8740, 3664 }, { 0, 8769, 3665 }, { 0, 8746, 3666 },
+    { 0, 8765, 3667 }, { 0, 8790, 3668 }, { 0, 8745, 3669 }, { 0, 8751, 3670 },
+    { 0, 8747, 3671 }, { 0, 8750, 3672 }, { 0, 8750, 3673 }, { 0, 8761, 3674 },
+    { 0, 8768, 3675 }, { 0, 8784, 3676 }, { 0, 8793, 3677 }, { 16149, 8748, -1 },
+    { 0, 8749, 3681 }, { 16151, 8753, -1 }, { 16151, 8754, -1 }, { 0, 8801, 3686 },
+    { 0, 8755, 3687 }, { 0, 8756, 3690 }, { 16155, 8757, -1 }, { 16156, 8758, -1 },
+    { 0, 8759, 3693 }, { 16154, 8760, -1 }, { 0, 8773, 3695 }, { 0, 8762, 3696 },
+    { 16159, 8763, -1 }, { 16159, 8766, -1 }, { 0, 8770, 3699 }, { 0, 8771, 3700 },
+    { 0, 8777, 3702 }, { 0, 8779, 3704 }, { 16159, 8780, -1 }, { 0, 8781, 3708 },
+    { 0, 8782, 3709 }, { 0, 8783, 3711 }, { 16162, 8785, -1 }, { 0, 8786, 3714 },
+    { 16163, 8787, -1 }, { 0, 8789, 3716 }, { 16161, 8794, -1 }, { 0, 8799, 3719 },
+    { 0, 8804, 3721 }, { 0, 8811, 3722 }, { 0, 8817, 3723 }, { 0, 8835, 3724 },
+    { 0, 8849, 3725 }, { 0, 8852, 3727 }, { 0, 8796, 3728 }, { 0, 8798, 3729 },
+    { 0, 8803, 3730 }, { 0, 8799, 3720 }, { 0, 8810, 3731 }, { 0, 8818, 3732 },
+    { 0, 8820, 3733 }, { 0, 8837, 3734 }, { 0, 8842, 3735 }, { 0, 8800, 3736 },
+    { 0, 8807, 3737 }, { 0, 8808, 3738 }, { 0, 8789, 3717 }, { 0, 8791, 3739 },
+    { 0, 8814, 3741 }, { 0, 8840, 3742 }, { 0, 8848, 3743 }, { 0, 8788, 3744 },
+    { 0, 8825, 3745 }, { 16163, 8795, -1 }, { 0, 8797, 3747 }, { 16167, 8802, -1 },
+    { 0, 8805, 3751 }, { 16168, 8809, -1 }, { 0, 8821, 3753 }, { 0, 8849, 3726 },
+    { 16169, 8806, -1 }, { 0, 8812, 3755 }, { 0, 8813, 3759 }, { 0, 8815, 3765 },
+    { 0, 8816, 3766 }, { 0, 8819, 3767 }, { 0, 8822, 3768 }, { 16170, 8823, -1 },
+    { 0, 8824, 3771 }, { 0, 8826, 3772 }, { 0, 8856, 3773 }, { 0, 8827, 3774 },
+    { 0, 8828, 3776 }, { 16171, 8829, -1 }, { 0, 8830, 3782 }, { 0, 8886, 3783 },
+    { 0, 8831, 3784 }, { 0, 8853, 3785 }, { 0, 8832, 3786 }, { 0, 8833, 3787 },
+    { 16172, 8834, -1 }, { 0, 8836, 3793 }, { 0, 8838, 3797 }, { 0, 8839, 3799 },
+    { 0, 8841, 3800 }, { 16171, 8843, -1 }, { 0, 8844, 3803 }, { 0, 8845, 3804 },
+    { 0, 8846, 3805 }, { 0, 8847, 3806 }, { 0, 8791, 3740 }, { 0, 8850, 3808 },
+    { 0, 8851, 3809 }, { 0, 8854, 3810 }, { 16174, 8855, -1 }, { 16175, 8857, -1 },
+    { 0, 8858, 3815 }, { 0, 8859, 3816 }, { 0, 8866, 3817 }, { 0, 8860, 3818 },
+    { 0, 8861, 3822 }, { 0, 8862, 3826 }, { 0, 8863, 3831 }, { 0, 8864, 3832 },
+    { 0, 8865, 3834 }, { 0, 8867, 3835 }, { 0, 8868, 3836 }, { 0, 8869, 3837 },
+    { 0, 8870, 3838 }, { 0, 8871, 3839 }, { 0, 8872, 3843 }, { 16172, 8873, -1 },
+    { 0, 8874, 3845 }, { 16173, 8875, -1 }, { 0, 8876, 3847 }, { 0, 8877, 3848 },
+    { 0, 8907, 3849 }, { 0, 8911, 3850 }, { 0, 8878, 3851 }, { 0, 8882, 3852 },
+    { 0, 8879, 3853 }, { 16177, 8899, -1 }, { 0, 8912, 3855 }, { 0, 8914, 3856 },
+    { 0, 8880, 3857 }, { 0, 8883, 3858 }, { 0, 8884, 3859 }, { 16176, 8881, -1 },
+    { 0, 8885, 3862 }, { 16181, 8887, -1 }, { 16180, 8888, -1 }, { 16181, 8889, -1 },
+    { 0, 8890, 3877 }, { 0, 8891, 3881 }, { 0, 8892, 3882 }, { 0, 8893, 3883 },
+    { 0, 8894, 3885 }, { 16183, 8950, -1 }, { 0, 8895, 3887 }, { 0, 8900, 3888 },
+    { 0, 8896, 3891 }, { 0, 8897, 3900 }, { 16185, 8898, -1 }, { 16183, 8901, -1 },
+    { 0, 8929, 3903 }, { 0, 8902, 3904 }, { 0, 8927, 3905 }, { 0, 8903, 3906 },
+    { 0, 8904, 3907 }, { 0, 8905, 3908 }, { 0, 8906, 3909 }, { 0, 8908, 3910 },
+    { 16185, 8909, -1 }, { 16186, 8910, -1 }, { 16187, 8913, -1 }, { 16191, 8915, -1 },
+    { 0, 8916, 3915 }, { 0, 8917, 3916 }, { 0, 8918, 3917 }, { 16191, 8919, -1 },
+    { 0, 8920, 3924 }, { 0, 8921, 3925 }, { 0, 8922, 3928 }, { 0, 8923, 3932 },
+    { 16191, 8924, -1 }, { 16191, 8925, -1 }, { 16197, 8926, -1 }, { 0, 8928, 3938 },
+    { 0, 8930, 3939 }, { 0, 8931, 3940 }, { 0, 8932, 3941 }, { 0, 8933, 3942 },
+    { 16197, 8934, -1 }, { 0, 8935, 3946 }, { 0, 8949, 3947 }, { 0, 8959, 3948 },
+    { 0, 8936, 3950 }, { 0, 8937, 3951 }, { 0, 8938, 3955 }, { 0, 8939, 3957 },
+    { 0, 8940, 3960 }, { 16197, 8941, -1 }, { 16198, 8947, -1 }, { 0, 8942, 3963 },
+    { 0, 8943, 3964 }, { 16201, 8992, -1 }, { 16200, 8944, -1 }, { 0, 8958, 3967 },
+    { 0, 8945, 3969 }, { 0, 8946, 3970 }, { 0, 8957, 3971 }, { 0, 8948, 3972 },
+    { 0, 8960, 3973 }, { 0, 8962, 3974 }, { 0, 8951, 3975 }, { 0, 8952, 3976 },
+    { 16200, 8953, -1 }, { 0, 8954, 3979 }, { 0, 8955, 3980 }, { 16199, 8956, -1 },
+    { 0, 8961, 3983 }, { 0, 8963, 3984 }, { 0, 8964, 3985 }, { 0, 8965, 3987 },
+    { 16202, 8966, -1 }, { 16203, 8999, -1 }, { 0, 9005, 3990 }, { 0, 8967, 3991 },
+    { 0, 8969, 3992 }, { 0, 8972, 3993 }, { 0, 8974, 3994 }, { 0, 8968, 3995 },
+    { 0, 8970, 3996 }, { 0, 8991, 3997 }, { 0, 8971, 3998 }, { 0, 8973, 3999 },
+    { 16205, 8975, -1 }, { 16207, 8976, -1 }, { 0, 8977, 4004 }, { 16207, 9027, 4005 },
+    { 16206, 8978, -1 }, { 16210, 9002, -1 }, { 0, 8979, 4009 }, { 0, 8980, 4012 },
+    { 0, 8981, 4018 }, { 0, 8982, 4019 }, { 0, 8983, 4020 }, { 0, 8984, 4021 },
+    { 0, 8985, 4022 }, { 0, 8986, 4023 }, { 0, 8987, 4024 }, { 0, 8988, 4025 },
+    { 0, 8989, 4026 }, { 0, 8990, 4028 }, { 0, 8993, 4029 }, { 16208, 8994, -1 },
+    { 16209, 8995, -1 }, { 0, 8996, 4032 }, { 0, 8998, 4033 }, { 0, 9000, 4034 },
+    { 0, 9030, 4035 }, { 0, 9040, 4036 }, { 0, 9001, 4037 }, { 0, 9009, 4038 },
+    { 16213, 9004, -1 }, { 0, 9006, 4040 }, { 0, 9003, 4041 }, { 0, 9038, 4042 },
+    { 0, 9045, 4043 }, { 0, 9046, 4044 }, { 0, 8997, 4045 }, { 16213, 9007, -1 },
+    { 0, 9026, 4048 }, { 0, 9008, 4049 }, { 16211, 9010, -1 }, { 0, 9011, 4056 },
+    { 16215, 9012, -1 }, { 0, 9013, 4062 }, { 0, 9014, 4064 }, { 0, 9015, 4065 },
+    { 0, 9054, 4066 }, { 0, 9058, 4067 }, { 0, 9060, 4068 }, { 0, 9061, 4069 },
+    { 0, 9069, 4070 }, { 0, 9016, 4071 }, { 0, 9017, 4072 }, { 0, 9018, 4073 },
+    { 0, 9019, 4074 }, { 0, 9076, 4075 }, { 16218, 9020, -1 }, { 0, 9021, 4077 },
+    { 0, 9023, 4078 }, { 0, 9041, 4079 }, { 0, 9022, 4081 }, { 0, 9024, 4082 },
+    { 0, 9025, 4085 }, { 0, 9028, 4095 }, { 0, 9029, 4096 }, { 0, 9031, 4099 },
+    { 16215, 9032, -1 }, { 0, 9033, 4102 }, { 0, 9034, 4103 }, { 16216, 9035, -1 },
+    { 0, 9036, 4105 }, { 0, 9037, 4106 }, { 0, 9039, 4107 }, { 16220, 9042, -1 },
+    { 0, 9043, 4109 }, { 16221, 9044, -1 }, { 16222, 9049, -1 }, { 0, 9056, 4113 },
+    { 16223, 9062, -1 }, { 16224, 9062, -1 }, { 16223, 9063, -1 }, { 0, 9066, 4117 },
+    { 16224, 9085, -1 }, { 16226, 9047, -1 }, { 16227, 9077, -1 }, { 16228, 9088, -1 },
+    { 0, 9048, 4123 }, { 16228, 9078, -1 }, { 16231, 9081, -1 }, { 0, 9051, 4126 },
+    { 16230, 9082, -1 }, { 16231, 9086, -1 }, { 16234, 9053, -1 }, { 16235, 9059, -1 },
+    { 16235, 9074, -1 }, { 16237, 9105, -1 }, { 16235, 9109, -1 }, { 16237, 9050, -1 },
+    { 16238, 9052, -1 }, { 0, 9055, 4137 }, { 0, 9068, 4138 }, { 0, 9070, 4139 },
+    { 16236, 9074, -1 }, { 0, 9079, 4140 }, { 0, 9065, 4141 }, { 0, 9087, 4142 },
+    { 0, 9057, 4143 }, { 0, 9073, 4144 }, { 0, 9083, 4145 }, { 16239, 9064, -1 },
+    { 0, 9067, 4159 }, { 0, 9071, 4160 }, { 16244, 9072, -1 }, { 16242, 9075, -1 },
+    { 0, 9112, 4163 }, { 0, 9080, 4164 }, { 0, 9084, 4165 }, { 0, 9095, 4166 },
+    { 16243, 9089, -1 }, { 16247, 9098, -1 }, { 16247, 9090, -1 }, { 0, 9091, 4170 },
+    { 0, 9092, 4171 }, { 16245, 9093, -1 }, { 0, 9094, 4173 }, { 0, 9096, 4174 },
+    { 0, 9097, 4175 }, { 16250, 9099, -1 }, { 16246, 9100, -1 }, { 0, 9101, 4178 },
+    { 0, 9102, 4179 }, { 16250, 9103, -1 }, { 16252, 9104, -1 }, { 0, 9106, 4191 },
+    { 0, 9107, 4193 }, { 0, 9113, 4194 }, { 0, 9114, 4195 }, { 0, 9115, 4196 },
+    { 0, 9116, 4198 }, { 0, 9117, 4199 }, { 0, 9119, 4200 }, { 0, 9120, 4201 },
+    { 0, 9121, 4202 }, { 16252, 9123, -1 }, { 0, 9125, 4204 }, { 0, 9129, 4205 },
+    { 0, 9142, 4206 }, { 0, 9160, 4207 }, { 0, 9161, 4209 }, { 16252, 9164, -1 },
+    { 16254, 9178, -1 }, { 0, 9108, 4213 }, { 0, 9161, 4210 }, { 0, 9110, 4214 },
+    { 16256, 9111, -1 }, { 0, 9124, 4216 }, { 0, 9126, 4217 }, { 16257, 9134, -1 },
+    { 0, 9150, 4219 }, { 0, 9152, 4220 }, { 0, 9128, 4221 }, { 0, 9130, 4222 },
+    { 16254, 9143, -1 }, { 0, 9154, 4224 }, { 0, 9156, 4225 }, { 0, 9132, 4226 },
+    { 0, 9133, 4227 }, { 16260, 9137, 4229 }, { 0, 9157, 4231 }, { 0, 9160, 4208 },
+    { 0, 9163, 4233 }, { 0, 9170, 4234 }, { 0, 9171, 4235 }, { 0, 9180, 4238 },
+    { 0, 9177, 4236 }, { 0, 9127, 4239 }, { 0, 9147, 4240 }, { 16260, 9169, -1 },
+    { 0, 9172, 4242 }, { 0, 9157, 4232 }, { 0, 9118, 4243 }, { 0, 9131, 4244 },
+    { 0, 9138, 4245 }, { 16259, 9122, -1 }, { 0, 9135, 4247 }, { 0, 9136, 4253 },
+    { 0, 9139, 4254 }, { 0, 9140, 4255 }, { 0, 9141, 4256 }, { 0, 9115, 4197 },
+    { 16261, 9144, -1 }, { 16260, 9145, -1 }, { 0, 9146, 4270 }, { 0, 9148, 4271 },
+    { 0, 9158, 4272 }, { 0, 9159, 4273 }, { 0, 9167, 4274 }, { 0, 9149, 4275 },
+    { 0, 9151, 4276 }, { 0, 9153, 4278 }, { 0, 9155, 4281 }, { 16261, 9162, -1 },
+    { 16262, 9206, -1 }, { 0, 9165, 4288 }, { 0, 9166, 4289 }, { 0, 9168, 4291 },
+    { 0, 9173, 4293 }, { 0, 9174, 4294 }, { 0, 9175, 4295 }, { 0, 9176, 4298 },
+    { 0, 9179, 4300 }, { 0, 9181, 4301 }, { 0, 9182, 4302 }, { 16267, 9183, -1 },
+    { 0, 9184, 4304 }, { 16265, 9185, 4307 }, { 0, 9186, 4310 }, { 0, 9133, 4228 },
+    { 0, 9177, 4237 }, { 0, 9187, 4314 }, { 0, 9188, 4316 }, { 0, 9189, 4318 },
+    { 0, 9190, 4321 }, { 0, 9191, 4322 }, { 16265, 9192, -1 }, { 16266, 9193, -1 },
+    { 16267, 9216, -1 }, { 0, 9194, 4327 }, { 0, 9205, 4328 }, { 0, 9195, 4330 },
+    { 0, 9197, 4331 }, { 0, 9204, 4332 }, { 0, 9234, 4333 }, { 0, 9245, 4334 },
+    { 0, 9247, 4335 }, { 0, 9250, 4336 }, { 0, 9198, 4337 }, { 0, 9199, 4338 },
+    { 0, 9196, 4339 }, { 0, 9200, 4340 }, { 0, 9239, 4341 }, { 16271, 9201, -1 },
+    { 0, 9212, 4343 }, { 0, 9202, 4348 }, { 0, 9251, 4349 }, { 0, 9203, 4352 },
+    { 0, 9207, 4353 }, { 0, 9208, 4354 }, { 0, 9209, 4357 }, { 16274, 9210, -1 },
+    { 0, 9211, 4364 }, { 16276, 9242, -1 }, { 16277, 9213, -1 }, { 0, 9214, 4367 },
+    { 0, 9215, 4369 }, { 0, 9217, 4374 }, { 16279, 9218, -1 }, { 0, 9219, 4376 },
+    { 0, 9220, 4377 }, { 16277, 9221, -1 }, { 0, 9223, 4379 }, { 0, 9229, 4380 },
+    { 0, 9222, 4381 }, { 0, 9224, 4382 }, { 0, 9225, 4383 }, { 0, 9226, 4384 },
+    { 0, 9227, 4385 }, { 0, 9228, 4386 }, { 0, 9230, 4387 }, { 16278, 9231, -1 },
+    { 0, 9232, 4390 }, { 0, 9233, 4392 }, { 16281, 9235, -1 }, { 0, 9236, 4395 },
+    { 0, 9237, 4396 }, { 16278, 9238, -1 }, { 0, 9240, 4399 }, { 16283, 9241, -1 },
+    { 0, 9243, 4402 }, { 16281, 9244, -1 }, { 0, 9298, 4405 }, { 16282, 9246, -1 },
+    { 16283, 9248, -1 }, { 0, 9249, 4414 }, { 16287, 9293, -1 }, { 16288, 9252, -1 },
+    { 16287, 9253, -1 }, { 0, 9254, 4421 }, { 16288, 9255, -1 }, { 0, 9256, 4428 },
+    { 0, 9244, 4404 }, { 16274, 9210, -1 }, { 0, 9257, 4433 }, { 16292, 9258, -1 },
+    { 0, 9259, 4440 }, { 0, 9260, 4442 }, { 16289, 9261, -1 }, { 16294, 9262, -1 },
+    { 0, 9263, 4445 }, { 0, 9305, 4446 }, { 0, 9264, 4451 }, { 16295, 9265, -1 },
+    { 0, 9266, 4457 }, { 0, 9267, 4459 }, { 16297, 9268, -1 }, { 0, 9269, 4463 },
+    { 16299, 9300, -1 }, { 16300, 9270, -1 }, { 0, 9271, 4468 }, { 0, 9272, 4470 },
+    { 0, 9273, 4472 }, { 0, 9274, 4476 }, { 0, 9275, 4478 }, { 0, 9276, 4479 },
+    { 0, 9277, 4480 }, { 16297, 9278, -1 }, { 16298, 9279, -1 }, { 16299, 9280, -1 },
+    { 0, 9285, 4484 }, { 0, 9309, 4485 }, { 16300, 9281, -1 }, { 0, 9282, 4487 },
+    { 0, 9283, 4488 }, { 0, 9284, 4489 }, { 0, 9286, 4490 }, { 0, 9287, 4491 },
+    { 0, 9288, 4492 }, { 16305, 9289, -1 }, { 16303, 9290, -1 }, { 0, 9291, 4496 },
+    { 16304, 9330, -1 }, { 0, 9292, 4499 }, { 16305, 9314, -1 }, { 16309, 9294, -1 },
+    { 0, 9295, 4502 }, { 0, 9296, 4503 }, { 0, 9297, 4504 }, { 16308, 9299, -1 },
+    { 0, 9301, 4507 }, { 0, 9302, 4509 }, { 0, 9303, 4510 }, { 0, 9304, 4512 },
+    { 0, 9306, 4513 }, { 0, 9307, 4514 }, { 0, 9308, 4524 }, { 0, 9310, 4526 },
+    { 16297, 9268, -1 }, { 0, 9311, 4527 }, { 0, 9312, 4528 }, { 0, 9313, 4529 },
+    { 0, 9315, 4530 }, { 0, 9364, 4531 }, { 0, 9316, 4534 }, { 0, 9317, 4536 },
+    { 0, 9318, 4537 }, { 0, 9319, 4538 }, { 16311, 9321, -1 }, { 16309, 9323, -1 },
+    { 0, 9331, 4554 }, { 0, 9373, 4555 }, { 0, 9320, 4556 }, { 16310, 9322, -1 },
+    { 0, 9324, 4559 }, { 16311, 9325, -1 }, { 0, 9346, 4561 }, { 0, 9320, 4557 },
+    { 0, 9326, 4562 }, { 0, 9327, 4563 }, { 0, 9332, 4564 }, { 16316, 9334, -1 },
+    { 0, 9328, 4566 }, { 16313, 9365, -1 }, { 16318, 9333, -1 }, { 16320, 9336, -1 },
+    { 0, 9371, 4570 }, { 16320, 9329, -1 }, { 16318, 9335, 4572 }, { 16322, 9338, -1 },
+    { 0, 9337, 4575 }, { 16324, 9345, -1 }, { 0, 9339, 4577 }, { 0, 9341, 4578 },
+    { 0, 9383, 4579 }, { 16324, 9340, -1 }, { 0, 9342, 4582 }, { 0, 9343, 4583 },
+    { 0, 9344, 4584 }, { 16324, 9347, -1 }, { 0, 9348, 4588 }, { 0, 9349, 4589 },
+    { 0, 9350, 4591 }, { 0, 9351, 4592 }, { 0, 9352, 4595 }, { 0, 9353, 4596 },
+    { 16325, 9354, -1 }, { 0, 9355, 4599 }, { 0, 9356, 4600 }, { 0, 9357, 4603 },
+    { 0, 9368, 4604 }, { 0, 9358, 4606 }, { 0, 9359, 4607 }, { 0, 9360, 4608 },
+    { 0, 9361, 4609 }, { 0, 9362, 4610 }, { 16327, 9363, -1 }, { 0, 9366, 4612 },
+    { 0, 9367, 4613 }, { 0, 9418, 4614 }, { 0, 9369, 4615 }, { 16326, 9370, -1 },
+    { 0, 9372, 4618 }, { 16328, 9374, -1 }, { 0, 9375, 4622 }, { 0, 9376, 4623 },
+    { 0, 9377, 4624 }, { 0, 9378, 4625 }, { 0, 9379, 4627 }, { 0, 9380, 4628 },
+    { 16329, 9381, -1 }, { 16330, 9382, -1 }, { 0, 9384, 4631 }, { 0, 9385, 4632 },
+    { 16333, 9386, -1 }, { 0, 9387, 4634 }, { 16336, 9388, -1 }, { 0, 9444, 4636 },
+    { 16334, 9389, -1 }, { 16337, 9390, -1 }, { 16337, 9391, -1 }, { 16341, 9392, -1 },
+    { 0, 9393, 4644 }, { 16338, 9394, -1 }, { 16340, 9395, -1 }, { 0, 9396, 4652 },
+    { 0, 9397, 4653 }, { 0, 9398, 4654 }, { 0, 9399, 4656 }, { 0, 9407, 4657 },
+    { 0, 9400, 4658 }, { 0, 9401, 4659 }, { 0, 9402, 4660 }, { 16342, 9403, -1 },
+    { 0, 9406, 4663 }, { 16348, 9404, -1 }, { 0, 9405, 4670 }, { 0, 9408, 4671 },
+    { 0, 9409, 4675 }, { 16347, 9410, -1 }, { 0, 9411, 4684 }, { 0, 9412, 4685 },
+    { 0, 9413, 4687 }, { 0, 9414, 4689 }, { 0, 9415, 4692 }, { 0, 9416, 4694 },
+    { 0, 9417, 4695 }, { 0, 9419, 4696 }, { 0, 9420, 4697 }, { 0, 9421, 4698 },
+    { 0, 9422, 4700 }, { 0, 9423, 4701 }, { 0, 9424, 4702 }, { 0, 9425, 4703 },
+    { 0, 9426, 4704 }, { 0, 9427, 4705 }, { 0, 9428, 4707 }, { 0, 9429, 4708 },
+    { 0, 9430, 4713 }, { 0, 9431, 4714 }, { 0, 9432, 4718 }, { 0, 9433, 4719 },
+    { 16345, 9434, -1 }, { 0, 9435, 4721 }, { 0, 9457, 4722 }, { 0, 9436, 4724 },
+    { 16351, 9459, -1 }, { 16347, 9437, -1 }, { 0, 9449, 4728 }, { 0, 9451, 4729 },
+    { 16348, 9472, -1 }, { 16349, 9438, -1 }, { 0, 9471, 4732 }, { 16354, 9439, -1 },
+    { 16356, 9440, -1 }, { 0, 9441, 4737 }, { 0, 9442, 4738 }, { 0, 9443, 4739 },
+    { 0, 9445, 4740 }, { 0, 9446, 4741 }, { 16353, 9447, -1 }, { 16357, 9448, -1 },
+    { 0, 9473, 4746 }, { 16354, 9450, 4747 }, { 0, 9452, 4749 }, { 0, 9453, 4751 },
+    { 0, 9454, 4753 }, { 0, 9455, 4758 }, { 0, 9456, 4759 }, { 0, 9458, 4760 },
+    { 0, 9460, 4761 }, { 16355, 9461, -1 }, { 16357, 9462, -1 }, { 0, 9463, 4766 },
+    { 16363, 9464, -1 }, { 16363, 9465, -1 }, { 0, 9470, 4769 }, { 16364, 9466, -1 },
+    { 16362, 9469, 4771 }, { 0, 9474, 4773 }, { 0, 9467, 4774 }, { 16365, 9468, -1 },
+    { 0, 9475, 4779 }, { 0, 9476, 4780 }, { 0, 9517, 4781 }, { 16367, 9477, -1 },
+    { 0, 9478, 4786 }, { 16366, 9479, -1 }, { 0, 9480, 4791 }, { 0, 9481, 4793 },
+    { 16369, 9482, -1 }, { 0, 9483, 4796 }, { 0, 9484, 4797 }, { 0, 9485, 4798 },
+    { 0, 9486, 4799 }, { 0, 9487, 4800 }, { 16371, 9488, -1 }, { 0, 9489, 4802 },
+    { 0, 9490, 4805 }, { 16368, 9491, -1 }, { 16372, 9492, -1 }, { 0, 9493, 4814 },
+    { 0, 9496, 4815 }, { 0, 9500, 4816 }, { 0, 9539, 4817 }, { 0, 9546, 4818 },
+    { 0, 9494, 4819 }, { 0, 9495, 4820 }, { 0, 9497, 4821 }, { 0, 9532, 4822 },
+    { 0, 9498, 4823 }, { 0, 9520, 4824 }, { 0, 9521, 4825 }, { 0, 9499, 4826 },
+    { 0, 9501, 4830 }, { 0, 9503, 4833 }, { 0, 9522, 4834 }, { 0, 9502, 4835 },
+    { 0, 9504, 4836 }, { 0, 9505, 4838 }, { 0, 9506, 4839 }, { 16371, 9507, -1 },
+    { 0, 9508, 4841 }, { 0, 9515, 4842 }, { 0, 9516, 4843 }, { 0, 9509, 4844 },
+    { 16372, 9510, -1 }, { 0, 9511, 4857 }, { 0, 9512, 4859 }, { 16373, 9513, -1 },
+    { 16376, 9514, -1 }, { 0, 9518, 4865 }, { 16374, 9519, -1 }, { 0, 9523, 4872 },
+    { 0, 9524, 4873 }, { 0, 9573, 4874 }, { 0, 9525, 4875 }, { 0, 9526, 4876 },
+    { 0, 9527, 4877 }, { 0, 9582, 4878 }, { 16376, 9528, -1 }, { 0, 9529, 4882 },
+    { 0, 9531, 4883 }, { 16380, 9533, 4886 }, { 16376, 9530, -1 }, { 0, 9549, 4890 },
+    { 0, 9585, 4891 }, { 0, 9534, 4893 }, { 0, 9535, 4894 }, { 0, 9555, 4895 },
+    { 0, 9536, 4896 }, { 0, 9559, 4897 }, { 0, 9566, 4899 }, { 0, 9537, 4901 },
+    { 0, 9531, 4884 }, { 0, 9540, 4902 }, { 16380, 9568, -1 }, { 0, 9538, 4904 },
+    { 0, 9541, 4905 }, { 0, 9559, 4898 }, { 0, 9542, 4906 }, { 0, 9543, 4907 },
+    { 16380, 9544, 4909 }, { 0, 9545, 4912 }, { 16384, 9601, -1 }, { 0, 9547, 4914 },
+    { 0, 9548, 4915 }, { 0, 9553, 4916 }, { 16382, 9550, -1 }, { 0, 9530, 4889 },
+    { 0, 9590, 4918 }, { 0, 9551, 4919 }, { 0, 9552, 4921 }, { 16386, 9554, -1 },
+    { 0, 9556, 4923 }, { 0, 9557, 4924 }, { 0, 9558, 4925 }, { 0, 9560, 4928 },
+    { 0, 9561, 4929 }, { 0, 9562, 4930 }, { 0, 9563, 4932 }, { 16384, 9564, -1 },
+    { 16383, 9565, -1 }, { 0, 9567, 4935 }, { 0, 9566, 4900 }, { 0, 9569, 4938 },
+    { 0, 9570, 4939 }, { 0, 9571, 4942 }, { 0, 9572, 4947 }, { 0, 9574, 4952 },
+    { 0, 9531, 4885 }, { 0, 9575, 4957 }, { 0, 9576, 4959 }, { 0, 9577, 4963 },
+    { 0, 9578, 4974 }, { 16388, 9579, -1 }, { 0, 9585, 4892 }, { 16389, 9580, -1 },
+    { 0, 9581, 4979 }, { 0, 9583, 4980 }, { 16391, 9584, -1 }, { 0, 9586, 4993 },
+    { 0, 9587, 4996 }, { 0, 9588, 4998 }, { 0, 9589, 4999 }, { 0, 9635, 5000 },
+    { 0, 9591, 5001 }, { 0, 9592, 5003 }, { 0, 9593, 5006 }, { 16389, 9594, -1 },
+    { 0, 9595, 5014 }, { 0, 9596, 5020 }, { 0, 9608, 5021 }, { 0, 9655, 5022 },
+    { 0, 9597, 5023 }, { 0, 9636, 5025 }, { 0, 9599, 5026 }, { 0, 9609, 5027 },
+    { 0, 9598, 5028 }, { 0, 9621, 5029 }, { 0, 9641, 5030 }, { 0, 9600, 5031 },
+    { 0, 9597, 5024 }, { 0, 9606, 5032 }, { 0, 9602, 5039 }, { 0, 9603, 5048 },
+    { 0, 9604, 5051 }, { 0, 9605, 5052 }, { 0, 9616, 5053 }, { 16391, 9587, -1 },
+    { 0, 9620, 5054 }, { 16393, 9607, -1 }, { 0, 9610, 5056 }, { 0, 9633, 5057 },
+    { 0, 9611, 5058 }, { 16394, 9612, -1 }, { 0, 9613, 5066 }, { 0, 9614, 5068 },
+    { 0, 9615, 5079 }, { 0, 9617, 5088 }, { 0, 9673, 5089 }, { 0, 9618, 5093 },
+    { 0, 9625, 5094 }, { 0, 9619, 5095 }, { 0, 9630, 5096 }, { 0, 9622, 5103 },
+    { 0, 9623, 5105 }, { 0, 9624, 5106 }, { 0, 9626, 5109 }, { 0, 9627, 5119 },
+    { 0, 9628, 5134 }, { 0, 9629, 5135 }, { 0, 9631, 5136 }, { 16394, 9632, -1 },
+    { 0, 9634, 5143 }, { 0, 9637, 5144 }, { 0, 9640, 5145 }, { 0, 9638, 5146 },
+    { 0, 9643, 5147 }, { 0, 9645, 5148 }, { 0, 9639, 5151 }, { 0, 9642, 5152 },
+    { 0, 9644, 5153 }, { 0, 9646, 5155 }, { 0, 9647, 5156 }, { 0, 9672, 5157 },
+    { 0, 9648, 5158 }, { 0, 9649, 5159 }, { 16392, 9667, 5160 }, { 0, 9668, 5162 },
+    { 0, 9650, 5163 }, { 16393, 9651, -1 }, { 0, 9652, 5165 }, { 0, 9653, 5166 },
+    { 16398, 9654, -1 }, { 0, 9656, 5168 }, { 0, 9657, 5169 }, { 0, 9658, 5170 },
+    { 0, 9659, 5172 }, { 0, 9660, 5180 }, { 0, 9661, 5181 }, { 16395, 9662, -1 },
+    { 0, 9663, 5186 }, { 0, 9664, 5187 }, { 0, 9679, 5188 }, { 16396, 9665, -1 },
+    { 0, 9666, 5190 }, { 0, 9669, 5191 }, { 0, 9670, 5193 }, { 0, 9671, 5195 },
+    { 16400, 9674, -1 }, { 16399, 9675, -1 }, { 0, 9677, 5199 }, { 0, 9676, 5201 },
+    { 0, 9678, 5206 }, { 0, 9680, 5207 }, { 16399, 9681, -1 }, { 0, 9682, 5210 },
+    { 0, 9683, 5212 }, { 0, 9684, 5213 }, { 0, 9685, 5214 }, { 0, 9686, 5215 },
+    { 0, 9715, 5216 }, { 16404, 9688, -1 }, { 0, 9694, 5218 }, { 0, 9716, 5219 },
+    { 16402, 9687, -1 }, { 0, 9713, 5221 }, { 0, 9723, 5222 }, { 0, 9689, 5228 },
+    { 0, 9723, 5223 }, { 16406, 9690, -1 }, { 0, 9742, 5230 }, { 0, 9691, 5232 },
+    { 0, 9692, 5233 }, { 16404, 9695, -1 }, { 0, 9696, 5237 }, { 0, 9697, 5238 },
+    { 16408, 9693, -1 }, { 0, 9703, 5240 }, { 0, 9733, 5241 }, { 0, 9750, 5242 },
+    { 0, 9751, 5243 }, { 0, 9698, 5244 }, { 0, 9699, 5245 }, { 0, 9700, 5246 },
+    { 0, 9701, 5248 }, { 16405, 9702, -1 }, { 0, 9714, 5252 }, { 0, 9704, 5256 },
+    { 0, 9705, 5257 }, { 0, 9706, 5259 }, { 16409, 9707, -1 }, { 16412, 9708, -1 },
+    { 0, 9709, 5265 }, { 0, 9710, 5266 }, { 0, 9711, 5267 }, { 0, 9712, 5268 },
+    { 0, 9717, 5269 }, { 0, 9718, 5270 }, { 0, 9719, 5272 }, { 0, 9700, 5247 },
+    { 0, 9720, 5277 }, { 0, 9721, 5278 }, { 0, 9722, 5280 }, { 0, 9724, 5281 },
+    { 16413, 9725, -1 }, { 0, 9726, 5283 }, { 16410, 9727, -1 }, { 0, 9728, 5285 },
+    { 0, 9729, 5286 }, { 16414, 9730, -1 }, { 16415, 9731, -1 }, { 0, 9734, 5290 },
+    { 0, 9741, 5291 }, { 0, 9744, 5292 }, { 0, 9759, 5293 }, { 16416, 9773, -1 },
+    { 16418, 9782, -1 }, { 0, 9787, 5301 }, { 0, 9789, 5302 }, { 16418, 9732, -1 },
+    { 16416, 9752, -1 }, { 16421, 9769, -1 }, { 0, 9735, 5306 }, { 16422, 9746, -1 },
+    { 0, 9740, 5308 }, { 16424, 9743, -1 }, { 16423, 9745, -1 }, { 0, 9736, 5311 },
+    { 0, 9737, 5312 }, { 16425, 9738, -1 }, { 0, 9739, 5316 }, { 0, 9747, 5318 },
+    { 0, 9748, 5319 }, { 0, 9749, 5321 }, { 0, 9753, 5323 }, { 0, 9754, 5325 },
+    { 0, 9773, 5295 }, { 0, 9755, 5326 }, { 16427, 9756, -1 }, { 0, 9757, 5330 },
+    { 0, 9758, 5331 }, { 0, 9760, 5333 }, { 0, 9761, 5337 }, { 0, 9767, 5338 },
+    { 16424, 9806, -1 }, { 16426, 9762, -1 }, { 16425, 9763, -1 }, { 0, 9764, 5342 },
+    { 0, 9765, 5343 }, { 16430, 9788, -1 }, { 0, 9766, 5351 }, { 0, 9768, 5352 },
+    { 0, 9770, 5353 }, { 0, 9771, 5356 }, { 0, 9772, 5357 }, { 0, 9774, 5358 },
+    { 0, 9775, 5359 }, { 0, 9776, 5360 }, { 0, 9777, 5361 }, { 0, 9778, 5363 },
+    { 0, 9779, 5365 }, { 16430, 9780, -1 }, { 0, 9781, 5367 }, { 0, 9783, 5368 },
+    { 0, 9801, 5369 }, { 0, 9816, 5370 }, { 16432, 9786, -1 }, { 0, 9807, 5372 },
+    { 0, 9808, 5373 }, { 0, 9814, 5374 }, { 0, 9784, 5375 }, { 0, 9785, 5376 },
+    { 0, 9790, 5378 }, { 0, 9791, 5384 }, { 0, 9792, 5385 }, { 0, 9843, 5386 },
+    { 0, 9793, 5387 }, { 16429, 9794, -1 }, { 0, 9795, 5390 }, { 0, 9796, 5391 },
+    { 0, 9797, 5394 }, { 0, 9798, 5395 }, { 0, 9799, 5396 }, { 16430, 9800, -1 },
+    { 0, 9802, 5405 }, { 0, 9803, 5406 }, { 0, 9804, 5407 }, { 0, 9813, 5408 },
+    { 0, 9823, 5409 }, { 16432, 9805, -1 }, { 16436, 9824, -1 }, { 0, 9830, 5412 },
+    { 0, 9836, 5413 }, { 0, 9809, 5414 }, { 0, 9810, 5415 }, { 0, 9815, 5417 },
+    { 0, 9811, 5422 }, { 0, 9812, 5424 }, { 0, 9817, 5431 }, { 0, 9837, 5433 },
+    { 16437, 9840, -1 }, { 0, 9841, 5436 }, { 0, 9842, 5437 }, { 0, 9844, 5438 },
+    { 0, 9845, 5440 }, { 0, 9846, 5441 }, { 0, 9848, 5442 }, { 0, 9849, 5443 },
+    { 0, 9851, 5444 }, { 0, 9853, 5445 }, { 0, 9796, 5392 }, { 0, 9868, 5446 },
+    { 0, 9873, 5447 }, { 0, 9877, 5448 }, { 0, 9878, 5449 }, { 0, 9881, 5450 },
+    { 0, 9888, 5451 }, { 0, 9890, 5452 }, { 0, 9892, 5453 }, { 0, 9850, 5454 },
+    { 0, 9810, 5416 }, { 0, 9858, 5455 }, { 0, 9871, 5456 }, { 0, 9872, 5457 },
+    { 0, 9879, 5458 }, { 16440, 9885, -1 }, { 0, 9898, 5461 }, { 0, 9900, 5462 },
+    { 0, 9904, 5463 }, { 0, 9906, 5464 }, { 0, 9902, 5465 }, { 0, 9907, 5467 },
+    { 0, 9909, 5468 }, { 0, 9912, 5469 }, { 0, 9885, 5460 }, { 0, 9817, 5432 },
+    { 0, 9913, 5470 }, { 0, 9919, 5471 }, { 0, 9920, 5472 }, { 0, 9924, 5473 },
+    { 0, 9932, 5474 }, { 0, 9938, 5475 }, { 0, 9939, 5476 }, { 0, 9943, 5477 },
+    { 0, 9944, 5478 }, { 0, 9951, 5479 }, { 0, 9954, 5480 }, { 0, 9820, 5481 },
+    { 0, 9822, 5482 }, { 0, 9826, 5483 }, { 0, 9827, 5484 }, { 0, 9847, 5485 },
+    { 0, 9866, 5486 }, { 0, 9862, 5488 }, { 0, 9864, 5489 }, { 0, 9875, 5490 },
+    { 0, 9876, 5491 }, { 16438, 9844, -1 }, { 16441, 9886, -1 }, { 0, 9894, 5493 },
+    { 16441, 9818, -1 }, { 0, 9819, 5496 }, { 16443, 9821, -1 }, { 0, 9825, 5507 },
+    { 0, 9902, 5466 }, { 0, 9828, 5508 }, { 0, 9829, 5509 }, { 16441, 9831, -1 },
+    { 0, 9866, 5487 }, { 16445, 9832, -1 }, { 16446, 9833, 5513 }, { 0, 9834, 5517 },
+    { 0, 9835, 5519 }, { 0, 9838, 5521 }, { 0, 9839, 5523 }, { 16444, 9852, -1 },
+    { 0, 9854, 5525 }, { 16448, 9855, -1 }, { 16449, 9856, -1 }, { 0, 9857, 5529 },
+    { 0, 9859, 5534 }, { 16447, 9860, -1 }, { 0, 9882, 5536 }, { 0, 9874, 5537 },
+    { 16450, 9891, -1 }, { 16448, 9896, -1 }, { 16450, 9916, -1 }, { 0, 9922, 5542 },
+    { 0, 9867, 5543 }, { 0, 9869, 5544 }, { 0, 9870, 5545 }, { 0, 9916, 5541 },
+    { 0, 9863, 5546 }, { 0, 9865, 5547 }, { 16453, 9880, -1 }, { 0, 9899, 5550 },
+    { 0, 9914, 5551 }, { 0, 9928, 5552 }, { 0, 9861, 5553 }, { 0, 9883, 5554 },
+    { 0, 9884, 5555 }, { 0, 9887, 5556 }, { 0, 9889, 5557 }, { 0, 9893, 5559 },
+    { 0, 9895, 5565 }, { 0, 9897, 5566 }, { 16455, 9901, -1 }, { 16455, 9903, -1 },
+    { 16456, 9905, -1 }, { 0, 9908, 5577 }, { 0, 9910, 5579 }, { 0, 9911, 5580 },
+    { 0, 9915, 5582 }, { 16458, 9917, -1 }, { 0, 9918, 5585 }, { 0, 9908, 5578 },
+    { 0, 9921, 5587 }, { 0, 9923, 5588 }, { 0, 9925, 5593 }, { 16458, 9926, -1 },
+    { 0, 9927, 5602 }, { 16459, 9929, -1 }, { 16462, 9930, -1 }, { 0, 9931, 5611 },
+    { 16460, 9933, -1 }, { 0, 9934, 5614 }, { 0, 9936, 5620 }, { 0, 9945, 5621 },
+    { 0, 9935, 5622 }, { 16461, 9937, -1 }, { 0, 9940, 5627 }, { 0, 9941, 5628 },
+    { 16462, 9942, -1 }, { 0, 9961, 5634 }, { 0, 9946, 5637 }, { 0, 9947, 5638 },
+    { 0, 9948, 5639 }, { 0, 9949, 5640 }, { 0, 9950, 5642 }, { 16466, 9952, -1 },
+    { 0, 9953, 5644 }, { 16466, 9955, -1 }, { 0, 9956, 5648 }, { 0, 9957, 5649 },
+    { 16465, 9977, -1 }, { 0, 9958, 5651 }, { 0, 9963, 5652 }, { 0, 9971, 5653 },
+    { 0, 9992, 5654 }, { 0, 10013, 5655 }, { 0, 10015, 5656 }, { 0, 10019, 5657 },
+    { 0, 10020, 5658 }, { 0, 9959, 5659 }, { 0, 9983, 5660 }, { 0, 9960, 5661 },
+    { 16469, 9972, -1 }, { 0, 9973, 5664 }, { 16470, 9964, -1 }, { 0, 9979, 5666 },
+    { 0, 10007, 5667 }, { 0, 9962, 5668 }, { 0, 9969, 5669 }, { 0, 9980, 5670 },
+    { 0, 9981, 5671 }, { 0, 9965, 5673 }, { 0, 9966, 5677 }, { 0, 9967, 5678 },
+    { 0, 9968, 5679 }, { 16472, 9970, -1 }, { 0, 9991, 5686 }, { 0, 9974, 5687 },
+    { 0, 9975, 5689 }, { 0, 10024, 5690 }, { 0, 9976, 5692 }, { 0, 9978, 5697 },
+    { 0, 9984, 5700 }, { 0, 9985, 5701 }, { 16469, 9988, -1 }, { 0, 10021, 5703 },
+    { 0, 9986, 5704 }, { 0, 10017, 5705 }, { 0, 9982, 5706 }, { 0, 9987, 5707 },
+    { 16475, 9989, -1 }, { 0, 9990, 5709 }, { 0, 9997, 5710 }, { 16475, 9993, -1 },
+    { 0, 9995, 5712 }, { 16475, 9994, -1 }, { 16478, 9996, -1 }, { 0, 9998, 5717 },
+    { 0, 9999, 5719 }, { 16476, 10000, -1 }, { 0, 10001, 5733 }, { 16482, 10002, -1 },
+    { 16479, 10003, -1 }, { 0, 10004, 5737 }, { 0, 10005, 5738 }, { 0, 10006, 5740 },
+    { 0, 10008, 5742 }, { 16480, 10009, -1 }, { 16481, 10010, -1 }, { 0, 10011, 5745 },
+    { 16486, 10012, -1 }, { 0, 10014, 5749 }, { 16482, 10016, -1 }, { 16483, 10018, -1 },
+    { 16484, 10022, -1 }, { 0, 10023, 5753 }, { 16486, 10025, -1 }, { 0, 10026, 5757 },
+    { 0, 10027, 5760 }, { 16487, 10028, -1 }, { 0, 10029, 5780 }, { 0, 10030, 5792 },
+    { 0, 10031, 5801 }, { 0, 10032, 5802 }, { 0, 10033, 5803 }, { 0, 10034, 5807 },
+    { 0, 10035, 5811 }, { 0, 10036, 5813 }, { 0, 10037, 5814 }, { 0, 10038, 5817 },
+    { 0, 10041, 5818 }, { 0, 10039, 5819 }, { 0, 10040, 5820 }, { 0, 10042, 5824 },
+    { 0, 10043, 5825 }, { 16490, 10044, -1 }, { 0, 10045, 5838 }, { 16492, 10046, -1 },
+    { 0, 10047, 5841 }, { 0, 10048, 5847 }, { 0, 10049, 5849 }, { 16494, 10050, -1 },
+    { 0, 10071, 5851 }, { 0, 10051, 5856 }, { 0, 10052, 5860 }, { 16494, 10053, -1 },
+    { 0, 10054, 5865 }, { 0, 10055, 5867 }, { 0, 10056, 5874 }, { 0, 10057, 5875 },
+    { 16493, 10058, -1 }, { 0, 10059, 5882 }, { 0, 10060, 5883 }, { 0, 10061, 5884 },
+    { 0, 10062, 5890 }, { 0, 10063, 5893 }, { 16496, 10064, -1 }, { 0, 10065, 5927 },
+    { 16494, 10066, -1 }, { 0, 10067, 5939 }, { 0, 10068, 5940 }, { 16498, 10072, -1 },
+    { 0, 10069, 5942 }, { 0, 10076, 5944 }, { 0, 10086, 5945 }, { 0, 10070, 5946 },
+    { 0, 10070, 5947 }, { 0, 10081, 5948 }, { 0, 10073, 5949 }, { 0, 10090, 5950 },
+    { 0, 10101, 5951 }, { 0, 10113, 5952 }, { 0, 10114, 5954 }, { 0, 10075, 5955 },
+    { 0, 10078, 5956 }, { 0, 10069, 5943 }, { 0, 10080, 5957 }, { 0, 10115, 5958 },
+    { 16500, 10119, -1 }, { 0, 10113, 5953 }, { 0, 10074, 5961 }, { 0, 10100, 5962 },
+    { 16496, 10119, -1 }, { 0, 10108, 5963 }, { 0, 10077, 5964 }, { 16499, 10079, 5965 },
+    { 0, 10082, 5967 }, { 0, 10083, 5968 }, { 0, 10084, 5969 }, { 0, 10085, 5970 },
+    { 16500, 10087, -1 }, { 0, 10088, 5979 }, { 0, 10089, 5984 }, { 0, 10091, 5987 },
+    { 16502, 10092, -1 }, { 0, 10093, 5992 }, { 0, 10094, 6001 }, { 0, 10097, 6002 },
+    { 0, 10102, 6003 }, { 0, 10095, 6008 }, { 0, 10096, 6011 }, { 0, 10098, 6015 },
+    { 0, 10099, 6026 }, { 0, 10103, 6031 }, { 0, 10104, 6032 }, { 0, 10105, 6033 },
+    { 0, 10106, 6037 }, { 16502, 10111, -1 }, { 0, 10112, 6051 }, { 0, 10116, 6052 },
+    { 16506, 10107, 6053 }, { 0, 10109, 6055 }, { 0, 10110, 6056 }, { 0, 10146, 6057 },
+    { 0, 10117, 6058 }, { 0, 10118, 6060 }, { 0, 10122, 6061 }, { 0, 10123, 6062 },
+    { 0, 10129, 6063 }, { 0, 10138, 6064 }, { 0, 10120, 6065 }, { 0, 10121, 6069 },
+    { 0, 10124, 6071 }, { 16504, 10125, -1 }, { 16507, 10126, -1 }, { 0, 10144, 6075 },
+    { 16508, 10127, -1 }, { 16509, 10174, -1 }, { 0, 10128, 6079 }, { 16509, 10130, -1 },
+    { 0, 10131, 6081 }, { 0, 10148, 6082 }, { 16510, 10132, -1 }, { 0, 10117, 6059 },
+    { 0, 10133, 6086 }, { 0, 10134, 6090 }, { 0, 10135, 6091 }, { 0, 10136, 6093 },
+    { 16512, 10137, -1 }, { 0, 10139, 6095 }, { 0, 10159, 6096 }, { 0, 10140, 6111 },
+    { 0, 10141, 6115 }, { 16509, 10142, -1 }, { 16510, 10143, -1 }, { 0, 10145, 6119 },
+    { 0, 10147, 6122 }, { 0, 10149, 6124 }, { 0, 10150, 6127 }, { 0, 10151, 6128 },
+    { 16515, 10164, -1 }, { 0, 10152, 6132 }, { 0, 10162, 6133 }, { 0, 10153, 6145 },
+    { 16515, 10154, -1 }, { 0, 10155, 6176 }, { 0, 10156, 6177 }, { 0, 10161, 6178 },
+    { 0, 10161, 6179 }, { 0, 10157, 6180 }, { 0, 10177, 6181 }, { 0, 10195, 6183 },
+    { 0, 10208, 6184 }, { 0, 10158, 6185 }, { 0, 10183, 6186 }, { 0, 10165, 6187 },
+    { 0, 10179, 6189 }, { 16518, 10160, -1 }, { 0, 10163, 6192 }, { 0, 10166, 6194 },
+    { 0, 10167, 6197 }, { 0, 10168, 6200 }, { 0, 10169, 6202 }, { 16514, 10188, -1 },
+    { 16517, 10170, -1 }, { 0, 10171, 6208 }, { 0, 10173, 6210 }, { 0, 10177, 6182 },
+    { 0, 10180, 6211 }, { 0, 10172, 6212 }, { 16518, 10175, 6214 }, { 16523, 10178, -1 },
+    { 16519, 10176, 6217 }, { 0, 10181, 6219 }, { 0, 10192, 6220 }, { 0, 10165, 6188 },
+    { 0, 10182, 6222 }, { 16523, 10184, -1 }, { 0, 10185, 6225 }, { 16525, 10186, -1 },
+    { 0, 10187, 6229 }, { 0, 10232, 6230 }, { 0, 10189, 6231 }, { 0, 10190, 6232 },
+    { 16526, 10191, -1 }, { 16524, 10193, -1 }, { 0, 10194, 6238 }, { 0, 10199, 6239 },
+    { 16525, 10196, -1 }, { 0, 10197, 6242 }, { 0, 10198, 6243 }, { 16526, 10200, -1 },
+    { 0, 10201, 6246 }, { 0, 10202, 6249 }, { 16529, 10203, -1 }, { 0, 10204, 6251 },
+    { 0, 10205, 6253 }, { 0, 10206, 6254 }, { 0, 10229, 6255 }, { 0, 10250, 6256 },
+    { 16527, 10255, -1 }, { 16531, 10207, -1 }, { 16530, 10209, 6260 }, { 0, 10210, 6264 },
+    { 0, 10211, 6265 }, { 16530, 10212, -1 }, { 0, 10213, 6268 }, { 0, 10264, 6269 },
+    { 0, 10214, 6271 }, { 0, 10215, 6272 }, { 16533, 10216, -1 }, { 16538, 10217, -1 },
+    { 16534, 10218, -1 }, { 16537, 10219, 6278 }, { 0, 10220, 6280 }, { 0, 10222, 6281 },
+    { 0, 10221, 6282 }, { 16540, 10223, -1 }, { 0, 10224, 6289 }, { 0, 10225, 6290 },
+    { 0, 10227, 6291 }, { 0, 10244, 6293 }, { 16542, 10246, -1 }, { 0, 10247, 6295 },
+    { 0, 10276, 6296 }, { 0, 10227, 6292 }, { 0, 10226, 6297 }, { 0, 10228, 6298 },
+    { 0, 10234, 6299 }, { 0, 10236, 6300 }, { 0, 10252, 6301 }, { 0, 10254, 6302 },
+    { 0, 10272, 6303 }, { 0, 10273, 6304 }, { 16541, 10274, -1 }, { 0, 10275, 6306 },
+    { 0, 10231, 6307 }, { 0, 10233, 6308 }, { 0, 10237, 6309 }, { 0, 10253, 6310 },
+    { 0, 10269, 6311 }, { 0, 10288, 6312 }, { 0, 10289, 6313 }, { 0, 10241, 6314 },
+    { 0, 10242, 6315 }, { 0, 10256, 6316 }, { 0, 10238, 6317 }, { 16544, 10239, 6318 },
+    { 0, 10243, 6324 }, { 0, 10259, 6325 }, { 0, 10261, 6327 }, { 0, 10295, 6328 },
+    { 0, 10230, 6329 }, { 16546, 10235, -1 }, { 16546, 10286, -1 }, { 0, 10240, 6336 },
+    { 0, 10245, 6339 }, { 0, 10248, 6341 }, { 16549, 10249, -1 }, { 0, 10259, 6326 },
+    { 0, 10251, 6343 }, { 16549, 10257, -1 }, { 0, 10258, 6345 }, { 0, 10260, 6346 },
+    { 0, 10287, 6347 }, { 0, 10262, 6348 }, { 0, 10266, 6349 }, { 0, 10277, 6350 },
+    { 16548, 10263, -1 }, { 0, 10265, 6353 }, { 0, 10267, 6358 }, { 0, 10268, 6359 },
+    { 0, 10270, 6360 }, { 0, 10278, 6361 }, { 0, 10279, 6363 }, { 0, 10282, 6364 },
+    { 0, 10283, 6365 }, { 0, 10285, 6366 }, { 0, 10291, 6367 }, { 0, 10294, 6368 },
+    { 0, 10296, 6370 }, { 0, 10298, 6371 }, { 0, 10300, 6372 }, { 0, 10301, 6373 },
+    { 0, 10313, 6374 }, { 0, 10294, 6369 }, { 0, 10314, 6375 }, { 0, 10323, 6376 },
+    { 0, 10347, 6377 }, { 0, 10348, 6378 }, { 0, 10315, 6379 }, { 0, 10316, 6381 },
+    { 0, 10318, 6382 }, { 0, 10321, 6383 }, { 0, 10322, 6385 }, { 0, 10324, 6386 },
+    { 0, 10326, 6387 }, { 0, 10330, 6388 }, { 16549, 10336, -1 }, { 0, 10337, 6391 },
+    { 16553, 10344, -1 }, { 0, 10352, 6393 }, { 0, 10354, 6394 }, { 0, 10335, 6395 },
+    { 0, 10342, 6396 }, { 0, 10345, 6397 }, { 16552, 10350, -1 }, { 0, 10356, 6400 },
+    { 0, 10357, 6401 }, { 0, 10361, 6402 }, { 16554, 10362, -1 }, { 0, 10315, 6380 },
+    { 0, 10369, 6405 }, { 16555, 10371, -1 }, { 0, 10321, 6384 }, { 0, 10350, 6399 },
+    { 0, 10382, 6408 }, { 0, 10388, 6409 }, { 0, 10389, 6410 }, { 0, 10363, 6411 },
+    { 0, 10278, 6362 }, { 0, 10361, 6403 }, { 0, 10365, 6413 }, { 0, 10366, 6414 },
+    { 0, 10367, 6415 }, { 0, 10368, 6417 }, { 0, 10375, 6418 }, { 16557, 10363, -1 },
+    { 0, 10386, 6420 }, { 0, 10367, 6416 }, { 0, 10399, 6422 }, { 0, 10400, 6423 },
+    { 0, 10405, 6424 }, { 0, 10416, 6425 }, { 0, 10290, 6427 }, { 0, 10297, 6428 },
+    { 0, 10336, 6390 }, { 0, 10309, 6429 }, { 0, 10317, 6430 }, { 0, 10325, 6431 },
+    { 0, 10271, 6433 }, { 16557, 10334, -1 }, { 0, 10416, 6426 }, { 0, 10359, 6436 },
+    { 0, 10379, 6439 }, { 0, 10372, 6437 }, { 16558, 10381, -1 }, { 0, 10383, 6442 },
+    { 0, 10284, 6443 }, { 0, 10328, 6444 }, { 16557, 10280, -1 }, { 0, 10281, 6446 },
+    { 0, 10310, 6447 }, { 0, 10386, 6421 }, { 0, 10372, 6438 }, { 0, 10339, 6448 },
+    { 0, 10325, 6432 }, { 16561, 10304, -1 }, { 0, 10327, 6451 }, { 0, 10333, 6452 },
+    { 0, 10292, 6453 }, { 0, 10375, 6419 }, { 0, 10320, 6454 }, { 0, 10302, 6455 },
+    { 0, 10303, 6456 }, { 0, 10349, 6457 }, { 16558, 10293, -1 }, { 0, 10299, 6459 },
+    { 0, 10305, 6460 }, { 0, 10306, 6461 }, { 16562, 10307, -1 }, { 0, 10308, 6463 },
+    { 16560, 10329, -1 }, { 0, 10332, 6465 }, { 0, 10353, 6466 }, { 16563, 10355, -1 },
+    { 0, 10341, 6468 }, { 16567, 10364, -1 }, { 0, 10311, 6478 }, { 0, 10379, 6440 },
+    { 0, 10373, 6496 }, { 0, 10373, 6497 }, { 16566, 10374, -1 }, { 0, 10373, 6498 },
+    { 0, 10378, 6501 }, { 0, 10376, 6502 }, { 0, 10380, 6503 }, { 0, 10387, 6504 },
+    { 16565, 10390, -1 }, { 0, 10394, 6507 }, { 16570, 10403, -1 }, { 0, 10408, 6509 },
+    { 0, 10410, 6510 }, { 0, 10411, 6512 }, { 0, 10412, 6514 }, { 0, 10424, 6515 },
+    { 16571, 10430, -1 }, { 0, 10433, 6518 }, { 0, 10436, 6519 }, { 0, 10437, 6520 },
+    { 0, 10438, 6521 }, { 0, 10396, 6522 }, { 0, 10397, 6523 }, { 0, 10411, 6513 },
+    { 0, 10430, 6517 }, { 0, 10409, 6524 }, { 0, 10390, 6506 }, { 0, 10413, 6525 },
+    { 0, 10420, 6526 }, { 0, 10429, 6527 }, { 0, 10432, 6528 }, { 0, 10442, 6529 },
+    { 0, 10452, 6530 }, { 0, 10431, 6531 }, { 0, 10443, 6532 }, { 0, 10445, 6533 },
+    { 0, 10455, 6534 }, { 0, 10456, 6535 }, { 0, 10464, 6537 }, { 0, 10487, 6538 },
+    { 0, 10490, 6539 }, { 0, 10398, 6540 }, { 0, 10423, 6541 }, { 0, 10426, 6542 },
+    { 0, 10427, 6545 }, { 0, 10441, 6546 }, { 0, 10451, 6547 }, { 0, 10415, 6548 },
+    { 16573, 10440, -1 }, { 0, 10444, 6550 }, { 0, 10448, 6551 }, { 0, 10471, 6552 },
+    { 0, 10475, 6553 }, { 0, 10312, 6558 }, { 0, 10319, 6559 }, { 16573, 10331, -1 },
+    { 0, 10338, 6576 }, { 0, 10475, 6554 }, { 0, 10370, 6577 }, { 0, 10410, 6511 },
+    { 0, 10406, 6578 }, { 0, 10340, 6594 }, { 0, 10358, 6595 }, { 0, 10360, 6596 },
+    { 0, 10343, 6619 }, { 0, 10346, 6620 }, { 0, 10351, 6621 }, { 0, 10377, 6623 },
+    { 0, 10384, 6640 }, { 0, 10456, 6536 }, { 0, 10417, 6644 }, { 16568, 10426, 6543 },
+    { 0, 10418, 6645 }, { 0, 10446, 6646 }, { 0, 10467, 6647 }, { 0, 10385, 6648 },
+    { 0, 10391, 6653 }, { 0, 10392, 6654 }, { 0, 10393, 6657 }, { 16575, 10395, -1 },
+    { 0, 10401, 6670 }, { 0, 10402, 6674 }, { 0, 10414, 6675 }, { 0, 10425, 6676 },
+    { 0, 10421, 6698 }, { 0, 10453, 6699 }, { 0, 10462, 6700 }, { 0, 10404, 6701 },
+    { 0, 10407, 6704 }, { 16577, 10419, -1 }, { 16577, 10422, -1 }, { 0, 10360, 6597 },
+    { 0, 10428, 6764 }, { 0, 10447, 6769 }, { 0, 10454, 6770 }, { 16575, 10434, -1 },
+    { 0, 10435, 6772 }, { 16579, 10439, -1 }, { 0, 10479, 6775 }, { 0, 10449, 6776 },
+    { 0, 10450, 6783 }, { 0, 10457, 6784 }, { 16576, 10458, -1 }, { 0, 10511, 6789 },
+    { 0, 10459, 6790 }, { 16581, 10460, -1 }, { 16582, 10461, -1 }, { 16583, 10463, -1 },
+    { 16582, 10465, -1 }, { 0, 10466, 6802 }, { 0, 10468, 6803 }, { 0, 10469, 6805 },
+    { 0, 10470, 6814 }, { 0, 10472, 6836 }, { 0, 10519, 6837 }, { 0, 10473, 6838 },
+    { 16582, 10496, -1 }, { 0, 10474, 6840 }, { 0, 10476, 6841 }, { 0, 10477, 6843 },
+    { 16582, 10478, -1 }, { 0, 10480, 6846 }, { 0, 10523, 6847 }, { 16583, 10481, -1 },
+    { 0, 10482, 6849 }, { 0, 10483, 6852 }, { 0, 10484, 6853 }, { 0, 10485, 6856 },
+    { 0, 10486, 6859 }, { 16588, 10488, -1 }, { 0, 10489, 6861 }, { 16586, 10491, -1 },
+    { 16587, 10492, -1 }, { 0, 10493, 6869 }, { 0, 10494, 6870 }, { 0, 10495, 6871 },
+    { 0, 10497, 6874 }, { 0, 10503, 6875 }, { 0, 10498, 6879 }, { 0, 10499, 6880 },
+    { 0, 10504, 6881 }, { 16590, 10500, -1 }, { 0, 10505, 6883 }, { 0, 10507, 6884 },
+    { 0, 10510, 6885 }, { 0, 10506, 6886 }, { 0, 10508, 6887 }, { 0, 10517, 6888 },
+    { 0, 10555, 6889 }, { 0, 10501, 6890 }, { 16588, 10502, -1 }, { 0, 10509, 6893 },
+    { 16591, 10541, -1 }, { 0, 10512, 6895 }, { 0, 10513, 6896 }, { 16591, 10514, -1 },
+    { 0, 10515, 6899 }, { 0, 10516, 6901 }, { 0, 10518, 6902 }, { 0, 10520, 6904 },
+    { 0, 10521, 6906 }, { 0, 10522, 6907 }, { 0, 10524, 6908 }, { 0, 10525, 6909 },
+    { 0, 10526, 6910 }, { 0, 10527, 6911 }, { 0, 10528, 6912 }, { 0, 10529, 6915 },
+    { 0, 10530, 6916 }, { 16596, 10531, -1 }, { 0, 10532, 6918 }, { 0, 10533, 6919 },
+    { 16597, 10534, -1 }, { 16595, 10535, -1 }, { 16598, 10537, -1 }, { 0, 10538, 6925 },
+    { 16598, 10542, 6926 }, { 0, 10544, 6929 }, { 0, 10557, 6930 }, { 0, 10559, 6931 },
+    { 0, 10563, 6933 }, { 0, 10588, 6934 }, { 0, 10536, 6935 }, { 16600, 10547, -1 },
+    { 0, 10548, 6937 }, { 0, 10568, 6939 }, { 0, 10572, 6940 }, { 0, 10540, 6941 },
+    { 0, 10528, 6913 }, { 16601, 10561, -1 }, { 0, 10565, 6943 }, { 16604, 10571, -1 },
+    { 0, 10584, 6945 }, { 0, 10589, 6946 }, { 0, 10590, 6947 }, { 0, 10548, 6938 },
+    { 0, 10597, 6948 }, { 0, 10599, 6949 }, { 0, 10539, 6950 }, { 16601, 10543, 6951 },
+    { 0, 10545, 6953 }, { 0, 10546, 6955 }, { 0, 10545, 6954 }, { 0, 10549, 6957 },
+    { 0, 10550, 6959 }, { 16606, 10551, -1 }, { 0, 10552, 6964 }, { 0, 10554, 6967 },
+    { 16607, 10573, -1 }, { 0, 10553, 6972 }, { 16608, 10581, -1 }, { 0, 10556, 6980 },
+    { 16609, 10558, -1 }, { 0, 10560, 6984 }, { 0, 10562, 6985 }, { 0, 10577, 6986 },
+    { 16601, 10559, -1 }, { 0, 10566, 6987 }, { 0, 10574, 6988 }, { 0, 10564, 6989 },
+    { 0, 10569, 6990 }, { 0, 10586, 6991 }, { 0, 10567, 7000 }, { 0, 10570, 7001 },
+    { 0, 10575, 7004 }, { 16606, 10576, -1 }, { 16610, 10578, -1 }, { 0, 10579, 7013 },
+    { 0, 10580, 7024 }, { 0, 10582, 7028 }, { 0, 10583, 7030 }, { 16610, 10585, -1 },
+    { 16613, 10587, -1 }, { 0, 10591, 7039 }, { 16613, 10592, -1 }, { 0, 10595, 7044 },
+    { 16615, 10607, -1 }, { 0, 10586, 6992 }, { 0, 10636, 7046 }, { 16616, 10593, -1 },
+    { 0, 10594, 7048 }, { 16618, 10635, -1 }, { 0, 10596, 7050 }, { 0, 10598, 7056 },
+    { 0, 10600, 7057 }, { 16615, 10601, -1 }, { 16618, 10602, -1 }, { 0, 10603, 7062 },
+    { 16616, 10604, -1 }, { 0, 10605, 7064 }, { 16622, 10606, -1 }, { 0, 10628, 7066 },
+    { 0, 10608, 7070 }, { 0, 10609, 7071 }, { 0, 10617, 7072 }, { 0, 10619, 7073 },
+    { 0, 10610, 7074 }, { 0, 10611, 7075 }, { 0, 10612, 7076 }, { 16618, 10613, -1 },
+    { 0, 10624, 7085 }, { 0, 10655, 7086 }, { 0, 10614, 7092 }, { 0, 10615, 7099 },
+    { 16619, 10616, -1 }, { 0, 10618, 7108 }, { 0, 10620, 7109 }, { 0, 10621, 7119 },
+    { 16624, 10667, -1 }, { 0, 10622, 7121 }, { 0, 10623, 7123 }, { 0, 10625, 7124 },
+    { 0, 10626, 7125 }, { 0, 10627, 7140 }, { 0, 10629, 7146 }, { 0, 10630, 7149 },
+    { 0, 10631, 7179 }, { 16621, 10647, -1 }, { 0, 10659, 7181 }, { 16626, 10632, -1 },
+    { 0, 10633, 7186 }, { 0, 10683, 7187 }, { 16626, 10634, -1 }, { 0, 10637, 7189 },
+    { 0, 10638, 7190 }, { 0, 10639, 7191 }, { 0, 10640, 7192 }, { 0, 10641, 7193 },
+    { 0, 10642, 7194 }, { 0, 10643, 7195 }, { 0, 10644, 7196 }, { 0, 10645, 7198 },
+    { 16627, 10646, -1 }, { 0, 10648, 7202 }, { 16629, 10649, -1 }, { 0, 10650, 7204 },
+    { 0, 10651, 7206 }, { 0, 10652, 7207 }, { 0, 10653, 7248 }, { 16626, 10654, -1 },
+    { 16627, 10656, -1 }, { 16628, 10658, -1 }, { 0, 10660, 7277 }, { 16629, 10661, -1 },
+    { 0, 10682, 7279 }, { 16630, 10657, -1 }, { 16631, 10679, -1 }, { 0, 10662, 7284 },
+    { 16634, 10663, -1 }, { 16637, 10664, -1 }, { 0, 10665, 7308 }, { 0, 10666, 7313 },
+    { 0, 10668, 7315 }, { 0, 10669, 7333 }, { 0, 10670, 7334 }, { 0, 10671, 7344 },
+    { 0, 10672, 7349 }, { 16634, 10673, -1 }, { 16636, 10674, -1 }, { 16639, 10675, -1 },
+    { 16639, 10676, -1 }, { 0, 10677, 7355 }, { 0, 10678, 7356 }, { 16638, 10720, -1 },
+    { 16642, 10680, -1 }, { 16643, 10681, -1 }, { 0, 10684, 7360 }, { 0, 10685, 7363 },
+    { 16642, 10686, -1 }, { 0, 10687, 7370 }, { 16644, 10688, -1 }, { 0, 10689, 7373 },
+    { 0, 10690, 7375 }, { 0, 10691, 7376 }, { 0, 10692, 7379 }, { 16645, 10693, -1 },
+    { 16649, 10694, -1 }, { 0, 10696, 7384 }, { 0, 10695, 7397 }, { 16647, 10697, -1 },
+    { 0, 10698, 7399 }, { 16745, 10701, -1 }, { 16697, 10702, -1 }, { 16643, 10684, -1 },
+    { 16709, 10758, -1 }, { 16719, 10732, -1 }, { 16743, 10708, -1 }, { 16757, 10710, -1 },
+    { 16751, 10711, -1 }, { 16741, 10712, -1 }, { 16739, 10723, -1 }, { 16703, 10713, -1 },
+    { 16737, 10715, -1 }, { 16758, 10716, -1 }, { 16735, 10718, -1 }, { 16760, 10722, -1 },
+    { 16752, 10729, -1 }, { 16752, 10734, -1 }, { 16712, 10739, -1 }, { 16755, 10741, -1 },
+    { 16752, 10745, -1 }, { 16716, 10746, -1 }, { 16754, 10750, -1 }, { 16765, 10752, -1 },
+    { 16774, 10756, -1 }, { 16719, 10757, -1 }, { 16776, 10761, -1 }, { 16761, 10763, -1 },
+    { 16760, 10765, -1 }, { 16722, 10766, -1 }, { 16772, 10767, -1 }, { 16745, 10794, -1 },
+    { 16782, 10771, -1 }, { 16774, 10773, -1 }, { 16784, 10780, -1 }, { 16781, 10782, -1 },
+    { 16730, 10786, -1 }, { 16787, 10787, -1 }, { 16730, 10801, -1 }, { 16769, 10807, -1 },
+    { 16783, 10813, -1 }, { 16762, 10814, -1 }, { 16775, 10815, -1 }, { 16757, 10818, -1 },
+    { 16785, 10814, -1 }, { 16777, 10819, -1 }, { 16781, 10825, -1 }, { 16772, 10830, -1 },
+    { 16793, 10832, -1 }, { 16777, 10833, -1 }, { 16794, 10834, -1 }, { 16787, 10836, -1 },
+    { 16748, 10836, -1 }, { 16789, 10836, -1 }, { 16758, 10836, -1 }, { 16763, 10836, -1 },
+    { 16775, 10839, -1 }, { 16791, 10842, -1 }, { 16803, 10844, -1 }, { 16756, 10856, -1 },
+    { 16791, 10861, -1 }, { 16787, 10869, -1 }, { 16767, 10870, -1 }, { 16787, 10879, -1 },
+    { 16799, 10880, -1 }, { 16761, 10882, -1 }, { 16811, 10887, -1 }, { 16806, 10893, -1 },
+    { 16813, 10894, -1 }, { 16810, 10897, -1 }, { 16801, 10898, -1 }, { 16803, 10899, -1 },
+    { 16804, 10901, -1 }, { 16809, 10906, -1 }, { 16771, 10911, -1 }, { 16778, 10909, -1 },
+    { 16767, 10922, -1 }, { 16809, 10958, -1 }, { 16781, 10910, -1 }, { 16806, 10915, -1 },
+    { 16807, 10912, -1 }, { 16822, 10938, -1 }, { 16808, 10913, -1 }, { 16815, 10914, -1 },
+    { 16832, 10916, -1 }, { 16775, 10914, -1 }, { 16838, 10914, -1 }, { 16785, 10917, -1 },
+    { 16829, 10936, -1 }, { 16807, 10918, -1 }, { 16824, 10920, -1 }, { 16813, 10942, -1 },
+    { 16783, 10918, -1 }, { 16841, 10942, -1 }, { 16845, 10921, -1 }, { 16800, 10923, -1 },
+    { 16844, 10924, -1 }, { 16850, 10960, -1 }, { 16795, 10963, -1 }, { 16796, 10927, -1 },
+    { 16804, 10928, -1 }, { 16825, 10929, -1 }, { 16822, 10930, -1 }, { 16814, 10935, -1 },
+    { 16803, 10937, -1 }, { 16806, 10934, -1 }, { 16852, 10945, -1 }, { 16861, 10949, -1 },
+    { 16804, 10967, -1 }, { 16801, 10937, -1 }, { 16805, 10985, -1 }, { 16837, 10940, -1 },
+    { 16810, 10948, -1 }, { 16870, 10948, -1 }, { 16870, 10948, -1 }, { 16811, 10950, -1 },
+    { 16826, 10953, -1 }, { 16845, 10953, -1 }, { 16873, 10954, -1 }, { 16829, 10957, -1 },
+    { 16871, 10953, -1 }, { 16821, 10954, -1 }, { 16854, 10955, -1 }, { 16831, 10956, -1 },
+    { 16854, 10959, -1 }, { 16822, 10991, -1 }, { 16833, 11016, -1 }, { 16841, 10964, -1 },
+    { 16887, 10973, -1 }, { 16857, 10968, -1 }, { 16829, 10966, -1 }, { 16859, 11006, -1 },
+    { 16841, 10972, -1 }, { 16839, 11005, -1 }, { 16831, 11006, -1 }, { 16893, 11006, -1 },
+    { 16860, 10974, -1 }, { 16847, 10975, -1 }, { 16850, 10976, -1 }, { 16848, 10978, -1 },
+    { 16841, 11018, -1 }, { 16901, 11018, -1 }, { 16842, 11035, -1 }, { 16892, 10982, -1 },
+    { 16882, 10982, -1 }, { 16856, 10983, -1 }, { 16854, 10987, -1 }, { 16881, 11009, -1 },
+    { 16862, 11015, -1 }, { 16899, 11020, -1 }, { 16873, 10990, -1 }, { 16909, 10994, -1 },
+    { 16862, 10995, -1 }, { 16909, 11028, -1 }, { 16891, 10994, -1 }, { 16903, 10998, -1 },
+    { 16869, 10999, -1 }, { 16888, 10999, -1 }, { 16887, 11000, -1 }, { 16880, 11001, -1 },
+    { 16914, 10999, -1 }, { 16903, 11007, -1 }, { 16917, 11008, -1 }, { 16887, 11010, -1 },
+    { 16869, 11011, -1 }, { 16887, 11012, -1 }, { 16901, 11013, -1 }, { 16925, 11014, -1 },
+    { 16904, 11022, -1 }, { 16905, 11017, -1 }, { 16871, 11023, -1 }, { 16927, 11026, -1 },
+    { 16888, 11050, -1 }, { 16877, 11033, -1 }, { 16887, 11034, -1 }, { 16938, 11047, -1 },
+    { 16926, 11036, -1 }, { 16895, 11037, -1 }, { 16885, 11036, -1 }, { 16935, 11039, -1 },
+    { 16928, 11040, -1 }, { 16922, 11049, -1 }, { 16924, 11042, -1 }, { 16925, 11069, -1 },
+    { 16928, 11043, -1 }, { 16929, 11044, -1 }, { 16899, 11057, -1 }, { 16926, 11046, -1 },
+    { 16919, 11048, -1 }, { 16917, 11051, -1 }, { 16946, 11048, -1 }, { 16930, 11056, -1 },
+    { 16900, 11063, -1 }, { 16937, 11071, -1 }, { 16941, 11073, -1 }, { 16911, 11075, -1 },
+    { 16902, 11080, -1 }, { 16898, 11086, -1 }, { 16933, 11090, -1 }, { 16963, 11096, -1 },
+    { 16903, 11107, -1 }, { 16957, 11114, -1 }, { 16958, 11117, -1 }, { 16959, 11124, -1 },
+    { 16935, 11127, -1 }, { 16951, 11127, -1 }, { 16970, 11130, -1 }, { 16914, 11131, -1 },
+    { 16923, 11132, -1 }, { 16945, 11133, -1 }, { 16970, 11134, -1 }, { 16947, 11135, -1 },
+    { 16919, 11148, -1 }, { 16926, 11149, -1 }, { 16966, 11217, -1 }, { 16921, 11245, -1 },
+    { 16946, 11249, -1 }, { 16975, 11252, -1 }, { 16973, 11253, -1 }, { 16976, 11259, -1 },
+    { 16940, 11260, -1 }, { 16925, 11261, -1 }, { 16965, 11272, -1 }, { 16932, 11275, -1 },
+    { 16958, 11282, -1 }, { 16933, 11286, -1 }, { 16954, 11287, -1 }, { 16985, 11289, -1 },
+    { 16949, 11291, -1 }, { 16934, 11287, -1 }, { 16990, 11295, -1 }, { 16937, 11301, -1 },
+    { 16941, 11312, -1 }, { 16976, 11315, -1 }, { 16941, 11316, -1 }, { 16998, 11317, -1 },
+    { 16987, 11320, -1 }, { 16982, 11320, -1 }, { 16996, 11327, -1 }, { 16948, 11328, -1 },
+    { 16957, 11338, -1 }, { 16995, 11339, -1 }, { 17004, 11346, -1 }, { 16979, 11363, -1 },
+    { 16995, 11359, -1 }, { 16954, 11360, -1 }, { 16982, 11361, -1 }, { 16997, 11373, -1 },
+    { 17008, 11374, -1 }, { 17000, 11377, -1 }, { 16955, 11381, -1 }, { 17009, 11382, -1 },
+    { 17010, 11383, -1 }, { 17003, 11389, -1 }, { 16994, 11396, -1 }, { 16996, 11410, -1 },
+    { 17003, 11400, -1 }, { 17006, 11434, -1 }, { 17016, 11438, -1 }, { 16971, 11440, -1 },
+    { 16980, 11441, -1 }, { 16978, 11443, -1 }, { 17013, 11448, -1 }, { 16999, 11483, -1 },
+    { 16989, 11453, -1 }, { 16975, 11465, -1 }, { 17024, 11467, -1 }, { 17020, 11468, -1 },
+    { 17027, 11453, -1 }, { 16992, 11472, -1 }, { 16979, 11481, -1 }, { 17007, 11482, -1 },
+    { 16982, 11492, -1 }, { 17031, 11509, -1 }, { 17019, 11515, -1 }, { 17040, 11516, -1 },
+    { 16980, 11519, -1 }, { 17016, 11520, -1 }, { 17037, 11525, -1 }, { 17003, 11519, -1 },
+    { 17027, 11527, -1 }, { 17028, 11526, -1 }, { 17029, 11528, -1 }, { 17015, 11532, -1 },
+    { 17020, 11545, -1 }, { 17021, 11540, -1 }, { 17043, 11544, -1 }, { 17044, 11557, -1 },
+    { 17053, 11558, -1 }, { 16996, 11559, -1 }, { 17039, 11560, -1 }, { 17000, 11563, -1 },
+    { 17009, 11568, -1 }, { 17040, 11617, -1 }, { 17041, 11618, -1 }, { 17008, 11625, -1 },
+    { 17046, 11629, -1 }, { 17062, 11633, -1 }, { 17007, 11634, -1 }, { 17056, 11635, -1 },
+    { 17060, 11637, -1 }, { 17051, 11638, -1 }, { 17032, 11644, -1 }, { 17046, 11651, -1 },
+    { 17056, 11652, -1 }, { 17012, 11658, -1 }, { 17065, 11663, -1 }, { 17052, 11658, -1 },
+    { 17048, 11670, -1 }, { 17018, 11672, -1 }, { 17057, 11677, -1 }, { 17065, 11681, -1 },
+    { 17059, 11683, -1 }, { 17020, 11684, -1 }, { 17080, 11685, -1 }, { 17060, 11684, -1 },
+    { 17065, 11691, -1 }, { 17047, 11704, -1 }, { 17070, 11707, -1 }, { 17064, 11716, -1 },
+    { 17024, 11758, -1 }, { 17030, 11707, -1 }, { 17041, 11699, -1 }, { 17027, 11708, -1 },
+    { 17032, 11719, -1 }, { 17084, 11760, -1 }, { 17088, 11729, -1 }, { 17064, 11728, -1 },
+    { 17064, 11734, -1 }, { 17033, 11750, -1 }, { 17051, 11757, -1 }, { 17060, 11787, -1 },
+    { 17039, 11791, -1 }, { 17035, 11792, -1 }, { 17069, 11801, -1 }, { 17040, 11802, -1 },
+    { 17043, 11814, -1 }, { 17084, 11815, -1 }, { 17044, 11817, -1 }, { 17073, 11818, -1 },
+    { 17098, 11828, -1 }, { 17091, 11831, -1 }, { 17080, 11851, -1 }, { 17082, 11848, -1 },
+    { 17103, 11856, -1 }, { 17054, 11865, -1 }, { 17094, 11875, -1 }, { 17064, 11883, -1 },
+    { 17106, 11886, -1 }, { 17109, 11888, -1 }, { 17104, 11888, -1 }, { 17084, 11936, -1 },
+    { 17103, 11890, -1 }, { 17091, 11899, -1 }, { 17107, 11910, -1 }, { 17108, 11909, -1 },
+    { 17059, 11916, -1 }, { 17117, 11929, -1 }, { 17067, 11948, -1 }, { 17067, 11951, -1 },
+    { 17068, 11952, -1 }, { 17109, 11954, -1 }, { 17070, 11955, -1 }, { 17096, 11957, -1 },
+    { 17129, 11964, -1 }, { 17122, 11966, -1 }, { 17071, 11969, -1 }, { 17128, 11971, -1 },
+    { 17119, 11972, -1 }, { 17078, 11980, -1 }, { 17121, 11980, -1 }, { 17097, 11980, -1 },
+    { 17080, 11981, -1 }, { 17124, 11982, -1 }, { 17100, 11983, -1 }, { 17082, 11984, -1 },
+    { 17135, 11992, -1 }, { 17088, 11993, -1 }, { 17116, 11995, -1 }, { 17137, 11996, -1 },
+    { 17139, 11996, -1 }, { 17135, 11997, -1 }, { 17131, 11998, -1 }, { 17147, 12009, -1 },
+    { 17092, 12023, -1 }, { 17123, 12024, -1 }, { 17117, 12037, -1 }, { 17150, 12038, -1 },
+    { 17137, 12039, -1 }, { 17111, 12040, -1 }, { 17094, 12043, -1 }, { 17125, 12053, -1 },
+    { 17101, 12054, -1 }, { 17136, 12054, -1 }, { 17106, 12057, -1 }, { 17107, 12058, -1 },
+    { 17106, 12060, -1 }, { 17163, 12060, -1 }, { 17122, 12062, -1 }, { 17108, 12069, -1 },
+    { 17143, 12069, -1 }, { 17160, 12078, -1 }, { 17111, 12083, -1 }, { 17153, 12090, -1 },
+    { 17164, 12099, -1 }, { 17155, 12101, -1 }, { 17159, 12105, -1 }, { 17174, 12106, -1 },
+    { 17119, 12107, -1 }, { 17168, 12109, -1 }, { 17159, 12112, -1 }, { 17161, 12114, -1 },
+    { 17166, 12116, -1 }, { 17125, 12120, -1 }, { 17179, 12133, -1 }, { 17125, 12138, -1 },
+    { 17156, 12142, -1 }, { 17177, 12156, -1 }, { 17152, 12173, -1 }, { 17168, 12173, -1 },
+    { 17161, 12178, -1 }, { 17180, 12184, -1 }, { 17178, 12187, -1 }, { 17128, 12190, -1 },
+    { 17177, 12191, -1 }, { 17134, 12194, -1 }, { 17188, 12194, -1 }, { 17176, 12195, -1 },
+    { 17132, 12196, -1 }, { 17160, 12202, -1 }, { 17179, 12209, -1 }, { 17198, 12217, -1 },
+    { 17186, 12221, -1 }, { 17140, 12225, -1 }, { 17144, 12229, -1 }, { 17170, 12233, -1 },
+    { 17197, 12239, -1 }, { 17192, 12229, -1 }, { 17197, 12245, -1 }, { 17144, 12246, -1 },
+    { 17199, 12247, -1 }, { 17194, 12249, -1 }, { 17191, 12251, -1 }, { 17149, 12256, -1 },
+    { 17198, 12260, -1 }, { 17198, 12267, -1 }, { 17208, 12268, -1 }, { 17168, 12270, -1 },
+    { 17204, 12267, -1 }, { 17180, 12272, -1 }, { 17181, 12273, -1 }, { 17205, 12276, -1 },
+    { 17191, 12282, -1 }, { 17205, 12290, -1 }, { 17164, 12291, -1 }, { 17197, 12298, -1 },
+    { 17192, 12294, -1 }, { 17203, 12296, -1 }, { 17204, 12297, -1 }, { 17220, 12307, -1 },
+    { 17187, 12297, -1 }, { 17208, 12308, -1 }, { 17208, 12310, -1 }, { 17201, 12311, -1 },
+    { 17221, 12324, -1 }, { 17201, 12338, -1 }, { 17176, 12346, -1 }, { 17213, 12346, -1 },
+    { 17229, 12352, -1 }, { 17230, 12353, -1 }, { 17182, 12356, -1 }, { 17206, 12363, -1 },
+    { 17232, 12366, -1 }, { 17231, 12404, -1 }, { 17224, 12371, -1 }, { 17189, 12373, -1 },
+    { 17240, 12374, -1 }, { 17231, 12375, -1 }, { 17228, 12377, -1 }, { 17239, 12378, -1 },
+    { 17191, 12379, -1 }, { 17231, 12380, -1 }, { 17236, 12382, -1 }, { 17222, 12383, -1 },
+    { 17224, 12387, -1 }, { 17197, 12390, -1 }, { 17245, 12391, -1 }, { 17241, 12393, -1 },
+    { 17243, 12395, -1 }, { 17242, 12399, -1 }, { 17237, 12405, -1 }, { 17238, 12393, -1 },
+    { 17255, 12435, -1 }, { 17253, 12434, -1 }, { 17202, 12439, -1 }, { 17206, 12443, -1 },
+    { 17204, 12444, -1 }, { 17236, 12449, -1 }, { 17266, 12450, -1 }, { 17205, 12457, -1 },
+    { 17267, 12466, -1 }, { 17213, 12470, -1 }, { 17237, 12473, -1 }, { 17208, 12476, -1 },
+    { 17253, 12477, -1 }, { 17260, 12478, -1 }, { 17261, 12479, -1 }, { 17257, 12480, -1 },
+    { 17220, 12482, -1 }, { 17231, 12490, -1 }, { 17249, 12505, -1 }, { 17272, 12512, -1 },
+    { 17267, 12517, -1 }, { 17248, 12518, -1 }, { 17264, 12518, -1 }, { 17276, 12525, -1 },
+    { 17239, 12530, -1 }, { 17267, 12533, -1 }, { 17258, 12534, -1 }, { 17275, 12537, -1 },
+    { 17281, 12538, -1 }, { 17238, 12541, -1 }, { 17230, 12543, -1 }, { 17231, 12544, -1 },
+    { 17243, 12547, -1 }, { 17244, 12548, -1 }, { 17274, 12551, -1 }, { 17287, 12599, -1 },
+    { 17294, 12555, -1 }, { 17293, 12562, -1 }, { 17263, 12564, -1 }, { 17293, 12565, -1 },
+    { 17253, 12569, -1 }, { 17284, 12573, -1 }, { 17296, 12577, -1 }, { 17301, 12579, -1 },
+    { 17257, 12582, -1 }, { 17248, 12583, -1 }, { 17292, 12595, -1 }, { 17251, 12600, -1 },
+    { 17253, 12606, -1 }, { 17262, 12608, -1 }, { 17286, 12610, -1 }, { 17285, 12608, -1 },
+    { 17304, 12608, -1 }, { 17314, 12608, -1 }, { 17301, 12613, -1 }, { 17254, 12614, -1 },
+    { 17304, 12619, -1 }, { 17261, 12621, -1 }, { 17285, 12650, -1 }, { 17312, 12621, -1 },
+    { 17265, 12622, -1 }, { 17314, 12673, -1 }, { 17315, 12629, -1 }, { 17319, 12651, -1 },
+    { 17297, 12636, -1 }, { 17268, 12653, -1 }, { 17276, 12654, -1 }, { 17271, 12659, -1 },
+    { 17321, 12658, -1 }, { 17290, 12668, -1 }, { 17325, 12672, -1 }, { 17283, 12684, -1 },
+    { 17307, 12691, -1 }, { 17320, 12689, -1 }, { 17280, 12694, -1 }, { 17328, 12693, -1 },
+    { 17318, 12693, -1 }, { 17289, 12700, -1 }, { 17313, 12719, -1 }, { 17284, 12731, -1 },
+    { 17286, 12725, -1 }, { 17286, 12732, -1 }, { 17329, 12737, -1 }, { 17341, 12766, -1 },
+    { 17345, 12741, -1 }, { 17347, 12744, -1 }, { 17320, 12745, -1 }, { 17340, 12751, -1 },
+    { 17347, 12755, -1 }, { 17348, 12760, -1 }, { 17347, 12761, -1 }, { 17344, 12764, -1 },
+    { 17349, 12770, -1 }, { 17337, 12784, -1 }, { 17336, 12774, -1 }, { 17304, 12778, -1 },
+    { 17329, 12782, -1 }, { 17303, 12786, -1 }, { 17314, 12806, -1 }, { 17325, 12796, -1 },
+    { 17321, 12786, -1 }, { 17306, 12802, -1 }, { 17347, 12810, -1 }, { 17307, 12815, -1 },
+    { 17359, 12816, -1 }, { 17311, 12821, -1 }, { 17312, 12879, -1 }, { 17339, 12826, -1 },
+    { 17330, 12826, -1 }, { 17348, 12826, -1 }, { 17317, 12849, -1 }, { 17365, 12826, -1 },
+    { 17346, 12828, -1 }, { 17376, 12833, -1 }, { 17372, 12834, -1 }, { 17333, 12842, -1 },
+    { 17376, 12852, -1 }, { 17347, 12860, -1 }, { 17327, 12867, -1 }, { 17374, 12877, -1 },
+    { 17367, 12902, -1 }, { 17328, 12906, -1 }, { 17327, 12907, -1 }, { 17385, 12909, -1 },
+    { 17358, 12911, -1 }, { 17332, 12912, -1 }, { 17374, 12913, -1 }, { 17375, 12914, -1 },
+    { 17330, 12927, -1 }, { 17365, 12928, -1 }, { 17356, 12932, -1 }, { 17369, 12938, -1 },
+    { 17390, 12940, -1 }, { 17392, 12942, -1 }, { 17345, 12953, -1 }, { 17383, 12989, -1 },
+    { 17336, 12996, -1 }, { 17359, 12998, -1 }, { 17393, 12999, -1 }, { 17346, 13006, -1 },
+    { 17407, 13006, -1 }, { 17455, 13006, -1 }, { 17413, 13006, -1 }, { 17429, 13006, -1 },
+    { 17486, 13006, -1 }, { 17380, 13008, -1 }, { 17395, 13009, -1 }, { 17410, 13016, -1 },
+    { 17407, 13019, -1 }, { 17387, 13027, -1 }, { 17417, 13028, -1 }, { 17373, 13029, -1 },
+    { 17428, 13030, -1 }, { 17430, 13033, -1 }, { 17376, 13036, -1 }, { 17387, 13038, -1 },
+    { 17388, 13039, -1 }, { 17392, 13045, -1 }, { 17438, 13048, -1 }, { 17450, 13051, -1 },
+    { 17425, 13053, -1 }, { 17453, 13062, -1 }, { 17457, 13065, -1 }, { 17459, 13067, -1 },
+    { 17457, 13069, -1 }, { 17472, 13071, -1 }, { 17469, 13072, -1 }, { 17443, 13076, -1 },
+    { 17476, 13079, -1 }, { 17465, 13080, -1 }, { 17472, 13085, -1 }, { 17431, 13088, -1 },
+    { 17442, 13091, -1 }, { 17444, 13092, -1 }, { 17445, 13093, -1 }, { 17487, 13097, -1 },
+    { 17489, 13098, -1 }, { 17442, 13101, -1 }, { 17454, 13109, -1 }, { 17479, 13119, -1 },
+    { 17495, 13120, -1 }, { 17493, 13123, -1 }, { 17495, 13124, -1 }, { 17497, 13126, -1 },
+    { 17500, 13129, -1 }, { 17461, 13132, -1 }, { 17511, 13137, -1 }, { 17476, 13139, -1 },
+    { 17489, 13158, -1 }, { 17498, 13162, -1 }, { 17513, 13175, -1 }, { 17506, 13194, -1 },
+    { 17521, 13195, -1 }, { 17530, 13196, -1 }, { 17486, 13199, -1 }, { 17509, 13202, -1 },
+    { 17504, 13203, -1 }, { 17505, 13204, -1 }, { 17506, 13206, -1 }, { 17514, 13209, -1 },
+    { 17489, 13228, -1 }, { 17521, 13230, -1 }, { 17506, 13233, -1 }, { 17522, 13233, -1 },
+    { 17482, 13235, -1 }, { 17508, 13246, -1 }, { 17485, 13261, -1 }, { 17530, 13269, -1 },
+    { 17547, 13271, -1 }, { 17519, 13275, -1 }, { 17502, 13277, -1 }, { 17543, 13278, -1 },
+    { 17494, 13281, -1 }, { 17536, 13282, -1 }, { 17542, 13292, -1 }, { 17535, 13295, -1 },
+    { 17542, 13299, -1 }, { 17542, 13301, -1 }, { 17542, 13307, -1 }, { 17552, 13309, -1 },
+    { 17541, 13313, -1 }, { 17553, 13315, -1 }, { 17549, 13324, -1 }, { 17555, 13325, -1 },
+    { 17547, 13326, -1 }, { 17546, 13328, -1 }, { 17540, 13336, -1 }, { 17548, 13337, -1 },
+    { 17510, 13338, -1 }, { 17548, 13341, -1 }, { 17545, 13344, -1 }, { 17519, 13345, -1 },
+    { 17508, 13349, -1 }, { 17527, 13351, -1 }, { 17525, 13388, -1 }, { 17570, 13376, -1 },
+    { 17519, 13358, -1 }, { 17531, 13363, -1 }, { 17549, 13367, -1 }, { 17558, 13407, -1 },
+    { 17557, 13374, -1 }, { 17569, 13396, -1 }, { 17566, 13382, -1 }, { 17569, 13385, -1 },
+    { 17574, 13391, -1 }, { 17565, 13392, -1 }, { 17554, 13402, -1 }, { 17538, 13406, -1 },
+    { 17529, 13408, -1 }, { 17531, 13413, -1 }, { 17533, 13414, -1 }, { 17534, 13419, -1 },
+    { 17563, 13420, -1 }, { 17580, 13427, -1 }, { 17533, 13431, -1 }, { 17566, 13432, -1 },
+    { 17540, 13436, -1 }, { 17560, 13437, -1 }, { 17593, 13438, -1 }, { 17584, 13439, -1 },
+    { 17593, 13442, -1 }, { 17587, 13443, -1 }, { 17569, 13449, -1 }, { 17596, 13452, -1 },
+    { 17555, 13453, -1 }, { 17545, 13461, -1 }, { 17599, 13462, -1 }, { 17599, 13466, -1 },
+    { 17575, 13468, -1 }, { 17602, 13469, -1 }, { 17603, 13470, -1 }, { 17604, 13471, -1 },
+    { 17590, 13474, -1 }, { 17580, 13475, -1 }, { 17596, 13475, -1 }, { 17603, 13488, -1 },
+    { 17604, 13489, -1 }, { 17612, 13493, -1 }, { 17612, 13496, -1 }, { 17613, 13497, -1 },
+    { 17614, 13499, -1 }, { 17582, 13501, -1 }, { 17614, 13507, -1 }, { 17589, 13511, -1 },
+    { 17599, 13515, -1 }, { 17612, 13520, -1 }, { 17570, 13521, -1 }, { 17592, 13525, -1 },
+    { 17622, 13550, -1 }, { 17577, 13526, -1 }, { 17598, 13528, -1 }, { 17577, 13529, -1 },
+    { 17605, 13530, -1 }, { 17603, 13532, -1 }, { 17602, 13533, -1 }, { 17618, 13533, -1 },
+    { 17629, 13535, -1 }, { 17581, 13547, -1 }, { 17606, 13544, -1 }, { 17614, 13545, -1 },
+    { 17580, 13546, -1 }, { 17596, 13549, -1 }, { 17634, 13553, -1 }, { 17622, 13556, -1 },
+    { 17586, 13560, -1 }, { 17613, 13575, -1 }, { 17629, 13575, -1 }, { 17635, 13577, -1 },
+    { 17620, 13578, -1 }, { 17621, 13582, -1 }, { 17622, 13583, -1 }, { 17645, 13585, -1 },
+    { 17590, 13588, -1 }, { 17631, 13589, -1 }, { 17610, 13594, -1 }, { 17608, 13598, -1 },
+    { 17643, 13600, -1 }, { 17649, 13598, -1 }, { 17628, 13602, -1 }, { 17656, 13629, -1 },
+    { 17611, 13631, -1 }, { 17605, 13633, -1 }, { 17601, 13636, -1 }, { 17648, 13643, -1 },
+    { 17603, 13649, -1 }, { 17611, 13656, -1 }, { 17641, 13661, -1 }, { 17654, 13670, -1 },
+    { 17613, 13671, -1 }, { 17642, 13687, -1 }, { 17665, 13689, -1 }, { 17626, 13670, -1 },
+    { 17648, 13697, -1 }, { 17667, 13703, -1 }, { 17618, 13705, -1 }, { 17631, 13706, -1 },
+    { 17663, 13707, -1 }, { 17653, 13713, -1 }, { 17655, 13707, -1 }, { 17655, 13718, -1 },
+    { 17655, 13719, -1 }, { 17669, 13728, -1 }, { 17670, 13729, -1 }, { 17671, 13730, -1 },
+    { 17670, 13731, -1 }, { 17637, 13735, -1 }, { 17679, 13740, -1 }, { 17682, 13741, -1 },
+    { 17687, 13735, -1 }, { 17634, 13742, -1 }, { 17643, 13748, -1 }, { 17692, 13757, -1 },
+    { 17644, 13758, -1 }, { 17638, 13761, -1 }, { 17651, 13762, -1 }, { 17671, 13772, -1 },
+    { 17668, 13775, -1 }, { 17640, 13780, -1 }, { 17641, 13781, -1 }, { 17645, 13792, -1 },
+    { 17644, 13793, -1 }, { 17652, 13795, -1 }, { 17696, 13796, -1 }, { 17647, 13797, -1 },
+    { 17682, 13811, -1 }, { 17691, 13812, -1 }, { 17667, 13820, -1 }, { 17657, 13827, -1 },
+    { 17691, 13830, -1 }, { 17650, 13832, -1 }, { 17655, 13846, -1 }, { 17699, 13856, -1 },
+    { 17680, 13859, -1 }, { 17658, 13863, -1 }, { 17659, 13865, -1 }, { 17678, 13866, -1 },
+    { 17706, 13868, -1 }, { 17707, 13869, -1 }, { 17692, 13870, -1 }, { 17703, 13872, -1 },
+    { 17720, 13873, -1 }, { 17675, 13874, -1 }, { 17676, 13875, -1 }, { 17720, 13877, -1 },
+    { 17713, 13878, -1 }, { 17707, 13880, -1 }, { 17708, 13881, -1 }, { 17672, 13882, -1 },
+    { 17711, 13883, -1 }, { 17703, 13884, -1 }, { 17704, 13892, -1 }, { 17689, 13885, -1 },
+    { 17716, 13886, -1 }, { 17722, 13887, -1 }, { 17723, 13888, -1 }, { 17704, 13899, -1 },
+    { 17682, 13902, -1 }, { 17730, 13903, -1 }, { 17731, 13908, -1 }, { 17684, 13909, -1 },
+    { 17714, 13910, -1 }, { 17725, 13913, -1 }, { 17683, 13917, -1 }, { 17738, 13918, -1 },
+    { 17734, 13921, -1 }, { 17697, 13922, -1 }, { 17720, 13933, -1 }, { 17735, 13939, -1 },
+    { 17722, 13940, -1 }, { 17714, 13944, -1 }, { 17739, 13947, -1 }, { 17711, 13952, -1 },
+    { 17698, 13957, -1 }, { 17750, 13967, -1 }, { 17736, 13973, -1 }, { 17705, 13980, -1 },
+    { 17751, 13981, -1 }, { 17712, 13991, -1 }, { 17727, 13992, -1 }, { 17743, 13992, -1 },
+    { 17706, 14003, -1 }, { 17745, 14005, -1 }, { 17735, 14014, -1 }, { 17747, 14015, -1 },
+    { 17748, 14016, -1 }, { 17739, 14031, -1 }, { 17712, 14039, -1 }, { 17755, 14081, -1 },
+    { 17725, 14039, -1 }, { 17756, 14041, -1 }, { 17757, 14042, -1 }, { 17717, 14046, -1 },
+    { 17729, 14049, -1 }, { 17738, 14059, -1 }, { 17761, 14062, -1 }, { 17748, 14065, -1 },
+    { 17763, 14067, -1 }, { 17772, 14069, -1 }, { 17767, 14071, -1 }, { 17748, 14072, -1 },
+    { 17764, 14072, -1 }, { 17722, 14074, -1 }, { 17755, 14075, -1 }, { 17760, 14076, -1 },
+    { 17729, 14078, -1 }, { 17779, 14083, -1 }, { 17739, 14086, -1 }, { 17773, 14087, -1 },
+    { 17730, 14091, -1 }, { 17735, 14094, -1 }, { 17778, 14136, -1 }, { 17748, 14094, -1 },
+    { 17779, 14096, -1 }, { 17780, 14097, -1 }, { 17767, 14105, -1 }, { 17792, 14106, -1 },
+    { 17769, 14107, -1 }, { 17781, 14110, -1 }, { 17785, 14117, -1 }, { 17746, 14118, -1 },
+    { 17769, 14120, -1 }, { 17785, 14120, -1 }, { 17786, 14122, -1 }, { 17776, 14123, -1 },
+    { 17773, 14127, -1 }, { 17788, 14146, -1 }, { 17779, 14147, -1 }, { 17780, 14151, -1 },
+    { 17810, 14153, -1 }, { 17798, 14159, -1 }, { 17805, 14161, -1 }, { 17799, 14162, -1 },
+    { 17757, 14163, -1 }, { 17807, 14165, -1 }, { 17783, 14166, -1 }, { 17802, 14167, -1 },
+    { 17757, 14169, -1 }, { 17805, 14173, -1 }, { 17796, 14177, -1 }, { 17822, 14184, -1 },
+    { 17808, 14194, -1 }, { 17797, 14177, -1 }, { 17791, 14199, -1 }, { 17807, 14199, -1 },
+    { 17793, 14201, -1 }, { 17809, 14201, -1 }, { 17821, 14208, -1 }, { 17822, 14209, -1 },
+    { 17787, 14212, -1 }, { 17823, 14214, -1 }, { 17771, 14216, -1 }, { 17821, 14217, -1 },
+    { 17811, 14218, -1 }, { 17777, 14219, -1 }, { 17803, 14221, -1 }, { 17819, 14221, -1 },
+    { 17805, 14222, -1 }, { 17821, 14222, -1 }, { 17807, 14231, -1 }, { 17823, 14231, -1 },
+    { 17785, 14233, -1 }, { 17815, 14237, -1 }, { 17837, 14260, -1 }, { 17788, 14264, -1 },
+    { 17839, 14265, -1 }, { 17840, 14268, -1 }, { 17841, 14269, -1 }, { 17844, 14271, -1 },
+    { 17794, 14272, -1 }, { 17815, 14278, -1 }, { 17838, 14279, -1 }, { 17830, 14281, -1 },
+    { 17796, 14289, -1 }, { 17850, 14272, -1 }, { 17821, 14290, -1 }, { 17801, 14292, -1 },
+    { 17802, 14293, -1 }, { 17803, 14295, -1 }, { 17847, 14296, -1 }, { 17847, 14299, -1 },
+    { 17855, 14303, -1 }, { 17804, 14305, -1 }, { 17814, 14308, -1 }, { 17808, 14314, -1 },
+    { 17843, 14317, -1 }, { 17833, 14318, -1 }, { 17805, 14339, -1 }, { 17806, 14344, -1 },
+    { 17811, 14347, -1 }, { 17826, 14348, -1 }, { 17852, 14350, -1 }, { 17822, 14358, -1 },
+    { 17818, 14361, -1 }, { 17868, 14362, -1 }, { 17863, 14374, -1 }, { 17848, 14380, -1 },
+    { 17822, 14382, -1 }, { 17820, 14386, -1 }, { 17822, 14391, -1 }, { 17830, 14399, -1 },
+    { 17861, 14400, -1 }, { 17837, 14413, -1 }, { 17869, 14415, -1 }, { 17827, 14418, -1 },
+    { 17870, 14447, -1 }, { 17884, 14427, -1 }, { 17872, 14449, -1 }, { 17831, 14453, -1 },
+    { 17882, 14471, -1 }, { 17888, 14486, -1 }, { 17874, 14489, -1 }, { 17885, 14492, -1 },
+    { 17865, 14499, -1 }, { 17866, 14503, -1 }, { 17874, 14508, -1 }, { 17893, 14509, -1 },
+    { 17891, 14514, -1 }, { 17853, 14521, -1 }, { 17897, 14524, -1 }, { 17893, 14529, -1 },
+    { 17865, 14533, -1 }, { 17898, 14536, -1 }, { 17897, 14545, -1 }, { 17877, 14550, -1 },
+    { 17847, 14551, -1 }, { 17850, 14564, -1 }, { 17902, 14566, -1 }, { 17890, 14569, -1 },
+    { 17849, 14570, -1 }, { 17864, 14575, -1 }, { 17857, 14576, -1 }, { 17910, 14579, -1 },
+    { 17893, 14576, -1 }, { 17917, 14580, -1 }, { 17855, 14581, -1 }, { 17904, 14583, -1 },
+    { 17857, 14585, -1 }, { 17872, 14586, -1 }, { 17908, 14589, -1 }, { 17867, 14598, -1 },
+    { 17877, 14604, -1 }, { 17866, 14605, -1 }, { 17919, 14606, -1 }, { 17911, 14609, -1 },
+    { 17873, 14621, -1 }, { 17868, 14626, -1 }, { 17923, 14637, -1 }, { 17902, 14643, -1 },
+    { 17919, 14649, -1 }, { 17906, 14650, -1 }, { 17917, 14660, -1 }, { 17891, 14717, -1 },
+    { 17912, 14660, -1 }, { 17888, 14685, -1 }, { 17934, 14718, -1 }, { 17884, 14720, -1 },
+    { 17935, 14722, -1 }, { 17926, 14727, -1 }, { 17885, 14729, -1 }, { 17886, 14730, -1 },
+    { 17941, 14735, -1 }, { 17888, 14737, -1 }, { 17898, 14738, -1 }, { 17886, 14741, -1 },
+    { 17925, 14744, -1 }, { 17922, 14745, -1 }, { 17937, 14746, -1 }, { 17944, 14754, -1 },
+    { 17893, 14754, -1 }, { 17924, 14766, -1 }, { 17925, 14767, -1 }, { 17926, 14768, -1 },
+    { 17911, 14773, -1 }, { 17930, 14779, -1 }, { 17949, 14781, -1 }, { 17922, 14782, -1 },
+    { 17947, 14784, -1 }, { 17913, 14789, -1 }, { 17932, 14792, -1 }, { 17949, 14799, -1 },
+    { 17940, 14801, -1 }, { 17952, 14804, -1 }, { 17952, 14816, -1 }, { 17922, 14818, -1 },
+    { 17907, 14829, -1 }, { 17964, 14829, -1 }, { 17954, 14838, -1 }, { 17910, 14829, -1 },
+    { 17965, 14844, -1 }, { 17947, 14829, -1 }, { 17945, 14847, -1 }, { 17936, 14849, -1 },
+    { 17967, 14850, -1 }, { 17971, 14853, -1 }, { 17918, 14855, -1 }, { 17967, 14856, -1 },
+    { 17981, 14861, -1 }, { 17982, 14862, -1 }, { 17925, 14864, -1 }, { 17966, 14866, -1 },
+    { 17967, 14867, -1 }, { 17968, 14868, -1 }, { 17954, 14870, -1 }, { 17935, 14873, -1 },
+    { 17961, 14889, -1 }, { 17977, 14891, -1 }, { 17933, 14895, -1 }, { 17987, 14899, -1 },
+    { 17967, 14904, -1 }, { 17978, 14910, -1 }, { 17970, 14912, -1 }, { 17950, 14915, -1 },
+    { 17937, 14932, -1 }, { 17961, 14936, -1 }, { 17970, 14939, -1 }, { 17948, 14944, -1 },
+    { 17957, 14948, -1 }, { 17943, 14961, -1 }, { 17947, 14964, -1 }, { 17953, 14977, -1 },
+    { 17989, 14978, -1 }, { 17990, 14980, -1 }, { 17996, 14981, -1 }, { 17973, 14983, -1 },
+    { 17980, 14986, -1 }, { 17962, 14992, -1 }, { 18004, 14997, -1 }, { 18005, 14998, -1 },
+    { 18000, 15004, -1 }, { 17985, 15008, -1 }, { 17956, 15021, -1 }, { 17987, 15027, -1 },
+    { 18013, 15028, -1 }, { 17991, 15034, -1 }, { 18011, 15028, -1 }, { 17963, 15035, -1 },
+    { 18015, 15036, -1 }, { 18014, 15041, -1 }, { 17967, 15043, -1 }, { 17998, 15048, -1 },
+    { 18013, 15049, -1 }, { 18014, 15052, -1 }, { 18015, 15055, -1 }, { 17973, 15058, -1 },
+    { 18001, 15064, -1 }, { 18009, 15065, -1 }, { 18000, 15066, -1 }, { 18016, 15069, -1 },
+    { 17988, 15065, -1 }, { 18022, 15074, -1 }, { 17979, 15075, -1 }, { 18035, 15076, -1 },
+    { 18009, 15077, -1 }, { 17981, 15081, -1 }, { 17984, 15086, -1 }, { 17991, 15098, -1 },
+    { 17986, 15111, -1 }, { 17996, 15111, -1 }, { 17987, 15117, -1 }, { 18041, 15118, -1 },
+    { 18044, 15111, -1 }, { 17989, 15122, -1 }, { 17991, 15125, -1 }, { 18020, 15132, -1 },
+    { 18011, 15162, -1 }, { 17993, 15164, -1 }, { 18042, 15170, -1 }, { 18025, 15174, -1 },
+    { 18042, 15177, -1 }, { 17998, 15191, -1 }, { 18021, 15205, -1 }, { 18022, 15210, -1 },
+    { 18048, 15177, -1 }, { 18026, 15214, -1 }, { 18024, 15221, -1 }, { 18033, 15230, -1 },
+    { 18005, 15234, -1 }, { 18043, 15236, -1 }, { 18051, 15239, -1 }, { 18007, 15241, -1 },
+    { 18015, 15246, -1 }, { 18037, 15246, -1 }, { 18038, 15252, -1 }, { 18023, 15254, -1 },
+    { 18056, 15260, -1 }, { 18043, 15315, -1 }, { 18065, 15292, -1 }, { 18052, 15299, -1 },
+    { 18067, 15323, -1 }, { 18020, 15333, -1 }, { 18070, 15334, -1 }, { 18065, 15339, -1 },
+    { 18075, 15341, -1 }, { 18080, 15346, -1 }, { 18035, 15349, -1 }, { 18034, 15350, -1 },
+    { 18047, 15351, -1 }, { 18070, 15352, -1 }, { 18052, 15360, -1 }, { 18057, 15364, -1 },
+    { 18080, 15367, -1 }, { 18072, 15373, -1 }, { 18076, 15375, -1 }, { 18077, 15376, -1 },
+    { 18040, 15385, -1 }, { 18065, 15394, -1 }, { 18073, 15396, -1 }, { 18078, 15399, -1 },
+    { 18039, 15413, -1 }, { 18040, 15416, -1 }, { 18068, 15417, -1 }, { 18094, 15418, -1 },
+    { 18090, 15420, -1 }, { 18071, 15420, -1 }, { 18097, 15460, -1 }, { 18073, 15427, -1 },
+    { 18079, 15433, -1 }, { 18100, 15435, -1 }, { 18076, 15443, -1 }, { 18101, 15449, -1 },
+    { 18099, 15452, -1 }, { 18070, 15454, -1 }, { 18093, 15456, -1 }, { 18103, 15469, -1 },
+    { 18067, 15470, -1 }, { 18091, 15475, -1 }, { 18113, 15476, -1 }, { 18068, 15478, -1 },
+    { 18052, 15480, -1 }, { 18053, 15483, -1 }, { 18059, 15485, -1 }, { 18105, 15489, -1 },
+    { 18107, 15490, -1 }, { 18102, 15492, -1 }, { 18064, 15494, -1 }, { 18104, 15503, -1 },
+    { 18094, 15508, -1 }, { 18119, 15512, -1 }, { 18118, 15521, -1 }, { 18097, 15523, -1 },
+    { 18123, 15526, -1 }, { 18094, 15536, -1 }, { 18071, 15538, -1 }, { 18073, 15543, -1 },
+    { 18102, 15544, -1 }, { 18075, 15545, -1 }, { 18076, 15547, -1 }, { 18105, 15549, -1 },
+    { 18128, 15550, -1 }, { 18109, 15552, -1 }, { 18082, 15553, -1 }, { 18109, 15561, -1 },
+    { 18126, 15562, -1 }, { 18111, 15563, -1 }, { 18096, 15564, -1 }, { 18083, 15567, -1 },
+    { 18096, 15568, -1 }, { 18115, 15569, -1 }, { 18100, 15587, -1 }, { 18125, 15572, -1 },
+    { 18134, 15574, -1 }, { 18140, 15579, -1 }, { 18134, 15580, -1 }, { 18125, 15583, -1 },
+    { 18145, 15585, -1 }, { 18116, 15586, -1 }, { 18137, 15588, -1 }, { 18102, 15589, -1 },
+    { 18152, 15590, -1 }, { 18144, 15591, -1 }, { 18145, 15592, -1 }, { 18127, 15593, -1 },
+    { 18096, 15594, -1 }, { 18148, 15595, -1 }, { 18099, 15596, -1 }, { 18151, 15597, -1 },
+    { 18129, 15598, -1 }, { 18119, 15599, -1 }, { 18159, 15600, -1 }, { 18148, 15601, -1 },
+    { 18164, 15602, -1 }, { 18162, 15603, -1 }, { 18138, 15604, -1 }, { 18123, 15605, -1 },
+    { 18140, 15606, -1 }, { 18118, 15607, -1 }, { 18161, 15608, -1 }, { 18161, 15609, -1 },
+    { 18163, 15610, -1 }, { 18166, 15611, -1 }, { 18143, 15612, -1 }, { 18128, 15613, -1 },
+    { 18125, 15614, -1 }, { 18128, 15615, -1 }, { 18139, 15616, -1 }, { 18170, 15617, -1 },
+    { 18141, 15618, -1 }, { 18121, 15619, -1 }, { 18140, 15620, -1 }, { 18144, 15621, -1 },
+    { 18181, 15622, -1 }, { 18157, 15623, -1 }, { 18177, 15624, -1 }, { 18143, 15625, -1 },
+    { 18179, 15628, -1 }, { 18161, 15626, -1 }, { 18130, 15627, -1 }, { 18163, 15629, -1 },
+    { 18178, 15630, -1 }, { 18178, 15631, -1 }, { 18148, 15632, -1 }, { 18175, 15633, -1 },
+    { 18171, 15634, -1 }, { 18169, 15635, -1 }, { 18195, 15636, -1 }, { 18201, 15637, -1 },
+    { 18160, 15638, -1 }, { 18200, 15637, -1 }, { 18185, 15639, -1 }, { 18193, 15636, -1 },
+    { 18170, 15640, -1 }, { 18180, 15641, -1 }, { 18200, 15642, -1 }, { 18204, 15638, -1 },
+    { 18200, 15643, -1 }, { 18191, 15644, -1 }, { 18165, 15645, -1 }, { 18201, 15646, -1 },
+    { 18183, 15647, -1 }, { 18187, 15648, -1 }, { 18208, 15649, -1 }, { 18166, 15650, -1 },
+    { 18215, 15651, -1 }, { 18168, 15652, -1 }, { 18216, 15653, -1 }, { 18201, 15654, -1 },
+    { 18164, 15635, -1 }, { 18203, 15655, -1 }, { 18204, 15656, -1 }, { 18197, 15657, -1 },
+    { 18193, 15658, -1 }, { 18182, 15659, -1 }, { 18229, 15660, -1 }, { 18225, 15661, -1 },
+    { 18182, 15662, -1 }, { 18173, 15663, -1 }, { 18185, 15664, -1 }, { 18227, 15665, -1 },
+    { 18226, 15666, -1 }, { 18190, 15667, -1 }, { 18211, 15669, -1 }, { 18208, 15670, -1 },
+    { 18187, 15668, -1 }, { 18238, 15671, -1 }, { 18230, 15672, -1 }, { 18224, 15668, -1 },
+    { 18231, 15673, -1 }, { 18198, 15676, -1 }, { 18231, 15675, -1 }, { 18144, 15635, -1 },
+    { 18197, 15677, -1 }, { 18235, 15674, -1 }, { 18247, 15678, -1 }, { 18190, 15679, -1 },
+    { 18244, 15680, -1 }, { 18222, 15681, -1 }, { 18196, 15682, -1 }, { 18229, 15681, -1 },
+    { 18225, 15683, -1 }, { 18202, 15684, -1 }, { 18224, 15685, -1 }, { 18220, 15686, -1 },
+    { 18233, 15687, -1 }, { 18209, 15687, -1 }, { 18263, 15688, -1 }, { 18240, 15693, -1 },
+    { 18247, 15689, -1 }, { 18264, 15690, -1 }, { 18208, 15691, -1 }, { 18237, 15692, -1 },
+    { 18238, 15694, -1 }, { 18238, 15695, -1 }, { 18241, 15696, -1 }, { 18264, 15697, -1 },
+    { 18202, 15686, -1 }, { 18243, 15698, -1 }, { 18247, 15699, -1 }, { 18200, 15685, -1 },
+    { 18260, 15700, -1 }, { 18221, 15701, -1 }, { 18267, 15704, -1 }, { 18253, 15702, -1 },
+    { 18268, 15705, -1 }, { 18232, 15703, -1 }, { 18276, 15706, -1 }, { 18234, 15707, -1 },
+    { 18259, 15708, -1 }, { 18284, 15709, -1 }, { 18232, 15710, -1 }, { 18287, 15711, -1 },
+    { 18250, 15711, -1 }, { 18288, 15712, -1 }, { 18280, 15713, -1 }, { 18280, 15714, -1 },
+    { 18274, 15715, -1 }, { 18233, 15718, -1 }, { 18276, 15719, -1 }, { 18270, 15716, -1 },
+    { 18288, 15717, -1 }, { 18268, 15720, -1 }, { 18250, 15721, -1 }, { 18253, 15722, -1 },
+    { 18302, 15723, -1 }, { 18273, 15724, -1 }, { 18297, 15725, -1 }, { 18287, 15726, -1 },
+    { 18262, 15716, -1 }, { 18301, 15727, -1 }, { 18302, 15728, -1 }, { 18276, 15729, -1 },
+    { 18306, 15730, -1 }, { 18305, 15731, -1 }, { 18293, 15732, -1 }, { 18257, 15733, -1 },
+    { 18316, 15733, -1 }, { 18316, 15734, -1 }, { 18270, 15735, -1 }, { 18274, 15738, -1 },
+    { 18315, 15736, -1 }, { 18259, 15737, -1 }, { 18309, 15739, -1 }, { 18306, 15740, -1 },
+    { 18267, 15741, -1 }, { 18313, 15744, -1 }, { 18280, 15742, -1 }, { 18316, 15743, -1 },
+    { 18313, 15745, -1 }, { 18313, 15746, -1 }, { 18319, 15747, -1 }, { 18273, 15748, -1 },
+    { 18311, 15749, -1 }, { 18293, 15750, -1 }, { 18325, 15751, -1 }, { 18238, 15697, -1 },
+    { 18313, 15752, -1 }, { 18314, 15753, -1 }, { 18289, 15754, -1 }, { 18276, 15755, -1 },
+    { 18319, 15756, -1 }, { 18309, 15757, -1 }, { 18332, 15758, -1 }, { 18333, 15759, -1 },
+    { 18280, 15760, -1 }, { 18309, 15762, -1 }, { 18314, 15761, -1 }, { 18338, 15763, -1 },
+    { 18333, 15764, -1 }, { 18341, 15765, -1 }, { 18302, 15766, -1 }, { 18303, 15767, -1 },
+    { 18288, 15768, -1 }, { 18289, 15769, -1 }, { 18299, 15770, -1 }, { 18296, 15771, -1 },
+    { 18339, 15772, -1 }, { 18305, 15774, -1 }, { 18320, 15773, -1 }, { 18297, 15775, -1 },
+    { 18357, 15776, -1 }, { 18330, 15777, -1 }, { 18323, 15778, -1 }, { 18303, 15779, -1 },
+    { 18326, 15780, -1 }, { 18342, 15781, -1 }, { 18332, 15782, -1 }, { 18367, 15783, -1 },
+    { 18334, 15784, -1 }, { 18321, 15785, -1 }, { 18317, 15786, -1 }, { 18318, 15787, -1 },
+    { 18333, 15788, -1 }, { 18343, 15789, -1 }, { 18347, 15790, -1 }, { 18354, 15791, -1 },
+    { 18354, 15792, -1 }, { 18353, 15785, -1 }, { 18344, 15793, -1 }, { 18331, 15794, -1 },
+    { 18332, 15795, -1 }, { 18367, 15796, -1 }, { 18335, 15797, -1 }, { 18350, 15798, -1 },
+    { 18363, 15799, -1 }, { 18336, 15800, -1 }, { 18374, 15801, -1 }, { 18340, 15802, -1 },
+    { 18334, 15803, -1 }, { 18373, 15804, -1 }, { 18330, 15805, -1 }, { 18368, 15806, -1 },
+    { 18379, 15807, -1 }, { 18365, 15808, -1 }, { 18383, 15809, -1 }, { 18340, 15810, -1 },
+    { 18365, 15813, -1 }, { 18397, 15811, -1 }, { 18357, 15812, -1 }, { 18346, 15814, -1 },
+    { 18365, 15815, -1 }, { 18388, 15816, -1 }, { 18379, 15817, -1 }, { 18389, 15818, -1 },
+    { 18345, 15819, -1 }, { 18399, 15820, -1 }, { 18349, 15821, -1 }, { 18355, 15822, -1 },
+    { 18395, 15823, -1 }, { 18400, 15824, -1 }, { 18361, 15825, -1 }, { 18378, 15826, -1 },
+    { 18378, 15827, -1 }, { 18407, 15828, -1 }, { 18400, 15829, -1 }, { 18415, 15830, -1 },
+    { 18368, 15831, -1 }, { 18406, 15832, -1 }, { 18412, 15833, -1 }, { 18400, 15834, -1 },
+    { 18408, 15835, -1 }, { 18409, 15836, -1 }, { 18405, 15837, -1 }, { 18368, 15838, -1 },
+    { 18371, 15839, -1 }, { 18395, 15840, -1 }, { 18412, 15841, -1 }, { 18421, 15842, -1 },
+    { 18401, 15843, -1 }, { 18413, 15844, -1 }, { 18410, 15845, -1 }, { 18400, 15846, -1 },
+    { 18397, 15847, -1 }, { 18409, 15848, -1 }, { 18420, 15852, -1 }, { 18434, 15849, -1 },
+    { 18407, 15850, -1 }, { 18390, 15851, -1 }, { 18415, 15853, -1 }, { 18429, 15854, -1 },
+    { 18440, 15855, -1 }, { 18389, 15856, -1 }, { 18430, 15857, -1 }, { 18384, 15858, -1 },
+    { 18418, 15859, -1 }, { 18396, 15860, -1 }, { 18440, 15863, -1 }, { 18401, 15861, -1 },
+    { 18396, 15862, -1 }, { 18418, 15864, -1 }, { 18419, 15865, -1 }, { 18420, 15866, -1 },
+    { 18412, 15867, -1 }, { 18416, 15868, -1 }, { 18417, 15869, -1 }, { 18437, 15870, -1 },
+    { 18425, 15871, -1 }, { 18429, 15872, -1 }, { 18454, 15873, -1 }, { 18445, 15874, -1 },
+    { 18460, 15875, -1 }, { 18441, 15876, -1 }, { 18431, 15877, -1 }, { 18432, 15878, -1 },
+    { 18425, 15879, -1 }, { 18448, 15880, -1 }, { 18438, 15881, -1 }, { 18457, 15882, -1 },
+    { 18414, 15883, -1 }, { 18458, 15884, -1 }, { 18422, 15885, -1 }, { 18428, 15886, -1 },
+    { 18449, 15887, -1 }, { 18440, 15888, -1 }, { 18411, 15889, -1 }, { 18474, 15891, -1 },
+    { 18464, 15890, -1 }, { 18415, 15892, -1 }, { 18478, 15893, -1 }, { 18448, 15894, -1 },
+    { 18436, 15895, -1 }, { 18450, 15896, -1 }, { 18419, 15897, -1 }, { 18482, 15899, -1 },
+    { 18482, 15898, -1 }, { 18476, 15900, -1 }, { 18472, 15901, -1 }, { 18455, 15902, -1 },
+    { 18437, 15905, -1 }, { 18477, 15903, -1 }, { 18427, 15904, -1 }, { 18463, 15906, -1 },
+    { 18454, 15907, -1 }, { 18442, 15908, -1 }, { 18489, 15909, -1 }, { 18455, 15910, -1 },
+    { 18438, 15911, -1 }, { 18490, 15912, -1 }, { 18479, 15913, -1 }, { 18449, 15914, -1 },
+    { 18474, 15915, -1 }, { 18486, 15916, -1 }, { 18496, 15917, -1 }, { 18475, 15918, -1 },
+    { 18444, 15919, -1 }, { 18502, 15920, -1 }, { 18476, 15921, -1 }, { 18454, 15922, -1 },
+    { 18458, 15923, -1 }, { 18497, 15924, -1 }, { 18483, 15925, -1 }, { 18490, 15926, -1 },
+    { 18484, 15915, -1 }, { 18491, 15927, -1 }, { 18502, 15928, -1 }, { 18504, 15929, -1 },
+    { 18485, 15930, -1 }, { 18458, 15931, -1 }, { 18464, 15932, -1 }, { 18469, 15933, -1 },
+    { 18513, 15934, -1 }, { 18521, 15935, -1 }, { 18475, 15936, -1 }, { 18495, 15937, -1 },
+    { 18521, 15938, -1 }, { 18478, 15939, -1 }, { 18523, 15940, -1 }, { 18477, 15941, -1 },
+    { 18517, 15942, -1 }, { 18512, 15943, -1 }, { 18513, 15944, -1 }, { 18475, 15945, -1 },
+    { 18515, 15946, -1 }, { 18493, 15947, -1 }, { 18488, 15948, -1 }, { 18528, 15949, -1 },
+    { 18517, 15950, -1 }, { 18526, 15951, -1 }, { 18491, 15952, -1 }, { 18523, 15953, -1 },
+    { 18491, 15954, -1 }, { 18540, 15955, -1 }, { 18531, 15956, -1 }, { 18505, 15954, -1 },
+    { 18492, 15957, -1 }, { 18522, 15958, -1 }, { 18522, 15959, -1 }, { 18547, 15960, -1 },
+    { 18535, 15961, -1 }, { 18515, 15962, -1 }, { 18532, 15963, -1 }, { 18507, 15964, -1 },
+    { 18505, 15965, -1 }, { 18522, 15966, -1 }, { 18540, 15967, -1 }, { 18500, 15968, -1 },
+    { 18556, 15969, -1 }, { 18518, 15970, -1 }, { 18495, 15971, -1 }, { 18541, 15972, -1 },
+    { 18544, 15973, -1 }, { 18547, 15974, -1 }, { 18539, 15975, -1 }, { 18524, 15976, -1 },
+    { 18533, 15977, -1 }, { 18518, 15978, -1 }, { 18519, 15979, -1 }, { 18505, 15980, -1 },
+    { 18533, 15981, -1 }, { 18544, 15982, -1 }, { 18531, 15983, -1 }, { 18540, 15984, -1 },
+    { 18520, 15985, -1 }, { 18567, 15986, -1 }, { 18568, 15987, -1 }, { 18523, 15988, -1 },
+    { 18570, 15989, -1 }, { 18566, 15990, -1 }, { 18535, 15991, -1 }, { 18557, 15992, -1 },
+    { 18526, 15993, -1 }, { 18550, 15994, -1 }, { 18527, 15995, -1 }, { 18536, 15996, -1 },
+    { 18551, 15997, -1 }, { 18576, 15998, -1 }, { 18536, 15999, -1 }, { 18576, 16000, -1 },
+    { 18546, 16001, -1 }, { 18549, 16002, -1 }, { 18559, 16003, -1 }, { 18587, 16004, -1 },
+    { 18540, 16005, -1 }, { 18578, 16006, -1 }, { 18593, 16007, -1 }, { 18589, 16008, -1 },
+    { 18576, 16009, -1 }, { 18552, 16010, -1 }, { 18567, 16011, -1 }, { 18579, 16012, -1 },
+    { 18543, 16013, -1 }, { 18593, 16014, -1 }, { 18563, 16015, -1 }, { 18570, 16016, -1 },
+    { 18578, 16017, -1 }, { 18594, 16018, -1 }, { 18549, 16021, -1 }, { 18573, 16019, -1 },
+    { 18596, 16020, -1 }, { 18555, 16022, -1 }, { 18555, 16023, -1 }, { 18557, 16024, -1 },
+    { 18606, 16025, -1 }, { 18582, 16026, -1 }, { 18598, 16027, -1 }, { 18582, 16028, -1 },
+    { 18610, 16029, -1 }, { 18566, 16032, -1 }, { 18568, 16030, -1 }, { 18560, 16031, -1 },
+    { 18558, 16033, -1 }, { 18559, 16034, -1 }, { 18575, 16035, -1 }, { 18581, 16036, -1 },
+    { 18611, 16037, -1 }, { 18573, 16038, -1 }, { 18564, 16039, -1 }, { 18576, 16040, -1 },
+    { 18580, 16041, -1 }, { 18581, 16042, -1 }, { 18596, 16044, -1 }, { 18571, 16043, -1 },
+    { 18587, 16045, -1 }, { 18586, 16046, -1 }, { 18601, 16047, -1 }, { 18634, 16048, -1 },
+    { 18586, 16049, -1 }, { 18618, 16050, -1 }, { 18614, 16042, -1 }, { 18595, 16051, -1 },
+    { 18628, 16052, -1 }, { 18629, 16053, -1 }, { 18597, 16054, -1 }, { 18603, 16055, -1 },
+    { 18590, 16056, -1 }, { 18621, 16057, -1 }, { 18615, 16058, -1 }, { 18635, 16059, -1 },
+    { 18585, 16060, -1 }, { 18643, 16061, -1 }, { 18619, 16062, -1 }, { 18622, 16063, -1 },
+    { 18602, 16064, -1 }, { 18622, 16065, -1 }, { 18648, 16066, -1 }, { 18625, 16067, -1 },
+    { 18608, 16068, -1 }, { 18599, 16069, -1 }, { 18617, 16070, -1 }, { 18653, 16071, -1 },
+    { 18630, 16075, -1 }, { 18656, 16072, -1 }, { 18653, 16073, -1 }, { 18641, 16074, -1 },
+    { 18611, 16076, -1 }, { 18612, 16077, -1 }, { 18642, 16078, -1 }, { 18618, 16079, -1 },
+    { 18609, 16080, -1 }, { 18622, 16081, -1 }, { 18670, 16082, -1 }, { 18637, 16083, -1 },
+    { 18654, 16084, -1 }, { 18626, 16085, -1 }, { 18663, 16086, -1 }, { 18653, 16087, -1 },
+    { 18676, 16088, -1 }, { 18631, 16089, -1 }, { 18632, 16090, -1 }, { 18649, 16091, -1 },
+    { 18623, 16092, -1 }, { 18653, 16093, -1 }, { 18621, 16094, -1 }, { 18672, 16095, -1 },
+    { 18682, 16096, -1 }, { 18646, 16097, -1 }, { 18656, 16098, -1 }, { 18676, 16099, -1 },
+    { 18673, 16100, -1 }, { 18659, 16101, -1 }, { 18622, 16071, -1 }, { 18657, 16102, -1 },
+    { 18685, 16103, -1 }, { 18639, 16104, -1 }, { 18662, 16105, -1 }, { 18670, 16106, -1 },
+    { 18669, 16107, -1 }, { 18635, 16108, -1 }, { 18636, 16109, -1 }, { 18687, 16110, -1 },
+    { 18700, 16111, -1 }, { 18640, 16112, -1 }, { 18691, 16113, -1 }, { 18664, 16114, -1 },
+    { 18692, 16115, -1 }, { 18685, 16116, -1 }, { 18675, 16117, -1 }, { 18695, 16118, -1 },
+    { 18675, 16119, -1 }, { 18657, 16120, -1 }, { 18693, 16121, -1 }, { 18660, 16122, -1 },
+    { 18662, 16123, -1 }, { 18682, 16124, -1 }, { 18713, 16125, -1 }, { 18711, 16127, -1 },
+    { 18668, 16128, -1 }, { 18710, 16128, -1 }, { 18687, 16129, -1 }, { 18682, 16126, -1 },
+    { 18672, 16130, -1 }, { 18675, 16131, -1 }, { 18663, 16132, -1 }, { 18717, 16133, -1 },
+    { 18708, 16135, -1 }, { 18694, 16134, -1 }, { 18718, 16136, -1 }, { 18719, 16137, -1 },
+    { 18691, 16138, -1 }, { 18679, 16139, -1 }, { 18730, 16140, -1 }, { 18707, 16141, -1 },
+    { 18731, 16142, -1 }, { 18722, 16143, -1 }, { 18721, 16144, -1 }, { 18708, 16145, -1 },
+    { 18736, 16146, -1 }, { 18680, 16147, -1 }, { 18683, 16148, -1 }, { 18691, 16149, -1 },
+    { 18729, 16150, -1 }, { 18729, 16151, -1 }, { 18695, 16152, -1 }, { 18718, 16153, -1 },
+    { 18729, 16154, -1 }, { 18734, 16155, -1 }, { 18705, 16156, -1 }, { 18739, 16157, -1 },
+    { 18725, 16158, -1 }, { 18687, 16159, -1 }, { 18723, 16160, -1 }, { 18715, 16161, -1 },
+    { 18693, 16162, -1 }, { 18747, 16163, -1 }, { 18725, 16164, -1 }, { 18726, 16165, -1 },
+    { 18706, 16166, -1 }, { 18751, 16167, -1 }, { 18749, 16168, -1 }, { 18711, 16169, -1 },
+    { 18730, 16170, -1 }, { 18756, 16171, -1 }, { 18726, 16172, -1 }, { 18764, 16173, -1 },
+    { 18752, 16176, -1 }, { 18753, 16174, -1 }, { 18713, 16175, -1 }, { 18719, 16177, -1 },
+    { 18708, 16178, -1 }, { 18766, 16179, -1 }, { 18759, 16180, -1 }, { 18759, 16181, -1 },
+    { 18773, 16182, -1 }, { 18763, 16183, -1 }, { 18742, 16184, -1 }, { 18769, 16185, -1 },
+    { 18764, 16187, -1 }, { 18767, 16186, -1 }, { 18733, 16158, -1 }, { 18779, 16188, -1 },
+    { 18768, 16189, -1 }, { 18744, 16190, -1 }, { 18766, 16191, -1 }, { 18750, 16192, -1 },
+    { 18721, 16193, -1 }, { 18775, 16194, -1 }, { 18732, 16195, -1 }, { 18777, 16196, -1 },
+    { 18740, 16197, -1 }, { 18775, 16198, -1 }, { 18777, 16199, -1 }, { 18791, 16200, -1 },
+    { 18744, 16201, -1 }, { 18745, 16202, -1 }, { 18746, 16203, -1 }, { 18746, 16204, -1 },
+    { 18740, 16205, -1 }, { 18737, 16206, -1 }, { 18783, 16207, -1 }, { 18788, 16208, -1 },
+    { 18767, 16209, -1 }, { 18766, 16210, -1 }, { 18758, 16211, -1 }, { 18780, 16212, -1 },
+    { 18746, 16213, -1 }, { 18751, 16214, -1 }, { 18806, 16215, -1 }, { 18787, 16215, -1 },
+    { 18788, 16215, -1 }, { 18787, 16215, -1 }, { 18801, 16215, -1 }, { 18789, 16215, -1 },
+    { 18775, 16216, -1 }, { 18883, 16221, -1 }, { 18901, 16222, -1 }, { 18864, 16223, -1 },
+    { 18774, 16216, -1 }, { 18787, 16216, -1 }, { 18818, 16218, -1 }, { 18866, 16224, -1 },
+    { 18921, 16225, -1 }, { 18785, 16216, -1 }, { 18786, 16216, -1 }, { 18795, 16216, -1 },
+    { 18825, 16216, -1 }, { 18827, 16218, -1 }, { 18771, 16216, -1 }, { 18872, 16226, -1 },
+    { 18914, 16227, -1 }, { 18808, 16216, -1 }, { 18781, 16216, -1 }, { 18811, 16216, -1 },
+    { 18912, 16228, -1 }, { 18892, 16219, -1 }, { 18883, 16229, -1 }, { 18780, 16216, -1 },
+    { 18913, 16230, -1 }, { 18851, 16218, -1 }, { 18804, 16216, -1 }, { 18790, 16216, -1 },
+    { 18878, 16218, -1 }, { 18867, 16219, -1 }, { 18822, 16218, -1 }, { 18881, 16218, -1 },
+    { 18849, 16219, -1 }, { 18845, 16219, -1 }, { 18886, 16218, -1 }, { 18796, 16216, -1 },
+    { 18799, 16216, -1 }, { 18833, 16216, -1 }, { 18872, 16231, -1 }, { 18899, 16232, -1 },
+    { 18912, 16233, -1 }, { 18825, 16218, -1 }, { 18866, 16218, -1 }, { 18897, 16234, -1 },
+    { 18825, 16216, -1 }, { 18840, 16216, -1 }, { 18832, 16216, -1 }, { 18830, 16216, -1 },
+    { 18798, 16216, -1 }, { 18818, 16217, -1 }, { 18877, 16235, -1 }, { 18931, 16236, -1 },
+    { 18851, 16217, -1 }, { 18879, 16237, -1 }, { 18820, 16216, -1 }, { 18843, 16217, -1 },
+    { 18794, 16216, -1 }, { 18880, 16238, -1 }, { 18837, 16219, -1 }, { 18894, 16239, -1 },
+    { 18793, 16216, -1 }, { 18800, 16216, -1 }, { 18889, 16240, -1 }, { 18855, 16218, -1 },
+    { 18820, 16217, -1 }, { 18892, 16241, -1 }, { 18926, 16242, -1 }, { 18877, 16218, -1 },
+    { 18857, 16217, -1 }, { 18815, 16217, -1 }, { 18827, 16217, -1 }, { 18854, 16217, -1 },
+    { 18848, 16217, -1 }, { 18858, 16219, -1 }, { 18808, 16217, -1 }, { 18890, 16243, -1 },
+    { 18886, 16244, -1 }, { 18846, 16217, -1 }, { 18895, 16220, -1 }, { 18918, 16245, -1 },
+    { 18899, 16246, -1 }, { 18926, 16247, -1 }, { 18889, 16248, -1 }, { 18883, 16219, -1 },
+    { 18886, 16219, -1 }, { 18892, 16220, -1 }, { 18886, 16249, -1 }, { 18887, 16250, -1 },
+    { 18930, 16251, -1 }, { 18894, 16252, -1 }, { 18913, 16253, -1 }, { 18934, 16254, -1 },
+    { 18926, 16255, -1 }, { 18908, 16256, -1 }, { 18857, 16217, -1 }, { 18854, 16217, -1 },
+    { 18841, 16217, -1 }, { 18865, 16217, -1 }, { 18826, 16217, -1 }, { 18843, 16220, -1 },
+    { 18851, 16217, -1 }, { 18943, 16257, -1 }, { 18861, 16220, -1 }, { 18830, 16217, -1 },
+    { 18856, 16217, -1 }, { 18923, 16258, -1 }, { 18901, 16220, -1 }, { 18879, 16220, -1 },
+    { 18934, 16259, -1 }, { 18828, 16217, -1 }, { 18925, 16260, -1 }, { 18953, 16261, -1 },
+    { 18958, 16262, -1 }, { 18896, 16220, -1 }, { 18898, 16263, -1 }, { 18959, 16264, -1 },
+    { 18886, 16220, -1 }, { 18900, 16265, -1 }, { 18915, 16266, -1 }, { 18928, 16267, -1 },
+    { 18957, 16268, -1 }, { 18888, 16220, -1 }, { 18965, 16269, -1 }, { 18904, 16270, -1 },
+    { 18935, 16271, -1 }, { 18934, 16272, -1 }, { 18935, 16273, -1 }, { 18970, 16274, -1 },
+    { 18910, 16275, -1 }, { 18911, 16276, -1 }, { 18912, 16277, -1 }, { 18934, 16278, -1 },
+    { 18944, 16279, -1 }, { 18959, 16280, -1 }, { 18976, 16281, -1 }, { 18920, 16282, -1 },
+    { 18877, 16220, -1 }, { 18912, 16220, -1 }, { 18969, 16283, -1 }, { 18968, 16284, -1 },
+    { 18947, 16285, -1 }, { 18930, 16286, -1 }, { 18977, 16287, -1 }, { 18934, 16288, -1 },
+    { 18975, 16289, -1 }, { 18976, 16290, -1 }, { 18929, 16291, -1 }, { 18955, 16292, -1 },
+    { 18934, 16293, -1 }, { 18942, 16294, -1 }, { 18941, 16295, -1 }, { 18961, 16296, -1 },
+    { 18993, 16297, -1 }, { 18959, 16298, -1 }, { 18983, 16299, -1 }, { 18984, 16300, -1 },
+    { 18966, 16301, -1 }, { 18983, 16302, -1 }, { 18968, 16303, -1 }, { 18946, 16304, -1 },
+    { 18961, 16305, -1 }, { 18988, 16306, -1 }, { 18994, 16307, -1 }, { 18997, 16308, -1 },
+    { 18989, 16309, -1 }, { 18986, 16310, -1 }, { 18944, 16311, -1 }, { 18950, 16312, -1 },
+    { 18994, 16313, -1 }, { 18951, 16314, -1 }, { 18955, 16315, -1 }, { 18990, 16316, -1 },
+    { 19002, 16317, -1 }, { 18968, 16318, -1 }, { 19008, 16319, -1 }, { 18961, 16320, -1 },
+    { 18963, 16321, -1 }, { 19020, 16322, -1 }, { 19001, 16323, -1 }, { 18988, 16324, -1 },
+    { 19006, 16325, -1 }, { 18966, 16326, -1 }, { 18967, 16327, -1 }, { 18992, 16317, -1 },
+    { 18992, 16328, -1 }, { 19001, 16329, -1 }, { 18984, 16330, -1 }, { 19029, 16331, -1 },
+    { 19017, 16332, -1 }, { 18971, 16333, -1 }, { 19021, 16334, -1 }, { 18986, 16335, -1 },
+    { 19022, 16336, -1 }, { 19029, 16337, -1 }, { 18996, 16338, -1 }, { 19025, 16339, -1 },
+    { 18989, 16340, -1 }, { 19007, 16341, -1 }, { 19040, 16342, -1 }, { 18987, 16343, -1 },
+    { 19002, 16344, -1 }, { 19031, 16345, -1 }, { 19032, 16346, -1 }, { 19033, 16347, -1 },
+    { 19023, 16348, -1 }, { 19007, 16349, -1 }, { 19017, 16350, -1 }, { 18992, 16311, -1 },
+    { 19002, 16351, -1 }, { 19003, 16352, -1 }, { 19007, 16353, -1 }, { 19040, 16354, -1 },
+    { 19041, 16355, -1 }, { 19042, 16356, -1 }, { 19013, 16357, -1 }, { 19043, 16358, -1 },
+    { 19014, 16359, -1 }, { 18996, 16360, -1 }, { 19053, 16361, -1 }, { 19049, 16362, -1 },
+    { 19009, 16363, -1 }, { 19055, 16364, -1 }, { 19033, 16365, -1 }, { 19041, 16366, -1 },
+    { 19036, 16367, -1 }, { 19057, 16368, -1 }, { 19016, 16369, -1 }, { 19028, 16370, -1 },
+    { 19038, 16371, -1 }, { 19055, 16372, -1 }, { 19021, 16373, -1 }, { 19049, 16374, -1 },
+    { 19054, 16375, -1 }, { 19049, 16376, -1 }, { 19066, 16377, -1 }, { 19026, 16378, -1 },
+    { 19030, 16379, -1 }, { 19077, 16380, -1 }, { 19039, 16381, -1 }, { 19049, 16382, -1 },
+    { 19034, 16383, -1 }, { 19048, 16384, -1 }, { 19035, 16385, -1 }, { 19036, 16386, -1 },
+    { 19073, 16387, -1 }, { 19063, 16388, -1 }, { 19055, 16389, -1 }, { 19071, 16390, -1 },
+    { 19069, 16391, -1 }, { 19028, 16393, -1 }, { 19056, 16392, -1 }, { 19041, 16394, -1 },
+    { 19037, 16395, -1 }, { 19043, 16396, -1 }, { 19045, 16397, -1 }, { 19073, 16398, -1 },
+    { 19083, 16399, -1 }, { 19097, 16400, -1 }, { 19062, 16401, -1 }, { 19093, 16402, -1 },
+    { 19095, 16403, -1 }, { 19078, 16407, -1 }, { 19053, 16404, -1 }, { 19070, 16405, -1 },
+    { 19093, 16406, -1 }, { 19047, 16408, -1 }, { 19095, 16409, -1 }, { 19058, 16410, -1 },
+    { 19092, 16411, -1 }, { 19099, 16412, -1 }, { 19066, 16414, -1 }, { 19061, 16413, -1 },
+    { 19056, 16415, -1 }, { 19053, 16416, -1 }, { 19069, 16417, -1 }, { 19070, 16418, -1 },
+    { 19071, 16419, -1 }, { 19070, 16420, -1 }, { 19118, 16421, -1 }, { 19118, 16424, -1 },
+    { 19095, 16422, -1 }, { 19081, 16423, -1 }, { 19066, 16425, -1 }, { 19069, 16426, -1 },
+    { 19098, 16427, -1 }, { 19091, 16428, -1 }, { 19115, 16429, -1 }, { 19079, 16430, -1 },
+    { 19071, 16431, -1 }, { 19097, 16432, -1 }, { 19069, 16433, -1 }, { 19070, 16434, -1 },
+    { 19110, 16435, -1 }, { 19085, 16436, -1 }, { 19103, 16437, -1 }, { 19086, 16438, -1 },
+    { 19088, 16439, -1 }, { 19080, 16440, -1 }, { 19112, 16441, -1 }, { 19117, 16442, -1 },
+    { 19133, 16443, -1 }, { 19112, 16444, -1 }, { 19125, 16445, -1 }, { 19117, 16446, -1 },
+    { 19113, 16447, -1 }, { 19107, 16448, -1 }, { 19145, 16449, -1 }, { 19146, 16450, -1 },
+    { 19104, 16451, -1 }, { 19140, 16452, -1 }, { 19101, 16453, -1 }, { 19097, 16454, -1 },
+    { 19150, 16455, -1 }, { 19149, 16456, -1 }, { 19082, 16412, -1 }, { 19139, 16457, -1 },
+    { 19140, 16458, -1 }, { 19155, 16459, -1 }, { 19096, 16460, -1 }, { 19109, 16461, -1 },
+    { 19110, 16462, -1 }, { 19110, 16463, -1 }, { 19113, 16464, -1 }, { 19137, 16465, -1 },
+    { 19138, 16466, -1 }, { 19105, 16467, -1 }, { 19130, 16468, -1 }, { 19122, 16469, -1 },
+    { 19123, 16470, -1 }, { 19131, 16471, -1 }, { 19159, 16472, -1 }, { 19166, 16473, -1 },
+    { 19133, 16474, -1 }, { 19164, 16475, -1 }, { 19145, 16476, -1 }, { 19152, 16477, -1 },
+    { 19157, 16478, -1 }, { 19167, 16479, -1 }, { 19178, 16480, -1 }, { 19130, 16481, -1 },
+    { 19173, 16482, -1 }, { 19142, 16483, -1 }, { 19175, 16484, -1 }, { 19124, 16485, -1 },
+    { 19153, 16486, -1 }, { 19176, 16487, -1 }, { 19175, 16488, -1 }, { 19136, 16489, -1 },
+    { 19159, 16490, -1 }, { 19180, 16491, -1 }, { 19150, 16492, -1 }, { 19187, 16493, -1 },
+    { 19154, 16494, -1 }, { 19164, 16495, -1 }, { 19193, 16496, -1 }, { 19172, 16497, -1 },
+    { 19164, 16498, -1 }, { 19168, 16499, -1 }, { 19169, 16500, -1 }, { 19154, 16501, -1 },
+    { 19160, 16502, -1 }, { 19170, 16504, -1 }, { 19187, 16503, -1 }, { 19188, 16505, -1 },
+    { 19189, 16506, -1 }, { 19194, 16507, -1 }, { 19146, 16508, -1 }, { 19172, 16509, -1 },
+    { 19168, 16510, -1 }, { 19177, 16511, -1 }, { 19195, 16512, -1 }, { 19161, 16513, -1 },
+    { 19167, 16514, -1 }, { 19175, 16515, -1 }, { 19185, 16516, -1 }, { 19171, 16517, -1 },
+    { 19170, 16518, -1 }, { 19205, 16519, -1 }, { 19210, 16520, -1 }, { 19203, 16521, -1 },
+    { 19162, 16522, -1 }, { 19209, 16523, -1 }, { 19222, 16524, -1 }, { 19183, 16525, -1 },
+    { 19193, 16527, -1 }, { 19210, 16526, -1 }, { 19211, 16528, -1 }, { 19212, 16529, -1 },
+    { 19196, 16530, -1 }, { 19182, 16531, -1 }, { 19198, 16532, -1 }, { 19202, 16533, -1 },
+    { 19224, 16534, -1 }, { 19188, 16535, -1 }, { 19196, 16536, -1 }, { 19206, 16537, -1 },
+    { 19207, 16538, -1 }, { 19233, 16539, -1 }, { 19200, 16540, -1 }, { 19206, 16541, -1 },
+    { 19208, 16542, -1 }, { 19209, 16543, -1 }, { 19229, 16544, -1 }, { 19242, 16545, -1 },
+    { 19234, 16546, -1 }, { 19241, 16547, -1 }, { 19237, 16548, -1 }, { 19195, 16549, -1 },
+    { 19210, 16550, -1 }, { 19234, 16551, -1 }, { 19224, 16552, -1 }, { 19247, 16553, -1 },
+    { 19217, 16554, -1 }, { 19204, 16557, -1 }, { 19242, 16555, -1 }, { 19255, 16556, -1 },
+    { 19218, 16558, -1 }, { 19228, 16559, -1 }, { 19220, 16560, -1 }, { 19230, 16561, -1 },
+    { 19250, 16562, -1 }, { 19251, 16563, -1 }, { 19253, 16564, -1 }, { 19211, 16565, -1 },
+    { 19219, 16566, -1 }, { 19260, 16567, -1 }, { 19263, 16568, -1 }, { 19263, 16569, -1 },
+    { 19230, 16570, -1 }, { 19240, 16571, -1 }, { 19232, 16572, -1 }, { 19242, 16573, -1 },
+    { 19234, 16574, -1 }, { 19244, 16575, -1 }, { 19225, 16576, -1 }, { 19219, 16577, -1 },
+    { 19266, 16578, -1 }, { 19268, 16579, -1 }, { 19268, 16580, -1 }, { 19269, 16581, -1 },
+    { 19270, 16582, -1 }, { 19246, 16583, -1 }, { 19239, 16584, -1 }, { 19266, 16589, -1 },
+    { 19282, 16585, -1 }, { 19285, 16586, -1 }, { 19238, 16587, -1 }, { 19265, 16588, -1 },
+    { 19266, 16590, -1 }, { 19278, 16591, -1 }, { 19289, 16592, -1 }, { 19290, 16593, -1 },
+    { 19261, 16594, -1 }, { 19254, 16595, -1 }, { 19264, 16596, -1 }, { 19237, 16597, -1 },
+    { 19242, 16598, -1 }, { 19288, 16599, -1 }, { 19285, 16600, -1 }, { 19261, 16601, -1 },
+    { 19288, 16602, -1 }, { 19289, 16603, -1 }, { 19269, 16604, -1 }, { 19289, 16605, -1 },
+    { 19289, 16606, -1 }, { 19297, 16607, -1 }, { 19308, 16608, -1 }, { 19297, 16609, -1 },
+    { 19289, 16610, -1 }, { 19311, 16611, -1 }, { 19300, 16612, -1 }, { 19295, 16613, -1 },
+    { 19298, 16614, -1 }, { 19257, 16615, -1 }, { 19254, 16616, -1 }, { 19261, 16617, -1 },
+    { 19302, 16618, -1 }, { 19303, 16619, -1 }, { 19309, 16620, -1 }, { 19289, 16621, -1 },
+    { 19313, 16622, -1 }, { 19320, 16623, -1 }, { 19309, 16624, -1 }, { 19286, 16625, -1 },
+    { 19296, 16626, -1 }, { 19274, 16627, -1 }, { 19295, 16628, -1 }, { 19296, 16629, -1 },
+    { 19274, 16630, -1 }, { 19317, 16631, -1 }, { 19321, 16632, -1 }, { 19325, 16633, -1 },
+    { 19302, 16634, -1 }, { 19282, 16635, -1 }, { 19274, 16636, -1 }, { 19292, 16637, -1 },
+    { 19327, 16638, -1 }, { 19282, 16639, -1 }, { 19304, 16640, -1 }, { 19257, 16611, -1 },
+    { 19309, 16641, -1 }, { 19301, 16642, -1 }, { 19337, 16643, -1 }, { 19322, 16644, -1 },
+    { 19297, 16645, -1 }, { 19289, 16646, -1 }, { 19332, 16648, -1 }, { 19296, 16647, -1 },
+    { 19334, 16646, -1 }, { 19335, 16649, -1 }, { 19328, 16650, -1 }, { 19331, 16651, -1 },
+    { 19325, 16652, -1 }, { 19353, 16653, -1 }, { 19350, 16654, -1 }, { 19309, 16655, -1 },
+    { 19345, 16656, -1 }, { 19324, 16657, -1 }, { 19348, 16658, -1 }, { 19351, 16659, -1 },
+    { 19362, 16660, -1 }, { 19329, 16661, -1 }, { 19352, 16662, -1 }, { 19331, 16663, -1 },
+    { 19333, 16664, -1 }, { 19337, 16665, -1 }, { 19307, 16666, -1 }, { 19364, 16668, -1 },
+    { 19332, 16667, -1 }, { 19371, 16669, -1 }, { 19309, 16670, -1 }, { 19373, 16671, -1 },
+    { 19320, 16672, -1 }, { 19347, 16673, -1 }, { 19326, 16674, -1 }, { 19327, 16675, -1 },
+    { 19345, 16676, -1 }, { 19329, 16677, -1 }, { 19379, 16678, -1 }, { 19337, 16679, -1 },
+    { 19350, 16680, -1 }, { 19343, 16681, -1 }, { 19337, 16682, -1 }, { 19383, 16683, -1 },
+    { 19380, 16684, -1 }, { 19325, 16685, -1 }, { 19388, 16686, -1 }, { 19389, 16687, -1 },
+    { 19378, 16688, -1 }, { 19335, 16689, -1 }, { 19365, 16690, -1 }, { 19342, 16691, -1 },
+    { 19347, 16692, -1 }, { 19392, 16693, -1 }, { 19353, 16694, -1 }, { 19391, 16695, -1 },
+    { 19338, 16696, -1 }, { 19352, 16697, -1 }, { 19394, 16698, -1 }, { 19386, 16699, -1 },
+    { 19356, 16700, -1 }, { 19367, 16701, -1 }, { 19366, 16703, -1 }, { 19356, 16705, -1 },
+    { 19377, 16702, -1 }, { 19355, 16704, -1 }, { 19410, 16706, -1 }, { 19410, 16707, -1 },
+    { 19401, 16698, -1 }, { 19363, 16708, -1 }, { 19401, 16709, -1 }, { 19367, 16710, -1 },
+    { 19368, 16711, -1 }, { 19404, 16712, -1 }, { 19405, 16713, -1 }, { 19401, 16714, -1 },
+    { 19388, 16715, -1 }, { 19389, 16716, -1 }, { 19390, 16717, -1 }, { 19382, 16718, -1 },
+    { 19368, 16719, -1 }, { 19415, 16720, -1 }, { 19399, 16721, -1 }, { 19409, 16722, -1 },
+    { 19390, 16723, -1 }, { 19424, 16724, -1 }, { 19415, 16725, -1 }, { 19404, 16726, -1 },
+    { 19377, 16727, -1 }, { 19396, 16728, -1 }, { 19370, 16729, -1 }, { 19434, 16730, -1 },
+    { 19388, 16731, -1 }, { 19386, 16732, -1 }, { 19408, 16733, -1 }, { 19425, 16734, -1 },
+    { 19380, 16735, -1 }, { 19426, 16736, -1 }, { 19427, 16737, -1 }, { 19431, 16738, -1 },
+    { 19430, 16739, -1 }, { 19397, 16740, -1 }, { 19430, 16741, -1 }, { 19434, 16742, -1 },
+    { 19435, 16743, -1 }, { 19445, 16744, -1 }, { 19387, 16745, -1 }, { 19413, 16746, -1 },
+    { 19417, 16747, -1 }, { 19419, 16748, -1 }, { 19441, 16750, -1 }, { 19367, 16701, -1 },
+    { 19454, 16749, -1 }, { 19397, 16751, -1 }, { 19449, 16752, -1 }, { 19444, 16753, -1 },
+    { 19404, 16754, -1 }, { 19429, 16755, -1 }, { 19413, 16756, -1 }, { 19414, 16757, -1 },
+    { 19415, 16758, -1 }, { 19407, 16759, -1 }, { 19430, 16760, -1 }, { 19442, 16761, -1 },
+    { 19429, 16764, -1 }, { 19427, 16762, -1 }, { 19437, 16763, -1 }, { 19422, 16765, -1 },
+    { 19459, 16766, -1 }, { 19460, 16767, -1 }, { 19472, 16768, -1 }, { 19428, 16769, -1 },
+    { 19461, 16770, -1 }, { 19466, 16771, -1 }, { 19463, 16772, -1 }, { 19444, 16773, -1 },
+    { 19466, 16776, -1 }, { 19463, 16774, -1 }, { 19437, 16775, -1 }, { 19465, 16777, -1 },
+    { 19433, 16778, -1 }, { 19484, 16779, -1 }, { 19472, 16780, -1 }, { 19428, 16781, -1 },
+    { 19463, 16782, -1 }, { 19430, 16783, -1 }, { 19431, 16784, -1 }, { 19483, 16788, -1 },
+    { 19433, 16785, -1 }, { 19470, 16786, -1 }, { 19471, 16787, -1 }, { 19454, 16789, -1 },
+    { 19473, 16790, -1 }, { 19430, 16776, -1 }, { 19462, 16791, -1 }, { 19455, 16792, -1 },
+    { 19435, 16793, -1 }, { 19490, 16794, -1 }, { 19483, 16795, -1 }, { 19471, 16796, -1 },
+    { 19451, 16797, -1 }, { 19452, 16798, -1 }, { 19446, 16799, -1 }, { 19454, 16800, -1 },
+    { 19472, 16801, -1 }, { 19484, 16802, -1 }, { 19485, 16803, -1 }, { 19486, 16804, -1 },
+    { 19497, 16805, -1 }, { 19453, 16806, -1 }, { 19465, 16807, -1 }, { 19450, 16808, -1 },
+    { 19458, 16809, -1 }, { 19458, 16810, -1 }, { 19496, 16811, -1 }, { 19465, 16812, -1 },
+    { 19477, 16813, -1 }, { 19479, 16814, -1 }, { 19486, 16815, -1 }, { 19509, 16816, -1 },
+    { 19508, 16817, -1 }, { 19476, 16818, -1 }, { 19477, 16819, -1 }, { 19504, 16820, -1 },
+    { 19525, 16821, -1 }, { 19468, 16822, -1 }, { 19492, 16823, -1 }, { 19529, 16824, -1 },
+    { 19517, 16825, -1 }, { 19531, 16826, -1 }, { 19469, 16827, -1 }, { 19519, 16828, -1 },
+    { 19534, 16829, -1 }, { 19472, 16830, -1 }, { 19536, 16831, -1 }, { 19496, 16832, -1 },
+    { 19475, 16833, -1 }, { 19505, 16834, -1 }, { 19503, 16835, -1 }, { 19487, 16836, -1 },
+    { 19540, 16837, -1 }, { 19526, 16838, -1 }, { 19532, 16839, -1 }, { 19495, 16840, -1 },
+    { 19509, 16841, -1 }, { 19529, 16842, -1 }, { 19537, 16843, -1 }, { 19526, 16844, -1 },
+    { 19527, 16845, -1 }, { 19534, 16846, -1 }, { 19519, 16847, -1 }, { 19492, 16848, -1 },
+    { 19523, 16849, -1 }, { 19544, 16850, -1 }, { 19525, 16851, -1 }, { 19523, 16852, -1 },
+    { 19504, 16853, -1 }, { 19547, 16854, -1 }, { 19533, 16855, -1 }, { 19498, 16856, -1 },
+    { 19524, 16857, -1 }, { 19524, 16858, -1 }, { 19554, 16859, -1 }, { 19531, 16860, -1 },
+    { 19561, 16861, -1 }, { 19562, 16862, -1 }, { 19534, 16863, -1 }, { 19557, 16864, -1 },
+    { 19514, 16865, -1 }, { 19531, 16866, -1 }, { 19538, 16867, -1 }, { 19526, 16868, -1 },
+    { 19526, 16869, -1 }, { 19558, 16870, -1 }, { 19559, 16871, -1 }, { 19559, 16872, -1 },
+    { 19530, 16873, -1 }, { 19562, 16874, -1 }, { 19517, 16875, -1 }, { 19572, 16876, -1 },
+    { 19569, 16877, -1 }, { 19566, 16878, -1 }, { 19570, 16879, -1 }, { 0, 16880, 2 },
+    { 19485, 16881, -1 }, { 0, 16882, 8 }, { 0, 16883, 10 }, { 19481, 16884, -1 },
+    { 19485, 16885, -1 }, { 0, 16886, 15 }, { 0, 16887, 16 }, { 19487, 16888, -1 },
+    { 19488, 16889, -1 }, { 19486, 16890, -1 }, { 19491, 16891, -1 }, { 0, 16892, 23 },
+    { 19490, 16893, -1 }, { 19489, 16894, -1 }, { 19492, 16895, -1 }, { 19491, 16896, -1 },
+    { 0, 16897, 43 }, { 0, 16898, 47 }, { 0, 16899, 48 }, { 0, 16900, 52 },
+    { 0, 16901, 54 }, { 19494, 16902, -1 }, { 19496, 16903, -1 }, { 19496, 16904, -1 },
+    { 19498, 16905, -1 }, { 0, 16906, 67 }, { 19496, 16907, -1 }, { 0, 16908, 70 },
+    { 0, 16909, 72 }, { 0, 16910, 77 }, { 0, 16911, 78 }, { 19497, 16912, -1 },
+    { 0, 16913, 89 }, { 0, 16914, 92 }, { 0, 16915, 93 }, { 0, 16916, 102 },
+    { 0, 16917, 113 }, { 0, 16918, 121 }, { 0, 16919, 122 }, { 0, 16920, 123 },
+    { 0, 16921, 124 }, { 19499, 16922, -1 }, { 0, 16923, 130 }, { 19501, 16924, -1 },
+    { 19501, 16925, -1 }, { 19503, 16926, -1 }, { 19503, 16927, -1 }, { 0, 16928, 147 },
+    { 19506, 16929, -1 }, { 19507, 16952, -1 }, { 19509, 16975, -1 }, { 19510, 16930, -1 },
+    { 19512, 16935, -1 }, { 19512, 16931, -1 }, { 19512, 16933, -1 }, { 19514, 16932, -1 },
+    { 19513, 16939, -1 }, { 19516, 16934, -1 }, { 0, 16936, 166 }, { 0, 16937, 168 },
+    { 0, 16938, 170 }, { 19518, 16940, -1 }, { 19519, 16941, -1 }, { 19518, 16942, -1 },
+    { 19522, 16943, -1 }, { 0, 16944, 212 }, { 0, 16945, 214 }, { 19523, 16946, -1 },
+    { 0, 16947, 222 }, { 0, 16948, 233 }, { 0, 16949, 234 }, { 19522, 16950, -1 },
+    { 19524, 16951, -1 }, { 19507, 16952, -1 }, { 19525, 16953, -1 }, { 19524, 16954, -1 },
+    { 19526, 16955, -1 }, { 0, 16956, 253 }, { 0, 16957, 254 }, { 0, 16958, 255 },
+    { 0, 16959, 256 }, { 0, 16960, 257 }, { 0, 16961, 258 }, { 19527, 16962, -1 },
+    { 0, 16963, 260 }, { 0, 16964, 261 }, { 0, 16965, 262 }, { 0, 16966, 263 },
+    { 0, 16967, 264 }, { 0, 16968, 265 }, { 0, 16971, 266 }, { 0, 16969, 267 },
+    { 0, 16970, 270 }, { 0, 16972, 271 }, { 0, 16973, 272 }, { 0, 16974, 273 },
+    { 0, 16976, 274 }, { 0, 16977, 276 }, { 0, 16978, 277 }, { 0, 16979, 278 },
+    { 0, 16980, 279 }, { 0, 16981, 280 }, { 0, 16983, 281 }, { 0, 16982, 282 },
+    { 0, 16984, 284 }, { 0, 16985, 285 }, { 0, 16986, 286 }, { 0, 17003, 287 },
+    { 0, 16987, 288 }, { 0, 17000, 289 }, { 0, 16988, 293 }, { 0, 16989, 294 },
+    { 0, 16990, 295 }, { 0, 16991, 296 }, { 19528, 16992, -1 }, { 0, 16993, 302 },
+    { 0, 16994, 303 }, { 0, 16995, 304 }, { 0, 16996, 305 }, { 0, 16997, 306 },
+    { 0, 16998, 308 }, { 0, 16999, 309 }, { 0, 17059, 310 }, { 0, 17001, 311 },
+    { 0, 17002, 312 }, { 0, 17004, 313 }, { 0, 17005, 314 }, { 19531, 17006, -1 },
+    { 0, 17007, 319 }, { 0, 17008, 320 }, { 0, 17009, 321 }, { 0, 17010, 322 },
+    { 0, 17011, 323 }, { 0, 17012, 324 }, { 0, 17013, 327 }, { 0, 17014, 328 },
+    { 0, 17015, 329 }, { 0, 17016, 330 }, { 19529, 16992, -1 }, { 19528, 17017, -1 },
+    { 0, 17018, 333 }, { 0, 17019, 335 }, { 19533, 17020, -1 }, { 19534, 17021, -1 },
+    { 19533, 17022, -1 }, { 0, 17023, 343 }, { 0, 17032, 344 }, { 0, 17024, 345 },
+    { 0, 17025, 346 }, { 0, 17026, 348 }, { 0, 17027, 349 }, { 0, 17028, 351 },
+    { 0, 17029, 352 }, { 0, 17019, 336 }, { 0, 17030, 353 }, { 0, 17031, 357 },
+    { 0, 17033, 359 }, { 0, 17034, 360 }, { 0, 17035, 362 }, { 0, 17036, 363 },
+    { 0, 17037, 364 }, { 0, 17038, 366 }, { 0, 17034, 361 }, { 0, 17039, 368 },
+    { 0, 17040, 369 }, { 0, 17041, 370 }, { 0, 17042, 373 }, { 0, 17043, 374 },
+    { 0, 17044, 375 }, { 0, 17045, 377 }, { 0, 17046, 379 }, { 0, 17047, 380 },
+    { 0, 17048, 381 }, { 19536, 17049, -1 }, { 0, 17050, 383 }, { 0, 17051, 384 },
+    { 0, 17052, 387 }, { 0, 17053, 388 }, { 0, 17054, 389 }, { 0, 17055, 390 },
+    { 0, 17056, 391 }, { 0, 17057, 392 }, { 0, 17058, 393 }, { 0, 17060, 394 },
+    { 0, 17061, 395 }, { 0, 17062, 397 }, { 0, 17063, 401 }, { 0, 17064, 403 },
+    { 0, 17065, 407 }, { 0, 17066, 408 }, { 0, 17067, 409 }, { 0, 17068, 410 },
+    { 0, 17069, 411 }, { 0, 17070, 412 }, { 0, 17071, 414 }, { 0, 17072, 416 },
+    { 0, 17073, 418 }, { 19537, 17074, -1 }, { 19538, 17075, -1 }, { 0, 17076, 421 },
+    { 0, 17077, 422 }, { 0, 17078, 423 }, { 0, 17079, 426 }, { 0, 17080, 427 },
+    { 0, 17081, 428 }, { 0, 17082, 429 }, { 19536, 17083, -1 }, { 0, 17082, 430 },
+    { 19538, 17084, -1 }, { 19541, 17085, -1 }, { 19539, 17086, -1 }, { 19544, 17087, -1 },
+    { 19541, 17088, -1 }, { 0, 17089, 469 }, { 0, 17090, 474 }, { 19544, 17091, -1 },
+    { 19542, 17092, -1 }, { 19547, 17093, -1 }, { 19548, 17101, -1 }, { 0, 17094, 506 },
+    { 0, 17095, 515 }, { 0, 17096, 519 }, { 0, 17097, 520 }, { 0, 17098, 523 },
+    { 19549, 17099, -1 }, { 19550, 17100, -1 }, { 0, 17102, 526 }, { 19551, 17103, -1 },
+    { 0, 17104, 529 }, { 19553, 17105, -1 }, { 19552, 17106, -1 }, { 19554, 17107, -1 },
+    { 19555, 17108, -1 }, { 19554, 17109, -1 }, { 0, 17110, 668 }, { 19556, 17111, -1 },
+    { 0, 17112, 671 }, { 19559, 17113, -1 }, { 19561, 17114, -1 }, { 0, 17115, 683 },
+    { 19558, 17116, -1 }, { 0, 17117, 702 }, { 19561, 17118, -1 }, { 0, 17119, 713 },
+    { 0, 17120, 714 }, { 0, 17121, 716 }, { 19563, 17122, -1 }, { 0, 17123, 722 },
+    { 19562, 17124, -1 }, { 19563, 17125, -1 }, { 19562, 17126, -1 }, { 19567, 17127, -1 },
+    { 19567, 17128, -1 }, { 0, 17129, 757 }, { 19565, 17130, -1 }, { 0, 17131, 766 },
+    { 19571, 17132, -1 }, { 0, 17133, 781 }, { 0, 17134, 782 }, { 0, 17135, 789 },
+    { 0, 17136, 793 }, { 0, 17137, 805 }, { 19570, 17138, -1 }, { 0, 17139, 809 },
+    { 0, 17140, 828 }, { 19572, 17141, -1 }, { 0, 17142, 834 }, { 0, 17143, 838 },
+    { 0, 17144, 839 }, { 0, 17145, 840 }, { 19572, 17146, -1 }, { 19570, 17147, -1 },
+    { 0, 17148, 865 }, { 19575, 17149, -1 }, { 0, 17150, 901 }, { 0, 17151, 902 },
+    { 0, 17152, 907 }, { 0, 17153, 908 }, { 0, 17154, 910 }, { 0, 17155, 914 },
+    { 0, 17156, 918 }, { 0, 17157, 920 }, { 0, 17158, 921 }, { 0, 17159, 933 },
+    { 0, 17160, 936 }, { 0, 17161, 938 }, { 19575, 17162, -1 }, { 0, 17163, 957 },
+    { 0, 17164, 962 }, { 0, 17165, 971 }, { 0, 17166, 989 }, { 0, 17167, 993 },
+    { 0, 17168, 994 }, { 0, 17169, 997 }, { 0, 17170, 998 }, { 0, 17171, 999 },
+    { 0, 17172, 1005 }, { 0, 17173, 1006 }, { 0, 17174, 1008 }, { 0, 17175, 1009 },
+    { 0, 17176, 1014 }, { 0, 17177, 1017 }, { 0, 17178, 1025 }, { 19577, 17179, -1 },
+    { 0, 17180, 1039 }, { 0, 17181, 1041 }, { 0, 17182, 1042 }, { 0, 17183, 1043 },
+    { 19575, 17184, -1 }, { 0, 17185, 1055 }, { 0, 17186, 1105 }, { 0, 17187, 1106 },
+    { 0, 17188, 1119 }, { 0, 17189, 1125 }, { 0, 17190, 1129 }, { 19578, 17191, -1 },
+    { 0, 17192, 1131 }, { 19580, 17193, -1 }, { 0, 17194, 1136 }, { 19578, 17195, -1 },
+    { 19579, 17196, -1 }, { 19579, 17197, -1 }, { 0, 17198, 1165 }, { 19581, 17199, -1 },
+    { 0, 17200, 1175 }, { 19584, 17201, -1 }, { 19586, 17202, -1 }, { 0, 17203, 1191 },
+    { 19587, 17204, -1 }, { 0, 17205, 1200 }, { 0, 17206, 1201 }, { 19586, 17207, -1 },
+    { 0, 17208, 1203 }, { 0, 17209, 1209 }, { 0, 17210, 1216 }, { 0, 17211, 1218 },
+    { 0, 17212, 1219 }, { 0, 17213, 1220 }, { 19590, 17214, -1 }, { 19589, 17215, 1236 },
+    { 0, 17216, 1239 }, { 0, 17217, 1261 }, { 0, 17218, 1264 }, { 0, 17219, 1275 },
+    { 0, 17220, 1278 }, { 0, 17221, 1279 }, { 0, 17222, 1287 }, { 0, 17223, 1290 },
+    { 0, 17224, 1308 }, { 0, 17236, 1309 }, { 0, 17225, 1314 }, { 0, 17226, 1316 },
+    { 19592, 17227, -1 }, { 0, 17228, 1327 }, { 19593, 17229, -1 }, { 0, 17230, 1342 },
+    { 19591, 17231, -1 }, { 19594, 17232, -1 }, { 19595, 17233, -1 }, { 0, 17234, 1358 },
+    { 0, 17235, 1369 }, { 0, 17237, 1376 }, { 0, 17238, 1386 }, { 19596, 17239, -1 },
+    { 0, 17240, 1410 }, { 0, 17241, 1427 }, { 0, 17242, 1431 }, { 19598, 17243, -1 },
+    { 19599, 17244, -1 }, { 19601, 17245, -1 }, { 19597, 17246, -1 }, { 19600, 17247, -1 },
+    { 19599, 17248, -1 }, { 0, 17249, 1458 }, { 19600, 17250, -1 }, { 19605, 17251, -1 },
+    { 19605, 17252, -1 }, { 0, 17253, 1501 }, { 0, 17254, 1502 }, { 0, 17255, 1504 },
+    { 0, 17256, 1505 }, { 0, 17257, 1508 }, { 19607, 17258, -1 }, { 19605, 17259, -1 },
+    { 19609, 17260, -1 }, { 19610, 17261, -1 }, { 19610, 17262, -1 }, { 19612, 17263, -1 },
+    { 19613, 17264, -1 }, { 0, 17267, 1533 }, { 19614, 17265, -1 }, { 19615, 17266, -1 },
+    { 0, 17268, 1537 }, { 0, 17269, 1538 }, { 0, 17270, 1539 }, { 19612, 17271, -1 },
+    { 19617, 17272, -1 }, { 0, 17273, 1553 }, { 19618, 17274, -1 }, { 19619, 17275, -1 },
+    { 0, 17276, 1556 }, { 0, 17277, 1557 }, { 19620, 17278, -1 }, { 19620, 17279, -1 },
+    { 0, 17280, 1588 }, { 19621, 17281, -1 }, { 19624, 17282, -1 }, { 19621, 17283, -1 },
+    { 0, 17284, 1602 }, { 19621, 17285, -1 }, { 0, 17286, 1616 }, { 0, 17287, 1617 },
+    { 19624, 17288, -1 }, { 0, 17289, 1621 }, { 0, 17290, 1622 }, { 0, 17291, 1624 },
+    { 0, 17292, 1625 }, { 0, 17293, 1626 }, { 0, 17294, 1633 }, { 19625, 17295, -1 },
+    { 19628, 17296, -1 }, { 19627, 17297, -1 }, { 0, 17298, 1664 }, { 0, 17299, 1673 },
+    { 19629, 17300, -1 }, { 0, 17301, 1689 }, { 0, 17302, 1690 }, { 19629, 17303, -1 },
+    { 0, 17304, 1694 }, { 0, 17305, 1698 }, { 19628, 17306, -1 }, { 0, 17307, 1705 },
+    { 19630, 17308, -1 }, { 0, 17309, 1721 }, { 0, 17310, 1727 }, { 0, 17311, 1731 },
+    { 19634, 17312, -1 }, { 0, 17313, 1783 }, { 0, 17314, 1784 }, { 19632, 17315, -1 },
+    { 19636, 17316, -1 }, { 19634, 17317, -1 }, { 19637, 17318, -1 }, { 0, 17319, 1812 },
+    { 19639, 17320, -1 }, { 19640, 17321, -1 }, { 0, 17322, 1817 }, { 19639, 17323, -1 },
+    { 0, 17324, 1824 }, { 0, 17325, 1831 }, { 0, 17326, 1839 }, { 19641, 17327, -1 },
+    { 0, 17328, 1849 }, { 19642, 17329, -1 }, { 19643, 17330, -1 }, { 19645, 17331, -1 },
+    { 0, 17332, 1870 }, { 0, 17333, 1877 }, { 19642, 17334, -1 }, { 0, 17335, 1879 },
+    { 19644, 17336, -1 }, { 0, 17337, 1887 }, { 19646, 17338, -1 }, { 0, 17339, 1905 },
+    { 0, 17340, 1920 }, { 19649, 17341, -1 }, { 0, 17342, 1922 }, { 19647, 17343, -1 },
+    { 19651, 17344, -1 }, { 19652, 17345, -1 }, { 0, 17346, 1936 }, { 19654, 17347, -1 },
+    { 0, 17348, 1958 }, { 19655, 17349, -1 }, { 19657, 17350, -1 }, { 0, 17351, 1963 },
+    { 0, 17352, 1966 }, { 0, 17353, 1967 }, { 0, 17362, 1968 }, { 0, 17354, 1969 },
+    { 19656, 17355, -1 }, { 0, 17356, 1985 }, { 0, 17357, 1987 }, { 0, 17358, 1988 },
+    { 19658, 17359, -1 }, { 0, 17360, 2014 }, { 0, 17361, 2021 }, { 0, 17363, 2022 },
+    { 0, 17364, 2024 }, { 0, 17365, 2025 }, { 19659, 17366, -1 }, { 0, 17367, 2035 },
+    { 0, 17368, 2039 }, { 0, 17369, 2044 }, { 0, 17370, 2045 }, { 19660, 17371, -1 },
+    { 0, 17372, 2048 }, { 0, 17373, 2049 }, { 0, 17374, 2051 }, { 19660, 17375, -1 },
+    { 19659, 17376, -1 }, { 0, 17377, 2054 }, { 0, 17378, 2056 }, { 19663, 17379, -1 },
+    { 19664, 17380, -1 }, { 19662, 17381, -1 }, { 19664, 17382, -1 }, { 19664, 17383, -1 },
+    { 19664, 17414, -1 }, { 0, 17384, 2068 }, { 0, 17385, 2070 }, { 19669, 17386, -1 },
+    { 19666, 17387, -1 }, { 19668, 17388, -1 }, { 0, 17389, 2118 }, { 0, 17390, 2122 },
+    { 0, 17391, 2126 }, { 19671, 17392, -1 }, { 0, 17393, 2139 }, { 19671, 17394, -1 },
+    { 0, 17395, 2148 }, { 19675, 17396, -1 }, { 19675, 17397, -1 }, { 19672, 17398, -1 },
+    { 0, 17399, 2188 }, { 19674, 17400, -1 }, { 0, 17401, 2190 }, { 0, 17402, 2191 },
+    { 0, 17403, 2192 }, { 19674, 17404, -1 }, { 19678, 17405, -1 }, { 19679, 17406, -1 },
+    { 0, 17407, 2231 }, { 19677, 17408, -1 }, { 0, 17409, 2240 }, { 0, 17410, 2241 },
+    { 0, 17411, 2251 }, { 0, 17412, 2258 }, { 0, 17413, 2261 }, { 0, 17415, 2262 },
+    { 0, 17416, 2266 }, { 0, 17417, 2270 }, { 19678, 17418, -1 }, { 19682, 17419, -1 },
+    { 0, 17420, 2278 }, { 19681, 17421, -1 }, { 19682, 17422, -1 }, { 0, 17423, 2285 },
+    { 19685, 17424, -1 }, { 0, 17425, 2291 }, { 19687, 17426, -1 }, { 19688, 17427, -1 },
+    { 0, 17428, 2304 }, { 19690, 17429, -1 }, { 19690, 17430, -1 }, { 0, 17431, 2319 },
+    { 0, 17432, 2320 }, { 19691, 17433, -1 }, { 19691, 17434, -1 }, { 19691, 17435, -1 },
+    { 0, 17436, 2364 }, { 19690, 17437, -1 }, { 19691, 17438, -1 }, { 0, 17439, 2375 },
+    { 0, 17440, 2376 }, { 0, 17441, 2377 }, { 19696, 17442, -1 }, { 19697, 17443, -1 },
+    { 0, 17444, 2389 }, { 19695, 17445, -1 }, { 0, 17446, 2403 }, { 0, 17447, 2404 },
+    { 0, 17448, 2405 }, { 0, 17449, 2408 }, { 0, 17450, 2418 }, { 0, 17451, 2425 },
+    { 0, 17452, 2426 }, { 19699, 17453, -1 }, { 19701, 17454, -1 }, { 0, 17455, 2449 },
+    { 19701, 17456, -1 }, { 0, 17457, 2452 }, { 0, 17458, 2457 }, { 0, 17459, 2469 },
+    { 19702, 17460, -1 }, { 0, 17461, 2479 }, { 0, 17462, 2481 }, { 0, 17463, 2485 },
+    { 0, 17464, 2486 }, { 0, 17465, 2488 }, { 0, 17466, 2489 }, { 0, 17467, 2494 },
+    { 0, 17468, 2515 }, { 19700, 17469, -1 }, { 19704, 17470, -1 }, { 0, 17471, 2526 },
+    { 0, 17472, 2527 }, { 0, 17502, 2528 }, { 0, 17473, 2537 }, { 19705, 17474, -1 },
+    { 0, 17475, 2542 }, { 0, 17476, 2543 }, { 0, 17477, 2548 }, { 0, 17478, 2553 },
+    { 0, 17479, 2557 }, { 19704, 17480, -1 }, { 0, 17481, 2563 }, { 0, 17482, 2569 },
+    { 0, 17483, 2570 }, { 0, 17484, 2573 }, { 0, 17485, 2578 }, { 0, 17486, 2584 },
+    { 19704, 17487, -1 }, { 19709, 17488, -1 }, { 0, 17489, 2593 }, { 0, 17490, 2597 },
+    { 0, 17491, 2600 }, { 0, 17492, 2602 }, { 0, 17493, 2610 }, { 0, 17494, 2611 },
+    { 19710, 17495, -1 }, { 19711, 17496, -1 }, { 19711, 17497, -1 }, { 19713, 17498, -1 },
+    { 0, 17499, 2626 }, { 19712, 17500, -1 }, { 0, 17501, 2632 }, { 0, 17503, 2633 },
+    { 19711, 17504, -1 }, { 19715, 17505, -1 }, { 0, 17506, 2645 }, { 0, 17507, 2653 },
+    { 19713, 17508, -1 }, { 19718, 17509, -1 }, { 0, 17510, 2687 }, { 19717, 17511, -1 },
+    { 0, 17512, 2721 }, { 19720, 17513, -1 }, { 19717, 17514, -1 }, { 0, 17515, 2728 },
+    { 0, 17516, 2731 }, { 0, 17517, 2733 }, { 0, 17518, 2734 }, { 19722, 17519, -1 },
+    { 19723, 17520, -1 }, { 0, 17521, 2757 }, { 0, 17522, 2763 }, { 19724, 17523, -1 },
+    { 19726, 17524, -1 }, { 19726, 17525, -1 }, { 19723, 17526, -1 }, { 0, 17527, 2824 },
+    { 19725, 17528, -1 }, { 0, 17529, 2828 }, { 0, 17530, 2836 }, { 0, 17531, 2841 },
+    { 0, 17532, 2842 }, { 0, 17533, 2845 }, { 0, 17535, 2849 }, { 0, 17534, 2846 },
+    { 0, 17536, 2851 }, { 0, 17530, 2837 }, { 0, 17540, 2852 }, { 0, 17541, 2854 },
+    { 0, 17545, 2855 }, { 0, 17546, 2857 }, { 0, 17547, 2858 }, { 0, 17550, 2862 },
+    { 0, 17553, 2863 }, { 0, 17535, 2850 }, { 0, 17540, 2853 }, { 0, 17554, 2864 },
+    { 0, 17534, 2847 }, { 0, 17545, 2856 }, { 0, 17548, 2859 }, { 0, 17555, 2865 },
+    { 0, 17548, 2860 }, { 0, 17559, 2866 }, { 0, 17563, 2870 }, { 0, 17562, 2867 },
+    { 0, 17532, 2843 }, { 0, 17534, 2848 }, { 0, 17530, 2838 }, { 0, 17571, 2872 },
+    { 0, 17572, 2875 }, { 0, 17571, 2873 }, { 0, 17563, 2871 }, { 0, 17571, 2874 },
+    { 0, 17573, 2878 }, { 0, 17580, 2880 }, { 0, 17530, 2839 }, { 0, 17581, 2881 },
+    { 0, 17582, 2884 }, { 0, 17583, 2885 }, { 0, 17532, 2844 }, { 0, 17584, 2886 },
+    { 0, 17548, 2861 }, { 0, 17590, 2887 }, { 0, 17572, 2876 }, { 0, 17530, 2840 },
+    { 0, 17562, 2868 }, { 0, 17596, 2890 }, { 0, 17592, 2888 }, { 0, 17597, 2891 },
+    { 0, 17572, 2877 }, { 0, 17592, 2889 }, { 0, 17585, 2892 }, { 0, 17588, 2893 },
+    { 0, 17591, 2894 }, { 0, 17600, 2895 }, { 0, 17604, 2896 }, { 0, 17605, 2897 },
+    { 0, 17606, 2898 }, { 0, 17562, 2869 }, { 0, 17607, 2899 }, { 0, 17608, 2900 },
+    { 0, 17610, 2901 }, { 0, 17613, 2902 }, { 0, 17630, 2903 }, { 0, 17631, 2904 },
+    { 0, 17632, 2905 }, { 0, 17633, 2907 }, { 0, 17634, 2909 }, { 0, 17581, 2882 },
+    { 0, 17636, 2910 }, { 0, 17639, 2911 }, { 0, 17640, 2912 }, { 0, 17645, 2913 },
+    { 0, 17542, 2914 }, { 0, 17549, 2915 }, { 0, 17561, 2916 }, { 0, 17564, 2917 },
+    { 0, 17566, 2918 }, { 0, 17567, 2919 }, { 0, 17570, 2920 }, { 0, 17577, 2921 },
+    { 0, 17578, 2922 }, { 0, 17599, 2924 }, { 0, 17633, 2908 }, { 0, 17603, 2925 },
+    { 0, 17573, 2879 }, { 0, 17557, 2927 }, { 0, 17581, 2883 }, { 0, 17632, 2906 },
+    { 0, 17578, 2923 }, { 0, 17565, 2928 }, { 0, 17568, 2929 }, { 0, 17569, 2930 },
+    { 0, 17594, 2931 }, { 0, 17609, 2932 }, { 0, 17619, 2933 }, { 0, 17620, 2934 },
+    { 0, 17614, 2936 }, { 0, 17621, 2937 }, { 0, 17635, 2938 }, { 0, 17638, 2939 },
+    { 0, 17642, 2940 }, { 0, 17643, 2941 }, { 0, 17649, 2942 }, { 0, 17652, 2943 },
+    { 0, 17657, 2944 }, { 0, 17603, 2926 }, { 0, 17620, 2935 }, { 0, 17672, 2945 },
+    { 0, 17673, 2946 }, { 0, 17537, 2950 }, { 19727, 17538, -1 }, { 19726, 17539, -1 },
+    { 0, 17543, 2964 }, { 0, 17544, 2979 }, { 19731, 17551, -1 }, { 19731, 17552, -1 },
+    { 19734, 17556, -1 }, { 19733, 17558, -1 }, { 19732, 17560, -1 }, { 19736, 17574, -1 },
+    { 19736, 17575, -1 }, { 19737, 17576, -1 }, { 19736, 17579, -1 }, { 0, 17586, 3018 },
+    { 0, 17587, 3022 }, { 0, 17589, 3042 }, { 0, 17593, 3045 }, { 19736, 17595, -1 },
+    { 0, 17598, 3049 }, { 0, 17601, 3055 }, { 19741, 17602, -1 }, { 19743, 17611, -1 },
+    { 0, 17612, 3070 }, { 19743, 17615, -1 }, { 19740, 17616, -1 }, { 0, 17617, 3085 },
+    { 19743, 17618, -1 }, { 19743, 17622, -1 }, { 19744, 17623, -1 }, { 0, 17624, 3095 },
+    { 0, 17625, 3096 }, { 19748, 17626, -1 }, { 0, 17627, 3107 }, { 19749, 17628, -1 },
+    { 0, 17629, 3120 }, { 19750, 17637, -1 }, { 0, 17641, 3124 }, { 0, 17644, 3127 },
+    { 0, 17646, 3131 }, { 19750, 17647, -1 }, { 0, 17648, 3141 }, { 19753, 17650, -1 },
+    { 0, 17651, 3162 }, { 0, 17653, 3172 }, { 0, 17654, 3183 }, { 19753, 17655, -1 },
+    { 19754, 17656, -1 }, { 19754, 17658, -1 }, { 0, 17659, 3214 }, { 19756, 17660, -1 },
+    { 0, 17661, 3219 }, { 0, 17662, 3220 }, { 0, 17663, 3222 }, { 19757, 17664, -1 },
+    { 19757, 17665, -1 }, { 0, 17666, 3254 }, { 0, 17667, 3257 }, { 0, 17668, 3258 },
+    { 0, 17669, 3260 }, { 0, 17670, 3274 }, { 0, 17671, 3301 }, { 19757, 17674, -1 },
+    { 19758, 17675, -1 }, { 0, 17676, 3320 }, { 0, 17677, 3322 }, { 19759, 17678, -1 },
+    { 0, 17679, 3331 }, { 19759, 17680, -1 }, { 19760, 17681, -1 }, { 0, 17682, 3350 },
+    { 19761, 17683, -1 }, { 19766, 17684, -1 }, { 0, 17685, 3371 }, { 19766, 17686, -1 },
+    { 0, 17687, 3381 }, { 0, 17688, 3385 }, { 0, 17689, 3395 }, { 0, 17690, 3396 },
+    { 19768, 17691, -1 }, { 0, 17692, 3401 }, { 19766, 17693, -1 }, { 0, 17694, 3411 },
+    { 19767, 17695, -1 }, { 19770, 17696, -1 }, { 0, 17697, 3419 }, { 19770, 17698, -1 },
+    { 0, 17699, 3424 }, { 0, 17700, 3429 }, { 0, 17701, 3430 }, { 0, 17702, 3435 },
+    { 0, 17743, 3436 }, { 0, 17703, 3440 }, { 0, 17704, 3445 }, { 0, 17705, 3449 },
+    { 0, 17706, 3453 }, { 19772, 17707, -1 }, { 19769, 17708, -1 }, { 19770, 17719, -1 },
+    { 0, 17709, 3468 }, { 0, 17710, 3471 }, { 19776, 17711, -1 }, { 19776, 17712, -1 },
+    { 0, 17713, 3483 }, { 0, 17714, 3487 }, { 0, 17715, 3489 }, { 0, 17716, 3494 },
+    { 19776, 17717, -1 }, { 19777, 17718, -1 }, { 0, 17720, 3503 }, { 19779, 17721, -1 },
+    { 19781, 17722, -1 }, { 0, 17723, 3513 }, { 19783, 17724, -1 }, { 19781, 17725, -1 },
+    { 19784, 17726, -1 }, { 19784, 17727, -1 }, { 0, 17728, 3524 }, { 19783, 17729, -1 },
+    { 0, 17730, 3534 }, { 0, 17731, 3538 }, { 0, 17732, 3541 }, { 19784, 17733, -1 },
+    { 19788, 17734, -1 }, { 0, 17735, 3553 }, { 0, 17736, 3556 }, { 0, 17737, 3557 },
+    { 0, 17738, 3558 }, { 0, 17739, 3559 }, { 19789, 17740, -1 }, { 0, 17741, 3565 },
+    { 0, 17742, 3566 }, { 0, 17744, 3584 }, { 0, 17745, 3585 }, { 0, 17746, 3590 },
+    { 0, 17747, 3594 }, { 0, 17748, 3595 }, { 0, 17749, 3597 }, { 19790, 17750, -1 },
+    { 0, 17751, 3606 }, { 0, 17752, 3610 }, { 19790, 17753, -1 }, { 19789, 17754, -1 },
+    { 19792, 17755, -1 }, { 19790, 17756, -1 }, { 0, 17757, 3626 }, { 0, 17758, 3627 },
+    { 0, 17759, 3629 }, { 0, 17760, 3630 }, { 19792, 17761, -1 }, { 0, 17762, 3633 },
+    { 0, 17763, 3634 }, { 19793, 17764, 3635 }, { 19796, 17765, -1 }, { 19794, 17766, -1 },
+    { 0, 17767, 3649 }, { 19795, 17768, -1 }, { 0, 17769, 3651 }, { 19800, 17770, -1 },
+    { 0, 17771, 3656 }, { 0, 17772, 3659 }, { 0, 17773, 3663 }, { 0, 17774, 3679 },
+    { 0, 17775, 3680 }, { 0, 17776, 3683 }, { 19801, 17777, -1 }, { 0, 17778, 3691 },
+    { 0, 17779, 3692 }, { 0, 17780, 3694 }, { 19798, 17781, -1 }, { 19803, 17782, -1 },
+    { 0, 17783, 3706 }, { 19800, 17784, -1 }, { 19801, 17785, -1 }, { 19805, 17786, -1 },
+    { 0, 17787, 3718 }, { 0, 17788, 3746 }, { 0, 17789, 3750 }, { 0, 17790, 3752 },
+    { 19807, 17791, -1 }, { 0, 17792, 3769 }, { 0, 17793, 3777 }, { 0, 17794, 3790 },
+    { 19806, 17795, -1 }, { 0, 17796, 3811 }, { 19809, 17797, -1 }, { 0, 17798, 3814 },
+    { 0, 17799, 3844 }, { 0, 17800, 3846 }, { 0, 17801, 3854 }, { 0, 17802, 3860 },
+    { 0, 17803, 3867 }, { 0, 17804, 3868 }, { 0, 17805, 3869 }, { 19808, 17850, -1 },
+    { 19807, 17806, -1 }, { 19811, 17807, -1 }, { 19812, 17808, -1 }, { 19814, 17809, -1 },
+    { 0, 17810, 3911 }, { 0, 17811, 3912 }, { 0, 17812, 3913 }, { 19815, 17813, -1 },
+    { 19814, 17814, -1 }, { 19815, 17815, -1 }, { 19817, 17816, -1 }, { 19815, 17817, -1 },
+    { 19816, 17818, -1 }, { 19822, 17819, -1 }, { 19822, 17820, -1 }, { 19819, 17821, -1 },
+    { 19824, 17822, -1 }, { 0, 17823, 3966 }, { 19821, 17824, -1 }, { 0, 17825, 3982 },
+    { 0, 17826, 3988 }, { 0, 17827, 3989 }, { 19822, 17828, -1 }, { 0, 17829, 4003 },
+    { 19827, 17830, -1 }, { 0, 17831, 4007 }, { 0, 17832, 4008 }, { 0, 17833, 4030 },
+    { 0, 17834, 4031 }, { 19828, 17835, -1 }, { 19828, 17836, -1 }, { 0, 17837, 4050 },
+    { 19827, 17838, -1 }, { 19831, 17839, -1 }, { 19829, 17840, -1 }, { 0, 17841, 4104 },
+    { 19829, 17842, -1 }, { 19830, 17843, -1 }, { 0, 17844, 4112 }, { 0, 17845, 4114 },
+    { 0, 17846, 4115 }, { 0, 17847, 4116 }, { 0, 17848, 4118 }, { 0, 17849, 4119 },
+    { 0, 17851, 4121 }, { 0, 17852, 4122 }, { 0, 17853, 4124 }, { 0, 17854, 4125 },
+    { 0, 17855, 4127 }, { 0, 17856, 4128 }, { 0, 17857, 4129 }, { 0, 17858, 4130 },
+    { 0, 17859, 4131 }, { 0, 17860, 4132 }, { 0, 17861, 4133 }, { 0, 17849, 4120 },
+    { 0, 17862, 4134 }, { 0, 17863, 4135 }, { 0, 17864, 4136 }, { 0, 17865, 4158 },
+    { 19832, 17866, -1 }, { 0, 17867, 4162 }, { 0, 17868, 4167 }, { 19835, 17869, -1 },
+    { 0, 17870, 4169 }, { 0, 17871, 4172 }, { 19837, 17872, -1 }, { 0, 17873, 4177 },
+    { 19834, 17874, -1 }, { 19839, 17875, -1 }, { 19841, 17876, -1 }, { 19840, 17877, -1 },
+    { 19841, 17878, -1 }, { 19839, 17879, -1 }, { 19844, 17880, -1 }, { 19844, 17881, -1 },
+    { 19846, 17882, -1 }, { 0, 17883, 4241 }, { 19844, 17884, -1 }, { 19848, 17885, -1 },
+    { 19849, 17886, -1 }, { 19846, 17887, -1 }, { 0, 17888, 4286 }, { 0, 17889, 4287 },
+    { 19847, 17890, -1 }, { 0, 17891, 4308 }, { 0, 17892, 4323 }, { 0, 17893, 4325 },
+    { 0, 17894, 4326 }, { 0, 17895, 4342 }, { 19852, 17896, -1 }, { 19853, 17897, -1 },
+    { 0, 17898, 4363 }, { 0, 17899, 4365 }, { 0, 17900, 4366 }, { 19855, 17901, -1 },
+    { 0, 17902, 4378 }, { 19855, 17903, -1 }, { 19853, 17904, -1 }, { 0, 17905, 4397 },
+    { 0, 17906, 4401 }, { 0, 17907, 4403 }, { 0, 17908, 4406 }, { 0, 17909, 4412 },
+    { 0, 17910, 4413 }, { 0, 17911, 4415 }, { 0, 17912, 4416 }, { 19857, 17913, -1 },
+    { 19858, 17914, -1 }, { 19860, 17915, -1 }, { 0, 17916, 4443 }, { 0, 17917, 4444 },
+    { 19856, 17918, -1 }, { 19861, 17919, -1 }, { 19862, 17920, -1 }, { 0, 17921, 4462 },
+    { 0, 17922, 4464 }, { 0, 17923, 4465 }, { 0, 17924, 4481 }, { 0, 17925, 4482 },
+    { 0, 17926, 4483 }, { 0, 17927, 4486 }, { 19859, 17928, -1 }, { 0, 17929, 4494 },
+    { 0, 17930, 4497 }, { 0, 17931, 4498 }, { 0, 17932, 4500 }, { 0, 17933, 4501 },
+    { 0, 17934, 4505 }, { 19861, 17935, -1 }, { 19863, 17936, -1 }, { 0, 17937, 4558 },
+    { 19864, 17938, -1 }, { 19868, 17939, -1 }, { 0, 17940, 4567 }, { 0, 17941, 4568 },
+    { 19864, 17942, -1 }, { 0, 17943, 4571 }, { 0, 17944, 4573 }, { 0, 17945, 4574 },
+    { 19868, 17946, -1 }, { 0, 17947, 4580 }, { 19868, 17948, -1 }, { 19869, 17949, -1 },
+    { 19873, 17950, -1 }, { 19874, 17951, -1 }, { 0, 17952, 4616 }, { 0, 17953, 4617 },
+    { 0, 17954, 4619 }, { 19871, 17955, 4620 }, { 0, 17956, 4629 }, { 0, 17957, 4630 },
+    { 19872, 17958, -1 }, { 0, 17959, 4635 }, { 19877, 17960, -1 }, { 19877, 17961, -1 },
+    { 0, 17962, 4642 }, { 0, 17963, 4643 }, { 0, 17964, 4645 }, { 0, 17965, 4646 },
+    { 0, 17966, 4648 }, { 19875, 17967, 4649 }, { 0, 17968, 4661 }, { 0, 17969, 4662 },
+    { 0, 17970, 4664 }, { 0, 17971, 4678 }, { 0, 17972, 4720 }, { 19879, 17973, -1 },
+    { 0, 17974, 4727 }, { 0, 17975, 4730 }, { 0, 17976, 4731 }, { 19881, 17977, -1 },
+    { 0, 17978, 4735 }, { 0, 17979, 4736 }, { 19879, 17980, -1 }, { 19883, 17981, -1 },
+    { 19880, 17982, -1 }, { 19885, 17983, -1 }, { 19887, 17984, -1 }, { 19884, 17985, -1 },
+    { 19884, 17986, -1 }, { 19885, 17987, -1 }, { 0, 17988, 4772 }, { 19887, 17989, -1 },
+    { 19892, 17990, -1 }, { 0, 17991, 4790 }, { 19893, 17992, -1 }, { 19893, 17993, -1 },
+    { 19895, 17994, -1 }, { 19896, 17995, -1 }, { 0, 17996, 4840 }, { 0, 17997, 4856 },
+    { 19894, 17998, -1 }, { 0, 17999, 4864 }, { 19894, 18000, -1 }, { 19898, 18001, -1 },
+    { 19900, 18002, -1 }, { 0, 18003, 4888 }, { 19901, 18004, -1 }, { 0, 18005, 4910 },
+    { 0, 18035, 4911 }, { 19899, 18006, -1 }, { 19901, 18007, -1 }, { 0, 18008, 4922 },
+    { 19901, 18009, -1 }, { 19905, 18010, -1 }, { 19906, 18011, -1 }, { 0, 18012, 4978 },
+    { 0, 18013, 4990 }, { 19906, 18014, -1 }, { 0, 18015, 5011 }, { 19907, 18016, -1 },
+    { 0, 18017, 5060 }, { 19906, 18018, -1 }, { 0, 18019, 5161 }, { 0, 18020, 5164 },
+    { 0, 18021, 5167 }, { 0, 18022, 5185 }, { 0, 18023, 5189 }, { 19907, 18024, -1 },
+    { 19908, 18025, -1 }, { 0, 18026, 5209 }, { 0, 18027, 5217 }, { 19911, 18028, -1 },
+    { 0, 18029, 5229 }, { 0, 18030, 5236 }, { 0, 18031, 5239 }, { 0, 18032, 5251 },
+    { 0, 18033, 5260 }, { 19914, 18034, -1 }, { 19912, 18036, -1 }, { 19914, 18037, -1 },
+    { 19914, 18038, -1 }, { 0, 18039, 5289 }, { 19917, 18040, -1 }, { 19919, 18041, -1 },
+    { 19921, 18044, -1 }, { 19922, 18042, -1 }, { 19919, 18043, -1 }, { 19922, 18045, -1 },
+    { 19922, 18046, -1 }, { 19921, 18047, -1 }, { 19926, 18048, -1 }, { 19924, 18049, -1 },
+    { 0, 18050, 5314 }, { 19929, 18051, -1 }, { 19925, 18052, -1 }, { 19927, 18053, -1 },
+    { 0, 18054, 5341 }, { 19931, 18055, -1 }, { 0, 18056, 5366 }, { 19932, 18057, -1 },
+    { 0, 18058, 5389 }, { 0, 18059, 5401 }, { 19933, 18060, -1 }, { 19931, 18061, -1 },
+    { 19931, 18062, -1 }, { 19932, 18063, -1 }, { 19935, 18064, -1 }, { 0, 18065, 5459 },
+    { 0, 18066, 5492 }, { 0, 18067, 5494 }, { 19939, 18068, -1 }, { 0, 18069, 5510 },
+    { 0, 18070, 5511 }, { 0, 18071, 5514 }, { 0, 18072, 5524 }, { 0, 18073, 5526 },
+    { 19939, 18074, -1 }, { 0, 18075, 5535 }, { 19938, 18076, -1 }, { 0, 18077, 5539 },
+    { 0, 18078, 5540 }, { 19940, 18079, -1 }, { 19938, 18080, -1 }, { 19942, 18081, -1 },
+    { 0, 18082, 5575 }, { 0, 18083, 5576 }, { 19944, 18084, -1 }, { 19945, 18085, -1 },
+    { 19945, 18086, -1 }, { 19947, 18087, -1 }, { 0, 18088, 5612 }, { 19947, 18089, -1 },
+    { 19946, 18090, -1 }, { 0, 18091, 5643 }, { 19947, 18092, -1 }, { 0, 18093, 5650 },
+    { 19951, 18094, -1 }, { 19952, 18104, -1 }, { 0, 18095, 5665 }, { 19951, 18096, -1 },
+    { 19954, 18097, -1 }, { 19952, 18147, -1 }, { 19956, 18098, -1 }, { 19955, 18099, -1 },
+    { 0, 18100, 5702 }, { 0, 18101, 5708 }, { 0, 18102, 5711 }, { 19955, 18103, -1 },
+    { 19958, 18105, -1 }, { 0, 18106, 5732 }, { 19958, 18107, -1 }, { 0, 18108, 5736 },
+    { 19961, 18109, -1 }, { 19960, 18110, -1 }, { 0, 18111, 5748 }, { 0, 18112, 5750 },
+    { 0, 18113, 5751 }, { 0, 18114, 5752 }, { 0, 18115, 5755 }, { 19961, 18116, -1 },
+    { 19961, 18117, -1 }, { 19965, 18118, -1 }, { 0, 18119, 5850 }, { 19964, 18120, -1 },
+    { 0, 18121, 5879 }, { 0, 18122, 5916 }, { 19967, 18123, -1 }, { 19968, 18124, -1 },
+    { 19969, 18125, -1 }, { 19970, 18126, -1 }, { 0, 18127, 5966 }, { 19969, 18128, -1 },
+    { 0, 18129, 5991 }, { 19972, 18130, -1 }, { 19973, 18131, -1 }, { 19971, 18132, -1 },
+    { 0, 18133, 6074 }, { 0, 18134, 6076 }, { 0, 18135, 6077 }, { 0, 18136, 6080 },
+    { 0, 18137, 6083 }, { 19976, 18138, -1 }, { 0, 18139, 6117 }, { 0, 18140, 6118 },
+    { 19972, 18141, -1 }, { 19976, 18142, -1 }, { 19978, 18143, -1 }, { 0, 18144, 6203 },
+    { 19980, 18145, -1 }, { 0, 18146, 6207 }, { 0, 18148, 6215 }, { 0, 18149, 6216 },
+    { 0, 18150, 6218 }, { 19977, 18151, -1 }, { 19981, 18152, -1 }, { 19982, 18153, -1 },
+    { 0, 18154, 6237 }, { 0, 18155, 6240 }, { 0, 18156, 6244 }, { 0, 18157, 6250 },
+    { 0, 18158, 6257 }, { 19981, 18159, -1 }, { 19982, 18160, -1 }, { 0, 18161, 6261 },
+    { 0, 18162, 6267 }, { 0, 18163, 6273 }, { 19985, 18164, -1 }, { 19982, 18165, -1 },
+    { 0, 18166, 6279 }, { 0, 18167, 6285 }, { 19987, 18168, -1 }, { 0, 18169, 6305 },
+    { 19989, 18170, -1 }, { 19989, 18171, -1 }, { 19989, 18172, -1 }, { 19989, 18189, -1 },
+    { 0, 18173, 6333 }, { 0, 18174, 6334 }, { 0, 18175, 6342 }, { 19991, 18176, -1 },
+    { 0, 18177, 6352 }, { 0, 18178, 6389 }, { 0, 18179, 6392 }, { 19994, 18180, -1 },
+    { 0, 18181, 6404 }, { 0, 18182, 6406 }, { 19993, 18183, -1 }, { 0, 18184, 6412 },
+    { 19993, 18185, -1 }, { 19997, 18186, -1 }, { 0, 18187, 6445 }, { 19998, 18188, -1 },
+    { 0, 18190, 6458 }, { 0, 18191, 6462 }, { 20000, 18192, -1 }, { 19997, 18193, -1 },
+    { 19998, 18194, -1 }, { 0, 18195, 6499 }, { 0, 18196, 6500 }, { 0, 18197, 6505 },
+    { 19999, 18198, -1 }, { 0, 18199, 6516 }, { 0, 18200, 6544 }, { 0, 18201, 6549 },
+    { 20001, 18202, -1 }, { 20003, 18203, -1 }, { 20003, 18204, -1 }, { 0, 18205, 6723 },
+    { 0, 18206, 6771 }, { 0, 18207, 6774 }, { 20004, 18208, -1 }, { 20008, 18209, -1 },
+    { 0, 18210, 6795 }, { 20009, 18211, -1 }, { 20010, 18212, -1 }, { 0, 18213, 6839 },
+    { 0, 18214, 6844 }, { 20009, 18215, -1 }, { 0, 18216, 6860 }, { 0, 18217, 6863 },
+    { 0, 18218, 6865 }, { 0, 18219, 6882 }, { 20010, 18220, -1 }, { 20012, 18221, -1 },
+    { 20014, 18222, -1 }, { 20015, 18223, -1 }, { 20016, 18224, -1 }, { 0, 18225, 6923 },
+    { 0, 18226, 6924 }, { 0, 18227, 6927 }, { 0, 18228, 6928 }, { 0, 18229, 6932 },
+    { 0, 18230, 6936 }, { 0, 18231, 6942 }, { 0, 18232, 6944 }, { 0, 18233, 6952 },
+    { 20013, 18234, -1 }, { 0, 18235, 6968 }, { 20014, 18236, -1 }, { 0, 18237, 6982 },
+    { 0, 18238, 7007 }, { 0, 18239, 7008 }, { 20019, 18240, -1 }, { 20020, 18241, -1 },
+    { 20022, 18242, -1 }, { 0, 18243, 7045 }, { 0, 18244, 7047 }, { 20021, 18245, -1 },
+    { 20020, 18246, -1 }, { 20022, 18247, -1 }, { 0, 18248, 7063 }, { 20022, 18249, -1 },
+    { 0, 18250, 7084 }, { 0, 18251, 7105 }, { 20026, 18252, -1 }, { 0, 18253, 7180 },
+    { 0, 18254, 7182 }, { 0, 18255, 7188 }, { 20025, 18256, -1 }, { 0, 18257, 7203 },
+    { 20028, 18258, -1 }, { 0, 18259, 7275 }, { 20028, 18260, -1 }, { 20029, 18261, -1 },
+    { 0, 18262, 7280 }, { 20030, 18263, -1 }, { 20032, 18264, -1 }, { 20033, 18265, -1 },
+    { 0, 18266, 7350 }, { 0, 18267, 7351 }, { 0, 18268, 7352 }, { 0, 18269, 7353 },
+    { 20032, 18270, -1 }, { 20033, 18271, -1 }, { 0, 18272, 7359 }, { 0, 18273, 7361 },
+    { 20036, 18274, -1 }, { 0, 18275, 7372 }, { 20035, 18276, -1 }, { 20036, 18277, -1 },
+    { 20040, 18278, -1 }, { 20085, 18280, -1 }, { 20124, 18283, -1 }, { 20122, 18284, -1 },
+    { 20129, 18287, -1 }, { 20138, 18288, -1 }, { 20132, 18289, -1 }, { 20091, 18290, -1 },
+    { 20104, 18292, -1 }, { 20116, 18293, -1 }, { 20120, 18294, -1 }, { 20089, 18295, -1 },
+    { 20120, 18301, -1 }, { 20146, 18302, -1 }, { 20150, 18303, -1 }, { 20097, 18304, -1 },
+    { 20151, 18306, -1 }, { 20153, 18311, -1 }, { 20116, 18321, -1 }, { 20159, 18323, -1 },
+    { 20099, 18324, -1 }, { 20139, 18325, -1 }, { 20121, 18326, -1 }, { 20136, 18328, -1 },
+    { 20126, 18329, -1 }, { 20157, 18353, -1 }, { 20126, 18329, -1 }, { 20158, 18330, -1 },
+    { 20167, 18331, -1 }, { 20152, 18332, -1 }, { 20142, 18333, -1 }, { 20151, 18334, -1 },
+    { 20171, 18335, -1 }, { 20127, 18336, -1 }, { 20165, 18337, -1 }, { 20168, 18341, -1 },
+    { 20130, 18342, -1 }, { 20119, 18343, -1 }, { 20122, 18344, -1 }, { 20120, 18347, -1 },
+    { 20166, 18351, -1 }, { 20143, 18352, -1 }, { 20145, 18354, -1 }, { 20131, 18355, -1 },
+    { 20181, 18356, -1 }, { 20175, 18363, -1 }, { 20157, 18394, -1 }, { 20158, 18418, -1 },
+    { 20183, 18407, -1 }, { 20162, 18419, -1 }, { 20128, 18422, -1 }, { 20143, 18423, -1 },
+    { 20184, 18424, -1 }, { 20188, 18453, -1 }, { 20145, 18477, -1 }, { 20146, 18478, -1 },
+    { 20183, 18486, -1 }, { 20152, 18488, -1 }, { 20193, 18489, -1 }, { 20147, 18490, -1 },
+    { 20142, 18491, -1 }, { 20153, 18492, -1 }, { 20201, 18495, -1 }, { 20163, 18496, -1 },
+    { 20169, 18497, -1 }, { 20170, 18498, -1 }, { 20149, 18504, -1 }, { 20194, 18505, -1 },
+    { 20195, 18507, -1 }, { 20189, 18507, -1 }, { 20184, 18509, -1 }, { 20160, 18510, -1 },
+    { 20153, 18511, -1 }, { 20180, 18512, -1 }, { 20199, 18513, -1 }, { 20177, 18515, -1 },
+    { 20202, 18517, -1 }, { 20157, 18518, -1 }, { 20211, 18520, -1 }, { 20199, 18522, -1 },
+    { 20217, 18526, -1 }, { 20177, 18528, -1 }, { 20194, 18529, -1 }, { 20197, 18530, -1 },
+    { 20198, 18531, -1 }, { 20178, 18532, -1 }, { 20198, 18534, -1 }, { 20170, 18536, -1 },
+    { 20221, 18542, -1 }, { 20222, 18545, -1 }, { 20232, 18550, -1 }, { 20209, 18551, -1 },
+    { 20176, 18553, -1 }, { 20211, 18566, -1 }, { 20222, 18583, -1 }, { 20176, 18588, -1 },
+    { 20182, 18595, -1 }, { 20231, 18597, -1 }, { 20207, 18599, -1 }, { 20202, 18600, -1 },
+    { 20197, 18601, -1 }, { 20188, 18603, -1 }, { 20234, 18605, -1 }, { 20231, 18606, -1 },
+    { 20184, 18605, -1 }, { 20225, 18608, -1 }, { 20193, 18611, -1 }, { 20203, 18618, -1 },
+    { 20224, 18619, -1 }, { 20247, 18632, -1 }, { 20247, 18634, -1 }, { 20242, 18636, -1 },
+    { 20232, 18637, -1 }, { 20226, 18638, -1 }, { 20252, 18643, -1 }, { 20251, 18647, -1 },
+    { 20252, 18648, -1 }, { 20202, 18649, -1 }, { 20251, 18650, -1 }, { 20236, 18651, -1 },
+    { 20244, 18652, -1 }, { 20242, 18654, -1 }, { 20258, 18655, -1 }, { 20221, 18656, -1 },
+    { 20230, 18662, -1 }, { 20220, 18663, -1 }, { 20207, 18664, -1 }, { 20261, 18665, -1 },
+    { 20241, 18666, -1 }, { 20242, 18667, -1 }, { 20257, 18668, -1 }, { 20238, 18670, -1 },
+    { 20229, 18671, -1 }, { 20246, 18675, -1 }, { 20228, 18676, -1 }, { 20241, 18678, -1 },
+    { 20242, 18679, -1 }, { 20218, 18682, -1 }, { 20271, 18683, -1 }, { 20279, 18685, -1 },
+    { 20224, 18686, -1 }, { 20228, 18687, -1 }, { 20284, 18689, -1 }, { 20234, 18692, -1 },
+    { 20235, 18699, -1 }, { 20272, 18700, -1 }, { 20262, 18701, -1 }, { 20241, 18704, -1 },
+    { 20269, 18707, -1 }, { 20285, 18710, -1 }, { 20284, 18712, -1 }, { 20236, 18716, -1 },
+    { 20261, 18719, -1 }, { 20280, 18720, -1 }, { 20285, 18721, -1 }, { 20277, 18722, -1 },
+    { 20293, 18724, -1 }, { 20294, 18725, -1 }, { 20295, 18727, -1 }, { 20253, 18731, -1 },
+    { 20280, 18733, -1 }, { 20281, 18734, -1 }, { 20247, 18735, -1 }, { 20244, 18738, -1 },
+    { 20273, 18740, -1 }, { 20246, 18742, -1 }, { 20292, 18745, -1 }, { 20276, 18747, -1 },
+    { 20292, 18747, -1 }, { 20293, 18748, -1 }, { 20302, 18749, -1 }, { 20256, 18751, -1 },
+    { 20276, 18753, -1 }, { 20259, 18754, -1 }, { 20295, 18760, -1 }, { 20303, 18764, -1 },
+    { 20261, 18770, -1 }, { 20311, 18775, -1 }, { 20316, 18779, -1 }, { 20258, 18780, -1 },
+    { 20286, 18783, -1 }, { 20317, 18784, -1 }, { 20312, 18785, -1 }, { 20318, 18786, -1 },
+    { 20293, 18787, -1 }, { 20309, 18788, -1 }, { 20300, 18791, -1 }, { 20300, 18792, -1 },
+    { 20282, 18793, -1 }, { 20275, 18797, -1 }, { 20306, 18799, -1 }, { 20277, 18801, -1 },
+    { 20329, 18802, -1 }, { 20312, 18803, -1 }, { 20281, 18805, -1 }, { 20330, 18809, -1 },
+    { 20290, 18810, -1 }, { 20310, 18811, -1 }, { 20333, 18813, -1 }, { 20305, 18822, -1 },
+    { 20294, 18823, -1 }, { 20335, 18825, -1 }, { 20336, 18826, -1 }, { 20317, 18828, -1 },
+    { 20338, 18830, -1 }, { 20331, 18831, -1 }, { 20289, 18833, -1 }, { 20291, 18834, -1 },
+    { 20314, 18837, -1 }, { 20325, 18838, -1 }, { 20310, 18839, -1 }, { 20335, 18841, -1 },
+    { 20334, 18842, -1 }, { 20297, 18846, -1 }, { 20342, 18847, -1 }, { 20324, 18849, -1 },
+    { 20322, 18857, -1 }, { 20303, 18858, -1 }, { 20353, 18860, -1 }, { 20354, 18864, -1 },
+    { 20335, 18873, -1 }, { 20305, 18874, -1 }, { 20303, 18879, -1 }, { 20314, 18885, -1 },
+    { 20333, 18892, -1 }, { 20309, 18893, -1 }, { 20310, 18900, -1 }, { 20308, 18901, -1 },
+    { 20324, 18901, -1 }, { 20331, 18902, -1 }, { 20312, 18903, -1 }, { 20350, 18905, -1 },
+    { 20339, 18908, -1 }, { 20320, 18909, -1 }, { 20375, 18912, -1 }, { 20361, 18913, -1 },
+    { 20366, 18915, -1 }, { 20319, 18917, -1 }, { 20373, 18918, -1 }, { 20366, 18923, -1 },
+    { 20366, 18924, -1 }, { 20375, 18927, -1 }, { 20325, 18928, -1 }, { 20339, 18929, -1 },
+    { 20359, 18930, -1 }, { 20347, 18932, -1 }, { 20357, 19046, -1 }, { 20366, 19047, -1 },
+    { 20384, 19050, -1 }, { 20337, 19051, -1 }, { 20336, 19052, -1 }, { 20345, 19053, -1 },
+    { 20386, 19054, -1 }, { 20393, 19055, -1 }, { 20340, 19056, -1 }, { 20352, 19057, -1 },
+    { 20385, 19058, -1 }, { 20370, 19063, -1 }, { 20340, 19066, -1 }, { 20343, 19067, -1 },
+    { 20374, 19069, -1 }, { 20342, 19070, -1 }, { 20377, 19072, -1 }, { 20380, 19073, -1 },
+    { 20381, 19074, -1 }, { 20350, 19077, -1 }, { 20400, 19079, -1 }, { 20404, 19081, -1 },
+    { 20381, 19085, -1 }, { 20352, 19087, -1 }, { 20397, 19091, -1 }, { 20408, 19092, -1 },
+    { 20386, 19093, -1 }, { 20380, 19095, -1 }, { 20368, 19099, -1 }, { 20372, 19100, -1 },
+    { 20393, 19107, -1 }, { 20377, 19108, -1 }, { 20404, 19111, -1 }, { 20418, 19113, -1 },
+    { 20419, 19114, -1 }, { 20410, 19116, -1 }, { 20368, 19117, -1 }, { 20419, 19119, -1 },
+    { 20367, 19124, -1 }, { 20394, 19126, -1 }, { 20367, 19128, -1 }, { 20410, 19129, -1 },
+    { 20376, 19131, -1 }, { 20417, 19141, -1 }, { 20371, 19142, -1 }, { 20372, 19143, -1 },
+    { 20371, 19146, -1 }, { 20430, 19147, -1 }, { 20409, 19152, -1 }, { 20410, 19153, -1 },
+    { 20379, 19155, -1 }, { 20416, 19147, -1 }, { 20411, 19156, -1 }, { 20378, 19158, -1 },
+    { 20415, 19159, -1 }, { 20435, 19160, -1 }, { 20423, 19161, -1 }, { 20412, 19163, -1 },
+    { 20443, 19167, -1 }, { 20440, 19168, -1 }, { 20403, 19174, -1 }, { 20387, 19183, -1 },
+    { 20429, 19186, -1 }, { 20418, 19187, -1 }, { 20429, 19188, -1 }, { 20428, 19189, -1 },
+    { 20415, 19194, -1 }, { 20422, 19197, -1 }, { 20447, 19198, -1 }, { 20419, 19199, -1 },
+    { 20397, 19201, -1 }, { 20445, 19203, -1 }, { 20456, 19210, -1 }, { 20460, 19214, -1 },
+    { 20400, 19215, -1 }, { 20432, 19217, -1 }, { 20433, 19218, -1 }, { 20417, 19219, -1 },
+    { 20430, 19224, -1 }, { 20441, 19228, -1 }, { 20460, 19230, -1 }, { 20409, 19239, -1 },
+    { 20410, 19240, -1 }, { 20450, 19241, -1 }, { 20448, 19242, -1 }, { 20440, 19243, -1 },
+    { 20456, 19247, -1 }, { 20455, 19248, -1 }, { 20456, 19249, -1 }, { 20455, 19250, -1 },
+    { 20422, 19251, -1 }, { 20460, 19252, -1 }, { 20419, 19253, -1 }, { 20444, 19254, -1 },
+    { 20475, 19255, -1 }, { 20420, 19256, -1 }, { 20466, 19258, -1 }, { 20478, 19262, -1 },
+    { 20479, 19264, -1 }, { 20447, 19269, -1 }, { 20434, 19270, -1 }, { 20489, 19272, -1 },
+    { 20432, 19273, -1 }, { 20478, 19274, -1 }, { 20465, 19276, -1 }, { 20466, 19277, -1 },
+    { 20494, 19300, -1 }, { 20436, 19303, -1 }, { 20460, 19306, -1 }, { 20468, 19308, -1 },
+    { 20447, 19309, -1 }, { 20438, 19310, -1 }, { 20452, 19311, -1 }, { 20479, 19312, -1 },
+    { 20479, 19313, -1 }, { 20455, 19314, -1 }, { 20504, 19315, -1 }, { 20444, 19316, -1 },
+    { 20495, 19318, -1 }, { 20492, 19319, -1 }, { 20460, 19320, -1 }, { 20502, 19321, -1 },
+    { 20483, 19324, -1 }, { 20496, 19330, -1 }, { 20497, 19331, -1 }, { 20454, 19335, -1 },
+    { 20500, 19337, -1 }, { 20468, 19338, -1 }, { 20476, 19347, -1 }, { 20455, 19348, -1 },
+    { 20460, 19349, -1 }, { 20481, 19352, -1 }, { 20505, 19353, -1 }, { 20506, 19354, -1 },
+    { 20515, 19362, -1 }, { 20510, 19369, -1 }, { 20498, 19370, -1 }, { 20467, 19372, -1 },
+    { 20470, 19373, -1 }, { 20506, 19376, -1 }, { 20473, 19380, -1 }, { 20490, 19382, -1 },
+    { 20491, 19383, -1 }, { 20474, 19384, -1 }, { 20476, 19385, -1 }, { 20500, 19389, -1 },
+    { 20487, 19392, -1 }, { 20474, 19394, -1 }, { 20529, 19395, -1 }, { 20504, 19401, -1 },
+    { 20523, 19407, -1 }, { 20481, 19411, -1 }, { 20526, 19414, -1 }, { 20485, 19415, -1 },
+    { 20532, 19415, -1 }, { 20506, 19416, -1 }, { 20482, 19417, -1 }, { 20487, 19418, -1 },
+    { 20538, 19419, -1 }, { 20520, 19420, -1 }, { 20521, 19421, -1 }, { 20549, 19423, -1 },
+    { 20492, 19424, -1 }, { 20544, 19424, -1 }, { 20548, 19426, -1 }, { 20497, 19427, -1 },
+    { 20546, 19428, -1 }, { 20498, 19429, -1 }, { 20551, 19432, -1 }, { 20528, 19434, -1 },
+    { 20504, 19435, -1 }, { 20544, 19436, -1 }, { 20499, 19438, -1 }, { 20553, 19441, -1 },
+    { 20503, 19442, -1 }, { 20509, 19444, -1 }, { 20549, 19445, -1 }, { 20550, 19446, -1 },
+    { 20510, 19449, -1 }, { 20556, 19451, -1 }, { 20556, 19453, -1 }, { 20529, 19459, -1 },
+    { 20566, 19460, -1 }, { 20517, 19463, -1 }, { 20516, 19469, -1 }, { 20511, 19470, -1 },
+    { 20570, 19471, -1 }, { 20571, 19472, -1 }, { 20563, 19474, -1 }, { 20519, 19475, -1 },
+    { 20573, 19475, -1 }, { 20521, 19476, -1 }, { 20522, 19477, -1 }, { 20533, 19478, -1 },
+    { 20554, 19479, -1 }, { 20563, 19480, -1 }, { 20563, 19481, -1 }, { 20529, 19482, -1 },
+    { 20523, 19483, -1 }, { 20531, 19485, -1 }, { 20588, 19486, -1 }, { 20584, 19487, -1 },
+    { 20566, 19489, -1 }, { 20576, 19491, -1 }, { 20578, 19494, -1 }, { 20591, 19495, -1 },
+    { 20569, 19496, -1 }, { 20570, 19497, -1 }, { 20545, 19498, -1 }, { 20541, 19502, -1 },
+    { 20583, 19508, -1 }, { 20568, 19510, -1 }, { 20594, 19513, -1 }, { 20575, 19514, -1 },
+    { 20574, 19515, -1 }, { 20600, 19518, -1 }, { 20589, 19519, -1 }, { 20584, 19520, -1 },
+    { 20569, 19521, -1 }, { 20558, 19523, -1 }, { 20579, 19524, -1 }, { 20577, 19526, -1 },
+    { 20596, 19528, -1 }, { 20589, 19529, -1 }, { 20602, 19531, -1 }, { 20565, 19532, -1 },
+    { 20582, 19533, -1 }, { 20610, 19534, -1 }, { 20606, 19535, -1 }, { 20579, 19539, -1 },
+    { 20591, 19540, -1 }, { 20609, 19542, -1 }, { 20585, 19544, -1 }, { 20589, 19545, -1 },
+    { 20564, 19551, -1 }, { 20577, 19552, -1 }, { 20565, 19553, -1 }, { 20607, 19555, -1 },
+    { 20592, 19558, -1 }, { 20607, 19559, -1 }, { 20623, 19560, -1 }, { 20624, 19561, -1 },
+    { 20579, 19563, -1 }, { 20617, 19565, -1 }, { 20578, 19566, -1 }, { 20580, 19567, -1 },
+    { 20579, 19573, -1 }, { 20629, 19576, -1 }, { 20608, 19577, -1 }, { 20576, 19578, -1 },
+    { 20580, 19580, -1 }, { 20633, 19585, -1 }, { 20614, 19586, -1 }, { 20582, 19587, -1 },
+    { 20632, 19593, -1 }, { 20633, 19594, -1 }, { 20588, 19598, -1 }, { 20645, 19599, -1 },
+    { 20646, 19602, -1 }, { 20591, 19604, -1 }, { 20592, 19604, -1 }, { 20606, 19605, -1 },
+    { 20592, 19606, -1 }, { 20635, 19607, -1 }, { 20607, 19611, -1 }, { 20645, 19615, -1 },
+    { 20614, 19618, -1 }, { 20593, 19620, -1 }, { 20641, 19621, -1 }, { 20631, 19623, -1 },
+    { 20638, 19623, -1 }, { 20645, 19626, -1 }, { 20654, 19627, -1 }, { 20661, 19628, -1 },
+    { 20656, 19632, -1 }, { 20625, 19636, -1 }, { 20606, 19637, -1 }, { 20658, 19638, -1 },
+    { 20660, 19642, -1 }, { 20653, 19643, -1 }, { 20665, 19645, -1 }, { 20666, 19646, -1 },
+    { 20608, 19649, -1 }, { 20664, 19654, -1 }, { 20641, 19655, -1 }, { 20667, 19656, -1 },
+    { 20660, 19657, -1 }, { 20661, 19658, -1 }, { 20670, 19668, -1 }, { 20660, 19670, -1 },
+    { 20665, 19674, -1 }, { 20651, 19675, -1 }, { 20623, 19676, -1 }, { 20628, 19679, -1 },
+    { 20670, 19680, -1 }, { 20634, 19681, -1 }, { 20674, 19683, -1 }, { 20680, 19686, -1 },
+    { 20636, 19690, -1 }, { 20633, 19692, -1 }, { 20667, 19694, -1 }, { 20668, 19695, -1 },
+    { 20679, 19697, -1 }, { 20634, 19698, -1 }, { 20685, 19699, -1 }, { 20670, 19704, -1 },
+    { 20643, 19705, -1 }, { 20681, 19708, -1 }, { 20688, 19710, -1 }, { 20659, 19711, -1 },
+    { 20639, 19712, -1 }, { 20683, 19713, -1 }, { 20662, 19714, -1 }, { 20667, 19715, -1 },
+    { 20686, 19716, -1 }, { 20704, 19717, -1 }, { 20650, 19718, -1 }, { 20706, 19719, -1 },
+    { 20657, 19720, -1 }, { 20668, 19721, -1 }, { 20655, 19722, -1 }, { 20679, 19723, -1 },
+    { 20688, 19724, -1 }, { 20712, 19725, -1 }, { 20705, 19726, -1 }, { 20708, 19727, -1 },
+    { 20705, 19728, -1 }, { 20660, 19729, -1 }, { 20716, 19730, -1 }, { 20678, 19731, -1 },
+    { 20702, 19732, -1 }, { 20697, 19733, -1 }, { 20669, 19734, -1 }, { 20690, 19735, -1 },
+    { 20698, 19736, -1 }, { 20700, 19738, -1 }, { 20714, 19737, -1 }, { 20715, 19739, -1 },
+    { 20680, 19740, -1 }, { 20677, 19741, -1 }, { 20671, 19742, -1 }, { 20681, 19743, -1 },
+    { 20684, 19744, -1 }, { 20685, 19745, -1 }, { 20722, 19746, -1 }, { 20701, 19747, -1 },
+    { 20706, 19748, -1 }, { 20673, 19749, -1 }, { 20720, 19750, -1 }, { 20731, 19751, -1 },
+    { 20727, 19752, -1 }, { 20727, 19753, -1 }, { 20735, 19754, -1 }, { 20700, 19755, -1 },
+    { 20727, 19756, -1 }, { 20721, 19757, -1 }, { 20718, 19758, -1 }, { 20719, 19759, -1 },
+    { 20737, 19760, -1 }, { 20743, 19761, -1 }, { 20695, 19762, -1 }, { 20731, 19763, -1 },
+    { 20690, 19764, -1 }, { 20742, 19765, -1 }, { 20746, 19766, -1 }, { 20747, 19767, -1 },
+    { 20709, 19768, -1 }, { 20695, 19769, -1 }, { 20747, 19770, -1 }, { 20722, 19771, -1 },
+    { 20734, 19772, -1 }, { 20745, 19773, -1 }, { 20721, 19774, -1 }, { 20739, 19753, -1 },
+    { 20702, 19775, -1 }, { 20742, 19776, -1 }, { 20743, 19777, -1 }, { 20745, 19778, -1 },
+    { 20761, 19779, -1 }, { 20762, 19780, -1 }, { 20744, 19781, -1 }, { 20743, 19782, -1 },
+    { 20724, 19783, -1 }, { 20710, 19784, -1 }, { 20772, 19785, -1 }, { 20734, 19786, -1 },
+    { 20758, 19787, -1 }, { 20759, 19788, -1 }, { 20717, 19789, -1 }, { 20765, 19790, -1 },
+    { 20754, 19791, -1 }, { 20717, 19792, -1 }, { 20724, 19793, -1 }, { 20782, 19794, -1 },
+    { 20741, 19795, -1 }, { 20757, 19796, -1 }, { 20765, 19797, -1 }, { 20745, 19798, -1 },
+    { 20781, 19799, -1 }, { 20772, 19800, -1 }, { 20736, 19801, -1 }, { 20773, 19799, -1 },
+    { 20773, 19802, -1 }, { 20739, 19803, -1 }, { 20765, 19804, -1 }, { 20780, 19805, -1 },
+    { 20736, 19806, -1 }, { 20735, 19807, -1 }, { 20741, 19808, -1 }, { 20744, 19809, -1 },
+    { 20759, 19810, -1 }, { 20782, 19811, -1 }, { 20797, 19812, -1 }, { 20755, 19813, -1 },
+    { 20779, 19814, -1 }, { 20760, 19816, -1 }, { 20788, 19815, -1 }, { 20783, 19817, -1 },
+    { 20760, 19818, -1 }, { 20780, 19819, -1 }, { 20805, 19820, -1 }, { 20747, 19821, -1 },
+    { 20767, 19822, -1 }, { 20775, 19823, -1 }, { 20790, 19824, -1 }, { 20777, 19825, -1 },
+    { 20800, 19826, -1 }, { 20784, 19827, -1 }, { 20785, 19828, -1 }, { 20807, 19829, -1 },
+    { 20767, 19830, -1 }, { 20759, 19831, -1 }, { 20782, 19832, -1 }, { 20759, 19833, -1 },
+    { 20791, 19834, -1 }, { 20774, 19835, -1 }, { 20784, 19836, -1 }, { 20781, 19837, -1 },
+    { 20808, 19838, -1 }, { 20774, 19839, -1 }, { 20767, 19840, -1 }, { 20803, 19841, -1 },
+    { 20782, 19842, -1 }, { 20825, 19843, -1 }, { 20817, 19844, -1 }, { 20800, 19845, -1 },
+    { 20774, 19846, -1 }, { 20814, 19847, -1 }, { 20815, 19848, -1 }, { 20819, 19849, -1 },
+    { 20821, 19850, -1 }, { 20802, 19851, -1 }, { 20830, 19852, -1 }, { 20802, 19853, -1 },
+    { 20842, 19854, -1 }, { 20785, 19855, -1 }, { 20786, 19856, -1 }, { 20829, 19857, -1 },
+    { 20801, 19858, -1 }, { 20828, 19859, -1 }, { 20837, 19860, -1 }, { 20839, 19861, -1 },
+    { 20839, 19862, -1 }, { 20802, 19863, -1 }, { 20813, 19864, -1 }, { 20837, 19865, -1 },
+    { 20840, 19866, -1 }, { 20802, 19867, -1 }, { 20820, 19868, -1 }, { 20821, 19869, -1 },
+    { 20820, 19870, -1 }, { 20840, 19871, -1 }, { 20838, 19872, -1 }, { 20839, 19873, -1 },
+    { 20813, 19874, -1 }, { 20848, 19875, -1 }, { 20825, 19876, -1 }, { 20850, 19877, -1 },
+    { 20853, 19878, -1 }, { 20828, 19879, -1 }, { 20838, 19880, -1 }, { 20827, 19881, -1 },
+    { 20845, 19882, -1 }, { 20822, 19883, -1 }, { 20871, 19884, -1 }, { 20867, 19885, -1 },
+    { 20827, 19886, -1 }, { 20870, 19887, -1 }, { 20827, 19888, -1 }, { 20830, 19889, -1 },
+    { 20871, 19890, -1 }, { 20850, 19891, -1 }, { 20825, 19892, -1 }, { 20832, 19893, -1 },
+    { 20880, 19894, -1 }, { 20847, 19895, -1 }, { 20845, 19896, -1 }, { 20855, 19897, -1 },
+    { 20847, 19898, -1 }, { 20855, 19899, -1 }, { 20881, 19900, -1 }, { 20838, 19901, -1 },
+    { 20887, 19902, -1 }, { 20875, 19903, -1 }, { 20847, 19904, -1 }, { 20842, 19905, -1 },
+    { 20848, 19906, -1 }, { 20889, 19907, -1 }, { 20877, 19908, -1 }, { 20836, 19909, -1 },
+    { 20882, 19910, -1 }, { 20884, 19911, -1 }, { 20881, 19912, -1 }, { 20889, 19913, -1 },
+    { 20890, 19914, -1 }, { 20895, 19915, -1 }, { 20851, 19916, -1 }, { 20896, 19917, -1 },
+    { 20901, 19918, -1 }, { 20888, 19919, -1 }, { 20896, 19920, -1 }, { 20864, 19921, -1 },
+    { 20910, 19922, -1 }, { 20881, 19923, -1 }, { 20912, 19924, -1 }, { 20876, 19925, -1 },
+    { 20909, 19926, -1 }, { 20904, 19927, -1 }, { 20876, 19928, -1 }, { 20907, 19929, -1 },
+    { 20919, 19930, -1 }, { 20920, 19931, -1 }, { 20911, 19932, -1 }, { 20884, 19933, -1 },
+    { 20904, 19934, -1 }, { 20865, 19935, -1 }, { 20913, 19936, -1 }, { 20915, 19937, -1 },
+    { 20915, 19938, -1 }, { 20909, 19939, -1 }, { 20875, 19940, -1 }, { 20897, 19941, -1 },
+    { 20916, 19942, -1 }, { 20925, 19943, -1 }, { 20902, 19944, -1 }, { 20934, 19945, -1 },
+    { 20916, 19946, -1 }, { 20905, 19947, -1 }, { 20885, 19948, -1 }, { 20906, 19949, -1 },
+    { 20925, 19950, -1 }, { 20898, 19951, -1 }, { 20931, 19952, -1 }, { 20888, 19953, -1 },
+    { 20936, 19954, -1 }, { 20914, 19955, -1 }, { 20905, 19956, -1 }, { 20946, 19957, -1 },
+    { 20902, 19958, -1 }, { 20898, 19959, -1 }, { 20917, 19960, -1 }, { 20938, 19961, -1 },
+    { 20940, 19962, -1 }, { 20932, 19963, -1 }, { 20940, 19964, -1 }, { 20910, 19965, -1 },
+    { 20899, 19966, -1 }, { 20921, 19967, -1 }, { 20924, 19968, -1 }, { 20924, 19969, -1 },
+    { 20927, 19970, -1 }, { 20910, 19971, -1 }, { 20913, 19972, -1 }, { 20899, 19973, -1 },
+    { 20940, 19974, -1 }, { 20921, 19975, -1 }, { 20922, 19976, -1 }, { 20914, 19977, -1 },
+    { 20950, 19978, -1 }, { 20931, 19979, -1 }, { 20906, 19980, -1 }, { 20960, 19981, -1 },
+    { 20954, 19982, -1 }, { 20924, 19983, -1 }, { 20921, 19984, -1 }, { 20926, 19985, -1 },
+    { 20955, 19986, -1 }, { 20917, 19987, -1 }, { 20916, 19988, -1 }, { 20941, 19989, -1 },
+    { 20973, 19990, -1 }, { 20974, 19991, -1 }, { 20969, 19992, -1 }, { 20949, 19993, -1 },
+    { 20966, 19994, -1 }, { 20957, 19995, -1 }, { 20978, 19996, -1 }, { 20940, 19997, -1 },
+    { 20961, 19998, -1 }, { 20987, 19999, -1 }, { 20977, 20000, -1 }, { 20931, 20001, -1 },
+    { 20928, 20002, -1 }, { 20929, 20003, -1 }, { 20947, 20004, -1 }, { 20941, 20005, -1 },
+    { 20958, 20009, -1 }, { 20944, 20006, -1 }, { 20945, 20007, -1 }, { 20977, 20008, -1 },
+    { 20963, 20010, -1 }, { 20967, 20011, -1 }, { 20979, 20012, -1 }, { 20948, 20013, -1 },
+    { 20986, 20014, -1 }, { 20964, 20015, -1 }, { 20999, 20016, -1 }, { 20974, 20017, -1 },
+    { 20969, 20018, -1 }, { 21007, 20019, -1 }, { 20961, 20020, -1 }, { 20970, 20021, -1 },
+    { 20979, 20022, -1 }, { 21012, 20023, -1 }, { 20995, 20024, -1 }, { 20974, 20025, -1 },
+    { 21001, 20026, -1 }, { 21001, 20027, -1 }, { 20954, 20028, -1 }, { 21012, 20029, -1 },
+    { 20956, 20030, -1 }, { 21001, 20031, -1 }, { 21020, 20032, -1 }, { 20971, 20033, -1 },
+    { 20972, 20034, -1 }, { 21004, 20035, -1 }, { 20986, 20036, -1 }, { 21019, 20037, -1 },
+    { 20986, 20038, -1 }, { 20988, 20039, -1 }, { 21015, 20040, -1 }, { 21003, 20041, -1 },
+    { 21016, 20042, -1 }, { 20989, 20043, -1 }, { 20997, 20044, -1 }, { 21003, 20045, -1 },
+    { 21004, 20046, -1 }, { 21013, 20047, -1 }, { 21002, 20048, -1 }, { 21024, 20049, -1 },
+    { 21012, 20050, -1 }, { 21032, 20051, -1 }, { 21029, 20052, -1 }, { 21018, 20053, -1 },
+    { 21012, 20054, -1 }, { 21027, 20055, -1 }, { 21045, 20056, -1 }, { 21022, 20057, -1 },
+    { 21035, 20058, -1 }, { 21036, 20059, -1 }, { 21029, 20060, -1 }, { 21017, 20061, -1 },
+    { 20996, 20062, -1 }, { 20997, 20063, -1 }, { 21032, 20064, -1 }, { 21035, 20065, -1 },
+    { 21051, 20066, -1 }, { 21022, 20067, -1 }, { 21032, 20068, -1 }, { 21033, 20069, -1 },
+    { 21007, 20070, -1 }, { 21003, 20071, -1 }, { 21011, 20072, -1 }, { 21004, 20073, -1 },
+    { 21063, 20074, -1 }, { 21046, 20075, -1 }, { 21008, 20076, -1 }, { 21049, 20077, -1 },
+    { 21006, 20078, -1 }, { 21056, 20079, -1 }, { 21014, 20080, -1 }, { 21053, 20081, -1 },
+    { 21054, 20082, -1 }, { 21065, 20083, -1 }, { 21067, 20084, -1 }, { 21029, 20085, -1 },
+    { 21074, 20086, -1 }, { 21072, 20087, -1 }, { 21057, 20088, -1 }, { 21058, 20089, -1 },
+    { 21062, 20090, -1 }, { 21063, 20091, -1 }, { 21069, 20092, -1 }, { 21035, 20093, -1 },
+    { 21037, 20094, -1 }, { 21050, 20095, -1 }, { 21068, 20096, -1 }, { 21023, 20097, -1 },
+    { 21087, 20098, -1 }, { 21077, 20099, -1 }, { 21078, 20100, -1 }, { 21082, 20101, -1 },
+    { 21077, 20102, -1 }, { 21052, 20103, -1 }, { 21041, 20104, -1 }, { 21075, 20105, -1 },
+    { 21037, 20106, -1 }, { 21056, 20107, -1 }, { 21080, 20108, -1 }, { 21077, 20109, -1 },
+    { 21088, 20110, -1 }, { 21086, 20111, -1 }, { 21069, 20112, -1 }, { 21065, 20113, -1 },
+    { 21048, 20114, -1 }, { 21083, 20115, -1 }, { 21092, 20116, -1 }, { 21051, 20117, -1 },
+    { 21052, 20118, -1 }, { 21057, 20119, -1 }, { 21063, 20120, -1 }, { 21110, 20121, -1 },
+    { 21048, 20122, -1 }, { 21056, 20123, -1 }, { 21113, 20124, -1 }, { 21064, 20125, -1 },
+    { 21052, 20126, -1 }, { 21082, 20127, -1 }, { 21115, 20128, -1 }, { 21101, 20129, -1 },
+    { 21070, 20130, -1 }, { 21107, 20131, -1 }, { 21070, 20132, -1 }, { 21071, 20133, -1 },
+    { 21106, 20134, -1 }, { 21107, 20135, -1 }, { 21069, 20136, -1 }, { 21071, 20137, -1 },
+    { 21124, 20138, -1 }, { 21128, 20139, -1 }, { 21114, 20140, -1 }, { 21128, 20141, -1 },
+    { 21073, 20142, -1 }, { 21122, 20143, -1 }, { 21070, 20144, -1 }, { 21096, 20145, -1 },
+    { 21086, 20146, -1 }, { 21078, 20147, -1 }, { 21093, 20148, -1 }, { 21081, 20149, -1 },
+    { 21082, 20150, -1 }, { 21140, 20151, -1 }, { 21099, 20152, -1 }, { 21112, 20153, -1 },
+    { 21081, 20154, -1 }, { 21140, 20155, -1 }, { 21118, 20156, -1 }, { 21099, 20157, -1 },
+    { 21139, 20158, -1 }, { 21086, 20159, -1 }, { 21098, 20160, -1 }, { 21127, 20161, -1 },
+    { 21093, 20162, -1 }, { 21121, 20163, -1 }, { 21118, 20164, -1 }, { 21119, 20165, -1 },
+    { 21097, 20166, -1 }, { 21140, 20167, -1 }, { 21141, 20168, -1 }, { 21122, 20169, -1 },
+    { 21077, 20148, -1 }, { 21158, 20170, -1 }, { 21121, 20171, -1 }, { 21100, 20172, -1 },
+    { 21100, 20173, -1 }, { 21154, 20174, -1 }, { 21142, 20175, -1 }, { 21144, 20176, -1 },
+    { 21110, 20177, -1 }, { 21125, 20178, -1 }, { 21157, 20179, -1 }, { 21120, 20180, -1 },
+    { 21153, 20181, -1 }, { 21170, 20182, -1 }, { 21124, 20183, -1 }, { 21113, 20184, -1 },
+    { 21143, 20185, -1 }, { 21174, 20186, -1 }, { 21159, 20187, -1 }, { 21126, 20188, -1 },
+    { 21177, 20189, -1 }, { 21124, 20190, -1 }, { 21135, 20191, -1 }, { 21167, 20192, -1 },
+    { 21154, 20193, -1 }, { 21163, 20194, -1 }, { 21139, 20195, -1 }, { 21138, 20196, -1 },
+    { 21181, 20197, -1 }, { 21160, 20198, -1 }, { 21161, 20199, -1 }, { 21143, 20200, -1 },
+    { 21156, 20201, -1 }, { 21142, 20202, -1 }, { 21142, 20203, -1 }, { 21177, 20204, -1 },
+    { 21183, 20205, -1 }, { 21134, 20206, -1 }, { 21186, 20207, -1 }, { 21191, 20208, -1 },
+    { 21148, 20209, -1 }, { 21173, 20210, -1 }, { 21199, 20211, -1 }, { 21170, 20212, -1 },
+    { 21171, 20213, -1 }, { 21148, 20214, -1 }, { 21171, 20215, -1 }, { 21152, 20216, -1 },
+    { 21191, 20217, -1 }, { 21157, 20218, -1 }, { 21175, 20219, -1 }, { 21202, 20220, -1 },
+    { 21162, 20221, -1 }, { 21179, 20222, -1 }, { 21163, 20223, -1 }, { 21191, 20224, -1 },
+    { 21185, 20225, -1 }, { 21208, 20226, -1 }, { 21156, 20227, -1 }, { 21206, 20228, -1 },
+    { 21202, 20229, -1 }, { 21208, 20230, -1 }, { 21202, 20231, -1 }, { 21210, 20232, -1 },
+    { 21205, 20233, -1 }, { 21189, 20234, -1 }, { 21212, 20235, -1 }, { 21174, 20236, -1 },
+    { 21210, 20237, -1 }, { 21165, 20238, -1 }, { 21166, 20239, -1 }, { 21171, 20240, -1 },
+    { 21189, 20241, -1 }, { 21221, 20242, -1 }, { 21201, 20243, -1 }, { 21217, 20244, -1 },
+    { 21188, 20245, -1 }, { 21224, 20246, -1 }, { 21206, 20247, -1 }, { 21232, 20248, -1 },
+    { 21203, 20249, -1 }, { 21223, 20250, -1 }, { 21229, 20251, -1 }, { 21209, 20252, -1 },
+    { 21212, 20253, -1 }, { 21187, 20254, -1 }, { 21195, 20255, -1 }, { 21187, 20256, -1 },
+    { 21213, 20257, -1 }, { 21225, 20258, -1 }, { 21226, 20259, -1 }, { 21233, 20260, -1 },
+    { 21247, 20261, -1 }, { 21198, 20262, -1 }, { 21215, 20263, -1 }, { 21222, 20264, -1 },
+    { 21238, 20265, -1 }, { 21229, 20266, -1 }, { 21257, 20267, -1 }, { 21222, 20268, -1 },
+    { 0, 20269, 3 }, { 0, 20270, 11 }, { 0, 20271, 14 }, { 0, 20272, 17 },
+    { 0, 20273, 18 }, { 0, 20274, 21 }, { 21156, 20275, -1 }, { 0, 20276, 26 },
+    { 0, 20277, 33 }, { 0, 20278, 36 }, { 0, 20279, 41 }, { 0, 20280, 58 },
+    { 0, 20281, 60 }, { 0, 20282, 63 }, { 0, 20283, 65 }, { 0, 20284, 68 },
+    { 0, 20285, 86 }, { 0, 20286, 129 }, { 0, 20287, 136 }, { 0, 20288, 142 },
+    { 0, 20289, 144 }, { 0, 20290, 145 }, { 0, 20291, 151 }, { 0, 20292, 152 },
+    { 0, 20293, 153 }, { 0, 20294, 154 }, { 0, 20295, 155 }, { 0, 20296, 156 },
+    { 0, 20297, 157 }, { 0, 20298, 158 }, { 0, 20299, 159 }, { 0, 20300, 160 },
+    { 0, 20301, 161 }, { 0, 20302, 162 }, { 0, 20303, 183 }, { 0, 20304, 190 },
+    { 0, 20305, 198 }, { 0, 20306, 201 }, { 0, 20307, 217 }, { 0, 20308, 237 },
+    { 0, 20309, 239 }, { 0, 20331, 240 }, { 0, 20310, 241 }, { 0, 20311, 243 },
+    { 0, 20312, 248 }, { 0, 20313, 259 }, { 21159, 20314, -1 }, { 21160, 20315, -1 },
+    { 0, 20316, 315 }, { 0, 20317, 331 }, { 0, 20318, 340 }, { 0, 20319, 341 },
+    { 0, 20320, 342 }, { 0, 20321, 382 }, { 21158, 20322, -1 }, { 21159, 20323, -1 },
+    { 0, 20324, 437 }, { 0, 20325, 442 }, { 0, 20326, 449 }, { 0, 20327, 451 },
+    { 21163, 20328, -1 }, { 0, 20329, 459 }, { 0, 20330, 482 }, { 0, 20332, 493 },
+    { 0, 20333, 501 }, { 0, 20334, 502 }, { 0, 20335, 524 }, { 21161, 20336, -1 },
+    { 0, 20337, 527 }, { 21165, 20338, -1 }, { 21166, 20339, -1 }, { 0, 20340, 552 },
+    { 0, 20341, 628 }, { 0, 20342, 660 }, { 0, 20343, 665 }, { 0, 20344, 669 },
+    { 21166, 20345, -1 }, { 0, 20346, 673 }, { 0, 20347, 686 }, { 0, 20348, 712 },
+    { 0, 20349, 718 }, { 0, 20350, 728 }, { 0, 20351, 742 }, { 0, 20352, 752 },
+    { 21168, 20353, -1 }, { 0, 20354, 754 }, { 21169, 20355, -1 }, { 0, 20356, 767 },
+    { 0, 20359, 768 }, { 21168, 20357, -1 }, { 0, 20358, 830 }, { 0, 20360, 849 },
+    { 0, 20361, 861 }, { 0, 20362, 866 }, { 0, 20363, 945 }, { 0, 20364, 1027 },
+    { 0, 20365, 1047 }, { 0, 20366, 1130 }, { 0, 20367, 1133 }, { 0, 20368, 1148 },
+    { 0, 20369, 1157 }, { 0, 20370, 1158 }, { 0, 20371, 1166 }, { 0, 20372, 1182 },
+    { 0, 20373, 1183 }, { 0, 20374, 1185 }, { 0, 20375, 1197 }, { 0, 20376, 1202 },
+    { 0, 20377, 1231 }, { 21170, 20378, -1 }, { 0, 20379, 1325 }, { 0, 20380, 1341 },
+    { 0, 20381, 1344 }, { 0, 20382, 1346 }, { 0, 20383, 1355 }, { 0, 20384, 1395 },
+    { 0, 20385, 1434 }, { 0, 20386, 1435 }, { 21171, 20387, -1 }, { 0, 20388, 1439 },
+    { 0, 20389, 1448 }, { 0, 20390, 1454 }, { 0, 20391, 1464 }, { 0, 20392, 1477 },
+    { 0, 20393, 1498 }, { 0, 20394, 1515 }, { 0, 20395, 1517 }, { 0, 20396, 1520 },
+    { 0, 20397, 1522 }, { 0, 20398, 1523 }, { 0, 20399, 1531 }, { 21173, 20400, -1 },
+    { 0, 20401, 1534 }, { 0, 20402, 1536 }, { 0, 20403, 1550 }, { 0, 20404, 1551 },
+    { 0, 20405, 1554 }, { 0, 20406, 1555 }, { 0, 20407, 1568 }, { 0, 20408, 1586 },
+    { 0, 20409, 1599 }, { 0, 20410, 1600 }, { 0, 20411, 1601 }, { 0, 20412, 1606 },
+    { 21174, 20413, -1 }, { 21175, 20414, -1 }, { 0, 20415, 1648 }, { 0, 20416, 1656 },
+    { 0, 20417, 1675 }, { 0, 20418, 1692 }, { 0, 20419, 1703 }, { 0, 20420, 1709 },
+    { 0, 20421, 1760 }, { 0, 20422, 1794 }, { 0, 20423, 1802 }, { 0, 20424, 1807 },
+    { 0, 20425, 1811 }, { 0, 20426, 1815 }, { 0, 20427, 1816 }, { 0, 20428, 1818 },
+    { 0, 20429, 1843 }, { 0, 20430, 1853 }, { 0, 20431, 1854 }, { 0, 20432, 1862 },
+    { 0, 20433, 1878 }, { 0, 20434, 1881 }, { 0, 20435, 1895 }, { 0, 20436, 1921 },
+    { 0, 20437, 1923 }, { 0, 20438, 1924 }, { 21176, 20439, -1 }, { 21177, 20440, -1 },
+    { 0, 20441, 1943 }, { 0, 20442, 1959 }, { 0, 20443, 1960 }, { 0, 20444, 1975 },
+    { 21175, 20445, -1 }, { 0, 20446, 2028 }, { 0, 20447, 2047 }, { 0, 20448, 2052 },
+    { 0, 20449, 2053 }, { 0, 20450, 2057 }, { 0, 20451, 2061 }, { 0, 20452, 2064 },
+    { 0, 20453, 2065 }, { 0, 20454, 2066 }, { 0, 20455, 2067 }, { 21178, 20456, -1 },
+    { 0, 20457, 2081 }, { 0, 20458, 2082 }, { 0, 20459, 2127 }, { 21177, 20460, -1 },
+    { 0, 20461, 2170 }, { 0, 20462, 2178 }, { 0, 20463, 2181 }, { 0, 20464, 2189 },
+    { 0, 20465, 2194 }, { 0, 20466, 2202 }, { 0, 20467, 2223 }, { 0, 20468, 2237 },
+    { 0, 20469, 2275 }, { 0, 20470, 2277 }, { 0, 20471, 2281 }, { 0, 20472, 2282 },
+    { 0, 20473, 2289 }, { 0, 20474, 2298 }, { 21182, 20475, -1 }, { 0, 20476, 2310 },
+    { 0, 20477, 2315 }, { 0, 20478, 2323 }, { 0, 20479, 2326 }, { 0, 20480, 2358 },
+    { 0, 20481, 2372 }, { 0, 20482, 2374 }, { 0, 20483, 2378 }, { 0, 20484, 2382 },
+    { 0, 20485, 2391 }, { 0, 20486, 2429 }, { 21182, 20487, -1 }, { 0, 20488, 2450 },
+    { 0, 20489, 2472 }, { 0, 20490, 2520 }, { 0, 20491, 2525 }, { 0, 20492, 2539 },
+    { 0, 20493, 2561 }, { 0, 20494, 2587 }, { 0, 20495, 2588 }, { 0, 20496, 2616 },
+    { 0, 20497, 2617 }, { 0, 20498, 2618 }, { 21183, 20499, -1 }, { 0, 20500, 2625 },
+    { 0, 20501, 2627 }, { 0, 20502, 2637 }, { 0, 20503, 2638 }, { 0, 20504, 2665 },
+    { 0, 20505, 2674 }, { 0, 20506, 2716 }, { 21184, 20507, -1 }, { 0, 20508, 2725 },
+    { 0, 20509, 2751 }, { 0, 20510, 2752 }, { 0, 20511, 2766 }, { 0, 20512, 2768 },
+    { 0, 20513, 2782 }, { 0, 20514, 2818 }, { 0, 20515, 2826 }, { 0, 20516, 2951 },
+    { 0, 20517, 2960 }, { 0, 20518, 2980 }, { 0, 20519, 2982 }, { 0, 20520, 2983 },
+    { 0, 20521, 2986 }, { 0, 20522, 2993 }, { 0, 20523, 2996 }, { 0, 20524, 2997 },
+    { 0, 20525, 3005 }, { 0, 20526, 3014 }, { 0, 20527, 3047 }, { 0, 20528, 3056 },
+    { 0, 20529, 3067 }, { 0, 20530, 3073 }, { 0, 20531, 3080 }, { 21182, 20532, -1 },
+    { 0, 20533, 3089 }, { 0, 20534, 3090 }, { 0, 20535, 3099 }, { 0, 20536, 3118 },
+    { 0, 20537, 3123 }, { 0, 20538, 3133 }, { 0, 20539, 3143 }, { 0, 20540, 3209 },
+    { 0, 20541, 3210 }, { 0, 20542, 3211 }, { 0, 20543, 3217 }, { 21186, 20544, -1 },
+    { 0, 20545, 3252 }, { 0, 20546, 3313 }, { 21188, 20547, -1 }, { 0, 20548, 3323 },
+    { 0, 20549, 3332 }, { 0, 20550, 3347 }, { 0, 20551, 3359 }, { 0, 20552, 3363 },
+    { 0, 20553, 3373 }, { 0, 20554, 3399 }, { 0, 20555, 3410 }, { 0, 20556, 3412 },
+    { 0, 20557, 3415 }, { 0, 20558, 3420 }, { 0, 20559, 3459 }, { 0, 20560, 3465 },
+    { 0, 20561, 3466 }, { 0, 20562, 3474 }, { 0, 20563, 3475 }, { 0, 20564, 3476 },
+    { 0, 20565, 3496 }, { 0, 20566, 3502 }, { 0, 20567, 3508 }, { 0, 20568, 3512 },
+    { 0, 20569, 3518 }, { 0, 20570, 3519 }, { 0, 20571, 3520 }, { 0, 20572, 3521 },
+    { 0, 20573, 3525 }, { 0, 20574, 3549 }, { 0, 20575, 3550 }, { 0, 20576, 3562 },
+    { 0, 20577, 3600 }, { 0, 20578, 3614 }, { 0, 20579, 3619 }, { 21185, 20580, -1 },
+    { 21189, 20581, -1 }, { 0, 20582, 3631 }, { 0, 20583, 3636 }, { 0, 20584, 3638 },
+    { 0, 20585, 3641 }, { 0, 20586, 3650 }, { 0, 20587, 3653 }, { 0, 20588, 3685 },
+    { 0, 20589, 3697 }, { 0, 20590, 3698 }, { 21191, 20591, -1 }, { 21190, 20592, -1 },
+    { 0, 20593, 3715 }, { 21193, 20594, -1 }, { 0, 20595, 3802 }, { 21193, 20596, -1 },
+    { 0, 20597, 3870 }, { 0, 20598, 3871 }, { 0, 20599, 3886 }, { 0, 20600, 3901 },
+    { 0, 20601, 3902 }, { 0, 20602, 3914 }, { 0, 20603, 3918 }, { 0, 20604, 3919 },
+    { 0, 20605, 3933 }, { 0, 20606, 3934 }, { 0, 20607, 3936 }, { 0, 20608, 3944 },
+    { 0, 20609, 3961 }, { 21194, 20610, -1 }, { 0, 20611, 3965 }, { 0, 20612, 3978 },
+    { 0, 20613, 4000 }, { 0, 20614, 4006 }, { 0, 20615, 4039 }, { 0, 20616, 4047 },
+    { 21196, 20617, -1 }, { 0, 20618, 4076 }, { 0, 20619, 4101 }, { 0, 20620, 4108 },
+    { 0, 20621, 4110 }, { 21197, 20622, -1 }, { 0, 20623, 4168 }, { 21193, 20624, -1 },
+    { 0, 20625, 4180 }, { 0, 20626, 4182 }, { 0, 20627, 4203 }, { 0, 20628, 4211 },
+    { 0, 20629, 4212 }, { 0, 20630, 4215 }, { 0, 20631, 4218 }, { 0, 20632, 4223 },
+    { 0, 20633, 4230 }, { 0, 20634, 4246 }, { 0, 20635, 4262 }, { 0, 20636, 4263 },
+    { 0, 20637, 4285 }, { 0, 20638, 4303 }, { 0, 20639, 4361 }, { 0, 20640, 4362 },
+    { 0, 20641, 4375 }, { 0, 20642, 4388 }, { 0, 20643, 4393 }, { 0, 20644, 4418 },
+    { 0, 20645, 4422 }, { 0, 20646, 4434 }, { 0, 20647, 4454 }, { 0, 20648, 4460 },
+    { 0, 20649, 4461 }, { 0, 20650, 4493 }, { 0, 20651, 4552 }, { 0, 20652, 4553 },
+    { 0, 20653, 4560 }, { 0, 20654, 4565 }, { 0, 20655, 4569 }, { 0, 20656, 4576 },
+    { 0, 20657, 4585 }, { 0, 20658, 4586 }, { 21198, 20659, -1 }, { 0, 20660, 4611 },
+    { 0, 20661, 4621 }, { 0, 20662, 4633 }, { 0, 20663, 4637 }, { 0, 20664, 4638 },
+    { 0, 20665, 4650 }, { 0, 20666, 4725 }, { 21199, 20667, -1 }, { 0, 20668, 4742 },
+    { 0, 20669, 4744 }, { 0, 20670, 4745 }, { 0, 20671, 4748 }, { 21200, 20672, -1 },
+    { 21201, 20673, -1 }, { 0, 20674, 4767 }, { 0, 20675, 4768 }, { 0, 20676, 4770 },
+    { 0, 20677, 4776 }, { 0, 20678, 4782 }, { 0, 20679, 4783 }, { 0, 20680, 4794 },
+    { 0, 20681, 4801 }, { 0, 20682, 4806 }, { 0, 20683, 4808 }, { 0, 20684, 4863 },
+    { 0, 20685, 4870 }, { 0, 20686, 4881 }, { 0, 20687, 4887 }, { 0, 20688, 4903 },
+    { 0, 20689, 4913 }, { 0, 20690, 4917 }, { 0, 20691, 4933 }, { 0, 20692, 4934 },
+    { 0, 20693, 4977 }, { 0, 20694, 4997 }, { 0, 20695, 5055 }, { 0, 20696, 5140 },
+    { 0, 20697, 5196 }, { 0, 20698, 5198 }, { 0, 20699, 5220 }, { 21198, 20700, -1 },
+    { 0, 20701, 5282 }, { 0, 20702, 5284 }, { 0, 20703, 5288 }, { 0, 20704, 5294 },
+    { 0, 20705, 5296 }, { 0, 20706, 5297 }, { 0, 20728, 5298 }, { 0, 20707, 5299 },
+    { 0, 20708, 5300 }, { 0, 20709, 5303 }, { 0, 20710, 5304 }, { 0, 20711, 5305 },
+    { 0, 20712, 5307 }, { 0, 20713, 5309 }, { 0, 20714, 5310 }, { 0, 20715, 5327 },
+    { 0, 20716, 5339 }, { 0, 20717, 5340 }, { 0, 20718, 5344 }, { 0, 20719, 5371 },
+    { 0, 20720, 5410 }, { 0, 20721, 5411 }, { 0, 20722, 5434 }, { 0, 20723, 5435 },
+    { 0, 20724, 5439 }, { 0, 20725, 5503 }, { 0, 20726, 5527 }, { 0, 20727, 5538 },
+    { 0, 20729, 5548 }, { 0, 20730, 5549 }, { 0, 20731, 5567 }, { 0, 20732, 5583 },
+    { 0, 20733, 5596 }, { 0, 20734, 5604 }, { 0, 20735, 5607 }, { 0, 20736, 5625 },
+    { 0, 20737, 5633 }, { 0, 20738, 5646 }, { 0, 20739, 5662 }, { 0, 20740, 5663 },
+    { 0, 20741, 5681 }, { 0, 20742, 5682 }, { 0, 20743, 5683 }, { 0, 20744, 5684 },
+    { 0, 20745, 5685 }, { 0, 20746, 5714 }, { 0, 20747, 5715 }, { 0, 20748, 5735 },
+    { 0, 20749, 5743 }, { 0, 20750, 5744 }, { 0, 20751, 5779 }, { 0, 20752, 5829 },
+    { 0, 20753, 5840 }, { 0, 20754, 5864 }, { 0, 20755, 5928 }, { 0, 20756, 5941 },
+    { 0, 20757, 5959 }, { 0, 20758, 5960 }, { 0, 20759, 5974 }, { 0, 20760, 6050 },
+    { 0, 20761, 6054 }, { 0, 20762, 6072 }, { 0, 20763, 6094 }, { 0, 20764, 6129 },
+    { 0, 20765, 6146 }, { 0, 20766, 6190 }, { 0, 20767, 6206 }, { 0, 20768, 6224 },
+    { 0, 20769, 6228 }, { 0, 20770, 6234 }, { 0, 20771, 6258 }, { 0, 20772, 6259 },
+    { 0, 20773, 6274 }, { 0, 20774, 6275 }, { 0, 20775, 6294 }, { 0, 20776, 6319 },
+    { 0, 20777, 6320 }, { 0, 20778, 6321 }, { 0, 20779, 6322 }, { 0, 20780, 6323 },
+    { 0, 20781, 6344 }, { 0, 20782, 6398 }, { 0, 20783, 6407 }, { 0, 20784, 6435 },
+    { 0, 20785, 6441 }, { 0, 20786, 6449 }, { 0, 20787, 6450 }, { 0, 20788, 6464 },
+    { 0, 20789, 6467 }, { 0, 20790, 6469 }, { 0, 20791, 6508 }, { 0, 20792, 6567 },
+    { 0, 20793, 6660 }, { 0, 20794, 6714 }, { 0, 20795, 6788 }, { 0, 20796, 6793 },
+    { 21203, 20797, -1 }, { 0, 20798, 6801 }, { 21201, 20799, -1 }, { 0, 20800, 6892 },
+    { 0, 20801, 6894 }, { 0, 20802, 6898 }, { 0, 20803, 6917 }, { 0, 20804, 6922 },
+    { 0, 20805, 6960 }, { 0, 20806, 6973 }, { 0, 20807, 7031 }, { 0, 20808, 7035 },
+    { 0, 20809, 7043 }, { 0, 20810, 7049 }, { 0, 20811, 7058 }, { 0, 20812, 7061 },
+    { 0, 20813, 7065 }, { 0, 20814, 7120 }, { 0, 20815, 7199 }, { 0, 20816, 7273 },
+    { 0, 20817, 7276 }, { 0, 20818, 7278 }, { 21201, 20819, -1 }, { 0, 20820, 7306 },
+    { 0, 20821, 7307 }, { 0, 20822, 7357 }, { 0, 20823, 7358 }, { 0, 20824, 7364 },
+    { 0, 20825, 7380 }, { 0, 20826, 7383 }, { 0, 20827, 7398 }, { 21298, 20834, -1 },
+    { 21303, 20874, -1 }, { 21304, 20875, -1 }, { 21294, 20882, -1 }, { 21297, 20883, -1 },
+    { 21298, 20888, -1 }, { 21280, 20895, -1 }, { 21300, 20897, -1 }, { 21279, 20898, -1 },
+    { 21292, 20904, -1 }, { 21281, 20912, -1 }, { 21304, 20914, -1 }, { 21286, 20917, -1 },
+    { 21296, 20937, -1 }, { 21293, 20946, -1 }, { 21304, 20959, -1 }, { 21296, 20972, -1 },
+    { 21296, 20973, -1 }, { 21291, 20998, -1 }, { 21296, 20999, -1 }, { 21294, 21004, -1 },
+    { 21280, 21015, -1 }, { 21267, 21019, -1 }, { 21272, 21034, -1 }, { 21276, 21046, -1 },
+    { 21272, 21058, -1 }, { 21271, 21066, -1 }, { 21309, 21091, -1 }, { 21273, 21103, -1 },
+    { 21278, 21106, -1 }, { 21325, 21139, -1 }, { 21291, 21140, -1 }, { 21282, 21150, -1 },
+    { 21300, 21151, -1 }, { 21283, 21153, -1 }, { 21328, 21155, -1 }, { 21329, 21169, -1 },
+    { 21288, 21176, -1 }, { 21288, 21181, -1 }, { 21328, 21183, -1 }, { 21329, 21218, -1 },
+    { 21291, 21226, -1 }, { 21335, 21231, -1 }, { 21293, 21232, -1 }, { 21314, 21259, -1 },
+    { 21295, 21356, -1 }, { 21345, 21358, -1 }, { 21312, 21378, -1 }, { 21314, 21387, -1 },
+    { 21345, 21388, -1 }, { 21346, 21389, -1 }, { 21348, 21390, -1 }, { 21310, 21391, -1 },
+    { 21354, 21392, -1 }, { 21321, 21393, -1 }, { 21356, 21394, -1 }, { 21321, 21395, -1 },
+    { 21349, 21396, -1 }, { 21323, 21397, -1 }, { 21360, 21398, -1 }, { 21321, 21399, -1 },
+    { 21321, 21400, -1 }, { 21325, 21401, -1 }, { 21334, 21402, -1 }, { 21337, 21403, -1 },
+    { 21348, 21404, -1 }, { 21311, 21405, -1 }, { 21336, 21406, -1 }, { 21335, 21407, -1 },
+    { 21324, 21408, -1 }, { 21342, 21409, -1 }, { 21372, 21410, -1 }, { 21327, 21411, -1 },
+    { 21365, 21412, -1 }, { 21365, 21413, -1 }, { 21339, 21414, -1 }, { 21328, 21415, -1 },
+    { 21363, 21416, -1 }, { 21382, 21417, -1 }, { 21328, 21418, -1 }, { 21371, 21419, -1 },
+    { 21386, 21420, -1 }, { 21375, 21421, -1 }, { 21384, 21422, -1 }, { 21332, 21423, -1 },
+    { 21381, 21424, -1 }, { 21382, 21425, -1 }, { 21363, 21426, -1 }, { 21339, 21427, -1 },
+    { 21346, 21428, -1 }, { 21391, 21429, -1 }, { 21348, 21430, -1 }, { 21346, 21431, -1 },
+    { 21350, 21432, -1 }, { 21344, 21433, -1 }, { 21362, 21434, -1 }, { 0, 21435, 22 },
+    { 0, 21436, 297 }, { 0, 21437, 298 }, { 0, 21438, 419 }, { 0, 21439, 420 },
+    { 0, 21440, 454 }, { 0, 21441, 525 }, { 0, 21442, 528 }, { 21302, 21443, -1 },
+    { 0, 21444, 672 }, { 21303, 21445, -1 }, { 0, 21446, 758 }, { 0, 21447, 807 },
+    { 21304, 21448, -1 }, { 0, 21449, 1437 }, { 0, 21450, 1532 }, { 0, 21451, 1618 },
+    { 0, 21452, 1634 }, { 21305, 21453, -1 }, { 21306, 21454, -1 }, { 0, 21455, 1998 },
+    { 21303, 21456, -1 }, { 0, 21457, 2140 }, { 21308, 21458, -1 }, { 0, 21459, 2433 },
+    { 0, 21460, 2624 }, { 0, 21461, 2722 }, { 0, 21462, 3088 }, { 21305, 21463, -1 },
+    { 21310, 21464, -1 }, { 0, 21465, 3620 }, { 0, 21466, 3624 }, { 0, 21467, 3712 },
+    { 0, 21468, 3713 }, { 21311, 21469, -1 }, { 0, 21470, 3812 }, { 0, 21471, 3962 },
+    { 21308, 21472, -1 }, { 21313, 21473, -1 }, { 0, 21474, 4176 }, { 0, 21475, 4597 },
+    { 0, 21476, 4733 }, { 0, 21477, 4762 }, { 0, 21478, 4764 }, { 0, 21479, 5264 },
+    { 0, 21480, 6798 }, { 0, 21481, 6848 }, { 21314, 21482, -1 }, { 21371, 21491, -1 },
+    { 21372, 21493, -1 }, { 21401, 21496, -1 }, { 21370, 21501, -1 }, { 21371, 21502, -1 },
+    { 21414, 21504, -1 }, { 21359, 21506, -1 }, { 21405, 21511, -1 }, { 21366, 21512, -1 },
+    { 21368, 21517, -1 }, { 21401, 21520, -1 }, { 21399, 21521, -1 }, { 21392, 21530, -1 },
+    { 21413, 21531, -1 }, { 21414, 21532, -1 }, { 21425, 21533, -1 }, { 21432, 21534, -1 },
+    { 21433, 21535, -1 }, { 21422, 21536, -1 }, { 21432, 21537, -1 }, { 21405, 21538, -1 },
+    { 21416, 21539, -1 }, { 21388, 21540, -1 }, { 21426, 21541, -1 }, { 21392, 21542, -1 },
+    { 21389, 21543, -1 }, { 0, 21544, 550 }, { 0, 21545, 753 }, { 0, 21546, 1237 },
+    { 0, 21547, 1926 }, { 0, 21548, 1927 }, { 0, 21549, 2075 }, { 0, 21550, 2300 },
+    { 0, 21551, 3225 }, { 0, 21552, 3316 }, { 0, 21553, 3754 }, { 0, 21554, 4059 },
+    { 0, 21555, 4161 }, { 0, 21556, 7281 },
+};
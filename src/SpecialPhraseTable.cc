@@ -21,6 +21,7 @@
  */
 #include "SpecialPhraseTable.h"
 
+#include <algorithm>
 #include <fstream>
 
 #include "DynamicSpecialPhrase.h"
@@ -29,6 +30,7 @@
 namespace PyZy {
 
 std::unique_ptr<SpecialPhraseTable> SpecialPhraseTable::m_instance;
+unsigned int SpecialPhraseTable::m_instances = 0;
 
 class StaticSpecialPhrase : public SpecialPhrase {
 public:
@@ -43,6 +45,7 @@ private:
 };
 
 SpecialPhraseTable::SpecialPhraseTable (const std::string &config_dir)
+    : m_serial (++m_instances)
 {
     char * path =
         g_build_filename (config_dir.c_str(), "phrases.txt", NULL);
@@ -53,24 +56,119 @@ SpecialPhraseTable::SpecialPhraseTable (const std::string &config_dir)
     g_free (path);
 }
 
+size_t
+SpecialPhraseTable::child (size_t node, char c) const
+{
+    for (size_t i = m_nodes[node].child; i != 0; i = m_nodes[i].sibling) {
+        if (m_nodes[i].c == c)
+            return i;
+        if ((guchar) m_nodes[i].c > (guchar) c)
+            break;
+    }
+    return 0;
+}
+
 bool
-SpecialPhraseTable::lookup (const std::string         &command,
-                            std::vector<std::string>  &result)
+SpecialPhraseTable::lookup (size_t                     node,
+                            std::vector<std::string>  &result) const
 {
     result.clear ();
 
-    std::pair<Map::iterator, Map::iterator> range = m_map.equal_range (command);
-    for (Map::iterator it = range.first; it != range.second; it ++) {
-        result.push_back ((*it).second->text ());
+    const Node &n = m_nodes[node];
+    for (size_t i = n.begin; i < n.end; i++) {
+        result.push_back (m_phrases[i].second->text ());
     }
 
     return result.size () > 0;
 }
 
+bool
+SpecialPhraseTable::lookup (const std::string         &command,
+                            std::vector<std::string>  &result) const
+{
+    size_t node = 0;
+    for (size_t i = 0; i < command.size (); i++) {
+        node = child (node, command[i]);
+        if (node == 0)
+            break;
+    }
+    return lookup (node, result);
+}
+
+size_t
+SpecialPhraseTable::complete (size_t                    node,
+                              size_t                    max,
+                              std::vector<std::string> &commands) const
+{
+    size_t size = commands.size ();
+    std::string command;
+    completeNode (node, size + max, command, commands);
+    return commands.size () - size;
+}
+
+/* Appends the commands below node, as the rest after its prefix, until
+ * there are max commands */
+void
+SpecialPhraseTable::completeNode (size_t                    node,
+                                  size_t                    max,
+                                  std::string              &command,
+                                  std::vector<std::string> &commands) const
+{
+    for (size_t i = m_nodes[node].child; i != 0; i = m_nodes[i].sibling) {
+        if (commands.size () >= max)
+            return;
+        command.push_back (m_nodes[i].c);
+        if (m_nodes[i].begin < m_nodes[i].end)
+            commands.push_back (command);
+        completeNode (i, max, command, commands);
+        command.resize (command.size () - 1);
+    }
+}
+
+void
+SpecialPhraseTable::insert (const std::string       &command,
+                            const SpecialPhrasePtr  &phrase)
+{
+    size_t node = 0;
+    for (size_t i = 0; i < command.size (); i++) {
+        const guchar c = command[i];
+
+        /* find c in the sorted children, or the place to insert it */
+        size_t prev = 0;
+        size_t next = m_nodes[node].child;
+        while (next != 0 && (guchar) m_nodes[next].c < c) {
+            prev = next;
+            next = m_nodes[next].sibling;
+        }
+
+        if (next == 0 || (guchar) m_nodes[next].c != c) {
+            Node n = { 0, (guint32) next, 0, 0, (char) c };
+            size_t id = m_nodes.size ();
+            m_nodes.push_back (n);
+            if (prev == 0)
+                m_nodes[node].child = id;
+            else
+                m_nodes[prev].sibling = id;
+            next = id;
+        }
+        node = next;
+    }
+    m_phrases.push_back (std::make_pair ((guint32) node, phrase));
+}
+
+static bool
+phrase_node_less (const std::pair<guint32, SpecialPhrasePtr> &a,
+                  const std::pair<guint32, SpecialPhrasePtr> &b)
+{
+    return a.first < b.first;
+}
+
 bool
 SpecialPhraseTable::load (const char *file)
 {
-    m_map.clear ();
+    Node root = { 0, 0, 0, 0, '\0' };
+    m_nodes.assign (1, root);
+    m_phrases.clear ();
 
     std::ifstream in (file);
     if (in.fail ())
@@ -92,13 +190,22 @@ SpecialPhraseTable::load (const char *file)
 
         if (value[0] != '#') {
             SpecialPhrasePtr phrase (new StaticSpecialPhrase (value, 0));
-            m_map.insert (Map::value_type (command, phrase));
+            insert (command, phrase);
         }
         else if (value.size () > 1) {
             SpecialPhrasePtr phrase (new DynamicSpecialPhrase (value.substr (1), 0));
-            m_map.insert (Map::value_type (command, phrase));
+            insert (command, phrase);
         }
     }
+
+    /* the phrases of a command together, in the order of the file */
+    std::stable_sort (m_phrases.begin (), m_phrases.end (), phrase_node_less);
+    for (size_t i = 0; i < m_phrases.size (); i++) {
+        Node &node = m_nodes[m_phrases[i].first];
+        if (node.begin == node.end)
+            node.begin = i;
+        node.end = i + 1;
+    }
     return true;
 }
 
@@ -23,7 +23,6 @@
 #define __PYZY_SPECIAL_PHRASE_TABLE_H_
 
 #include <glib.h>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -39,21 +38,54 @@ private:
     explicit SpecialPhraseTable (const std::string &config_dir);
 
 public:
-    bool lookup (const std::string &command, std::vector<std::string> &result);
+    /* The commands are stored as a trie of their bytes. A node stands for
+     * a command prefix, and 0 is the root, the empty prefix, which is no
+     * child of any node, so child () returns 0 when no command has the
+     * prefix of node followed by c. */
+    size_t child (size_t node, char c) const;
+    bool lookup (size_t node, std::vector<std::string> &result) const;
+    bool lookup (const std::string &command, std::vector<std::string> &result) const;
+
+    /* Appends the rest of at most max longer commands starting with the
+     * prefix of node, in byte order, as hints to complete the prefix, and
+     * returns how many it appended */
+    size_t complete (size_t                    node,
+                     size_t                    max,
+                     std::vector<std::string> &commands) const;
+
+    /* changes whenever a table is created, so the nodes of an old table
+     * are known to be stale */
+    unsigned int serial (void) const { return m_serial; }
 
 private:
     bool load (const char *file);
+    void insert (const std::string &command, const SpecialPhrasePtr &phrase);
+    void completeNode (size_t                    node,
+                       size_t                    max,
+                       std::string              &command,
+                       std::vector<std::string> &commands) const;
 
 public:
     static void init (const std::string &config_dir);
     static SpecialPhraseTable & instance (void);
 
 private:
-    typedef std::multimap<std::string, SpecialPhrasePtr> Map;
-    Map m_map;
+    /* The children of a node are a list of siblings sorted by byte, and
+     * the phrases of a node are m_phrases[begin, end) */
+    struct Node {
+        guint32 child;
+        guint32 sibling;
+        guint32 begin;
+        guint32 end;
+        char c;
+    };
+    std::vector<Node> m_nodes;
+    std::vector<std::pair<guint32, SpecialPhrasePtr> > m_phrases;
+    unsigned int m_serial;
 
 private:
     static std::unique_ptr<SpecialPhraseTable> m_instance;
+    static unsigned int m_instances;
 };
 
 };  // namespace PyZy
@@ -0,0 +1,428 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#include "UserDBWriter.h"
+
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <glib/gstdio.h>
+#include <unistd.h>
+
+namespace PyZy {
+
+/* how long the writer waits for more changes before writing them */
+#define DB_WRITE_DELAY      (2)
+
+enum {
+    STMT_INSERT = 0,
+    STMT_UPDATE,
+    STMT_DELETE,
+};
+
+/* A journal record is followed by len pairs of sheng and yun ids and by
+ * size bytes of the phrase. check is the FNV-1a hash of the whole record
+ * with check set to 0, so a torn record at the end is dropped. */
+struct JournalRecord {
+    guint32 seq;
+    guint32 freq;
+    guint32 check;
+    guint8 len;
+    guint8 size;
+    guint8 remove;
+    guint8 reserved;
+};
+
+#define JOURNAL_RECORD_MAX_SIZE \
+    (sizeof (JournalRecord) + MAX_PHRASE_LEN * 2 + PHRASE_LEN_IN_BYTE)
+
+static guint32
+journal_record_check (const char *data, size_t size)
+{
+    guint32 hash = 2166136261U;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= (guint8) data[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+UserPhraseUpdater::UserPhraseUpdater (sqlite3 *db, const char *schema)
+    : m_db (db)
+    , m_schema (schema)
+{
+}
+
+SQLStmtPtr
+UserPhraseUpdater::prepare (size_t index, size_t len)
+{
+    SQLStmtPtr &stmt = m_stmts[index][len - 1];
+    if (stmt.get () != NULL)
+        return stmt;
+
+    /* phrase is bound to ?1, freq or delta to ?2 and the pinyin ids
+     * from ?3 */
+    String sql;
+    switch (index) {
+    case STMT_INSERT:
+        sql << "INSERT OR IGNORE INTO " << m_schema << ".py_phrase_" << len - 1
+            << " VALUES (0,?1,?2";
+        for (size_t i = 0; i < len; i++)
+            sql << ",?" << 3 + i * 2 << ",?" << 4 + i * 2;
+        sql << ")";
+        break;
+    case STMT_UPDATE:
+        sql << "UPDATE " << m_schema << ".py_phrase_" << len - 1
+            << " SET user_freq=user_freq+?2";
+        break;
+    case STMT_DELETE:
+        sql << "DELETE FROM " << m_schema << ".py_phrase_" << len - 1;
+        break;
+    }
+
+    if (index != STMT_INSERT) {
+        sql << " WHERE phrase=?1";
+        for (size_t i = 0; i < len; i++)
+            sql << " AND s" << i << "=?" << 3 + i * 2
+                << " AND y" << i << "=?" << 4 + i * 2;
+    }
+
+    SQLStmtPtr p (new SQLStmt (m_db));
+    if (!p->prepare (sql))
+        return SQLStmtPtr ();
+    stmt = p;
+    return stmt;
+}
+
+bool
+UserPhraseUpdater::execute (size_t index, const Phrase &phrase, unsigned int delta)
+{
+    SQLStmtPtr stmt = prepare (index, phrase.len);
+    if (stmt.get () == NULL)
+        return false;
+
+    stmt->bindText (1, phrase.phrase);
+    if (index != STMT_DELETE)
+        stmt->bindInt (2, index == STMT_INSERT ? phrase.freq : delta);
+    for (size_t i = 0; i < phrase.len; i++) {
+        stmt->bindInt (3 + i * 2, phrase.pinyin_id[i].sheng);
+        stmt->bindInt (4 + i * 2, phrase.pinyin_id[i].yun);
+    }
+    stmt->step ();
+    stmt->reset ();
+    return true;
+}
+
+bool
+UserPhraseUpdater::insert (const Phrase &phrase, unsigned int delta)
+{
+    return execute (STMT_INSERT, phrase, 0) &&
+           execute (STMT_UPDATE, phrase, delta);
+}
+
+bool
+UserPhraseUpdater::remove (const Phrase &phrase)
+{
+    return execute (STMT_DELETE, phrase, 0);
+}
+
+UserDBWriter::UserDBWriter (const char *filename, const char *journal)
+    : m_filename (filename)
+    , m_journal (journal)
+    , m_db (NULL)
+    , m_fd (-1)
+    , m_seq (0)
+    , m_quit (false)
+{
+    g_mutex_init (&m_mutex);
+    g_cond_init (&m_cond);
+
+    /* the thread is not running yet */
+    if (!open ())
+        close ();
+    recover ();
+
+    m_thread = g_thread_new ("pyzy-userdb", UserDBWriter::threadFunc,
+                             static_cast<gpointer> (this));
+}
+
+UserDBWriter::~UserDBWriter (void)
+{
+    /* the thread writes all pending changes before it quits */
+    g_mutex_lock (&m_mutex);
+    m_quit = true;
+    g_cond_signal (&m_cond);
+    g_mutex_unlock (&m_mutex);
+
+    g_thread_join (m_thread);
+    if (m_fd >= 0)
+        ::close (m_fd);
+    close ();
+    g_cond_clear (&m_cond);
+    g_mutex_clear (&m_mutex);
+}
+
+void
+UserDBWriter::insert (const Phrase &phrase)
+{
+    push (phrase, false);
+}
+
+void
+UserDBWriter::remove (const Phrase &phrase)
+{
+    push (phrase, true);
+}
+
+void
+UserDBWriter::push (const Phrase &phrase, bool remove)
+{
+    Change change;
+    change.phrase = phrase;
+    change.remove = remove;
+
+    char buf[JOURNAL_RECORD_MAX_SIZE];
+    JournalRecord record = { 0 };
+    size_t size = std::strlen (phrase.phrase);
+    record.freq = phrase.freq;
+    record.len = phrase.len;
+    record.size = size;
+    record.remove = remove;
+    char *p = buf + sizeof (record);
+    for (size_t i = 0; i < phrase.len; i++) {
+        *p++ = phrase.pinyin_id[i].sheng;
+        *p++ = phrase.pinyin_id[i].yun;
+    }
+    std::memcpy (p, phrase.phrase, size);
+    p += size;
+
+    g_mutex_lock (&m_mutex);
+    change.seq = record.seq = ++m_seq;
+    std::memcpy (buf, &record, sizeof (record));
+    record.check = journal_record_check (buf, p - buf);
+    std::memcpy (buf, &record, sizeof (record));
+
+    /* the thread writes the record, so no file is written here */
+    m_records.append (buf, p - buf);
+    m_changes.push_back (change);
+    g_cond_signal (&m_cond);
+    g_mutex_unlock (&m_mutex);
+}
+
+gpointer
+UserDBWriter::threadFunc (gpointer data)
+{
+    static_cast<UserDBWriter *> (data)->run ();
+    return NULL;
+}
+
+void
+UserDBWriter::run (void)
+{
+    std::vector<Change> changes;
+
+    g_mutex_lock (&m_mutex);
+    for (;;) {
+        while (m_changes.empty () && !m_quit)
+            g_cond_wait (&m_cond, &m_mutex);
+        if (m_changes.empty ())
+            break;
+
+        /* journal the records as they come, and collect a burst of
+         * commits into one transaction */
+        writeJournal ();
+        gint64 end_time = g_get_monotonic_time () + DB_WRITE_DELAY * G_TIME_SPAN_SECOND;
+        while (!m_quit && g_cond_wait_until (&m_cond, &m_mutex, end_time))
+            writeJournal ();
+        writeJournal ();
+
+        changes.swap (m_changes);
+        g_mutex_unlock (&m_mutex);
+
+        bool written = m_db != NULL && write (changes);
+        changes.clear ();
+
+        g_mutex_lock (&m_mutex);
+        /* the records appended meanwhile are still needed */
+        if (written && m_changes.empty () && m_fd >= 0 &&
+            ftruncate (m_fd, 0) != 0)
+            g_warning ("can not truncate user database journal %s", m_journal.c_str ());
+    }
+    g_mutex_unlock (&m_mutex);
+}
+
+/* Appends the queued records to the journal, with m_mutex held, which is
+ * released while writing */
+void
+UserDBWriter::writeJournal (void)
+{
+    String records;
+    while (!m_records.empty ()) {
+        records.swap (m_records);
+        g_mutex_unlock (&m_mutex);
+
+        /* no fsync here, the records only have to survive a crash of the
+         * process until they are folded into the database */
+        if (m_fd >= 0 &&
+            ::write (m_fd, records.data (), records.size ()) != (ssize_t) records.size ())
+            g_warning ("can not write user database journal %s", m_journal.c_str ());
+        records.clear ();
+
+        g_mutex_lock (&m_mutex);
+    }
+}
+
+bool
+UserDBWriter::open (void)
+{
+    unsigned int flags = SQLITE_OPEN_READWRITE;
+    if (sqlite3_open_v2 (m_filename, &m_db, flags, NULL) != SQLITE_OK) {
+        g_warning ("can not open user database %s", m_filename.c_str ());
+        return false;
+    }
+
+    /* With WAL a transaction only appends the changed pages to the log,
+     * and synchronous=NORMAL keeps the file consistent on a crash. */
+    const char *sql = "PRAGMA journal_mode=WAL;\n"
+                      "PRAGMA synchronous=NORMAL;\n";
+    char *errmsg = NULL;
+    if (sqlite3_exec (m_db, sql, NULL, NULL, &errmsg) != SQLITE_OK) {
+        g_warning ("%s: %s", errmsg, sql);
+        sqlite3_free (errmsg);
+        return false;
+    }
+    sqlite3_busy_timeout (m_db, 1000);
+
+    m_updater.reset (new UserPhraseUpdater (m_db, "main"));
+    m_seq_stmt.reset (new SQLStmt (m_db));
+    if (!m_seq_stmt->prepare ("UPDATE desc SET value=?1 WHERE name='journal-seq'"))
+        return false;
+    return true;
+}
+
+void
+UserDBWriter::close (void)
+{
+    m_updater.reset ();
+    m_seq_stmt.reset ();
+
+    if (m_db != NULL) {
+        if (sqlite3_close (m_db) != SQLITE_OK) {
+            g_warning ("close user database failed!");
+        }
+        m_db = NULL;
+    }
+}
+
+/* Folds the records left in the journal by a crash into the database, and
+ * opens the journal for the next records. Without the database, the
+ * records stay in the journal. */
+void
+UserDBWriter::recover (void)
+{
+    if (m_db != NULL) {
+        SQLStmt stmt (m_db);
+        if (stmt.prepare ("SELECT value FROM desc WHERE name='journal-seq'") &&
+            stmt.step ())
+            m_seq = stmt.columnInt (0);
+    }
+
+    std::vector<Change> changes;
+    gchar *contents = NULL;
+    gsize length = 0;
+    if (g_file_get_contents (m_journal, &contents, &length, NULL)) {
+        const char *p = contents;
+        const char *end = contents + length;
+        while ((size_t) (end - p) >= sizeof (JournalRecord)) {
+            JournalRecord record;
+            std::memcpy (&record, p, sizeof (record));
+            size_t size = sizeof (record) + record.len * 2 + record.size;
+            if (record.len == 0 || record.len > MAX_PHRASE_LEN ||
+                record.size >= PHRASE_LEN_IN_BYTE ||
+                (size_t) (end - p) < size)
+                break;
+
+            char buf[JOURNAL_RECORD_MAX_SIZE];
+            std::memcpy (buf, p, size);
+            std::memset (buf + offsetof (JournalRecord, check), 0, sizeof (record.check));
+            if (journal_record_check (buf, size) != record.check)
+                break;
+
+            if (record.seq > m_seq) {
+                Change change;
+                change.phrase.reset ();
+                change.phrase.freq = record.freq;
+                change.phrase.len = record.len;
+                const char *ids = p + sizeof (record);
+                for (size_t i = 0; i < record.len; i++) {
+                    change.phrase.pinyin_id[i].sheng = ids[i * 2];
+                    change.phrase.pinyin_id[i].yun = ids[i * 2 + 1];
+                }
+                std::memcpy (change.phrase.phrase, ids + record.len * 2, record.size);
+                change.phrase.phrase[record.size] = 0;
+                change.remove = record.remove;
+                change.seq = record.seq;
+                changes.push_back (change);
+            }
+            p += size;
+        }
+        g_free (contents);
+    }
+
+    int flags = O_WRONLY | O_CREAT | O_APPEND;
+    if (m_db != NULL && (changes.empty () || write (changes)))
+        flags |= O_TRUNC;
+    if (!changes.empty ())
+        m_seq = changes.back ().seq;
+
+    m_fd = ::g_open (m_journal, flags, 0600);
+    if (m_fd < 0)
+        g_warning ("can not open user database journal %s", m_journal.c_str ());
+}
+
+bool
+UserDBWriter::write (const std::vector<Change> &changes)
+{
+    if (sqlite3_exec (m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL) != SQLITE_OK) {
+        g_warning ("can not write user database: %s", sqlite3_errmsg (m_db));
+        return false;
+    }
+
+    for (size_t i = 0; i < changes.size (); i++) {
+        if (changes[i].remove)
+            m_updater->remove (changes[i].phrase);
+        else
+            m_updater->insert (changes[i].phrase, 1);
+    }
+
+    m_seq_stmt->bindInt (1, changes.back ().seq);
+    m_seq_stmt->step ();
+    m_seq_stmt->reset ();
+
+    if (sqlite3_exec (m_db, "COMMIT;", NULL, NULL, NULL) != SQLITE_OK) {
+        g_warning ("can not write user database: %s", sqlite3_errmsg (m_db));
+        sqlite3_exec (m_db, "ROLLBACK;", NULL, NULL, NULL);
+        return false;
+    }
+    return true;
+}
+
+};  // namespace PyZy
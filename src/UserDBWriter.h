@@ -0,0 +1,112 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#ifndef __PYZY_USER_DB_WRITER_H_
+#define __PYZY_USER_DB_WRITER_H_
+
+#include <glib.h>
+#include <vector>
+
+#include "Phrase.h"
+#include "SQLStmt.h"
+#include "String.h"
+#include "Util.h"
+
+namespace PyZy {
+
+/* Inserts, counts and removes user phrases with prepared statements */
+class UserPhraseUpdater {
+public:
+    UserPhraseUpdater (sqlite3 *db, const char *schema);
+
+    /* inserts the phrase if needed, and adds delta to its user_freq */
+    bool insert (const Phrase &phrase, unsigned int delta);
+    bool remove (const Phrase &phrase);
+
+private:
+    SQLStmtPtr prepare (size_t index, size_t len);
+    bool execute (size_t index, const Phrase &phrase, unsigned int delta);
+
+private:
+    sqlite3 *m_db;
+    String m_schema;
+    SQLStmtPtr m_stmts[3][MAX_PHRASE_LEN]; /* insert, update and delete stmts */
+};
+
+/*
+ * Persists the user phrase changes. The input path queues a change with a
+ * compact binary record of it; a background thread appends the records to
+ * a journal file at once, folds the queued changes into the user database
+ * file in one transaction every few seconds, and then truncates the
+ * journal.
+ *
+ * Every record has a sequence number, and the database stores the last
+ * one folded into it. After a crash the records newer than that are
+ * replayed from the journal when the writer is created. When the database
+ * can not be opened, the records are kept in the journal for the next
+ * start.
+ */
+class UserDBWriter {
+public:
+    UserDBWriter (const char *filename, const char *journal);
+    ~UserDBWriter (void);
+
+    void insert (const Phrase &phrase);
+    void remove (const Phrase &phrase);
+
+private:
+    struct Change {
+        Phrase phrase;
+        bool remove;
+        guint32 seq;
+    };
+
+    void push (const Phrase &phrase, bool remove);
+    static gpointer threadFunc (gpointer data);
+    void run (void);
+    void writeJournal (void);
+    bool open (void);
+    void close (void);
+    void recover (void);
+    bool write (const std::vector<Change> &changes);
+
+private:
+    String m_filename;
+    String m_journal;
+    sqlite3 *m_db;
+    std::unique_ptr<UserPhraseUpdater> m_updater;
+    SQLStmtPtr m_seq_stmt;
+
+    int m_fd;                           /* journal, written by the thread */
+
+    GMutex m_mutex;
+    GCond m_cond;
+    String m_records;                   /* journal records not written yet,
+                                           protected by m_mutex */
+    guint32 m_seq;                      /* protected by m_mutex */
+    std::vector<Change> m_changes;      /* protected by m_mutex */
+    bool m_quit;                        /* protected by m_mutex */
+    GThread *m_thread;
+};
+
+};  // namespace PyZy
+
+#endif  // __PYZY_USER_DB_WRITER_H_
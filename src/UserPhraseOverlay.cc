@@ -0,0 +1,128 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#include "UserPhraseOverlay.h"
+
+#include <algorithm>
+#include <set>
+
+namespace PyZy {
+
+static inline std::string
+phrase_key (const Phrase &phrase)
+{
+    std::string key ((const char *) phrase.pinyin_id, phrase.len * 2);
+    key += phrase.phrase;
+    return key;
+}
+
+UserPhraseOverlay::Entry &
+UserPhraseOverlay::lookup (const Phrase &phrase)
+{
+    Entries &entries = m_entries[phrase.len - 1];
+    std::pair<Entries::iterator, bool> ret =
+        entries.insert (Entries::value_type (phrase_key (phrase), Entry ()));
+    Entry &entry = ret.first->second;
+    if (ret.second) {
+        entry.phrase = phrase;
+        entry.phrase.user_freq = 0;
+        entry.removed = false;
+        entry.delta = 0;
+        m_size ++;
+    }
+    return entry;
+}
+
+void
+UserPhraseOverlay::insert (const Phrase &phrase, unsigned int delta)
+{
+    lookup (phrase).delta += delta;
+}
+
+void
+UserPhraseOverlay::remove (const Phrase &phrase)
+{
+    Entry &entry = lookup (phrase);
+    entry.removed = true;
+    entry.delta = 0;
+}
+
+void
+UserPhraseOverlay::clear (void)
+{
+    for (size_t i = 0; i < MAX_PHRASE_LEN; i++)
+        m_entries[i].clear ();
+    m_size = 0;
+}
+
+PhraseStreamPtr
+UserPhraseOverlay::apply (const PhraseStreamPtr                 &rows,
+                          const MappedDictionary::Condition    *conditions,
+                          size_t                                len) const
+{
+    const Entries &entries = m_entries[len - 1];
+    if (G_LIKELY (entries.empty ()))
+        return rows;
+
+    /* the overlay is small, so the changed rows are merged by sorting
+     * the rows of the query again */
+    std::shared_ptr<ArrayPhraseStream> stream (new ArrayPhraseStream ());
+    std::vector<Phrase> &phrases = stream->phrases ();
+    std::set<const Entry *> merged;
+    Phrase phrase;
+    while (rows->next (phrase)) {
+        Entries::const_iterator it = entries.find (phrase_key (phrase));
+        if (it == entries.end ()) {
+            phrases.push_back (phrase);
+        }
+        else if (!it->second.removed) {
+            phrase.user_freq += it->second.delta;
+            phrases.push_back (phrase);
+            merged.insert (&it->second);
+        }
+    }
+
+    /* rows not in the user database yet, or inserted again after the
+     * removal */
+    for (Entries::const_iterator it = entries.begin ();
+         it != entries.end (); ++it) {
+        const Entry &entry = it->second;
+        if (entry.delta == 0 || merged.count (&entry) != 0)
+            continue;
+
+        size_t i;
+        for (i = 0; i < len; i++) {
+            if (!conditions[i].accepts (entry.phrase.pinyin_id[i].sheng,
+                                        entry.phrase.pinyin_id[i].yun))
+                break;
+        }
+        if (i < len)
+            continue;
+
+        phrases.push_back (entry.phrase);
+        phrases.back ().user_freq = entry.delta;
+    }
+
+    std::sort (phrases.begin (), phrases.end (), PhraseRankBefore ());
+    return stream;
+}
+
+};  // namespace PyZy
@@ -0,0 +1,70 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+#ifndef __PYZY_USER_PHRASE_OVERLAY_H_
+#define __PYZY_USER_PHRASE_OVERLAY_H_
+
+#include <map>
+#include <string>
+
+#include "MappedDictionary.h"
+#include "Phrase.h"
+#include "PhraseStream.h"
+
+namespace PyZy {
+
+/*
+ * The user phrase changes not folded into the user database yet. Queries
+ * see them at once by passing the user database rows through apply ().
+ */
+class UserPhraseOverlay {
+public:
+    struct Entry {
+        Phrase phrase;
+        bool removed;           /* the row in the user database is removed */
+        unsigned int delta;     /* added to user_freq, after the removal */
+    };
+    typedef std::map<std::string, Entry> Entries;
+
+    UserPhraseOverlay (void) : m_size (0) { }
+
+    void insert (const Phrase &phrase, unsigned int delta);
+    void remove (const Phrase &phrase);
+
+    PhraseStreamPtr apply (const PhraseStreamPtr                 &rows,
+                           const MappedDictionary::Condition    *conditions,
+                           size_t                                len) const;
+
+    const Entries & entries (size_t len) const { return m_entries[len - 1]; }
+    size_t size (void) const { return m_size; }
+    void clear (void);
+
+private:
+    Entry & lookup (const Phrase &phrase);
+
+private:
+    Entries m_entries[MAX_PHRASE_LEN];
+    size_t m_size;
+};
+
+};  // namespace PyZy
+
+#endif  // __PYZY_USER_PHRASE_OVERLAY_H_
@@ -22,10 +22,16 @@
 #include <glib/gstdio.h>
 
 #include <iostream>
+#include <sstream>
 #include <algorithm>
 
 #include "Config.h"
+#include "Const.h"
+#include "Converter.h"
+#include "Database.h"
 #include "InputContext.h"
+#include "PinyinParser.h"
+#include "SpecialPhraseTable.h"
 #include "Util.h"  // for unique_ptr
 #include "Variant.h"
 
@@ -274,7 +280,7 @@ int testFullPinyin ()
         g_assert_cmpstring (context->selectedText (), ==, "");
         g_assert_cmpstring (context->conversionText (), ==, "a a zh|i");
         g_assert_cmpstring (context->restText (), ==, "");
-        g_assert_cmpstring (context->auxiliaryText (), ==, "a a zh|i");
+        g_assert_cmpstring (context->auxiliaryText (), ==, "a a zh|i [aazhi]");
         g_assert (context->hasCandidate (0));
         g_assert_cmpstring (observer.commitedText (), ==, "");
 
@@ -296,7 +302,7 @@ int testFullPinyin ()
         g_assert_cmpstring (context->selectedText (), ==, "");
         g_assert_cmpstring (context->conversionText (), ==, "a a zh|i");
         g_assert_cmpstring (context->restText (), ==, "");
-        g_assert_cmpstring (context->auxiliaryText (), ==, "a a zh|i");
+        g_assert_cmpstring (context->auxiliaryText (), ==, "a a zh|i [aazhi]");
         g_assert (context->hasCandidate (0));
         g_assert_cmpstring (observer.commitedText (), ==, "");
 
@@ -318,7 +324,7 @@ int testFullPinyin ()
         g_assert_cmpstring (context->selectedText (), ==, "");
         g_assert_cmpstring (context->conversionText (), ==, "啊啊");
         g_assert_cmpstring (context->restText (), ==, "");
-        g_assert_cmpstring (context->auxiliaryText (), ==, "a a|");
+        g_assert_cmpstring (context->auxiliaryText (), ==, "a a| [aazhi]");
         g_assert (context->hasCandidate (0));
         g_assert_cmpstring (observer.commitedText (), ==, "");
 
@@ -355,6 +361,30 @@ int testFullPinyin ()
         g_assert (!context->hasCandidate (0));
         g_assert_cmpstring (observer.commitedText (), ==, "啊啊nihao");
     }
+
+    {  // Keys that change no segment look no phrase up.
+        context->reset ();
+        const DatabasePtr &database = Database::instance ();
+        Candidate candidate;
+
+        insertKeys (context.get (), "nihao");
+        g_assert (context->getCandidate (0, candidate));
+        const string text = candidate.text;
+        const size_t queries =
+            database->queryCacheHits () + database->queryCacheMisses ();
+
+        context->insert ('\'');
+        g_assert_cmpstring (context->inputText (), ==, "nihao'");
+        g_assert (context->getCandidate (0, candidate));
+        g_assert_cmpstring (candidate.text, ==, text.c_str ());
+        g_assert_cmpint (database->queryCacheHits () +
+                         database->queryCacheMisses (), ==, queries);
+
+        insertKeys (context.get (), "ma");
+        g_assert_cmpint (database->queryCacheHits () +
+                         database->queryCacheMisses (), >, queries);
+        context->reset ();
+    }
 }
 
 void testDoublePinyin()
@@ -570,7 +600,7 @@ void testDoublePinyin()
         g_assert_cmpstring (context->selectedText (), ==, "");
         g_assert_cmpstring (context->conversionText (), ==, "a zang|i");
         g_assert_cmpstring (context->restText (), ==, "");
-        g_assert_cmpstring (context->auxiliaryText (), ==, "a zang|i");
+        g_assert_cmpstring (context->auxiliaryText (), ==, "a zang|i [aazhi]");
         g_assert (context->hasCandidate (0));
         g_assert_cmpstring (observer.commitedText (), ==, "");
 
@@ -592,7 +622,7 @@ void testDoublePinyin()
         g_assert_cmpstring (context->selectedText (), ==, "");
         g_assert_cmpstring (context->conversionText (), ==, "a zang|i");
         g_assert_cmpstring (context->restText (), ==, "");
-        g_assert_cmpstring (context->auxiliaryText (), ==, "a zang|i");
+        g_assert_cmpstring (context->auxiliaryText (), ==, "a zang|i [aazhi]");
         g_assert (context->hasCandidate (0));
         g_assert_cmpstring (observer.commitedText (), ==, "");
 
@@ -614,7 +644,7 @@ void testDoublePinyin()
         g_assert_cmpstring (context->selectedText (), ==, "");
         g_assert_cmpstring (context->conversionText (), ==, "啊张");
         g_assert_cmpstring (context->restText (), ==, "");
-        g_assert_cmpstring (context->auxiliaryText (), ==, "a zang|");
+        g_assert_cmpstring (context->auxiliaryText (), ==, "a zang| [aazhi]");
         g_assert (context->hasCandidate (0));
         g_assert_cmpstring (observer.commitedText (), ==, "");
 
@@ -623,7 +653,7 @@ void testDoublePinyin()
         g_assert_cmpint (context->cursor (), ==, 8);
         g_assert_cmpstring (context->inputText (), ==, "aazhnihk");
         g_assert_cmpstring (context->selectedText (), ==, "");
-        g_assert_cmpstring (context->conversionText (), ==, "啊站立好");
+        g_assert_cmpstring (context->conversionText (), ==, "啊张你好");
         g_assert_cmpstring (context->restText (), ==, "");
         g_assert_cmpstring (context->auxiliaryText (), ==, "a zang ni hao|");
         g_assert (context->hasCandidate (0));
@@ -634,7 +664,7 @@ void testDoublePinyin()
         g_assert_cmpint (context->cursor (), ==, 8);
         g_assert_cmpstring (context->inputText (), ==, "aazhnihk");
         g_assert_cmpstring (context->selectedText (), ==, "啊");
-        g_assert_cmpstring (context->conversionText (), ==, "站立好");
+        g_assert_cmpstring (context->conversionText (), ==, "张你好");
         g_assert_cmpstring (context->restText (), ==, "");
         g_assert_cmpstring (context->auxiliaryText (), ==, "zang ni hao|");
         g_assert (context->hasCandidate (0));
@@ -1031,6 +1061,25 @@ void testCommit ()
         context->commit (InputContext::TYPE_CONVERTED);
         g_assert_cmpstring (observer.commitedText (), ==, "ㄋㄧㄏㄠ");
     }
+
+    {  // Traditional Chinese commit
+        DummyObserver observer;
+        unique_ptr<InputContext> context;
+        context.reset (
+            InputContext::create (InputContext::FULL_PINYIN, &observer));
+        context->setProperty (InputContext::PROPERTY_MODE_SIMP,
+                              Variant::fromBool (false));
+
+        observer.clear ();
+        insertKeys (context.get (), "zhongguo");
+        g_assert_cmpstring (context->conversionText (), ==, "中國");
+
+        Candidate candidate;
+        g_assert (context->getCandidate (0, candidate));
+        g_assert_cmpstring (candidate.text, ==, "中國");
+        g_assert (context->selectCandidate (0));
+        g_assert_cmpstring (observer.commitedText (), ==, "中國");
+    }
 }
 
 string getTestDir ()
@@ -1068,6 +1117,441 @@ bool removeDirectory (const string &path) {
     return ret == 0;
 }
 
+void testUserDatabases ()
+{
+    const string user_dir = getTestDir () + G_DIR_SEPARATOR_S + "user";
+    DummyObserver observer;
+    unique_ptr<InputContext> context;
+    unique_ptr<InputContext> user_context;
+    context.reset (
+        InputContext::create (InputContext::FULL_PINYIN, &observer));
+    user_context.reset (
+        InputContext::create (InputContext::FULL_PINYIN, &observer, user_dir));
+
+    Candidate candidate;
+    insertKeys (user_context.get (), "ni");
+    g_assert (user_context->getCandidate (5, candidate));
+    const string text = candidate.text;
+    g_assert (user_context->selectCandidate (5));
+    g_assert_cmpstring (observer.commitedText (), ==, text.c_str ());
+
+    // The committed phrase goes first for the user only.
+    insertKeys (user_context.get (), "ni");
+    g_assert (user_context->getCandidate (0, candidate));
+    g_assert_cmpstring (candidate.text, ==, text.c_str ());
+
+    insertKeys (context.get (), "ni");
+    g_assert (context->getCandidate (5, candidate));
+    g_assert_cmpstring (candidate.text, ==, text.c_str ());
+}
+
+void testConverter ()
+{
+    unique_ptr<Converter> converter (Converter::create ());
+
+    g_assert_cmpstring (converter->convert ("nihao"), ==, "你好");
+    g_assert_cmpstring (converter->convert ("zhonghuarenmingongheguo"),
+                        ==, "中华人民共和国");
+    // Characters that are not pinyin are kept.
+    g_assert_cmpstring (converter->convert ("nihao, 123"),
+                        ==, "你好, 123");
+
+    vector<string> texts;
+    g_assert_cmpint (converter->convert ("nihao", 5, texts), ==, 5);
+    g_assert_cmpint (texts.size (), ==, 5);
+    g_assert_cmpstring (texts[0], ==, "你好");
+    g_assert (texts[1] != texts[0]);
+
+    vector<string> pinyins;
+    pinyins.push_back ("nihao");
+    pinyins.push_back ("zhongguo");
+    texts.clear ();
+    converter->convert (pinyins, texts);
+    g_assert_cmpint (texts.size (), ==, 2);
+    g_assert_cmpstring (texts[0], ==, "你好");
+    g_assert_cmpstring (texts[1], ==, "中国");
+
+    // Several threads convert in the order of the pinyins.
+    for (size_t i = 0; i < 500; i++)
+        pinyins.push_back (i % 2 ? "zhongguo" : "nihao");
+    texts.clear ();
+    converter->convert (pinyins, texts, 4);
+    g_assert_cmpint (texts.size (), ==, 502);
+    g_assert_cmpstring (texts[0], ==, "你好");
+    g_assert_cmpstring (texts[501], ==, "中国");
+
+    istringstream in ("nihao\nzhongguo\n");
+    ostringstream out;
+    g_assert_cmpint (converter->convert (in, out, 2), ==, 2);
+    g_assert_cmpstring (out.str (), ==, "你好\n中国\n");
+
+    // Documents may hold bytes that are not UTF-8.
+    string document;
+    for (size_t i = 0; i < 100000; i++)
+        document += "中国\xff\n";
+    string trad;
+    Converter::simpToTrad (document.data (), document.size (), trad, 4);
+    g_assert_cmpint (trad.size (), ==, document.size ());
+    g_assert (trad.compare (0, 8, "中國\xff\n") == 0);
+
+    g_assert (converter->setProperty (InputContext::PROPERTY_MODE_SIMP,
+                                      Variant::fromBool (false)));
+    g_assert_cmpstring (converter->convert ("zhongguo"), ==, "中國");
+    g_assert (!converter->setProperty (InputContext::PROPERTY_SPECIAL_PHRASE,
+                                       Variant::fromBool (false)));
+}
+
+void queryPhrases (Database &database, const PinyinArray &pinyin,
+                   PhraseArray &phrases)
+{
+    const unsigned int option = PINYIN_INCOMPLETE_PINYIN | PINYIN_CORRECT_ALL;
+    PhraseStreamPtr stream =
+        database.query (pinyin, 0, pinyin.size (), -1, option);
+    g_assert (stream.get () != NULL);
+
+    Phrase phrase;
+    phrases.clear ();
+    while (stream->next (phrase))
+        phrases.push_back (phrase);
+}
+
+void testQueryCache ()
+{
+    const string user_dir = getTestDir () + G_DIR_SEPARATOR_S + "cache";
+    DatabasePtr database = Database::instance (user_dir);
+    const unsigned int option = PINYIN_INCOMPLETE_PINYIN | PINYIN_CORRECT_ALL;
+    const String text ("shiyan");
+    PinyinArray pinyin;
+    PinyinParser::parse (text, text.size (), option, pinyin, MAX_PHRASE_LEN);
+
+    PhraseArray phrases;
+    queryPhrases (*database, pinyin, phrases);
+    g_assert_cmpint (phrases.size (), >, 1);
+    const string first = phrases[0].phrase;
+    const Phrase phrase = phrases.back ();
+
+    // The same query again comes from the cache.
+    size_t hits = database->queryCacheHits ();
+    size_t misses = database->queryCacheMisses ();
+    queryPhrases (*database, pinyin, phrases);
+    g_assert_cmpint (database->queryCacheHits (), ==, hits + 1);
+    g_assert_cmpint (database->queryCacheMisses (), ==, misses);
+
+    // A committed phrase drops the cached result, so it goes first.
+    database->commit (PhraseArray (1, phrase));
+    queryPhrases (*database, pinyin, phrases);
+    g_assert_cmpint (database->queryCacheMisses (), ==, misses + 1);
+    g_assert_cmpstr (phrases[0].phrase, ==, phrase.phrase);
+    g_assert_cmpint (phrases[0].user_freq, >, 0);
+
+    queryPhrases (*database, pinyin, phrases);
+    g_assert_cmpint (database->queryCacheHits (), ==, hits + 2);
+    g_assert_cmpstr (phrases[0].phrase, ==, phrase.phrase);
+
+    // So does a removed one, which goes back to its place.
+    database->remove (phrase);
+    queryPhrases (*database, pinyin, phrases);
+    g_assert_cmpint (database->queryCacheMisses (), ==, misses + 2);
+    g_assert_cmpstring (first, ==, phrases[0].phrase);
+    g_assert_cmpstr (phrases.back ().phrase, ==, phrase.phrase);
+    g_assert_cmpint (phrases.back ().user_freq, ==, 0);
+}
+
+void testQueryStmts ()
+{
+    const string user_dir = getTestDir () + G_DIR_SEPARATOR_S + "stmts";
+    DatabasePtr database = Database::instance (user_dir);
+    const unsigned int option = PINYIN_INCOMPLETE_PINYIN | PINYIN_CORRECT_ALL;
+    const char *texts[] = { "shi", "ta", "ni", "wo", "de", "ren", "da", "li" };
+    vector<PinyinArray> pinyins (G_N_ELEMENTS (texts));
+    for (size_t i = 0; i < G_N_ELEMENTS (texts); ++i) {
+        const String text (texts[i]);
+        PinyinParser::parse (text, text.size (), option, pinyins[i],
+                             MAX_PHRASE_LEN);
+    }
+
+    // Queries of one shape running at once each take a stmt of the shape.
+    Phrase phrase;
+    vector<PhraseStreamPtr> streams;
+    for (size_t i = 0; i < 3; ++i) {
+        streams.push_back (
+            database->query (pinyins[i], 0, pinyins[i].size (), 20, option));
+        g_assert (streams.back ()->next (phrase));
+    }
+    const size_t prepares = database->queryPrepares ();
+    g_assert_cmpint (prepares, >, 0);
+    g_assert_cmpint (prepares, <=, 4);
+    streams.clear ();
+
+    // The queries after them reuse those stmts.
+    for (size_t i = 0; i < pinyins.size (); ++i) {
+        PhraseStreamPtr stream =
+            database->query (pinyins[i], 0, pinyins[i].size (), 20, option);
+        g_assert (stream->next (phrase));
+    }
+    g_assert_cmpint (database->queryPrepares (), ==, prepares);
+
+    // Cached results keep no stmt busy, while their streams are read or
+    // after they are dropped, so the next queries of the shape reuse one.
+    for (size_t i = 0; i < pinyins.size (); ++i) {
+        streams.push_back (
+            database->query (pinyins[i], 0, pinyins[i].size (), -1, option));
+        g_assert (streams.back ()->next (phrase));
+    }
+    g_assert_cmpint (database->queryPrepares (), ==, prepares);
+    streams.clear ();
+    for (size_t i = 0; i < pinyins.size (); ++i) {
+        PhraseStreamPtr stream =
+            database->query (pinyins[i], 0, pinyins[i].size (), -1, option);
+        g_assert (stream->next (phrase));
+    }
+    g_assert_cmpint (database->queryPrepares (), ==, prepares);
+
+    // Reading past the cached rows queries the rest.
+    PhraseArray phrases;
+    queryPhrases (*database, pinyins[0], phrases);
+    PhraseArray again;
+    queryPhrases (*database, pinyins[0], again);
+    g_assert_cmpint (phrases.size (), >, 64);
+    g_assert_cmpint (again.size (), ==, phrases.size ());
+    for (size_t i = 0; i < phrases.size (); ++i)
+        g_assert_cmpstr (again[i].phrase, ==, phrases[i].phrase);
+}
+
+unsigned int userFreq (Database &database, const PinyinArray &pinyin,
+                       const char *text)
+{
+    PhraseArray phrases;
+    queryPhrases (database, pinyin, phrases);
+    for (size_t i = 0; i < phrases.size (); ++i) {
+        if (strcmp (phrases[i].phrase, text) == 0)
+            return phrases[i].user_freq;
+    }
+    g_assert_not_reached ();
+    return 0;
+}
+
+void testUserJournal ()
+{
+    const string crash_dir = getTestDir () + G_DIR_SEPARATOR_S + "crash";
+    const string user_dir = getTestDir () + G_DIR_SEPARATOR_S + "journal";
+    const string crash_journal =
+        crash_dir + G_DIR_SEPARATOR_S + "user-1.0.journal";
+    const string journal = user_dir + G_DIR_SEPARATOR_S + "user-1.0.journal";
+    const unsigned int option = PINYIN_INCOMPLETE_PINYIN | PINYIN_CORRECT_ALL;
+    const String text ("shiyan");
+    PinyinArray pinyin;
+    PinyinParser::parse (text, text.size (), option, pinyin, MAX_PHRASE_LEN);
+
+    // An empty user database, and the journal of a commit not written to
+    // the database yet, as a crash would leave them.
+    DatabasePtr database = Database::instance (user_dir);
+    database.reset ();
+
+    database = Database::instance (crash_dir);
+    PhraseArray phrases;
+    queryPhrases (*database, pinyin, phrases);
+    const Phrase phrase = phrases.back ();
+    g_assert_cmpint (phrase.user_freq, ==, 0);
+    database->commit (PhraseArray (1, phrase));
+    const unsigned int user_freq = userFreq (*database, pinyin, phrase.phrase);
+    g_assert_cmpint (user_freq, >, 0);
+
+    gchar *contents = NULL;
+    gsize length = 0;
+    for (size_t i = 0; i < 100 && length == 0; ++i) {
+        g_free (contents);
+        contents = NULL;
+        g_usleep (10000);
+        g_assert (g_file_get_contents (crash_journal.c_str (), &contents,
+                                       &length, NULL));
+    }
+    g_assert_cmpint (length, >, 0);
+    const string records (contents, length);
+    g_free (contents);
+    database.reset ();
+
+    // The next start replays the records.
+    g_assert (g_file_set_contents (journal.c_str (), records.data (),
+                                   records.size (), NULL));
+    database = Database::instance (user_dir);
+    g_assert_cmpint (userFreq (*database, pinyin, phrase.phrase), ==, user_freq);
+    database.reset ();
+
+    // Only once, the journal is empty then.
+    database = Database::instance (user_dir);
+    g_assert_cmpint (userFreq (*database, pinyin, phrase.phrase), ==, user_freq);
+    database.reset ();
+    g_assert (g_file_get_contents (journal.c_str (), &contents, &length, NULL));
+    g_assert_cmpint (length, ==, 0);
+    g_free (contents);
+
+    // The records already in the database are skipped.
+    g_assert (g_file_set_contents (journal.c_str (), records.data (),
+                                   records.size (), NULL));
+    database = Database::instance (user_dir);
+    g_assert_cmpint (userFreq (*database, pinyin, phrase.phrase), ==, user_freq);
+    database.reset ();
+}
+
+string joinPinyin (const PinyinArray &pinyin)
+{
+    string text;
+    for (size_t i = 0; i < pinyin.size (); ++i) {
+        if (i > 0)
+            text += '\'';
+        text += pinyin[i]->text;
+    }
+    return text;
+}
+
+vector<string> latticePaths (const string &text, size_t n,
+                             vector<int> &scores)
+{
+    const unsigned int option = PINYIN_INCOMPLETE_PINYIN | PINYIN_CORRECT_ALL;
+    PinyinLattice lattice;
+    PinyinParser::parseLattice (text, text.size (), option, lattice);
+
+    vector<PinyinArray> paths;
+    scores.clear ();
+    g_assert_cmpint (lattice.bestPaths (n, paths, scores), ==, paths.size ());
+    g_assert_cmpint (scores.size (), ==, paths.size ());
+
+    vector<string> result;
+    for (size_t i = 0; i < paths.size (); ++i)
+        result.push_back (joinPinyin (paths[i]));
+    return result;
+}
+
+void testPinyinLattice ()
+{
+    const unsigned int option = PINYIN_INCOMPLETE_PINYIN | PINYIN_CORRECT_ALL;
+    vector<int> scores;
+    vector<string> paths;
+
+    paths = latticePaths ("xian", 16, scores);
+    g_assert (find (paths.begin (), paths.end (), "xian") != paths.end ());
+    g_assert (find (paths.begin (), paths.end (), "xi'an") != paths.end ());
+
+    paths = latticePaths ("fangan", 16, scores);
+    g_assert (find (paths.begin (), paths.end (), "fang'an") != paths.end ());
+    g_assert (find (paths.begin (), paths.end (), "fan'gan") != paths.end ());
+
+    // parse () re-splits fang'ang to fan'gang with the special table, the
+    // lattice keeps both.
+    paths = latticePaths ("fangang", 16, scores);
+    g_assert (find (paths.begin (), paths.end (), "fan'gang") != paths.end ());
+    g_assert (find (paths.begin (), paths.end (), "fang'ang") != paths.end ());
+
+    // The segmentation of parse () ranks first, the others follow by score.
+    const char *texts[] = { "xian", "fangan", "fangang", "nihao", "zhongguoren" };
+    for (size_t i = 0; i < G_N_ELEMENTS (texts); ++i) {
+        const String text (texts[i]);
+        PinyinArray parsed;
+        PinyinParser::parse (text, text.size (), option, parsed, MAX_PHRASE_LEN);
+
+        paths = latticePaths (texts[i], 3, scores);
+        g_assert_cmpint (paths.size (), ==, 3);
+        g_assert_cmpstring (paths[0], ==, joinPinyin (parsed).c_str ());
+        for (size_t j = 1; j < paths.size (); ++j) {
+            g_assert (paths[j] != paths[j - 1]);
+            g_assert_cmpint (scores[j - 1], >=, scores[j]);
+        }
+    }
+}
+
+void testSpecialPhraseTable ()
+{
+    const SpecialPhraseTable &table = SpecialPhraseTable::instance ();
+    vector<string> by_node;
+    vector<string> by_string;
+
+    // Walking the trie finds what the whole command does.
+    const char *commands[] = {
+        "aazhi", "haha", "tixu", "tixushan", "txu", "tix", "t", "tixz", "zzz",
+    };
+    for (size_t i = 0; i < G_N_ELEMENTS (commands); ++i) {
+        const string command = commands[i];
+        size_t node = 0;
+        for (size_t j = 0; j < command.size () && (j == 0 || node != 0); ++j)
+            node = table.child (node, command[j]);
+        const bool found = table.lookup (command, by_string);
+        g_assert (table.lookup (node, by_node) == found);
+        g_assert (by_node == by_string);
+        g_assert (found == !by_string.empty ());
+    }
+    g_assert (table.lookup ("haha", by_string));
+    g_assert_cmpint (by_string.size (), ==, 2);
+    g_assert (!table.lookup ("tix", by_string));
+    g_assert (!table.lookup ("tixz", by_string));
+
+    // The longer commands of a prefix come in byte order, at most max.
+    const size_t t = table.child (0, 't');
+    g_assert (t != 0);
+    vector<string> hints (1, "hint");
+    g_assert_cmpint (table.complete (t, 2, hints), ==, 2);
+    g_assert_cmpint (hints.size (), ==, 3);
+    g_assert_cmpstring (hints[1], ==, "ixu");
+    g_assert_cmpstring (hints[2], ==, "ixushan");
+
+    hints.clear ();
+    g_assert_cmpint (table.complete (t, 100, hints), ==, 4);
+    g_assert_cmpstring (hints[0], ==, "ixu");
+    g_assert_cmpstring (hints[1], ==, "ixushan");
+    g_assert_cmpstring (hints[2], ==, "xingtai");
+    g_assert_cmpstring (hints[3], ==, "xu");
+    g_assert (is_sorted (hints.begin (), hints.end ()));
+
+    // The context walks only the characters after the prefix the command
+    // shares with the last one, and a command diverging from that prefix
+    // gets no phrases of the last one.
+    DummyObserver observer;
+    unique_ptr<InputContext> context (
+        InputContext::create (InputContext::FULL_PINYIN, &observer));
+    insertKeys (context.get (), "tixushan");
+    g_assert_cmpstring (context->conversionText (), ==, "T恤衫");
+    for (size_t i = 0; i < 4; ++i)
+        context->removeCharBefore ();
+    g_assert_cmpstring (context->conversionText (), ==, "T恤");
+    for (size_t i = 0; i < 3; ++i)
+        context->removeCharBefore ();
+    insertKeys (context.get (), "xu");
+    g_assert_cmpstring (context->inputText (), ==, "txu");
+    g_assert_cmpstring (context->conversionText (), ==, "T恤");
+
+    context->reset ();
+    insertKeys (context.get (), "bchao");
+    g_assert_cmpstring (context->conversionText (), ==, "B超");
+    for (size_t i = 0; i < 4; ++i)
+        context->removeCharBefore ();
+    insertKeys (context.get (), "gu");
+    g_assert_cmpstring (context->conversionText (), ==, "B股");
+    for (size_t i = 0; i < 2; ++i)
+        context->removeCharBefore ();
+    insertKeys (context.get (), "ing");
+    Candidate candidate;
+    for (size_t i = 0; context->getCandidate (i, candidate); ++i) {
+        g_assert_cmpstring (candidate.text, !=, "B股");
+        g_assert_cmpstring (candidate.text, !=, "B超");
+    }
+
+    // The longer commands of the typed prefix are hints.
+    context->reset ();
+    insertKeys (context.get (), "t");
+    g_assert_cmpstring (context->auxiliaryText (), ==,
+                        "t| [tixu tixushan txingtai txu]");
+    insertKeys (context.get (), "ix");
+    g_assert_cmpstring (context->auxiliaryText (), ==,
+                        "ti x| [tixu tixushan]");
+    insertKeys (context.get (), "u");
+    g_assert_cmpstring (context->auxiliaryText (), ==, "tixu| [tixushan]");
+    insertKeys (context.get (), "shan");
+    g_assert_cmpstring (context->auxiliaryText (), ==, "tixushan|");
+    context->reset ();
+    insertKeys (context.get (), "nihao");
+    g_assert_cmpstring (context->auxiliaryText (), ==, "ni hao|");
+}
+
 void setUp ()
 {
     const string test_dir = getTestDir ();
@@ -1098,5 +1582,31 @@ int main (int argc, char **argv)
     testCommit();
     tearDown();
 
+    setUp();
+    testUserDatabases();
+    tearDown();
+
+    setUp();
+    testConverter();
+    tearDown();
+
+    setUp();
+    testQueryCache();
+    tearDown();
+
+    setUp();
+    testQueryStmts();
+    tearDown();
+
+    setUp();
+    testUserJournal();
+    tearDown();
+
+    setUp();
+    testSpecialPhraseTable();
+    tearDown();
+
+    testPinyinLattice();
+
     return 0;
 }
@@ -0,0 +1,144 @@
+/* vim:set et ts=4 sts=4:
+ *
+ * libpyzy - The Chinese PinYin and Bopomofo conversion library.
+ *
+ * Copyright (c) 2008-2010 Peng Huang <shawn.p.huang@gmail.com>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301
+ * USA
+ */
+/*
+ * Converts full pinyin to phrases, one line at a time.
+ *
+ *   pyzy-convert [-j threads] [-t] [-d user_cache_dir] [file...]
+ *   pyzy-convert -s [-j threads] [file...]
+ *
+ * Reads the files, or the standard input, and writes the best conversion
+ * of every line to the standard output in the same order. With -s, the
+ * files are simplified Chinese documents converted to traditional Chinese.
+ */
+#include <glib.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include "Converter.h"
+#include "InputContext.h"
+#include "Util.h"  // for unique_ptr
+#include "Variant.h"
+
+using namespace std;
+using namespace PyZy;
+
+static void
+usage (const char *name)
+{
+    cerr << "Usage: " << name << " [-j threads] [-t] [-d user_cache_dir] [file...]" << endl
+         << "       " << name << " -s [-j threads] [file...]" << endl
+         << "  -j threads         convert with threads threads, one for every processor by default" << endl
+         << "  -t                 convert to traditional Chinese" << endl
+         << "  -d user_cache_dir  read the user phrases in user_cache_dir" << endl
+         << "  -s                 convert simplified Chinese documents to traditional Chinese" << endl;
+}
+
+static int
+simp_to_trad (int argc, char **argv, size_t threads)
+{
+    if (optind == argc)
+        return Converter::simpToTrad (0, 1, threads) ? 0 : 1;
+
+    int ret = 0;
+    for (int i = optind; i < argc; i++) {
+        int fd = open (argv[i], O_RDONLY);
+        if (fd < 0) {
+            cerr << argv[0] << ": can not open " << argv[i] << endl;
+            ret = 1;
+            continue;
+        }
+        if (!Converter::simpToTrad (fd, 1, threads))
+            ret = 1;
+        close (fd);
+    }
+    return ret;
+}
+
+int main (int argc, char **argv)
+{
+    size_t threads = 0;
+    bool trad = false;
+    bool document = false;
+    string user_cache_dir;
+
+    int opt;
+    while ((opt = getopt (argc, argv, "j:td:sh")) != -1) {
+        switch (opt) {
+        case 'j':
+            threads = strtoul (optarg, NULL, 10);
+            break;
+        case 't':
+            trad = true;
+            break;
+        case 'd':
+            user_cache_dir = optarg;
+            break;
+        case 's':
+            document = true;
+            break;
+        default:
+            usage (argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    /* no pinyin, so no database */
+    if (document)
+        return simp_to_trad (argc, argv, threads);
+
+    if (user_cache_dir.empty ()) {
+        InputContext::init ();
+    }
+    else {
+        char *config_dir =
+            g_build_filename (g_get_user_config_dir (), "pyzy", NULL);
+        InputContext::init (user_cache_dir, config_dir);
+        g_free (config_dir);
+    }
+
+    int ret = 0;
+    {
+        unique_ptr<Converter> converter (Converter::create ());
+        converter->setProperty (InputContext::PROPERTY_MODE_SIMP,
+                                Variant::fromBool (!trad));
+
+        if (optind == argc)
+            converter->convert (cin, cout, threads);
+
+        for (int i = optind; i < argc; i++) {
+            ifstream in (argv[i]);
+            if (!in) {
+                cerr << argv[0] << ": can not open " << argv[i] << endl;
+                ret = 1;
+                continue;
+            }
+            converter->convert (in, cout, threads);
+        }
+    }
+
+    InputContext::finalize ();
+    return ret;
+}